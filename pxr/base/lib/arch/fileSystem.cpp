@@ -37,6 +37,8 @@
 #include <cstdlib>
 #include <cerrno>
 #include <memory>
+#include <thread>
+#include <vector>
 
 #include <fcntl.h>
 #include <sys/types.h>
@@ -439,7 +441,8 @@ Arch_Unmapper::operator()(char *mapStart) const
 
 template <class Mapping>
 static inline Mapping
-Arch_MapFileImpl(FILE *file, std::string *errMsg)
+Arch_MapFileImpl(FILE *file, ArchFileMappingOptions const &options,
+                 std::string *errMsg)
 {
     using PtrType = typename Mapping::pointer;
     constexpr bool isConst =
@@ -466,11 +469,29 @@ Arch_MapFileImpl(FILE *file, std::string *errMsg)
     CloseHandle(hFileMap);
     return Mapping(ptr, Arch_Unmapper(length));
 #else // Assume POSIX
+    int flags = MAP_PRIVATE;
+#if defined(MAP_POPULATE)
+    if (options.populate) {
+        flags |= MAP_POPULATE;
+    }
+#endif
     auto m = mmap(nullptr, length,
                   isConst ? PROT_READ : PROT_READ | PROT_WRITE,
-                  MAP_PRIVATE, fileno(file), 0);
+                  flags, fileno(file), 0);
     Mapping ret(m == MAP_FAILED ? nullptr : static_cast<PtrType>(m),
                 Arch_Unmapper(length));
+    if (ret) {
+#if defined(MADV_HUGEPAGE)
+        // Huge pages are strictly a hint; failure (e.g. on kernels built
+        // without transparent huge page support) is silently ignored.
+        if (options.requestHugePages) {
+            madvise(m, length, MADV_HUGEPAGE);
+        }
+#endif
+        if (options.advice != ArchMemAdviceNormal) {
+            ArchMemAdvise(m, length, options.advice);
+        }
+    }
     if (!ret && errMsg) {
         int err = errno;
         if (err == EINVAL) {
@@ -489,13 +510,29 @@ Arch_MapFileImpl(FILE *file, std::string *errMsg)
 ArchConstFileMapping
 ArchMapFileReadOnly(FILE *file, std::string *errMsg)
 {
-    return Arch_MapFileImpl<ArchConstFileMapping>(file, errMsg);
+    return Arch_MapFileImpl<ArchConstFileMapping>(
+        file, ArchFileMappingOptions(), errMsg);
+}
+
+ArchConstFileMapping
+ArchMapFileReadOnly(FILE *file, ArchFileMappingOptions const &options,
+                    std::string *errMsg)
+{
+    return Arch_MapFileImpl<ArchConstFileMapping>(file, options, errMsg);
 }
 
 ArchMutableFileMapping
 ArchMapFileReadWrite(FILE *file, std::string *errMsg)
 {
-    return Arch_MapFileImpl<ArchMutableFileMapping>(file, errMsg);
+    return Arch_MapFileImpl<ArchMutableFileMapping>(
+        file, ArchFileMappingOptions(), errMsg);
+}
+
+ArchMutableFileMapping
+ArchMapFileReadWrite(FILE *file, ArchFileMappingOptions const &options,
+                     std::string *errMsg)
+{
+    return Arch_MapFileImpl<ArchMutableFileMapping>(file, options, errMsg);
 }
 
 ARCH_API
@@ -515,7 +552,8 @@ void ArchMemAdvise(void const *addr, size_t len, ArchMemAdvice adv)
         /* ArchMemAdviceNormal       = */ POSIX_MADV_NORMAL,
         /* ArchMemAdviceWillNeed     = */ POSIX_MADV_WILLNEED,
         /* ArchMemAdviceDontNeed     = */ POSIX_MADV_DONTNEED,
-        /* ArchMemAdviceRandomAccess = */ POSIX_MADV_RANDOM
+        /* ArchMemAdviceRandomAccess = */ POSIX_MADV_RANDOM,
+        /* ArchMemAdviceSequential   = */ POSIX_MADV_SEQUENTIAL
     };
 
     int rval = posix_madvise(reinterpret_cast<void *>(alignedAddrInt),
@@ -602,6 +640,94 @@ ArchPRead(FILE *file, void *buffer, size_t count, int64_t offset)
 #endif
 }
 
+namespace {
+
+// Read one request's extent, reading and discarding through a scratch
+// buffer if the request has no destination.  Return bytes read or -1.
+int64_t
+Arch_ReadRequest(FILE *file, ArchPReadRequest const &req,
+                 std::unique_ptr<char[]> *scratch)
+{
+    if (req.buffer) {
+        return ArchPRead(file, req.buffer, req.count, req.offset);
+    }
+
+    constexpr size_t scratchSize = 512 * 1024;
+    if (!*scratch) {
+        scratch->reset(new char[scratchSize]);
+    }
+    int64_t total = 0;
+    int64_t offset = req.offset;
+    size_t remaining = req.count;
+    while (remaining) {
+        size_t chunk = remaining < scratchSize ? remaining : scratchSize;
+        int64_t nread = ArchPRead(file, scratch->get(), chunk, offset);
+        if (nread < 0) {
+            return -1;
+        }
+        if (nread == 0) {
+            break; // End of file.
+        }
+        total += nread;
+        offset += nread;
+        remaining -= nread;
+    }
+    return total;
+}
+
+} // anonymous namespace
+
+int64_t
+ArchPReadMultiple(FILE *file, ArchPReadRequest const *requests,
+                  size_t numRequests)
+{
+    constexpr size_t maxThreads = 8;
+    size_t numThreads = numRequests < maxThreads ? numRequests : maxThreads;
+
+    if (numThreads <= 1) {
+        std::unique_ptr<char[]> scratch;
+        int64_t total = 0;
+        for (size_t i = 0; i != numRequests; ++i) {
+            int64_t nread = Arch_ReadRequest(file, requests[i], &scratch);
+            if (nread < 0) {
+                return -1;
+            }
+            total += nread;
+        }
+        return total;
+    }
+
+    std::atomic<size_t> nextRequest(0);
+    std::atomic<int64_t> totalRead(0);
+    std::atomic<bool> failed(false);
+
+    auto worker = [&]() {
+        std::unique_ptr<char[]> scratch;
+        size_t i;
+        while ((i = nextRequest.fetch_add(1)) < numRequests &&
+               !failed.load(std::memory_order_relaxed)) {
+            int64_t nread = Arch_ReadRequest(file, requests[i], &scratch);
+            if (nread < 0) {
+                failed = true;
+            } else {
+                totalRead += nread;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numThreads - 1);
+    for (size_t i = 0; i != numThreads - 1; ++i) {
+        threads.emplace_back(worker);
+    }
+    worker();
+    for (auto &thread: threads) {
+        thread.join();
+    }
+
+    return failed ? -1 : totalRead.load();
+}
+
 int64_t
 ArchPWrite(FILE *file, void const *bytes, size_t count, int64_t offset)
 {
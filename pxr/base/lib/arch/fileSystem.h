@@ -330,8 +330,41 @@ enum ArchMemAdvice {
     ArchMemAdviceWillNeed,     // OS may prefetch this range.
     ArchMemAdviceDontNeed,     // OS may free resources related to this range.
     ArchMemAdviceRandomAccess, // Prefetching may not be beneficial.
+    ArchMemAdviceSequential,   // OS may aggressively read ahead.
 };
 
+/// \struct ArchFileMappingOptions
+///
+/// Options controlling how ArchMapFileReadOnly() and ArchMapFileReadWrite()
+/// establish a mapping.  All of these are optimization hints; platforms that
+/// do not support a given hint silently ignore it, and program semantics are
+/// unaffected either way.
+struct ArchFileMappingOptions {
+    /// Memory access advice to apply to the new mapping.  See ArchMemAdvice.
+    ArchMemAdvice advice = ArchMemAdviceNormal;
+
+    /// Request that the mapping be backed by transparent huge pages where
+    /// the system supports them, reducing page fault counts and TLB pressure
+    /// for large files.
+    bool requestHugePages = false;
+
+    /// Request that the mapped pages be populated (pre-faulted) as part of
+    /// establishing the mapping, rather than faulted in on first access.
+    bool populate = false;
+};
+
+/// Like ArchMapFileReadOnly() but apply the given mapping \p options.
+ARCH_API
+ArchConstFileMapping
+ArchMapFileReadOnly(FILE *file, ArchFileMappingOptions const &options,
+                    std::string *errMsg=nullptr);
+
+/// Like ArchMapFileReadWrite() but apply the given mapping \p options.
+ARCH_API
+ArchMutableFileMapping
+ArchMapFileReadWrite(FILE *file, ArchFileMappingOptions const &options,
+                     std::string *errMsg=nullptr);
+
 /// Advise the OS regarding how the application intends to access a range of
 /// memory.  See ArchMemAdvice.  This is primarily useful for mapped file
 /// regions.  This call does not change program semantics.  It is only an
@@ -363,6 +396,27 @@ ArchQueryMappedMemoryResidency(
 ARCH_API
 int64_t ArchPRead(FILE *file, void *buffer, size_t count, int64_t offset);
 
+/// \struct ArchPReadRequest
+///
+/// A single extent for ArchPReadMultiple().  If \p buffer is null the extent
+/// is read and discarded, which serves to populate the file system cache for
+/// a subsequent read of the same extent.
+struct ArchPReadRequest {
+    void *buffer;   // Destination, or nullptr to read and discard.
+    size_t count;   // Number of bytes to read.
+    int64_t offset; // File offset to read from.
+};
+
+/// Read a batch of extents from \p file, as if by calling ArchPRead() for
+/// each element of \p requests.  The reads are issued concurrently from a
+/// small pool of threads, so that requests to high-latency storage overlap
+/// rather than serialize; callers can also overlap their own processing of
+/// completed extents with the remaining I/O by splitting work into multiple
+/// calls.  Return the total number of bytes read, or -1 if any read fails.
+ARCH_API
+int64_t ArchPReadMultiple(FILE *file, ArchPReadRequest const *requests,
+                          size_t numRequests);
+
 /// Write up to \p count bytes from \p buffer to \p file at \p offset.  The file
 /// position indicator for \p file is not changed.  Return the number of bytes
 /// written, possibly zero if none written.  Return -1 in case of an error, with
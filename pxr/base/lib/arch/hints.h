@@ -48,4 +48,27 @@
 
 #endif
 
+/// \c ARCH_SPIN_PAUSE() emits a hint to the processor that the calling
+/// thread is in a spin-wait loop.  On x86 this issues the 'pause'
+/// instruction, which reduces power consumption and frees pipeline
+/// resources for a sibling hyperthread (such as the thread whose result is
+/// being waited for); on other architectures it is a no-op.  Use this in
+/// the body of short spin loops on shared memory locations.
+
+#if defined(ARCH_COMPILER_GCC) || defined(ARCH_COMPILER_CLANG)
+
+#if defined(ARCH_CPU_INTEL)
+#define ARCH_SPIN_PAUSE() __builtin_ia32_pause()
+#elif defined(ARCH_CPU_ARM)
+#define ARCH_SPIN_PAUSE() asm volatile ("yield" ::: "memory")
+#else
+#define ARCH_SPIN_PAUSE()
+#endif
+
+#else
+
+#define ARCH_SPIN_PAUSE()
+
+#endif
+
 #endif // ARCH_HINTS_H
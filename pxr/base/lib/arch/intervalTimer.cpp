@@ -0,0 +1,198 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#include "pxr/pxr.h"
+#include "pxr/base/arch/intervalTimer.h"
+#include "pxr/base/arch/hints.h"
+
+#include <unordered_map>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+static const unsigned _NumBuckets = 64;
+
+// Per-thread accumulation buffer.  Written only by its owning thread;
+// readers aggregate with relaxed loads, which is sufficient for reporting.
+struct ArchTimerAccumulator::_ThreadData
+{
+    _ThreadData() : next(nullptr), count(0), totalTicks(0) {
+        for (unsigned i = 0; i != _NumBuckets; ++i)
+            buckets[i].store(0, std::memory_order_relaxed);
+    }
+
+    _ThreadData *next;
+    std::atomic<uint64_t> count;
+    std::atomic<uint64_t> totalTicks;
+    // buckets[i] counts intervals with floor(log2(ticks)) == i.
+    std::atomic<uint64_t> buckets[_NumBuckets];
+};
+
+namespace {
+
+// Identify accumulators by a unique id rather than by address, so a thread's
+// cached lookup can never alias a destroyed accumulator whose storage was
+// reused.
+std::atomic<uint64_t> _nextAccumulatorId(1);
+
+// One-entry cache in front of the per-thread map for the common case of
+// repeatedly recording into the same accumulator.  Typed as void * since
+// _ThreadData is private to the accumulator.
+thread_local uint64_t _cachedId = 0;
+thread_local void *_cachedData = nullptr;
+
+// Return floor(log2(ticks)), taking 0 -> 0.
+inline unsigned
+_Bucket(uint64_t ticks)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return ticks ? 63 - __builtin_clzll(ticks) : 0;
+#else
+    unsigned b = 0;
+    while (ticks >>= 1)
+        ++b;
+    return b;
+#endif
+}
+
+} // anonymous namespace
+
+ArchTimerAccumulator::ArchTimerAccumulator()
+    : _threadData(nullptr)
+    , _id(_nextAccumulatorId.fetch_add(1, std::memory_order_relaxed))
+{
+}
+
+ArchTimerAccumulator::~ArchTimerAccumulator()
+{
+    _ThreadData *data = _threadData.load(std::memory_order_acquire);
+    while (data) {
+        _ThreadData *next = data->next;
+        delete data;
+        data = next;
+    }
+}
+
+ArchTimerAccumulator::_ThreadData *
+ArchTimerAccumulator::_GetThreadData()
+{
+    static thread_local std::unordered_map<uint64_t, _ThreadData *> map;
+    _ThreadData *&data = map[_id];
+    if (!data) {
+        data = new _ThreadData;
+        // Publish on the accumulator's list so aggregation can find it.
+        _ThreadData *head = _threadData.load(std::memory_order_relaxed);
+        do {
+            data->next = head;
+        } while (!_threadData.compare_exchange_weak(
+                     head, data, std::memory_order_release));
+    }
+    _cachedId = _id;
+    _cachedData = data;
+    return data;
+}
+
+void
+ArchTimerAccumulator::Record(uint64_t ticks)
+{
+    _ThreadData *data = ARCH_LIKELY(_cachedId == _id)
+        ? static_cast<_ThreadData *>(_cachedData) : _GetThreadData();
+    data->count.fetch_add(1, std::memory_order_relaxed);
+    data->totalTicks.fetch_add(ticks, std::memory_order_relaxed);
+    data->buckets[_Bucket(ticks)].fetch_add(1, std::memory_order_relaxed);
+}
+
+uint64_t
+ArchTimerAccumulator::GetCount() const
+{
+    uint64_t count = 0;
+    for (_ThreadData *data = _threadData.load(std::memory_order_acquire);
+         data; data = data->next) {
+        count += data->count.load(std::memory_order_relaxed);
+    }
+    return count;
+}
+
+uint64_t
+ArchTimerAccumulator::GetTotalTicks() const
+{
+    uint64_t total = 0;
+    for (_ThreadData *data = _threadData.load(std::memory_order_acquire);
+         data; data = data->next) {
+        total += data->totalTicks.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+uint64_t
+ArchTimerAccumulator::GetPercentileTicks(double percentile) const
+{
+    // Merge the per-thread histograms.
+    uint64_t buckets[_NumBuckets] = { 0 };
+    uint64_t count = 0;
+    for (_ThreadData *data = _threadData.load(std::memory_order_acquire);
+         data; data = data->next) {
+        for (unsigned i = 0; i != _NumBuckets; ++i) {
+            uint64_t n = data->buckets[i].load(std::memory_order_relaxed);
+            buckets[i] += n;
+            count += n;
+        }
+    }
+    if (count == 0)
+        return 0;
+
+    if (percentile < 0.0)
+        percentile = 0.0;
+    if (percentile > 100.0)
+        percentile = 100.0;
+
+    // Find the bucket holding the requested rank and interpolate linearly
+    // within its [2^i, 2^(i+1)) span.
+    double rank = percentile / 100.0 * count;
+    uint64_t seen = 0;
+    for (unsigned i = 0; i != _NumBuckets; ++i) {
+        if (buckets[i] == 0)
+            continue;
+        if (seen + buckets[i] >= rank) {
+            double frac = (rank - seen) / buckets[i];
+            uint64_t lo = i == 0 ? 0 : (UINT64_C(1) << i);
+            uint64_t hi = UINT64_C(1) << (i + 1);
+            return lo + static_cast<uint64_t>(frac * (hi - lo));
+        }
+        seen += buckets[i];
+    }
+    return UINT64_C(1) << (_NumBuckets - 1);
+}
+
+void
+ArchTimerAccumulator::Reset()
+{
+    for (_ThreadData *data = _threadData.load(std::memory_order_acquire);
+         data; data = data->next) {
+        data->count.store(0, std::memory_order_relaxed);
+        data->totalTicks.store(0, std::memory_order_relaxed);
+        for (unsigned i = 0; i != _NumBuckets; ++i)
+            data->buckets[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
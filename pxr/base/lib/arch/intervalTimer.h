@@ -0,0 +1,123 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef ARCH_INTERVAL_TIMER_H
+#define ARCH_INTERVAL_TIMER_H
+
+/// \file arch/intervalTimer.h
+/// \ingroup group_arch_SystemFunctions
+/// Scoped interval timing with lock-free per-thread accumulation.
+
+#include "pxr/pxr.h"
+#include "pxr/base/arch/api.h"
+#include "pxr/base/arch/timing.h"
+
+#include <atomic>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class ArchTimerAccumulator
+/// \ingroup group_arch_SystemFunctions
+///
+/// Accumulates interval measurements from any number of threads without
+/// locking.  Each recording thread writes into its own buffer, so Record()
+/// costs a few relaxed atomic increments on an uncontended cache line and
+/// never takes a mutex.  In addition to the count and total, each buffer
+/// holds a histogram with power-of-two bucket boundaries, from which
+/// GetPercentileTicks() computes approximate percentiles (accurate to
+/// within one bucket, i.e. a factor of two) without storing individual
+/// samples.
+///
+/// Aggregation methods may be called concurrently with recording; they
+/// observe a consistent-enough snapshot for reporting purposes.  The
+/// accumulator must outlive all threads' use of it.
+///
+class ArchTimerAccumulator
+{
+    ArchTimerAccumulator(ArchTimerAccumulator const &) = delete;
+    ArchTimerAccumulator &operator=(ArchTimerAccumulator const &) = delete;
+public:
+    ARCH_API ArchTimerAccumulator();
+    ARCH_API ~ArchTimerAccumulator();
+
+    /// Record an interval of \p ticks, as measured by ArchGetTickTime().
+    /// Lock-free; safe to call concurrently from any number of threads.
+    ARCH_API void Record(uint64_t ticks);
+
+    /// Return the number of intervals recorded so far, across all threads.
+    ARCH_API uint64_t GetCount() const;
+
+    /// Return the sum of all recorded intervals, in ticks.
+    ARCH_API uint64_t GetTotalTicks() const;
+
+    /// Return an approximation of the \p percentile (in [0, 100]) of the
+    /// recorded intervals, in ticks.  The result is interpolated within a
+    /// power-of-two histogram bucket, so it is accurate to within a factor
+    /// of two.  Return 0 if nothing has been recorded.
+    ARCH_API uint64_t GetPercentileTicks(double percentile) const;
+
+    /// Discard all recorded intervals.  Not thread-safe with respect to
+    /// concurrent Record() calls; intended for use between measurement
+    /// phases.
+    ARCH_API void Reset();
+
+private:
+    struct _ThreadData;
+    _ThreadData *_GetThreadData();
+
+    // Lock-free singly-linked list of per-thread buffers.
+    std::atomic<_ThreadData *> _threadData;
+    uint64_t _id;
+};
+
+/// \class ArchIntervalTimer
+/// \ingroup group_arch_SystemFunctions
+///
+/// Scoped timer that measures the interval from its construction to its
+/// destruction with ArchGetTickTime() and records it into the given
+/// ArchTimerAccumulator.
+///
+class ArchIntervalTimer
+{
+    ArchIntervalTimer(ArchIntervalTimer const &) = delete;
+    ArchIntervalTimer &operator=(ArchIntervalTimer const &) = delete;
+public:
+    /// Start timing, recording into \p accumulator at destruction.  If
+    /// \p accumulator is NULL, the timer does nothing.
+    explicit ArchIntervalTimer(ArchTimerAccumulator *accumulator)
+        : _accumulator(accumulator)
+        , _startTicks(ArchGetTickTime()) {}
+
+    ~ArchIntervalTimer() {
+        if (_accumulator)
+            _accumulator->Record(ArchGetTickTime() - _startTicks);
+    }
+
+private:
+    ArchTimerAccumulator *_accumulator;
+    uint64_t _startTicks;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // ARCH_INTERVAL_TIMER_H
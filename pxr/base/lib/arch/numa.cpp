@@ -0,0 +1,177 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#include "pxr/pxr.h"
+#include "pxr/base/arch/numa.h"
+#include "pxr/base/arch/defines.h"
+
+#if defined(ARCH_OS_LINUX)
+#include <sched.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#endif
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+#if defined(ARCH_OS_LINUX)
+
+// Read the contents of the (small) sysfs file at path, or return the empty
+// string if it cannot be read.
+static std::string
+Arch_ReadSysfsFile(char const *path)
+{
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        return std::string();
+    }
+    char buf[4096];
+    size_t n = fread(buf, 1, sizeof(buf) - 1, f);
+    fclose(f);
+    buf[n] = '\0';
+    return std::string(buf);
+}
+
+// Parse a sysfs cpulist string like "0-15,32-47" and add the named CPUs to
+// the given set.
+static void
+Arch_ParseCpuList(std::string const &cpuList, cpu_set_t *set)
+{
+    char const *p = cpuList.c_str();
+    while (*p) {
+        char *end = nullptr;
+        long first = strtol(p, &end, 10);
+        if (end == p) {
+            break;
+        }
+        long last = first;
+        if (*end == '-') {
+            p = end + 1;
+            last = strtol(p, &end, 10);
+        }
+        for (long cpu = first; cpu <= last; ++cpu) {
+            if (cpu >= 0 && cpu < CPU_SETSIZE) {
+                CPU_SET(cpu, set);
+            }
+        }
+        p = (*end == ',') ? end + 1 : end;
+    }
+}
+
+// Discover the per-node CPU sets from sysfs, once.  The returned vector has
+// one entry per NUMA node; it has a single full entry on machines where the
+// topology cannot be read.
+static std::vector<cpu_set_t> const &
+Arch_GetNodeCpuSets()
+{
+    static std::vector<cpu_set_t> const nodeCpuSets = []() {
+        std::vector<cpu_set_t> sets;
+        for (int node = 0; ; ++node) {
+            char path[128];
+            snprintf(path, sizeof(path),
+                     "/sys/devices/system/node/node%d/cpulist", node);
+            std::string cpuList = Arch_ReadSysfsFile(path);
+            if (cpuList.empty()) {
+                break;
+            }
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            Arch_ParseCpuList(cpuList, &set);
+            sets.push_back(set);
+        }
+        if (sets.empty()) {
+            // No topology information; treat the machine as one node
+            // spanning every CPU.
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            if (sched_getaffinity(0, sizeof(set), &set) != 0) {
+                for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+                    CPU_SET(cpu, &set);
+                }
+            }
+            sets.push_back(set);
+        }
+        return sets;
+    }();
+    return nodeCpuSets;
+}
+
+int
+ArchGetNumaNodeCount()
+{
+    return static_cast<int>(Arch_GetNodeCpuSets().size());
+}
+
+int
+ArchGetCurrentNumaNode()
+{
+    int cpu = sched_getcpu();
+    if (cpu < 0) {
+        return -1;
+    }
+    std::vector<cpu_set_t> const &sets = Arch_GetNodeCpuSets();
+    for (size_t node = 0; node != sets.size(); ++node) {
+        if (CPU_ISSET(cpu, &sets[node])) {
+            return static_cast<int>(node);
+        }
+    }
+    return -1;
+}
+
+bool
+ArchBindThreadToNumaNode(int node)
+{
+    std::vector<cpu_set_t> const &sets = Arch_GetNodeCpuSets();
+    if (node < 0 || static_cast<size_t>(node) >= sets.size()) {
+        return false;
+    }
+    return sched_setaffinity(0, sizeof(cpu_set_t), &sets[node]) == 0;
+}
+
+#else // not ARCH_OS_LINUX
+
+int
+ArchGetNumaNodeCount()
+{
+    // XXX: Not implemented for other platforms yet.
+    return 1;
+}
+
+int
+ArchGetCurrentNumaNode()
+{
+    return -1;
+}
+
+bool
+ArchBindThreadToNumaNode(int node)
+{
+    return false;
+}
+
+#endif
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,56 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef ARCH_NUMA_H
+#define ARCH_NUMA_H
+
+/// \file arch/numa.h
+/// \ingroup group_arch_Multithreading
+/// NUMA topology discovery and thread placement.
+
+#include "pxr/pxr.h"
+#include "pxr/base/arch/api.h"
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// Return the number of NUMA nodes on this machine.  On systems where the
+/// topology cannot be determined, or that have no NUMA support, return 1.
+/// \ingroup group_arch_Multithreading
+ARCH_API int ArchGetNumaNodeCount();
+
+/// Return the NUMA node that the calling thread is currently executing on,
+/// or -1 if it cannot be determined.
+/// \ingroup group_arch_Multithreading
+ARCH_API int ArchGetCurrentNumaNode();
+
+/// Restrict the calling thread to execute only on the CPUs belonging to
+/// NUMA node \p node.  With the common first-touch allocation policy this
+/// also makes the thread's subsequent memory allocations node-local.
+/// Return true on success.  On systems without NUMA support, or if \p node
+/// is out of range, do nothing and return false.
+/// \ingroup group_arch_Multithreading
+ARCH_API bool ArchBindThreadToNumaNode(int node);
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // ARCH_NUMA_H
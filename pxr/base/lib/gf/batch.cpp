@@ -0,0 +1,161 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#include "pxr/pxr.h"
+#include "pxr/base/gf/batch.h"
+
+#include "pxr/base/arch/defines.h"
+
+#if defined(ARCH_CPU_INTEL) && defined(__SSE2__)
+#include <emmintrin.h>
+#define GF_BATCH_USE_SSE2
+#endif
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+// An affine matrix has fourth column (0, 0, 0, 1), so points transform
+// without the homogeneous divide.
+static inline bool
+_IsAffine(GfMatrix4d const &m)
+{
+    return m[0][3] == 0.0 && m[1][3] == 0.0 &&
+           m[2][3] == 0.0 && m[3][3] == 1.0;
+}
+
+#ifdef GF_BATCH_USE_SSE2
+
+// Transform points in place by an affine matrix, computing in double
+// precision like the scalar GfMatrix4d::Transform does.  The x and y
+// result components are computed two wide; z is scalar.
+template <class Vec3>
+static void
+_TransformPointsAffineSse2(GfMatrix4d const &m, Vec3 *points, size_t n)
+{
+    const __m128d r0 = _mm_loadu_pd(&m[0][0]);
+    const __m128d r1 = _mm_loadu_pd(&m[1][0]);
+    const __m128d r2 = _mm_loadu_pd(&m[2][0]);
+    const __m128d r3 = _mm_loadu_pd(&m[3][0]);
+    const double m02 = m[0][2], m12 = m[1][2], m22 = m[2][2], m32 = m[3][2];
+
+    for (size_t i = 0; i != n; ++i) {
+        const double x = points[i][0];
+        const double y = points[i][1];
+        const double z = points[i][2];
+        __m128d xy = _mm_add_pd(
+            _mm_add_pd(_mm_mul_pd(_mm_set1_pd(x), r0),
+                       _mm_mul_pd(_mm_set1_pd(y), r1)),
+            _mm_add_pd(_mm_mul_pd(_mm_set1_pd(z), r2), r3));
+        double out[2];
+        _mm_storeu_pd(out, xy);
+        points[i].Set(static_cast<typename Vec3::ScalarType>(out[0]),
+                      static_cast<typename Vec3::ScalarType>(out[1]),
+                      static_cast<typename Vec3::ScalarType>(
+                          x * m02 + y * m12 + z * m22 + m32));
+    }
+}
+
+#endif // GF_BATCH_USE_SSE2
+
+void
+GfTransformPoints(GfMatrix4d const &m, GfVec3f *points, size_t numPoints)
+{
+    if (_IsAffine(m)) {
+#ifdef GF_BATCH_USE_SSE2
+        _TransformPointsAffineSse2(m, points, numPoints);
+#else
+        for (size_t i = 0; i != numPoints; ++i)
+            points[i] = m.TransformAffine(points[i]);
+#endif
+        return;
+    }
+    for (size_t i = 0; i != numPoints; ++i)
+        points[i] = m.Transform(points[i]);
+}
+
+void
+GfTransformPoints(GfMatrix4d const &m, GfVec3d *points, size_t numPoints)
+{
+    if (_IsAffine(m)) {
+#ifdef GF_BATCH_USE_SSE2
+        _TransformPointsAffineSse2(m, points, numPoints);
+#else
+        for (size_t i = 0; i != numPoints; ++i)
+            points[i] = m.TransformAffine(points[i]);
+#endif
+        return;
+    }
+    for (size_t i = 0; i != numPoints; ++i)
+        points[i] = m.Transform(points[i]);
+}
+
+void
+GfMultiplyMatrices(GfMatrix4d const *matrices, size_t numMatrices,
+                   GfMatrix4d const &rhs, GfMatrix4d *result)
+{
+#ifdef GF_BATCH_USE_SSE2
+    // Hoist the rhs rows (as lo/hi register pairs) out of the loop; each
+    // result row is a linear combination of them.
+    __m128d bLo[4], bHi[4];
+    for (int r = 0; r != 4; ++r) {
+        bLo[r] = _mm_loadu_pd(&rhs[r][0]);
+        bHi[r] = _mm_loadu_pd(&rhs[r][2]);
+    }
+    for (size_t i = 0; i != numMatrices; ++i) {
+        GfMatrix4d const &a = matrices[i];
+        for (int r = 0; r != 4; ++r) {
+            // Read the row's scalars before storing, so result may alias
+            // matrices.
+            const double a0 = a[r][0], a1 = a[r][1];
+            const double a2 = a[r][2], a3 = a[r][3];
+            __m128d lo = _mm_add_pd(
+                _mm_add_pd(_mm_mul_pd(_mm_set1_pd(a0), bLo[0]),
+                           _mm_mul_pd(_mm_set1_pd(a1), bLo[1])),
+                _mm_add_pd(_mm_mul_pd(_mm_set1_pd(a2), bLo[2]),
+                           _mm_mul_pd(_mm_set1_pd(a3), bLo[3])));
+            __m128d hi = _mm_add_pd(
+                _mm_add_pd(_mm_mul_pd(_mm_set1_pd(a0), bHi[0]),
+                           _mm_mul_pd(_mm_set1_pd(a1), bHi[1])),
+                _mm_add_pd(_mm_mul_pd(_mm_set1_pd(a2), bHi[2]),
+                           _mm_mul_pd(_mm_set1_pd(a3), bHi[3])));
+            _mm_storeu_pd(&result[i][r][0], lo);
+            _mm_storeu_pd(&result[i][r][2], hi);
+        }
+    }
+#else
+    for (size_t i = 0; i != numMatrices; ++i)
+        result[i] = matrices[i] * rhs;
+#endif
+}
+
+void
+GfInvertMatrices(GfMatrix4d const *matrices, size_t numMatrices,
+                 GfMatrix4d *result)
+{
+    // GetInverse() is already a single tight computation per matrix; the
+    // batch form exists so callers have one dispatch point as wider
+    // per-element kernels are added.
+    for (size_t i = 0; i != numMatrices; ++i)
+        result[i] = matrices[i].GetInverse();
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,74 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef GF_BATCH_H
+#define GF_BATCH_H
+
+/// \file gf/batch.h
+/// \ingroup group_gf_LinearAlgebra
+/// Batch kernels that apply a Gf operation across an array of elements.
+///
+/// These free functions produce the same results as calling the
+/// corresponding GfMatrix4d method element by element, but hoist
+/// per-element work (affine checks, matrix loads) out of the loop and use
+/// SIMD arithmetic where the build targets a CPU that supports it.  They
+/// are intended for hot paths that process large arrays, such as instance
+/// transform flattening and CPU primvar transformation.
+
+#include "pxr/pxr.h"
+#include "pxr/base/gf/api.h"
+#include "pxr/base/gf/matrix4d.h"
+#include "pxr/base/gf/vec3d.h"
+#include "pxr/base/gf/vec3f.h"
+
+#include <cstddef>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// Transform \p numPoints row vectors in place by \p m, treating each as a
+/// 4-component vector whose fourth component is 1, as if by calling
+/// \c m.Transform() on each element.
+GF_API
+void GfTransformPoints(GfMatrix4d const &m,
+                       GfVec3f *points, size_t numPoints);
+
+/// \overload
+GF_API
+void GfTransformPoints(GfMatrix4d const &m,
+                       GfVec3d *points, size_t numPoints);
+
+/// Compute <c>result[i] = matrices[i] * rhs</c> for each of the
+/// \p numMatrices input matrices.  \p result may alias \p matrices.
+GF_API
+void GfMultiplyMatrices(GfMatrix4d const *matrices, size_t numMatrices,
+                        GfMatrix4d const &rhs, GfMatrix4d *result);
+
+/// Compute <c>result[i] = matrices[i].GetInverse()</c> for each of the
+/// \p numMatrices input matrices.  \p result may alias \p matrices.
+GF_API
+void GfInvertMatrices(GfMatrix4d const *matrices, size_t numMatrices,
+                      GfMatrix4d *result);
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // GF_BATCH_H
@@ -901,6 +901,61 @@ GfFrustum::Intersects(const GfBBox3d &bbox) const
     return true;
 }
 
+void
+GfFrustum::IntersectsBatch(const GfBBox3d *bboxes, size_t numBBoxes,
+                           uint64_t *results) const
+{
+    // Recalculate frustum planes if necessary
+    _CalculateFrustumPlanes();
+
+    // Hoist the plane data out of the per-box loop.
+    const size_t numPlanes = _planes.size();
+    std::vector<GfVec3d> normals(numPlanes);
+    std::vector<double> distances(numPlanes);
+    for (size_t i = 0; i < numPlanes; i++) {
+        normals[i] = _planes[i].GetNormal();
+        distances[i] = _planes[i].GetDistanceFromOrigin();
+    }
+
+    for (size_t i = 0; i < numBBoxes; i++) {
+        if (i % 64 == 0)
+            results[i / 64] = 0;
+
+        GfBBox3d const &bbox = bboxes[i];
+        GfRange3d const &range = bbox.GetRange();
+        if (range.IsEmpty())
+            continue;
+
+        // Express the box as a world-space center point and three edge
+        // vectors.  A box intersects a plane's positive half space iff its
+        // most positive corner does, i.e. iff the center's distance plus
+        // the box's projected radius is non-negative.
+        GfMatrix4d const &localToWorld = bbox.GetMatrix();
+        GfVec3d const size = range.GetSize();
+        GfVec3d const center = localToWorld.Transform(range.GetMidpoint());
+        GfVec3d const edges[3] = {
+            localToWorld.TransformDir(GfVec3d(size[0], 0, 0)),
+            localToWorld.TransformDir(GfVec3d(0, size[1], 0)),
+            localToWorld.TransformDir(GfVec3d(0, 0, size[2])),
+        };
+
+        bool intersects = true;
+        for (size_t p = 0; p < numPlanes; p++) {
+            GfVec3d const &n = normals[p];
+            const double centerDist = GfDot(n, center) - distances[p];
+            const double radius = 0.5 * (GfAbs(GfDot(n, edges[0])) +
+                                         GfAbs(GfDot(n, edges[1])) +
+                                         GfAbs(GfDot(n, edges[2])));
+            if (centerDist + radius < 0) {
+                intersects = false;
+                break;
+            }
+        }
+        if (intersects)
+            results[i / 64] |= UINT64_C(1) << (i % 64);
+    }
+}
+
 bool
 GfFrustum::Intersects(const GfVec3d &point) const
 {
@@ -41,6 +41,7 @@
 
 #include <boost/functional/hash.hpp>
 
+#include <cstdint>
 #include <iosfwd>
 #include <vector>
 
@@ -520,6 +521,18 @@ class GfFrustum {
     /// frustum culling.
     GF_API bool         Intersects(const GfBBox3d &bbox) const;
 
+    /// Tests \p numBBoxes bounding boxes against the frustum and writes the
+    /// outcomes as a bitmask to \p results, which must have room for
+    /// (\p numBBoxes + 63) / 64 words; bit <c>i % 64</c> of word
+    /// <c>i / 64</c> is set iff <c>Intersects(bboxes[i])</c> would return
+    /// true.  The batched form hoists the per-plane setup out of the loop
+    /// and tests boxes with a center-and-extents computation instead of
+    /// transforming each plane per box, which makes CPU culling of large
+    /// draw lists substantially cheaper.
+    GF_API void         IntersectsBatch(const GfBBox3d *bboxes,
+                                        size_t numBBoxes,
+                                        uint64_t *results) const;
+
     /// Returns true if the given point is inside or intersecting the frustum.
     /// Otherwise, it returns false. 
     GF_API bool         Intersects(const GfVec3d &point) const;
@@ -23,13 +23,101 @@
 //
 
 #include "pxr/base/gf/half.h"
+#include "pxr/base/arch/defines.h"
 #include "pxr/base/tf/registryManager.h"
 #include "pxr/base/tf/type.h"
 
+// The F16C paths use the target attribute so they can be compiled into
+// this translation unit without raising the ISA floor of the build; they
+// are only called after a runtime CPU feature check.
+#if defined(ARCH_CPU_INTEL) && (defined(__GNUC__) || defined(__clang__)) && \
+    !defined(ARCH_OS_WINDOWS)
+#include <immintrin.h>
+#define GF_HALF_USE_F16C
+#endif
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 TF_REGISTRY_FUNCTION(TfType) {
     TfType::Define<GfHalf>();
 }
 
+#ifdef GF_HALF_USE_F16C
+
+// half is a standard-layout type holding a single unsigned short, so the
+// conversion kernels treat arrays of it as arrays of bits.
+static_assert(sizeof(GfHalf) == sizeof(unsigned short),
+              "GfHalf must be exactly one unsigned short");
+
+__attribute__((target("avx,f16c")))
+static void
+_ConvertFloatToHalfF16c(float const *src, unsigned short *dst, size_t n)
+{
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m256 f = _mm256_loadu_ps(src + i);
+        __m128i h = _mm256_cvtps_ph(f, _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), h);
+    }
+    for (; i != n; ++i) {
+        __m128i h = _mm_cvtps_ph(_mm_set_ss(src[i]),
+                                 _MM_FROUND_TO_NEAREST_INT);
+        dst[i] = static_cast<unsigned short>(_mm_extract_epi16(h, 0));
+    }
+}
+
+__attribute__((target("avx,f16c")))
+static void
+_ConvertHalfToFloatF16c(unsigned short const *src, float *dst, size_t n)
+{
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        __m128i h = _mm_loadu_si128(
+            reinterpret_cast<__m128i const *>(src + i));
+        _mm256_storeu_ps(dst + i, _mm256_cvtph_ps(h));
+    }
+    for (; i != n; ++i) {
+        __m128i h = _mm_cvtsi32_si128(src[i]);
+        dst[i] = _mm_cvtss_f32(_mm_cvtph_ps(h));
+    }
+}
+
+static bool
+_SupportsF16c()
+{
+    return __builtin_cpu_supports("avx") && __builtin_cpu_supports("f16c");
+}
+
+#endif // GF_HALF_USE_F16C
+
+void
+GfConvertFloatToHalf(float const *src, GfHalf *dst, size_t numValues)
+{
+#ifdef GF_HALF_USE_F16C
+    static const bool useF16c = _SupportsF16c();
+    if (useF16c) {
+        _ConvertFloatToHalfF16c(
+            src, reinterpret_cast<unsigned short *>(dst), numValues);
+        return;
+    }
+#endif
+    for (size_t i = 0; i != numValues; ++i)
+        dst[i] = GfHalf(src[i]);
+}
+
+void
+GfConvertHalfToFloat(GfHalf const *src, float *dst, size_t numValues)
+{
+#ifdef GF_HALF_USE_F16C
+    static const bool useF16c = _SupportsF16c();
+    if (useF16c) {
+        _ConvertHalfToFloatF16c(
+            reinterpret_cast<unsigned short const *>(src), dst, numValues);
+        return;
+    }
+#endif
+    for (size_t i = 0; i != numValues; ++i)
+        dst[i] = static_cast<float>(src[i]);
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,219 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#include "pxr/pxr.h"
+#include "pxr/base/gf/matrix4dSoA.h"
+#include "pxr/base/gf/math.h"
+
+#include <cfloat>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+GfMatrix4dSoA::GfMatrix4dSoA(size_t size)
+    : _size(size)
+    , _data(16 * size)
+{
+}
+
+GfMatrix4dSoA::GfMatrix4dSoA(GfMatrix4d const *matrices, size_t size)
+    : _size(0)
+{
+    Load(matrices, size);
+}
+
+void
+GfMatrix4dSoA::Resize(size_t size)
+{
+    _size = size;
+    _data.resize(16 * size);
+}
+
+void
+GfMatrix4dSoA::Load(GfMatrix4d const *matrices, size_t size)
+{
+    Resize(size);
+    for (int r = 0; r != 4; ++r) {
+        for (int c = 0; c != 4; ++c) {
+            double *plane = GetPlane(r, c);
+            for (size_t i = 0; i != size; ++i)
+                plane[i] = matrices[i][r][c];
+        }
+    }
+}
+
+void
+GfMatrix4dSoA::Store(GfMatrix4d *matrices) const
+{
+    for (int r = 0; r != 4; ++r) {
+        for (int c = 0; c != 4; ++c) {
+            double const *plane = GetPlane(r, c);
+            for (size_t i = 0; i != _size; ++i)
+                matrices[i][r][c] = plane[i];
+        }
+    }
+}
+
+void
+GfMatrix4dSoA::Multiply(GfMatrix4d const &rhs)
+{
+    // Each output plane (r, c) is a linear combination of this row's four
+    // planes, weighted by rhs's column c.  Work row by row, copying the
+    // row's planes aside so outputs can overwrite them.
+    std::vector<double> rowCopy(4 * _size);
+    for (int r = 0; r != 4; ++r) {
+        for (int k = 0; k != 4; ++k) {
+            double const *plane = GetPlane(r, k);
+            std::copy(plane, plane + _size, rowCopy.data() + k * _size);
+        }
+        double const *a0 = rowCopy.data();
+        double const *a1 = rowCopy.data() + _size;
+        double const *a2 = rowCopy.data() + 2 * _size;
+        double const *a3 = rowCopy.data() + 3 * _size;
+        for (int c = 0; c != 4; ++c) {
+            const double b0 = rhs[0][c], b1 = rhs[1][c];
+            const double b2 = rhs[2][c], b3 = rhs[3][c];
+            double *out = GetPlane(r, c);
+            for (size_t i = 0; i != _size; ++i)
+                out[i] = a0[i]*b0 + a1[i]*b1 + a2[i]*b2 + a3[i]*b3;
+        }
+    }
+}
+
+void
+GfMatrix4dSoA::Multiply(GfMatrix4dSoA const &rhs)
+{
+    std::vector<double> rowCopy(4 * _size);
+    for (int r = 0; r != 4; ++r) {
+        for (int k = 0; k != 4; ++k) {
+            double const *plane = GetPlane(r, k);
+            std::copy(plane, plane + _size, rowCopy.data() + k * _size);
+        }
+        double const *a0 = rowCopy.data();
+        double const *a1 = rowCopy.data() + _size;
+        double const *a2 = rowCopy.data() + 2 * _size;
+        double const *a3 = rowCopy.data() + 3 * _size;
+        for (int c = 0; c != 4; ++c) {
+            double const *b0 = rhs.GetPlane(0, c);
+            double const *b1 = rhs.GetPlane(1, c);
+            double const *b2 = rhs.GetPlane(2, c);
+            double const *b3 = rhs.GetPlane(3, c);
+            double *out = GetPlane(r, c);
+            for (size_t i = 0; i != _size; ++i)
+                out[i] = a0[i]*b0[i] + a1[i]*b1[i] + a2[i]*b2[i] + a3[i]*b3[i];
+        }
+    }
+}
+
+void
+GfMatrix4dSoA::Invert(double eps)
+{
+    // The cofactor computation from GfMatrix4d::GetInverse(), applied per
+    // element over the planes.  Reading from locals and storing only at
+    // the end lets the inversion run in place; keeping the loop body
+    // branch-free except for the singular fallback lets it vectorize
+    // across elements.
+    double *m[4][4];
+    for (int r = 0; r != 4; ++r)
+        for (int c = 0; c != 4; ++c)
+            m[r][c] = GetPlane(r, c);
+
+    for (size_t i = 0; i != _size; ++i) {
+        const double x00 = m[0][0][i], x01 = m[0][1][i];
+        const double x02 = m[0][2][i], x03 = m[0][3][i];
+        const double x10 = m[1][0][i], x11 = m[1][1][i];
+        const double x12 = m[1][2][i], x13 = m[1][3][i];
+        const double x20 = m[2][0][i], x21 = m[2][1][i];
+        const double x22 = m[2][2][i], x23 = m[2][3][i];
+        const double x30 = m[3][0][i], x31 = m[3][1][i];
+        const double x32 = m[3][2][i], x33 = m[3][3][i];
+
+        // 2x2 determinants of the first two columns.
+        const double y01 = x00*x11 - x10*x01;
+        const double y02 = x00*x21 - x20*x01;
+        const double y03 = x00*x31 - x30*x01;
+        const double y12 = x10*x21 - x20*x11;
+        const double y13 = x10*x31 - x30*x11;
+        const double y23 = x20*x31 - x30*x21;
+
+        // 3x3 cofactors for the second two columns.
+        const double z33 = x02*y12 - x12*y02 + x22*y01;
+        const double z23 = x12*y03 - x32*y01 - x02*y13;
+        const double z13 = x02*y23 - x22*y03 + x32*y02;
+        const double z03 = x22*y13 - x32*y12 - x12*y23;
+        const double z32 = x13*y02 - x23*y01 - x03*y12;
+        const double z22 = x03*y13 - x13*y03 + x33*y01;
+        const double z12 = x23*y03 - x33*y02 - x03*y23;
+        const double z02 = x13*y23 - x23*y13 + x33*y12;
+
+        // 2x2 determinants of the second two columns.
+        const double w01 = x02*x13 - x12*x03;
+        const double w02 = x02*x23 - x22*x03;
+        const double w03 = x02*x33 - x32*x03;
+        const double w12 = x12*x23 - x22*x13;
+        const double w13 = x12*x33 - x32*x13;
+        const double w23 = x22*x33 - x32*x23;
+
+        // 3x3 cofactors for the first two columns.
+        const double z30 = x11*w02 - x21*w01 - x01*w12;
+        const double z20 = x01*w13 - x11*w03 + x31*w01;
+        const double z10 = x21*w03 - x31*w02 - x01*w23;
+        const double z00 = x11*w23 - x21*w13 + x31*w12;
+        const double z31 = x00*w12 - x10*w02 + x20*w01;
+        const double z21 = x10*w03 - x30*w01 - x00*w13;
+        const double z11 = x00*w23 - x20*w03 + x30*w02;
+        const double z01 = x20*w13 - x30*w12 - x10*w23;
+
+        const double det = x30*z30 + x20*z20 + x10*z10 + x00*z00;
+
+        if (GfAbs(det) > eps) {
+            const double rcp = 1.0 / det;
+            m[0][0][i] = z00*rcp; m[0][1][i] = z10*rcp;
+            m[0][2][i] = z20*rcp; m[0][3][i] = z30*rcp;
+            m[1][0][i] = z01*rcp; m[1][1][i] = z11*rcp;
+            m[1][2][i] = z21*rcp; m[1][3][i] = z31*rcp;
+            m[2][0][i] = z02*rcp; m[2][1][i] = z12*rcp;
+            m[2][2][i] = z22*rcp; m[2][3][i] = z32*rcp;
+            m[3][0][i] = z03*rcp; m[3][1][i] = z13*rcp;
+            m[3][2][i] = z23*rcp; m[3][3][i] = z33*rcp;
+        } else {
+            // Match GetInverse(): the FLT_MAX scale matrix.
+            for (int r = 0; r != 4; ++r)
+                for (int c = 0; c != 4; ++c)
+                    m[r][c][i] = 0.0;
+            m[0][0][i] = m[1][1][i] = m[2][2][i] = FLT_MAX;
+            m[3][3][i] = 1.0;
+        }
+    }
+}
+
+void
+GfMatrix4dSoA::ExtractTranslations(GfVec3d *translations) const
+{
+    double const *tx = GetPlane(3, 0);
+    double const *ty = GetPlane(3, 1);
+    double const *tz = GetPlane(3, 2);
+    for (size_t i = 0; i != _size; ++i)
+        translations[i].Set(tx[i], ty[i], tz[i]);
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
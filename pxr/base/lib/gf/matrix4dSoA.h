@@ -0,0 +1,116 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef GF_MATRIX4D_SOA_H
+#define GF_MATRIX4D_SOA_H
+
+/// \file gf/matrix4dSoA.h
+/// \ingroup group_gf_LinearAlgebra
+
+#include "pxr/pxr.h"
+#include "pxr/base/gf/api.h"
+#include "pxr/base/gf/matrix4d.h"
+#include "pxr/base/gf/vec3d.h"
+
+#include <cstddef>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class GfMatrix4dSoA
+/// \ingroup group_gf_LinearAlgebra
+///
+/// A structure-of-arrays container for a sequence of GfMatrix4d.  Each of
+/// the 16 matrix components is stored in its own contiguous plane of
+/// doubles, so per-element operations (composition, inversion) read and
+/// write unit-stride arrays and vectorize across elements, where the
+/// array-of-structs layout of GfMatrix4d[] defeats vectorization.
+///
+/// The intended use is transform-heavy loops over large matrix arrays,
+/// e.g. instance transform flattening: load the matrices once, apply a
+/// chain of operations in SoA form, and store the result back out.  For
+/// VtArray<GfMatrix4d> data, load from \c array.cdata() and store into
+/// \c array.data().
+///
+class GfMatrix4dSoA
+{
+public:
+    /// Construct an empty container.
+    GfMatrix4dSoA() : _size(0) {}
+
+    /// Construct with \p size uninitialized elements.
+    GF_API explicit GfMatrix4dSoA(size_t size);
+
+    /// Construct from \p size matrices starting at \p matrices.
+    GF_API GfMatrix4dSoA(GfMatrix4d const *matrices, size_t size);
+
+    /// Return the number of matrices in the container.
+    size_t GetSize() const { return _size; }
+
+    /// Resize to \p size uninitialized elements.  Existing contents are
+    /// discarded, since the plane layout depends on the size.
+    GF_API void Resize(size_t size);
+
+    /// Replace the contents with \p size matrices starting at \p matrices.
+    GF_API void Load(GfMatrix4d const *matrices, size_t size);
+
+    /// Write the contents to \p matrices, which must have room for
+    /// GetSize() elements.
+    GF_API void Store(GfMatrix4d *matrices) const;
+
+    /// Return the contiguous plane of element (\p row, \p col) components;
+    /// the plane holds GetSize() doubles.
+    double *GetPlane(int row, int col) {
+        return _data.data() + (row * 4 + col) * _size;
+    }
+    /// \overload
+    double const *GetPlane(int row, int col) const {
+        return _data.data() + (row * 4 + col) * _size;
+    }
+
+    /// Right-multiply every element by \p rhs, as if by
+    /// <c>element = element * rhs</c>.
+    GF_API void Multiply(GfMatrix4d const &rhs);
+
+    /// Right-multiply each element by the corresponding element of \p rhs,
+    /// which must have the same size.
+    GF_API void Multiply(GfMatrix4dSoA const &rhs);
+
+    /// Replace every element with its inverse, matching
+    /// GfMatrix4d::GetInverse(): elements whose determinant magnitude is
+    /// not greater than \p eps become the FLT_MAX scale matrix.
+    GF_API void Invert(double eps = 0);
+
+    /// Write each element's translation (its fourth row) to
+    /// \p translations, which must have room for GetSize() elements.
+    GF_API void ExtractTranslations(GfVec3d *translations) const;
+
+private:
+    size_t _size;
+    // 16 planes of _size doubles, plane (r, c) at offset (r*4 + c) * _size.
+    std::vector<double> _data;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // GF_MATRIX4D_SOA_H
@@ -125,6 +125,67 @@ public:
     std::vector<JsObject::key_type> keys;
     std::vector<JsObject::mapped_type> values;
 };
+
+// Adapts the rapidjson handler concept to the public JsSaxHandler
+// interface. No values are materialized; string and key data is forwarded
+// as (pointer, length) pairs directly from the parser.
+struct _SaxHandlerAdapter
+    : public rj::BaseReaderHandler<rj::UTF8<>, _SaxHandlerAdapter>
+{
+    explicit _SaxHandlerAdapter(JsSaxHandler* h) : handler(h) { }
+
+    bool Null() { return handler->OnNull(); }
+    bool Bool(bool b) { return handler->OnBool(b); }
+    bool Int(int i) { return handler->OnInt64(i); }
+    bool Uint(unsigned u) {
+        return handler->OnUInt64(static_cast<uint64_t>(u));
+    }
+    bool Int64(int64_t i) { return handler->OnInt64(i); }
+    bool Uint64(uint64_t u) { return handler->OnUInt64(u); }
+    bool Double(double d) { return handler->OnReal(d); }
+    bool String(const char* str, rj::SizeType length, bool /* copy */) {
+        return handler->OnString(str, length);
+    }
+    bool Key(const char* str, rj::SizeType length, bool /* copy */) {
+        return handler->OnKey(str, length);
+    }
+    bool StartObject() { return handler->OnBeginObject(); }
+    bool EndObject(rj::SizeType memberCount) {
+        return handler->OnEndObject(memberCount);
+    }
+    bool StartArray() { return handler->OnBeginArray(); }
+    bool EndArray(rj::SizeType elementCount) {
+        return handler->OnEndArray(elementCount);
+    }
+
+    JsSaxHandler* handler;
+};
+
+// Rapidjson only provides a character offset for errors; convert it to the
+// line/column information JsParseError carries by scanning the input up to
+// the offset.
+static void
+_FillParseError(
+    JsParseError* error,
+    const char* data,
+    const rj::ParseResult& result)
+{
+    if (!error) {
+        return;
+    }
+
+    error->line = 1;
+    const size_t eoff = result.Offset();
+    size_t nlpos = 0;
+    for (size_t i = 0; i < eoff; ++i) {
+        if (data[i] == '\n') {
+            error->line++;
+            nlpos = i;
+        }
+    }
+    error->column = eoff - nlpos;
+    error->reason = rj::GetParseError_En(result.Code());
+}
 }
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -194,6 +255,71 @@ _JsValueToImplValue(
 }
 
 
+JsSaxHandler::~JsSaxHandler()
+{
+}
+
+bool
+JsSaxParseString(
+    const std::string& data,
+    JsSaxHandler* handler,
+    JsParseError* error)
+{
+    if (data.empty()) {
+        TF_CODING_ERROR("JSON string is empty");
+        return false;
+    }
+    if (!handler) {
+        TF_CODING_ERROR("Invalid handler");
+        return false;
+    }
+
+    _SaxHandlerAdapter adapter(handler);
+    rj::Reader reader;
+    rj::StringStream ss(data.c_str());
+    rj::ParseResult result =
+        reader.Parse<rj::kParseStopWhenDoneFlag>(ss, adapter);
+
+    if (!result) {
+        _FillParseError(error, data.c_str(), result);
+        return false;
+    }
+
+    return true;
+}
+
+bool
+JsSaxParseStringInPlace(
+    char* data,
+    JsSaxHandler* handler,
+    JsParseError* error)
+{
+    if (!data || !*data) {
+        TF_CODING_ERROR("JSON string is empty");
+        return false;
+    }
+    if (!handler) {
+        TF_CODING_ERROR("Invalid handler");
+        return false;
+    }
+
+    _SaxHandlerAdapter adapter(handler);
+    rj::Reader reader;
+    rj::InsituStringStream ss(data);
+    rj::ParseResult result =
+        reader.Parse<rj::kParseInsituFlag | rj::kParseStopWhenDoneFlag>(
+            ss, adapter);
+
+    if (!result) {
+        // In-situ parsing has already rewritten parts of the buffer before
+        // the error offset, so the line/column here is approximate.
+        _FillParseError(error, data, result);
+        return false;
+    }
+
+    return true;
+}
+
 JsValue
 JsParseStream(
     std::istream& istr,
@@ -230,23 +356,7 @@ JsParseString(
         reader.Parse<rj::kParseStopWhenDoneFlag>(ss, handler);
 
     if (!result) {
-        if (error) {
-            // Rapidjson only provides a character offset for errors, not
-            // line/column information like other parsers (like json_spirit,
-            // upon which this library was previously implemented). Analyze
-            // the input data to convert the offset to line/column.
-            error->line = 1;
-            const size_t eoff = result.Offset();
-            size_t nlpos = 0;
-            for (size_t i = 0; i < eoff; ++i) {
-                if (data[i] == '\n') {
-                    error->line++;
-                    nlpos = i;
-                }
-            }
-            error->column = eoff - nlpos;
-            error->reason = rj::GetParseError_En(result.Code());
-        }
+        _FillParseError(error, data.c_str(), result);
         return JsValue();
     }
 
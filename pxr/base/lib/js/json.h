@@ -48,6 +48,52 @@ struct JsParseError {
     std::string reason;
 };
 
+/// \class JsSaxHandler
+///
+/// Interface for event-driven (SAX-style) JSON parsing with
+/// JsSaxParseString().  The parser invokes one callback per syntactic
+/// element in document order; no DOM is built, so clients that only need
+/// to extract a few values avoid constructing and discarding the
+/// intermediate JsObject/JsArray structure that JsParseString() produces.
+///
+/// Each callback returns true to continue parsing or false to abort.
+/// String and key data passed to callbacks is only valid for the duration
+/// of the callback; when parsing in situ it points into the caller's
+/// buffer.
+///
+class JsSaxHandler {
+public:
+    JS_API virtual ~JsSaxHandler();
+
+    virtual bool OnNull() = 0;
+    virtual bool OnBool(bool value) = 0;
+    virtual bool OnInt64(int64_t value) = 0;
+    virtual bool OnUInt64(uint64_t value) = 0;
+    virtual bool OnReal(double value) = 0;
+    virtual bool OnString(const char* value, size_t length) = 0;
+    virtual bool OnKey(const char* key, size_t length) = 0;
+    virtual bool OnBeginObject() = 0;
+    virtual bool OnEndObject(size_t numMembers) = 0;
+    virtual bool OnBeginArray() = 0;
+    virtual bool OnEndArray(size_t numElements) = 0;
+};
+
+/// Parse the JSON string \p data, invoking \p handler callbacks as
+/// elements are encountered instead of building a JsValue.  Return true if
+/// the document parsed completely; on a parse error or when a callback
+/// aborts, return false and fill \p error if supplied.
+JS_API
+bool JsSaxParseString(const std::string& data, JsSaxHandler* handler,
+                      JsParseError* error = 0);
+
+/// Like the string overload, but parses the NUL-terminated buffer \p data
+/// in situ: string values are unescaped in place within the buffer and the
+/// pointers passed to the handler refer into it, eliminating per-string
+/// allocation and copying.  The buffer contents are destroyed by parsing.
+JS_API
+bool JsSaxParseStringInPlace(char* data, JsSaxHandler* handler,
+                             JsParseError* error = 0);
+
 /// Parse the contents of input stream \p istr and return a JsValue. On
 /// failure, this returns a null JsValue.
 JS_API
@@ -0,0 +1,143 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+///
+/// \file testenv/testJsSax.cpp
+
+#include "pxr/pxr.h"
+#include "pxr/base/js/json.h"
+#include "pxr/base/tf/diagnosticLite.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+// Records each callback as a short string so event sequences can be
+// compared between parsing modes.
+struct _EventRecorder : public JsSaxHandler
+{
+    bool OnNull() override {
+        events.push_back("null");
+        return true;
+    }
+    bool OnBool(bool value) override {
+        events.push_back(value ? "true" : "false");
+        return true;
+    }
+    bool OnInt64(int64_t value) override {
+        events.push_back("int " + std::to_string(value));
+        return true;
+    }
+    bool OnUInt64(uint64_t value) override {
+        events.push_back("uint " + std::to_string(value));
+        return true;
+    }
+    bool OnReal(double value) override {
+        events.push_back("real " + std::to_string(value));
+        return true;
+    }
+    bool OnString(const char* value, size_t length) override {
+        events.push_back("string " + std::string(value, length));
+        return true;
+    }
+    bool OnKey(const char* key, size_t length) override {
+        events.push_back("key " + std::string(key, length));
+        return true;
+    }
+    bool OnBeginObject() override {
+        events.push_back("{");
+        return true;
+    }
+    bool OnEndObject(size_t numMembers) override {
+        events.push_back("} " + std::to_string(numMembers));
+        return true;
+    }
+    bool OnBeginArray() override {
+        events.push_back("[");
+        return true;
+    }
+    bool OnEndArray(size_t numElements) override {
+        events.push_back("] " + std::to_string(numElements));
+        return true;
+    }
+
+    std::vector<std::string> events;
+};
+
+// Aborts parsing when a particular key is encountered.
+struct _AbortingHandler : public _EventRecorder
+{
+    explicit _AbortingHandler(const std::string& k) : stopKey(k) { }
+
+    bool OnKey(const char* key, size_t length) override {
+        return std::string(key, length) != stopKey;
+    }
+
+    std::string stopKey;
+};
+
+int main(int argc, char const *argv[])
+{
+    const char* doc =
+        "{\"a\": [1, 2.5, \"x\\ny\"],"
+        " \"b\": {\"c\": null, \"d\": true},"
+        " \"n\": -7}";
+
+    // Copying and in-situ parses must produce identical event sequences,
+    // including unescaped string content.
+    _EventRecorder copied;
+    JsParseError error;
+    TF_AXIOM(JsSaxParseString(std::string(doc), &copied, &error));
+    TF_AXIOM(!copied.events.empty());
+    TF_AXIOM(copied.events.front() == "{");
+    TF_AXIOM(copied.events.back() == "} 3");
+
+    std::vector<char> buffer(doc, doc + strlen(doc) + 1);
+    _EventRecorder inSitu;
+    TF_AXIOM(JsSaxParseStringInPlace(buffer.data(), &inSitu, &error));
+    TF_AXIOM(copied.events == inSitu.events);
+
+    // Escape sequences are decoded before reaching the handler.
+    TF_AXIOM(std::find(copied.events.begin(), copied.events.end(),
+                       "string x\ny") != copied.events.end());
+
+    // Parse errors are reported with line and column information, matching
+    // the behavior of JsParseString.
+    _EventRecorder failed;
+    TF_AXIOM(!JsSaxParseString("{\"a\": }", &failed, &error));
+    TF_AXIOM(error.line == 1);
+    TF_AXIOM(error.column == 6);
+    TF_AXIOM(!error.reason.empty());
+
+    // A handler returning false aborts the parse; callbacks after the
+    // aborting one must not be invoked.
+    _AbortingHandler aborting("b");
+    TF_AXIOM(!JsSaxParseString(std::string(doc), &aborting, &error));
+    TF_AXIOM(std::find(aborting.events.begin(), aborting.events.end(),
+                       "key n") == aborting.events.end());
+
+    return 0;
+}
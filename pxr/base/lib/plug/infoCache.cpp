@@ -0,0 +1,462 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/base/plug/infoCache.h"
+#include "pxr/base/plug/debugCodes.h"
+#include "pxr/base/arch/fileSystem.h"
+#include "pxr/base/tf/atomicOfstreamWrapper.h"
+#include "pxr/base/tf/getenv.h"
+#include "pxr/base/tf/pathUtils.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <set>
+#include <sstream>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+// Bump this whenever the format below changes; a version mismatch is
+// treated as a cache miss.
+const uint32_t _Version = 1;
+const char _Magic[8] = { 'P','l','u','g','C','a','c','h' };
+
+// Value tags for the binary JsValue encoding.
+enum _ValueTag : uint8_t {
+    _NullTag,
+    _FalseTag,
+    _TrueTag,
+    _Int64Tag,
+    _UInt64Tag,
+    _RealTag,
+    _StringTag,
+    _ArrayTag,
+    _ObjectTag
+};
+
+std::string
+_GetCachePath()
+{
+    return TfGetenv("PXR_PLUGINFO_CACHE_PATH");
+}
+
+//
+// Writing.  The format uses native endianness and fixed-width integers;
+// the cache is a per-machine artifact, not an interchange format.
+//
+
+void
+_WriteBytes(std::ostream& out, const void* data, size_t size)
+{
+    out.write(static_cast<const char*>(data), size);
+}
+
+void
+_WriteUInt32(std::ostream& out, uint32_t value)
+{
+    _WriteBytes(out, &value, sizeof(value));
+}
+
+void
+_WriteUInt64(std::ostream& out, uint64_t value)
+{
+    _WriteBytes(out, &value, sizeof(value));
+}
+
+void
+_WriteDouble(std::ostream& out, double value)
+{
+    _WriteBytes(out, &value, sizeof(value));
+}
+
+void
+_WriteString(std::ostream& out, const std::string& value)
+{
+    _WriteUInt32(out, static_cast<uint32_t>(value.size()));
+    _WriteBytes(out, value.data(), value.size());
+}
+
+void
+_WriteValue(std::ostream& out, const JsValue& value)
+{
+    switch (value.GetType()) {
+    case JsValue::NullType:
+        out.put(_NullTag);
+        break;
+    case JsValue::BoolType:
+        out.put(value.GetBool() ? _TrueTag : _FalseTag);
+        break;
+    case JsValue::IntType:
+        if (value.IsUInt64()) {
+            out.put(_UInt64Tag);
+            _WriteUInt64(out, value.GetUInt64());
+        }
+        else {
+            out.put(_Int64Tag);
+            _WriteUInt64(out, static_cast<uint64_t>(value.GetInt64()));
+        }
+        break;
+    case JsValue::RealType:
+        out.put(_RealTag);
+        _WriteDouble(out, value.GetReal());
+        break;
+    case JsValue::StringType:
+        out.put(_StringTag);
+        _WriteString(out, value.GetString());
+        break;
+    case JsValue::ArrayType: {
+        const JsArray& array = value.GetJsArray();
+        out.put(_ArrayTag);
+        _WriteUInt32(out, static_cast<uint32_t>(array.size()));
+        for (const auto& element : array) {
+            _WriteValue(out, element);
+        }
+        break;
+    }
+    case JsValue::ObjectType: {
+        const JsObject& object = value.GetJsObject();
+        out.put(_ObjectTag);
+        _WriteUInt32(out, static_cast<uint32_t>(object.size()));
+        for (const auto& member : object) {
+            _WriteString(out, member.first);
+            _WriteValue(out, member.second);
+        }
+        break;
+    }
+    }
+}
+
+//
+// Reading.  The entire cache file is read into memory with a single read
+// and decoded from the buffer; any truncation or garbage turns the read
+// into a cache miss via the ok flag.
+//
+
+struct _Reader {
+    _Reader(const char* data, size_t size) :
+        pos(data), end(data + size), ok(true) { }
+
+    bool Read(void* data, size_t size) {
+        if (!ok || size > static_cast<size_t>(end - pos)) {
+            ok = false;
+            return false;
+        }
+        memcpy(data, pos, size);
+        pos += size;
+        return true;
+    }
+
+    uint32_t ReadUInt32() {
+        uint32_t value = 0;
+        Read(&value, sizeof(value));
+        return value;
+    }
+
+    uint64_t ReadUInt64() {
+        uint64_t value = 0;
+        Read(&value, sizeof(value));
+        return value;
+    }
+
+    double ReadDouble() {
+        double value = 0.0;
+        Read(&value, sizeof(value));
+        return value;
+    }
+
+    std::string ReadString() {
+        const uint32_t size = ReadUInt32();
+        if (!ok || size > static_cast<size_t>(end - pos)) {
+            ok = false;
+            return std::string();
+        }
+        std::string value(pos, size);
+        pos += size;
+        return value;
+    }
+
+    const char* pos;
+    const char* end;
+    bool ok;
+};
+
+JsValue
+_ReadValue(_Reader* in)
+{
+    uint8_t tag = _NullTag;
+    if (!in->Read(&tag, sizeof(tag))) {
+        return JsValue();
+    }
+
+    switch (tag) {
+    case _NullTag:
+        return JsValue();
+    case _FalseTag:
+        return JsValue(false);
+    case _TrueTag:
+        return JsValue(true);
+    case _Int64Tag:
+        return JsValue(static_cast<int64_t>(in->ReadUInt64()));
+    case _UInt64Tag:
+        return JsValue(in->ReadUInt64());
+    case _RealTag:
+        return JsValue(in->ReadDouble());
+    case _StringTag:
+        return JsValue(in->ReadString());
+    case _ArrayTag: {
+        const uint32_t size = in->ReadUInt32();
+        JsArray array;
+        for (uint32_t i = 0; in->ok && i != size; ++i) {
+            array.push_back(_ReadValue(in));
+        }
+        return JsValue(array);
+    }
+    case _ObjectTag: {
+        const uint32_t size = in->ReadUInt32();
+        JsObject object;
+        for (uint32_t i = 0; in->ok && i != size; ++i) {
+            std::string key = in->ReadString();
+            object[key] = _ReadValue(in);
+        }
+        return JsValue(object);
+    }
+    default:
+        in->ok = false;
+        return JsValue();
+    }
+}
+
+// Collect the modification times that key the cache: one entry for each
+// visited plugInfo file and one for each distinct containing directory,
+// so both edits to known files and files added or removed next to them
+// invalidate the cache.
+std::map<std::string, double>
+_GetValidationTimes(const std::vector<std::string>& visitedPaths)
+{
+    std::set<std::string> paths;
+    for (const auto& path : visitedPaths) {
+        paths.insert(path);
+        const std::string dirname = TfGetPathName(path);
+        if (!dirname.empty()) {
+            paths.insert(dirname);
+        }
+    }
+
+    std::map<std::string, double> result;
+    for (const auto& path : paths) {
+        double time = 0.0;
+        if (ArchGetModificationTime(path.c_str(), &time)) {
+            result[path] = time;
+        }
+    }
+    return result;
+}
+
+} // anonymous namespace
+
+bool
+Plug_IsPlugInfoCacheEnabled()
+{
+    return !_GetCachePath().empty();
+}
+
+bool
+Plug_ReadPlugInfoCache(
+    const std::vector<std::string>& pathnames,
+    std::vector<std::string>* visitedPaths,
+    std::vector<Plug_RegistrationMetadata>* plugins)
+{
+    const std::string cachePath = _GetCachePath();
+    if (cachePath.empty()) {
+        return false;
+    }
+
+    // Read the whole file in one go.
+    std::ifstream ifs(cachePath.c_str(), std::ios::binary);
+    if (!ifs.is_open()) {
+        TF_DEBUG(PLUG_INFO_SEARCH).
+            Msg("No plugInfo cache at %s\n", cachePath.c_str());
+        return false;
+    }
+    std::ostringstream buffer;
+    buffer << ifs.rdbuf();
+    const std::string data = buffer.str();
+
+    _Reader in(data.c_str(), data.size());
+
+    // Header.
+    char magic[sizeof(_Magic)] = { 0 };
+    in.Read(magic, sizeof(magic));
+    if (!in.ok || memcmp(magic, _Magic, sizeof(_Magic)) != 0 ||
+        in.ReadUInt32() != _Version) {
+        TF_DEBUG(PLUG_INFO_SEARCH).
+            Msg("Ignoring plugInfo cache %s: bad header\n", cachePath.c_str());
+        return false;
+    }
+
+    // The search paths must match exactly.
+    const uint32_t numPathnames = in.ReadUInt32();
+    if (!in.ok || numPathnames != pathnames.size()) {
+        return false;
+    }
+    for (const auto& pathname : pathnames) {
+        if (in.ReadString() != pathname) {
+            return false;
+        }
+    }
+
+    // Validate modification times.
+    const uint32_t numTimes = in.ReadUInt32();
+    for (uint32_t i = 0; in.ok && i != numTimes; ++i) {
+        const std::string path = in.ReadString();
+        const double cachedTime = in.ReadDouble();
+        double time = 0.0;
+        if (!in.ok) {
+            break;
+        }
+        if (!ArchGetModificationTime(path.c_str(), &time) ||
+            time != cachedTime) {
+            TF_DEBUG(PLUG_INFO_SEARCH).
+                Msg("Ignoring plugInfo cache %s: %s changed\n",
+                    cachePath.c_str(), path.c_str());
+            return false;
+        }
+    }
+
+    // Visited paths.
+    std::vector<std::string> cachedVisited;
+    const uint32_t numVisited = in.ReadUInt32();
+    for (uint32_t i = 0; in.ok && i != numVisited; ++i) {
+        cachedVisited.push_back(in.ReadString());
+    }
+
+    // Plugins.
+    std::vector<Plug_RegistrationMetadata> cachedPlugins;
+    const uint32_t numPlugins = in.ReadUInt32();
+    for (uint32_t i = 0; in.ok && i != numPlugins; ++i) {
+        Plug_RegistrationMetadata metadata;
+        metadata.type =
+            static_cast<Plug_RegistrationMetadata::Type>(in.ReadUInt32());
+        metadata.pluginName = in.ReadString();
+        metadata.pluginPath = in.ReadString();
+        metadata.libraryPath = in.ReadString();
+        metadata.resourcePath = in.ReadString();
+        const JsValue plugInfo = _ReadValue(&in);
+        if (!in.ok || !plugInfo.IsObject()) {
+            in.ok = false;
+            break;
+        }
+        metadata.plugInfo = plugInfo.GetJsObject();
+        cachedPlugins.push_back(metadata);
+    }
+
+    if (!in.ok) {
+        TF_DEBUG(PLUG_INFO_SEARCH).
+            Msg("Ignoring plugInfo cache %s: malformed\n", cachePath.c_str());
+        return false;
+    }
+
+    TF_DEBUG(PLUG_INFO_SEARCH).
+        Msg("Read %zu plugins from plugInfo cache %s\n",
+            cachedPlugins.size(), cachePath.c_str());
+    visitedPaths->swap(cachedVisited);
+    plugins->swap(cachedPlugins);
+    return true;
+}
+
+void
+Plug_WritePlugInfoCache(
+    const std::vector<std::string>& pathnames,
+    const std::vector<std::string>& visitedPaths,
+    const std::vector<Plug_RegistrationMetadata>& plugins)
+{
+    const std::string cachePath = _GetCachePath();
+    if (cachePath.empty()) {
+        return;
+    }
+
+    // Stat before writing so a modification racing with the scan makes
+    // the cache stale rather than wrong.
+    const std::map<std::string, double> times =
+        _GetValidationTimes(visitedPaths);
+
+    TfAtomicOfstreamWrapper wrapper(cachePath);
+    std::string reason;
+    if (!wrapper.Open(&reason)) {
+        TF_DEBUG(PLUG_INFO_SEARCH).
+            Msg("Not writing plugInfo cache: %s\n", reason.c_str());
+        return;
+    }
+    std::ostream& out = wrapper.GetStream();
+
+    // Header.
+    _WriteBytes(out, _Magic, sizeof(_Magic));
+    _WriteUInt32(out, _Version);
+
+    // Search paths.
+    _WriteUInt32(out, static_cast<uint32_t>(pathnames.size()));
+    for (const auto& pathname : pathnames) {
+        _WriteString(out, pathname);
+    }
+
+    // Validation times.
+    _WriteUInt32(out, static_cast<uint32_t>(times.size()));
+    for (const auto& entry : times) {
+        _WriteString(out, entry.first);
+        _WriteDouble(out, entry.second);
+    }
+
+    // Visited paths.
+    _WriteUInt32(out, static_cast<uint32_t>(visitedPaths.size()));
+    for (const auto& path : visitedPaths) {
+        _WriteString(out, path);
+    }
+
+    // Plugins.
+    _WriteUInt32(out, static_cast<uint32_t>(plugins.size()));
+    for (const auto& metadata : plugins) {
+        _WriteUInt32(out, static_cast<uint32_t>(metadata.type));
+        _WriteString(out, metadata.pluginName);
+        _WriteString(out, metadata.pluginPath);
+        _WriteString(out, metadata.libraryPath);
+        _WriteString(out, metadata.resourcePath);
+        _WriteValue(out, JsValue(metadata.plugInfo));
+    }
+
+    if (!out || !wrapper.Commit(&reason)) {
+        TF_DEBUG(PLUG_INFO_SEARCH).
+            Msg("Failed to write plugInfo cache %s\n", cachePath.c_str());
+        return;
+    }
+
+    TF_DEBUG(PLUG_INFO_SEARCH).
+        Msg("Wrote %zu plugins to plugInfo cache %s\n",
+            plugins.size(), cachePath.c_str());
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,77 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef PLUG_INFO_CACHE_H
+#define PLUG_INFO_CACHE_H
+
+#include "pxr/pxr.h"
+#include "pxr/base/plug/info.h"
+
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \file plug/infoCache.h
+///
+/// A binary cache of the merged results of a plugInfo scan, so that warm
+/// process startup does a single file read instead of a recursive
+/// directory walk and hundreds of JSON parses.
+///
+/// The cache is enabled by setting PXR_PLUGINFO_CACHE_PATH to the path of
+/// the cache file.  It records the search paths it was built from, the
+/// modification times of every plugInfo file that was read and of each
+/// containing directory, and the registration metadata for every plugin
+/// that was found.  A cache read fails (and callers fall back to the
+/// normal scan, which regenerates the cache) if the search paths differ
+/// or any recorded modification time has changed.
+///
+/// Note that the validation set only covers previously discovered
+/// locations; plugInfo files added under directories the cached scan
+/// never visited are not detected.  Deleting the cache file forces a full
+/// rescan.
+
+/// Returns true if a plugInfo cache file path is configured.
+bool Plug_IsPlugInfoCacheEnabled();
+
+/// Attempts to read the plugInfo cache for the search paths \p pathnames.
+/// On success fills \p visitedPaths with every plugInfo path the cached
+/// scan visited and \p plugins with the cached registration metadata, and
+/// returns true.  Returns false if caching is disabled, the cache is
+/// missing, stale, or malformed.
+bool Plug_ReadPlugInfoCache(
+    const std::vector<std::string>& pathnames,
+    std::vector<std::string>* visitedPaths,
+    std::vector<Plug_RegistrationMetadata>* plugins);
+
+/// Writes a plugInfo cache recording that scanning \p pathnames visited
+/// \p visitedPaths and produced \p plugins.  Does nothing if caching is
+/// disabled; failure to write is silent since the cache is best-effort.
+void Plug_WritePlugInfoCache(
+    const std::vector<std::string>& pathnames,
+    const std::vector<std::string>& visitedPaths,
+    const std::vector<Plug_RegistrationMetadata>& plugins);
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PLUG_INFO_CACHE_H
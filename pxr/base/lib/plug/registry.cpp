@@ -27,6 +27,7 @@
 
 #include "pxr/base/plug/notice.h"
 #include "pxr/base/plug/info.h"
+#include "pxr/base/plug/infoCache.h"
 #include "pxr/base/plug/plugin.h"
 
 #include "pxr/base/arch/attributes.h"
@@ -43,6 +44,7 @@
 #include <tbb/concurrent_vector.h>
 #include <tbb/spin_mutex.h>
 
+#include <algorithm>
 #include <functional>
 
 using std::pair;
@@ -150,14 +152,69 @@ PlugRegistry::_RegisterPlugins(const std::vector<std::string>& pathsToPlugInfo)
     {
         // XXX -- Is this mutex really needed?
         std::lock_guard<std::mutex> lock(_mutex);
-        Plug_ReadPlugInfo(pathsToPlugInfo,
-                          std::bind(
-                              &PlugRegistry::_InsertRegisteredPluginPath,
-                              this, std::placeholders::_1),
-                          std::bind(
-                              &PlugRegistry::_RegisterPlugin<NewPluginsVec>,
-                              this, std::placeholders::_1, &newPlugins),
-                          _dispatcher.get());
+
+        // The binary plugInfo cache, if enabled, replaces the directory
+        // walk and JSON parsing with a single file read.  Only the first
+        // registration may use it: once paths have been registered the
+        // scan must run to correctly skip already-visited files.
+        const bool mayUseCache =
+            Plug_IsPlugInfoCacheEnabled() && _registeredPluginPaths.empty();
+
+        bool usedCache = false;
+        std::vector<std::string> visitedPaths;
+        std::vector<Plug_RegistrationMetadata> plugins;
+        if (mayUseCache &&
+            Plug_ReadPlugInfoCache(pathsToPlugInfo,
+                                   &visitedPaths, &plugins)) {
+            for (const auto& path : visitedPaths) {
+                _InsertRegisteredPluginPath(path);
+            }
+            usedCache = true;
+        }
+
+        if (!usedCache) {
+            // Scan in parallel, gathering the results instead of
+            // registering on the fly.
+            tbb::concurrent_vector<std::string> scanVisited;
+            tbb::concurrent_vector<Plug_RegistrationMetadata> scanPlugins;
+            Plug_ReadPlugInfo(
+                pathsToPlugInfo,
+                [this, &scanVisited](const std::string& path) {
+                    if (_InsertRegisteredPluginPath(path)) {
+                        scanVisited.push_back(path);
+                        return true;
+                    }
+                    return false;
+                },
+                [&scanPlugins](const Plug_RegistrationMetadata& metadata) {
+                    scanPlugins.push_back(metadata);
+                },
+                _dispatcher.get());
+            visitedPaths.assign(scanVisited.begin(), scanVisited.end());
+            plugins.assign(scanPlugins.begin(), scanPlugins.end());
+
+            // The parallel scan discovers plugins in a nondeterministic
+            // order; sort so registration order (and hence tie-breaking
+            // between same-named plugins and notice order) is stable
+            // across runs.
+            std::sort(visitedPaths.begin(), visitedPaths.end());
+            std::sort(plugins.begin(), plugins.end(),
+                [](const Plug_RegistrationMetadata& lhs,
+                   const Plug_RegistrationMetadata& rhs) {
+                    return lhs.pluginPath != rhs.pluginPath
+                           ? lhs.pluginPath < rhs.pluginPath
+                           : lhs.pluginName < rhs.pluginName;
+                });
+
+            if (mayUseCache) {
+                Plug_WritePlugInfoCache(
+                    pathsToPlugInfo, visitedPaths, plugins);
+            }
+        }
+
+        for (const auto& metadata : plugins) {
+            _RegisterPlugin(metadata, &newPlugins);
+        }
     }
 
     if (!newPlugins.empty()) {
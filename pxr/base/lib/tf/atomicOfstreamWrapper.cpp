@@ -40,6 +40,8 @@
 #include <iostream>
 #include <cerrno>
 #include <cstdio>
+#include <thread>
+#include <utility>
 
 #if defined(ARCH_OS_WINDOWS)
 #include <Windows.h>
@@ -53,6 +55,7 @@ using std::string;
 TfAtomicOfstreamWrapper::TfAtomicOfstreamWrapper(
     const string& filePath)
     : _filePath(filePath)
+    , _bufferSize(0)
 {
     // Do Nothing.
 }
@@ -62,6 +65,17 @@ TfAtomicOfstreamWrapper::~TfAtomicOfstreamWrapper()
     Cancel();
 }
 
+void
+TfAtomicOfstreamWrapper::SetBufferSize(
+    size_t bufferSize)
+{
+    if (_stream.is_open()) {
+        TF_CODING_ERROR("Cannot set the buffer size on an open stream");
+        return;
+    }
+    _bufferSize = bufferSize;
+}
+
 bool
 TfAtomicOfstreamWrapper::Open(
     string* reason)
@@ -84,6 +98,13 @@ TfAtomicOfstreamWrapper::Open(
     // with the same file name.
     ArchCloseFile(tmpFd);
 
+    // Install the coalescing buffer, if requested. This must be done before
+    // the stream is opened for the buffer to take effect.
+    if (_bufferSize != 0) {
+        _buffer.reset(new char[_bufferSize]);
+        _stream.rdbuf()->pubsetbuf(_buffer.get(), _bufferSize);
+    }
+
     _stream.open(_tmpFilePath.c_str(),
                  std::fstream::out|std::fstream::binary|std::fstream::trunc);
     if (!_stream) {
@@ -117,6 +138,48 @@ TfAtomicOfstreamWrapper::Commit(
     return Tf_AtomicRenameFileOver(_tmpFilePath, _filePath, err);
 }
 
+void
+TfAtomicOfstreamWrapper::CommitAsync(
+    std::function<void (bool, const string&)> callback)
+{
+    if (!_stream.is_open()) {
+        if (callback) {
+            callback(false, "Stream is not open");
+        }
+        return;
+    }
+
+    // Transfer ownership of the stream, its buffer and the temporary file
+    // to the writer thread, leaving this wrapper in the closed state so
+    // that a subsequent Cancel() (e.g. from the destructor) does not
+    // disturb the pending commit.
+    struct _PendingCommit {
+        std::ofstream stream;
+        std::unique_ptr<char[]> buffer;
+        string tmpFilePath;
+        string filePath;
+    };
+    std::shared_ptr<_PendingCommit> pending(new _PendingCommit);
+    pending->stream = std::move(_stream);
+    pending->buffer = std::move(_buffer);
+    pending->tmpFilePath.swap(_tmpFilePath);
+    pending->filePath = _filePath;
+
+    std::thread writer([pending, callback]() {
+        // Flush any pending writes to disk and close the temporary file
+        // stream before calling rename.
+        pending->stream.close();
+
+        string reason;
+        const bool success = Tf_AtomicRenameFileOver(
+            pending->tmpFilePath, pending->filePath, &reason);
+        if (callback) {
+            callback(success, reason);
+        }
+    });
+    writer.detach();
+}
+
 bool
 TfAtomicOfstreamWrapper::Cancel(
     string* reason)
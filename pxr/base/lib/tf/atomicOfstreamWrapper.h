@@ -33,6 +33,8 @@
 #include <boost/noncopyable.hpp>
 
 #include <fstream>
+#include <functional>
+#include <memory>
 #include <string>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -85,6 +87,14 @@ public:
     /// Destructor. Calls Cancel().
     TF_API ~TfAtomicOfstreamWrapper();
 
+    /// Sets the size in bytes of the buffer used to coalesce writes to the
+    /// temporary file. Serializers that emit many small writes benefit from
+    /// a large buffer, which turns them into a small number of large
+    /// sequential writes to the file system. This must be called before
+    /// Open(); calling it on an open stream is a coding error and has no
+    /// effect. Passing zero restores the implementation-defined default.
+    TF_API void SetBufferSize(size_t bufferSize);
+
     /// Opens the temporary file for writing. If the destination directory
     /// does not exist, it is created. If the destination directory exists but
     /// is unwritable, the destination directory cannot be created, or the
@@ -100,6 +110,18 @@ public:
     /// false is returned and \p reason is set to the reason for failure.
     TF_API bool Commit(std::string* reason = 0);
 
+    /// Like Commit(), but performs the flush of buffered data and the atomic
+    /// rename on a background thread so that the calling thread does not
+    /// block on the file system. The caller must be finished writing to the
+    /// stream before calling this method; ownership of the stream and the
+    /// temporary file transfers to the background thread, leaving this
+    /// wrapper in the closed state. If \p callback is supplied, it is
+    /// invoked from the background thread when the commit completes, with
+    /// the success of the commit and, on failure, the reason for failure.
+    TF_API void CommitAsync(
+        std::function<void (bool, const std::string&)> callback =
+        std::function<void (bool, const std::string&)>());
+
     /// Closes the temporary file and removes it from disk, if it exists.
     TF_API bool Cancel(std::string* reason = 0);
 
@@ -112,6 +134,8 @@ private:
     std::string _filePath;
     std::string _tmpFilePath;
     std::ofstream _stream;
+    size_t _bufferSize;
+    std::unique_ptr<char[]> _buffer;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
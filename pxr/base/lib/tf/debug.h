@@ -419,6 +419,28 @@ struct TfDebug::TimedScopeHelper<false> {
 ///
 /// \hideinitializer
 #define TF_DEBUG_CODES(...)                                                  \
+    TF_CONDITIONALLY_COMPILE_TIME_ENABLED_DEBUG_CODES(true, __VA_ARGS__)
+
+/// Define debugging symbols, with a compile-time enabled state.
+///
+/// This is like TF_DEBUG_CODES() except that it takes a leading boolean
+/// constant expression argument.  When \p condition is false, every
+/// TF_DEBUG() check on these symbols becomes a compile-time constant false
+/// and the compiler eliminates the check and the message code entirely; the
+/// symbols are also not registered for run-time control.  When \p condition
+/// is true the symbols behave exactly as if declared with TF_DEBUG_CODES().
+/// This lets hot call sites compile their debug output out of production
+/// builds while other symbols keep run-time toggling:
+/// \code
+/// TF_CONDITIONALLY_COMPILE_TIME_ENABLED_DEBUG_CODES(
+///   TF_DEV_BUILD,
+///   MY_HOT_E1,
+///   MY_HOT_E2
+/// );
+/// \endcode
+///
+/// \hideinitializer
+#define TF_CONDITIONALLY_COMPILE_TIME_ENABLED_DEBUG_CODES(condition, ...)    \
     enum _TF_DEBUG_ENUM_NAME(__VA_ARGS__) {                                  \
         TF_PP_CAT( _TF_DEBUG_ENUM_NAME(__VA_ARGS__), __FIRST)                \
         , __VA_ARGS__                                                        \
@@ -428,7 +450,7 @@ struct TfDebug::TimedScopeHelper<false> {
         _TF_DEBUG_ENUM_NAME(__VA_ARGS__),                                    \
         TF_PP_CAT( _TF_DEBUG_ENUM_NAME(__VA_ARGS__), __FIRST),               \
         TF_PP_CAT( _TF_DEBUG_ENUM_NAME(__VA_ARGS__), __LAST),                \
-        true);
+        condition);
 
 // In the _TF_DEBUG_ENUM_NAME macro below we pass 'dummy' to
 // _TF_DEBUG_FIRST_CODE as the second argument to ensure that we always
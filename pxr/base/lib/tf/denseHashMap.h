@@ -44,8 +44,8 @@ PXR_NAMESPACE_OPEN_SCOPE
 /// This is a space efficent container that mimics the TfHashMap API that
 /// uses a vector for storage when the size of the map is small.
 ///
-/// When the map gets bigger than \p Threshold a TfHashMap is allocated
-/// that is used to accelerate lookup in the vector.
+/// When the map gets bigger than \p Threshold a flat open-addressing
+/// index is allocated that is used to accelerate lookup in the vector.
 ///
 /// \warning This differs from a TfHashMap in so far that inserting and
 /// removing elements invalidate all iterators of the container.
@@ -129,8 +129,161 @@ private:
     // The vector type holding all data for this dense hash map.
     typedef std::vector<_InternalValueType> _Vector;
 
-    // The hash map used when the map holds more than Threshold elements.
-    typedef TfHashMap<Key, size_t, HashFn, EqualKey> _HashMap;
+    // Flat open-addressing index used to accelerate key lookup in the
+    // vector once the map holds more than Threshold elements.  Each slot
+    // caches the key's full hash along with the key's position in the
+    // vector, so probing walks a contiguous array of slot pairs (several
+    // per cache line) and the vector is only touched for the final key
+    // comparison.  Erased slots become tombstones; the table doubles when
+    // three quarters of its slots are used.
+    class _FlatIndex {
+    public:
+        static const size_t npos = ~size_t(0);
+
+        explicit _FlatIndex(size_t numElements)
+        :   _slots(_ComputeCapacity(numElements)),
+            _numUsed(0) {}
+
+        // Returns the vector index of the element with key \p k, or npos.
+        size_t Find(const Key &k, size_t hash,
+                    const EqualKey &equ, const _Vector &vec) const {
+            const size_t mask = _slots.size() - 1;
+            _Prefetch(&_slots[((hash & mask) + _SlotsPerFetch) & mask]);
+            for (size_t i = hash & mask; ; i = (i + 1) & mask) {
+                const _Slot &s = _slots[i];
+                if (s.index == _EmptySlot)
+                    return npos;
+                if (s.index != _TombstoneSlot && s.hash == hash &&
+                    equ(vec[s.index].GetValue().first, k))
+                    return s.index;
+            }
+        }
+
+        // If an element with key \p k is present, returns its index and
+        // false.  Otherwise records \p newIndex for \p k and returns
+        // (newIndex, true).
+        std::pair<size_t, bool>
+        FindOrInsert(const Key &k, size_t hash, size_t newIndex,
+                     const EqualKey &equ, const _Vector &vec) {
+            _MaybeGrow();
+            const size_t mask = _slots.size() - 1;
+            size_t insertPos = npos;
+            for (size_t i = hash & mask; ; i = (i + 1) & mask) {
+                _Slot &s = _slots[i];
+                if (s.index == _EmptySlot) {
+                    if (insertPos == npos) {
+                        insertPos = i;
+                        ++_numUsed;
+                    }
+                    _slots[insertPos].hash = hash;
+                    _slots[insertPos].index = newIndex;
+                    return std::make_pair(newIndex, true);
+                }
+                if (s.index == _TombstoneSlot) {
+                    // Remember the first tombstone for reuse, but keep
+                    // probing in case the key exists further on.
+                    if (insertPos == npos)
+                        insertPos = i;
+                    continue;
+                }
+                if (s.hash == hash && equ(vec[s.index].GetValue().first, k))
+                    return std::make_pair(s.index, false);
+            }
+        }
+
+        // Insert an element known not to be present.
+        void InsertUnique(size_t hash, size_t index) {
+            _MaybeGrow();
+            const size_t mask = _slots.size() - 1;
+            for (size_t i = hash & mask; ; i = (i + 1) & mask) {
+                _Slot &s = _slots[i];
+                if (s.index == _EmptySlot || s.index == _TombstoneSlot) {
+                    if (s.index == _EmptySlot)
+                        ++_numUsed;
+                    s.hash = hash;
+                    s.index = index;
+                    return;
+                }
+            }
+        }
+
+        // Remove the element with key \p k, if present.
+        void Erase(const Key &k, size_t hash,
+                   const EqualKey &equ, const _Vector &vec) {
+            const size_t mask = _slots.size() - 1;
+            for (size_t i = hash & mask; ; i = (i + 1) & mask) {
+                _Slot &s = _slots[i];
+                if (s.index == _EmptySlot)
+                    return;
+                if (s.index != _TombstoneSlot && s.hash == hash &&
+                    equ(vec[s.index].GetValue().first, k)) {
+                    s.index = _TombstoneSlot;
+                    return;
+                }
+            }
+        }
+
+        // Repoint the slot recording \p oldIndex for an element with the
+        // given hash at \p newIndex.  Used when erasure moves an element
+        // within the vector; this deliberately matches on the recorded
+        // index instead of the key, since the vector is already reordered.
+        void UpdateIndex(size_t hash, size_t oldIndex, size_t newIndex) {
+            const size_t mask = _slots.size() - 1;
+            for (size_t i = hash & mask; ; i = (i + 1) & mask) {
+                _Slot &s = _slots[i];
+                if (s.index == _EmptySlot)
+                    return;
+                if (s.index == oldIndex && s.hash == hash) {
+                    s.index = newIndex;
+                    return;
+                }
+            }
+        }
+
+    private:
+        // Sentinels stored in _Slot::index.
+        static const size_t _EmptySlot = ~size_t(0);
+        static const size_t _TombstoneSlot = ~size_t(0) - 1;
+
+        // Number of slots covered by one prefetch, assuming 64-byte lines.
+        static const size_t _SlotsPerFetch = 64 / (2 * sizeof(size_t));
+
+        struct _Slot {
+            _Slot() : hash(0), index(_EmptySlot) {}
+            size_t hash;
+            size_t index;
+        };
+
+        static inline void _Prefetch(const void *addr) {
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(addr);
+#endif
+        }
+
+        static size_t _ComputeCapacity(size_t numElements) {
+            // Power of two, at most half full to start with.
+            size_t capacity = 64;
+            while (capacity < 2 * numElements)
+                capacity <<= 1;
+            return capacity;
+        }
+
+        void _MaybeGrow() {
+            if (4 * _numUsed < 3 * _slots.size())
+                return;
+            std::vector<_Slot> old;
+            old.swap(_slots);
+            _slots.resize(old.size() * 2);
+            _numUsed = 0;
+            for (size_t i = 0; i != old.size(); ++i) {
+                if (old[i].index < _TombstoneSlot)
+                    InsertUnique(old[i].hash, old[i].index);
+            }
+        }
+
+        std::vector<_Slot> _slots;
+        size_t _numUsed;
+    };
 
     // Note that we don't just use _Vector::iterator for accessing elements
     // of the TfDenseHashMap.  This is because the vector's iterator would
@@ -240,7 +393,7 @@ public:
     TfDenseHashMap(const TfDenseHashMap &rhs)
     :   _vectorHashFnEqualFn(rhs._vectorHashFnEqualFn) {
         if (rhs._h)
-            _h.reset(new _HashMap(*rhs._h));
+            _h.reset(new _FlatIndex(*rhs._h));
     }
 
     /// Assignment operator.
@@ -325,11 +478,11 @@ public:
     ///
     iterator find(const key_type &k) {
         if (_h) {
-            typename _HashMap::const_iterator iter = _h->find(k);
-            if (iter == _h->end())
+            size_t index = _h->Find(k, _hash()(k), _equ(), _vec());
+            if (index == _FlatIndex::npos)
                 return end();
 
-            return _vec().begin() + iter->second;
+            return _vec().begin() + index;
         } else {
             return _FindInVec(k);
         }
@@ -339,11 +492,11 @@ public:
     ///
     const_iterator find(const key_type &k) const {
         if (_h) {
-            typename _HashMap::const_iterator iter = _h->find(k);
-            if (iter == _h->end())
+            size_t index = _h->Find(k, _hash()(k), _equ(), _vec());
+            if (index == _FlatIndex::npos)
                 return end();
 
-            return _vec().begin() + iter->second;
+            return _vec().begin() + index;
         } else {
             return _FindInVec(k);
         }
@@ -362,11 +515,11 @@ public:
         if (_h) {
             // Attempt to insert the new index.  If this fails, we can't insert
             // v.
-            std::pair<typename _HashMap::iterator, bool> res =
-                _h->insert(std::make_pair(v.first, size()));
+            std::pair<size_t, bool> res = _h->FindOrInsert(
+                v.first, _hash()(v.first), size(), _equ(), _vec());
 
             if (!res.second)
-                return insert_result(_vec().begin() + res.first->second, false);
+                return insert_result(_vec().begin() + res.first, false);
         } else {
             // Bail if already inserted.
             iterator iter = _FindInVec(v.first);
@@ -438,9 +591,11 @@ public:
     ///
     void erase(const iterator &iter) {
 
-        // Erase key from hash table if applicable.
+        // Erase key from the index if applicable.  This must happen
+        // before the vector is reordered below, since erasure compares
+        // against keys in the vector.
         if (_h)
-            _h->erase(iter->first);
+            _h->Erase(iter->first, _hash()(iter->first), _equ(), _vec());
     
         // If we are not removing that last element...
         if (iter != std::prev(end())) {
@@ -454,7 +609,8 @@ public:
     
             // ... and update the moved element's index.
             if (_h)
-                (*_h)[vi->GetValue().first] = vi - _vec().begin();
+                _h->UpdateIndex(_hash()(vi->GetValue().first),
+                                size() - 1, vi - _vec().begin());
         }
     
         _vec().pop_back();
@@ -464,17 +620,14 @@ public:
     ///
     void erase(iterator i0, iterator i1) {
 
-        if (_h) {
-            for(iterator iter = i0; iter != i1; ++iter)
-                _h->erase(iter->first);
-        }
-
-        typename _Vector::const_iterator vremain = _vec().erase(
+        _vec().erase(
             i0._GetUnderlyingIterator(), i1._GetUnderlyingIterator());
 
+        // Erasing a range shifts every element behind it, so rebuilding
+        // the index wholesale is as cheap as repairing it.
         if (_h) {
-            for(; vremain != _vec().end(); ++vremain)
-                (*_h)[vremain->GetValue().first] = vremain - _vec().begin();
+            _h.reset();
+            _CreateTable();
         }
     }
 
@@ -498,10 +651,10 @@ public:
 
         } else {
 
-            // Otherwise, allocate a new hash map with the optimal size.
-            _h.reset(new _HashMap(sz, _hash(), _equ()));
+            // Otherwise, allocate a new index with the optimal size.
+            _h.reset(new _FlatIndex(sz));
             for(size_t i=0; i<sz; ++i)
-                _h->insert(std::make_pair(_vec()[i].GetValue().first, i));
+                _h->InsertUnique(_hash()(_vec()[i].GetValue().first), i);
         }
     }
 
@@ -580,9 +733,9 @@ private:
     // exist.
     inline void _CreateTable() {
         if (!_h) {
-            _h.reset(new _HashMap(Threshold, _hash(), _equ()));
+            _h.reset(new _FlatIndex(size() < Threshold ? Threshold : size()));
             for(size_t i=0; i < size(); ++i)
-                _h->insert(std::make_pair(_vec()[i].GetValue().first, i));
+                _h->InsertUnique(_hash()(_vec()[i].GetValue().first), i);
         }
     }
 
@@ -598,8 +751,8 @@ private:
 
     _VectorHashFnEqualFn _vectorHashFnEqualFn;
 
-    // Optional hash map that maps from keys to vector indices.
-    boost::scoped_ptr<_HashMap> _h;
+    // Optional index that maps from keys to vector indices.
+    boost::scoped_ptr<_FlatIndex> _h;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
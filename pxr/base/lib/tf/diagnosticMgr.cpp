@@ -36,9 +36,12 @@
 #include "pxr/base/tf/pyExceptionState.h"
 #endif // PXR_PYTHON_SUPPORT_ENABLED
 
+#include "pxr/base/arch/attributes.h"
 #include "pxr/base/arch/debugger.h"
+#include "pxr/base/arch/defines.h"
 #include "pxr/base/arch/demangle.h"
 #include "pxr/base/arch/function.h"
+#include "pxr/base/arch/hints.h"
 #include "pxr/base/arch/stackTrace.h"
 #include "pxr/base/arch/threads.h"
 
@@ -135,6 +138,78 @@ Tf_UnhandledAbort()
 
 TF_INSTANTIATE_SINGLETON(TfDiagnosticMgr);
 
+#if defined(ARCH_HAS_THREAD_LOCAL)
+
+// Mark bracketing is the hottest path through this code -- composition
+// brackets nearly every operation with a TfErrorMark -- so the mark count
+// and a pointer to this thread's error list live in a plain thread_local we
+// can reach in a handful of instructions, rather than in TBB
+// thread-specific storage whose lookup shows up in profiles.  Force the
+// accessor out-of-line since modern compilers generate way too many calls
+// to __tls_get_addr even if you cache a pointer to the thread_local
+// yourself.
+namespace {
+struct Tf_DiagnosticThreadData {
+    size_t errorMarkCount = 0;
+    TfDiagnosticMgr::ErrorList *errorList = nullptr;
+};
+} // end anonymous namespace
+
+static thread_local Tf_DiagnosticThreadData _tlThreadData;
+static Tf_DiagnosticThreadData &_GetThreadData() ARCH_NOINLINE;
+static Tf_DiagnosticThreadData &_GetThreadData()
+{
+    return _tlThreadData;
+}
+
+#endif // ARCH_HAS_THREAD_LOCAL
+
+void
+TfDiagnosticMgr::_CreateErrorMark()
+{
+#if defined(ARCH_HAS_THREAD_LOCAL)
+    ++_GetThreadData().errorMarkCount;
+#else
+    ++_errorMarkCounts.local();
+#endif
+}
+
+bool
+TfDiagnosticMgr::_DestroyErrorMark()
+{
+#if defined(ARCH_HAS_THREAD_LOCAL)
+    return --_GetThreadData().errorMarkCount == 0;
+#else
+    return --_errorMarkCounts.local() == 0;
+#endif
+}
+
+bool
+TfDiagnosticMgr::HasActiveErrorMark()
+{
+#if defined(ARCH_HAS_THREAD_LOCAL)
+    return _GetThreadData().errorMarkCount > 0;
+#else
+    return _errorMarkCounts.local() > 0;
+#endif
+}
+
+TfDiagnosticMgr::ErrorList &
+TfDiagnosticMgr::_GetErrorList()
+{
+#if defined(ARCH_HAS_THREAD_LOCAL)
+    // Entries in _errorList are stable for the life of their thread, so
+    // caching the pointer is safe.
+    Tf_DiagnosticThreadData &threadData = _GetThreadData();
+    if (ARCH_UNLIKELY(!threadData.errorList)) {
+        threadData.errorList = &_errorList.local();
+    }
+    return *threadData.errorList;
+#else
+    return _errorList.local();
+#endif
+}
+
 
 TfDiagnosticMgr::Delegate::~Delegate() {}
 
@@ -188,7 +263,7 @@ TfDiagnosticMgr::AppendError(TfError const &e) {
         _ReportError(e);
     } else {
         e._data->_serial = _nextSerial.fetch_and_increment();
-        ErrorList &errorList = _errorList.local();
+        ErrorList &errorList = _GetErrorList();
         errorList.push_back(e);
         _AppendErrorsToLogText(std::prev(errorList.end())); 
     }
@@ -209,7 +284,7 @@ TfDiagnosticMgr::_SpliceErrors(ErrorList &src)
             error._data->_serial = serial++;
         }
         // Now splice them into the main list.
-        ErrorList &errorList = _errorList.local();
+        ErrorList &errorList = _GetErrorList();
         // We store the begin iterator from the new list.  This iterator remains
         // valid *after the splice*, and iterates the spliced elements from src
         // in errorList.
@@ -418,7 +493,7 @@ void TfDiagnosticMgr::PostFatal(TfCallContext const &context,
 TfDiagnosticMgr::ErrorIterator
 TfDiagnosticMgr::EraseError(ErrorIterator i)
 {
-    ErrorList &errorList = _errorList.local();
+    ErrorList &errorList = _GetErrorList();
 
     return i == errorList.end() ? i : errorList.erase(i);
 }
@@ -426,7 +501,7 @@ TfDiagnosticMgr::EraseError(ErrorIterator i)
 TfDiagnosticMgr::ErrorIterator
 TfDiagnosticMgr::_GetErrorMarkBegin(size_t mark, size_t *nErrors)
 {
-    ErrorList &errorList = _errorList.local();
+    ErrorList &errorList = _GetErrorList();
 
     if (mark >= _nextSerial || errorList.empty()) {
         if (nErrors)
@@ -454,7 +529,7 @@ TfDiagnosticMgr::EraseRange(ErrorIterator first, ErrorIterator last)
     if (first == last)
         return last;
 
-    ErrorIterator result = _errorList.local().erase(first, last);
+    ErrorIterator result = _GetErrorList().erase(first, last);
     _RebuildErrorLogText();
     return result;
 }
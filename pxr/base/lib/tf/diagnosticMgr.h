@@ -171,10 +171,10 @@ public:
     void SetQuiet(bool quiet) { _quiet = quiet; }
     
     /// Return an iterator to the beginning of this thread's error list.
-    ErrorIterator GetErrorBegin() { return _errorList.local().begin(); }
+    ErrorIterator GetErrorBegin() { return _GetErrorList().begin(); }
 
     /// Return an iterator to the end of this thread's error list.
-    ErrorIterator GetErrorEnd() { return _errorList.local().end(); }
+    ErrorIterator GetErrorEnd() { return _GetErrorList().end(); }
 
     /// Remove error specified by iterator \p i.
     /// \deprecated Use TfErrorMark insetad.
@@ -248,7 +248,8 @@ public:
 
     /// Return true if an instance of TfErrorMark exists in the curren thread
     /// of exection, false otherwise.
-    bool HasActiveErrorMark() { return _errorMarkCounts.local() > 0; }
+    TF_API
+    bool HasActiveErrorMark();
 
 #if !defined(doxygen)
     //
@@ -384,11 +385,20 @@ private:
     TF_API
     ErrorIterator _GetErrorMarkBegin(size_t mark, size_t *nErrors);
 
-    // Invoked by ErrorMark ctor.
-    inline void _CreateErrorMark() { ++_errorMarkCounts.local(); }
+    // Invoked by ErrorMark ctor.  Out-of-line so the mark count can live in
+    // a plain thread_local -- mark bracketing is hot enough in composition
+    // that the TBB thread-specific storage lookup shows up in profiles.
+    TF_API
+    void _CreateErrorMark();
 
     // Invoked by ErrorMark dtor.
-    inline bool _DestroyErrorMark() { return --_errorMarkCounts.local() == 0; }
+    TF_API
+    bool _DestroyErrorMark();
+
+    // Return this thread's error list, caching a pointer to it in
+    // thread-local storage to avoid repeated lookups.
+    TF_API
+    ErrorList &_GetErrorList();
 
     // Report an error, either via delegate or print to stderr, and issue a
     // notice if this thread of execution is the main thread.
@@ -438,8 +448,9 @@ private:
     };
     tbb::enumerable_thread_specific<_LogText> _logText;
 
-    // Thread-specific error mark counts.  Use a native key for best performance
-    // here.
+    // Thread-specific error mark counts.  Only consulted on platforms
+    // without thread_local support; elsewhere the counts live in a plain
+    // thread_local (see diagnosticMgr.cpp).
     tbb::enumerable_thread_specific<
         size_t, tbb::cache_aligned_allocator<size_t>,
         tbb::ets_key_per_instance> _errorMarkCounts;
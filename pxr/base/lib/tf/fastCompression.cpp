@@ -30,10 +30,38 @@
 // XXX: Need to isolate symbols here?
 #include "pxrLZ4/lz4.h"
 
+#ifdef PXR_ZSTD_SUPPORT_ENABLED
+#include <zstd.h>
+#endif
+
+#include <cstdint>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 using namespace pxr_lz4;
 
+// Compressed buffers lead with a single signed byte: a value >= 0 is the
+// LZ4 chunk count (0 meaning a single chunk), and -1 indicates a single
+// Zstd frame.  The LZ4 chunk count never exceeds 127, so the negative
+// range is free for other codecs.
+static const int8_t _ZstdMarker = -1;
+
+bool
+TfFastCompression::IsCodecSupported(Codec codec)
+{
+    switch (codec) {
+    case LZ4:
+        return true;
+    case Zstd:
+#ifdef PXR_ZSTD_SUPPORT_ENABLED
+        return true;
+#else
+        return false;
+#endif
+    }
+    return false;
+}
+
 size_t
 TfFastCompression::GetMaxInputSize()
 {
@@ -41,11 +69,17 @@ TfFastCompression::GetMaxInputSize()
 }
 
 size_t
-TfFastCompression::GetCompressedBufferSize(size_t inputSize)
+TfFastCompression::GetCompressedBufferSize(size_t inputSize, Codec codec)
 {
     if (inputSize > GetMaxInputSize())
         return 0;
-    
+
+#ifdef PXR_ZSTD_SUPPORT_ENABLED
+    if (codec == Zstd) {
+        return ZSTD_compressBound(inputSize) + 1;
+    }
+#endif
+
     // If it fits in one chunk then it's just the compress bound plus 1.
     if (inputSize <= LZ4_MAX_INPUT_SIZE) {
         return LZ4_compressBound(inputSize) + 1;
@@ -61,7 +95,7 @@ TfFastCompression::GetCompressedBufferSize(size_t inputSize)
 
 size_t
 TfFastCompression::CompressToBuffer(
-    char const *input, char *compressed, size_t inputSize)
+    char const *input, char *compressed, size_t inputSize, Codec codec)
 {
     if (inputSize > GetMaxInputSize()) {
         TF_CODING_ERROR("Attempted to compress a buffer of %zu bytes, "
@@ -69,7 +103,26 @@ TfFastCompression::CompressToBuffer(
                         inputSize, GetMaxInputSize());
         return 0;
     }
-    
+
+    if (codec == Zstd) {
+#ifdef PXR_ZSTD_SUPPORT_ENABLED
+        compressed[0] = _ZstdMarker;
+        size_t n = ZSTD_compress(
+            compressed + 1, ZSTD_compressBound(inputSize),
+            input, inputSize, ZSTD_CLEVEL_DEFAULT);
+        if (ZSTD_isError(n)) {
+            TF_RUNTIME_ERROR("Failed to compress data: %s",
+                             ZSTD_getErrorName(n));
+            return ~0ull;
+        }
+        return n + 1;
+#else
+        TF_CODING_ERROR("Zstd compression requested but this build does "
+                        "not have Zstd support enabled");
+        return ~0ull;
+#endif
+    }
+
     // If it fits in one chunk, just do it.
     char const * const origCompressed = compressed;
     if (inputSize <= LZ4_MAX_INPUT_SIZE) {
@@ -106,8 +159,29 @@ TfFastCompression::DecompressFromBuffer(
     char const *compressed, char *output,
     size_t compressedSize, size_t maxOutputSize)
 {
-    // Check first byte for # chunks.
-    int nChunks = *compressed++;
+    // Check first byte for the codec/chunk count.
+    int nChunks = static_cast<int8_t>(*compressed++);
+    if (nChunks == _ZstdMarker) {
+#ifdef PXR_ZSTD_SUPPORT_ENABLED
+        size_t n = ZSTD_decompress(
+            output, maxOutputSize, compressed, compressedSize - 1);
+        if (ZSTD_isError(n)) {
+            TF_RUNTIME_ERROR("Failed to decompress data, possibly corrupt? "
+                             "Zstd error: %s", ZSTD_getErrorName(n));
+            return 0;
+        }
+        return n;
+#else
+        TF_RUNTIME_ERROR("Data is Zstd-compressed but this build does not "
+                         "have Zstd support enabled");
+        return 0;
+#endif
+    }
+    if (nChunks < 0) {
+        TF_RUNTIME_ERROR("Unrecognized compression codec marker %d, "
+                         "possibly corrupt data?", nChunks);
+        return 0;
+    }
     if (nChunks == 0) {
         // Just one.
         int nDecompressed = LZ4_decompress_safe(
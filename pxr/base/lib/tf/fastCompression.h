@@ -38,28 +38,43 @@ PXR_NAMESPACE_OPEN_SCOPE
 class TfFastCompression
 {
 public:
+    /// Compression codec.  LZ4 is always available; Zstd is available when
+    /// built with PXR_ENABLE_ZSTD_SUPPORT and typically yields considerably
+    /// better compression ratios at similar decompression speed.
+    enum Codec {
+        LZ4,
+        Zstd
+    };
+
+    /// Return true if \p codec is available in this build.
+    TF_API static bool
+    IsCodecSupported(Codec codec);
+
     /// Return the largest input buffer size that can be compressed with these
     /// functions.  Guaranteed to be at least 200 GB.
     TF_API static size_t
     GetMaxInputSize();
-    
+
     /// Return the largest possible compressed size for the given \p inputSize
     /// in the worst case (input is not compressible).  This is larger than
     /// \p inputSize.  If inputSize is larger than GetMaxInputSize(), return 0.
     TF_API static size_t
-    GetCompressedBufferSize(size_t inputSize);
+    GetCompressedBufferSize(size_t inputSize, Codec codec = LZ4);
 
     /// Compress \p inputSize bytes in \p input and store the result in
-    /// \p compressed.  The \p compressed buffer must point to at least
-    /// GetCompressedBufferSize(uncompressedSize) bytes.  Return the number of
-    /// bytes written to the \p compressed buffer.  Issue a runtime error and
-    /// return ~0 in case of an error.
+    /// \p compressed, using \p codec.  The \p compressed buffer must point to
+    /// at least GetCompressedBufferSize(uncompressedSize, codec) bytes.
+    /// Return the number of bytes written to the \p compressed buffer.  Issue
+    /// a runtime error and return ~0 in case of an error.
     TF_API static size_t
-    CompressToBuffer(char const *input, char *compressed, size_t inputSize);
-                           
+    CompressToBuffer(char const *input, char *compressed, size_t inputSize,
+                     Codec codec = LZ4);
+
     /// Decompress \p compressedSize bytes in \p compressed and store the
     /// result in \p output.  No more than \p maxOutputSize bytes will be
-    /// written to \p output.
+    /// written to \p output.  The codec used to compress the data is
+    /// determined from the data itself; decompressing Zstd data in a build
+    /// without Zstd support issues a runtime error and returns 0.
     TF_API static size_t
     DecompressFromBuffer(char const *compressed, char *output,
                          size_t compressedSize, size_t maxOutputSize);
@@ -86,6 +86,37 @@ static ArchMallocHook _mallocHook;      // zero-initialized POD
 static Tf_MallocGlobalData* _mallocGlobalData = NULL;
 bool TfMallocTag::_doTagging = false;
 
+/*
+ * Statistical sampling support.  When TF_MALLOC_TAG_SAMPLE_BYTES is set to a
+ * positive value N, only allocations that cross an N-byte boundary of
+ * allocated bytes are recorded, and each recorded allocation is attributed
+ * the number of intervals it crossed times N bytes.  This keeps the expected
+ * attributed size per tag correct while letting the vast majority of
+ * allocations skip the global mutex and bookkeeping entirely, which makes it
+ * feasible to leave tagging enabled on production jobs.  The countdown is
+ * per-thread, so the fast path touches no shared state.
+ */
+static int64_t _sampleIntervalBytes = 0;
+static thread_local int64_t _bytesUntilNextSample = 0;
+
+// Returns true if this allocation should be recorded, in which case
+// *weight is the number of bytes to attribute to it.
+static inline bool
+_TakeSample(size_t nBytes, size_t* weight)
+{
+    _bytesUntilNextSample -= nBytes;
+    if (ARCH_LIKELY(_bytesUntilNextSample >= 0))
+        return false;
+
+    size_t w = 0;
+    do {
+        w += _sampleIntervalBytes;
+        _bytesUntilNextSample += _sampleIntervalBytes;
+    } while (_bytesUntilNextSample < 0);
+    *weight = w;
+    return true;
+}
+
 static bool
 _UsePtmalloc()
 {
@@ -960,11 +991,17 @@ TfMallocTag::_MallocWrapper(size_t nBytes, const void*)
     if (_ShouldNotTag(&td) || ARCH_UNLIKELY(!ptr))
         return ptr;
 
+    size_t blockSize = Tf_GetMallocBlockSize(ptr, nBytes);
+
+    // In sampling mode, most allocations skip bookkeeping entirely;
+    // sampled ones are recorded with their attributed weight.
+    if (_sampleIntervalBytes > 0 && !_TakeSample(blockSize, &blockSize))
+        return ptr;
+
     {
         tbb::spin_mutex::scoped_lock lock(_mallocGlobalData->_mutex);
-    
+
         Tf_MallocPathNode* node = _GetCurrentPathNodeNoLock(td);
-        size_t blockSize = Tf_GetMallocBlockSize(ptr, nBytes);
 
         // Update malloc global data with bookkeeping information. This has to
         // happen while the mutex is held.
@@ -1054,9 +1091,14 @@ TfMallocTag::_ReallocWrapper(void* oldPtr, size_t nBytes, const void*)
         if (shouldNotTag || ARCH_UNLIKELY(!newPtr))
             return newPtr;
 
-        Tf_MallocPathNode* newNode = _GetCurrentPathNodeNoLock(td);
         size_t blockSize = Tf_GetMallocBlockSize(newPtr, nBytes);
 
+        // See comment in _MallocWrapper regarding sampling mode.
+        if (_sampleIntervalBytes > 0 && !_TakeSample(blockSize, &blockSize))
+            return newPtr;
+
+        Tf_MallocPathNode* newNode = _GetCurrentPathNodeNoLock(td);
+
         // Update malloc global data with bookkeeping information. This has to
         // happen while the mutex is held.
         if (_mallocGlobalData->_RegisterPathNodeForBlock(
@@ -1096,10 +1138,15 @@ TfMallocTag::_MemalignWrapper(size_t alignment, size_t nBytes, const void*)
     if (_ShouldNotTag(&td) || ARCH_UNLIKELY(!ptr))
         return ptr;
 
+    size_t blockSize = Tf_GetMallocBlockSize(ptr, nBytes);
+
+    // See comment in _MallocWrapper regarding sampling mode.
+    if (_sampleIntervalBytes > 0 && !_TakeSample(blockSize, &blockSize))
+        return ptr;
+
     tbb::spin_mutex::scoped_lock lock(_mallocGlobalData->_mutex);
 
     Tf_MallocPathNode* node = _GetCurrentPathNodeNoLock(td);
-    size_t blockSize = Tf_GetMallocBlockSize(ptr, nBytes);
 
     // Update malloc global data with bookkeeping information. This has to
     // happen while the mutex is held.
@@ -1414,8 +1461,20 @@ TfMallocTag::_Initialize(std::string* errMsg)
     // of this function so that all subsequent memory allocations are captured.
     _SetTagging(_TaggingDisabled);
 
+    _sampleIntervalBytes = TfGetenvInt("TF_MALLOC_TAG_SAMPLE_BYTES", 0);
+
     bool usePtmalloc = _UsePtmalloc();
-    
+
+    if (_sampleIntervalBytes > 0 && usePtmalloc) {
+        // The ptmalloc-specific implementation derives per-block sizes from
+        // the allocator's block headers at free time, which is incompatible
+        // with attributing sampled weights, so sampling always uses the
+        // allocator-agnostic implementation.
+        TF_WARN("TF_MALLOC_TAG_SAMPLE_BYTES is set; using allocator-"
+                "agnostic implementation for sampled tagging.");
+        usePtmalloc = false;
+    }
+
     if (usePtmalloc) {
         // index 0 is reserved for untracked malloc/free's:
         _mallocGlobalData->_allPathNodes.push_back(NULL);
@@ -183,6 +183,14 @@ public:
     /// memory allocated prior to calling \c Initialize() is not tracked i.e.
     /// all data refers to allocations that happen subsequent to calling \c
     /// Initialize().
+    ///
+    /// Setting the environment variable TF_MALLOC_TAG_SAMPLE_BYTES to a
+    /// positive value N enables statistical sampling: only allocations that
+    /// cross an N-byte boundary of allocated bytes are recorded, each
+    /// attributed a correspondingly scaled size.  Reported numbers become
+    /// estimates, but the per-allocation cost for unsampled allocations
+    /// drops to a per-thread counter decrement, making it practical to
+    /// leave tagging enabled on production jobs.
     TF_API static bool Initialize(std::string* errMsg);
 
     /// Return true if the tagging system is active.
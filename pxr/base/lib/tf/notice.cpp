@@ -166,4 +166,45 @@ TfNotice::Block::~Block()
     Tf_NoticeRegistry::_GetInstance()._DecrementBlockCount();
 }
 
+TfNotice::Batch::Batch(bool parallelDelivery)
+    : _parallel(parallelDelivery)
+{
+    Tf_NoticeRegistry::_GetInstance()._BeginBatching();
+}
+
+TfNotice::Batch::~Batch()
+{
+    Tf_NoticeRegistry::_GetInstance()._EndBatching(_parallel);
+}
+
+size_t
+TfNotice::Batch::Flush()
+{
+    Tf_NoticeRegistry &reg = Tf_NoticeRegistry::_GetInstance();
+    size_t nSent = reg._EndBatching(_parallel);
+    reg._BeginBatching();
+    return nSent;
+}
+
+size_t
+TfNotice::SendBatched(std::shared_ptr<const TfNotice> const &notice)
+{
+    return _SendBatched(notice, 0, 0, typeid(void));
+}
+
+size_t
+TfNotice::_SendBatched(std::shared_ptr<const TfNotice> const &notice,
+                       const TfWeakBase *sender,
+                       const void *senderUniqueId,
+                       const type_info &senderType)
+{
+    if (!notice) {
+        TF_CODING_ERROR("NULL notice passed to SendBatched");
+        return 0;
+    }
+    TfType noticeType = TfType::Find(typeid(*notice));
+    return Tf_NoticeRegistry::_GetInstance().
+        _SendOrDefer(notice, noticeType, sender, senderUniqueId, senderType);
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
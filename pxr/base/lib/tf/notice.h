@@ -37,6 +37,7 @@
 #include "pxr/base/arch/hints.h"
 
 #include <list>
+#include <memory>
 #include <typeinfo>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -454,6 +455,48 @@ public:
         TF_API ~Block();
     };
 
+    /// Batches sending of notices in the current thread.
+    ///
+    /// While one or more \c TfNotice::Batch is instantiated, notices sent
+    /// in the current thread via SendBatched() are queued rather than
+    /// delivered immediately.  When the outermost batch is destroyed (or
+    /// Flush() is called) the queued notices are coalesced -- a queued
+    /// notice is superseded by a later notice of the same type from the
+    /// same sender -- and then delivered.  If the batch was constructed
+    /// with \p parallelDelivery true, delivery of the queued notices is
+    /// fanned out across threads, so listeners must be prepared to be
+    /// invoked concurrently.
+    ///
+    /// Notices sent via the regular Send() calls are unaffected by an
+    /// active batch and are delivered immediately as usual.
+    class Batch {
+    public:
+        TF_API explicit Batch(bool parallelDelivery = false);
+        TF_API ~Batch();
+
+        /// Deliver all notices queued so far, returning the number of
+        /// deliveries made.
+        TF_API size_t Flush();
+
+    private:
+        bool _parallel;
+    };
+
+    /// Deliver \p notice to interested listeners as Send() would, unless a
+    /// \c TfNotice::Batch is active in the current thread, in which case
+    /// the notice is queued and delivered when the batch flushes.  Because
+    /// delivery may be deferred, the notice must be heap-allocated;
+    /// ownership is shared with the queue.  Returns the number of
+    /// deliveries made, which is zero when the notice is queued.
+    TF_API
+    static size_t SendBatched(std::shared_ptr<const TfNotice> const &notice);
+
+    /// Variant of SendBatched() that takes the sender as an argument, as
+    /// the Send(sender) form does.
+    template <typename SenderPtr>
+    static size_t SendBatched(std::shared_ptr<const TfNotice> const &notice,
+                              SenderPtr const &s);
+
 private:
     // Abstract base class for calling listeners.
     // A typed-version derives (via templating) off this class.
@@ -770,6 +813,12 @@ private:
                          const void *senderUniqueId,
                          const std::type_info & senderType) const;
 
+    TF_API
+    static size_t _SendBatched(std::shared_ptr<const TfNotice> const &notice,
+                               const TfWeakBase* sender,
+                               const void *senderUniqueId,
+                               const std::type_info & senderType);
+
     friend class Tf_NoticeRegistry;
 
     // Befriend the wrapping so it can access _SendWithType() directly
@@ -787,6 +836,18 @@ TfNotice::Send(SenderPtr const &s) const
                  typeid(typename SenderPtr::DataType) : typeid(void));
 }
 
+template <typename SenderPtr>
+size_t
+TfNotice::SendBatched(std::shared_ptr<const TfNotice> const &notice,
+                      SenderPtr const &s)
+{
+    const TfWeakBase *senderWeakBase = s ? s.GetWeakBase() : NULL;
+    return _SendBatched(notice, senderWeakBase,
+                        senderWeakBase ? s.GetUniqueIdentifier() : 0,
+                        senderWeakBase ?
+                        typeid(typename SenderPtr::DataType) : typeid(void));
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
 
 #endif // TF_NOTICE_H
@@ -32,6 +32,9 @@
 #include "pxr/base/tf/stringUtils.h"
 #include "pxr/base/arch/demangle.h"
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
 #include <typeinfo>
 
 using std::string;
@@ -362,11 +365,92 @@ Tf_NoticeRegistry::_IncrementBlockCount()
     ++_perThreadBlockCount.local();
 }
 
-void 
+void
 Tf_NoticeRegistry::_DecrementBlockCount()
 {
     --_globalBlockCount;
     --_perThreadBlockCount.local();
 }
 
+void
+Tf_NoticeRegistry::_BeginBatching()
+{
+    ++_perThreadBatch.local().depth;
+}
+
+size_t
+Tf_NoticeRegistry::_EndBatching(bool parallel)
+{
+    _BatchState &state = _perThreadBatch.local();
+    if (!TF_VERIFY(state.depth > 0)) {
+        return 0;
+    }
+    if (--state.depth > 0) {
+        return 0;
+    }
+
+    // Take the queue locally; deliveries below may themselves send (or
+    // batch) further notices.
+    vector<_DeferredNotice> queue;
+    queue.swap(state.queue);
+
+    if (parallel && queue.size() > 1) {
+        std::atomic<size_t> nSent(0);
+        tbb::parallel_for(
+            tbb::blocked_range<size_t>(0, queue.size()),
+            [this, &queue, &nSent](tbb::blocked_range<size_t> const &r) {
+                for (size_t i = r.begin(); i != r.end(); ++i) {
+                    _DeferredNotice const &d = queue[i];
+                    nSent += _Send(*d.notice, d.noticeType, d.sender,
+                                   d.senderUniqueId, *d.senderType);
+                }
+            });
+        return nSent;
+    }
+
+    size_t nSent = 0;
+    TF_FOR_ALL(i, queue) {
+        nSent += _Send(*i->notice, i->noticeType, i->sender,
+                       i->senderUniqueId, *i->senderType);
+    }
+    return nSent;
+}
+
+size_t
+Tf_NoticeRegistry::_SendOrDefer(const std::shared_ptr<const TfNotice> &n,
+                                const TfType &noticeType,
+                                const TfWeakBase *s,
+                                const void *senderUniqueId,
+                                const std::type_info &senderType)
+{
+    if (!TF_VERIFY(n)) {
+        return 0;
+    }
+
+    _BatchState &state = _perThreadBatch.local();
+    if (state.depth == 0) {
+        return _Send(*n, noticeType, s, senderUniqueId, senderType);
+    }
+
+    // Coalesce: a queued notice of the same type from the same sender is
+    // superseded by this one.
+    TF_FOR_ALL(i, state.queue) {
+        if (i->noticeType == noticeType && i->sender == s &&
+            i->senderUniqueId == senderUniqueId) {
+            i->notice = n;
+            i->senderType = &senderType;
+            return 0;
+        }
+    }
+
+    _DeferredNotice d;
+    d.notice = n;
+    d.noticeType = noticeType;
+    d.sender = s;
+    d.senderUniqueId = senderUniqueId;
+    d.senderType = &senderType;
+    state.queue.push_back(d);
+    return 0;
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
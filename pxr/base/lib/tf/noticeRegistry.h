@@ -41,6 +41,8 @@
 #include <tbb/enumerable_thread_specific.h>
 #include <tbb/spin_mutex.h>
 #include <atomic>
+#include <memory>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -119,6 +121,26 @@ public:
     TF_API
     void _DecrementBlockCount();
 
+    // Begin batching notices sent via _SendOrDefer in the current thread.
+    TF_API
+    void _BeginBatching();
+
+    // End the current thread's batching scope.  If this ends the outermost
+    // scope, deliver the queued notices (coalesced per notice-type/sender
+    // pair, keeping the last notice queued for each) and return the total
+    // number of deliveries made.  If \p parallel is true the queued notices
+    // are fanned out across threads.
+    TF_API
+    size_t _EndBatching(bool parallel);
+
+    // Like _Send, but if a batching scope is active in the current thread,
+    // queue the notice for delivery when the scope ends and return 0.
+    TF_API
+    size_t _SendOrDefer(const std::shared_ptr<const TfNotice> &n,
+                        const TfType &noticeType,
+                        const TfWeakBase *s, const void *senderUniqueId,
+                        const std::type_info &senderType);
+
 private:
     Tf_NoticeRegistry();
     friend class TfSingleton<Tf_NoticeRegistry>;
@@ -253,6 +275,24 @@ private:
 
     std::atomic<size_t> _globalBlockCount;
     tbb::enumerable_thread_specific<size_t> _perThreadBlockCount;
+
+    // A notice queued by _SendOrDefer while a batching scope is active.
+    struct _DeferredNotice {
+        std::shared_ptr<const TfNotice> notice;
+        TfType noticeType;
+        const TfWeakBase *sender;
+        const void *senderUniqueId;
+        const std::type_info *senderType;
+    };
+
+    // Per-thread batching state; the queue is only touched by its own
+    // thread, so it needs no locking.
+    struct _BatchState {
+        _BatchState() : depth(0) {}
+        size_t depth;
+        std::vector<_DeferredNotice> queue;
+    };
+    tbb::enumerable_thread_specific<_BatchState> _perThreadBatch;
 };
 
 TF_API_TEMPLATE_CLASS(TfSingleton<Tf_NoticeRegistry>);
@@ -43,6 +43,67 @@ TfPoolAllocator::TfPoolAllocator(size_t elementSize, size_t bytesPerChunk)
     _freeList = NULL;
     _freeListLength = 0;
     _threadSafety = true;
+    _perThreadCaching = false;
+}
+
+void
+TfPoolAllocator::SetPerThreadCaching(bool enable)
+{
+    if (_perThreadCaching && !enable) {
+        // Flush every thread's cache back to the shared free list.  The
+        // caller guarantees no concurrent Alloc/Free, so walking the
+        // thread-specific instances is safe.
+        for (_LocalCache &cache : _localCache) {
+            while (cache.head) {
+                _PoolNode *node = cache.head;
+                cache.head = node->next;
+                node->next = _freeList;
+                _freeList = node;
+                _freeListLength++;
+            }
+            cache.length = 0;
+        }
+    }
+    _perThreadCaching = enable;
+}
+
+void
+TfPoolAllocator::_FillLocalCache(_LocalCache *cache)
+{
+    TF_AXIOM(!cache->head);
+    tbb::spin_mutex::scoped_lock lock(_fastMutex);
+    _PoolNode *head = NULL;
+    size_t n = 0;
+    while (n != _CacheBatchSize) {
+        _PoolNode *node = _freeList ? _freeList : _Refill();
+        _freeList = node->next;
+        _freeListLength--;
+        node->next = head;
+        head = node;
+        ++n;
+    }
+    cache->head = head;
+    cache->length = n;
+}
+
+void
+TfPoolAllocator::_FlushLocalCacheBatch(_LocalCache *cache)
+{
+    TF_AXIOM(cache->length >= _CacheBatchSize);
+
+    // Detach a batch from the front of the cache.
+    _PoolNode *head = cache->head;
+    _PoolNode *tail = head;
+    for (size_t i = 1; i != _CacheBatchSize; ++i) {
+        tail = tail->next;
+    }
+    cache->head = tail->next;
+    cache->length -= _CacheBatchSize;
+
+    tbb::spin_mutex::scoped_lock lock(_fastMutex);
+    tail->next = _freeList;
+    _freeList = head;
+    _freeListLength += _CacheBatchSize;
 }
 
 TfPoolAllocator::~TfPoolAllocator()
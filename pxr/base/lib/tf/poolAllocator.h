@@ -30,6 +30,7 @@
 #include "pxr/pxr.h"
 #include "pxr/base/tf/api.h"
 
+#include <tbb/enumerable_thread_specific.h>
 #include <tbb/spin_mutex.h>
 #include <vector>
 
@@ -78,13 +79,35 @@ public:
     /// state is with the lock enabled.
     void SetThreadSafety(bool threadSafety) { _threadSafety = threadSafety; }
 
+    /// Enable or disable per-thread free-list caching.
+    ///
+    /// When enabled, each thread keeps a private cache of free elements and
+    /// only touches the shared free list (and its lock) to grab or return a
+    /// batch at a time, so parallel allocation-heavy workloads do not
+    /// serialize on the allocator.  Caches are rebalanced automatically: a
+    /// thread whose cache grows past twice the batch size returns a batch to
+    /// the shared list.  Elements sitting in a thread's cache are counted as
+    /// in use by GetBytesInUse().  This call must not race with concurrent
+    /// Alloc() or Free() calls; disabling flushes all caches back to the
+    /// shared free list.
+    TF_API void SetPerThreadCaching(bool enable);
+
     /// Returns memory out of the pool allocator.
     ///
     /// The memory returned by this routine is suitably aligned for all
     /// purposes.
     void* Alloc() {
         _PoolNode* node;
-        if (_threadSafety) {
+        if (_perThreadCaching) {
+            _LocalCache &cache = _localCache.local();
+            if (!cache.head) {
+                _FillLocalCache(&cache);
+            }
+            node = cache.head;
+            cache.head = node->next;
+            cache.length--;
+        }
+        else if (_threadSafety) {
             tbb::spin_mutex::scoped_lock lock(_fastMutex);
             node = _freeList ? _freeList : _Refill();
             _freeList = node->next;
@@ -98,14 +121,22 @@ public:
 
         return node;
     }
-    
+
     /// Frees up the memory previously granted by the allocator.
     ///
     /// The location \c ptr must have been obtained by a previous call to \c
     /// Alloc(); if not, chaos will quickly ensue.
     void Free(const void* ptr) {
         void *nonConstPtr = const_cast<void *>(ptr);
-        if (_threadSafety) {
+        if (_perThreadCaching) {
+            _LocalCache &cache = _localCache.local();
+            reinterpret_cast<_PoolNode*>(nonConstPtr)->next = cache.head;
+            cache.head = reinterpret_cast<_PoolNode*>(nonConstPtr);
+            if (++cache.length >= 2 * _CacheBatchSize) {
+                _FlushLocalCacheBatch(&cache);
+            }
+        }
+        else if (_threadSafety) {
             tbb::spin_mutex::scoped_lock lock(_fastMutex);
 
             reinterpret_cast<_PoolNode*>(nonConstPtr)->next = _freeList;
@@ -154,8 +185,20 @@ private:
         _PoolNode* next;
     };
 
+    // Number of elements moved between a thread's cache and the shared free
+    // list at a time when per-thread caching is enabled.
+    static const size_t _CacheBatchSize = 32;
+
+    struct _LocalCache {
+        _LocalCache() : head(NULL), length(0) {}
+        _PoolNode *head;
+        size_t length;
+    };
+
     TF_API _PoolNode* _Refill();
-    
+    TF_API void _FillLocalCache(_LocalCache *cache);
+    TF_API void _FlushLocalCacheBatch(_LocalCache *cache);
+
     tbb::spin_mutex          _fastMutex;
     _PoolNode *              _freeList;
     size_t                   _freeListLength;
@@ -163,7 +206,10 @@ private:
     const size_t             _bytesPerChunk;
     std::vector<_PoolNode *> _chunks;
     bool                     _threadSafety;
+    bool                     _perThreadCaching;
     bool                     _freeCalled;
+
+    tbb::enumerable_thread_specific<_LocalCache> _localCache;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,460 @@
+//
+// Copyright 2017 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef TF_SMALLVECTOR_H
+#define TF_SMALLVECTOR_H
+
+/// \file tf/smallVector.h
+
+#include "pxr/pxr.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class TfSmallVector
+///
+/// A vector that stores up to \p N elements in place, falling back to
+/// heap allocation only when it grows beyond that.  Hot paths commonly
+/// build many vectors of just a handful of elements, and the heap
+/// traffic for those tiny allocations dominates their cost; storing the
+/// typical case inline eliminates it.
+///
+/// The interface follows std::vector.  Growth moves elements into the
+/// new storage rather than copying them.  Unlike std::vector, swap() and
+/// move construction from a vector whose elements are stored locally
+/// must move the elements themselves, so iterators and element addresses
+/// are not preserved across those operations.
+///
+template <typename T, size_t N>
+class TfSmallVector
+{
+public:
+    typedef T value_type;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef T* iterator;
+    typedef const T* const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+    typedef size_t size_type;
+    typedef ptrdiff_t difference_type;
+
+    TfSmallVector()
+        : _size(0)
+        , _capacity(N)
+    {
+    }
+
+    explicit TfSmallVector(size_type n)
+        : TfSmallVector()
+    {
+        resize(n);
+    }
+
+    TfSmallVector(size_type n, const value_type& value)
+        : TfSmallVector()
+    {
+        assign(n, value);
+    }
+
+    TfSmallVector(std::initializer_list<value_type> values)
+        : TfSmallVector()
+    {
+        assign(values.begin(), values.end());
+    }
+
+    template <typename ForwardIterator,
+              typename = typename std::enable_if<
+                  !std::is_integral<ForwardIterator>::value>::type>
+    TfSmallVector(ForwardIterator first, ForwardIterator last)
+        : TfSmallVector()
+    {
+        assign(first, last);
+    }
+
+    TfSmallVector(const TfSmallVector& rhs)
+        : TfSmallVector()
+    {
+        assign(rhs.begin(), rhs.end());
+    }
+
+    TfSmallVector(TfSmallVector&& rhs)
+        : _size(0)
+        , _capacity(N)
+    {
+        _MoveFrom(std::move(rhs));
+    }
+
+    ~TfSmallVector()
+    {
+        _Destroy(begin(), end());
+        _FreeStorage();
+    }
+
+    TfSmallVector& operator=(const TfSmallVector& rhs)
+    {
+        if (this != &rhs) {
+            assign(rhs.begin(), rhs.end());
+        }
+        return *this;
+    }
+
+    TfSmallVector& operator=(TfSmallVector&& rhs)
+    {
+        if (this != &rhs) {
+            clear();
+            _FreeStorage();
+            _capacity = N;
+            _MoveFrom(std::move(rhs));
+        }
+        return *this;
+    }
+
+    TfSmallVector& operator=(std::initializer_list<value_type> values)
+    {
+        assign(values.begin(), values.end());
+        return *this;
+    }
+
+    iterator begin() { return _Data(); }
+    const_iterator begin() const { return _Data(); }
+    const_iterator cbegin() const { return _Data(); }
+
+    iterator end() { return _Data() + _size; }
+    const_iterator end() const { return _Data() + _size; }
+    const_iterator cend() const { return _Data() + _size; }
+
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    const_reverse_iterator rbegin() const {
+        return const_reverse_iterator(end());
+    }
+    const_reverse_iterator crbegin() const {
+        return const_reverse_iterator(end());
+    }
+
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rend() const {
+        return const_reverse_iterator(begin());
+    }
+    const_reverse_iterator crend() const {
+        return const_reverse_iterator(begin());
+    }
+
+    value_type* data() { return _Data(); }
+    const value_type* data() const { return _Data(); }
+
+    size_type size() const { return _size; }
+    size_type capacity() const { return _capacity; }
+    bool empty() const { return _size == 0; }
+
+    /// The number of elements this vector can hold without allocating.
+    static constexpr size_type InlineCapacity() { return N; }
+
+    reference operator[](size_type i) { return _Data()[i]; }
+    const_reference operator[](size_type i) const { return _Data()[i]; }
+
+    reference front() { return *begin(); }
+    const_reference front() const { return *begin(); }
+
+    reference back() { return _Data()[_size - 1]; }
+    const_reference back() const { return _Data()[_size - 1]; }
+
+    void reserve(size_type newCapacity)
+    {
+        if (newCapacity > _capacity) {
+            _Relocate(newCapacity);
+        }
+    }
+
+    void resize(size_type newSize)
+    {
+        if (newSize < _size) {
+            _Destroy(begin() + newSize, end());
+        }
+        else {
+            reserve(newSize);
+            for (iterator it = end(), e = begin() + newSize; it != e; ++it) {
+                new (it) value_type();
+            }
+        }
+        _size = newSize;
+    }
+
+    void resize(size_type newSize, const value_type& value)
+    {
+        if (newSize < _size) {
+            _Destroy(begin() + newSize, end());
+        }
+        else {
+            reserve(newSize);
+            for (iterator it = end(), e = begin() + newSize; it != e; ++it) {
+                new (it) value_type(value);
+            }
+        }
+        _size = newSize;
+    }
+
+    void clear()
+    {
+        _Destroy(begin(), end());
+        _size = 0;
+    }
+
+    void assign(size_type n, const value_type& value)
+    {
+        clear();
+        reserve(n);
+        for (size_type i = 0; i < n; ++i) {
+            new (_Data() + i) value_type(value);
+        }
+        _size = n;
+    }
+
+    template <typename ForwardIterator,
+              typename = typename std::enable_if<
+                  !std::is_integral<ForwardIterator>::value>::type>
+    void assign(ForwardIterator first, ForwardIterator last)
+    {
+        clear();
+        const size_type n = std::distance(first, last);
+        reserve(n);
+        for (iterator it = begin(); first != last; ++first, ++it) {
+            new (it) value_type(*first);
+        }
+        _size = n;
+    }
+
+    void push_back(const value_type& value)
+    {
+        _GrowIfFull();
+        new (end()) value_type(value);
+        ++_size;
+    }
+
+    void push_back(value_type&& value)
+    {
+        _GrowIfFull();
+        new (end()) value_type(std::move(value));
+        ++_size;
+    }
+
+    template <typename... Args>
+    void emplace_back(Args&&... args)
+    {
+        _GrowIfFull();
+        new (end()) value_type(std::forward<Args>(args)...);
+        ++_size;
+    }
+
+    void pop_back()
+    {
+        back().~value_type();
+        --_size;
+    }
+
+    iterator insert(const_iterator pos, const value_type& value)
+    {
+        return _Insert(pos, value_type(value));
+    }
+
+    iterator insert(const_iterator pos, value_type&& value)
+    {
+        return _Insert(pos, std::move(value));
+    }
+
+    template <typename ForwardIterator,
+              typename = typename std::enable_if<
+                  !std::is_integral<ForwardIterator>::value>::type>
+    iterator insert(const_iterator pos, ForwardIterator first,
+                    ForwardIterator last)
+    {
+        const size_type offset = pos - cbegin();
+        for (size_type i = offset; first != last; ++first, ++i) {
+            _Insert(cbegin() + i, value_type(*first));
+        }
+        return begin() + offset;
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        return erase(pos, pos + 1);
+    }
+
+    iterator erase(const_iterator first, const_iterator last)
+    {
+        iterator f = begin() + (first - cbegin());
+        iterator l = begin() + (last - cbegin());
+        if (f != l) {
+            iterator newEnd = std::move(l, end(), f);
+            _Destroy(newEnd, end());
+            _size = newEnd - begin();
+        }
+        return f;
+    }
+
+    void swap(TfSmallVector& rhs)
+    {
+        TfSmallVector tmp(std::move(rhs));
+        rhs = std::move(*this);
+        *this = std::move(tmp);
+    }
+
+    bool operator==(const TfSmallVector& rhs) const
+    {
+        return _size == rhs._size && std::equal(begin(), end(), rhs.begin());
+    }
+
+    bool operator!=(const TfSmallVector& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+private:
+    bool _IsLocal() const
+    {
+        // Heap storage is only ever allocated to grow past the inline
+        // capacity, so a capacity of N means the elements live in the
+        // inline buffer.
+        return _capacity == N;
+    }
+
+    value_type* _Data()
+    {
+        return _IsLocal()
+            ? reinterpret_cast<value_type*>(&_local)
+            : _remote;
+    }
+
+    const value_type* _Data() const
+    {
+        return _IsLocal()
+            ? reinterpret_cast<const value_type*>(&_local)
+            : _remote;
+    }
+
+    static void _Destroy(iterator first, iterator last)
+    {
+        for (; first != last; ++first) {
+            first->~value_type();
+        }
+    }
+
+    void _FreeStorage()
+    {
+        if (!_IsLocal()) {
+            ::operator delete(_remote);
+        }
+    }
+
+    // Move \p count elements from \p src into the raw storage at
+    // \p dst, destroying the sources.
+    static void _UninitializedMove(value_type* src, size_type count,
+                                   value_type* dst)
+    {
+        for (size_type i = 0; i < count; ++i) {
+            new (dst + i) value_type(std::move(src[i]));
+            src[i].~value_type();
+        }
+    }
+
+    // Move the contents of \p rhs into this empty, locally-stored
+    // vector.  Heap storage can simply be stolen; inline elements are
+    // moved one by one.
+    void _MoveFrom(TfSmallVector&& rhs)
+    {
+        if (rhs._IsLocal()) {
+            _UninitializedMove(rhs._Data(), rhs._size,
+                               reinterpret_cast<value_type*>(&_local));
+        }
+        else {
+            _remote = rhs._remote;
+            _capacity = rhs._capacity;
+        }
+        _size = rhs._size;
+        rhs._size = 0;
+        rhs._capacity = N;
+    }
+
+    // Move the elements into new heap storage of \p newCapacity.
+    void _Relocate(size_type newCapacity)
+    {
+        value_type* newData = static_cast<value_type*>(
+            ::operator new(newCapacity * sizeof(value_type)));
+        _UninitializedMove(_Data(), _size, newData);
+        _FreeStorage();
+        _remote = newData;
+        _capacity = newCapacity;
+    }
+
+    void _GrowIfFull()
+    {
+        if (_size == _capacity) {
+            _Relocate(_capacity * 2);
+        }
+    }
+
+    iterator _Insert(const_iterator pos, value_type&& value)
+    {
+        const size_type offset = pos - cbegin();
+        _GrowIfFull();
+        iterator it = begin() + offset;
+        if (it == end()) {
+            new (it) value_type(std::move(value));
+        }
+        else {
+            new (end()) value_type(std::move(back()));
+            std::move_backward(it, end() - 1, end());
+            *it = std::move(value);
+        }
+        ++_size;
+        return it;
+    }
+
+private:
+    union {
+        typename std::aligned_storage<
+            sizeof(value_type) * N, alignof(value_type)>::type _local;
+        value_type* _remote;
+    };
+
+    size_type _size;
+    size_type _capacity;
+};
+
+template <typename T, size_t N>
+void swap(TfSmallVector<T, N>& lhs, TfSmallVector<T, N>& rhs)
+{
+    lhs.swap(rhs);
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // TF_SMALLVECTOR_H
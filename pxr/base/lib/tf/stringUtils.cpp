@@ -30,9 +30,14 @@
 #include "pxr/base/tf/tf.h"
 #include "pxr/base/tf/token.h"
 #include "pxr/base/tf/staticData.h"
+#include "pxr/base/arch/defines.h"
 #include "pxr/base/arch/inttypes.h"
 #include "pxr/base/arch/vsnprintf.h"
 
+#if defined(ARCH_CPU_INTEL) && defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 #include <boost/type_traits/is_signed.hpp>
 #include <boost/utility/enable_if.hpp>
 
@@ -394,9 +399,96 @@ TfStringJoin(const set<string>& strings, const char* separator)
 }
 
 static inline
+#if defined(ARCH_CPU_INTEL) && defined(__SSE2__)
+
+// Vectorized delimiter scanning for small delimiter sets.  SSE2 is baseline
+// on x86-64 so this requires no special compile flags.
+struct _SseDelims
+{
+    _SseDelims(char const *delimiters, int count) : n(count) {
+        for (int i = 0; i != n; ++i) {
+            chars[i] = delimiters[i];
+            vec[i] = _mm_set1_epi8(delimiters[i]);
+        }
+    }
+    __m128i vec[4];
+    char chars[4];
+    int n;
+};
+
+// Return a pointer to the first delimiter character in [p, end), or end.
+static inline char const *
+_FindFirstDelim(char const *p, char const *end, _SseDelims const &d)
+{
+    for (; p + 16 <= end; p += 16) {
+        __m128i chunk = _mm_loadu_si128(
+            reinterpret_cast<__m128i const *>(p));
+        __m128i m = _mm_cmpeq_epi8(chunk, d.vec[0]);
+        for (int i = 1; i < d.n; ++i)
+            m = _mm_or_si128(m, _mm_cmpeq_epi8(chunk, d.vec[i]));
+        if (int mask = _mm_movemask_epi8(m))
+            return p + __builtin_ctz(mask);
+    }
+    for (; p != end; ++p) {
+        for (int i = 0; i != d.n; ++i)
+            if (*p == d.chars[i])
+                return p;
+    }
+    return end;
+}
+
+// Return a pointer to the first non-delimiter character in [p, end), or end.
+static inline char const *
+_FindFirstNonDelim(char const *p, char const *end, _SseDelims const &d)
+{
+    for (; p + 16 <= end; p += 16) {
+        __m128i chunk = _mm_loadu_si128(
+            reinterpret_cast<__m128i const *>(p));
+        __m128i m = _mm_cmpeq_epi8(chunk, d.vec[0]);
+        for (int i = 1; i < d.n; ++i)
+            m = _mm_or_si128(m, _mm_cmpeq_epi8(chunk, d.vec[i]));
+        int mask = _mm_movemask_epi8(m);
+        if (mask != 0xFFFF)
+            return p + __builtin_ctz(~mask & 0xFFFF);
+    }
+    for (; p != end; ++p) {
+        bool isDelim = false;
+        for (int i = 0; i != d.n; ++i)
+            isDelim |= (*p == d.chars[i]);
+        if (!isDelim)
+            return p;
+    }
+    return end;
+}
+
+#endif // ARCH_CPU_INTEL && __SSE2__
+
 void _TokenizeToSegments(string const &src, char const *delimiters,
                          vector<pair<char const *, char const *> > &segments)
 {
+    // A small amount of reservation seems to help.
+    segments.reserve(8);
+
+#if defined(ARCH_CPU_INTEL) && defined(__SSE2__)
+    // Vectorize scanning for the common case of a small delimiter set (e.g.
+    // whitespace) on a reasonably sized input.
+    size_t const numDelims = strlen(delimiters);
+    if (numDelims && numDelims <= 4 && src.size() >= 16) {
+        _SseDelims const d(delimiters, static_cast<int>(numDelims));
+        char const *end = src.data() + src.size();
+        char const *c = src.data();
+        while (c != end) {
+            c = _FindFirstNonDelim(c, end, d);
+            if (c == end)
+                break;
+            char const *tokenEnd = _FindFirstDelim(c + 1, end, d);
+            segments.push_back(make_pair(c, tokenEnd));
+            c = tokenEnd;
+        }
+        return;
+    }
+#endif
+
     // Delimiter checking LUT.
     // NOTE: For some reason, calling memset here is faster than doing the
     // aggregate initialization.  Beats me.  Ask gcc.  (10/07)
@@ -411,9 +503,6 @@ void _TokenizeToSegments(string const &src, char const *delimiters,
     // \a src's data, the first indicating the start of a token, the second
     // pointing one past the last character of a token (like a pair of
     // iterators).
-    
-    // A small amount of reservation seems to help.
-    segments.reserve(8);
     char const *end = src.data() + src.size();
     for (char const *c = src.data(); c < end; ++c) {
         // skip delimiters
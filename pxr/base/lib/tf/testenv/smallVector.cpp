@@ -0,0 +1,157 @@
+//
+// Copyright 2017 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/base/tf/smallVector.h"
+#include "pxr/base/tf/regTest.h"
+#include "pxr/base/tf/stringUtils.h"
+
+#include <algorithm>
+#include <string>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+static void
+TestBasics()
+{
+    TfSmallVector<int, 4> v;
+    TF_AXIOM(v.empty());
+    TF_AXIOM(v.capacity() == 4);
+    TF_AXIOM(v.InlineCapacity() == 4);
+
+    // Fill the inline storage; no growth should occur.
+    for (int i = 0; i < 4; ++i) {
+        v.push_back(i);
+    }
+    TF_AXIOM(v.size() == 4);
+    TF_AXIOM(v.capacity() == 4);
+
+    // Grow past the inline storage.
+    v.push_back(4);
+    TF_AXIOM(v.size() == 5);
+    TF_AXIOM(v.capacity() > 4);
+    for (int i = 0; i < 5; ++i) {
+        TF_AXIOM(v[i] == i);
+    }
+
+    v.pop_back();
+    TF_AXIOM(v.size() == 4);
+    TF_AXIOM(v.back() == 3);
+    TF_AXIOM(v.front() == 0);
+
+    v.clear();
+    TF_AXIOM(v.empty());
+}
+
+static void
+TestNonPodElements()
+{
+    // Exercise growth, insertion and erasure with an element type that
+    // tracks its copies and moves properly.
+    TfSmallVector<std::string, 2> v;
+    v.push_back("a");
+    v.push_back("b");
+    v.push_back("c");
+    TF_AXIOM(v.size() == 3);
+    TF_AXIOM(v.capacity() > 2);
+
+    v.insert(v.begin() + 1, "x");
+    TF_AXIOM(v.size() == 4);
+    TF_AXIOM(v[0] == "a" && v[1] == "x" && v[2] == "b" && v[3] == "c");
+
+    v.erase(v.begin(), v.begin() + 2);
+    TF_AXIOM(v.size() == 2);
+    TF_AXIOM(v[0] == "b" && v[1] == "c");
+
+    v.emplace_back(3, '!');
+    TF_AXIOM(v.back() == "!!!");
+}
+
+static void
+TestCopyAndMove()
+{
+    TfSmallVector<std::string, 2> v;
+    for (size_t i = 0; i < 10; ++i) {
+        v.push_back(TfStringify(i));
+    }
+
+    TfSmallVector<std::string, 2> copy(v);
+    TF_AXIOM(copy == v);
+
+    // Heap storage is stolen by move construction.
+    TfSmallVector<std::string, 2> moved(std::move(copy));
+    TF_AXIOM(moved == v);
+    TF_AXIOM(copy.empty());
+
+    // Inline storage is moved element by element.
+    TfSmallVector<std::string, 8> small;
+    small.push_back("only");
+    TfSmallVector<std::string, 8> movedSmall(std::move(small));
+    TF_AXIOM(movedSmall.size() == 1 && movedSmall[0] == "only");
+    TF_AXIOM(small.empty());
+
+    moved = v;
+    TF_AXIOM(moved == v);
+    TF_AXIOM(moved != TfSmallVector<std::string, 2>());
+
+    TfSmallVector<std::string, 2> a(1, "a"), b(3, "b");
+    a.swap(b);
+    TF_AXIOM(a.size() == 3 && a[0] == "b");
+    TF_AXIOM(b.size() == 1 && b[0] == "a");
+}
+
+static void
+TestAlgorithms()
+{
+    TfSmallVector<int, 4> v{5, 3, 1, 4, 2};
+    std::sort(v.begin(), v.end());
+    TF_AXIOM((v == TfSmallVector<int, 4>{1, 2, 3, 4, 5}));
+
+    TfSmallVector<int, 4> r(v.rbegin(), v.rend());
+    TF_AXIOM((r == TfSmallVector<int, 4>{5, 4, 3, 2, 1}));
+
+    r.insert(r.end(), v.begin(), v.end());
+    TF_AXIOM(r.size() == 10);
+
+    r.resize(3);
+    TF_AXIOM((r == TfSmallVector<int, 4>{5, 4, 3}));
+    r.resize(5, 9);
+    TF_AXIOM((r == TfSmallVector<int, 4>{5, 4, 3, 9, 9}));
+
+    r.reserve(100);
+    TF_AXIOM(r.capacity() >= 100);
+    TF_AXIOM((r == TfSmallVector<int, 4>{5, 4, 3, 9, 9}));
+}
+
+static bool
+Test_TfSmallVector()
+{
+    TestBasics();
+    TestNonPodElements();
+    TestCopyAndMove();
+    TestAlgorithms();
+    return true;
+}
+
+TF_ADD_REGTEST(TfSmallVector);
@@ -35,6 +35,7 @@
 #include "pxr/base/tf/type.h"
 
 #include "pxr/base/arch/align.h"
+#include "pxr/base/arch/hash.h"
 
 #include <boost/multi_index_container.hpp>
 #include <boost/multi_index/hashed_index.hpp>
@@ -68,18 +69,17 @@ struct Tf_TokenRegistry
         }
     };
 
-    template <int Mul>
+    template <int Seed>
     struct _Hash {
         inline size_t operator()(TfToken::_Rep const &rep) const {
             return (*this)(rep._cstr);
         }
         inline size_t operator()(char const *s) const {
-            // Matches STL original implementation for now.  Switch to something
-            // better?
-            unsigned int h = 0;
-            for (; *s; ++s)
-                h = Mul * h + *s;
-            return h;
+            // ArchHash (SpookyHash) consumes the string a word at a time,
+            // which beats the old byte-at-a-time multiplicative hash on the
+            // long property paths and type names we commonly intern.  The
+            // seed keeps set selection and in-set bucketing decorrelated.
+            return ArchHash(s, strlen(s), Seed);
         }
     };
 
@@ -104,9 +104,61 @@ struct Tf_TokenRegistry
     // TfHashSet for now.
     typedef TfHashSet<TfToken::_Rep, _InnerHash, _Eq> _RepSet;
 
+    // Lock-free table of immortal reps.  Immortal reps are never destroyed,
+    // so once published here they may be returned without taking a set lock
+    // or touching a reference count.  Repeated interning of already-immortal
+    // strings (schema type names, property names, metadata fields) is by far
+    // the common case during stage composition, and this keeps those lookups
+    // scalable across threads.  The table is probed before falling back to
+    // the locked sets; if it fills up we simply stop publishing, and the
+    // locked path remains fully correct.
+    struct _ImmortalRepTable {
+        static const size_t _Capacity = 1 << 16;
+        static const size_t _CapacityMask = _Capacity - 1;
+        // Bound probe sequences so a nearly-full table degrades to the
+        // locked path rather than scanning the whole table.
+        static const size_t _MaxProbes = 64;
+
+        _ImmortalRepTable() {
+            for (size_t i = 0; i != _Capacity; ++i)
+                _slots[i].store(nullptr, std::memory_order_relaxed);
+        }
+
+        inline _RepPtr Find(char const *s, size_t hash) const {
+            for (size_t i = 0; i != _MaxProbes; ++i) {
+                _RepPtr rep = _slots[(hash + i) & _CapacityMask].
+                    load(std::memory_order_acquire);
+                if (!rep)
+                    return nullptr;
+                if (!strcmp(rep->_cstr, s))
+                    return rep;
+            }
+            return nullptr;
+        }
+
+        inline void Insert(_RepPtr rep, size_t hash) {
+            for (size_t i = 0; i != _MaxProbes; ++i) {
+                std::atomic<_RepPtr> &slot =
+                    _slots[(hash + i) & _CapacityMask];
+                _RepPtr expected = nullptr;
+                if (slot.compare_exchange_strong(
+                        expected, rep, std::memory_order_release)) {
+                    return;
+                }
+                if (expected == rep || !strcmp(expected->_cstr, rep->_cstr))
+                    return;
+            }
+            // No free slot within the probe bound -- this rep is simply
+            // never published and lookups for it take the locked path.
+        }
+
+        std::atomic<_RepPtr> _slots[_Capacity];
+    };
+
     // Data members.
     _RepSet _sets[_NumSets];
     mutable _CacheLinePadded<tbb::spin_mutex> _locks[_NumSets];
+    _ImmortalRepTable _immortalReps;
 
     static Tf_TokenRegistry& _GetInstance() {
         return TfSingleton<Tf_TokenRegistry>::GetInstance();
@@ -202,12 +254,20 @@ private:
         if (_IsEmpty(s))
             return _RepPtrAndBits();
 
-        size_t setNum = _GetSetNum(_CStr(s));
+        char const *cstr = _CStr(s);
+        size_t innerHash = _InnerHash()(cstr);
+
+        // Fast path: immortal reps can be returned without locking or
+        // reference counting, regardless of makeImmortal.
+        if (_RepPtr rep = _immortalReps.Find(cstr, innerHash))
+            return _RepPtrAndBits(rep, /*isCounted=*/false);
+
+        size_t setNum = _GetSetNum(cstr);
 
         tbb::spin_mutex::scoped_lock lock(_locks[setNum].val);
 
         // Insert or lookup an existing.
-        _RepSet::iterator iter = _sets[setNum].find(_LookupRep(_CStr(s)));
+        _RepSet::iterator iter = _sets[setNum].find(_LookupRep(cstr));
         if (iter != _sets[setNum].end()) {
             _RepPtr rep = &(*iter);
             bool isCounted = rep->_isCounted;
@@ -217,6 +277,8 @@ private:
                 else
                     ++rep->_refCount;
             }
+            if (!isCounted)
+                _immortalReps.Insert(rep, innerHash);
             return _RepPtrAndBits(rep, isCounted);
         } else {
             // No entry present, add a new entry.
@@ -226,6 +288,8 @@ private:
             rep->_setNum = setNum;
             if (!makeImmortal)
                 rep->_refCount = 1;
+            else
+                _immortalReps.Insert(rep, innerHash);
             return _RepPtrAndBits(rep, !makeImmortal);
         }
     }
@@ -234,13 +298,19 @@ private:
     _RepPtrAndBits _FindPtrImpl(Str s) const {
         if (_IsEmpty(s))
             return _RepPtrAndBits();
-        
-        size_t setNum = _GetSetNum(_CStr(s));
+
+        char const *cstr = _CStr(s);
+
+        // Fast path: immortal reps can be returned without locking.
+        if (_RepPtr rep = _immortalReps.Find(cstr, _InnerHash()(cstr)))
+            return _RepPtrAndBits(rep, /*isCounted=*/false);
+
+        size_t setNum = _GetSetNum(cstr);
 
         tbb::spin_mutex::scoped_lock lock(_locks[setNum].val);
 
         _RepSet::const_iterator iter =
-            _sets[setNum].find(_LookupRep(_CStr(s)));
+            _sets[setNum].find(_LookupRep(cstr));
         if (iter == _sets[setNum].end())
             return _RepPtrAndBits();
 
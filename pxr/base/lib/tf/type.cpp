@@ -327,6 +327,48 @@ public:
         return info ? *info : nullptr;
     }
 
+    // Lock-free cache of typeid -> _TypeInfo lookups, keyed by type_info
+    // address.  Types are never unregistered, so a published entry remains
+    // valid for the life of the process, and readers need no locking.
+    // Lookups that miss (including the rare case of a type_info object with
+    // a different address for the same type, e.g. across dlopen'd modules)
+    // fall back to the locked registry and publish their result.  If the
+    // table fills, new entries simply stop being published.
+    TfType::_TypeInfo *
+    FindByTypeidCached(const std::type_info &typeInfo) const {
+        size_t h = _HashTypeidAddress(&typeInfo);
+        for (size_t i = 0; i != _CacheMaxProbes; ++i) {
+            _CacheEntry const &e = _typeidCache[(h + i) & _CacheMask];
+            std::type_info const *key = e.key.load(std::memory_order_relaxed);
+            if (!key)
+                return nullptr;
+            if (key == &typeInfo) {
+                // May be null if the entry's publisher has claimed the slot
+                // but not yet stored the value; callers treat that as a
+                // cache miss.
+                return e.value.load(std::memory_order_acquire);
+            }
+        }
+        return nullptr;
+    }
+
+    void
+    PublishTypeidCacheEntry(const std::type_info &typeInfo,
+                            TfType::_TypeInfo *info) const {
+        size_t h = _HashTypeidAddress(&typeInfo);
+        for (size_t i = 0; i != _CacheMaxProbes; ++i) {
+            _CacheEntry &e = _typeidCache[(h + i) & _CacheMask];
+            std::type_info const *expected = nullptr;
+            if (e.key.compare_exchange_strong(
+                    expected, &typeInfo, std::memory_order_relaxed)) {
+                e.value.store(info, std::memory_order_release);
+                return;
+            }
+            if (expected == &typeInfo)
+                return;
+        }
+    }
+
 #ifdef PXR_PYTHON_SUPPORT_ENABLED
     TfType::_TypeInfo *
     FindByPythonClass(const boost::python::object &classObj) const {
@@ -340,6 +382,23 @@ public:
 private:
     Tf_TypeRegistry();
 
+    static inline size_t _HashTypeidAddress(std::type_info const *ti) {
+        // type_info objects are aligned and spread out in static data;
+        // mix the address bits so nearby objects land in distinct slots.
+        return (reinterpret_cast<uintptr_t>(ti) >> 4) * 2654435761u;
+    }
+
+    static const size_t _CacheCapacity = 1 << 12;
+    static const size_t _CacheMask = _CacheCapacity - 1;
+    static const size_t _CacheMaxProbes = 16;
+
+    struct _CacheEntry {
+        _CacheEntry() : key(nullptr), value(nullptr) {}
+        std::atomic<std::type_info const *> key;
+        std::atomic<TfType::_TypeInfo *> value;
+    };
+    mutable _CacheEntry _typeidCache[_CacheCapacity];
+
     mutable RWMutex _mutex;
 
     // The thread that is currently performing initialization.  This is set to a
@@ -519,12 +578,26 @@ TfType::_FindByTypeid(const std::type_info &typeInfo)
     };
 
     auto &r = Tf_TypeRegistry::GetInstance();
+
+    // Try the lock-free cache first; this is the hot path for repeated
+    // lookups of already-defined types.
+    if (TfType::_TypeInfo *info = r.FindByTypeidCached(typeInfo)) {
+        return info->canonicalTfType;
+    }
+
     r.WaitForInitializingThread();
 
-    ScopedLock readLock(r.GetMutex(), /*write=*/false);
-    TfType::_TypeInfo *info = r.FindByTypeid(typeInfo, WriteUpgrader(readLock));
+    TfType::_TypeInfo *info;
+    {
+        ScopedLock readLock(r.GetMutex(), /*write=*/false);
+        info = r.FindByTypeid(typeInfo, WriteUpgrader(readLock));
+    }
 
-    return info ? info->canonicalTfType : GetUnknownType();
+    if (info) {
+        r.PublishTypeidCacheEntry(typeInfo, info);
+        return info->canonicalTfType;
+    }
+    return GetUnknownType();
 }
 
 #ifdef PXR_PYTHON_SUPPORT_ENABLED
@@ -0,0 +1,327 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/base/tracelite/collector.h"
+#include "pxr/base/tracelite/trace.h"
+
+#include "pxr/base/arch/timing.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+// The site object the initialize callback stores into each trace site's
+// static atomic; it owns the site's name for the lifetime of the program.
+class TraceScopeHolder {
+public:
+    explicit TraceScopeHolder(std::string const &name) : _name(name) { }
+
+    std::string const &GetName() const { return _name; }
+
+private:
+    std::string _name;
+};
+
+namespace {
+
+enum _EventType {
+    _BeginEvent,
+    _EndEvent,
+    _CounterEvent
+};
+
+struct _Event {
+    const void *key;        // TraceScopeHolder* or counter name
+    uint64_t ticks;
+    double value;
+    uint32_t type;
+};
+
+// A fixed-capacity ring of events written by exactly one thread.  The
+// capacity is a power of two so the cursor wraps with a mask, and the
+// cursor itself just counts forever; export rematerializes the window of
+// the most recent events from it.
+class _EventBuffer {
+public:
+    _EventBuffer(size_t capacity, unsigned threadIndex)
+        : _events(capacity)
+        , _mask(capacity - 1)
+        , _head(0)
+        , _threadIndex(threadIndex)
+    {
+    }
+
+    inline void Record(_EventType type, const void *key, double value) {
+        _Event &e = _events[_head & _mask];
+        e.key = key;
+        e.ticks = ArchGetTickTime();
+        e.value = value;
+        e.type = type;
+        ++_head;
+    }
+
+    void Reset() { _head = 0; }
+
+    size_t GetCapacity() const { return _events.size(); }
+    uint64_t GetHead() const { return _head; }
+    unsigned GetThreadIndex() const { return _threadIndex; }
+    _Event const &GetEvent(uint64_t i) const { return _events[i & _mask]; }
+
+private:
+    std::vector<_Event> _events;
+    uint64_t _mask;
+    uint64_t _head;
+    unsigned _threadIndex;
+};
+
+// Shared collector state.  Buffers are created on each thread's first
+// event, registered here, and kept for the life of the program so export
+// can read events from threads that have since exited.
+struct _Collector {
+    _Collector() : capturing(false), nextThreadIndex(0), capacity(0) { }
+
+    std::mutex registryMutex;
+    std::vector<std::unique_ptr<_EventBuffer>> buffers;
+    std::atomic<bool> capturing;
+    unsigned nextThreadIndex;
+    size_t capacity;
+};
+
+} // anonymous namespace
+
+static _Collector &
+_GetCollector()
+{
+    static _Collector collector;
+    return collector;
+}
+
+static size_t
+_GetConfiguredCapacity()
+{
+    // Default to 1M events per thread; round any override up to a power
+    // of two, with a floor that keeps the mask arithmetic sensible.
+    size_t capacity = 1024 * 1024;
+    if (const char *env = std::getenv("TRACELITE_BUFFER_SIZE")) {
+        const long requested = std::atol(env);
+        if (requested > 0) {
+            capacity = 1024;
+            while (capacity < static_cast<size_t>(requested)) {
+                capacity *= 2;
+            }
+        }
+    }
+    return capacity;
+}
+
+static _EventBuffer *
+_GetThreadBuffer()
+{
+    static thread_local _EventBuffer *buffer = nullptr;
+    if (!buffer) {
+        _Collector &collector = _GetCollector();
+        std::lock_guard<std::mutex> lock(collector.registryMutex);
+        collector.buffers.emplace_back(
+            new _EventBuffer(collector.capacity,
+                             collector.nextThreadIndex++));
+        buffer = collector.buffers.back().get();
+    }
+    return buffer;
+}
+
+// Backend callbacks installed into the slots declared in trace.h.
+
+static void
+_InitializeSite(std::atomic<TraceScopeHolder*> *siteData,
+                const std::string *key, char const *key1, char const *key2)
+{
+    TraceScopeHolder *holder =
+        new TraceScopeHolder(key ? *key : std::string(key1 ? key1 : ""));
+    TraceScopeHolder *expected = nullptr;
+    if (!siteData->compare_exchange_strong(expected, holder)) {
+        // Another thread initialized this site first.
+        delete holder;
+    }
+}
+
+static void
+_BeginScope(void *stackData, void *siteData)
+{
+    _GetThreadBuffer()->Record(_BeginEvent, siteData, 0.0);
+}
+
+static void
+_EndScope(void *stackData)
+{
+    // Scopes close in LIFO order per thread, so the end event needs no
+    // site; the viewer pairs it with the innermost open begin.
+    _GetThreadBuffer()->Record(_EndEvent, nullptr, 0.0);
+}
+
+void
+TraceliteStartCapture()
+{
+    _Collector &collector = _GetCollector();
+
+    static bool installed = false;
+    if (!installed) {
+        collector.capacity = _GetConfiguredCapacity();
+        TraceliteSetFunctions(_InitializeSite, _BeginScope, _EndScope);
+        installed = true;
+    }
+
+    if (TraceliteEnable(true) == 1) {
+        // First (non-nested) start: drop any previous capture.
+        std::lock_guard<std::mutex> lock(collector.registryMutex);
+        for (const auto &buffer : collector.buffers) {
+            buffer->Reset();
+        }
+    }
+    collector.capturing.store(true, std::memory_order_release);
+}
+
+void
+TraceliteStopCapture()
+{
+    if (TraceliteEnable(false) <= 0) {
+        _GetCollector().capturing.store(false, std::memory_order_release);
+    }
+}
+
+bool
+TraceliteIsCapturing()
+{
+    return _GetCollector().capturing.load(std::memory_order_acquire);
+}
+
+void
+TraceliteRecordCounter(char const *name, double value)
+{
+    if (!TraceliteIsCapturing()) {
+        return;
+    }
+    _GetThreadBuffer()->Record(_CounterEvent, name, value);
+}
+
+static void
+_WriteJsonString(std::ostream &out, std::string const &s)
+{
+    out << '"';
+    for (char c : s) {
+        switch (c) {
+        case '"':  out << "\\\""; break;
+        case '\\': out << "\\\\"; break;
+        case '\n': out << "\\n"; break;
+        case '\t': out << "\\t"; break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                char buf[8];
+                snprintf(buf, sizeof(buf), "\\u%04x", c);
+                out << buf;
+            } else {
+                out << c;
+            }
+        }
+    }
+    out << '"';
+}
+
+void
+TraceliteWriteChromeTrace(std::ostream &out)
+{
+    _Collector &collector = _GetCollector();
+    std::lock_guard<std::mutex> lock(collector.registryMutex);
+
+    const double nsPerTick = ArchGetNanosecondsPerTick();
+
+    out << "{\"traceEvents\":[";
+    bool first = true;
+    for (const auto &buffer : collector.buffers) {
+        const uint64_t head = buffer->GetHead();
+        const uint64_t capacity = buffer->GetCapacity();
+        uint64_t i = head > capacity ? head - capacity : 0;
+
+        // A wrapped buffer may begin with end events whose begins were
+        // overwritten; skip ends until the first surviving begin opens a
+        // scope, so the output stays well nested.
+        uint64_t depth = 0;
+        for (; i != head; ++i) {
+            _Event const &e = buffer->GetEvent(i);
+            if (e.type == _EndEvent && depth == 0) {
+                continue;
+            }
+
+            if (!first) {
+                out << ",";
+            }
+            first = false;
+
+            // Timestamps are microseconds; emit nanosecond precision.
+            const double ts = e.ticks * nsPerTick / 1000.0;
+            char tsBuf[32];
+            snprintf(tsBuf, sizeof(tsBuf), "%.3f", ts);
+
+            out << "{\"ph\":";
+            if (e.type == _BeginEvent) {
+                ++depth;
+                out << "\"B\",\"name\":";
+                _WriteJsonString(out,
+                    static_cast<TraceScopeHolder const *>(e.key)->GetName());
+            } else if (e.type == _EndEvent) {
+                --depth;
+                out << "\"E\"";
+            } else {
+                out << "\"C\",\"name\":";
+                _WriteJsonString(out,
+                    std::string(static_cast<char const *>(e.key)));
+                out << ",\"args\":{\"value\":" << e.value << "}";
+            }
+            out << ",\"ts\":" << tsBuf
+                << ",\"pid\":0,\"tid\":" << buffer->GetThreadIndex()
+                << "}";
+        }
+    }
+    out << "]}\n";
+}
+
+bool
+TraceliteWriteChromeTrace(std::string const &filename)
+{
+    std::ofstream out(filename.c_str());
+    if (!out) {
+        return false;
+    }
+    TraceliteWriteChromeTrace(out);
+    return static_cast<bool>(out);
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,99 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef TRACELITE_COLLECTOR_H
+#define TRACELITE_COLLECTOR_H
+
+/// \file tracelite/collector.h
+/// Event-collecting backend for the tracelite facility.
+///
+/// The collector plugs into the callback slots declared in trace.h and
+/// records the begin/end events produced by TRACE_FUNCTION / TRACE_SCOPE
+/// into per-thread ring buffers of fixed capacity.  Each thread writes only
+/// its own buffer, so recording takes no lock: an event is a site pointer
+/// and a tick-resolution timestamp appended at the thread's write cursor.
+/// When a buffer fills it wraps and the oldest events are dropped.
+///
+/// Typical use is to bracket the region of interest and write the capture
+/// out in the trace-event format that chrome://tracing and compatible
+/// viewers read:
+///
+/// \code
+/// TraceliteStartCapture();
+/// // ...code containing TRACE_FUNCTION / TRACE_SCOPE...
+/// TraceliteStopCapture();
+/// TraceliteWriteChromeTrace("stageOpen.trace.json");
+/// \endcode
+///
+/// Capture control is not thread-safe; call the start/stop/write functions
+/// from a single thread (normally the main thread), and stop the capture
+/// before writing it out.  When no capture is active the scope macros cost
+/// a single predicted branch, as before.
+///
+/// The per-thread buffer capacity defaults to 1048576 events and can be
+/// overridden with the TRACELITE_BUFFER_SIZE environment variable (read
+/// when the first capture starts).
+
+#include "pxr/pxr.h"
+#include "pxr/base/tracelite/api.h"
+
+#include <iosfwd>
+#include <string>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// Install the collector as the tracelite backend (first time only) and
+/// begin recording scope events.  Calls may nest; each must be matched by
+/// a TraceliteStopCapture().
+TRACELITE_API
+void TraceliteStartCapture();
+
+/// Stop recording scope events.  Previously recorded events remain
+/// available for export until the next capture starts.
+TRACELITE_API
+void TraceliteStopCapture();
+
+/// Return true if a capture is currently recording.
+TRACELITE_API
+bool TraceliteIsCapturing();
+
+/// Record a counter sample on the calling thread's buffer.  \p name must
+/// outlive the capture (normally a string literal).  Does nothing when no
+/// capture is active; the inactive check is a single atomic load.
+TRACELITE_API
+void TraceliteRecordCounter(char const *name, double value);
+
+/// Write the most recent capture to \p out in the chrome://tracing JSON
+/// event format.
+TRACELITE_API
+void TraceliteWriteChromeTrace(std::ostream &out);
+
+/// Write the most recent capture to the file \p filename in the
+/// chrome://tracing JSON event format.  Returns false if the file could
+/// not be written.
+TRACELITE_API
+bool TraceliteWriteChromeTrace(std::string const &filename);
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // TRACELITE_COLLECTOR_H
@@ -0,0 +1,113 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/base/tracelite/counter.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+unsigned
+Tracelite_GetThreadSlotIndex()
+{
+    static std::atomic<unsigned> nextIndex(0);
+    static thread_local unsigned index = nextIndex++;
+    return index;
+}
+
+namespace {
+
+// The registry interns counters by name; counters are never destroyed so
+// handles stay valid in caller statics for the life of the program.
+struct _CounterRegistry {
+    std::mutex mutex;
+    std::map<std::string, std::unique_ptr<TraceliteCounter>> counters;
+};
+
+} // anonymous namespace
+
+static _CounterRegistry &
+_GetRegistry()
+{
+    static _CounterRegistry *registry = new _CounterRegistry;
+    return *registry;
+}
+
+TraceliteCounter::TraceliteCounter(std::string const &name)
+    : _name(name)
+    , _slots(_NumSlots)
+{
+    for (_Slot &slot : _slots) {
+        slot.value.store(0.0, std::memory_order_relaxed);
+    }
+}
+
+void
+TraceliteCounter::Set(double value)
+{
+    _slots[0].value.store(value, std::memory_order_relaxed);
+    for (unsigned i = 1; i != _NumSlots; ++i) {
+        _slots[i].value.store(0.0, std::memory_order_relaxed);
+    }
+}
+
+double
+TraceliteCounter::GetValue() const
+{
+    double sum = 0.0;
+    for (_Slot const &slot : _slots) {
+        sum += slot.value.load(std::memory_order_relaxed);
+    }
+    return sum;
+}
+
+TraceliteCounter *
+TraceliteRegisterCounter(std::string const &name)
+{
+    _CounterRegistry &registry = _GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    std::unique_ptr<TraceliteCounter> &counter = registry.counters[name];
+    if (!counter) {
+        counter.reset(new TraceliteCounter(name));
+    }
+    return counter.get();
+}
+
+std::vector<TraceliteCounter *>
+TraceliteGetCounters()
+{
+    _CounterRegistry &registry = _GetRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    std::vector<TraceliteCounter *> result;
+    result.reserve(registry.counters.size());
+    for (const auto &entry : registry.counters) {
+        result.push_back(entry.second.get());
+    }
+    return result;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
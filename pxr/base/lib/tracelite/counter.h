@@ -0,0 +1,133 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef TRACELITE_COUNTER_H
+#define TRACELITE_COUNTER_H
+
+/// \file tracelite/counter.h
+/// Always-on lightweight performance counters.
+///
+/// Counters are registered once by name and then updated through the
+/// returned handle.  Each counter spreads its value over a small array of
+/// cache-line-padded atomic slots indexed by thread, so concurrent updates
+/// from different threads do not contend on a line and never take a lock;
+/// GetValue() aggregates the slots on read.  Updates are cheap enough to
+/// leave compiled into release builds.
+///
+/// \code
+/// static TraceliteCounter *drawCalls =
+///     TraceliteRegisterCounter("draw calls");
+/// drawCalls->Increment();
+/// \endcode
+
+#include "pxr/pxr.h"
+#include "pxr/base/tracelite/api.h"
+#include "pxr/base/arch/align.h"
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// Return a small dense index for the calling thread, used to pick a
+/// counter slot.  Distinct live threads get distinct indices modulo the
+/// slot count.
+TRACELITE_API
+unsigned Tracelite_GetThreadSlotIndex();
+
+/// \class TraceliteCounter
+///
+/// A named double-valued counter that can be updated concurrently without
+/// locking.  Instances are created by TraceliteRegisterCounter() and live
+/// for the rest of the program; handles are therefore safe to cache in
+/// statics.
+///
+class TraceliteCounter {
+    // One cache line per slot keeps threads that hash to different slots
+    // from false sharing.
+    struct _Slot {
+        std::atomic<double> value;
+        char _pad[ARCH_CACHE_LINE_SIZE - sizeof(std::atomic<double>)];
+    };
+
+    // Must be a power of two; 64 slots bounds the collision rate at a cost
+    // of 4KB per counter.
+    static const unsigned _NumSlots = 64;
+
+public:
+    /// Add \p amount to the counter.  Lock-free; a CAS loop arbitrates the
+    /// rare case of two threads sharing a slot.
+    inline void Add(double amount) {
+        std::atomic<double> &slot =
+            _slots[Tracelite_GetThreadSlotIndex() & (_NumSlots - 1)].value;
+        double current = slot.load(std::memory_order_relaxed);
+        while (!slot.compare_exchange_weak(current, current + amount,
+                                           std::memory_order_relaxed)) {
+        }
+    }
+
+    /// Add 1 to the counter.
+    inline void Increment() { Add(1.0); }
+
+    /// Subtract 1 from the counter.
+    inline void Decrement() { Add(-1.0); }
+
+    /// Subtract \p amount from the counter.
+    inline void Subtract(double amount) { Add(-amount); }
+
+    /// Set the counter to \p value.  Unlike Add(), this is not atomic with
+    /// respect to concurrent updates: an Add() racing with Set() may be
+    /// lost.  Intended for counters a single thread publishes.
+    TRACELITE_API
+    void Set(double value);
+
+    /// Return the aggregated value of the counter.
+    TRACELITE_API
+    double GetValue() const;
+
+    /// Return the counter's name.
+    std::string const &GetName() const { return _name; }
+
+private:
+    friend TraceliteCounter *TraceliteRegisterCounter(std::string const &);
+
+    explicit TraceliteCounter(std::string const &name);
+
+    std::string _name;
+    std::vector<_Slot> _slots;
+};
+
+/// Return the counter registered under \p name, creating it if necessary.
+/// The same name always yields the same handle; counters are never
+/// destroyed.
+TRACELITE_API
+TraceliteCounter *TraceliteRegisterCounter(std::string const &name);
+
+/// Return all registered counters.
+TRACELITE_API
+std::vector<TraceliteCounter *> TraceliteGetCounters();
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // TRACELITE_COUNTER_H
@@ -40,7 +40,7 @@
 #include "pxr/base/tf/mallocTag.h"
 #include "pxr/base/tf/stringUtils.h"
 
-#include <boost/container/vector.hpp>
+#include <boost/container/small_vector.hpp>
 #include <boost/operators.hpp>
 #include <boost/preprocessor.hpp>
 #include <boost/smart_ptr/intrusive_ptr.hpp>
@@ -50,7 +50,9 @@
 #include <algorithm>
 #include <atomic>
 #include <cstddef>
+#include <functional>
 #include <iostream>
+#include <memory>
 #include <vector>
 
 #include <boost/functional/hash.hpp>
@@ -112,7 +114,17 @@ PXR_NAMESPACE_OPEN_SCOPE
 template<typename ELEM>
 class VtArray {
 
-    typedef boost::container::vector<ELEM> _VecType;
+    // Elements are stored inline in the shared _Data when the whole array
+    // fits in a small buffer, so the 1-4 element arrays that dominate
+    // attribute metadata cost a single allocation instead of two.  The
+    // inline capacity is capped by byte size rather than element count so
+    // large element types don't bloat the header of every big array.
+    static const size_t _SmallBufferBytes = 32;
+    typedef boost::container::small_vector<
+        ELEM,
+        (sizeof(ELEM) <= _SmallBufferBytes
+         ? _SmallBufferBytes / sizeof(ELEM)
+         : 1)> _VecType;
 
   public:
 
@@ -171,6 +183,39 @@ class VtArray {
         resize(n);
     }
 
+    /// Type of the function invoked to release foreign data wrapped by
+    /// FromForeignData() when the last array referring to it is destroyed.
+    typedef std::function<void (ElementType const *)> ForeignDataDeleter;
+
+    /// Create an array of \p size elements that refers to \p foreignData
+    /// without copying it.  The returned array and any copies of it share
+    /// the buffer; \p deleter (if supplied) is invoked with \p foreignData
+    /// when the last of them is destroyed or detached.  The buffer must
+    /// remain valid and unchanged until then.  Invoking any non-const
+    /// member function detaches from the foreign buffer by copying its
+    /// contents into owned storage, exactly like the usual copy-on-write
+    /// detachment between arrays.  This supports handing large buffers
+    /// (memory-mapped file regions, external caches) to consumers with
+    /// zero copies.
+    static VtArray FromForeignData(ElementType const *foreignData,
+                                   size_t size,
+                                   ForeignDataDeleter deleter =
+                                       ForeignDataDeleter()) {
+        VtArray result;
+        if (foreignData) {
+            result._data.reset(new _Data);
+            result._data->foreign.reset(
+                new _ForeignSource(foreignData, size, std::move(deleter)));
+        }
+        return result;
+    }
+
+    /// Return true if this array refers to foreign data installed by
+    /// FromForeignData() and has not yet detached from it.
+    bool IsHoldingForeignData() const {
+        return _data && _data->IsForeign();
+    }
+
     /// \addtogroup STL_API
     /// @{
     
@@ -223,7 +268,7 @@ class VtArray {
     /// Return a pointer to this array's data.
     pointer data() { _Detach(); return _data ? _data->vec.data() : NULL; }
     /// Return a const pointer to this array's data.
-    const_pointer data() const { return _data ? _data->vec.data() : NULL; }
+    const_pointer data() const { return _data ? _data->GetPointer() : NULL; }
     /// Return a const pointer to the data held by this array.
     const_pointer cdata() const { return data(); }
 
@@ -251,7 +296,7 @@ class VtArray {
     }
 
     /// Return the total number of elements in this array.
-    size_t size() const { return _data ? _data->vec.size() : 0; }
+    size_t size() const { return _data ? _data->GetSize() : 0; }
 
     /// Equivalent to size() == 0.
     bool empty() const { return size() == 0; }
@@ -299,6 +344,8 @@ class VtArray {
 
         if (!_data)
             _data.reset(new _Data);
+        else if (_data->IsForeign())
+            _Detach();
 
         if (_data->IsUnique()) {
             _data->vec.resize(num);
@@ -384,11 +431,11 @@ ARCH_PRAGMA_PUSH
 ARCH_PRAGMA_FORCING_TO_BOOL
 ARCH_PRAGMA_UNSAFE_USE_OF_BOOL
 ARCH_PRAGMA_UNARY_MINUS_ON_UNSIGNED
-    VTOPERATOR_CPPARRAY(+)
-    VTOPERATOR_CPPARRAY(-)
-    VTOPERATOR_CPPARRAY(*)
-    VTOPERATOR_CPPARRAY(/)
-    VTOPERATOR_CPPARRAY(%)
+    VTOPERATOR_CPPARRAY(+,Add)
+    VTOPERATOR_CPPARRAY(-,Sub)
+    VTOPERATOR_CPPARRAY(*,Mul)
+    VTOPERATOR_CPPARRAY(/,Div)
+    VTOPERATOR_CPPARRAY(%,Mod)
     VTOPERATOR_CPPARRAY_UNARY(-)
 ARCH_PRAGMA_POP
 
@@ -433,30 +480,66 @@ ARCH_PRAGMA_POP
     }
 
     void _Detach() {
-        if (_data && !_data->IsUnique())
+        if (_data && (!_data->IsUnique() || _data->IsForeign()))
             _data.reset(new _Data(*_data));
     }
 
+    // Records a foreign buffer installed by FromForeignData() and releases
+    // it via the deleter when the last array referring to it lets go.
+    struct _ForeignSource {
+        _ForeignSource(ElementType const *data_, size_t size_,
+                       ForeignDataDeleter deleter_)
+            : data(data_), size(size_), deleter(std::move(deleter_)) {}
+        ~_ForeignSource() {
+            if (deleter)
+                deleter(data);
+        }
+        ElementType const *data;
+        size_t size;
+        ForeignDataDeleter deleter;
+    };
+
     struct _NoValues {};
     struct _Data {
 
         _Data() : _refCount(0) {}
 
-        _Data(_Data const &other) 
-            : vec(other.vec), reserved(other.reserved), _refCount(0) {}
+        _Data(_Data const &other)
+            : vec(other.vec), reserved(other.reserved), _refCount(0) {
+            if (other.foreign) {
+                vec.assign(other.foreign->data,
+                           other.foreign->data + other.foreign->size);
+            }
+        }
 
-        _Data(_Data const &other, _NoValues) 
+        _Data(_Data const &other, _NoValues)
             : reserved(other.reserved), _refCount(0) {}
 
         _Data &operator=(_Data const &other) {
-            vec = other.vec;
+            if (other.foreign) {
+                vec.assign(other.foreign->data,
+                           other.foreign->data + other.foreign->size);
+            }
+            else {
+                vec = other.vec;
+            }
+            foreign.reset();
             reserved = other.reserved;
             return *this;
         }
 
         bool IsUnique() const { return _refCount == 1; }
+        bool IsForeign() const { return static_cast<bool>(foreign); }
+
+        ElementType const *GetPointer() const {
+            return foreign ? foreign->data : vec.data();
+        }
+        size_t GetSize() const {
+            return foreign ? foreign->size : vec.size();
+        }
 
         _VecType vec;
+        std::unique_ptr<_ForeignSource> foreign;
         Vt_Reserved reserved;
 
     private:
@@ -504,6 +587,55 @@ VTOPERATOR_CPPSCALAR_DOUBLE(/)
 VTOPERATOR_CPPSCALAR(%)
 ARCH_PRAGMA_POP
 
+/// Returns the element-wise fused multiply-add \p a[i] * \p b[i] + \p c[i].
+/// The arrays must all be the same size.  For float and double element
+/// types this runs a SIMD kernel (with true FMA instructions where the CPU
+/// provides them); other element types use a scalar loop.
+template <typename ElemType>
+VtArray<ElemType>
+VtFusedMultiplyAdd(VtArray<ElemType> const &a, VtArray<ElemType> const &b,
+                   VtArray<ElemType> const &c)
+{
+    if (a.size() != b.size() || a.size() != c.size()) {
+        TF_CODING_ERROR("Non-conforming inputs for VtFusedMultiplyAdd");
+        return VtArray<ElemType>();
+    }
+    VtArray<ElemType> ret(a.size());
+    if (ret.size() &&
+        Vt_SimdMulAdd(a.cdata(), b.cdata(), c.cdata(),
+                      ret.data(), ret.size())) {
+        return ret;
+    }
+    for (size_t i = 0, n = ret.size(); i != n; ++i) {
+        ret[i] = a[i] * b[i] + c[i];
+    }
+    return ret;
+}
+
+/// Returns the element-wise fused multiply-add \p a[i] * \p scalar + \p c[i].
+/// The arrays must be the same size.  This form also covers element types
+/// that scale by a double but do not multiply element-wise, e.g. GfVec3f.
+template <typename ElemType>
+VtArray<ElemType>
+VtFusedMultiplyAdd(VtArray<ElemType> const &a, double scalar,
+                   VtArray<ElemType> const &c)
+{
+    if (a.size() != c.size()) {
+        TF_CODING_ERROR("Non-conforming inputs for VtFusedMultiplyAdd");
+        return VtArray<ElemType>();
+    }
+    VtArray<ElemType> ret(a.size());
+    if (ret.size() &&
+        Vt_SimdScaleAdd(a.cdata(), scalar, c.cdata(),
+                        ret.data(), ret.size())) {
+        return ret;
+    }
+    for (size_t i = 0, n = ret.size(); i != n; ++i) {
+        ret[i] = ElemType(a[i] * scalar) + c[i];
+    }
+    return ret;
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
 
 #endif // VT_ARRAY_H
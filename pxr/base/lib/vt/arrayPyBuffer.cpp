@@ -172,9 +172,10 @@ constexpr auto Vt_GetElementShape() ->
 
 ////////////////////////////////////////////////////////////////////////
 // Array wrapper object -- we allocate one of these when we get a buffer
-// request.  It holds a copy of the VtArray, plus shape and stride arrays.  We
-// store a pointer to the allocated wrapper in the Py_buffer object and delete
-// it on 'releasebuffer'.
+// request.  It holds a copy of the VtArray that shares the exporting array's
+// storage, keeping the exported pointer valid for the life of the view, plus
+// shape and stride arrays.  We store a pointer to the allocated wrapper in
+// the Py_buffer object and delete it on 'releasebuffer'.
 template <class Array>
 struct Vt_ArrayBufferWrapper
 {
@@ -202,13 +203,6 @@ struct Vt_ArrayBufferWrapper
         }
     }
 
-    void MakeWritable() {
-        // Invoke the .data() method on array.  As a side effect this will
-        // detach it from any shared storage, ensuring that any modifications
-        // will not affect other VtArray instances.
-        (void)array.data();
-    }
-
     Array array;
 
     Vt_PyShape<Vt_GetElementShape<value_type>().size() + 1> shape;
@@ -228,7 +222,10 @@ Vt_getreadbuf(PyObject *self, Py_ssize_t segment, void **ptrptr) {
         return -1;
     }
     T &selfT = bp::extract<T &>(self);
-    *ptrptr = static_cast<void *>(selfT.data());
+    // Alias the data in place -- read-only access never detaches, so this
+    // incurs no copy even when the storage is shared.
+    *ptrptr = static_cast<void *>(
+        const_cast<typename T::value_type *>(selfT.cdata()));
     // Return size in bytes.
     return selfT.size() * sizeof(typename T::value_type);
 }
@@ -237,9 +234,16 @@ Vt_getreadbuf(PyObject *self, Py_ssize_t segment, void **ptrptr) {
 template <class T>
 Py_ssize_t
 Vt_getwritebuf(PyObject *self, Py_ssize_t segment, void **ptrptr) {
-    PyErr_SetString(PyExc_ValueError, "writable buffers supported only with "
-                    "new-style buffer protocol.");
-    return -1;
+    if (segment != 0) {
+        // Always one-segment for arrays.
+        PyErr_SetString(PyExc_ValueError, "accessed non-existent segment");
+        return -1;
+    }
+    T &selfT = bp::extract<T &>(self);
+    // Detach from any shared storage (the usual copy-on-write detach) and
+    // hand out the array's own data, so writes are visible to this array.
+    *ptrptr = static_cast<void *>(selfT.data());
+    return selfT.size() * sizeof(typename T::value_type);
 }
 
 // Python's getsegcount interface function.
@@ -285,16 +289,23 @@ Vt_getbuffer(PyObject *self, Py_buffer *view, int flags)
     }
 
     T &array = bp::extract<T &>(self);
-    auto wrapper = std::unique_ptr<Vt_ArrayBufferWrapper<T>>(
-        new Vt_ArrayBufferWrapper<T>(array));
 
     bool writable = ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE);
 
-    if (writable)
-        wrapper->MakeWritable();
+    // Establish the exported pointer before taking the wrapper's copy.  For
+    // writable requests, detach 'array' from any arrays sharing its storage
+    // (the usual copy-on-write detach) and alias its storage directly, so
+    // writes through the view round-trip to the array python holds.
+    // Read-only requests alias the storage in place, with no copy at all.
+    void *buf = writable
+        ? static_cast<void *>(array.data())
+        : static_cast<void *>(const_cast<value_type *>(array.cdata()));
+
+    auto wrapper = std::unique_ptr<Vt_ArrayBufferWrapper<T>>(
+        new Vt_ArrayBufferWrapper<T>(array));
 
     view->obj = self;
-    view->buf = static_cast<void *>(wrapper->array.data());
+    view->buf = buf;
     view->len = wrapper->array.size() * sizeof(value_type);
     view->readonly = static_cast<int>(!writable);
     view->itemsize = sizeof(typename Vt_GetSubElementType<value_type>::Type);
@@ -446,6 +457,29 @@ Vt_ArrayFromBuffer(TfPyObjWrapper const &obj,
         isConvertible = true;
 
         if (out) {
+            // If the buffer's layout matches the array's exactly -- same
+            // element format and size, C-contiguous -- adopt the buffer's
+            // memory via FromForeignData() rather than copying it.  The
+            // resulting array holds the Py_buffer (and through it a
+            // reference to the exporting object, e.g. a numpy array) until
+            // the last array sharing the data is destroyed or detached by a
+            // mutation.
+            if (typeChar == desiredFmt[0] &&
+                view.itemsize == static_cast<Py_ssize_t>(sizeof(SubType)) &&
+                PyBuffer_IsContiguous(&view, 'C')) {
+                Py_buffer heldView = view;
+                *out = VtArray<T>::FromForeignData(
+                    static_cast<T const *>(view.buf), arraySize,
+                    [heldView](T const *) mutable {
+                        // The last reference may drop on any thread; take
+                        // the GIL to release the buffer.
+                        TfPyLock lock;
+                        PyBuffer_Release(&heldView);
+                    });
+                // Ownership of the view passed to the deleter above.
+                return true;
+            }
+
             out->resize(arraySize);
 
             // Copy the contents to out.  An element at 'index' is located at:
@@ -39,6 +39,13 @@ PXR_NAMESPACE_OPEN_SCOPE
 /// compatible type and dimensions.  If \p err is supplied, set it to an
 /// explanatory message in case of conversion failure.  This function may be
 /// invoked for VtArray<T> where T is one of VT_ARRAY_PYBUFFER_TYPES.
+///
+/// When \p obj exposes a C-contiguous buffer whose element format and size
+/// match VtArray<T> exactly, the returned array adopts the buffer's memory
+/// without copying, retaining a reference to \p obj until the last array
+/// sharing the data is destroyed or detached by a mutation (see
+/// VtArray::FromForeignData()).  Buffers with other (convertible) formats or
+/// strided layouts are copied element-by-element as before.
 template <class T>
 boost::optional<VtArray<T> >
 VtArrayFromPyBuffer(TfPyObjWrapper const &obj, std::string *err=nullptr);
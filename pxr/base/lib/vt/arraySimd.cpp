@@ -0,0 +1,414 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/base/vt/arraySimd.h"
+
+#include "pxr/base/arch/defines.h"
+
+// The AVX and FMA paths use the target attribute so they can be compiled
+// into this translation unit without raising the ISA floor of the build;
+// they are only called after a runtime CPU feature check.  The SSE2 paths
+// are baseline on x86-64 and need no check.
+#if defined(ARCH_CPU_INTEL) && defined(__SSE2__) && \
+    (defined(__GNUC__) || defined(__clang__)) && !defined(ARCH_OS_WINDOWS)
+#include <immintrin.h>
+#define VT_ARRAYSIMD_USE_X86
+#endif
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+#ifdef VT_ARRAYSIMD_USE_X86
+
+static bool
+_SupportsAvx()
+{
+    static const bool supported = __builtin_cpu_supports("avx");
+    return supported;
+}
+
+static bool
+_SupportsFma()
+{
+    static const bool supported =
+        __builtin_cpu_supports("avx") && __builtin_cpu_supports("fma");
+    return supported;
+}
+
+// Generate the AVX (8-wide float / 4-wide double) and SSE2 (4-wide float /
+// 2-wide double) kernels for one binary operation.  The kernels are
+// identical except for the intrinsic, so stamp them out with a macro.
+#define VT_DEFINE_BINARY_KERNELS(Name, intrin, op)                           \
+__attribute__((target("avx"))) static void                                   \
+_##Name##AvxFloat(float const *a, float const *b, float *r, size_t n)        \
+{                                                                            \
+    size_t i = 0;                                                            \
+    for (; i + 8 <= n; i += 8) {                                             \
+        _mm256_storeu_ps(r + i,                                              \
+            _mm256_##intrin##_ps(_mm256_loadu_ps(a + i),                     \
+                                 _mm256_loadu_ps(b + i)));                   \
+    }                                                                        \
+    for (; i != n; ++i) { r[i] = a[i] op b[i]; }                             \
+}                                                                            \
+__attribute__((target("avx"))) static void                                   \
+_##Name##AvxDouble(double const *a, double const *b, double *r, size_t n)    \
+{                                                                            \
+    size_t i = 0;                                                            \
+    for (; i + 4 <= n; i += 4) {                                             \
+        _mm256_storeu_pd(r + i,                                              \
+            _mm256_##intrin##_pd(_mm256_loadu_pd(a + i),                     \
+                                 _mm256_loadu_pd(b + i)));                   \
+    }                                                                        \
+    for (; i != n; ++i) { r[i] = a[i] op b[i]; }                             \
+}                                                                            \
+static void                                                                  \
+_##Name##SseFloat(float const *a, float const *b, float *r, size_t n)        \
+{                                                                            \
+    size_t i = 0;                                                            \
+    for (; i + 4 <= n; i += 4) {                                             \
+        _mm_storeu_ps(r + i,                                                 \
+            _mm_##intrin##_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));    \
+    }                                                                        \
+    for (; i != n; ++i) { r[i] = a[i] op b[i]; }                             \
+}                                                                            \
+static void                                                                  \
+_##Name##SseDouble(double const *a, double const *b, double *r, size_t n)    \
+{                                                                            \
+    size_t i = 0;                                                            \
+    for (; i + 2 <= n; i += 2) {                                             \
+        _mm_storeu_pd(r + i,                                                 \
+            _mm_##intrin##_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)));    \
+    }                                                                        \
+    for (; i != n; ++i) { r[i] = a[i] op b[i]; }                             \
+}
+
+VT_DEFINE_BINARY_KERNELS(Add, add, +)
+VT_DEFINE_BINARY_KERNELS(Sub, sub, -)
+VT_DEFINE_BINARY_KERNELS(Mul, mul, *)
+VT_DEFINE_BINARY_KERNELS(Div, div, /)
+
+#undef VT_DEFINE_BINARY_KERNELS
+
+__attribute__((target("avx,fma"))) static void
+_MulAddFmaFloat(float const *a, float const *b, float const *c,
+                float *r, size_t n)
+{
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(r + i,
+            _mm256_fmadd_ps(_mm256_loadu_ps(a + i), _mm256_loadu_ps(b + i),
+                            _mm256_loadu_ps(c + i)));
+    }
+    for (; i != n; ++i) { r[i] = a[i] * b[i] + c[i]; }
+}
+
+__attribute__((target("avx,fma"))) static void
+_MulAddFmaDouble(double const *a, double const *b, double const *c,
+                 double *r, size_t n)
+{
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(r + i,
+            _mm256_fmadd_pd(_mm256_loadu_pd(a + i), _mm256_loadu_pd(b + i),
+                            _mm256_loadu_pd(c + i)));
+    }
+    for (; i != n; ++i) { r[i] = a[i] * b[i] + c[i]; }
+}
+
+static void
+_MulAddSseFloat(float const *a, float const *b, float const *c,
+                float *r, size_t n)
+{
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(r + i,
+            _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)),
+                       _mm_loadu_ps(c + i)));
+    }
+    for (; i != n; ++i) { r[i] = a[i] * b[i] + c[i]; }
+}
+
+static void
+_MulAddSseDouble(double const *a, double const *b, double const *c,
+                 double *r, size_t n)
+{
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        _mm_storeu_pd(r + i,
+            _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(a + i), _mm_loadu_pd(b + i)),
+                       _mm_loadu_pd(c + i)));
+    }
+    for (; i != n; ++i) { r[i] = a[i] * b[i] + c[i]; }
+}
+
+__attribute__((target("avx,fma"))) static void
+_ScaleAddFmaFloat(float const *a, float s, float const *c, float *r, size_t n)
+{
+    const __m256 sv = _mm256_set1_ps(s);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(r + i,
+            _mm256_fmadd_ps(_mm256_loadu_ps(a + i), sv,
+                            _mm256_loadu_ps(c + i)));
+    }
+    for (; i != n; ++i) { r[i] = a[i] * s + c[i]; }
+}
+
+__attribute__((target("avx,fma"))) static void
+_ScaleAddFmaDouble(double const *a, double s, double const *c,
+                   double *r, size_t n)
+{
+    const __m256d sv = _mm256_set1_pd(s);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(r + i,
+            _mm256_fmadd_pd(_mm256_loadu_pd(a + i), sv,
+                            _mm256_loadu_pd(c + i)));
+    }
+    for (; i != n; ++i) { r[i] = a[i] * s + c[i]; }
+}
+
+static void
+_ScaleAddSseFloat(float const *a, float s, float const *c, float *r, size_t n)
+{
+    const __m128 sv = _mm_set1_ps(s);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(r + i,
+            _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(a + i), sv),
+                       _mm_loadu_ps(c + i)));
+    }
+    for (; i != n; ++i) { r[i] = a[i] * s + c[i]; }
+}
+
+static void
+_ScaleAddSseDouble(double const *a, double s, double const *c,
+                   double *r, size_t n)
+{
+    const __m128d sv = _mm_set1_pd(s);
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        _mm_storeu_pd(r + i,
+            _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(a + i), sv),
+                       _mm_loadu_pd(c + i)));
+    }
+    for (; i != n; ++i) { r[i] = a[i] * s + c[i]; }
+}
+
+__attribute__((target("avx,fma"))) static void
+_LerpFmaFloat(float alpha, float const *a, float const *b, float *r, size_t n)
+{
+    const __m256 av = _mm256_set1_ps(alpha);
+    const __m256 iv = _mm256_set1_ps(1.0f - alpha);
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        _mm256_storeu_ps(r + i,
+            _mm256_fmadd_ps(_mm256_loadu_ps(b + i), av,
+                _mm256_mul_ps(_mm256_loadu_ps(a + i), iv)));
+    }
+    for (; i != n; ++i) { r[i] = (1.0f - alpha) * a[i] + alpha * b[i]; }
+}
+
+__attribute__((target("avx,fma"))) static void
+_LerpFmaDouble(double alpha, double const *a, double const *b,
+               double *r, size_t n)
+{
+    const __m256d av = _mm256_set1_pd(alpha);
+    const __m256d iv = _mm256_set1_pd(1.0 - alpha);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm256_storeu_pd(r + i,
+            _mm256_fmadd_pd(_mm256_loadu_pd(b + i), av,
+                _mm256_mul_pd(_mm256_loadu_pd(a + i), iv)));
+    }
+    for (; i != n; ++i) { r[i] = (1.0 - alpha) * a[i] + alpha * b[i]; }
+}
+
+static void
+_LerpSseFloat(float alpha, float const *a, float const *b, float *r, size_t n)
+{
+    const __m128 av = _mm_set1_ps(alpha);
+    const __m128 iv = _mm_set1_ps(1.0f - alpha);
+    size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+        _mm_storeu_ps(r + i,
+            _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(a + i), iv),
+                       _mm_mul_ps(_mm_loadu_ps(b + i), av)));
+    }
+    for (; i != n; ++i) { r[i] = (1.0f - alpha) * a[i] + alpha * b[i]; }
+}
+
+static void
+_LerpSseDouble(double alpha, double const *a, double const *b,
+               double *r, size_t n)
+{
+    const __m128d av = _mm_set1_pd(alpha);
+    const __m128d iv = _mm_set1_pd(1.0 - alpha);
+    size_t i = 0;
+    for (; i + 2 <= n; i += 2) {
+        _mm_storeu_pd(r + i,
+            _mm_add_pd(_mm_mul_pd(_mm_loadu_pd(a + i), iv),
+                       _mm_mul_pd(_mm_loadu_pd(b + i), av)));
+    }
+    for (; i != n; ++i) { r[i] = (1.0 - alpha) * a[i] + alpha * b[i]; }
+}
+
+#endif // VT_ARRAYSIMD_USE_X86
+
+#ifdef VT_ARRAYSIMD_USE_X86
+
+#define VT_DEFINE_BINARY_DISPATCH(Name)                                      \
+bool Vt_Simd##Name(float const *a, float const *b, float *r, size_t n)       \
+{                                                                            \
+    if (_SupportsAvx()) {                                                    \
+        _##Name##AvxFloat(a, b, r, n);                                       \
+    } else {                                                                 \
+        _##Name##SseFloat(a, b, r, n);                                       \
+    }                                                                        \
+    return true;                                                             \
+}                                                                            \
+bool Vt_Simd##Name(double const *a, double const *b, double *r, size_t n)    \
+{                                                                            \
+    if (_SupportsAvx()) {                                                    \
+        _##Name##AvxDouble(a, b, r, n);                                      \
+    } else {                                                                 \
+        _##Name##SseDouble(a, b, r, n);                                      \
+    }                                                                        \
+    return true;                                                             \
+}
+
+#else // !VT_ARRAYSIMD_USE_X86
+
+#define VT_DEFINE_BINARY_DISPATCH(Name)                                      \
+bool Vt_Simd##Name(float const *, float const *, float *, size_t)            \
+{                                                                            \
+    return false;                                                            \
+}                                                                            \
+bool Vt_Simd##Name(double const *, double const *, double *, size_t)         \
+{                                                                            \
+    return false;                                                            \
+}
+
+#endif // VT_ARRAYSIMD_USE_X86
+
+VT_DEFINE_BINARY_DISPATCH(Add)
+VT_DEFINE_BINARY_DISPATCH(Sub)
+VT_DEFINE_BINARY_DISPATCH(Mul)
+VT_DEFINE_BINARY_DISPATCH(Div)
+
+#undef VT_DEFINE_BINARY_DISPATCH
+
+bool
+Vt_SimdMulAdd(float const *a, float const *b, float const *c,
+              float *r, size_t n)
+{
+#ifdef VT_ARRAYSIMD_USE_X86
+    if (_SupportsFma()) {
+        _MulAddFmaFloat(a, b, c, r, n);
+    } else {
+        _MulAddSseFloat(a, b, c, r, n);
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool
+Vt_SimdMulAdd(double const *a, double const *b, double const *c,
+              double *r, size_t n)
+{
+#ifdef VT_ARRAYSIMD_USE_X86
+    if (_SupportsFma()) {
+        _MulAddFmaDouble(a, b, c, r, n);
+    } else {
+        _MulAddSseDouble(a, b, c, r, n);
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool
+Vt_SimdScaleAdd(float const *a, double s, float const *c, float *r, size_t n)
+{
+#ifdef VT_ARRAYSIMD_USE_X86
+    if (_SupportsFma()) {
+        _ScaleAddFmaFloat(a, static_cast<float>(s), c, r, n);
+    } else {
+        _ScaleAddSseFloat(a, static_cast<float>(s), c, r, n);
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool
+Vt_SimdScaleAdd(double const *a, double s, double const *c, double *r, size_t n)
+{
+#ifdef VT_ARRAYSIMD_USE_X86
+    if (_SupportsFma()) {
+        _ScaleAddFmaDouble(a, s, c, r, n);
+    } else {
+        _ScaleAddSseDouble(a, s, c, r, n);
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool
+Vt_SimdLerp(double alpha, float const *a, float const *b, float *r, size_t n)
+{
+#ifdef VT_ARRAYSIMD_USE_X86
+    if (_SupportsFma()) {
+        _LerpFmaFloat(static_cast<float>(alpha), a, b, r, n);
+    } else {
+        _LerpSseFloat(static_cast<float>(alpha), a, b, r, n);
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool
+Vt_SimdLerp(double alpha, double const *a, double const *b, double *r, size_t n)
+{
+#ifdef VT_ARRAYSIMD_USE_X86
+    if (_SupportsFma()) {
+        _LerpFmaDouble(alpha, a, b, r, n);
+    } else {
+        _LerpSseDouble(alpha, a, b, r, n);
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
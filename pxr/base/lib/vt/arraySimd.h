@@ -0,0 +1,138 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef VT_ARRAYSIMD_H
+#define VT_ARRAYSIMD_H
+
+/// \file vt/arraySimd.h
+/// SIMD kernels backing the element-wise VtArray operators.
+///
+/// Each kernel returns true if it performed the operation and false if the
+/// caller should run its scalar loop instead.  The generic templates always
+/// decline, so the operator macros in operators.h can dispatch through these
+/// unconditionally for any element type; only the types with concrete
+/// overloads below (float, double, and GfVec3f viewed as packed floats) take
+/// the vector path.  The concrete kernels select an instruction set at
+/// runtime, so no caller needs to raise the ISA floor of the build.
+///
+/// All kernels require n != 0, valid input pointers, and a destination that
+/// does not alias the inputs; the operator macros construct a fresh result
+/// array, which satisfies this.
+
+#include "pxr/pxr.h"
+#include "pxr/base/vt/api.h"
+#include "pxr/base/gf/matrix4d.h"
+#include "pxr/base/gf/vec3f.h"
+
+#include <cstddef>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+// Generic fallbacks: no SIMD kernel for this element type.
+template <class T>
+inline bool Vt_SimdAdd(T const *, T const *, T *, size_t) { return false; }
+template <class T>
+inline bool Vt_SimdSub(T const *, T const *, T *, size_t) { return false; }
+template <class T>
+inline bool Vt_SimdMul(T const *, T const *, T *, size_t) { return false; }
+template <class T>
+inline bool Vt_SimdDiv(T const *, T const *, T *, size_t) { return false; }
+template <class T>
+inline bool Vt_SimdMod(T const *, T const *, T *, size_t) { return false; }
+template <class T>
+inline bool Vt_SimdMulAdd(T const *, T const *, T const *, T *, size_t) {
+    return false;
+}
+template <class T>
+inline bool Vt_SimdScaleAdd(T const *, double, T const *, T *, size_t) {
+    return false;
+}
+template <class T>
+inline bool Vt_SimdLerp(double, T const *, T const *, T *, size_t) {
+    return false;
+}
+
+// r[i] = a[i] op b[i]
+VT_API bool Vt_SimdAdd(float const *a, float const *b, float *r, size_t n);
+VT_API bool Vt_SimdSub(float const *a, float const *b, float *r, size_t n);
+VT_API bool Vt_SimdMul(float const *a, float const *b, float *r, size_t n);
+VT_API bool Vt_SimdDiv(float const *a, float const *b, float *r, size_t n);
+VT_API bool Vt_SimdAdd(double const *a, double const *b, double *r, size_t n);
+VT_API bool Vt_SimdSub(double const *a, double const *b, double *r, size_t n);
+VT_API bool Vt_SimdMul(double const *a, double const *b, double *r, size_t n);
+VT_API bool Vt_SimdDiv(double const *a, double const *b, double *r, size_t n);
+
+// r[i] = a[i] * b[i] + c[i]
+VT_API bool Vt_SimdMulAdd(float const *a, float const *b, float const *c,
+                          float *r, size_t n);
+VT_API bool Vt_SimdMulAdd(double const *a, double const *b, double const *c,
+                          double *r, size_t n);
+
+// r[i] = a[i] * s + c[i]
+VT_API bool Vt_SimdScaleAdd(float const *a, double s, float const *c,
+                            float *r, size_t n);
+VT_API bool Vt_SimdScaleAdd(double const *a, double s, double const *c,
+                            double *r, size_t n);
+
+// r[i] = (1-alpha) * a[i] + alpha * b[i].  Unlike the kernels above, r may
+// alias a or b: each element is loaded before the store to the same index,
+// so in-place use is safe.
+VT_API bool Vt_SimdLerp(double alpha, float const *a, float const *b,
+                        float *r, size_t n);
+VT_API bool Vt_SimdLerp(double alpha, double const *a, double const *b,
+                        double *r, size_t n);
+
+// GfVec3f is a standard-layout triple of floats, so component-wise
+// operations on a packed array of n vectors are the same as float
+// operations on 3n scalars.
+inline bool
+Vt_SimdAdd(GfVec3f const *a, GfVec3f const *b, GfVec3f *r, size_t n) {
+    return Vt_SimdAdd(a->data(), b->data(), r->data(), 3 * n);
+}
+inline bool
+Vt_SimdSub(GfVec3f const *a, GfVec3f const *b, GfVec3f *r, size_t n) {
+    return Vt_SimdSub(a->data(), b->data(), r->data(), 3 * n);
+}
+inline bool
+Vt_SimdScaleAdd(GfVec3f const *a, double s, GfVec3f const *c, GfVec3f *r,
+                size_t n) {
+    return Vt_SimdScaleAdd(a->data(), s, c->data(), r->data(), 3 * n);
+}
+inline bool
+Vt_SimdLerp(double alpha, GfVec3f const *a, GfVec3f const *b, GfVec3f *r,
+            size_t n) {
+    return Vt_SimdLerp(alpha, a->data(), b->data(), r->data(), 3 * n);
+}
+
+// Likewise, GfMatrix4d is a standard-layout 4x4 block of doubles, so a
+// packed array of n matrices is 16n scalars.
+inline bool
+Vt_SimdLerp(double alpha, GfMatrix4d const *a, GfMatrix4d const *b,
+            GfMatrix4d *r, size_t n) {
+    return Vt_SimdLerp(alpha, a->GetArray(), b->GetArray(), r->GetArray(),
+                       16 * n);
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // VT_ARRAYSIMD_H
@@ -37,6 +37,7 @@
 #include "pxr/base/tf/move.h"
 #include "pxr/base/tf/mallocTag.h"
 
+#include <boost/container/flat_map.hpp>
 #include <boost/functional/hash.hpp>
 #include <boost/preprocessor.hpp>
 
@@ -73,7 +74,13 @@ PXR_NAMESPACE_OPEN_SCOPE
 /// \link group_vtdict_functions VtDictionary Functions \endlink group page .
 ///
 class VtDictionary {
-    typedef std::map<std::string, VtValue> _Map;
+    // Keys are kept in a flat sorted vector rather than a node-based map:
+    // the dictionaries that flow through metadata and asset info are
+    // nearly always small, so binary search over contiguous storage beats
+    // pointer-chasing through tree nodes, and iteration is a linear scan.
+    // Note that unlike std::map, insertion and erasure invalidate
+    // iterators and references into the dictionary.
+    typedef boost::container::flat_map<std::string, VtValue> _Map;
     std::unique_ptr<_Map> _dictMap;
 
 public:
@@ -272,8 +279,9 @@ public:
         // Hash empty dict as zero.
         if (dict.empty())
             return 0;
-        // Otherwise hash the map.
-        return boost::hash_value(*dict._dictMap);
+        // Otherwise hash the map contents.
+        return boost::hash_range(
+            dict._dictMap->begin(), dict._dictMap->end());
     }
 
     /// Inserts a range into the \p VtDictionary. 
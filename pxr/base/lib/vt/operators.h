@@ -26,6 +26,7 @@
 
 #include "pxr/pxr.h"
 #include "pxr/base/vt/api.h"
+#include "pxr/base/vt/arraySimd.h"
 
 #include <boost/utility/enable_if.hpp>
 #include <boost/type_traits/is_same.hpp>
@@ -74,8 +75,10 @@
 PXR_NAMESPACE_OPEN_SCOPE
 
 // Operations on arrays
-// These go into the class definition for VtArray
-#define VTOPERATOR_CPPARRAY(op)                                                \
+// These go into the class definition for VtArray.  opName selects the
+// Vt_Simd kernel from arraySimd.h; the kernel declines element types it
+// has no vector implementation for, leaving the scalar loop in charge.
+#define VTOPERATOR_CPPARRAY(op,opName)                                         \
     VtArray operator op (VtArray const &other) const {                         \
         /* accept empty vecs */                                                \
         if ((size()!=0 && other.size()!=0) &&                                  \
@@ -88,6 +91,11 @@ PXR_NAMESPACE_OPEN_SCOPE
         const bool thisEmpty = size() == 0,                                    \
             otherEmpty = other.size() == 0;                                    \
         VtArray ret(thisEmpty ? other.size() : size());                        \
+        if (!thisEmpty && !otherEmpty && ret.size() &&                         \
+            Vt_Simd ## opName(cdata(), other.cdata(),                          \
+                              ret.data(), ret.size())) {                       \
+            return ret;                                                        \
+        }                                                                      \
         ElementType zero = VtZero<ElementType>();                              \
         for (size_t i = 0, n = ret.size(); i != n; ++i) {                      \
             ret[i] = (thisEmpty ? zero : (*this)[i]) op                        \
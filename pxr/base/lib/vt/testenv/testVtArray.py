@@ -269,6 +269,35 @@ class TestVtArray(unittest.TestCase):
         va = Vt.Vec3dArray(10, [(1,2,3),(2,3,4)])
         self.assertEqual(Vt.Vec3dArray.FromNumpy(numpy.array(va)), va)
 
+        # Writable buffer views alias the array's own storage: writes through
+        # the view are visible in the array, while arrays that shared the
+        # data beforehand are detached first (copy-on-write).
+        a = Vt.DoubleArray(10, range(10))
+        b = Vt.DoubleArray(a)
+        view = numpy.frombuffer(a)
+        self.assertTrue(view.flags.writeable)
+        view[0] = 123.0
+        self.assertEqual(a[0], 123.0)
+        self.assertEqual(b[0], 0.0)
+
+        # Read-only views neither copy nor detach shared storage.
+        c = Vt.IntArray(range(5))
+        nc = numpy.array(c, copy=False)
+        self.assertFalse(nc.flags.writeable)
+        self.assertEqual(list(nc), list(range(5)))
+
+        # Constructing a VtArray from a matching contiguous numpy array
+        # adopts the numpy array's memory without copying, so mutations to
+        # the source show through until the VtArray detaches.
+        nd = numpy.arange(12, dtype=numpy.float64)
+        d = Vt.DoubleArray(nd)
+        nd[3] = 99.0
+        self.assertEqual(d[3], 99.0)
+        # Mutating the VtArray detaches it from the adopted memory.
+        d[0] = -1.0
+        nd[4] = 42.0
+        self.assertEqual(d[4], 4.0)
+
 if __name__ == '__main__':
     unittest.main()
 
@@ -216,6 +216,49 @@ static void testArray() {
         TF_AXIOM(cb._GetReserved()->data[1] == 2);
         TF_AXIOM(cb._GetReserved()->data[2] == 0);
     }
+
+    {
+        // Wrapping foreign data without copying.
+        static double buffer[100];
+        for (size_t i = 0; i != 100; ++i)
+            buffer[i] = i;
+
+        static int deleterCalls = 0;
+        {
+            VtDoubleArray foreign = VtDoubleArray::FromForeignData(
+                buffer, 100, [](double const *) { ++deleterCalls; });
+            TF_AXIOM(foreign.IsHoldingForeignData());
+            TF_AXIOM(foreign.size() == 100);
+            TF_AXIOM(foreign.cdata() == buffer);
+
+            // Copies share the foreign buffer.
+            VtDoubleArray copy = foreign;
+            TF_AXIOM(copy.IsIdentical(foreign));
+            TF_AXIOM(copy.cdata() == buffer);
+
+            // Mutation detaches into owned storage and leaves the buffer
+            // and other referents untouched.
+            copy[0] = -1.0;
+            TF_AXIOM(!copy.IsHoldingForeignData());
+            TF_AXIOM(copy.cdata() != buffer);
+            TF_AXIOM(copy[0] == -1.0 && copy[99] == 99.0);
+            TF_AXIOM(buffer[0] == 0.0);
+            TF_AXIOM(foreign.IsHoldingForeignData());
+            TF_AXIOM(deleterCalls == 0);
+
+            // Resizing detaches and preserves contents.
+            VtDoubleArray resized = foreign;
+            resized.resize(150);
+            TF_AXIOM(resized[99] == 99.0 && resized[149] == 0.0);
+
+            // Equality against an owned array with the same contents.
+            VtDoubleArray owned;
+            owned.assign(foreign.cbegin(), foreign.cend());
+            TF_AXIOM(owned == foreign);
+        }
+        // The deleter runs once, when the last referent goes away.
+        TF_AXIOM(deleterCalls == 1);
+    }
 }
 
 static void testArrayOperators() {
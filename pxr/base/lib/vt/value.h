@@ -207,12 +207,17 @@ class VtValue
         }
     };
 
-    // Hold objects up to 1 word large locally.  This makes the total structure
-    // 16 bytes when compiled 64 bit (1 word type-info pointer, 1 word storage
-    // space).
-    static const size_t _MaxLocalSize = sizeof(void*);
+    // Hold objects up to 3 words large locally.  This makes the total
+    // structure 32 bytes when compiled 64 bit (1 word type-info pointer, 3
+    // words storage space) and lets the common small value types -- GfVec3f,
+    // GfVec3d, GfVec2d, quaternions of float -- live in the value itself
+    // rather than costing a heap allocation each, which dominates the
+    // attribute value-resolution path.  Larger types like GfMatrix4d stay
+    // remote: storing them inline would balloon every VtValue (and every
+    // container of them) to the size of the largest type.
+    static const size_t _MaxLocalSize = 3 * sizeof(void*);
     typedef boost::aligned_storage<
-        /* size */_MaxLocalSize, /* alignment */_MaxLocalSize>::type _Storage;
+        /* size */_MaxLocalSize, /* alignment */sizeof(void*)>::type _Storage;
 
     template <class T>
     struct _IsTriviallyCopyable : boost::mpl::and_<
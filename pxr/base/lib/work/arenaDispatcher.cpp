@@ -27,6 +27,8 @@
 
 #include <tbb/concurrent_queue.h>
 
+#include <algorithm>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 namespace {
@@ -39,33 +41,48 @@ namespace {
 struct _ArenaManager
 {
     static constexpr size_t FreeLimit = 64; // a guess...
-    
+    static constexpr size_t NumTiers = WorkPriorityBackground + 1;
+
     inline tbb::task_arena *
-    CheckOut() {
-        // Try to pop one from freeArenas.
+    CheckOut(WorkPriority priority) {
+        // Try to pop one from the tier's free list.
         tbb::task_arena *ret;
-        if (freeArenas.try_pop(ret)) {
+        if (freeArenas[priority].try_pop(ret)) {
             return ret;
         }
         // Otherwise create a new one.
-        return new tbb::task_arena(WorkGetConcurrencyLimit());
+        return new tbb::task_arena(_GetTierConcurrency(priority));
     }
 
     inline void
-    Return(tbb::task_arena *arena) {
+    Return(WorkPriority priority, tbb::task_arena *arena) {
         // Racy size check -- if too many free already just delete to avoid
         // having too many arenas total.  Note that we can definitely have more
         // than FreeLimit free arenas, due to the racy size check.  That's okay.
-        if (freeArenas.unsafe_size() >= FreeLimit) {
+        if (freeArenas[priority].unsafe_size() >= FreeLimit) {
             delete arena;
         }
         // Otherwise return to free list.
         else {
-            freeArenas.push(arena);
-        }        
+            freeArenas[priority].push(arena);
+        }
+    }
+
+    // Background arenas are capped to half of the worker pool so that
+    // the frame-critical tiers always find threads available, no matter
+    // how much background work is pending.  The other tiers mirror the
+    // global concurrency limit.
+    static int
+    _GetTierConcurrency(WorkPriority priority) {
+        const int limit = WorkGetConcurrencyLimit();
+        return priority == WorkPriorityBackground
+            ? std::max(1, limit / 2)
+            : limit;
     }
 
-    tbb::concurrent_queue<tbb::task_arena *> freeArenas;
+    // One free list per priority tier, since the tiers size their
+    // arenas differently.
+    tbb::concurrent_queue<tbb::task_arena *> freeArenas[NumTiers];
 };
 
 _ArenaManager &
@@ -83,7 +100,7 @@ GetTheArenaManager()
 WorkArenaDispatcher::~WorkArenaDispatcher()
 {
     Wait();
-    GetTheArenaManager().Return(_arena);
+    GetTheArenaManager().Return(_priority, _arena);
 }
 
 void
@@ -112,9 +129,9 @@ WorkArenaDispatcher::Cancel()
 }
 
 tbb::task_arena *
-WorkArenaDispatcher::_GetArena() const
+WorkArenaDispatcher::_GetArena(WorkPriority priority) const
 {
-    return GetTheArenaManager().CheckOut();
+    return GetTheArenaManager().CheckOut(priority);
 }
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -52,12 +52,28 @@ PXR_NAMESPACE_OPEN_SCOPE
 /// The interface of the WorkArenaDispatcher, and thread-safety notes about its
 /// API are identical to those of the WorkDispatcher.
 ///
+/// Dispatchers may be placed in a priority tier (see WorkPriority).
+/// Each tier draws its arenas from a separate pool: interactive and
+/// default arenas mirror the global concurrency limit, while background
+/// arenas are capped to a fraction of it so that frame-critical tiers
+/// always find worker threads available.  In addition, background tasks
+/// run at low scheduler priority and yield their workers at task
+/// boundaries when higher-priority work arrives.
+///
 class WorkArenaDispatcher
 {
 public:
     /// Constructs a new dispatcher. The internal arena will mirror the
     /// global concurrency limit setting.
-    WorkArenaDispatcher() : _arena(_GetArena()) {}
+    WorkArenaDispatcher() : WorkArenaDispatcher(WorkPriorityDefault) {}
+
+    /// Constructs a new dispatcher in the given priority tier.
+    explicit WorkArenaDispatcher(WorkPriority priority)
+        : _priority(priority)
+        , _arena(_GetArena(priority))
+    {
+        _dispatcher.SetPriority(priority);
+    }
 
     /// Wait() for any pending tasks to complete, then destroy the dispatcher.
     WORK_API ~WorkArenaDispatcher();
@@ -101,8 +117,8 @@ public:
     WORK_API void Cancel();
 
 private:
-    WORK_API tbb::task_arena *_GetArena() const;
-    
+    WORK_API tbb::task_arena *_GetArena(WorkPriority priority) const;
+
     template <class Fn>
     struct _Runner {
         _Runner(WorkDispatcher *wd, Fn &&fn) : _wd(wd), _fn(std::move(fn)) {}
@@ -121,6 +137,9 @@ private:
             wd, std::forward<Fn>(fn));
     }
 
+    // The priority tier; determines which arena pool we draw from.
+    WorkPriority _priority;
+
     // The task arena.
     tbb::task_arena *_arena;
 
@@ -68,6 +68,26 @@ WorkDispatcher::Cancel()
     _context.cancel_group_execution();
 }
 
+void
+WorkDispatcher::SetPriority(WorkPriority priority)
+{
+    // Map the tiers onto the scheduler's task group priorities.  The
+    // scheduler drains higher-priority task groups first and migrates
+    // workers away from low-priority groups between tasks, which is
+    // what lets background work yield to frame-critical work.
+    switch (priority) {
+    case WorkPriorityInteractive:
+        _context.set_priority(tbb::priority_high);
+        break;
+    case WorkPriorityDefault:
+        _context.set_priority(tbb::priority_normal);
+        break;
+    case WorkPriorityBackground:
+        _context.set_priority(tbb::priority_low);
+        break;
+    }
+}
+
 /* static */
 void
 WorkDispatcher::_TransportErrors(const TfErrorMark &mark,
@@ -42,6 +42,18 @@
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+/// \enum WorkPriority
+///
+/// Priority tiers for dispatched work.  When tasks from multiple tiers
+/// are pending, the scheduler prefers higher tiers when doling out
+/// worker threads, so long-running background work does not add latency
+/// to frame-critical tasks.
+enum WorkPriority {
+    WorkPriorityInteractive,
+    WorkPriorityDefault,
+    WorkPriorityBackground
+};
+
 /// \class WorkDispatcher
 ///
 /// A work dispatcher runs concurrent tasks.  The dispatcher supports adding
@@ -126,6 +138,15 @@ public:
     /// pending tasks to complete.
     WORK_API void Cancel();
 
+    /// Assign \p priority to the tasks run by this dispatcher.
+    ///
+    /// Tasks in higher tiers are preferred by the scheduler whenever
+    /// both tiers have work pending; background tasks yield their
+    /// worker threads at task boundaries when higher-priority work
+    /// arrives.  A dispatcher starts out in the default tier.  This
+    /// must not be called concurrently with Run().
+    WORK_API void SetPriority(WorkPriority priority);
+
 private:
     typedef tbb::concurrent_vector<TfErrorTransport> _ErrorTransports;
 
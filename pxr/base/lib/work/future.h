@@ -0,0 +1,376 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef WORK_FUTURE_H
+#define WORK_FUTURE_H
+
+/// \file work/future.h
+
+#include "pxr/pxr.h"
+#include "pxr/base/work/detachedTask.h"
+#include "pxr/base/work/api.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+template <class T> class WorkFuture;
+template <class T> class Work_FutureState;
+
+// Grants the factory functions access to the private state constructor of
+// WorkFuture without befriending each instantiation individually.
+struct Work_FutureAccess
+{
+    template <class T>
+    static WorkFuture<T>
+    Make(std::shared_ptr<Work_FutureState<T>> const &state) {
+        return WorkFuture<T>(state);
+    }
+};
+
+// Shared state between a WorkFuture and the task that produces its value.
+// The value is stored in place once Set() runs; continuations registered
+// before that run on the thread that completes the state, continuations
+// registered after run immediately on the registering thread.
+template <class T>
+class Work_FutureState
+{
+public:
+    Work_FutureState() : _ready(false) { }
+
+    ~Work_FutureState() {
+        if (_ready.load(std::memory_order_acquire)) {
+            _Value()->~T();
+        }
+    }
+
+    Work_FutureState(Work_FutureState const &) = delete;
+    Work_FutureState &operator=(Work_FutureState const &) = delete;
+
+    bool IsReady() const {
+        return _ready.load(std::memory_order_acquire);
+    }
+
+    void Set(T &&value) {
+        std::vector<std::function<void ()>> continuations;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            new (&_storage) T(std::move(value));
+            _ready.store(true, std::memory_order_release);
+            continuations.swap(_continuations);
+        }
+        _cv.notify_all();
+        for (const auto &fn : continuations) {
+            fn();
+        }
+    }
+
+    T const &Get() {
+        if (!IsReady()) {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _cv.wait(lock, [this]() { return IsReady(); });
+        }
+        return *_Value();
+    }
+
+    void AddContinuation(std::function<void ()> &&fn) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!IsReady()) {
+                _continuations.push_back(std::move(fn));
+                return;
+            }
+        }
+        fn();
+    }
+
+private:
+    T const *_Value() const {
+        return reinterpret_cast<T const *>(&_storage);
+    }
+    T *_Value() {
+        return reinterpret_cast<T *>(&_storage);
+    }
+
+    typename std::aligned_storage<sizeof(T), alignof(T)>::type _storage;
+    std::atomic<bool> _ready;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::vector<std::function<void ()>> _continuations;
+};
+
+// Specialization for futures that carry no value and only signal
+// completion.
+template <>
+class Work_FutureState<void>
+{
+public:
+    Work_FutureState() : _ready(false) { }
+
+    Work_FutureState(Work_FutureState const &) = delete;
+    Work_FutureState &operator=(Work_FutureState const &) = delete;
+
+    bool IsReady() const {
+        return _ready.load(std::memory_order_acquire);
+    }
+
+    void Set() {
+        std::vector<std::function<void ()>> continuations;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _ready.store(true, std::memory_order_release);
+            continuations.swap(_continuations);
+        }
+        _cv.notify_all();
+        for (const auto &fn : continuations) {
+            fn();
+        }
+    }
+
+    void Get() {
+        if (!IsReady()) {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _cv.wait(lock, [this]() { return IsReady(); });
+        }
+    }
+
+    void AddContinuation(std::function<void ()> &&fn) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            if (!IsReady()) {
+                _continuations.push_back(std::move(fn));
+                return;
+            }
+        }
+        fn();
+    }
+
+private:
+    std::atomic<bool> _ready;
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::vector<std::function<void ()>> _continuations;
+};
+
+// Invokes a callable and stores the result in a future state, folding away
+// the difference between value-producing and void callables.
+template <class R>
+struct Work_FutureSetFromInvoke
+{
+    template <class Fn>
+    static void Invoke(Work_FutureState<R> *state, Fn &fn) {
+        state->Set(fn());
+    }
+    template <class Fn, class A>
+    static void Invoke(Work_FutureState<R> *state, Fn &fn, A const &arg) {
+        state->Set(fn(arg));
+    }
+};
+
+template <>
+struct Work_FutureSetFromInvoke<void>
+{
+    template <class Fn>
+    static void Invoke(Work_FutureState<void> *state, Fn &fn) {
+        fn();
+        state->Set();
+    }
+    template <class Fn, class A>
+    static void Invoke(Work_FutureState<void> *state, Fn &fn, A const &arg) {
+        fn(arg);
+        state->Set();
+    }
+};
+
+/// \class WorkFuture
+///
+/// A handle to the eventual result of a task started with WorkAsync().
+/// Futures are cheap to copy; all copies refer to the same result.
+///
+/// Get() blocks until the result is available; IsReady() polls without
+/// blocking.  Then() attaches a continuation that receives the result and
+/// yields a future for the continuation's own return value, so asynchronous
+/// stages chain without any intervening wait:
+///
+/// \code
+/// WorkFuture<size_t> length =
+///     WorkAsync(ReadFile, path)
+///         .Then([](std::string const &data) { return data.size(); });
+/// \endcode
+///
+/// A continuation runs on the thread that completes its antecedent, or
+/// immediately on the calling thread if the antecedent is already complete,
+/// so continuations should be brief; use WorkAsync() from within a
+/// continuation to spawn heavier follow-up work.
+///
+template <class T>
+class WorkFuture
+{
+public:
+    /// Construct an invalid future.  Futures are normally obtained from
+    /// WorkAsync() or Then().
+    WorkFuture() { }
+
+    /// Return true if this future refers to a result.
+    bool IsValid() const {
+        return static_cast<bool>(_state);
+    }
+
+    /// Return true if the result is available, without blocking.
+    bool IsReady() const {
+        return _state && _state->IsReady();
+    }
+
+    /// Block until the result is available, then return it.  The future
+    /// must be valid.  Do not call from within a task that the producing
+    /// work may be waiting on.
+    T const &Get() const {
+        return _state->Get();
+    }
+
+    /// Attach a continuation to run with the result once it is available
+    /// and return a future for the continuation's return value.  The
+    /// future must be valid.
+    template <class Fn>
+    WorkFuture<typename std::result_of<
+        typename std::decay<Fn>::type(T const &)>::type>
+    Then(Fn &&fn) const {
+        typedef typename std::result_of<
+            typename std::decay<Fn>::type(T const &)>::type R;
+        typedef typename std::decay<Fn>::type FnType;
+
+        std::shared_ptr<Work_FutureState<R>> next =
+            std::make_shared<Work_FutureState<R>>();
+        std::shared_ptr<Work_FutureState<T>> state = _state;
+        FnType fnCopy(std::forward<Fn>(fn));
+        state->AddContinuation([state, next, fnCopy]() mutable {
+            Work_FutureSetFromInvoke<R>::Invoke(
+                next.get(), fnCopy, state->Get());
+        });
+        return WorkFuture<R>(next);
+    }
+
+private:
+    template <class U> friend class WorkFuture;
+    friend struct Work_FutureAccess;
+
+    explicit WorkFuture(std::shared_ptr<Work_FutureState<T>> const &state)
+        : _state(state) { }
+
+    std::shared_ptr<Work_FutureState<T>> _state;
+};
+
+// Specialization for futures that signal completion without carrying a
+// value; continuations take no argument.
+template <>
+class WorkFuture<void>
+{
+public:
+    WorkFuture() { }
+
+    bool IsValid() const {
+        return static_cast<bool>(_state);
+    }
+
+    bool IsReady() const {
+        return _state && _state->IsReady();
+    }
+
+    /// Block until the task completes.
+    void Get() const {
+        _state->Get();
+    }
+
+    template <class Fn>
+    WorkFuture<typename std::result_of<typename std::decay<Fn>::type()>::type>
+    Then(Fn &&fn) const {
+        typedef typename std::result_of<
+            typename std::decay<Fn>::type()>::type R;
+        typedef typename std::decay<Fn>::type FnType;
+
+        std::shared_ptr<Work_FutureState<R>> next =
+            std::make_shared<Work_FutureState<R>>();
+        std::shared_ptr<Work_FutureState<void>> state = _state;
+        FnType fnCopy(std::forward<Fn>(fn));
+        state->AddContinuation([state, next, fnCopy]() mutable {
+            Work_FutureSetFromInvoke<R>::Invoke(next.get(), fnCopy);
+        });
+        return WorkFuture<R>(next);
+    }
+
+private:
+    template <class U> friend class WorkFuture;
+    friend struct Work_FutureAccess;
+
+    explicit WorkFuture(std::shared_ptr<Work_FutureState<void>> const &state)
+        : _state(state) { }
+
+    std::shared_ptr<Work_FutureState<void>> _state;
+};
+
+// Schedule \p fn asynchronously and return a future for its result.
+template <class Fn,
+          class R = typename std::result_of<
+              typename std::decay<Fn>::type()>::type>
+WorkFuture<R>
+Work_MakeFuture(Fn &&fn)
+{
+    typedef typename std::decay<Fn>::type FnType;
+
+    std::shared_ptr<Work_FutureState<R>> state =
+        std::make_shared<Work_FutureState<R>>();
+    FnType fnCopy(std::forward<Fn>(fn));
+    WorkRunDetachedTask([state, fnCopy]() mutable {
+        Work_FutureSetFromInvoke<R>::Invoke(state.get(), fnCopy);
+    });
+    return Work_FutureAccess::Make(state);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///
+/// WorkAsync(callable, args...)
+///
+/// Invoke \p callable with \p args asynchronously and return a
+/// WorkFuture for its result.  The task runs in the same task group as
+/// WorkRunDetachedTask(); any errors it raises are discarded, so results
+/// that can fail should be encoded in the return value.
+///
+template <class Fn, class... Args>
+WorkFuture<typename std::result_of<
+    typename std::decay<Fn>::type(typename std::decay<Args>::type...)>::type>
+WorkAsync(Fn &&fn, Args&&... args)
+{
+    return Work_MakeFuture(
+        std::bind(std::forward<Fn>(fn), std::forward<Args>(args)...));
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // WORK_FUTURE_H
@@ -0,0 +1,139 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef WORK_REDUCE_H
+#define WORK_REDUCE_H
+
+/// \file work/reduce.h
+#include "pxr/pxr.h"
+#include "pxr/base/work/threadLimits.h"
+#include "pxr/base/work/api.h"
+
+#include <tbb/tbb.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+///////////////////////////////////////////////////////////////////////////////
+///
+/// WorkParallelReduceN(identity, n, loopCallback, reductionCallback,
+///                     grainSize)
+///
+/// Runs a parallel work-stealing reduction over the range 0 to n, using
+/// \p identity as the value a subrange accumulation starts from.
+///
+/// Loop callback must be of the form:
+///
+///     V LoopCallback(size_t begin, size_t end, V intermediate);
+///
+/// and must accumulate the elements in [begin, end) onto \p intermediate,
+/// which is either \p identity or the result of a previous callback
+/// invocation on an adjacent subrange.
+///
+/// Reduction callback must be of the form:
+///
+///     V ReductionCallback(V lhs, V rhs);
+///
+/// and must combine two accumulated values into one.  Callbacks may run
+/// concurrently and in any order, so the reduction must be associative and
+/// the callbacks must not rely on shared state.
+///
+/// grainSize specifies a minimum amount of work to be done per-thread.
+/// There is overhead to launching a task and a typical guideline is that
+/// you want to have at least 10,000 instructions to count for the overhead
+/// of launching that task.
+///
+template <typename Fn, typename Rn, typename V>
+V
+WorkParallelReduceN(
+    const V &identity,
+    size_t n,
+    Fn &&loopCallback,
+    Rn &&reductionCallback,
+    size_t grainSize)
+{
+    if (n == 0)
+        return identity;
+
+    // Don't bother with parallel_reduce, if concurrency is limited to 1.
+    if (WorkGetConcurrencyLimit() > 1) {
+
+        class Work_Body_TBB
+        {
+        public:
+            Work_Body_TBB(Fn &fn) : _fn(fn) { }
+
+            V operator()(
+                const tbb::blocked_range<size_t> &r,
+                const V &value) const {
+                // Note that we std::forward _fn using Fn in order get the
+                // right operator().
+                // We maintain the right type in this way:
+                //  If Fn is T&, then reference collapsing gives us T& for _fn
+                //  If Fn is T, then std::forward correctly gives us T&& for _fn
+                return std::forward<Fn>(_fn)(r.begin(), r.end(), value);
+            }
+
+        private:
+            Fn &_fn;
+        };
+
+        // In most cases we do not want to inherit cancellation state from the
+        // parent context, so we create an isolated task group context.
+        tbb::task_group_context ctx(tbb::task_group_context::isolated);
+        return tbb::parallel_reduce(
+            tbb::blocked_range<size_t>(0, n, grainSize),
+            identity,
+            Work_Body_TBB(loopCallback),
+            std::forward<Rn>(reductionCallback),
+            tbb::auto_partitioner(),
+            ctx);
+    }
+
+    // If concurrency is limited to 1, execute serially.
+    return std::forward<Fn>(loopCallback)(0, n, identity);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+///
+/// WorkParallelReduceN(identity, n, loopCallback, reductionCallback)
+///
+/// Runs a parallel work-stealing reduction over the range 0 to n, with a
+/// grain size of 1.
+///
+template <typename Fn, typename Rn, typename V>
+V
+WorkParallelReduceN(
+    const V &identity,
+    size_t n,
+    Fn &&loopCallback,
+    Rn &&reductionCallback)
+{
+    return WorkParallelReduceN(identity, n,
+        std::forward<Fn>(loopCallback),
+        std::forward<Rn>(reductionCallback),
+        /* grainSize = */ 1);
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // WORK_REDUCE_H
@@ -0,0 +1,137 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef WORK_SCAN_H
+#define WORK_SCAN_H
+
+/// \file work/scan.h
+#include "pxr/pxr.h"
+#include "pxr/base/work/threadLimits.h"
+#include "pxr/base/work/api.h"
+
+#include <tbb/tbb.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+// Body for tbb::parallel_scan.  This cannot be a local class like the loop
+// bodies in loops.h, because parallel_scan requires a member template
+// operator() to distinguish the pre-scan and final-scan passes.
+template <typename V, typename Fn, typename Rn>
+class Work_ParallelScanN_TBB
+{
+public:
+    Work_ParallelScanN_TBB(const V &identity, Fn &fn, Rn &rn)
+        : _sum(identity)
+        , _identity(identity)
+        , _fn(fn)
+        , _rn(rn) { }
+
+    // Splitting constructor required by parallel_scan; the new body starts
+    // accumulating from identity.
+    Work_ParallelScanN_TBB(Work_ParallelScanN_TBB &other, tbb::split)
+        : _sum(other._identity)
+        , _identity(other._identity)
+        , _fn(other._fn)
+        , _rn(other._rn) { }
+
+    template <typename Tag>
+    void operator()(const tbb::blocked_range<size_t> &r, Tag) {
+        _sum = std::forward<Fn>(_fn)(
+            r.begin(), r.end(), _sum, Tag::is_final_scan());
+    }
+
+    void reverse_join(Work_ParallelScanN_TBB &other) {
+        _sum = std::forward<Rn>(_rn)(other._sum, _sum);
+    }
+
+    void assign(Work_ParallelScanN_TBB &other) {
+        _sum = other._sum;
+    }
+
+    const V &GetSum() const {
+        return _sum;
+    }
+
+private:
+    V _sum;
+    const V &_identity;
+    Fn &_fn;
+    Rn &_rn;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+///
+/// WorkParallelScanN(identity, n, scanCallback, reductionCallback)
+///
+/// Runs a parallel prefix scan (running reduction) over the range 0 to n
+/// and returns the total.  \p identity is the value an accumulation starts
+/// from.
+///
+/// Scan callback must be of the form:
+///
+///     V ScanCallback(size_t begin, size_t end, V sum, bool isFinalScan);
+///
+/// and must accumulate the elements in [begin, end) onto \p sum and return
+/// the result.  When \p isFinalScan is true, \p sum is the exact running
+/// total over [0, begin) and the callback should also record each element's
+/// prefix result (e.g. write running offsets into an output array).  When
+/// it is false the callback is computing a lookahead subtotal and must only
+/// accumulate.  The callback may run twice over a given subrange, once each
+/// way.
+///
+/// Reduction callback must be of the form:
+///
+///     V ReductionCallback(V lhs, V rhs);
+///
+/// and must combine two accumulated values into one.  The scan computes
+/// prefixes in range order, but subranges are processed concurrently, so
+/// the reduction must be associative and the callbacks must not rely on
+/// shared state.
+///
+template <typename Fn, typename Rn, typename V>
+V
+WorkParallelScanN(
+    const V &identity,
+    size_t n,
+    Fn &&scanCallback,
+    Rn &&reductionCallback)
+{
+    if (n == 0)
+        return identity;
+
+    // Don't bother with parallel_scan, if concurrency is limited to 1.
+    if (WorkGetConcurrencyLimit() > 1) {
+        Work_ParallelScanN_TBB<V, Fn, Rn> body(
+            identity, scanCallback, reductionCallback);
+        tbb::parallel_scan(tbb::blocked_range<size_t>(0, n), body);
+        return body.GetSum();
+    }
+
+    // If concurrency is limited to 1, execute serially.
+    return std::forward<Fn>(scanCallback)(
+        0, n, identity, /* isFinalScan = */ true);
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // WORK_SCAN_H
@@ -0,0 +1,124 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/base/work/taskGraph.h"
+
+#include "pxr/base/tf/diagnostic.h"
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+WorkTaskGraph::WorkTaskGraph()
+    : _numCompleted(0)
+    , _running(false)
+{
+}
+
+WorkTaskGraph::~WorkTaskGraph()
+{
+    Wait();
+}
+
+WorkTaskGraph::TaskId
+WorkTaskGraph::_AddTask(std::function<void ()> &&fn)
+{
+    if (_running) {
+        TF_CODING_ERROR("Cannot add tasks to a task graph that has been run");
+        return 0;
+    }
+    _tasks.push_back(std::unique_ptr<_Task>(new _Task(std::move(fn))));
+    return _tasks.size() - 1;
+}
+
+void
+WorkTaskGraph::AddDependency(TaskId task, TaskId dependsOn)
+{
+    if (_running) {
+        TF_CODING_ERROR("Cannot add dependencies to a task graph that has "
+                        "been run");
+        return;
+    }
+    if (task >= _tasks.size() || dependsOn >= _tasks.size() ||
+        task == dependsOn) {
+        TF_CODING_ERROR("Invalid task graph dependency %zu -> %zu",
+                        task, dependsOn);
+        return;
+    }
+    _tasks[dependsOn]->successors.push_back(_tasks[task].get());
+    ++_tasks[task]->numUnfinishedDependencies;
+}
+
+void
+WorkTaskGraph::Run()
+{
+    if (_running) {
+        TF_CODING_ERROR("Task graph has already been run");
+        return;
+    }
+    _running = true;
+
+    // Schedule every task with no dependencies; the rest are scheduled by
+    // their predecessors as they complete.
+    for (const auto &task : _tasks) {
+        if (task->numUnfinishedDependencies == 0) {
+            _Task *t = task.get();
+            _dispatcher.Run([this, t]() { _RunTask(t); });
+        }
+    }
+}
+
+void
+WorkTaskGraph::Wait()
+{
+    _dispatcher.Wait();
+    if (_running && _numCompleted != _tasks.size()) {
+        TF_CODING_ERROR("Task graph finished with %zu of %zu tasks not run; "
+                        "the graph contains a cycle or was cancelled",
+                        _tasks.size() - _numCompleted, _tasks.size());
+    }
+}
+
+void
+WorkTaskGraph::Cancel()
+{
+    _dispatcher.Cancel();
+}
+
+void
+WorkTaskGraph::_RunTask(_Task *task)
+{
+    task->fn();
+    ++_numCompleted;
+
+    // Schedule each successor whose last outstanding dependency this task
+    // was.  The decrement synchronizes with the other predecessors, so
+    // exactly one of them schedules the successor.
+    for (_Task *successor : task->successors) {
+        if (--successor->numUnfinishedDependencies == 0) {
+            _dispatcher.Run([this, successor]() { _RunTask(successor); });
+        }
+    }
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,141 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef WORK_TASKGRAPH_H
+#define WORK_TASKGRAPH_H
+
+/// \file work/taskGraph.h
+
+#include "pxr/pxr.h"
+#include "pxr/base/work/dispatcher.h"
+#include "pxr/base/work/api.h"
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class WorkTaskGraph
+///
+/// A task graph runs a set of tasks with declared dependencies between
+/// them.  Each task becomes runnable as soon as all of its predecessors
+/// have completed, so independent chains of work overlap without the full
+/// barriers that phased scheduling imposes.
+///
+/// Typical use is to add the tasks, declare the edges, then invoke Run()
+/// and Wait():
+///
+/// \code
+/// WorkTaskGraph graph;
+/// WorkTaskGraph::TaskId load = graph.AddTask(LoadLayer);
+/// WorkTaskGraph::TaskId index = graph.AddTask(BuildIndex);
+/// WorkTaskGraph::TaskId flatten = graph.AddTask(Flatten);
+/// graph.AddDependency(index, load);      // index runs after load
+/// graph.AddDependency(flatten, index);
+/// graph.Run();
+/// graph.Wait();
+/// \endcode
+///
+/// AddTask() and AddDependency() build the graph and must not be called
+/// concurrently or after Run().  The graph must be acyclic; tasks on a
+/// cycle can never become runnable and Wait() reports them as a coding
+/// error.  A graph is single-shot: to run the work again, build a new
+/// graph.
+///
+/// Tasks are scheduled through a WorkDispatcher, so errors raised inside
+/// tasks are transported back to the thread that calls Wait(), and
+/// Cancel() behaves as it does there.
+///
+class WorkTaskGraph
+{
+public:
+    /// Identifies a task within this graph.
+    typedef size_t TaskId;
+
+    /// Construct an empty task graph.
+    WORK_API WorkTaskGraph();
+
+    /// Wait() for any running tasks to complete, then destroy the graph.
+    WORK_API ~WorkTaskGraph();
+
+    WorkTaskGraph(WorkTaskGraph const &) = delete;
+    WorkTaskGraph &operator=(WorkTaskGraph const &) = delete;
+
+    /// Add a task to the graph and return its id.  The task will not start
+    /// until Run() is called and all of its dependencies have completed.
+    template <class Callable>
+    TaskId AddTask(Callable &&c) {
+        return _AddTask(std::function<void ()>(std::forward<Callable>(c)));
+    }
+
+    /// Declare that \p task must not start until \p dependsOn has
+    /// completed.  Both ids must have been returned by AddTask() on this
+    /// graph.
+    WORK_API void AddDependency(TaskId task, TaskId dependsOn);
+
+    /// Start running the graph.  Tasks with no outstanding dependencies
+    /// are scheduled immediately; the rest are scheduled as their
+    /// predecessors complete.  This function does not block.
+    WORK_API void Run();
+
+    /// Block until all tasks started by Run() complete.  If the graph
+    /// contains a cycle, the tasks on it never run; this is reported as a
+    /// coding error.
+    WORK_API void Wait();
+
+    /// Cancel remaining work and return immediately.  This call does not
+    /// block; call Wait() after Cancel() to wait for pending tasks to
+    /// complete.
+    WORK_API void Cancel();
+
+private:
+    struct _Task {
+        explicit _Task(std::function<void ()> &&fn)
+            : fn(std::move(fn))
+            , numUnfinishedDependencies(0) { }
+
+        std::function<void ()> fn;
+        std::atomic<int> numUnfinishedDependencies;
+        std::vector<_Task *> successors;
+    };
+
+    WORK_API TaskId _AddTask(std::function<void ()> &&fn);
+
+    // Run a task's function, then schedule any successors whose last
+    // dependency this task was.
+    void _RunTask(_Task *task);
+
+    std::vector<std::unique_ptr<_Task>> _tasks;
+    std::atomic<size_t> _numCompleted;
+    bool _running;
+    WorkDispatcher _dispatcher;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // WORK_TASKGRAPH_H
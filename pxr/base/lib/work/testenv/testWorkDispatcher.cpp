@@ -411,6 +411,14 @@ _TestDispatcherCancellation(Graph *graph)
     return graph->GetNumNodesRun() == numNodesPerLevel * numLevels;
 }
 
+// Helper to default-construct an arena dispatcher in a given priority
+// tier, so that it can be passed through the test templates above.
+template <WorkPriority priority>
+struct _TieredArenaDispatcher : public WorkArenaDispatcher
+{
+    _TieredArenaDispatcher() : WorkArenaDispatcher(priority) {}
+};
+
 int
 main(int argc, char **argv)
 {
@@ -454,6 +462,27 @@ main(int argc, char **argv)
         }
     }
 
+    // Test the arena dispatcher's priority tiers.  The tier only
+    // affects scheduling, so the graph must still run to completion
+    // in every tier.
+    {
+        std::cout << "Using the interactive-tier arena dispatcher"
+                  << std::endl;
+        if (!_TestDispatcher<
+                _TieredArenaDispatcher<WorkPriorityInteractive> >(
+                    graph.get())) {
+            return 1;
+        }
+
+        std::cout << "Using the background-tier arena dispatcher"
+                  << std::endl;
+        if (!_TestDispatcher<
+                _TieredArenaDispatcher<WorkPriorityBackground> >(
+                    graph.get())) {
+            return 1;
+        }
+    }
+
     return 0;
 
 }
@@ -0,0 +1,118 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/base/work/future.h"
+
+#include "pxr/base/tf/diagnostic.h"
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+static std::string
+_MakeGreeting(std::string const &name)
+{
+    return "hello, " + name;
+}
+
+static void
+_TestBasic()
+{
+    WorkFuture<std::string> future = WorkAsync(_MakeGreeting,
+                                               std::string("world"));
+    TF_AXIOM(future.IsValid());
+    TF_AXIOM(future.Get() == "hello, world");
+    TF_AXIOM(future.IsReady());
+
+    // Copies see the same result.
+    WorkFuture<std::string> copy = future;
+    TF_AXIOM(copy.Get() == "hello, world");
+
+    // A default-constructed future is invalid.
+    WorkFuture<int> invalid;
+    TF_AXIOM(!invalid.IsValid() && !invalid.IsReady());
+}
+
+static void
+_TestContinuations()
+{
+    // Chain value-producing stages.
+    WorkFuture<size_t> length =
+        WorkAsync(_MakeGreeting, std::string("futures"))
+            .Then([](std::string const &s) { return s.size(); });
+    TF_AXIOM(length.Get() == strlen("hello, futures"));
+
+    // Continuation attached after completion runs immediately.
+    WorkFuture<size_t> doubled =
+        length.Then([](size_t n) { return 2 * n; });
+    TF_AXIOM(doubled.IsReady());
+    TF_AXIOM(doubled.Get() == 2 * length.Get());
+
+    // Multiple continuations on one future all run.
+    std::atomic<int> ran(0);
+    WorkFuture<int> shared = WorkAsync([]() { return 7; });
+    WorkFuture<void> a = shared.Then([&ran](int v) { ran += v; });
+    WorkFuture<void> b = shared.Then([&ran](int v) { ran += v; });
+    a.Get();
+    b.Get();
+    TF_AXIOM(ran == 14);
+}
+
+static void
+_TestVoid()
+{
+    // void futures signal completion and chain to value stages.
+    std::atomic<bool> flag(false);
+    WorkFuture<int> result =
+        WorkAsync([&flag]() { flag = true; })
+            .Then([&flag]() { return flag ? 1 : 0; });
+    TF_AXIOM(result.Get() == 1);
+    TF_AXIOM(flag);
+}
+
+static void
+_TestManyTasks()
+{
+    const size_t numTasks = 256;
+    std::vector<WorkFuture<size_t>> futures;
+    for (size_t i = 0; i < numTasks; ++i) {
+        futures.push_back(WorkAsync([i]() { return i * i; }));
+    }
+    for (size_t i = 0; i < numTasks; ++i) {
+        TF_AXIOM(futures[i].Get() == i * i);
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+    _TestBasic();
+    _TestContinuations();
+    _TestVoid();
+    _TestManyTasks();
+    return 0;
+}
@@ -0,0 +1,136 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/base/work/reduce.h"
+#include "pxr/base/work/scan.h"
+
+#include "pxr/base/work/threadLimits.h"
+#include "pxr/base/tf/diagnostic.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+static void
+_TestReduce(size_t arraySize)
+{
+    std::vector<int> v(arraySize);
+    for (size_t i = 0; i < arraySize; ++i) {
+        v[i] = static_cast<int>(i % 97) - 48;
+    }
+
+    // Sum.
+    int64_t expectedSum = 0;
+    for (int i : v) {
+        expectedSum += i;
+    }
+    const int64_t sum = WorkParallelReduceN(
+        int64_t(0), arraySize,
+        [&v](size_t begin, size_t end, int64_t value) {
+            for (size_t i = begin; i != end; ++i) {
+                value += v[i];
+            }
+            return value;
+        },
+        [](int64_t lhs, int64_t rhs) {
+            return lhs + rhs;
+        });
+    TF_AXIOM(sum == expectedSum);
+
+    // Max, with an explicit grain size.
+    const int expectedMax =
+        arraySize ? *std::max_element(v.begin(), v.end()) : -1000;
+    const int maxValue = WorkParallelReduceN(
+        -1000, arraySize,
+        [&v](size_t begin, size_t end, int value) {
+            for (size_t i = begin; i != end; ++i) {
+                value = std::max(value, v[i]);
+            }
+            return value;
+        },
+        [](int lhs, int rhs) {
+            return std::max(lhs, rhs);
+        },
+        /* grainSize = */ 100);
+    TF_AXIOM(maxValue == expectedMax);
+}
+
+static void
+_TestScan(size_t arraySize)
+{
+    std::vector<int> v(arraySize);
+    for (size_t i = 0; i < arraySize; ++i) {
+        v[i] = static_cast<int>(i % 13) + 1;
+    }
+
+    // Exclusive prefix sum: offsets[i] is the sum of v[0..i).
+    std::vector<int64_t> offsets(arraySize);
+    const int64_t total = WorkParallelScanN(
+        int64_t(0), arraySize,
+        [&v, &offsets](size_t begin, size_t end, int64_t sum,
+                       bool isFinalScan) {
+            for (size_t i = begin; i != end; ++i) {
+                if (isFinalScan) {
+                    offsets[i] = sum;
+                }
+                sum += v[i];
+            }
+            return sum;
+        },
+        [](int64_t lhs, int64_t rhs) {
+            return lhs + rhs;
+        });
+
+    int64_t expected = 0;
+    for (size_t i = 0; i < arraySize; ++i) {
+        TF_AXIOM(offsets[i] == expected);
+        expected += v[i];
+    }
+    TF_AXIOM(total == expected);
+}
+
+int
+main(int argc, char **argv)
+{
+    const size_t sizes[] = { 0, 1, 2, 1000, 1000000 };
+
+    // Test with full concurrency and then again with concurrency limited
+    // to 1, which takes the serial paths.
+    WorkSetMaximumConcurrencyLimit();
+    for (size_t n : sizes) {
+        _TestReduce(n);
+        _TestScan(n);
+    }
+
+    WorkSetConcurrencyLimit(1);
+    for (size_t n : sizes) {
+        _TestReduce(n);
+        _TestScan(n);
+    }
+
+    return 0;
+}
@@ -0,0 +1,129 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/base/work/taskGraph.h"
+
+#include "pxr/base/tf/diagnostic.h"
+
+#include <atomic>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+// Every task records the order in which it completed; an edge is satisfied
+// if the predecessor completed before the successor did, since a successor
+// cannot even start until all of its predecessors are done.
+static void
+_TestDag(size_t numTasks)
+{
+    std::atomic<size_t> clock(0);
+    std::vector<size_t> stamp(numTasks, 0);
+
+    WorkTaskGraph graph;
+    std::vector<WorkTaskGraph::TaskId> ids;
+    for (size_t i = 0; i < numTasks; ++i) {
+        ids.push_back(graph.AddTask([&clock, &stamp, i]() {
+            stamp[i] = ++clock;
+        }));
+    }
+
+    // Layered dependencies: each task depends on a few tasks from earlier
+    // in the build order, giving a wide, deep dag.
+    std::vector<std::pair<size_t, size_t>> edges;
+    for (size_t i = 1; i < numTasks; ++i) {
+        for (size_t k = 1; k <= 3 && k <= i; k *= 2) {
+            graph.AddDependency(ids[i], ids[i - k]);
+            edges.push_back(std::make_pair(i - k, i));
+        }
+    }
+
+    graph.Run();
+    graph.Wait();
+
+    TF_AXIOM(clock == numTasks);
+    for (const auto &edge : edges) {
+        TF_AXIOM(stamp[edge.first] < stamp[edge.second]);
+    }
+}
+
+static void
+_TestDiamond()
+{
+    std::atomic<int> value(0);
+    int afterLeft = 0, afterRight = 0, final = 0;
+
+    WorkTaskGraph graph;
+    WorkTaskGraph::TaskId top = graph.AddTask([&value]() { value = 1; });
+    WorkTaskGraph::TaskId left = graph.AddTask(
+        [&value, &afterLeft]() { afterLeft = ++value; });
+    WorkTaskGraph::TaskId right = graph.AddTask(
+        [&value, &afterRight]() { afterRight = ++value; });
+    WorkTaskGraph::TaskId bottom = graph.AddTask(
+        [&value, &final]() { final = value; });
+    graph.AddDependency(left, top);
+    graph.AddDependency(right, top);
+    graph.AddDependency(bottom, left);
+    graph.AddDependency(bottom, right);
+
+    graph.Run();
+    graph.Wait();
+
+    // Both branches saw the top task's write and the bottom task saw both
+    // increments.
+    TF_AXIOM(afterLeft >= 2 && afterRight >= 2);
+    TF_AXIOM(final == 3);
+}
+
+static void
+_TestIndependent(size_t numTasks)
+{
+    std::atomic<size_t> count(0);
+
+    WorkTaskGraph graph;
+    for (size_t i = 0; i < numTasks; ++i) {
+        graph.AddTask([&count]() { ++count; });
+    }
+    graph.Run();
+    graph.Wait();
+
+    TF_AXIOM(count == numTasks);
+}
+
+int
+main(int argc, char **argv)
+{
+    _TestDiamond();
+    _TestIndependent(1000);
+    _TestDag(1);
+    _TestDag(2);
+    _TestDag(1000);
+
+    // An empty graph runs trivially.
+    WorkTaskGraph empty;
+    empty.Run();
+    empty.Wait();
+
+    return 0;
+}
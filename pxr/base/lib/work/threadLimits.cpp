@@ -27,10 +27,12 @@
 #include "pxr/pxr.h"
 #include "pxr/base/work/threadLimits.h"
 
+#include "pxr/base/arch/numa.h"
 #include "pxr/base/tf/envSetting.h"
 
 #include <tbb/atomic.h>
 #include <tbb/task_scheduler_init.h>
+#include <tbb/task_scheduler_observer.h>
 
 #include <algorithm>
 
@@ -55,6 +57,15 @@ TF_DEFINE_ENV_SETTING(
     "the environment variable (if set to a non-zero value) will override any "
     "value passed to Work thread-limiting API calls.");
 
+TF_DEFINE_ENV_SETTING(
+    PXR_WORK_NUMA_PINNING, false,
+    "On machines with more than one NUMA node, pin TBB worker threads "
+    "round-robin to NUMA nodes as they join the scheduler. This keeps each "
+    "worker on one socket, so with the usual first-touch policy its "
+    "allocations stay node-local instead of bouncing across sockets. Off by "
+    "default since pinning can hurt on machines shared with other "
+    "CPU-intensive processes.");
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 // This is Work's notion of the currently requested thread limit.  Due to TBB's
@@ -69,6 +80,33 @@ static tbb::atomic<unsigned> _threadLimit;
 // PXR_WORK_THREAD_LIMIT is set to a nonzero value.  Otherwise this stays NULL.
 static tbb::task_scheduler_init *_tbbTaskSchedInit;
 
+// When PXR_WORK_NUMA_PINNING is enabled, this observer pins each TBB worker
+// thread to a NUMA node as it joins the scheduler, distributing workers
+// round-robin across the nodes.  Application threads are left alone.
+class Work_NumaPinningObserver : public tbb::task_scheduler_observer
+{
+public:
+    Work_NumaPinningObserver()
+        : _numNodes(ArchGetNumaNodeCount()) {
+        _nextNode = 0;
+    }
+
+    virtual void on_scheduler_entry(bool isWorker) {
+        if (isWorker) {
+            ArchBindThreadToNumaNode(_nextNode.fetch_and_increment()
+                                     % _numNodes);
+        }
+    }
+
+private:
+    int _numNodes;
+    tbb::atomic<int> _nextNode;
+};
+
+// Non-NULL iff NUMA pinning is enabled.  Never deleted; the observer must
+// outlive every worker thread.
+static Work_NumaPinningObserver *_numaPinningObserver;
+
 unsigned
 WorkGetPhysicalConcurrencyLimit()
 {
@@ -130,6 +168,13 @@ Work_InitializeThreading()
     // as a plugin to another application.)
     if (settingVal)
         _tbbTaskSchedInit = new tbb::task_scheduler_init(_threadLimit);
+
+    // Install the NUMA pinning observer if requested and the machine
+    // actually has more than one node.
+    if (TfGetEnvSetting(PXR_WORK_NUMA_PINNING) && ArchGetNumaNodeCount() > 1) {
+        _numaPinningObserver = new Work_NumaPinningObserver;
+        _numaPinningObserver->observe(true);
+    }
 }
 static int _forceInitialization = (Work_InitializeThreading(), 0);
 
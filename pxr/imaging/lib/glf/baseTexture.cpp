@@ -33,10 +33,24 @@
 #include "pxr/base/tf/registryManager.h"
 #include "pxr/base/tf/type.h"
 #include "pxr/base/tracelite/trace.h"
+#include "pxr/base/work/dispatcher.h"
 
 PXR_NAMESPACE_OPEN_SCOPE
 
 
+// Holds everything needed to finish creating the GL texture once the
+// background decode of the texture data has completed.
+struct GlfBaseTexture::_PendingData {
+    WorkDispatcher dispatcher;
+    GlfBaseTextureDataRefPtr texData;
+    bool useMipmaps;
+    int unpackCropTop;
+    int unpackCropBottom;
+    int unpackCropLeft;
+    int unpackCropRight;
+};
+
+
 TF_REGISTRY_FUNCTION(TfType)
 {
     TfType::Define<GlfBaseTexture, TfType::Bases<GlfTexture> >();
@@ -67,6 +81,9 @@ GlfBaseTexture::GlfBaseTexture()
 
 GlfBaseTexture::~GlfBaseTexture()
 {
+    // Wait for a decode that never got consumed; its result is discarded.
+    _pendingData.reset();
+
     GlfSharedGLContextScopeHolder sharedGLContextScopeHolder;
 
     if (glIsTexture(_textureName)) {
@@ -79,6 +96,8 @@ GlfTexture::BindingVector
 GlfBaseTexture::GetBindings(TfToken const & identifier,
                              GLuint samplerName) const
 {
+    _CreatePendingTexture();
+
     return BindingVector(1,
                 Binding(identifier, GlfTextureTokens->texels,
                         GL_TEXTURE_2D, _textureName, samplerName));
@@ -87,6 +106,8 @@ GlfBaseTexture::GetBindings(TfToken const & identifier,
 VtDictionary
 GlfBaseTexture::GetTextureInfo() const
 {
+    _CreatePendingTexture();
+
     VtDictionary info;
     info["memoryUsed"] = GetMemoryUsed();
     info["width"] = _currentWidth;
@@ -258,5 +279,50 @@ GlfBaseTexture::_CreateTexture(GlfBaseTextureDataConstPtr texData,
     }
 }
 
+void
+GlfBaseTexture::_ReadTextureAsync(GlfBaseTextureDataRefPtr texData,
+                bool const useMipmaps,
+                int const unpackCropTop,
+                int const unpackCropBottom,
+                int const unpackCropLeft,
+                int const unpackCropRight)
+{
+    TRACE_FUNCTION();
+
+    _pendingData.reset(new _PendingData);
+    _pendingData->texData = texData;
+    _pendingData->useMipmaps = useMipmaps;
+    _pendingData->unpackCropTop = unpackCropTop;
+    _pendingData->unpackCropBottom = unpackCropBottom;
+    _pendingData->unpackCropLeft = unpackCropLeft;
+    _pendingData->unpackCropRight = unpackCropRight;
+
+    // The decode only touches texData, so it can run off the GL thread.
+    _pendingData->dispatcher.Run([texData, useMipmaps]() {
+        texData->Read(0, useMipmaps);
+    });
+}
+
+void
+GlfBaseTexture::_CreatePendingTexture() const
+{
+    if (!_pendingData) {
+        return;
+    }
+
+    // Take ownership of the pending state up front, so the texture is
+    // finalized exactly once even if the decode produced no data.
+    std::unique_ptr<_PendingData> pending;
+    pending.swap(_pendingData);
+
+    pending->dispatcher.Wait();
+
+    GlfBaseTexture *self = const_cast<GlfBaseTexture *>(this);
+    self->_UpdateTexture(pending->texData);
+    self->_CreateTexture(pending->texData, pending->useMipmaps,
+                         pending->unpackCropTop, pending->unpackCropBottom,
+                         pending->unpackCropLeft, pending->unpackCropRight);
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
 
@@ -36,6 +36,7 @@
 
 #include "pxr/imaging/garch/gl.h"
 
+#include <memory>
 #include <string>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -53,20 +54,24 @@ public:
     GLF_API
     virtual ~GlfBaseTexture();
 
-    /// Returns the OpenGl texture name for the texture. 
+    /// Returns the OpenGl texture name for the texture.
     GLuint GetGlTextureName() const {
+        _CreatePendingTexture();
         return _textureName;
     }
 
     int	GetWidth() const {
+        _CreatePendingTexture();
         return _currentWidth;
     }
 
     int GetHeight() const {
+        _CreatePendingTexture();
         return _currentHeight;
     }
 
     int GetFormat() const {
+        _CreatePendingTexture();
         return _format;
     }
 
@@ -92,11 +97,31 @@ protected:
                         int const unpackCropLeft = 0,
                         int const unpackCropRight = 0);
 
+    /// Kicks a background decode of \p texData. The GL texture is filled
+    /// in from the result the first time this texture is used on the GL
+    /// thread, so decodes of textures requested in a batch overlap.
+    GLF_API
+    void _ReadTextureAsync(GlfBaseTextureDataRefPtr texData,
+                           bool const useMipmaps,
+                           int const unpackCropTop = 0,
+                           int const unpackCropBottom = 0,
+                           int const unpackCropLeft = 0,
+                           int const unpackCropRight = 0);
+
+    /// Waits for a pending background decode, if any, and uploads the
+    /// result. Must be called with a current GL context.
+    GLF_API
+    void _CreatePendingTexture() const;
+
 private:
 
     // GL texture object
     const GLuint _textureName;
 
+    // In-flight background decode, consumed by _CreatePendingTexture.
+    struct _PendingData;
+    mutable std::unique_ptr<_PendingData> _pendingData;
+
     // required for stats/tracking
     int     _currentWidth, _currentHeight;
     int     _format;
@@ -25,6 +25,7 @@
 #include "pxr/imaging/glf/glslfxConfig.h"
 #include "pxr/imaging/glf/debugCodes.h"
 
+#include "pxr/base/arch/fileSystem.h"
 #include "pxr/base/plug/plugin.h"
 #include "pxr/base/plug/registry.h"
 #include "pxr/base/tf/diagnostic.h"
@@ -40,6 +41,7 @@
 #include <iostream>
 #include <istream>
 #include <fstream>
+#include <mutex>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -222,6 +224,58 @@ GlfGLSLFX::GlfGLSLFX(istream &is) :
     }
 }
 
+// Collect the modification times of a set of files; returns false if any
+// of the files cannot be statted.
+static bool
+_GetFileMtimes(std::set<std::string> const & files,
+               std::map<std::string, double> *mtimes)
+{
+    for (std::string const& file : files) {
+        double mtime = 0;
+        if (!ArchGetModificationTime(file.c_str(), &mtime)) {
+            return false;
+        }
+        (*mtimes)[file] = mtime;
+    }
+    return true;
+}
+
+namespace {
+struct _CachedGLSLFX {
+    std::map<std::string, double> mtimes;
+    GlfGLSLFXSharedPtr glslfx;
+};
+}
+
+/* static */
+GlfGLSLFXSharedPtr
+GlfGLSLFX::GetShared(std::string const & filePath)
+{
+    typedef std::map<std::string, _CachedGLSLFX> _Cache;
+    static std::mutex cacheMutex;
+    static _Cache cache;
+
+    std::lock_guard<std::mutex> lock(cacheMutex);
+
+    _Cache::iterator it = cache.find(filePath);
+    if (it != cache.end()) {
+        // reuse the cached document only if neither the file nor any of
+        // the files it imported has been modified since it was parsed.
+        std::map<std::string, double> mtimes;
+        if (_GetFileMtimes(it->second.glslfx->GetFiles(), &mtimes) &&
+            mtimes == it->second.mtimes) {
+            return it->second.glslfx;
+        }
+    }
+
+    _CachedGLSLFX entry;
+    entry.glslfx.reset(new GlfGLSLFX(filePath));
+    _GetFileMtimes(entry.glslfx->GetFiles(), &entry.mtimes);
+    cache[filePath] = entry;
+
+    return entry.glslfx;
+}
+
 bool
 GlfGLSLFX::IsValid(std::string *reason) const
 {
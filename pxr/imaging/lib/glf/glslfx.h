@@ -33,6 +33,7 @@
 #include "pxr/base/tf/token.h"
 
 #include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
 
 #include <string>
 #include <vector>
@@ -42,6 +43,9 @@
 PXR_NAMESPACE_OPEN_SCOPE
 
 
+typedef boost::shared_ptr<class GlfGLSLFX> GlfGLSLFXSharedPtr;
+
+
 /// \class GlfGLSLFX
 ///
 /// A class representing the config and shader source of a glslfx file.
@@ -132,6 +136,15 @@ public:
     GLF_API
     GlfGLSLFX(std::istream &is);
 
+    /// Return a shared glslfx object for \p filePath. Parsed documents
+    /// are interned in a process-wide registry keyed by path and the
+    /// modification times of every file processed (including imports),
+    /// so repeated requests for an unchanged file do not re-parse it.
+    /// The returned object is shared; callers must not hold it across
+    /// an expected file change they want to pick up.
+    GLF_API
+    static GlfGLSLFXSharedPtr GetShared(std::string const & filePath);
+
     /// Return the parameters specified in the configuration
     GLF_API
     GlfGLSLFXConfig::Parameters GetParameters() const;
@@ -84,6 +84,11 @@ public:
     /// {@
 
     /// Opens \a filename for reading from the given \a subimage.
+    ///
+    /// The index addresses down-sampled versions of the image; readers
+    /// resolve it to a subimage or to a mip level depending on how the
+    /// file stores its mip chain, and only decode data for the selected
+    /// level.
     GLF_API
     static GlfImageSharedPtr OpenForReading(std::string const & filename,
                                             int subimage = 0);
@@ -92,6 +97,9 @@ public:
     virtual bool Read(StorageSpec const & storage) = 0;
 
     /// Reads the cropped sub-image into \a storage.
+    ///
+    /// Readers only decode the tiles or scanlines covering the requested
+    /// region when no resampling is required.
     virtual bool ReadCropped(int const cropTop,
                              int const cropBottom,
                              int const cropLeft,
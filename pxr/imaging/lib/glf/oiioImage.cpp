@@ -31,6 +31,7 @@
 
 #include "pxr/base/arch/pragmas.h"
 #include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/tf/envSetting.h"
 #include "pxr/base/tf/stringUtils.h"
 #include "pxr/base/tf/type.h"
 
@@ -38,6 +39,7 @@ ARCH_PRAGMA_PUSH
 ARCH_PRAGMA_MACRO_REDEFINITION // due to Python copysign
 #include <OpenImageIO/imagebuf.h>
 #include <OpenImageIO/imagebufalgo.h>
+#include <OpenImageIO/imagecache.h>
 #include <OpenImageIO/imageio.h>
 #include <OpenImageIO/typedesc.h>
 ARCH_PRAGMA_POP
@@ -47,6 +49,30 @@ PXR_NAMESPACE_OPEN_SCOPE
 
 OIIO_NAMESPACE_USING
 
+TF_DEFINE_ENV_SETTING(GLF_IMAGE_CACHE_MEMORY_MB, 512,
+    "Memory budget in megabytes for the process-wide cache of decoded "
+    "image tiles backing OpenImageIO image reads");
+
+// All pixel reads go through a process-wide OpenImageIO image cache so
+// that tiled and mipmapped files are decoded at tile granularity, I/O is
+// shared between images of the same file, and total decoded-tile memory
+// stays within a configurable budget.
+static ImageCache *
+_CreateImageCache()
+{
+    ImageCache *cache = ImageCache::create(/*shared=*/ true);
+    cache->attribute("max_memory_MB",
+        static_cast<float>(TfGetEnvSetting(GLF_IMAGE_CACHE_MEMORY_MB)));
+    return cache;
+}
+
+static ImageCache *
+_GetImageCache()
+{
+    static ImageCache *cache = _CreateImageCache();
+    return cache;
+}
+
 class Glf_OIIOImage : public GlfImage {
 public:
     typedef GlfImage Base;
@@ -86,6 +112,7 @@ protected:
 private:
     std::string _filename;
     int _subimage;
+    int _miplevel;
     ImageBuf _imagebuf;
 };
 
@@ -269,6 +296,7 @@ _SetAttribute(ImageSpec * spec,
 
 Glf_OIIOImage::Glf_OIIOImage()
     : _subimage(0)
+    , _miplevel(0)
 {
 }
 
@@ -383,8 +411,11 @@ Glf_OIIOImage::GetSamplerMetadata(GLenum pname, VtValue * param) const
 int
 Glf_OIIOImage::GetNumMipLevels() const
 {
-    // XXX Add support for mip counting
-    return 1;
+    int nmiplevels = 1;
+    _GetImageCache()->get_image_info(ustring(_filename), _subimage, 0,
+                                     ustring("miplevels"), TypeDesc::INT,
+                                     &nmiplevels);
+    return nmiplevels;
 }
 
 /* virtual */
@@ -392,10 +423,38 @@ bool
 Glf_OIIOImage::_OpenForReading(std::string const & filename, int subimage)
 {
     _filename = filename;
-    _subimage = subimage;
+    _subimage = 0;
+    _miplevel = 0;
     _imagebuf.clear();
-    return _imagebuf.init_spec(_filename, subimage, /*mipmap*/0)
-           && (_imagebuf.nsubimages() > subimage);
+
+    ImageCache *cache = _GetImageCache();
+    ustring name(filename);
+
+    int nsubimages = 0;
+    if (!cache->get_image_info(name, 0, 0, ustring("subimages"),
+                               TypeDesc::INT, &nsubimages)) {
+        return false;
+    }
+
+    // Callers address down-sampled versions of an image by index.  Resolve
+    // the index to a subimage for files that carry them as subimages, or
+    // to a mip level for files that carry a mip chain on a single
+    // subimage, so only the selected level's tiles ever get decoded.
+    if (subimage < nsubimages) {
+        _subimage = subimage;
+    } else if (nsubimages == 1) {
+        int nmiplevels = 1;
+        cache->get_image_info(name, 0, 0, ustring("miplevels"),
+                              TypeDesc::INT, &nmiplevels);
+        if (subimage >= nmiplevels) {
+            return false;
+        }
+        _miplevel = subimage;
+    } else {
+        return false;
+    }
+
+    return _imagebuf.init_spec(_filename, _subimage, _miplevel);
 }
 
 /* virtual */
@@ -413,18 +472,44 @@ Glf_OIIOImage::ReadCropped(int const cropTop,
                            int const cropRight,
                            StorageSpec const & storage)
 {
-    // read from file
+    // When the requested region maps to storage without resampling, stream
+    // just the scanlines or tiles covering it out of the process-wide
+    // image cache; I/O and decode cost are then proportional to the region
+    // rather than to the whole image.
+    {
+        ImageSpec const & spec = _imagebuf.spec();
+        int xbegin = cropLeft;
+        int xend = spec.width - cropRight;
+        int ybegin = cropTop;
+        int yend = spec.height - cropBottom;
+
+        if (xend - xbegin == storage.width &&
+            yend - ybegin == storage.height &&
+            xbegin >= 0 && ybegin >= 0 && xend <= spec.width &&
+            yend <= spec.height) {
+            if (!_GetImageCache()->get_pixels(
+                    ustring(_filename), _subimage, _miplevel,
+                    xbegin, xend, ybegin, yend, 0, 1,
+                    _GetOIIOBaseType(storage.type), storage.data)) {
+                TF_CODING_ERROR("unable to get_pixels");
+                return false;
+            }
+            return true;
+        }
+    }
+
+    // Otherwise fall back to reading the selected level and resampling.
     ImageBuf * image = &_imagebuf;
 
     // Convert double precision images to float
     if (image->spec().format == TypeDesc::DOUBLE) {
-        if (!image->read(_subimage, /*miplevel*/0, /*force*/false,
+        if (!image->read(_subimage, _miplevel, /*force*/false,
                             TypeDesc::FLOAT)) {
             TF_CODING_ERROR("unable to read image (as float)");
             return false;
         }
     } else {
-        if (!image->read(_subimage)) {
+        if (!image->read(_subimage, _miplevel)) {
             TF_CODING_ERROR("unable to read image");
             return false;
         }
@@ -24,6 +24,7 @@
 #include "pxr/imaging/glf/ptexMipmapTextureLoader.h"
 #include "pxr/base/arch/fileSystem.h"
 #include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/work/loops.h"
 
 #include <Ptexture.h>
 #include <vector>
@@ -939,18 +940,22 @@ GlfPtexMipmapTextureLoader::optimizePacking(int maxNumPages,
             _pages[firstslot+1]->IsFull()) ++firstslot;
     }
 
-    // set corner pixel mipmap factors
-    for (BlockArray::iterator it = _blocks.begin(); it != _blocks.end(); ++it) {
-        int face = it->index;
-        uint16_t adjSizeDiffs = 0;
-        for (int edge = 0; edge < 4; ++edge) {
-            int levelDiff = getLevelDiff(face, edge);
-            adjSizeDiffs <<= 4;
-            adjSizeDiffs |= (uint16_t)levelDiff;
-        }
-        it->adjSizeDiffs = adjSizeDiffs;
-        // printf("Block %d, %08x\n", it->index, adjSizeDiffs);
-    }
+    // set corner pixel mipmap factors. each face only reads the packed
+    // block sizes and writes its own adjSizeDiffs, and ptex handles are
+    // safe for concurrent reads, so go wide across faces.
+    WorkParallelForN(_blocks.size(),
+        [this](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                Block &block = _blocks[i];
+                uint16_t adjSizeDiffs = 0;
+                for (int edge = 0; edge < 4; ++edge) {
+                    int levelDiff = getLevelDiff(block.index, edge);
+                    adjSizeDiffs <<= 4;
+                    adjSizeDiffs |= (uint16_t)levelDiff;
+                }
+                block.adjSizeDiffs = adjSizeDiffs;
+            }
+        });
 
 #if 0
     for (size_t i = 0; i < _pages.size(); ++i) {
@@ -984,10 +989,17 @@ GlfPtexMipmapTextureLoader::generateBuffers()
     _memoryUsage = pageStride * numPages;
     memset(_texelBuffer, 0, pageStride * numPages);
 
-    for (int i = 0; i < numPages; ++i) {
-        _pages[i]->Generate(this, _ptex, _texelBuffer + pageStride * i,
-                            _bpp, _pageWidth, _maxLevels);
-    }
+    // each page owns a disjoint slice of the texel buffer and face
+    // reads through the ptex handle are thread-safe, so pages can be
+    // packed concurrently.
+    WorkParallelForN(numPages,
+        [this, pageStride](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                _pages[i]->Generate(this, _ptex,
+                                    _texelBuffer + pageStride * i,
+                                    _bpp, _pageWidth, _maxLevels);
+            }
+        });
 
     // populate the layout texture buffer
     _layoutBuffer = new unsigned char[numFaces * sizeof(uint16_t) * 6];
@@ -30,18 +30,28 @@
 #include "pxr/imaging/glf/textureHandle.h"
 
 #include "pxr/base/arch/fileSystem.h"
+#include "pxr/base/tf/envSetting.h"
 #include "pxr/base/tf/instantiateSingleton.h"
 #include "pxr/base/tf/stl.h"
 
 #include "pxr/base/tracelite/trace.h"
 
+#include <algorithm>
 #include <cstdint>
+#include <utility>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
 
 TF_INSTANTIATE_SINGLETON( GlfTextureRegistry );
 
+TF_DEFINE_ENV_SETTING(GLF_TEXTURE_GC_MEMORY_BUDGET, 0,
+                      "Texture memory high-water mark in megabytes; garbage "
+                      "collection evicts least-recently-used unreferenced "
+                      "textures only while usage exceeds it (0 keeps the "
+                      "evict-all-unreferenced behavior)");
+
 GlfTextureRegistry &
 GlfTextureRegistry::GetInstance() {
     return TfSingleton<GlfTextureRegistry>::GetInstance();
@@ -49,6 +59,7 @@ GlfTextureRegistry::GetInstance() {
 
 GlfTextureRegistry::GlfTextureRegistry() :
     _typeMap(new GlfRankedTypeMap),
+    _accessCounter(0),
     _requiresGarbageCollection(false)
 {
     TfSingleton<GlfTextureRegistry>::SetInstanceConstructed(*this);
@@ -70,11 +81,13 @@ GlfTextureRegistry::GetTextureHandle(const TfToken &texture)
         _textureRegistry.find(texture);
 
     if (it != _textureRegistry.end() && it->second.IsMetadataEqual(md)) {
+        it->second.Touch(++_accessCounter);
         textureHandle = it->second.GetHandle();
     } else {
         // if not exists, create it
         textureHandle = _CreateTexture(texture);
         md.SetHandle(textureHandle);
+        md.Touch(++_accessCounter);
         _textureRegistry[texture] = md;
     }
 
@@ -102,11 +115,13 @@ GlfTextureRegistry::GetTextureHandle(const TfTokenVector &textures)
         _textureRegistry.find(texture);
     
     if (it != _textureRegistry.end() && it->second.IsMetadataEqual(md)) {
+        it->second.Touch(++_accessCounter);
         textureHandle = it->second.GetHandle();
     } else {
         // if not exists, create it
         textureHandle = _CreateTexture(textures, numTextures);
         md.SetHandle(textureHandle);
+        md.Touch(++_accessCounter);
         _textureRegistry[texture] = md;
     }
 
@@ -239,22 +254,52 @@ GlfTextureRegistry::GarbageCollectIfNeeded()
     // enough to avoid unnecessary process.
     if (!_requiresGarbageCollection) return;
 
-    // XXX:
-    // Frequent garbage collection causing slow UI when reading textures.
-    // We're freeing and re-loading textures instead of caching them.
-    // 
-    // Can we only garbage collect when GPU memory is high?  Or have a
-    // least-recently-used queue or something?
     TRACE_FUNCTION();
 
-    std::map<TfToken, _TextureMetadata>::iterator it =
-        _textureRegistry.begin();
-    while (it != _textureRegistry.end()){
-        if ((it->second.GetHandle()->IsUnique()) ) {
-            _textureRegistry.erase(it++);
-            // TextureHandle (and its GlfTexture) will be released here.
-        } else {
-            ++it;
+    // With a memory budget set, unreferenced textures are kept cached and
+    // only evicted, least recently used first, while the total memory used
+    // by the registry exceeds the budget. This avoids freeing and
+    // re-loading textures on every sampler reassignment.
+    static const size_t memoryBudget =
+        static_cast<size_t>(TfGetEnvSetting(GLF_TEXTURE_GC_MEMORY_BUDGET))
+        * 1024 * 1024;
+
+    if (memoryBudget == 0) {
+        std::map<TfToken, _TextureMetadata>::iterator it =
+            _textureRegistry.begin();
+        while (it != _textureRegistry.end()){
+            if ((it->second.GetHandle()->IsUnique()) ) {
+                _textureRegistry.erase(it++);
+                // TextureHandle (and its GlfTexture) will be released here.
+            } else {
+                ++it;
+            }
+        }
+    } else {
+        size_t totalMemory = 0;
+        // (last use, key) pairs of evictable (unreferenced) textures.
+        std::vector<std::pair<size_t, TfToken> > candidates;
+        for (TextureRegistryMap::value_type const& p : _textureRegistry) {
+            totalMemory += p.second.GetHandle()->GetTexture()->GetMemoryUsed();
+            if (p.second.GetHandle()->IsUnique()) {
+                candidates.push_back(
+                    std::make_pair(p.second.GetLastUsed(), p.first));
+            }
+        }
+        std::sort(candidates.begin(), candidates.end());
+
+        for (std::pair<size_t, TfToken> const& candidate : candidates) {
+            if (totalMemory <= memoryBudget) {
+                break;
+            }
+            std::map<TfToken, _TextureMetadata>::iterator it =
+                _textureRegistry.find(candidate.second);
+            if (it != _textureRegistry.end()) {
+                totalMemory -=
+                    it->second.GetHandle()->GetTexture()->GetMemoryUsed();
+                _textureRegistry.erase(it);
+                // TextureHandle (and its GlfTexture) will be released here.
+            }
         }
     }
 
@@ -334,6 +379,7 @@ GlfTextureRegistry::_TextureMetadata::_TextureMetadata(
     : _numTextures(numTextures)
     , _fileSize(0)
     , _mtime(0)
+    , _lastUsed(0)
 {
     TRACE_FUNCTION();
 
@@ -383,5 +429,17 @@ GlfTextureRegistry::_TextureMetadata::SetHandle(
     _handle = handle;
 }
 
+inline void
+GlfTextureRegistry::_TextureMetadata::Touch(std::size_t stamp)
+{
+    _lastUsed = stamp;
+}
+
+inline std::size_t
+GlfTextureRegistry::_TextureMetadata::GetLastUsed() const
+{
+    return _lastUsed;
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
 
@@ -111,6 +111,10 @@ private:
         const GlfTextureHandleRefPtr &GetHandle() const;
         void SetHandle(const GlfTextureHandleRefPtr &handle);
 
+        // Last-use stamp, for least-recently-used eviction.
+        void Touch(std::size_t stamp);
+        std::size_t GetLastUsed() const;
+
     private:
         _TextureMetadata(const TfToken *textures,
                          const std::uint32_t numTextures);
@@ -118,6 +122,7 @@ private:
         std::uint32_t _numTextures;
         off_t _fileSize;
         double _mtime;
+        std::size_t _lastUsed;
         GlfTextureHandleRefPtr _handle;
     };
 
@@ -136,6 +141,9 @@ private:
     // registry for non-shared textures (drawtargets)
     TextureRegistryNonSharedMap _textureRegistryNonShared;
 
+    // bumped on every shared handle access, for LRU eviction.
+    std::size_t _accessCounter;
+
     bool _requiresGarbageCollection;
 };
 
@@ -132,7 +132,9 @@ GlfCheckGLFrameBufferStatus(GLuint target, std::string * reason)
 bool GlfIsCompressedFormat(GLenum format)
 {
     if (format == GL_COMPRESSED_RGBA_BPTC_UNORM || 
-        format == GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT) {
+        format == GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT ||
+        format == GL_COMPRESSED_RGB_S3TC_DXT1_EXT ||
+        format == GL_COMPRESSED_RGBA_S3TC_DXT5_EXT) {
         return true;
     }
     return false;
@@ -144,12 +146,19 @@ size_t GlfGetCompressedTextureSize(int width, int height, GLenum format, GLenum
     int tileSize = 0;
     int alignSize = 0;
     
-    // XXX Only BPTC is supported right now
     if (format == GL_COMPRESSED_RGBA_BPTC_UNORM || 
         format == GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT) {
         blockSize = 16;
         tileSize = 4;
         alignSize = 3;
+    } else if (format == GL_COMPRESSED_RGB_S3TC_DXT1_EXT) {
+        blockSize = 8;
+        tileSize = 4;
+        alignSize = 3;
+    } else if (format == GL_COMPRESSED_RGBA_S3TC_DXT5_EXT) {
+        blockSize = 16;
+        tileSize = 4;
+        alignSize = 3;
     }
 
     size_t numPixels = ((width + alignSize)/tileSize) * 
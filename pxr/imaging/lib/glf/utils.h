@@ -59,13 +59,15 @@ bool GlfCheckGLFrameBufferStatus(GLuint target, std::string * reason);
 /// Check if the format is compressed.
 ///
 /// Supported OGL compressed formats : GL_COMPRESSED_RGBA_BPTC_UNORM, 
-/// GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT
+/// GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT, GL_COMPRESSED_RGB_S3TC_DXT1_EXT,
+/// GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
 bool GlfIsCompressedFormat(GLenum format);
 
 /// Calculate the byte size of compressed textures.
 ///
 /// Supported OGL compressed formats : GL_COMPRESSED_RGBA_BPTC_UNORM, 
-/// GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT
+/// GL_COMPRESSED_RGB_BPTC_UNSIGNED_FLOAT, GL_COMPRESSED_RGB_S3TC_DXT1_EXT,
+/// GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
 size_t GlfGetCompressedTextureSize(int width, int height, GLenum format, GLenum type);
 
 
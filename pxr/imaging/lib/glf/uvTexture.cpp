@@ -31,11 +31,16 @@
 #include "pxr/imaging/glf/uvTexture.h"
 #include "pxr/imaging/glf/uvTextureData.h"
 #include "pxr/imaging/glf/utils.h"
+#include "pxr/base/tf/envSetting.h"
 #include "pxr/base/tf/registryManager.h"
 #include "pxr/base/tf/type.h"
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(GLF_ENABLE_ASYNC_TEXTURE_LOADS, true,
+                      "Decode texture images on background threads and "
+                      "upload them on first use of the texture");
+
 
 // Custom factory to handle UVTexture and ArrayTexture for same types.
 class Glf_UVTextureFactory : public GlfTextureFactoryBase {
@@ -132,11 +137,18 @@ GlfUVTexture::_OnSetMemoryRequested(size_t targetMemory)
         GlfUVTextureData::New(_GetImageFilePath(), targetMemory,
                               _GetCropTop(), _GetCropBottom(),
                               _GetCropLeft(), _GetCropRight());
-    if (texData) {
-        texData->Read(0, _GenerateMipmap());
+
+    static const bool asyncLoads =
+        TfGetEnvSetting(GLF_ENABLE_ASYNC_TEXTURE_LOADS);
+    if (asyncLoads && texData) {
+        _ReadTextureAsync(texData, _GenerateMipmap());
+    } else {
+        if (texData) {
+            texData->Read(0, _GenerateMipmap());
+        }
+        _UpdateTexture(texData);
+        _CreateTexture(texData, _GenerateMipmap());
     }
-    _UpdateTexture(texData);
-    _CreateTexture(texData, _GenerateMipmap());
 }
 
 bool
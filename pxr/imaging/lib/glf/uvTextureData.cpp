@@ -27,11 +27,23 @@
 #include "pxr/imaging/glf/utils.h"
 #include "pxr/imaging/glf/uvTextureData.h"
 
+#include "pxr/base/tf/envSetting.h"
 #include "pxr/base/tf/fileUtils.h"
 #include "pxr/base/tracelite/trace.h"
+#include "pxr/base/work/loops.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <cstdlib>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(GLF_ENABLE_DXT_COMPRESSION, false,
+                      "Transcode uncompressed 8-bit RGB/RGBA textures to "
+                      "S3TC (DXT1/DXT5) blocks on load; lossy, but cuts the "
+                      "GPU memory and upload cost of the texture to a quarter");
+
 
 GlfUVTextureDataRefPtr
 GlfUVTextureData::New(
@@ -77,6 +89,147 @@ GlfUVTextureData::GlfUVTextureData(std::string const &filePath,
     /* nothing */
 }
 
+// Packs an RGB color into RGB565, the endpoint format of S3TC blocks.
+static uint16_t
+_PackColor565(unsigned char r, unsigned char g, unsigned char b)
+{
+    return ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+}
+
+// Fetches a 4x4 block of pixels as RGBA. Reads are clamped at the image
+// edge, so partial blocks at the border repeat their last row/column.
+static void
+_FetchBlock(unsigned char const *src, int width, int height,
+            int numChannels, int blockX, int blockY,
+            unsigned char rgba[16][4])
+{
+    for (int py = 0; py < 4; py++) {
+        const int y = std::min(blockY * 4 + py, height - 1);
+        for (int px = 0; px < 4; px++) {
+            const int x = std::min(blockX * 4 + px, width - 1);
+            unsigned char const *pixel = src + (y * width + x) * numChannels;
+            unsigned char *texel = rgba[py * 4 + px];
+            texel[0] = pixel[0];
+            texel[1] = pixel[1];
+            texel[2] = pixel[2];
+            texel[3] = (numChannels == 4) ? pixel[3] : 255;
+        }
+    }
+}
+
+// Encodes a DXT1 color block (8 bytes). The endpoints are the bounding
+// box of the block's colors and each pixel picks the nearest of the four
+// palette entries.
+static void
+_EncodeColorBlock(unsigned char const rgba[16][4], unsigned char *block)
+{
+    unsigned char minColor[3] = { 255, 255, 255 };
+    unsigned char maxColor[3] = { 0, 0, 0 };
+    for (int i = 0; i < 16; i++) {
+        for (int c = 0; c < 3; c++) {
+            minColor[c] = std::min(minColor[c], rgba[i][c]);
+            maxColor[c] = std::max(maxColor[c], rgba[i][c]);
+        }
+    }
+
+    // c0 > c1 selects the opaque four-color mode; the endpoints are
+    // ordered max/min, so this holds unless the block is a solid color.
+    const uint16_t c0 = _PackColor565(maxColor[0], maxColor[1], maxColor[2]);
+    const uint16_t c1 = _PackColor565(minColor[0], minColor[1], minColor[2]);
+
+    block[0] = c0 & 0xff;
+    block[1] = c0 >> 8;
+    block[2] = c1 & 0xff;
+    block[3] = c1 >> 8;
+
+    if (c0 <= c1) {
+        // Solid color block; every pixel references endpoint 0.
+        block[4] = block[5] = block[6] = block[7] = 0;
+        return;
+    }
+
+    // The four palette entries in decode order: c0, c1, 2/3c0 + 1/3c1,
+    // 1/3c0 + 2/3c1.
+    int palette[4][3];
+    for (int c = 0; c < 3; c++) {
+        palette[0][c] = maxColor[c];
+        palette[1][c] = minColor[c];
+        palette[2][c] = (2 * maxColor[c] + minColor[c]) / 3;
+        palette[3][c] = (maxColor[c] + 2 * minColor[c]) / 3;
+    }
+
+    // Two bits per pixel, four pixels per byte, pixel 0 in the low bits.
+    for (int row = 0; row < 4; row++) {
+        unsigned char bits = 0;
+        for (int col = 0; col < 4; col++) {
+            unsigned char const *texel = rgba[row * 4 + col];
+            int bestIndex = 0;
+            int bestDist = INT_MAX;
+            for (int i = 0; i < 4; i++) {
+                const int dr = texel[0] - palette[i][0];
+                const int dg = texel[1] - palette[i][1];
+                const int db = texel[2] - palette[i][2];
+                const int dist = dr * dr + dg * dg + db * db;
+                if (dist < bestDist) {
+                    bestDist = dist;
+                    bestIndex = i;
+                }
+            }
+            bits |= bestIndex << (col * 2);
+        }
+        block[4 + row] = bits;
+    }
+}
+
+// Encodes a DXT5 alpha block (8 bytes). a0 > a1 selects the mode with
+// eight interpolated alpha values.
+static void
+_EncodeAlphaBlock(unsigned char const rgba[16][4], unsigned char *block)
+{
+    unsigned char minAlpha = 255;
+    unsigned char maxAlpha = 0;
+    for (int i = 0; i < 16; i++) {
+        minAlpha = std::min(minAlpha, rgba[i][3]);
+        maxAlpha = std::max(maxAlpha, rgba[i][3]);
+    }
+
+    block[0] = maxAlpha;
+    block[1] = minAlpha;
+
+    if (maxAlpha <= minAlpha) {
+        // Constant alpha; every pixel references a0.
+        std::fill(block + 2, block + 8, 0);
+        return;
+    }
+
+    // The eight alpha values in decode order: a0, a1, then six evenly
+    // spaced interpolants from a0 down to a1.
+    int palette[8];
+    palette[0] = maxAlpha;
+    palette[1] = minAlpha;
+    for (int i = 2; i < 8; i++) {
+        palette[i] = ((8 - i) * maxAlpha + (i - 1) * minAlpha) / 7;
+    }
+
+    // Three bits per pixel, packed low-bit first into six bytes.
+    uint64_t bits = 0;
+    for (int i = 0; i < 16; i++) {
+        int bestIndex = 0;
+        int bestDist = INT_MAX;
+        for (int j = 0; j < 8; j++) {
+            const int dist = abs(rgba[i][3] - palette[j]);
+            if (dist < bestDist) {
+                bestDist = dist;
+                bestIndex = j;
+            }
+        }
+        bits |= uint64_t(bestIndex) << (i * 3);
+    }
+    for (int i = 0; i < 6; i++) {
+        block[2 + i] = (bits >> (i * 8)) & 0xff;
+    }
+}
+
 // Compute required GPU memory
 size_t
 GlfUVTextureData_ComputeMemory(GlfImageSharedPtr const &img,
@@ -410,9 +563,85 @@ GlfUVTextureData::Read(int degradeLevel, bool generateMipmap)
         }
     }
 
+    // Optionally transcode 8-bit RGB/RGBA images to S3TC blocks. Images
+    // that came off disk already compressed were kept as-is above.
+    static const bool compressOnLoad =
+        TfGetEnvSetting(GLF_ENABLE_DXT_COMPRESSION);
+    if (compressOnLoad && !isCompressed && _glType == GL_UNSIGNED_BYTE &&
+        (_glFormat == GL_RGB || _glFormat == GL_RGBA)) {
+        _CompressRawBuffer();
+    }
+
     return true;
 }
 
+void
+GlfUVTextureData::_CompressRawBuffer()
+{
+    TRACE_FUNCTION();
+
+    const int numChannels = (_glFormat == GL_RGBA) ? 4 : 3;
+    const GLenum compressedFormat = (_glFormat == GL_RGBA)
+                                        ? GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+                                        : GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+    const size_t blockSize = (_glFormat == GL_RGBA) ? 16 : 8;
+
+    // Compute the compressed mip layout.
+    std::vector<Mip> compressedMips(_rawBufferMips.size());
+    size_t compressedSize = 0;
+    for (size_t i = 0; i < _rawBufferMips.size(); i++) {
+        Mip & mip  = compressedMips[i];
+        mip.width  = _rawBufferMips[i].width;
+        mip.height = _rawBufferMips[i].height;
+        mip.size   = GlfGetCompressedTextureSize(mip.width, mip.height,
+                                                 compressedFormat, _glType);
+        mip.offset = compressedSize;
+        compressedSize += mip.size;
+    }
+
+    std::unique_ptr<unsigned char[]> compressedBuffer(
+        new unsigned char[compressedSize]);
+    if (!compressedBuffer) {
+        TF_RUNTIME_ERROR("Unable to allocate memory for the mip levels.");
+        return;
+    }
+
+    // Encode each mip, going wide over rows of 4x4 blocks.
+    for (size_t i = 0; i < _rawBufferMips.size(); i++) {
+        const Mip & mip = compressedMips[i];
+        unsigned char const *src = _rawBuffer.get() +
+                                   _rawBufferMips[i].offset;
+        unsigned char *dst = compressedBuffer.get() + mip.offset;
+        const int numBlocksX = (mip.width + 3) / 4;
+        const int numBlocksY = (mip.height + 3) / 4;
+
+        WorkParallelForN(numBlocksY,
+            [src, dst, &mip, numChannels, numBlocksX, blockSize]
+            (size_t begin, size_t end) {
+                unsigned char rgba[16][4];
+                for (size_t blockY = begin; blockY < end; blockY++) {
+                    unsigned char *row = dst + blockY * numBlocksX * blockSize;
+                    for (int blockX = 0; blockX < numBlocksX; blockX++) {
+                        _FetchBlock(src, mip.width, mip.height, numChannels,
+                                    blockX, (int)blockY, rgba);
+
+                        unsigned char *block = row + blockX * blockSize;
+                        if (numChannels == 4) {
+                            _EncodeAlphaBlock(rgba, block);
+                            block += 8;
+                        }
+                        _EncodeColorBlock(rgba, block);
+                    }
+                }
+            });
+    }
+
+    _rawBuffer = std::move(compressedBuffer);
+    _rawBufferMips.swap(compressedMips);
+    _size = compressedSize;
+    _glFormat = _glInternalFormat = compressedFormat;
+}
+
 size_t 
 GlfUVTextureData::ComputeBytesUsedByMip(int mipLevel) const
 {
@@ -180,11 +180,17 @@ private:
                                                     int startMip, 
                                                     int lastMip);
 
-    // Given a GlfImage it will return the number of mip levels that 
+    // Given a GlfImage it will return the number of mip levels that
     // are actually valid to be loaded to the GPU. For instance, it will
     // drop textures with non valid OpenGL pyramids.
     int _GetNumMipLevelsValid(const GlfImageSharedPtr image) const;
 
+    // Transcodes the raw buffer from 8-bit RGB/RGBA to S3TC blocks
+    // (DXT1/DXT5), replacing the raw buffer, mip layout and formats.
+    // The texture is then uploaded with glCompressedTexImage2D, cutting
+    // the GPU memory and upload cost of the texture.
+    void _CompressRawBuffer();
+
     GlfUVTextureData(std::string const &filePath, Params const &params);
     virtual ~GlfUVTextureData();
         
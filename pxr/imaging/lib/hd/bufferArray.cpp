@@ -25,8 +25,11 @@
 #include "pxr/imaging/hd/bufferArrayRange.h"
 #include "pxr/imaging/hd/debugCodes.h"
 #include "pxr/imaging/hd/perfLog.h"
+#include "pxr/base/arch/hints.h"
 #include "pxr/base/tf/iterator.h"
 
+#include <algorithm>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 
@@ -36,21 +39,79 @@ HdBufferArray::HdBufferArray(TfToken const &role,
                              TfToken const garbageCollectionPerfToken,
                              bool isImmutable)
     : _needsReallocation(false),
-      _rangeList(),
       _rangeCount(0),
-      _rangeListLock(),
-      _role(role), 
+      _role(role),
       _garbageCollectionPerfToken(garbageCollectionPerfToken),
       _version(_uniqueVersion++),   // Atomic
       _maxNumRanges(1),
       _isImmutable(isImmutable)
 {
-    /*NOTHING*/
+    for (size_t i = 0; i < _numBlocks; ++i) {
+        _rangeBlocks[i].store(nullptr, std::memory_order_relaxed);
+    }
 }
 
 HdBufferArray::~HdBufferArray()
 {
-    /*NOTHING*/
+    for (size_t i = 0; i < _numBlocks; ++i) {
+        delete [] _rangeBlocks[i].load(std::memory_order_relaxed);
+    }
+}
+
+/*static*/
+void
+HdBufferArray::_GetBlockLocation(size_t idx, size_t *blockIdx, size_t *offset)
+{
+    // With geometrically doubling blocks, the block index is the
+    // position of the top bit of (idx + firstBlockSize), relative to
+    // the first block's size.
+    size_t pos = idx + ((size_t)1 << _firstBlockSizeLog2);
+    size_t topBit = _firstBlockSizeLog2;
+    while ((pos >> (topBit + 1)) != 0) {
+        ++topBit;
+    }
+    *blockIdx = topBit - _firstBlockSizeLog2;
+    *offset   = pos - ((size_t)1 << topBit);
+}
+
+HdBufferArrayRangePtr *
+HdBufferArray::_GetRangeSlot(size_t idx)
+{
+    size_t blockIdx, offset;
+    _GetBlockLocation(idx, &blockIdx, &offset);
+
+    HdBufferArrayRangePtr *block =
+        _rangeBlocks[blockIdx].load(std::memory_order_acquire);
+    if (ARCH_UNLIKELY(!block)) {
+        HdBufferArrayRangePtr *newBlock =
+            new HdBufferArrayRangePtr[
+                (size_t)1 << (blockIdx + _firstBlockSizeLog2)];
+
+        // Publish the block; on failure another thread won the race
+        // and block holds its pointer instead.
+        if (_rangeBlocks[blockIdx].compare_exchange_strong(
+                block, newBlock,
+                std::memory_order_release,
+                std::memory_order_acquire)) {
+            block = newBlock;
+        } else {
+            delete [] newBlock;
+        }
+    }
+
+    return block + offset;
+}
+
+HdBufferArrayRangePtr *
+HdBufferArray::_GetExistingRangeSlot(size_t idx) const
+{
+    size_t blockIdx, offset;
+    _GetBlockLocation(idx, &blockIdx, &offset);
+
+    HdBufferArrayRangePtr *block =
+        _rangeBlocks[blockIdx].load(std::memory_order_acquire);
+    TF_VERIFY(block);
+    return block + offset;
 }
 
 void
@@ -66,29 +127,25 @@ HdBufferArray::TryAssignRange(HdBufferArrayRangeSharedPtr &range)
     // contiguous, so we only ever need to insert at end.
     size_t allocIdx = _rangeCount++;
 
-    if (allocIdx >= _maxNumRanges) {
-        // Make sure out range count remains clamp at _maxNumRanges.
+    // The chain of blocks can address this many ranges at most.
+    static const size_t maxCapacity =
+        ((size_t)1 << (_numBlocks + _firstBlockSizeLog2)) -
+        ((size_t)1 << _firstBlockSizeLog2);
+    const size_t maxRanges = std::min(_maxNumRanges, maxCapacity);
+
+    if (allocIdx >= maxRanges) {
+        // Make sure out range count remains clamp at maxRanges.
         // It's ok if multiple threads race to set this to the same value
         // (other than the cache line bouncing)
-        _rangeCount.store(_maxNumRanges);
+        _rangeCount.store(maxRanges);
 
         return false;
     }
 
-     size_t newSize = allocIdx + 1;
-
-    // As we might grow the array (which would result in a copy)
-    // we need to lock around the whole insert into _rangeList.
-    //
-    // An optomisation could be to change into a read/write lock.
-    {
-        std::lock_guard<std::mutex> lock(_rangeListLock);
-
-        if (newSize > _rangeList.size()) {
-            _rangeList.resize(newSize);
-        }
-        _rangeList[allocIdx] = range;
-    }
+    // The fetch-add above claimed allocIdx exclusively for this
+    // thread, and published blocks never move, so the slot can be
+    // written without a lock.
+    *_GetRangeSlot(allocIdx) = range;
 
     range->SetBufferArray(this);
     
@@ -104,10 +161,12 @@ HdBufferArray::RemoveUnusedRanges()
     size_t numRanges = _rangeCount;
     size_t idx = 0;
     while (idx < numRanges) {
-        if (_rangeList[idx].expired()) {
+        HdBufferArrayRangePtr &slot = *_GetExistingRangeSlot(idx);
+        if (slot.expired()) {
             // Order of range objects doesn't matter so use range at end to fill gap.
-            _rangeList[idx] = _rangeList[numRanges - 1];
-            _rangeList[numRanges - 1].reset();
+            HdBufferArrayRangePtr &tail = *_GetExistingRangeSlot(numRanges - 1);
+            slot = tail;
+            tail.reset();
             --numRanges;
 
             HD_PERF_COUNTER_INCR(_garbageCollectionPerfToken);
@@ -124,25 +183,31 @@ HdBufferArray::RemoveUnusedRanges()
 HdBufferArrayRangePtr
 HdBufferArray::GetRange(size_t idx) const
 {
-    // XXX: This would need a lock on range list
+    // XXX: This would need synchronization on the slot
     // if run in parrelel to TryAssignRange
 
     TF_VERIFY(idx < _rangeCount); // Note this maybe lower than the actual array
-    return _rangeList[idx];
+    return *_GetExistingRangeSlot(idx);
 }
 
 void
 HdBufferArray::_SetRangeList(
     std::vector<HdBufferArrayRangeSharedPtr> const &ranges)
 {
-    std::lock_guard<std::mutex> lock(_rangeListLock);
-
-    _rangeList.clear();
-    _rangeList.assign(ranges.begin(), ranges.end());
-    _rangeCount = _rangeList.size();
-    TF_FOR_ALL(it, ranges) {
-        (*it)->SetBufferArray(this);
+    // Called during reallocation, which doesn't overlap concurrent
+    // TryAssignRange (same contract as GetRange).
+    size_t oldCount = _rangeCount;
+    size_t newCount = ranges.size();
+
+    for (size_t i = 0; i < newCount; ++i) {
+        *_GetRangeSlot(i) = ranges[i];
+        ranges[i]->SetBufferArray(this);
+    }
+    // Drop stale entries beyond the new range set.
+    for (size_t i = newCount; i < oldCount; ++i) {
+        _GetExistingRangeSlot(i)->reset();
     }
+    _rangeCount = newCount;
 }
 
 /*virtual*/
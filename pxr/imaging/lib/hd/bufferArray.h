@@ -37,7 +37,6 @@
 #include <boost/enable_shared_from_this.hpp>
 
 #include <atomic>
-#include <mutex>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -140,16 +139,39 @@ protected:
     void _SetRangeList(std::vector<HdBufferArrayRangeSharedPtr> const &ranges);
 
 private:
-    typedef std::vector<HdBufferArrayRangePtr> _RangeList;
-
-    // Vector of ranges assosiated with this buffer
-    // We add values to the list in a multi-threaded fashion
+    // Ranges are stored in a chain of geometrically growing blocks.
+    // A block, once published, never moves, so a thread that claimed a
+    // slot off _rangeCount can write it without serializing against
+    // other writers or against growth -- parallel commit threads used
+    // to contend on a mutex here.
+    //
+    // Block b holds (1 << (b + _firstBlockSizeLog2)) entries; the
+    // first block covers the common case of small buffer arrays and
+    // the full chain addresses 2^31 ranges, which is effectively
+    // unbounded.
+    static const size_t _firstBlockSizeLog2 = 4;
+    static const size_t _numBlocks = 28;
+
+    // Maps a range index to its block and the offset within it.
+    static void _GetBlockLocation(size_t idx,
+                                  size_t *blockIdx, size_t *offset);
+
+    // Returns the slot for \p idx, allocating and publishing its block
+    // first if necessary.  Only the thread that claimed \p idx off
+    // _rangeCount may write through the returned pointer.
+    HdBufferArrayRangePtr *_GetRangeSlot(size_t idx);
+
+    // Returns the slot for \p idx, which must be in an already
+    // published block.
+    HdBufferArrayRangePtr *_GetExistingRangeSlot(size_t idx) const;
+
+    // Blocks of ranges assosiated with this buffer.
+    // We add values in a multi-threaded fashion
     // but can later remove them in _RemoveUnusedRanges
     // than add more.
     //
-    _RangeList         _rangeList;
-    std::atomic_size_t _rangeCount;               // how many ranges are valid in list
-    std::mutex         _rangeListLock;
+    std::atomic<HdBufferArrayRangePtr *> _rangeBlocks[_numBlocks];
+    std::atomic_size_t _rangeCount;               // how many ranges are valid
 
     const TfToken _role;
     const TfToken _garbageCollectionPerfToken;
@@ -28,6 +28,7 @@
 #include "pxr/imaging/hd/api.h"
 #include "pxr/imaging/hd/version.h"
 #include "pxr/imaging/garch/gl.h"
+#include "pxr/base/tf/smallVector.h"
 #include "pxr/base/tf/stl.h"
 #include "pxr/base/tf/token.h"
 #include <vector>
@@ -35,7 +36,10 @@
 PXR_NAMESPACE_OPEN_SCOPE
 
 
-typedef std::vector<struct HdBufferSpec> HdBufferSpecVector;
+// Buffer spec vectors almost always hold just a few entries (one per
+// named resource of an aggregated buffer array), so store the typical
+// case inline rather than heap-allocating it.
+typedef TfSmallVector<struct HdBufferSpec, 8> HdBufferSpecVector;
 
 /// \class HdBufferSpec
 ///
@@ -30,6 +30,7 @@
 #include "pxr/base/tf/debug.h"
 #include "pxr/base/tf/token.h"
 
+#include <algorithm>
 #include <iostream>
 #include <sstream>
 
@@ -48,6 +49,8 @@ HdChangeTracker::HdChangeTracker()
     , _needsGarbageCollection(false)
     , _instancerRprimMap()
     , _varyingStateVersion(1)
+    , _varyingIdLog()
+    , _varyingLogStartVersion(1)
     , _indexVersion(0)
     , _changeCount(1)       // changeCount in DirtyList starts from 0.
     , _visChangeCount(1)    // Clients (commandBuffer) start from 0.
@@ -74,29 +77,95 @@ HdChangeTracker::_LogCacheAccess(TfToken const& cacheName,
     }
 }
 
+void
+HdChangeTracker::_LogNewlyVaryingRprim(SdfPath const& id)
+{
+    // Bound the memory the log can hold onto; beyond this many
+    // transitions per reconciliation the incremental path stops
+    // paying off anyway.
+    static const size_t _maxLoggedIds = 8192;
+
+    if (_varyingIdLog.size() >= _maxLoggedIds) {
+        _TruncateVaryingLog();
+        return;
+    }
+    _varyingIdLog.push_back(std::make_pair(_varyingStateVersion, id));
+}
+
+void
+HdChangeTracker::_TruncateVaryingLog()
+{
+    _varyingIdLog.clear();
+    _varyingLogStartVersion = _varyingStateVersion;
+}
+
+bool
+HdChangeTracker::GetNewlyVaryingRprimIds(unsigned sinceVersion,
+                                         SdfPathVector *ids) const
+{
+    if (sinceVersion < _varyingLogStartVersion) {
+        // The log was truncated after the caller's snapshot was taken.
+        return false;
+    }
+
+    // Entries were appended with monotonically increasing versions.
+    _VaryingIdLog::const_iterator it =
+        std::upper_bound(_varyingIdLog.begin(), _varyingIdLog.end(),
+                         sinceVersion,
+                         [](unsigned version,
+                            _VaryingIdLog::value_type const &entry) {
+                             return version < entry.first;
+                         });
+    for (; it != _varyingIdLog.end(); ++it) {
+        ids->push_back(it->second);
+    }
+    return true;
+}
+
 void
 HdChangeTracker::RprimInserted(SdfPath const& id, HdDirtyBits initialDirtyState)
 {
     TF_DEBUG(HD_RPRIM_ADDED).Msg("Rprim Added: %s\n", id.GetText());
-    _rprimState[id] = initialDirtyState;
+    _rprimState.Insert(id, initialDirtyState);
 
     // Make sure cached DrawItems get flushed out.
     ++_changeCount;
     ++_indexVersion;
     ++_varyingStateVersion;
+    // Topology changes invalidate cached dirty lists wholesale.
+    _TruncateVaryingLog();
+}
+
+void
+HdChangeTracker::RprimsInserted(
+    const std::vector<std::pair<SdfPath, HdDirtyBits>> &entries)
+{
+    for (const auto &entry : entries) {
+        TF_DEBUG(HD_RPRIM_ADDED).Msg("Rprim Added: %s\n",
+                                     entry.first.GetText());
+        _rprimState.Insert(entry.first, entry.second);
+    }
+
+    // Invalidate cached DrawItems and dirty lists once for the whole
+    // batch rather than once per prim.
+    ++_changeCount;
+    ++_indexVersion;
+    ++_varyingStateVersion;
+    _TruncateVaryingLog();
 }
 
 void
 HdChangeTracker::RprimRemoved(SdfPath const& id)
 {
     TF_DEBUG(HD_RPRIM_REMOVED).Msg("Rprim Removed: %s\n", id.GetText());
-    _rprimState.erase(id);
+    _rprimState.Remove(id);
     // Make sure cached DrawItems get flushed out and their buffers are
     // reclaimed.
     _needsGarbageCollection = true;
     ++_changeCount;
     ++_indexVersion;
     ++_varyingStateVersion;
+    _TruncateVaryingLog();
 }
 
 
@@ -108,28 +177,78 @@ HdChangeTracker::MarkRprimDirty(SdfPath const& id, HdDirtyBits bits)
         return;
     }
 
-    _IDStateMap::iterator it = _rprimState.find(id);
-    if (!TF_VERIFY(it != _rprimState.end(), "%s\n", id.GetText()))
+    HdDirtyBits *state = _rprimState.Find(id);
+    if (!TF_VERIFY(state, "%s\n", id.GetText()))
         return;
 
     // used ensure the repr has been created. don't touch changeCount
     if (bits == HdChangeTracker::InitRepr) {
-        it->second |= HdChangeTracker::InitRepr;
+        *state |= HdChangeTracker::InitRepr;
         return;
     }
 
     // set Varying bit if it's not set
-    HdDirtyBits oldBits = it->second;
+    HdDirtyBits oldBits = *state;
     if ((oldBits & HdChangeTracker::Varying) == 0) {
         // varying state changed.
         bits |= HdChangeTracker::Varying;
         ++_varyingStateVersion;
+        _LogNewlyVaryingRprim(id);
+    }
+    *state = oldBits | bits;
+    ++_changeCount;
+
+    if (bits & DirtyVisibility)
+        ++_visChangeCount;
+}
+
+void
+HdChangeTracker::MarkRprimSubtreeDirty(SdfPath const& subtreeRoot,
+                                       HdDirtyBits bits)
+{
+    HD_TRACE_FUNCTION();
+
+    if (ARCH_UNLIKELY(bits == HdChangeTracker::Clean)) {
+        TF_CODING_ERROR("MarkRprimSubtreeDirty called with bits == clean!");
+        return;
+    }
+
+    const std::pair<size_t, size_t> range =
+        _rprimState.GetSubtreeRange(subtreeRoot);
+    if (range.first == range.second) {
+        return;
+    }
+
+    // used ensure the repr has been created. don't touch changeCount
+    if (bits == HdChangeTracker::InitRepr) {
+        for (size_t i = range.first; i != range.second; ++i) {
+            _rprimState.GetBits(i) |= HdChangeTracker::InitRepr;
+        }
+        return;
+    }
+
+    // Same per-prim logic as MarkRprimDirty, but the version counters
+    // are only bumped once for the whole subtree; consumers compare
+    // them for equality, not by count.
+    bool varyingStateChanged = false;
+    for (size_t i = range.first; i != range.second; ++i) {
+        HdDirtyBits &state = _rprimState.GetBits(i);
+        HdDirtyBits primBits = bits;
+        if ((state & HdChangeTracker::Varying) == 0) {
+            primBits |= HdChangeTracker::Varying;
+            if (!varyingStateChanged) {
+                varyingStateChanged = true;
+                ++_varyingStateVersion;
+            }
+            _LogNewlyVaryingRprim(_rprimState.GetId(i));
+        }
+        state |= primBits;
     }
-    it->second = oldBits | bits;
     ++_changeCount;
 
-    if (bits & DirtyVisibility) 
+    if (bits & DirtyVisibility) {
         ++_visChangeCount;
+    }
 }
 
 void
@@ -138,9 +257,13 @@ HdChangeTracker::ResetVaryingState()
     ++_varyingStateVersion;
     ++_changeCount;
 
+    // The log only records prims becoming varying, never ceasing to
+    // vary, so it cannot describe this transition.
+    _TruncateVaryingLog();
+
     // reset all variability bit
-    TF_FOR_ALL (it, _rprimState) {
-        it->second &= ~Varying;
+    for (size_t i = 0, n = _rprimState.GetSize(); i != n; ++i) {
+        _rprimState.GetBits(i) &= ~Varying;
     }
 }
 
@@ -148,11 +271,11 @@ void
 HdChangeTracker::MarkRprimClean(SdfPath const& id, HdDirtyBits newBits)
 {
     TF_DEBUG(HD_RPRIM_CLEANED).Msg("Rprim Cleaned: %s\n", id.GetText());
-    _IDStateMap::iterator it = _rprimState.find(id);
-    if (!TF_VERIFY(it != _rprimState.end()))
+    HdDirtyBits *state = _rprimState.Find(id);
+    if (!TF_VERIFY(state))
         return;
     // preserve the variability bit
-    it->second = (it->second & Varying) | newBits;
+    *state = (*state & Varying) | newBits;
 }
 
 void
@@ -680,9 +803,8 @@ HdChangeTracker::MarkAllRprimsDirty(HdDirtyBits bits)
 {
     HD_TRACE_FUNCTION();
 
-    for (_IDStateMap::iterator it  = _rprimState.begin();
-                               it != _rprimState.end(); ++it) {
-        it->second |= bits;
+    for (size_t i = 0, n = _rprimState.GetSize(); i != n; ++i) {
+        _rprimState.GetBits(i) |= bits;
     }
 
     ++_changeCount;
@@ -713,14 +835,14 @@ HdChangeTracker::MarkPrimVarDirty(HdDirtyBits *dirtyBits, TfToken const &name)
 HdDirtyBits
 HdChangeTracker::GetRprimDirtyBits(SdfPath const& id) const
 {
-    _IDStateMap::const_iterator it = _rprimState.find(id);
-    if (!TF_VERIFY(it != _rprimState.end()))
+    const HdDirtyBits *state = _rprimState.Find(id);
+    if (!TF_VERIFY(state))
         return Clean;
 
     // not masking the varying bit, since we use that bit
     // in HdRenderIndex::GetDelegateIDsWithDirtyRprims to extract
     // all varying rprims.
-    return it->second;// & (~Varying);
+    return *state;// & (~Varying);
 }
 
 void 
@@ -763,8 +885,9 @@ HdChangeTracker::MarkAllCollectionsDirty()
 
     ++_indexVersion;
     ++_varyingStateVersion;
+    _TruncateVaryingLog();
 
-    // Also force DirtyLists to refresh: 
+    // Also force DirtyLists to refresh:
     // This is needed in the event that a collection changes due to changes in
     // the delegate's scene graph, but those changes have no direct effect on
     // the RenderIndex.
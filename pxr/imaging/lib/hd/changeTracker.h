@@ -28,11 +28,14 @@
 #include "pxr/imaging/hd/api.h"
 #include "pxr/imaging/hd/version.h"
 #include "pxr/imaging/hd/rprimCollection.h"
+#include "pxr/imaging/hd/sortedDirtyBits.h"
 #include "pxr/imaging/hd/types.h"
 #include "pxr/usd/sdf/path.h"
 #include "pxr/base/tf/hashmap.h"
 
 #include <atomic>
+#include <utility>
+#include <vector>
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/unordered_map.hpp>
@@ -112,6 +115,13 @@ public:
     HD_API
     void RprimInserted(SdfPath const& id, HdDirtyBits initialDirtyState);
 
+    /// Start tracking a batch of Rprims, given as (id, initial dirty
+    /// state) pairs.  The invalidation counters are bumped once for the
+    /// whole batch instead of once per prim.
+    HD_API
+    void RprimsInserted(
+        const std::vector<std::pair<SdfPath, HdDirtyBits>> &entries);
+
     /// Stop tracking Rprim with the given \p id.
     HD_API
     void RprimRemoved(SdfPath const& id);
@@ -131,6 +141,16 @@ public:
     HD_API
     void MarkRprimDirty(SdfPath const& id, HdDirtyBits bits=AllDirty);
 
+    /// Flag every Rprim at or below \p subtreeRoot as being dirty.
+    /// Equivalent to calling MarkRprimDirty on each of them, but the
+    /// rprims are found with one range lookup over id-sorted storage
+    /// and the tracker versions are bumped once for the whole batch,
+    /// so invalidating a large subtree does not pay a per-prim map
+    /// operation.
+    HD_API
+    void MarkRprimSubtreeDirty(SdfPath const& subtreeRoot,
+                               HdDirtyBits bits=AllDirty);
+
     /// Clear the dirty flags for an HdRprim. if inSync is true, set OutOfSync
     /// flag to notify dirtyList will discover the prim to sync the residual
     /// data for new repr.
@@ -487,6 +507,18 @@ public:
         return _varyingStateVersion;
     }
 
+    /// Appends to \p ids the rprims that became varying after
+    /// \p sinceVersion (a value previously returned by
+    /// GetVaryingStateVersion()), so that cached dirty lists can be
+    /// maintained incrementally instead of being rebuilt from the full
+    /// render index.  Returns false when the record doesn't reach back
+    /// to \p sinceVersion -- after ResetVaryingState, rprim
+    /// insertion/removal or log overflow -- in which case the caller
+    /// must fall back to a full rebuild.
+    HD_API
+    bool GetNewlyVaryingRprimIds(unsigned sinceVersion,
+                                 SdfPathVector *ids) const;
+
     /// Returns the change count 
     unsigned GetChangeCount() const {
         return _changeCount;
@@ -541,13 +573,24 @@ private:
     static void _LogCacheAccess(TfToken const& cacheName,
                                 SdfPath const& id, bool hit);
 
+    // Records \p id as newly varying at the current (already bumped)
+    // varying state version.
+    void _LogNewlyVaryingRprim(SdfPath const& id);
+
+    // Discards the newly-varying log; subsequent
+    // GetNewlyVaryingRprimIds calls for older versions report the
+    // record as incomplete.
+    void _TruncateVaryingLog();
+
     typedef TfHashMap<SdfPath, HdDirtyBits, SdfPath::Hash> _IDStateMap;
     typedef TfHashMap<TfToken, int, TfToken::HashFunctor> _CollectionStateMap;
     typedef TfHashMap<SdfPath, SdfPathSet, SdfPath::Hash> _InstancerRprimMap;
     typedef TfHashMap<TfToken, unsigned, TfToken::HashFunctor> _GeneralStateMap;
 
-    // Core dirty state.
-    _IDStateMap _rprimState;
+    // Core dirty state.  Rprim dirty bits live in id-sorted storage so
+    // a whole subtree can be invalidated as one contiguous range; the
+    // other prim types are few enough that hash maps remain fine.
+    Hd_SortedDirtyBits _rprimState;
     _IDStateMap _instancerState;
     _IDStateMap _taskState;
     _IDStateMap _sprimState;
@@ -568,7 +611,18 @@ private:
     // delegate notify the change tracker when that state changes, which bumps
     // the varyingStateVersion, which triggers downstream invalidation.
     unsigned _varyingStateVersion;
- 
+
+    // Bounded log of (varyingStateVersion, id) for rprims that became
+    // varying, so dirty lists can catch up by appending instead of
+    // re-filtering the whole render index.  The log only covers
+    // versions at or after _varyingLogStartVersion; truncation events
+    // (varying state reset, topology changes, overflow) advance the
+    // start version, which makes stale queries fail and fall back to
+    // a full rebuild.
+    typedef std::vector<std::pair<unsigned, SdfPath> > _VaryingIdLog;
+    _VaryingIdLog _varyingIdLog;
+    unsigned _varyingLogStartVersion;
+
     // Used for coarse grain invalidation of all RprimCollections.
     unsigned _indexVersion;
 
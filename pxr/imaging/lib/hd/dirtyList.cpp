@@ -29,6 +29,7 @@
 #include "pxr/imaging/hd/renderIndex.h"
 #include "pxr/imaging/hd/tokens.h"
 
+#include <algorithm>
 #include <iostream>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -75,6 +76,7 @@ HdDirtyList::HdDirtyList(HdRprimCollection const& collection,
         , _changeCount(
             _renderIndex.GetChangeTracker().GetChangeCount() - 1)
         , _isEmpty(false)
+        , _rebuildVaryingSet(true)
 {
     HD_PERF_COUNTER_INCR(HdPerfTokens->dirtyLists);
 }
@@ -110,6 +112,32 @@ HdDirtyList::_UpdateIDs(SdfPathVector* ids, HdDirtyBits mask)
                   ids);
 }
 
+bool
+HdDirtyList::_PrimFitsCollection(SdfPath const& id) const
+{
+    // Mirrors what HdPrimGather does for a single prim: the deepest
+    // matching root/exclude path decides membership.
+    size_t includeDepth = 0;
+    for (auto const& root : _collection.GetRootPaths()) {
+        if (id.HasPrefix(root)) {
+            includeDepth = std::max(includeDepth,
+                                    root.GetPathElementCount() + 1);
+        }
+    }
+    if (includeDepth == 0) {
+        return false;
+    }
+    for (auto const& exclude : _collection.GetExcludePaths()) {
+        if (id.HasPrefix(exclude) &&
+            exclude.GetPathElementCount() + 1 > includeDepth) {
+            return false;
+        }
+    }
+
+    TfToken const& repr = _collection.GetReprName();
+    return _collection.HasRenderTag(_renderIndex.GetRenderTag(id, repr));
+}
+
 void
 HdDirtyList::Clear()
 {
@@ -132,6 +160,11 @@ HdDirtyList::Clear()
         // varying set.
         _collectionVersion = currentCollectionVersion;
         _varyingStateVersion = currentVaryingStateVersion - 1;
+
+        // The list currently holds the (conservative) initialization
+        // set; only a full re-filter can shrink it down to the stable
+        // varying set, so don't let the incremental path run next.
+        _rebuildVaryingSet = true;
     }
 
     // in any case, this list is now clean until the changeCount changes.
@@ -190,6 +223,7 @@ HdDirtyList::ApplyEdit(HdRprimCollection const& col)
            // populate only varying prims in the collection
            _UpdateIDs(&_dirtyIds, HdChangeTracker::Varying);
            _varyingStateVersion = currentVaryingStateVersion;
+           _rebuildVaryingSet = false;
     }
 
     SdfPathVector added, removed;
@@ -363,8 +397,27 @@ HdDirtyList::GetDirtyRprims()
                 _varyingStateVersion,
                 currentVaryingStateVersion);
 
-        // populate only varying prims in the collection
-        _UpdateIDs(&_dirtyIds, HdChangeTracker::Varying);
+        // When only a few prims started varying since the list was
+        // last built, the change tracker can name them and we append
+        // the ones in the collection instead of re-filtering the whole
+        // render index.  Fall back to the full rebuild when the
+        // tracker's record doesn't reach back far enough, or when the
+        // list still holds the initialization set and needs to shrink
+        // down to the stable varying set.
+        SdfPathVector newlyVaryingIds;
+        if (!_rebuildVaryingSet &&
+            changeTracker.GetNewlyVaryingRprimIds(_varyingStateVersion,
+                                                  &newlyVaryingIds)) {
+            for (auto const& id : newlyVaryingIds) {
+                if (_PrimFitsCollection(id)) {
+                    _dirtyIds.push_back(id);
+                }
+            }
+        } else {
+            // populate only varying prims in the collection
+            _UpdateIDs(&_dirtyIds, HdChangeTracker::Varying);
+            _rebuildVaryingSet = false;
+        }
         _varyingStateVersion = currentVaryingStateVersion;
     } else if (_changeCount != currentChangeCount) {
         // reuse the existing varying prims list.
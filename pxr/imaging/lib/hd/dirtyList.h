@@ -79,6 +79,11 @@ typedef boost::weak_ptr<class HdDirtyList> HdDirtyListPtr;
 ///   dirtybits, since effective dirtybits may differ over prims, by prim
 ///   type (mesh vs curve) or by per-prim repr style (flat vs smooth)
 ///
+///   When only a few prims started varying, the change tracker can
+///   report exactly those prims (GetNewlyVaryingRprimIds) and the
+///   cached list is patched by appending the ones that belong to the
+///   collection, instead of re-filtering the entire render index.
+///
 ///   example: [x]=Varying   [x*]=Dirty,Varying
 ///
 ///    say in change tracker:
@@ -137,6 +142,10 @@ public:
 private:
     void _UpdateIDs(SdfPathVector* ids, HdDirtyBits mask);
 
+    // Returns true if \p id belongs to the collection (root paths,
+    // exclude paths and render tags).
+    bool _PrimFitsCollection(SdfPath const& id) const;
+
     HdRprimCollection _collection;
     SdfPathVector _dirtyIds;
     HdRenderIndex &_renderIndex;
@@ -145,6 +154,11 @@ private:
     unsigned int _varyingStateVersion;
     unsigned int _changeCount;
     bool _isEmpty;
+
+    // True when the next varying-state refresh must re-filter the full
+    // render index (shrinking the initialization list down to the
+    // stable varying set) rather than appending newly varying prims.
+    bool _rebuildVaryingSet;
 };
 
 
@@ -167,10 +167,11 @@ HdExtCompGpuComputation::Execute(
     glDispatchCompute((GLuint)GetNumOutputElements(), 1, 1);
     GLF_POST_PENDING_GL_ERRORS();
 
-    // For now we make sure the computation finishes right away.
-    // Figure out if sync or async is the way to go.
-    // Assuming SSBOs for the output
-    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+    // The output aliases the rprim's primvar range directly, so the writes
+    // are next read either as SSBOs by downstream computations or as vertex
+    // attributes when the range is drawn.
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT |
+                    GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT);
 
     // Unbind.
     // XXX this should go away once we use a graphics abstraction
@@ -39,10 +39,24 @@
 #include "pxr/imaging/hd/perfLog.h"
 #include "pxr/imaging/hd/renderContextCaps.h"
 #include "pxr/imaging/hd/tokens.h"
+#include "pxr/base/tf/envSetting.h"
+#include "pxr/base/tf/instantiateSingleton.h"
 #include "pxr/base/vt/array.h"
 
+#include <cstring>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_INSTANTIATE_SINGLETON(HdGLStagingRing);
+
+TF_DEFINE_ENV_SETTING(HD_ENABLE_STAGING_RING, true,
+                      "Stream buffer uploads through a persistently mapped "
+                      "staging ring when GL_ARB_buffer_storage is available");
+
+TF_DEFINE_ENV_SETTING(HD_STAGING_RING_SIZE, (16*1024*1024),
+                      "Total size of the persistently mapped staging ring "
+                      "in bytes");
+
 
 template <typename T>
 VtValue
@@ -274,5 +288,161 @@ HdGLBufferRelocator::Commit()
     _queue.clear();
 }
 
+// ---------------------------------------------------------------------------
+
+HdGLStagingRing::HdGLStagingRing()
+    : _buffer(0)
+    , _mappedAddress(NULL)
+    , _segmentSize(0)
+    , _segment(0)
+    , _segmentOffset(0)
+    , _initialized(false)
+    , _enabled(false)
+{
+    for (int i = 0; i < _numSegments; ++i) {
+        _fences[i] = NULL;
+    }
+}
+
+HdGLStagingRing::~HdGLStagingRing()
+{
+    if (_buffer) {
+        glDeleteBuffers(1, &_buffer);
+    }
+}
+
+/*static*/
+HdGLStagingRing&
+HdGLStagingRing::GetInstance()
+{
+    return TfSingleton<HdGLStagingRing>::GetInstance();
+}
+
+bool
+HdGLStagingRing::IsEnabled()
+{
+    if (!_initialized) {
+        _Init();
+    }
+    return _enabled;
+}
+
+void
+HdGLStagingRing::_Init()
+{
+    _initialized = true;
+
+    HdRenderContextCaps const &caps = HdRenderContextCaps::GetInstance();
+    if (!TfGetEnvSetting(HD_ENABLE_STAGING_RING) ||
+        !caps.bufferStorageEnabled ||
+        !caps.copyBufferEnabled ||
+        !glBufferStorage) {
+        return;
+    }
+
+    _segmentSize = TfGetEnvSetting(HD_STAGING_RING_SIZE) / _numSegments;
+    if (_segmentSize <= 0) return;
+
+    GLbitfield access =
+        GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+    GLsizeiptr ringSize = _segmentSize * _numSegments;
+
+    glGenBuffers(1, &_buffer);
+    if (caps.directStateAccessEnabled) {
+        glNamedBufferStorageEXT(_buffer, ringSize, NULL, access);
+        _mappedAddress = (char*)glMapNamedBufferRangeEXT(
+            _buffer, 0, ringSize, access);
+    } else {
+        glBindBuffer(GL_COPY_READ_BUFFER, _buffer);
+        glBufferStorage(GL_COPY_READ_BUFFER, ringSize, NULL, access);
+        _mappedAddress = (char*)glMapBufferRange(
+            GL_COPY_READ_BUFFER, 0, ringSize, access);
+        glBindBuffer(GL_COPY_READ_BUFFER, 0);
+    }
+
+    if (!_mappedAddress) {
+        TF_WARN("Failed to map the staging ring; "
+                "falling back to glBufferSubData uploads");
+        glDeleteBuffers(1, &_buffer);
+        _buffer = 0;
+        return;
+    }
+
+    _enabled = true;
+}
+
+void
+HdGLStagingRing::_NextSegment()
+{
+    // The GPU may still be consuming copies issued from the retired
+    // segment; fence it so it isn't rewritten before they execute.
+    if (_fences[_segment]) {
+        glDeleteSync(_fences[_segment]);
+    }
+    _fences[_segment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+    _segment = (_segment + 1) % _numSegments;
+    _segmentOffset = 0;
+
+    // Wait until the copies issued the last time around the ring have
+    // been consumed before overwriting the next segment.
+    if (_fences[_segment]) {
+        GLenum status;
+        do {
+            status = glClientWaitSync(_fences[_segment],
+                                      GL_SYNC_FLUSH_COMMANDS_BIT,
+                                      1000000000 /*1 sec*/);
+        } while (status == GL_TIMEOUT_EXPIRED);
+        glDeleteSync(_fences[_segment]);
+        _fences[_segment] = NULL;
+    }
+}
+
+void
+HdGLStagingRing::Upload(GLuint dstBuffer, GLintptr dstOffset,
+                        GLsizeiptr size, void const *data)
+{
+    if (!TF_VERIFY(_enabled)) return;
+
+    HdRenderContextCaps const &caps = HdRenderContextCaps::GetInstance();
+
+    // Copies larger than one segment can't be staged in the ring;
+    // hand them straight to the driver.
+    if (size > _segmentSize) {
+        HD_PERF_COUNTER_INCR(HdPerfTokens->glBufferSubData);
+        if (ARCH_LIKELY(caps.directStateAccessEnabled)) {
+            glNamedBufferSubDataEXT(dstBuffer, dstOffset, size, data);
+        } else {
+            glBindBuffer(GL_ARRAY_BUFFER, dstBuffer);
+            glBufferSubData(GL_ARRAY_BUFFER, dstOffset, size, data);
+            glBindBuffer(GL_ARRAY_BUFFER, 0);
+        }
+        return;
+    }
+
+    if (_segmentOffset + size > _segmentSize) {
+        _NextSegment();
+    }
+
+    GLintptr ringOffset = _segment * _segmentSize + _segmentOffset;
+    memcpy(_mappedAddress + ringOffset, data, size);
+    _segmentOffset += size;
+
+    // The mapping is coherent, so the copy sees the memcpy above
+    // without an explicit flush.
+    HD_PERF_COUNTER_INCR(HdPerfTokens->glCopyBufferSubData);
+    if (ARCH_LIKELY(caps.directStateAccessEnabled)) {
+        glNamedCopyBufferSubDataEXT(_buffer, dstBuffer,
+                                    ringOffset, dstOffset, size);
+    } else {
+        glBindBuffer(GL_COPY_READ_BUFFER, _buffer);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, dstBuffer);
+        glCopyBufferSubData(GL_COPY_READ_BUFFER, GL_COPY_WRITE_BUFFER,
+                            ringOffset, dstOffset, size);
+        glBindBuffer(GL_COPY_READ_BUFFER, 0);
+        glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+    }
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
 
@@ -27,6 +27,7 @@
 #include "pxr/pxr.h"
 #include "pxr/imaging/hd/api.h"
 #include "pxr/imaging/hd/version.h"
+#include "pxr/base/tf/singleton.h"
 #include "pxr/base/vt/value.h"
 
 #include <algorithm>
@@ -144,6 +145,60 @@ private:
     GLint _dstBuffer;
 };
 
+/// \class HdGLStagingRing
+///
+/// A persistently mapped upload ring (GL_ARB_buffer_storage).
+///
+/// Buffer sources are memcpy'd into the mapped ring and copied into the
+/// destination VBO on the GPU with glCopyBufferSubData, so that large
+/// commits stream to the GPU without the driver-internal staging and
+/// synchronization glBufferSubData performs per call.  The ring is
+/// divided into fenced segments; a segment is recycled only after the
+/// GPU has finished consuming the copies issued from it.
+///
+class HdGLStagingRing {
+public:
+    /// Returns the upload ring shared within this process.  As with
+    /// HdRenderContextCaps, a valid GL context has to be made current
+    /// before using the returned instance.
+    HD_API
+    static HdGLStagingRing &GetInstance();
+
+    /// Returns true if uploads should be staged through the ring.
+    /// False if persistently mapped buffers aren't supported by the
+    /// current context, or the ring is disabled by the env setting.
+    HD_API
+    bool IsEnabled();
+
+    /// Copies \p size bytes of \p data into \p dstBuffer at
+    /// \p dstOffset, staging through the ring.  Copies larger than a
+    /// ring segment are handed directly to glBufferSubData.
+    HD_API
+    void Upload(GLuint dstBuffer, GLintptr dstOffset,
+                GLsizeiptr size, void const *data);
+
+private:
+    HD_API
+    HdGLStagingRing();
+    HD_API
+    ~HdGLStagingRing();
+    friend class TfSingleton<HdGLStagingRing>;
+
+    void _Init();
+    void _NextSegment();
+
+    static const int _numSegments = 4;
+
+    GLuint _buffer;             // ring buffer object, persistently mapped
+    char *_mappedAddress;
+    GLsizeiptr _segmentSize;
+    int _segment;               // segment currently being filled
+    GLsizeiptr _segmentOffset;  // write offset within the current segment
+    GLsync _fences[_numSegments];
+    bool _initialized;
+    bool _enabled;
+};
+
 
 PXR_NAMESPACE_CLOSE_SCOPE
 
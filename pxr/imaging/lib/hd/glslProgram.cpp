@@ -29,8 +29,11 @@
 #include "pxr/imaging/hd/resourceRegistry.h"
 #include "pxr/imaging/hd/tokens.h"
 #include "pxr/imaging/glf/glslfx.h"
+#include "pxr/base/tf/atomicOfstreamWrapper.h"
 #include "pxr/base/tf/diagnostic.h"
 #include "pxr/base/tf/envSetting.h"
+#include "pxr/base/tf/fileUtils.h"
+#include "pxr/base/tf/stringUtils.h"
 #include <string>
 #include <fstream>
 #include <iostream>
@@ -41,6 +44,49 @@ PXR_NAMESPACE_OPEN_SCOPE
 TF_DEFINE_ENV_SETTING(HD_ENABLE_SHARED_CONTEXT_CHECK, 0,
     "Enable GL context sharing validation");
 
+TF_DEFINE_ENV_SETTING(HD_PROGRAM_BINARY_CACHE_DIR, "",
+    "Directory used to persist linked GLSL program binaries between "
+    "processes (empty disables the cache)");
+
+// Returns the cache file path for the program with the given hash, or
+// an empty string if the cache is disabled or unusable.  Binaries are
+// only valid for the exact driver that produced them, so the driver
+// identification strings are folded into the file name; a driver update
+// simply orphans the old entries and misses into recompilation.
+static std::string
+_GetProgramBinaryCachePath(HdGLSLProgram::ID hash)
+{
+    static std::string cacheDir =
+        TfGetEnvSetting(HD_PROGRAM_BINARY_CACHE_DIR);
+    if (cacheDir.empty()) {
+        return std::string();
+    }
+
+    if (!TfIsDir(cacheDir) && !TfMakeDirs(cacheDir)) {
+        TF_WARN("Failed to create program binary cache directory %s",
+                cacheDir.c_str());
+        cacheDir.clear();
+        return std::string();
+    }
+
+    const char *vendor =
+        reinterpret_cast<const char *>(glGetString(GL_VENDOR));
+    const char *renderer =
+        reinterpret_cast<const char *>(glGetString(GL_RENDERER));
+    const char *version =
+        reinterpret_cast<const char *>(glGetString(GL_VERSION));
+    if (!vendor || !renderer || !version) {
+        return std::string();
+    }
+
+    std::string driver =
+        std::string(vendor) + renderer + version;
+    uint32_t driverHash = ArchHash(driver.c_str(), driver.size(), 0);
+
+    return TfStringPrintf("%s/hdProgram_%zx_%x.bin",
+                          cacheDir.c_str(), hash, driverHash);
+}
+
 HdGLSLProgram::HdGLSLProgram(TfToken const &role)
     : _program(role), _uniformBuffer(role)
 {
@@ -215,6 +261,96 @@ HdGLSLProgram::Link()
     return success;
 }
 
+bool
+HdGLSLProgram::LoadProgramBinary(ID hash)
+{
+    HD_TRACE_FUNCTION();
+
+    // glew has to be initialized, and the driver has to support
+    // program binaries.
+    if (!glProgramBinary) return false;
+
+    std::string path = _GetProgramBinaryCachePath(hash);
+    if (path.empty()) return false;
+
+    std::ifstream input(path.c_str(), std::ios::in|std::ios::binary);
+    if (!input) return false;
+
+    GLenum format = 0;
+    input.read(reinterpret_cast<char *>(&format), sizeof(format));
+    if (!input) return false;
+
+    std::vector<char> bin((std::istreambuf_iterator<char>(input)),
+                          std::istreambuf_iterator<char>());
+    if (bin.empty()) return false;
+
+    GLuint program = _program.GetId();
+    if (program == 0) {
+        program = glCreateProgram();
+        _program.SetAllocation(program, 0);
+    }
+
+    glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    glProgramBinary(program, format, &bin[0], bin.size());
+
+    std::string logString;
+    if (!HdGLUtils::GetProgramLinkStatus(program, &logString)) {
+        // A stale binary is expected to be rejected here; fall back to
+        // compiling from source.
+        return false;
+    }
+
+    GLint size = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &size);
+    _program.SetAllocation(program, size);
+
+    // create an uniform buffer
+    GLuint uniformBuffer = _uniformBuffer.GetId();
+    if (uniformBuffer == 0) {
+        glGenBuffers(1, &uniformBuffer);
+        _uniformBuffer.SetAllocation(uniformBuffer, 0);
+    }
+
+    return true;
+}
+
+void
+HdGLSLProgram::SaveProgramBinary(ID hash) const
+{
+    HD_TRACE_FUNCTION();
+
+    if (!glGetProgramBinary) return;
+
+    std::string path = _GetProgramBinaryCachePath(hash);
+    if (path.empty()) return;
+
+    GLuint program = _program.GetId();
+    if (program == 0) return;
+
+    GLint size = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &size);
+    if (size == 0) return;
+
+    std::vector<char> bin(size);
+    GLsizei len = 0;
+    GLenum format = 0;
+    glGetProgramBinary(program, size, &len, &format, &bin[0]);
+    if (len == 0) return;
+
+    // Write through a temporary so concurrent processes never observe a
+    // partially written cache entry.
+    TfAtomicOfstreamWrapper wrapper(path);
+    wrapper.GetStream().write(reinterpret_cast<const char *>(&format),
+                              sizeof(format));
+    wrapper.GetStream().write(&bin[0], len);
+
+    std::string reason;
+    if (!wrapper.Commit(&reason)) {
+        TF_WARN("Failed to write program binary cache entry: %s",
+                reason.c_str());
+    }
+}
+
 bool
 HdGLSLProgram::Validate() const
 {
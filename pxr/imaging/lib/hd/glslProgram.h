@@ -63,6 +63,19 @@ public:
     HD_API
     bool Link();
 
+    /// Attempts to restore a previously linked program for \a hash from
+    /// the persistent program binary cache.  Returns false if the cache
+    /// is disabled, has no entry for \a hash, or the driver rejects the
+    /// stored binary (e.g. it was produced by a different driver).
+    HD_API
+    bool LoadProgramBinary(ID hash);
+
+    /// Stores the linked program binary for \a hash into the persistent
+    /// program binary cache.  No-op if the cache is disabled or this
+    /// program hasn't been successfully linked.
+    HD_API
+    void SaveProgramBinary(ID hash) const;
+
     /// Validate if this program is a valid progam in the current context.
     HD_API
     bool Validate() const;
@@ -32,6 +32,7 @@
 
 #include <boost/shared_ptr.hpp>
 #include <tbb/concurrent_unordered_map.h>
+#include <tbb/concurrent_vector.h>
 
 #include <mutex>
 
@@ -117,8 +118,8 @@ public:
     /// Copy constructor.  Need as HdInstanceRegistry is placed in a map
     /// and mutex is not copy constructable, so can't use default
     HdInstanceRegistry(const HdInstanceRegistry &other)
-        : _dictionary(other._dictionary),
-        _regLock()  // Lock is not copied
+        : _dictionary(other._dictionary)
+        // Locks and garbage collection bookkeeping are not copied
     {
     }
 
@@ -150,8 +151,27 @@ private:
     }
 
     typedef typename INSTANCE::Dictionary _Dictionary;
+
+    // Registration locks are sharded by key hash, so that concurrent
+    // registration of different keys (e.g. during load) doesn't
+    // serialize on a single registry mutex.  The dictionary itself
+    // supports concurrent insertion; the lock only protects the
+    // first-instance population protocol for its shard of keys.
+    static const size_t _numShards = 16;
+    std::mutex &_GetShardMutex(typename INSTANCE::KeyType const &key) {
+        return _regLocks[typename _Dictionary::hasher()(key) % _numShards];
+    }
+
     _Dictionary _dictionary;
-    std::mutex _regLock;
+    std::mutex _regLocks[_numShards];
+
+    // Garbage collection bookkeeping.  Keys registered since the last
+    // pass are appended concurrently; everything else is only touched
+    // from GarbageCollect()/Invalidate(), which run exclusively.
+    static const unsigned _fullSweepInterval = 16;
+    tbb::concurrent_vector<typename INSTANCE::KeyType> _newEntries;
+    unsigned _gcPassCount = 0;
+    bool _fullSweepNeeded = true;
 
     HdInstanceRegistry &operator =(HdInstanceRegistry &) = delete;
 };
@@ -167,9 +187,9 @@ HdInstanceRegistry<INSTANCE>::GetInstance(typename INSTANCE::KeyType const &key,
     HD_TRACE_FUNCTION();
     HF_MALLOC_TAG_FUNCTION();
 
-    // Grab Registry lock
+    // Grab the registry lock for this key's shard
     // (and don't release it in this function, return it instead)
-    std::unique_lock<std::mutex> lock(_regLock);
+    std::unique_lock<std::mutex> lock(_GetShardMutex(key));
 
     typename _Dictionary::iterator it = _dictionary.find(key);
     bool firstInstance = false;
@@ -179,6 +199,9 @@ HdInstanceRegistry<INSTANCE>::GetInstance(typename INSTANCE::KeyType const &key,
             std::make_pair(key, typename INSTANCE::ValueType())).first;
 
         firstInstance = true;
+
+        // remember the key for the next garbage collection pass.
+        _newEntries.push_back(key);
     }
 
     instance->Create(key, it->second, &_dictionary, firstInstance);
@@ -194,9 +217,9 @@ HdInstanceRegistry<INSTANCE>::FindInstance(typename INSTANCE::KeyType const &key
     HD_TRACE_FUNCTION();
     HF_MALLOC_TAG_FUNCTION();
 
-    // Grab Registry lock
+    // Grab the registry lock for this key's shard
     // (and don't release it in this function, return it instead)
-    std::unique_lock<std::mutex> lock(_regLock);
+    std::unique_lock<std::mutex> lock(_GetShardMutex(key));
 
     typename _Dictionary::iterator it = _dictionary.find(key);
     if (it == _dictionary.end()) {
@@ -216,6 +239,35 @@ HdInstanceRegistry<INSTANCE>::GarbageCollect()
     HD_TRACE_FUNCTION();
     HF_MALLOC_TAG_FUNCTION();
 
+    // Almost every entry that becomes garbage does so shortly after
+    // registration, when provisional instances lose their last
+    // reference as the scene settles.  So most passes only visit
+    // entries registered since the previous pass; a periodic full sweep
+    // catches old entries whose references were dropped later.
+    bool fullSweep = _fullSweepNeeded ||
+                     (++_gcPassCount % _fullSweepInterval) == 0;
+
+    if (!fullSweep) {
+        for (typename tbb::concurrent_vector<
+                 typename INSTANCE::KeyType>::const_iterator
+                 keyIt  = _newEntries.begin();
+                 keyIt != _newEntries.end(); ++keyIt) {
+
+            typename _Dictionary::iterator it = _dictionary.find(*keyIt);
+
+            // erase instance which isn't referred from anyone
+            if (it != _dictionary.end() && _IsUnique(it->second)) {
+                _dictionary.unsafe_erase(it);
+            }
+        }
+        _newEntries.clear();
+
+        return _dictionary.size();
+    }
+
+    _fullSweepNeeded = false;
+    _newEntries.clear();
+
     size_t count = 0;
     for (typename _Dictionary::iterator it = _dictionary.begin();
          it != _dictionary.end();) {
@@ -239,6 +291,8 @@ HdInstanceRegistry<INSTANCE>::Invalidate()
     HF_MALLOC_TAG_FUNCTION();
 
     _dictionary.clear();
+    _newEntries.clear();
+    _fullSweepNeeded = true;
 }
 
 
@@ -668,7 +668,17 @@ HdInterleavedMemoryManager::_StripedInterleavedBufferRange::CopyData(
         const unsigned char *data =
             (const unsigned char*)bufferSource->GetData();
 
+        HdGLStagingRing &stagingRing = HdGLStagingRing::GetInstance();
         for (int i = 0; i < _numElements; ++i) {
+            if (stagingRing.IsEnabled()) {
+                // stream through the persistently mapped upload ring;
+                // this also sidesteps the glNamedBuffer issue below.
+                stagingRing.Upload(VBO->GetId(), vboOffset, dataSize, data);
+                vboOffset += vboStride;
+                data += dataSize;
+                continue;
+            }
+
             HD_PERF_COUNTER_INCR(HdPerfTokens->glBufferSubData);
 
             // XXX: MapBuffer?
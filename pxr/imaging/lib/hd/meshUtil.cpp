@@ -27,6 +27,7 @@
 #include "pxr/imaging/hd/tokens.h"
 
 #include "pxr/imaging/glf/glew.h"
+#include "pxr/base/work/loops.h"
 #include "pxr/base/gf/vec3i.h"
 #include "pxr/base/gf/vec2f.h"
 #include "pxr/base/gf/vec3f.h"
@@ -35,6 +36,9 @@
 #include "pxr/base/gf/vec3d.h"
 #include "pxr/base/gf/vec4d.h"
 
+#include <algorithm>
+#include <atomic>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 //-------------------------------------------------------------------------
@@ -95,25 +99,62 @@ HdMeshUtil::ComputeTriangleIndices(VtVec3iArray *indices,
     int const * holeFacesPtr = _topology->GetHoleIndices().cdata();
     int numFaces = _topology->GetFaceVertexCounts().size();
     int numVertIndices = _topology->GetFaceVertexIndices().size();
-    int numTris = 0;
     int numHoleFaces = _topology->GetHoleIndices().size();
-    bool invalidTopology = false;
-    int holeIndex = 0;
-    for (int i=0; i<numFaces; ++i) {
-        int nv = numVertsPtr[i]-2;
-        if (nv < 1) {
-            // skip degenerated face
-            invalidTopology = true;
-        } else if (holeIndex < numHoleFaces && holeFacesPtr[holeIndex] == i) {
-            // skip hole face
-            ++holeIndex;
-        } else {
-            numTris += nv;
-        }
-    }
-    if (invalidTopology) {
+
+    // Process faces in blocks: count triangles and vertices per block in
+    // parallel, scan the (few) block totals serially, then write each
+    // block's triangles to its own output range in parallel.  Hole faces
+    // are sorted, so each block can find its place in the hole list with
+    // a binary search.
+    static const size_t blockSize = 1 << 14;
+    const size_t numBlocks = (numFaces + blockSize - 1) / blockSize;
+    std::vector<size_t> blockTriOffsets(numBlocks);
+    std::vector<size_t> blockVertOffsets(numBlocks);
+    std::atomic<bool> invalidDegenerate(false);
+
+    WorkParallelForN(numBlocks,
+        [&](size_t begin, size_t end) {
+            for (size_t b = begin; b < end; ++b) {
+                size_t faceEnd = std::min((b + 1) * blockSize,
+                                          static_cast<size_t>(numFaces));
+                int holeIndex = std::lower_bound(
+                    holeFacesPtr, holeFacesPtr + numHoleFaces,
+                    static_cast<int>(b * blockSize)) - holeFacesPtr;
+                size_t numTris = 0;
+                size_t numVerts = 0;
+                for (size_t i = b * blockSize; i < faceEnd; ++i) {
+                    int nv = numVertsPtr[i];
+                    numVerts += nv;
+                    if (nv < 3) {
+                        // skip degenerated face
+                        invalidDegenerate.store(
+                            true, std::memory_order_relaxed);
+                    } else if (holeIndex < numHoleFaces &&
+                               holeFacesPtr[holeIndex] ==
+                                   static_cast<int>(i)) {
+                        // skip hole face
+                        ++holeIndex;
+                    } else {
+                        numTris += nv - 2;
+                    }
+                }
+                blockTriOffsets[b] = numTris;
+                blockVertOffsets[b] = numVerts;
+            }
+        });
+    if (invalidDegenerate.load()) {
         TF_WARN("degenerated face found [%s]", _id.GetText());
-        invalidTopology = false;
+    }
+
+    size_t numTris = 0;
+    size_t numVerts = 0;
+    for (size_t b = 0; b < numBlocks; ++b) {
+        size_t blockTris = blockTriOffsets[b];
+        size_t blockVerts = blockVertOffsets[b];
+        blockTriOffsets[b] = numTris;
+        blockVertOffsets[b] = numVerts;
+        numTris += blockTris;
+        numVerts += blockVerts;
     }
 
     indices->resize(numTris);
@@ -121,57 +162,72 @@ HdMeshUtil::ComputeTriangleIndices(VtVec3iArray *indices,
 
     bool flip = (_topology->GetOrientation() != HdTokens->rightHanded);
 
-    // reset holeIndex
-    holeIndex = 0;
-
-    for (int i=0,tv=0,v=0; i<numFaces; ++i) {
-        int nv = numVertsPtr[i];
-        if (nv < 3) {
-            // Skip degenerate faces.
-        } else if (holeIndex < numHoleFaces && holeFacesPtr[holeIndex] == i) {
-            // Skip hole faces.
-            ++holeIndex;
-        } else {
-            // edgeFlag is used for inner-line removal of non-triangle
-            // faces on wireframe shading.
-            //
-            //          0__                0  0   0__
-            //        _/|\ \_            _/.  ..   . \_
-            //      _/  | \  \_   ->   _/  .  . .   .  \_
-            //     /  A |C \ B \_     /  A .  .C .   . B \_
-            //    1-----2---3----4   1-----2  1---2   1----2
-            //
-            //  Type   EdgeFlag    Draw
-            //    -       0        show all edges
-            //    A       1        hide [2-0]
-            //    B       2        hide [0-1]
-            //    C       3        hide [0-1] and [2-0]
-            //
-            int edgeFlag = 0;
-            for (int j=0; j < nv-2; ++j) {
-                if (nv > 3) {
-                    if (j == 0) edgeFlag = flip ? 2 : 1;
-                    else if (j == nv-3) edgeFlag = flip ? 1 : 2;
-                    else edgeFlag = 3;
-                }
-
-                if (!_FanTriangulate(
-                        &(*indices)[tv],
-                        vertsPtr, v, j, numVertIndices, flip)) {
-                    invalidTopology = true;
+    std::atomic<bool> invalidIndices(false);
+    WorkParallelForN(numBlocks,
+        [&](size_t begin, size_t end) {
+            for (size_t b = begin; b < end; ++b) {
+                size_t faceEnd = std::min((b + 1) * blockSize,
+                                          static_cast<size_t>(numFaces));
+                int holeIndex = std::lower_bound(
+                    holeFacesPtr, holeFacesPtr + numHoleFaces,
+                    static_cast<int>(b * blockSize)) - holeFacesPtr;
+                size_t tv = blockTriOffsets[b];
+                int v = blockVertOffsets[b];
+                for (size_t i = b * blockSize; i < faceEnd; ++i) {
+                    int nv = numVertsPtr[i];
+                    if (nv < 3) {
+                        // Skip degenerate faces.
+                    } else if (holeIndex < numHoleFaces &&
+                               holeFacesPtr[holeIndex] ==
+                                   static_cast<int>(i)) {
+                        // Skip hole faces.
+                        ++holeIndex;
+                    } else {
+                        // edgeFlag is used for inner-line removal of
+                        // non-triangle faces on wireframe shading.
+                        //
+                        //          0__                0  0   0__
+                        //        _/|\ \_            _/.  ..   . \_
+                        //      _/  | \  \_   ->   _/  .  . .   .  \_
+                        //     /  A |C \ B \_     /  A .  .C .   . B \_
+                        //    1-----2---3----4   1-----2  1---2   1----2
+                        //
+                        //  Type   EdgeFlag    Draw
+                        //    -       0        show all edges
+                        //    A       1        hide [2-0]
+                        //    B       2        hide [0-1]
+                        //    C       3        hide [0-1] and [2-0]
+                        //
+                        int edgeFlag = 0;
+                        for (int j=0; j < nv-2; ++j) {
+                            if (nv > 3) {
+                                if (j == 0) edgeFlag = flip ? 2 : 1;
+                                else if (j == nv-3) edgeFlag = flip ? 1 : 2;
+                                else edgeFlag = 3;
+                            }
+
+                            if (!_FanTriangulate(
+                                    &(*indices)[tv],
+                                    vertsPtr, v, j, numVertIndices, flip)) {
+                                invalidIndices.store(
+                                    true, std::memory_order_relaxed);
+                            }
+
+                            // note that ptex indexing isn't available
+                            // along with triangulation.
+                            (*primitiveParams)[tv] =
+                                EncodeCoarseFaceParam(i, edgeFlag);
+                            ++tv;
+                        }
+                    }
+                    // When the face is degenerate and nv > 0, we need to
+                    // increment the v pointer to walk past the degenerate
+                    // verts.
+                    v += nv;
                 }
-
-                // note that ptex indexing isn't available along with
-                // triangulation.
-                (*primitiveParams)[tv] = EncodeCoarseFaceParam(i, edgeFlag);
-                ++tv;
             }
-        }
-        // When the face is degenerate and nv > 0, we need to increment the v
-        // pointer to walk past the degenerate verts.
-        v += nv;
-    }
-    if (invalidTopology) {
+        });
+    if (invalidIndices.load()) {
         TF_WARN("numVerts and verts are incosistent [%s]",
                 _id.GetText());
     }
@@ -366,53 +422,116 @@ HdMeshUtil::ComputeQuadInfo(HdQuadInfo* quadInfo)
     int numPoints = HdMeshTopology::ComputeNumPoints(
         _topology->GetFaceVertexIndices());
 
-    quadInfo->numVerts.clear();
-    quadInfo->verts.clear();
     quadInfo->pointsOffset = numPoints;
 
-    int vertIndex = 0;
-    int numAdditionalPoints = 0;
-    int maxNumVert = 0;
-    int holeIndex = 0;
-    bool invalidTopology = false;
-    for (int i = 0; i < numFaces; ++i) {
-        int nv = numVertsPtr[i];
-
-        if (holeIndex < numHoleFaces &&
-            holeFacesPtr[holeIndex] == i) {
-            // skip hole faces.
-            vertIndex += nv;
-            ++holeIndex;
-            continue;
-        }
-
-        if (nv == 4) {
-            vertIndex += nv;
-            continue;
-        }
-
-        // if it isn't a quad,
-        quadInfo->numVerts.push_back(nv);
-        for (int j = 0; j < nv; ++j) {
-            // store vertex indices into quadinfo
-            int index = 0;
-            if (vertIndex >= numVertIndices) {
-                invalidTopology = true;
-            } else {
-                index = vertsPtr[vertIndex++];
+    // Process faces in blocks, following the same scheme as triangulation
+    // above: count non-quad faces and their vertices per block in parallel,
+    // scan the block totals serially, then fill each block's slice of the
+    // quad info in parallel.
+    static const size_t blockSize = 1 << 14;
+    const size_t numBlocks = (numFaces + blockSize - 1) / blockSize;
+    std::vector<size_t> blockFaceOffsets(numBlocks);
+    std::vector<size_t> blockNonQuadOffsets(numBlocks);
+    std::vector<size_t> blockVertOffsets(numBlocks);
+    std::vector<int> blockMaxNumVerts(numBlocks);
+
+    WorkParallelForN(numBlocks,
+        [&](size_t begin, size_t end) {
+            for (size_t b = begin; b < end; ++b) {
+                size_t faceEnd = std::min((b + 1) * blockSize,
+                                          static_cast<size_t>(numFaces));
+                int holeIndex = std::lower_bound(
+                    holeFacesPtr, holeFacesPtr + numHoleFaces,
+                    static_cast<int>(b * blockSize)) - holeFacesPtr;
+                size_t numFaceVerts = 0;
+                size_t numNonQuads = 0;
+                size_t numNonQuadVerts = 0;
+                int maxNumVert = 0;
+                for (size_t i = b * blockSize; i < faceEnd; ++i) {
+                    int nv = numVertsPtr[i];
+                    numFaceVerts += nv;
+                    if (holeIndex < numHoleFaces &&
+                        holeFacesPtr[holeIndex] == static_cast<int>(i)) {
+                        // skip hole faces.
+                        ++holeIndex;
+                    } else if (nv != 4) {
+                        ++numNonQuads;
+                        numNonQuadVerts += nv;
+                        maxNumVert = std::max(maxNumVert, nv);
+                    }
+                }
+                blockFaceOffsets[b] = numFaceVerts;
+                blockNonQuadOffsets[b] = numNonQuads;
+                blockVertOffsets[b] = numNonQuadVerts;
+                blockMaxNumVerts[b] = maxNumVert;
             }
-            quadInfo->verts.push_back(index);
-        }
-        // nv + 1 (edge + center) additional vertices needed.
-        numAdditionalPoints += (nv + 1);
+        });
 
-        // remember max numvert for making gpu-friendly table
-        maxNumVert = std::max(maxNumVert, nv);
-    }
-    quadInfo->numAdditionalPoints = numAdditionalPoints;
+    size_t numFaceVerts = 0;
+    size_t numNonQuads = 0;
+    size_t numNonQuadVerts = 0;
+    int maxNumVert = 0;
+    for (size_t b = 0; b < numBlocks; ++b) {
+        size_t blockFaceVerts = blockFaceOffsets[b];
+        size_t blockNonQuads = blockNonQuadOffsets[b];
+        size_t blockNonQuadVerts = blockVertOffsets[b];
+        blockFaceOffsets[b] = numFaceVerts;
+        blockNonQuadOffsets[b] = numNonQuads;
+        blockVertOffsets[b] = numNonQuadVerts;
+        numFaceVerts += blockFaceVerts;
+        numNonQuads += blockNonQuads;
+        numNonQuadVerts += blockNonQuadVerts;
+        maxNumVert = std::max(maxNumVert, blockMaxNumVerts[b]);
+    }
+
+    quadInfo->numVerts.resize(numNonQuads);
+    quadInfo->verts.resize(numNonQuadVerts);
+    // nv + 1 (edge + center) additional vertices needed per non-quad.
+    quadInfo->numAdditionalPoints =
+        static_cast<int>(numNonQuadVerts + numNonQuads);
+    // remember max numvert for making gpu-friendly table
     quadInfo->maxNumVert = maxNumVert;
 
-    if (invalidTopology) {
+    std::atomic<bool> invalidTopology(false);
+    WorkParallelForN(numBlocks,
+        [&](size_t begin, size_t end) {
+            for (size_t b = begin; b < end; ++b) {
+                size_t faceEnd = std::min((b + 1) * blockSize,
+                                          static_cast<size_t>(numFaces));
+                int holeIndex = std::lower_bound(
+                    holeFacesPtr, holeFacesPtr + numHoleFaces,
+                    static_cast<int>(b * blockSize)) - holeFacesPtr;
+                int vertIndex = static_cast<int>(blockFaceOffsets[b]);
+                size_t nq = blockNonQuadOffsets[b];
+                size_t nqv = blockVertOffsets[b];
+                for (size_t i = b * blockSize; i < faceEnd; ++i) {
+                    int nv = numVertsPtr[i];
+
+                    if (holeIndex < numHoleFaces &&
+                        holeFacesPtr[holeIndex] == static_cast<int>(i)) {
+                        // skip hole faces.
+                        ++holeIndex;
+                    } else if (nv != 4) {
+                        // if it isn't a quad,
+                        quadInfo->numVerts[nq++] = nv;
+                        for (int j = 0; j < nv; ++j) {
+                            // store vertex indices into quadinfo
+                            int index = 0;
+                            if (vertIndex + j >= numVertIndices) {
+                                invalidTopology.store(
+                                    true, std::memory_order_relaxed);
+                            } else {
+                                index = vertsPtr[vertIndex + j];
+                            }
+                            quadInfo->verts[nqv++] = index;
+                        }
+                    }
+                    vertIndex += nv;
+                }
+            }
+        });
+
+    if (invalidTopology.load()) {
         TF_WARN("numVerts and verts are incosistent [%s]", _id.GetText());
     }
 }
@@ -140,99 +140,107 @@ HdPerfLog::GetCacheNames()
 TfTokenVector 
 HdPerfLog::GetCounterNames()
 {
-    _Lock lock(_mutex);
     TfTokenVector names;
-    names.reserve(_counterMap.size());
-    TF_FOR_ALL(it, _counterMap) {
+    names.reserve(_counterHandles.size());
+    TF_FOR_ALL(it, _counterHandles) {
         names.push_back(it->first);
     }
     std::sort(names.begin(), names.end());
     return names;
 }
 
+TraceliteCounter *
+HdPerfLog::_GetCounter(TfToken const& name)
+{
+    _CounterHandleMap::const_iterator it = _counterHandles.find(name);
+    if (it != _counterHandles.end())
+        return it->second;
+    // The tracelite registry interns by name, so if two threads race to
+    // bind the same token they get the same counter either way.
+    TraceliteCounter *counter = TraceliteRegisterCounter(name.GetString());
+    return _counterHandles.insert(std::make_pair(name, counter)).first->second;
+}
+
 void
 HdPerfLog::IncrementCounter(TfToken const& name)
 {
-    if (ARCH_LIKELY(!_enabled)) 
-        return;
-    _Lock lock(_mutex);
-    TF_DEBUG(HD_COUNTER_CHANGED).Msg("Counter changed %s: %f -> %f\n",
-            name.GetText(),
-            _counterMap[name],
-            _counterMap[name] + 1.0);
-    _counterMap[name] += 1.0;
+    TraceliteCounter *counter = _GetCounter(name);
+    if (ARCH_UNLIKELY(TfDebug::IsEnabled(HD_COUNTER_CHANGED))) {
+        TF_DEBUG(HD_COUNTER_CHANGED).Msg("Counter changed %s: %f -> %f\n",
+                name.GetText(),
+                counter->GetValue(),
+                counter->GetValue() + 1.0);
+    }
+    counter->Increment();
 }
 
 void
 HdPerfLog::DecrementCounter(TfToken const& name)
 {
-    if (ARCH_LIKELY(!_enabled)) 
-        return;
-    _Lock lock(_mutex);
-    TF_DEBUG(HD_COUNTER_CHANGED).Msg("Counter changed %s: %f -> %f\n",
-            name.GetText(),
-            _counterMap[name],
-            _counterMap[name] - 1.0);
-    _counterMap[name] -= 1.0;
+    TraceliteCounter *counter = _GetCounter(name);
+    if (ARCH_UNLIKELY(TfDebug::IsEnabled(HD_COUNTER_CHANGED))) {
+        TF_DEBUG(HD_COUNTER_CHANGED).Msg("Counter changed %s: %f -> %f\n",
+                name.GetText(),
+                counter->GetValue(),
+                counter->GetValue() - 1.0);
+    }
+    counter->Decrement();
 }
 
 void
 HdPerfLog::SetCounter(TfToken const& name, double value)
 {
-    if (ARCH_LIKELY(!_enabled)) 
-        return;
-    _Lock lock(_mutex);
-    TF_DEBUG(HD_COUNTER_CHANGED).Msg("Counter changed %s: %f -> %f\n",
-            name.GetText(),
-            _counterMap[name],
-            value);
-    _counterMap[name] = value;
+    TraceliteCounter *counter = _GetCounter(name);
+    if (ARCH_UNLIKELY(TfDebug::IsEnabled(HD_COUNTER_CHANGED))) {
+        TF_DEBUG(HD_COUNTER_CHANGED).Msg("Counter changed %s: %f -> %f\n",
+                name.GetText(),
+                counter->GetValue(),
+                value);
+    }
+    counter->Set(value);
 }
 
 void
 HdPerfLog::AddCounter(TfToken const &name, double value)
 {
-    if (ARCH_LIKELY(!_enabled))
-        return;
-    _Lock lock(_mutex);
-    TF_DEBUG(HD_COUNTER_CHANGED).Msg("Counter changed %s %f -> %f\n",
-            name.GetText(),
-            _counterMap[name],
-            _counterMap[name] + value);
-    _counterMap[name] += value;
+    TraceliteCounter *counter = _GetCounter(name);
+    if (ARCH_UNLIKELY(TfDebug::IsEnabled(HD_COUNTER_CHANGED))) {
+        TF_DEBUG(HD_COUNTER_CHANGED).Msg("Counter changed %s %f -> %f\n",
+                name.GetText(),
+                counter->GetValue(),
+                counter->GetValue() + value);
+    }
+    counter->Add(value);
 }
 
 void
 HdPerfLog::SubtractCounter(TfToken const &name, double value)
 {
-    if (ARCH_LIKELY(!_enabled))
-        return;
-    _Lock lock(_mutex);
-    TF_DEBUG(HD_COUNTER_CHANGED).Msg("Counter changed %s %f -> %f\n",
-            name.GetText(),
-            _counterMap[name],
-            _counterMap[name] - value);
-    _counterMap[name] -= value;
+    TraceliteCounter *counter = _GetCounter(name);
+    if (ARCH_UNLIKELY(TfDebug::IsEnabled(HD_COUNTER_CHANGED))) {
+        TF_DEBUG(HD_COUNTER_CHANGED).Msg("Counter changed %s %f -> %f\n",
+                name.GetText(),
+                counter->GetValue(),
+                counter->GetValue() - value);
+    }
+    counter->Subtract(value);
 }
 
 double
 HdPerfLog::GetCounter(TfToken const& name)
 {
-    _Lock lock(_mutex);
-    return TfMapLookupByValue(_counterMap, name, 0.0);
+    _CounterHandleMap::const_iterator it = _counterHandles.find(name);
+    return it != _counterHandles.end() ? it->second->GetValue() : 0.0;
 }
 
 void
 HdPerfLog::ResetCounters()
 {
-    if (ARCH_LIKELY(!_enabled))
-        return;
-    _Lock lock(_mutex);
-    TF_FOR_ALL(counterIt, _counterMap) {
+    TF_FOR_ALL(counterIt, _counterHandles) {
         TF_DEBUG(HD_COUNTER_CHANGED).Msg("Counter reset %s: %f -> 0\n",
                                          counterIt->first.GetText(),
-                                         counterIt->second);
-        counterIt->second = 0;
+                                         counterIt->second->GetValue());
+        counterIt->second->Set(0.0);
     }
 }
 
@@ -29,6 +29,7 @@
 #include "pxr/imaging/hd/version.h"
 #include "pxr/imaging/hd/debugCodes.h"
 
+#include "pxr/base/tracelite/counter.h"
 #include "pxr/base/tracelite/trace.h"
 
 #include "pxr/base/tf/mallocTag.h"
@@ -39,6 +40,8 @@
 #include <boost/shared_ptr.hpp>
 #include "pxr/base/tf/hashmap.h"
 
+#include <tbb/concurrent_unordered_map.h>
+
 #include <mutex>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -94,6 +97,11 @@ typedef boost::shared_ptr<class HdResourceRegistry> HdResourceRegistrySharedPtr;
 ///
 /// Performance counter monitoring.
 ///
+/// Value counters are always enabled: they are backed by the lock-free
+/// tracelite counter facility, so HD_PERF_COUNTER_* stays cheap enough for
+/// release builds.  Cache hit/miss tracking is still gated by
+/// HD_ENABLE_PERFLOG (or Enable()).
+///
 class HdPerfLog : public boost::noncopyable {
 public:
     HD_API
@@ -217,9 +225,15 @@ private:
     typedef TfHashMap<TfToken, _CacheEntry, TfToken::HashFunctor> _CacheMap;
     _CacheMap _cacheMap;
 
-    // Named value counters.
-    typedef TfHashMap<TfToken, double, TfToken::HashFunctor> _CounterMap;
-    _CounterMap _counterMap;
+    // Named value counters.  The values live in always-on tracelite
+    // counters, which are updated without locking; this map only caches the
+    // name-to-handle binding and so can be a concurrent map that is never
+    // locked on lookup.
+    HD_API
+    TraceliteCounter *_GetCounter(TfToken const& name);
+    typedef tbb::concurrent_unordered_map<
+        TfToken, TraceliteCounter*, TfToken::HashFunctor> _CounterHandleMap;
+    _CounterHandleMap _counterHandles;
 
     // Resource registry vector.
     std::vector<HdResourceRegistrySharedPtr> _resourceRegistryVector;
@@ -25,6 +25,9 @@
 #include "pxr/imaging/hd/primGather.h"
 #include "pxr/imaging/hd/perfLog.h"
 #include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/work/loops.h"
+
+#include <algorithm>
 
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -56,22 +59,72 @@ HdPrimGather::PredicatedFilter(const SdfPathVector &paths,
     _GatherPaths(paths);
 
     {
-        // Looked into parallelizing this loop
-        // However, the measured performance wasn't large enough to
-        // justify the parallel overhead.
-        // The scope here, is so it can be tracked and decided to
-        // go parallel later if warranted
         HD_TRACE_SCOPE("HdPrimGather::Predicate Test");
 
+        _resultRanges.clear();
+
+        // Split the gathered ranges into fixed size chunks, so that
+        // large ranges can be predicate tested in parallel.  Each chunk
+        // produces its own result ranges, which get stitched back
+        // together in order below.
+        static const size_t chunkSize = 1024;
+
+        _RangeArray chunks;
         size_t numRanges = _gatheredRanges.size();
         for (size_t rangeNum = 0; rangeNum < numRanges; ++rangeNum) {
             const _Range &range = _gatheredRanges[rangeNum];
 
-            _DoPredicateTest(paths,
-                             range._start,
-                             range._end,
-                             predicateFn,
-                             predicateParam);
+            for (size_t start  = range._start;
+                        start <= range._end;
+                        start += chunkSize) {
+                chunks.emplace_back(start,
+                                    std::min(start + chunkSize - 1,
+                                             range._end));
+            }
+        }
+
+        size_t numChunks = chunks.size();
+        if (numChunks < 2) {
+            // Not enough work to justify the parallel overhead.
+            for (size_t chunkNum = 0; chunkNum < numChunks; ++chunkNum) {
+                _DoPredicateTest(paths,
+                                 chunks[chunkNum]._start,
+                                 chunks[chunkNum]._end,
+                                 predicateFn,
+                                 predicateParam,
+                                 &_resultRanges);
+            }
+        } else {
+            std::vector<_RangeArray> chunkResults(numChunks);
+            WorkParallelForN(numChunks,
+                [&](size_t begin, size_t end) {
+                    for (size_t chunkNum = begin; chunkNum < end; ++chunkNum) {
+                        _DoPredicateTest(paths,
+                                         chunks[chunkNum]._start,
+                                         chunks[chunkNum]._end,
+                                         predicateFn,
+                                         predicateParam,
+                                         &chunkResults[chunkNum]);
+                    }
+                });
+
+            // Stitch the per-chunk results back together, merging ranges
+            // that meet at a chunk boundary.
+            for (size_t chunkNum = 0; chunkNum < numChunks; ++chunkNum) {
+                const _RangeArray &ranges = chunkResults[chunkNum];
+                for (size_t rangeNum = 0;
+                            rangeNum < ranges.size();
+                          ++rangeNum) {
+                    const _Range &range = ranges[rangeNum];
+
+                    if (!_resultRanges.empty() &&
+                        _resultRanges.back()._end + 1 == range._start) {
+                        _resultRanges.back()._end = range._end;
+                    } else {
+                        _resultRanges.push_back(range);
+                    }
+                }
+            }
         }
     }
 
@@ -305,7 +358,8 @@ HdPrimGather::_DoPredicateTest(const SdfPathVector &paths,
                                 size_t               begin,
                                 size_t               end,
                                 FilterPredicateFn    predicateFn,
-                                void                *predicateParam)
+                                void                *predicateParam,
+                                _RangeArray         *resultRanges) const
 {
     size_t currentStart = begin;
     for (size_t pathIdx = begin; pathIdx <= end; ++pathIdx) {
@@ -314,7 +368,7 @@ HdPrimGather::_DoPredicateTest(const SdfPathVector &paths,
 
             // Add all paths up to the path before this one
             if (currentStart < pathIdx) {
-                _resultRanges.emplace_back(currentStart, pathIdx - 1);
+                resultRanges->emplace_back(currentStart, pathIdx - 1);
             }
 
             currentStart = pathIdx + 1;
@@ -323,7 +377,7 @@ HdPrimGather::_DoPredicateTest(const SdfPathVector &paths,
 
     // Add final range
     if (currentStart <= end) {
-        _resultRanges.emplace_back(currentStart, end);
+        resultRanges->emplace_back(currentStart, end);
     }
 }
 
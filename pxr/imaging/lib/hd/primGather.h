@@ -200,7 +200,8 @@ private:
                           size_t               begin,
                           size_t               end,
                           FilterPredicateFn    predicateFn,
-                          void                *predicateParam);
+                          void                *predicateParam,
+                          _RangeArray         *resultRanges) const;
 
 
     void _WriteResults(const SdfPathVector &paths,
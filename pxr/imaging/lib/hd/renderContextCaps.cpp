@@ -197,7 +197,8 @@ HdRenderContextCaps::_LoadCaps()
     }
 
     // initialize by individual extension.
-    if (GLEW_ARB_bindless_texture && glMakeTextureHandleResidentNV) {
+    if (GLEW_ARB_bindless_texture &&
+        (glMakeTextureHandleResidentARB || glMakeTextureHandleResidentNV)) {
         bindlessTextureEnabled = true;
     }
     if (GLEW_NV_shader_buffer_load && glMakeNamedBufferResidentNV) {
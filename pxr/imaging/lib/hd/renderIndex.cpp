@@ -56,6 +56,7 @@
 
 #include <tbb/concurrent_unordered_map.h>
 #include <tbb/concurrent_vector.h>
+#include <tbb/parallel_sort.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -164,6 +165,69 @@ HdRenderIndex::InsertRprim(TfToken const& typeId,
     }
 }
 
+void
+HdRenderIndex::InsertRprims(HdSceneDelegate* sceneDelegate,
+                            RprimToInsertVector const& rprims)
+{
+    HD_TRACE_FUNCTION();
+    HF_MALLOC_TAG_FUNCTION();
+
+    SdfPath const &sceneDelegateId = sceneDelegate->GetDelegateID();
+
+    _rprimMap.reserve(_rprimMap.size() + rprims.size());
+
+    SdfPathVector insertedIds;
+    insertedIds.reserve(rprims.size());
+    std::vector<std::pair<SdfPath, HdDirtyBits>> trackerEntries;
+    trackerEntries.reserve(rprims.size());
+
+    for (RprimToInsert const& entry : rprims) {
+        if (ARCH_UNLIKELY(TfMapLookupPtr(_rprimMap, entry.rprimId))) {
+            continue;
+        }
+
+        if (!entry.rprimId.HasPrefix(sceneDelegateId)) {
+            TF_CODING_ERROR("Scene Delegate Id (%s) must prefix prim Id (%s)",
+                            sceneDelegateId.GetText(),
+                            entry.rprimId.GetText());
+            continue;
+        }
+
+        HdRprim *rprim = _renderDelegate->CreateRprim(entry.typeId,
+                                                      entry.rprimId,
+                                                      entry.instancerId);
+        if (rprim == nullptr) {
+            continue;
+        }
+
+        insertedIds.push_back(entry.rprimId);
+        trackerEntries.push_back(
+            std::make_pair(entry.rprimId, rprim->GetInitialDirtyBitsMask()));
+
+        _AllocatePrimId(rprim);
+
+        _RprimInfo info = {
+          sceneDelegate,
+          rprim
+        };
+        _rprimMap[entry.rprimId] = std::move(info);
+
+        SdfPath instanceId = rprim->GetInstancerId();
+
+        if (!instanceId.IsEmpty()) {
+            _tracker.InstancerRPrimInserted(instanceId, entry.rprimId);
+        }
+    }
+
+    // Register the ids and dirty state once for the whole batch, so the
+    // sorted id list and the tracker's invalidation counters are only
+    // touched once.
+    if (!insertedIds.empty()) {
+        _rprimIds.Insert(insertedIds);
+        _tracker.RprimsInserted(trackerEntries);
+    }
+}
+
 void
 HdRenderIndex::RemoveRprim(SdfPath const& id)
 {
@@ -1077,16 +1141,23 @@ HdRenderIndex::SyncAll(HdTaskSharedPtrVector const &tasks,
         (*it)->Sync(taskContext);
     }
 
-    // Merge IDs using the slow SdfPath less-than so that all delegate IDs group
-    // together. Unfortunately, FastLessThan makes the optimization below less
-    // effective, however the time to build the std::map dominates when using
-    // the lexicographic less than.
-    std::map<SdfPath, /*reprMask=*/size_t, SdfPath::FastLessThan> dirtyIds;
+    // Gather IDs with their repr mask and sort them so duplicates become
+    // adjacent.  FastLessThan groups IDs from the same delegate less well
+    // than the lexicographic less-than, however sorting a flat vector --
+    // in parallel -- is much cheaper than the node-at-a-time std::map
+    // insertions this used to do, which serialized the whole dirty list
+    // walk on large scenes.
+    std::vector<std::pair<SdfPath, /*reprMask=*/size_t> > dirtyIds;
     _ReprList reprs;
     {
         HF_TRACE_FUNCTION_SCOPE("Merge Dirty Lists");
-        // If dirty list prims are all sorted, we could do something more
-        // efficient here.
+
+        size_t numDirtyIds = 0;
+        for (auto const& hdDirtyList : _syncQueue) {
+            numDirtyIds += hdDirtyList->GetDirtyRprims().size();
+        }
+        dirtyIds.reserve(numDirtyIds);
+
         for (auto const& hdDirtyList : _syncQueue) {
             HdRprimCollection const& collection = hdDirtyList->GetCollection();
 
@@ -1116,11 +1187,19 @@ HdRenderIndex::SyncAll(HdTaskSharedPtrVector const &tasks,
                 break;
             }
 
-            // PERFORMANCE: this loop can be expensive.
             for (auto const& sdfPath : hdDirtyList->GetDirtyRprims()) {
-                dirtyIds[sdfPath] |= (1ULL << reprIndex);
+                dirtyIds.push_back(
+                    std::make_pair(sdfPath, 1ULL << reprIndex));
             }
         }
+
+        // Duplicate IDs (the same prim dirty in several lists) end up
+        // adjacent; their repr masks are merged in the loop below.
+        tbb::parallel_sort(dirtyIds.begin(), dirtyIds.end(),
+            [](const std::pair<SdfPath, size_t> &lhs,
+               const std::pair<SdfPath, size_t> &rhs) {
+                return SdfPath::FastLessThan()(lhs.first, rhs.first);
+            });
     }
 
     _RprimSyncRequestMap syncMap;
@@ -1133,8 +1212,18 @@ HdRenderIndex::SyncAll(HdTaskSharedPtrVector const &tasks,
 
         // PERFORMANCE: Hot loop.
         int numSkipped = 0;
-        TF_FOR_ALL(idIt, dirtyIds) {
-            _RprimMap::const_iterator it = _rprimMap.find(idIt->first);
+        size_t numUniqueIds = 0;
+        for (size_t idIdx = 0, n = dirtyIds.size(); idIdx != n; ) {
+            const SdfPath &dirtyId = dirtyIds[idIdx].first;
+            size_t reprsMask = dirtyIds[idIdx].second;
+            // Merge the repr masks of duplicate adjacent IDs.
+            for (++idIdx; idIdx != n && dirtyIds[idIdx].first == dirtyId;
+                     ++idIdx) {
+                reprsMask |= dirtyIds[idIdx].second;
+            }
+            ++numUniqueIds;
+
+            _RprimMap::const_iterator it = _rprimMap.find(dirtyId);
             if (!TF_VERIFY(it != _rprimMap.end())) {
                 continue;
             }
@@ -1143,7 +1232,6 @@ HdRenderIndex::SyncAll(HdTaskSharedPtrVector const &tasks,
             const SdfPath &rprimId = rprimInfo.rprim->GetId();
             int dirtyBits =
                            _tracker.GetRprimDirtyBits(rprimId);
-            size_t reprsMask = idIt->second;
 
             if (HdChangeTracker::IsClean(dirtyBits)) {
                 numSkipped++;
@@ -1166,15 +1254,15 @@ HdRenderIndex::SyncAll(HdTaskSharedPtrVector const &tasks,
         // list.  This leads to performance improvements after many rprims
         // get dirty and then cleaned one, and the steady state becomes a
         // small number of dirty items.
-        if (!dirtyIds.empty()) {
+        if (numUniqueIds > 0) {
             resetVaryingState =
-                ((float )numSkipped / (float)dirtyIds.size()) > 0.25f;
+                ((float )numSkipped / (float)numUniqueIds) > 0.25f;
 
             if (TfDebug::IsEnabled(HD_VARYING_STATE)) {
                 std::cout << "Dirty List Redundancy  = "
-                          << ((float )numSkipped * 100.0f / (float)dirtyIds.size())
+                          << ((float )numSkipped * 100.0f / (float)numUniqueIds)
                           << "% (" <<  numSkipped << " / "
-                          << dirtyIds.size() << ")" << std::endl;
+                          << numUniqueIds << ")" << std::endl;
             }
         }
 
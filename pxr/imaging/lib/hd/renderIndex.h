@@ -158,6 +158,32 @@ public:
                      SdfPath const& rprimId,
                      SdfPath const& instancerId = SdfPath());
 
+    /// Describes a single rprim for bulk insertion via InsertRprims().
+    struct RprimToInsert {
+        RprimToInsert(TfToken const& typeId,
+                      SdfPath const& rprimId,
+                      SdfPath const& instancerId = SdfPath())
+         : typeId(typeId)
+         , rprimId(rprimId)
+         , instancerId(instancerId)
+        {
+        }
+
+        TfToken typeId;
+        SdfPath rprimId;
+        SdfPath instancerId;
+    };
+    typedef std::vector<RprimToInsert> RprimToInsertVector;
+
+    /// Insert a batch of rprims into the index.  Equivalent to calling
+    /// InsertRprim() for each entry, but pre-reserves the index
+    /// structures and registers the ids and dirty state with the change
+    /// tracker once per batch, which matters when population inserts
+    /// hundreds of thousands of prims.
+    HD_API
+    void InsertRprims(HdSceneDelegate* sceneDelegate,
+                      RprimToInsertVector const& rprims);
+
     /// Remove a rprim from index
     HD_API
     void RemoveRprim(SdfPath const& id);
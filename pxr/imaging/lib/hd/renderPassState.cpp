@@ -63,6 +63,8 @@ HdRenderPassState::HdRenderPassState()
     , _alphaThreshold(0.5f)
     , _tessLevel(32.0)
     , _drawRange(0.9, -1.0)
+    , _occlusionTextureId(0)
+    , _occlusionTextureMipLevels(0)
     , _depthBiasUseDefault(true)
     , _depthBiasEnabled(false)
     , _depthBiasConstantFactor(0.0f)
@@ -90,6 +92,8 @@ HdRenderPassState::HdRenderPassState(
     , _alphaThreshold(0.5f)
     , _tessLevel(32.0)
     , _drawRange(0.9, -1.0)
+    , _occlusionTextureId(0)
+    , _occlusionTextureMipLevels(0)
     , _depthBiasUseDefault(true)
     , _depthBiasEnabled(false)
     , _depthBiasConstantFactor(0.0f)
@@ -259,6 +263,14 @@ HdRenderPassState::SetDrawingRange(GfVec2f const &drawRange)
     _drawRange = drawRange;
 }
 
+void
+HdRenderPassState::SetOcclusionTestTexture(unsigned int textureId,
+                                           int mipLevels)
+{
+    _occlusionTextureId = textureId;
+    _occlusionTextureMipLevels = mipLevels;
+}
+
 void
 HdRenderPassState::SetLightingEnabled(bool enabled)
 {
@@ -156,6 +156,20 @@ public:
         return _cullMatrix;
     }
 
+    /// Sets the depth pyramid used for GPU occlusion culling, typically
+    /// built from the previous frame's depth buffer. Each texel of every
+    /// mip level is expected to hold the farthest depth of the screen
+    /// region it covers. Passing a texture id of 0 disables the
+    /// occlusion test.
+    HD_API
+    void SetOcclusionTestTexture(unsigned int textureId, int mipLevels);
+    unsigned int GetOcclusionTestTextureId() const {
+        return _occlusionTextureId;
+    }
+    int GetOcclusionTestTextureMipLevels() const {
+        return _occlusionTextureMipLevels;
+    }
+
     HD_API
     void SetDepthBiasUseDefault(bool useDefault);
     bool GetDepthBiasUseDefault() const { return _depthBiasUseDefault; }
@@ -239,6 +253,10 @@ private:
     float _tessLevel;
     GfVec2f _drawRange;
 
+    // Depth pyramid for GPU occlusion culling.
+    unsigned int _occlusionTextureId;
+    int _occlusionTextureMipLevels;
+
     // Depth Bias RenderPassState
     // When use default is true - state
     // is inherited and onther values are
@@ -398,41 +398,83 @@ HdResourceRegistry::Commit()
         // reallocation or not.
 
         size_t numBufferSourcesResolved = 0;
-        int numThreads = 1; //omp_get_max_threads();
         int numIterations = 0;
 
+        // Scratch list of sources gathered for each sweep, so that the
+        // whole sweep goes out as one batched dispatch.
+        std::vector<HdBufferSource *> sweepSources;
+
+        // Tracks which requests have had their range resized, so the
+        // resize still happens exactly once when the first source of
+        // the request resolves.
+        std::vector<bool> rangeResized(_pendingSources.size(), false);
+
         // iterate until all buffer sources have been resolved.
         while (numBufferSourcesResolved < _numBufferSourcesToResolve) {
-            // XXX: Parallel for is currently much slower than a single
-            // thread in all tested scenarios, disabling until we can figure out
-            // what's going on here.
-//#pragma omp parallel for
-            for (int i = 0; i < numThreads; ++i) {
-                // iterate over all pending sources
-                for (_PendingSourceList::iterator reqIt = _pendingSources.begin();
-                     reqIt != _pendingSources.end(); ++reqIt) {
-                    TF_FOR_ALL(sourceIt, reqIt->sources) {
-                        // execute computation.
-                        // call IsResolved first since Resolve is virtual and
-                        // could be costly.
-                        if (!(*sourceIt)->IsResolved()) {
-                            if ((*sourceIt)->Resolve()) {
-                                TF_VERIFY((*sourceIt)->IsResolved(), 
-                                "Name = %s", (*sourceIt)->GetName().GetText());
-
-                                ++numBufferSourcesResolved;
-
-                                // call resize if it's the first source in sources.
-                                if (reqIt->range &&
-                                    (sourceIt.base() == reqIt->sources.begin())) {
-                                    reqIt->range->Resize(
-                                        (*sourceIt)->GetNumElements());
-                                }
+            // Gather the sources that still need resolving.
+            // call IsResolved first since Resolve is virtual and
+            // could be costly.
+            sweepSources.clear();
+            for (_PendingSourceList::iterator reqIt = _pendingSources.begin();
+                 reqIt != _pendingSources.end(); ++reqIt) {
+                TF_FOR_ALL(sourceIt, reqIt->sources) {
+                    if (!(*sourceIt)->IsResolved()) {
+                        sweepSources.push_back(sourceIt->get());
+                    }
+                }
+            }
+
+            // Execute the sweep's computations as one parallel dispatch.
+            // Many of these sources are small (e.g. per-prim CPU ext
+            // computations), so the blocked ranges batch them together
+            // rather than paying scheduling overhead per source.
+            // Sources whose dependencies aren't resolved yet simply
+            // return false and are picked up by the next sweep.
+            static const size_t parallelThreshold = 32;
+            if (sweepSources.size() >= parallelThreshold) {
+                WorkParallelForN(sweepSources.size(),
+                    [&sweepSources](size_t begin, size_t end) {
+                        for (size_t i = begin; i < end; ++i) {
+                            if (sweepSources[i]->Resolve()) {
+                                TF_VERIFY(sweepSources[i]->IsResolved(),
+                                "Name = %s",
+                                sweepSources[i]->GetName().GetText());
                             }
                         }
+                    });
+            } else {
+                for (size_t i = 0; i < sweepSources.size(); ++i) {
+                    if (sweepSources[i]->Resolve()) {
+                        TF_VERIFY(sweepSources[i]->IsResolved(),
+                        "Name = %s", sweepSources[i]->GetName().GetText());
                     }
                 }
             }
+
+            // Account for what the sweep resolved, and resize ranges
+            // whose first source is now resolved.
+            if (rangeResized.size() < _pendingSources.size()) {
+                rangeResized.resize(_pendingSources.size(), false);
+            }
+            numBufferSourcesResolved = 0;
+            size_t reqNum = 0;
+            for (_PendingSourceList::iterator reqIt = _pendingSources.begin();
+                 reqIt != _pendingSources.end(); ++reqIt, ++reqNum) {
+                TF_FOR_ALL(sourceIt, reqIt->sources) {
+                    if ((*sourceIt)->IsResolved()) {
+                        ++numBufferSourcesResolved;
+
+                        // call resize if it's the first source in sources.
+                        if (reqIt->range && !rangeResized[reqNum] &&
+                            (sourceIt.base() == reqIt->sources.begin())) {
+                            reqIt->range->Resize(
+                                (*sourceIt)->GetNumElements());
+                            rangeResized[reqNum] = true;
+                        }
+                    }
+                }
+            }
+
             if (++numIterations > 100) {
                 TF_WARN("Too many iterations in resolving buffer source. "
                         "It's likely due to incosistent dependency.");
@@ -605,6 +647,20 @@ HdResourceRegistry::GarbageCollect()
     // cleanup buffer array
     // buffer array retains weak_ptrs of range. All unused ranges should be
     // deleted (expired) at this point.
+
+    // give strategies a chance to reset per-pass state (such as
+    // compaction budgets) before the buffer arrays are collected.
+    if (_nonUniformAggregationStrategy)
+        _nonUniformAggregationStrategy->StartGarbageCollection();
+    if (_nonUniformImmutableAggregationStrategy)
+        _nonUniformImmutableAggregationStrategy->StartGarbageCollection();
+    if (_uniformUboAggregationStrategy)
+        _uniformUboAggregationStrategy->StartGarbageCollection();
+    if (_uniformSsboAggregationStrategy)
+        _uniformSsboAggregationStrategy->StartGarbageCollection();
+    if (_singleAggregationStrategy)
+        _singleAggregationStrategy->StartGarbageCollection();
+
     _nonUniformBufferArrayRegistry.GarbageCollect();
     _nonUniformImmutableBufferArrayRegistry.GarbageCollect();
     _uniformUboBufferArrayRegistry.GarbageCollect();
@@ -628,6 +684,22 @@ HdResourceRegistry::_GarbageCollect()
     /* NOTHING */
 }
 
+bool
+HdResourceRegistry::NeedsMoreGarbageCollection() const
+{
+    return (_nonUniformAggregationStrategy &&
+            _nonUniformAggregationStrategy->NeedsMoreGarbageCollection())
+        || (_nonUniformImmutableAggregationStrategy &&
+            _nonUniformImmutableAggregationStrategy->
+                NeedsMoreGarbageCollection())
+        || (_uniformUboAggregationStrategy &&
+            _uniformUboAggregationStrategy->NeedsMoreGarbageCollection())
+        || (_uniformSsboAggregationStrategy &&
+            _uniformSsboAggregationStrategy->NeedsMoreGarbageCollection())
+        || (_singleAggregationStrategy &&
+            _singleAggregationStrategy->NeedsMoreGarbageCollection());
+}
+
 VtDictionary
 HdResourceRegistry::GetResourceAllocation() const
 {
@@ -184,6 +184,12 @@ public:
     HD_API
     void GarbageCollect();
 
+    /// Returns true if the last GarbageCollect() deferred some work
+    /// (e.g. buffer compaction) to stay within its per-pass budget, so
+    /// another pass should be scheduled.
+    HD_API
+    bool NeedsMoreGarbageCollection() const;
+
     /// Set the aggregation strategy for non uniform parameters
     /// (vertex, varying, facevarying)
     /// Takes ownership of the passed in strategy object.
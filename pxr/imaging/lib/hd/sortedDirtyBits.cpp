@@ -0,0 +1,132 @@
+//
+// Copyright 2017 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#include "pxr/imaging/hd/sortedDirtyBits.h"
+
+#include <algorithm>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+// Entries are ordered by id only; the bits ride along.
+static bool
+_EntryLess(const std::pair<SdfPath, HdDirtyBits> &lhs,
+           const std::pair<SdfPath, HdDirtyBits> &rhs)
+{
+    return lhs.first < rhs.first;
+}
+
+Hd_SortedDirtyBits::Hd_SortedDirtyBits()
+    : _entries()
+    , _sortedCount(0)
+{
+}
+
+void
+Hd_SortedDirtyBits::Insert(const SdfPath &id, HdDirtyBits bits)
+{
+    _entries.push_back(_Entry(id, bits));
+
+    // Appending a single id to an already sorted list in order keeps
+    // it sorted (common when prims arrive in namespace order).
+    if (_sortedCount + 1 == _entries.size() &&
+            (_entries.size() == 1 ||
+             _entries[_entries.size() - 2].first < id)) {
+        ++_sortedCount;
+    }
+}
+
+void
+Hd_SortedDirtyBits::Remove(const SdfPath &id)
+{
+    _Sort();
+
+    _EntryVector::iterator it =
+        std::lower_bound(_entries.begin(), _entries.end(),
+                         _Entry(id, 0), _EntryLess);
+    if (it == _entries.end() || it->first != id) {
+        return;
+    }
+    _entries.erase(it);
+    _sortedCount = _entries.size();
+}
+
+HdDirtyBits *
+Hd_SortedDirtyBits::Find(const SdfPath &id) const
+{
+    _Sort();
+
+    _EntryVector::iterator it =
+        std::lower_bound(_entries.begin(), _entries.end(),
+                         _Entry(id, 0), _EntryLess);
+    if (it == _entries.end() || it->first != id) {
+        return nullptr;
+    }
+    return &it->second;
+}
+
+std::pair<size_t, size_t>
+Hd_SortedDirtyBits::GetSubtreeRange(const SdfPath &root) const
+{
+    _Sort();
+
+    _EntryVector::iterator first =
+        std::lower_bound(_entries.begin(), _entries.end(),
+                         _Entry(root, 0), _EntryLess);
+
+    // Paths sort with descendants immediately following their
+    // ancestors, so the subtree ends at the first id that doesn't
+    // have root as a prefix.
+    _EntryVector::iterator last = first;
+    while (last != _entries.end() && last->first.HasPrefix(root)) {
+        ++last;
+    }
+
+    return std::make_pair(first - _entries.begin(),
+                          last - _entries.begin());
+}
+
+void
+Hd_SortedDirtyBits::_Sort() const
+{
+    if (_sortedCount == _entries.size()) {
+        return;
+    }
+    // A stable sort keeps re-inserted ids after their stale entry, so
+    // the dedupe pass below can keep the most recent bits.
+    std::stable_sort(_entries.begin(), _entries.end(), _EntryLess);
+
+    size_t kept = 0;
+    for (size_t i = 0, n = _entries.size(); i != n; ++i) {
+        if (i + 1 != n && _entries[i].first == _entries[i + 1].first) {
+            continue;
+        }
+        if (kept != i) {
+            _entries[kept] = _entries[i];
+        }
+        ++kept;
+    }
+    _entries.resize(kept);
+    _sortedCount = _entries.size();
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
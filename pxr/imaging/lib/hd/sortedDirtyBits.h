@@ -0,0 +1,112 @@
+//
+// Copyright 2017 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef HD_SORTED_DIRTY_BITS_H
+#define HD_SORTED_DIRTY_BITS_H
+
+#include "pxr/pxr.h"
+#include "pxr/imaging/hd/api.h"
+#include "pxr/imaging/hd/types.h"
+
+#include "pxr/usd/sdf/path.h"
+
+#include <utility>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+///
+/// Maps prim Ids to their dirty bits, keeping the entries sorted by Id
+/// so that all prims beneath a common root occupy a contiguous range.
+///
+/// Subtree invalidation thereby becomes one range lookup followed by a
+/// linear sweep over packed storage, instead of a hash map operation
+/// per descendant.
+///
+/// Like Hd_SortedIds, sorting is deferred so that inserting a large
+/// number of prims at once (scene population) stays cheap; the list is
+/// sorted on the next lookup.
+///
+class Hd_SortedDirtyBits {
+public:
+    HD_API
+    Hd_SortedDirtyBits();
+
+    HD_API
+    ~Hd_SortedDirtyBits() = default;
+
+    /// Add an id with its initial dirty bits.  Inserting an id that is
+    /// already present replaces its bits.
+    HD_API
+    void Insert(const SdfPath &id, HdDirtyBits bits);
+
+    /// Remove an id from the collection.
+    HD_API
+    void Remove(const SdfPath &id);
+
+    /// Returns a pointer to the dirty bits of \p id, or NULL if the id
+    /// is not in the collection.  The pointer is valid until the next
+    /// Insert() or Remove().
+    HD_API
+    HdDirtyBits *Find(const SdfPath &id) const;
+
+    /// Returns the index range [first, second) of the entries whose
+    /// ids have \p root as a prefix (including \p root itself).
+    HD_API
+    std::pair<size_t, size_t> GetSubtreeRange(const SdfPath &root) const;
+
+    /// Number of entries.
+    size_t GetSize() const {
+        return _entries.size();
+    }
+
+    /// The id of the entry at \p index, in sorted order.
+    const SdfPath &GetId(size_t index) const {
+        _Sort();
+        return _entries[index].first;
+    }
+
+    /// The dirty bits of the entry at \p index, in sorted order.
+    HdDirtyBits &GetBits(size_t index) const {
+        _Sort();
+        return _entries[index].second;
+    }
+
+private:
+    typedef std::pair<SdfPath, HdDirtyBits> _Entry;
+    typedef std::vector<_Entry> _EntryVector;
+
+    void _Sort() const;
+
+    // Lookups sort lazily, so the storage is mutable; the ids
+    // themselves never change, only their order and their bits.
+    mutable _EntryVector _entries;
+    mutable size_t       _sortedCount;
+
+    Hd_SortedDirtyBits(const Hd_SortedDirtyBits &) = delete;
+    Hd_SortedDirtyBits &operator =(const Hd_SortedDirtyBits &) = delete;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HD_SORTED_DIRTY_BITS_H
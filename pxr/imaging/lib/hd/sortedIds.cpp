@@ -24,18 +24,13 @@
 #include "pxr/imaging/hd/sortedIds.h"
 #include "pxr/imaging/hd/perfLog.h"
 
-PXR_NAMESPACE_OPEN_SCOPE
+#include <algorithm>
 
-//
-// Tweakable value
-//
-// If the ids are already at least this percent sorted, use
-// insert sort rather than a full sort.
-//
-static const size_t SORTED_PERCENT = 90;
+PXR_NAMESPACE_OPEN_SCOPE
 
 Hd_SortedIds::Hd_SortedIds()
  : _ids()
+ , _removedIds()
  , _sortedCount(0)
 {
 
@@ -43,6 +38,7 @@ Hd_SortedIds::Hd_SortedIds()
 
 Hd_SortedIds::Hd_SortedIds(Hd_SortedIds &&other)
  : _ids(std::move(other._ids))
+ , _removedIds(std::move(other._removedIds))
  , _sortedCount(other._sortedCount)
 {
 }
@@ -51,6 +47,7 @@ const SdfPathVector &
 Hd_SortedIds::GetIds()
 {
     _Sort();
+    _Compact();
     return _ids;
 }
 
@@ -61,54 +58,21 @@ Hd_SortedIds::Insert(const SdfPath &id)
 }
 
 void
-Hd_SortedIds::Remove(const SdfPath &id)
+Hd_SortedIds::Insert(const SdfPathVector &ids)
 {
-    // The first implementation of this deletion code deleted the
-    // element in place.  This kept the list sorted, but was a
-    // performance issue on unloading a stage as a lot of prims
-    // get removed and the shifting of the vector become a bottleneck
-    // So instead, we do a more efficient removal (by swapping the
-    // element to be removed with the element on the end of the vector).
-    // The down side is that the list is now unsorted, so needs to be
-    // sorted again (which is deferred).
-    //
-    // However, this means that the list is now unsorted in mass removal.
-    // In order to use the binary search, we need a sorted list, but sorting
-    // again would be too expensive in this case, so if the list is not sorted
-    // fallback to a linear search for the id to be removed.
-
-    SdfPathVector::iterator idToRemove;
-    if (_sortedCount == _ids.size()) {
-        // Sorted, so use binary search
-        idToRemove = std::lower_bound(_ids.begin(),
-                                      _ids.end(),
-                                      id);
-    } else {
-        // Unsorted, so use linear search
-        idToRemove = std::find(_ids.begin(),
-                               _ids.end(),
-                               id);
-    }
-
-    if (idToRemove != _ids.end()) {
-        if (*idToRemove == id) {
-            SdfPathVector::iterator lastElement = _ids.end();
-            --lastElement;
-
-            std::iter_swap(idToRemove, lastElement);
-
-            _ids.pop_back();
-
-            // As we've moved an element from the end into the middle
-            // the list is now only sorted up to the place where the element
-            // was removed.
-
+    _ids.insert(_ids.end(), ids.begin(), ids.end());
+}
 
-            _sortedCount = std::min(_sortedCount,
-                                    static_cast<size_t>(
-                                              (idToRemove - _ids.begin())));
-        }
-    }
+void
+Hd_SortedIds::Remove(const SdfPath &id)
+{
+    // Removals are deferred: the id is recorded and one matching
+    // instance is dropped by a single compaction pass on the next
+    // GetIds() call.  Earlier implementations searched for and removed
+    // the element here, which made mass removal (such as unloading a
+    // stage) quadratic: each removal either shifted the vector or broke
+    // the sort and forced linear searches for the removals after it.
+    _removedIds.push_back(id);
 }
 
 
@@ -118,7 +82,7 @@ void Hd_SortedIds::RemoveRange(size_t start, size_t end)
     size_t numIds = _ids.size();
     size_t numToRemove = (end - start + 1);
 
-    if (_sortedCount != numIds) {
+    if (_sortedCount != numIds || !_removedIds.empty()) {
         TF_CODING_ERROR("RemoveRange can only be called while list sorted\n");
         return;
     }
@@ -139,52 +103,70 @@ void
 Hd_SortedIds::Clear()
 {
     _ids.clear();
+    _removedIds.clear();
     _sortedCount = 0;
 }
 
 void
-Hd_SortedIds::_InsertSort()
+Hd_SortedIds::_Sort()
 {
-    SdfPathVector::iterator sortPosIt = _ids.begin();
-    // skip already sorted items
-    sortPosIt += _sortedCount;
+    HD_TRACE_FUNCTION();
 
-    while (sortPosIt != _ids.end()) {
-        SdfPathVector::iterator insertPosIt = std::lower_bound(_ids.begin(),
-                                                               sortPosIt,
-                                                               *sortPosIt);
+    size_t numIds = _ids.size();
 
-        std::rotate(insertPosIt, sortPosIt, sortPosIt + 1);
-        ++sortPosIt;
+    if (_sortedCount == numIds) {
+        return;
     }
-}
 
-void
-Hd_SortedIds::_FullSort()
-{
-    std::sort(_ids.begin(), _ids.end());
+    // Sort only the newly inserted tail and merge it with the
+    // already-sorted prefix, so that bulk insertion during population
+    // costs O(k log k + n) for k new ids rather than re-sorting all
+    // n ids.
+    std::sort(_ids.begin() + _sortedCount, _ids.end());
+
+    if (_sortedCount > 0) {
+        std::inplace_merge(_ids.begin(),
+                           _ids.begin() + _sortedCount,
+                           _ids.end());
+    }
+
+    _sortedCount = numIds;
 }
 
 void
-Hd_SortedIds::_Sort()
+Hd_SortedIds::_Compact()
 {
     HD_TRACE_FUNCTION();
 
-    size_t numIds = _ids.size();
-
-
-    if (_sortedCount == numIds) {
+    if (_removedIds.empty()) {
         return;
     }
 
-    //   (_sortedCount / numIds) * 100 > SORTED_PERCENT
-    if (100 * _sortedCount > SORTED_PERCENT * numIds) {
-        _InsertSort();
-    } else {
-        _FullSort();
+    std::sort(_removedIds.begin(), _removedIds.end());
+
+    // Both lists are now sorted (_Sort() runs before compaction), so a
+    // single merge-walk drops one instance of each removed id.  Removed
+    // ids with no matching element are ignored, as Remove() always has.
+    SdfPathVector::iterator writeIt = _ids.begin();
+    SdfPathVector::const_iterator removeIt = _removedIds.begin();
+    for (SdfPathVector::iterator readIt = _ids.begin();
+         readIt != _ids.end(); ++readIt) {
+        while (removeIt != _removedIds.end() && *removeIt < *readIt) {
+            ++removeIt;
+        }
+        if (removeIt != _removedIds.end() && *removeIt == *readIt) {
+            ++removeIt;
+            continue;
+        }
+        if (writeIt != readIt) {
+            *writeIt = std::move(*readIt);
+        }
+        ++writeIt;
     }
 
-    _sortedCount = numIds;
+    _ids.erase(writeIt, _ids.end());
+    _removedIds.clear();
+    _sortedCount = _ids.size();
 }
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -34,11 +34,12 @@ PXR_NAMESPACE_OPEN_SCOPE
 ///
 /// Manages a container of Hydra Ids in a sorted order.
 ///
-/// For performance reasons, sorting of the list is deferred
-/// due to inserting a large number of items at once.
-///
-/// The class chooses the type of sort based on how many unsorted items
-/// there are in the list.
+/// For performance reasons, maintenance of the list is deferred: newly
+/// inserted ids are appended and sorted lazily by sorting only the new
+/// batch and merging it with the sorted prefix, and removed ids are
+/// recorded and dropped in a single compaction pass.  Both happen on
+/// GetIds(), so the cost of an update is amortized linear in the size
+/// of the change rather than in the size of the list.
 ///
 class Hd_SortedIds {
 public:
@@ -59,6 +60,10 @@ public:
     HD_API
     void Insert(const SdfPath &id);
 
+    /// Add a batch of ids to the collection.
+    HD_API
+    void Insert(const SdfPathVector &ids);
+
     /// Remove an id from the collection.
     HD_API
     void Remove(const SdfPath &id);
@@ -75,11 +80,11 @@ public:
 
 private:
     SdfPathVector _ids;
+    SdfPathVector _removedIds;
     size_t        _sortedCount;
 
-    void _InsertSort();
-    void _FullSort();
     void _Sort();
+    void _Compact();
 
     Hd_SortedIds(const Hd_SortedIds &) = delete;
     Hd_SortedIds &operator =(const Hd_SortedIds &) = delete;
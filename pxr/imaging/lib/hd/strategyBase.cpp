@@ -30,5 +30,19 @@ HdAggregationStrategy::~HdAggregationStrategy()
 {
 }
 
+/*virtual*/
+void
+HdAggregationStrategy::StartGarbageCollection()
+{
+    /*NOTHING*/
+}
+
+/*virtual*/
+bool
+HdAggregationStrategy::NeedsMoreGarbageCollection() const
+{
+    return false;
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
 
@@ -73,6 +73,18 @@ public:
     virtual size_t GetResourceAllocation(
         HdBufferArraySharedPtr const &bufferArray, 
         VtDictionary &result) const = 0;
+
+    /// Called at the start of a garbage collection pass over the
+    /// buffer arrays using this strategy.  Lets the strategy reset
+    /// per-pass state, such as compaction work budgets.
+    HD_API
+    virtual void StartGarbageCollection();
+
+    /// Returns true if the last garbage collection pass deferred some
+    /// of its work to stay within budget, so another pass should be
+    /// scheduled.
+    HD_API
+    virtual bool NeedsMoreGarbageCollection() const;
 };
 
 
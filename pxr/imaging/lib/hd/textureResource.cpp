@@ -41,6 +41,22 @@ TF_DEFINE_PRIVATE_TOKENS(
     ((fallbackUVPath, "UvNoNsEnSe"))
 );
 
+// Prefer the ARB entry points so the bindless path works on any driver
+// exposing ARB_bindless_texture, falling back to the NV aliases.
+static void
+_MakeTextureHandleResident(GLuint64 handle)
+{
+    if (glMakeTextureHandleResidentARB) {
+        if (!glIsTextureHandleResidentARB(handle)) {
+            glMakeTextureHandleResidentARB(handle);
+        }
+    } else {
+        if (!glIsTextureHandleResidentNV(handle)) {
+            glMakeTextureHandleResidentNV(handle);
+        }
+    }
+}
+
 HdTextureResource::~HdTextureResource()
 {
 }
@@ -155,17 +171,13 @@ HdSimpleTextureResource::HdSimpleTextureResource(
     if (bindlessTexture) {
         size_t handle = GetTexelsTextureHandle();
         if (handle) {
-            if (!glIsTextureHandleResidentNV(handle)) {
-                glMakeTextureHandleResidentNV(handle);
-            }
+            _MakeTextureHandleResident(handle);
         }
 
         if (_isPtex) {
             handle = GetLayoutTextureHandle();
             if (handle) {
-                if (!glIsTextureHandleResidentNV(handle)) {
-                    glMakeTextureHandleResidentNV(handle);
-                }
+                _MakeTextureHandleResident(handle);
             }
         }
     }
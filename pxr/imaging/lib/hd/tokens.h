@@ -106,6 +106,7 @@ PXR_NAMESPACE_OPEN_SCOPE
     (ulocResetPass)                             \
     (ulocCullMatrix)                            \
     (ulocDrawRangeNDC)                          \
+    (ulocOcclusionMipLevels)                    \
     (rightHanded)                               \
     (segmented)                                 \
     (smoothHull)                                \
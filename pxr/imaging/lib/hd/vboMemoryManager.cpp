@@ -47,6 +47,10 @@ PXR_NAMESPACE_OPEN_SCOPE
 TF_DEFINE_ENV_SETTING(HD_MAX_VBO_SIZE, (1*1024*1024*1024),
                       "Maximum aggregated VBO size");
 
+TF_DEFINE_ENV_SETTING(HD_VBO_COMPACTION_BUDGET, (64*1024*1024),
+                      "Maximum number of bytes VBO compaction may relocate "
+                      "per garbage collection pass (0 = unlimited)");
+
 // ---------------------------------------------------------------------------
 //  HdVBOMemoryManager
 // ---------------------------------------------------------------------------
@@ -56,7 +60,38 @@ HdVBOMemoryManager::CreateBufferArray(
     HdBufferSpecVector const &bufferSpecs)
 {
     return boost::make_shared<HdVBOMemoryManager::_StripedBufferArray>(
-        role, bufferSpecs, _isImmutable);
+        this, role, bufferSpecs, _isImmutable);
+}
+
+/*virtual*/
+void
+HdVBOMemoryManager::StartGarbageCollection()
+{
+    static size_t budget = std::max(0, TfGetEnvSetting(HD_VBO_COMPACTION_BUDGET));
+    _compactionBytesRemaining =
+        (budget == 0) ? std::numeric_limits<size_t>::max() : budget;
+    _deferredCompaction = false;
+}
+
+/*virtual*/
+bool
+HdVBOMemoryManager::NeedsMoreGarbageCollection() const
+{
+    return _deferredCompaction;
+}
+
+bool
+HdVBOMemoryManager::_ConsumeCompactionBudget(size_t bytes)
+{
+    // Let the request that exhausts the budget through, so a pass
+    // always makes progress even if one array exceeds the budget on
+    // its own.
+    if (_compactionBytesRemaining == 0) {
+        _deferredCompaction = true;
+        return false;
+    }
+    _compactionBytesRemaining -= std::min(bytes, _compactionBytesRemaining);
+    return true;
 }
 
 
@@ -135,10 +170,12 @@ HdVBOMemoryManager::GetResourceAllocation(
 //  _StripedBufferArray
 // ---------------------------------------------------------------------------
 HdVBOMemoryManager::_StripedBufferArray::_StripedBufferArray(
+    HdVBOMemoryManager *manager,
     TfToken const &role,
     HdBufferSpecVector const &bufferSpecs,
     bool isImmutable)
     : HdBufferArray(role, HdPerfTokens->garbageCollectedVbo, isImmutable),
+      _manager(manager),
       _needsCompaction(false),
       _totalCapacity(0),
       _maxBytesPerElement(0)
@@ -257,12 +294,32 @@ HdVBOMemoryManager::_StripedBufferArray::GarbageCollect()
         std::vector<HdBufferArrayRangeSharedPtr> ranges;
         size_t rangeCount = GetRangeCount();
         ranges.reserve(rangeCount);
+        size_t totalNumElements = 0;
         for (size_t i = 0; i < rangeCount; ++i) {
             HdBufferArrayRangeSharedPtr range = GetRange(i).lock();
-            if (range)
+            if (range) {
                 ranges.push_back(range);
+                totalNumElements += range->GetNumElements();
+            }
+        }
+
+        // Compaction copies every surviving range into a fresh VBO, so
+        // estimate that cost and charge it against the per-pass budget;
+        // if the budget has run out, stay marked for compaction and let
+        // a later pass pick this array up, keeping frame times stable
+        // when many ranges die at once.
+        size_t bytesPerElement = 0;
+        TF_FOR_ALL (resIt, GetResources()) {
+            HdBufferResourceGLSharedPtr const &bres = resIt->second;
+            bytesPerElement +=
+                bres->GetNumComponents() * bres->GetComponentSize();
+        }
+
+        if (!_manager ||
+            _manager->_ConsumeCompactionBudget(
+                totalNumElements * bytesPerElement)) {
+            Reallocate(ranges, shared_from_this());
         }
-        Reallocate(ranges, shared_from_this());
     }
 
     if (GetRangeCount() == 0) {
@@ -682,14 +739,22 @@ HdVBOMemoryManager::_StripedBufferArrayRange::CopyData(
         }
         GLintptr vboOffset = bytesPerElement * _offset;
 
-        HD_PERF_COUNTER_INCR(HdPerfTokens->glBufferSubData);
-
-        if (ARCH_LIKELY(caps.directStateAccessEnabled)) {
+        HdGLStagingRing &stagingRing = HdGLStagingRing::GetInstance();
+        if (stagingRing.IsEnabled()) {
+            // stream through the persistently mapped upload ring, so
+            // that large commits don't stall on driver-side staging.
+            stagingRing.Upload(VBO->GetId(),
+                               vboOffset,
+                               srcSize,
+                               bufferSource->GetData());
+        } else if (ARCH_LIKELY(caps.directStateAccessEnabled)) {
+            HD_PERF_COUNTER_INCR(HdPerfTokens->glBufferSubData);
             glNamedBufferSubDataEXT(VBO->GetId(),
                                     vboOffset,
                                     srcSize,
                                     bufferSource->GetData());
         } else {
+            HD_PERF_COUNTER_INCR(HdPerfTokens->glBufferSubData);
             glBindBuffer(GL_ARRAY_BUFFER, VBO->GetId());
             glBufferSubData(GL_ARRAY_BUFFER,
                             vboOffset,
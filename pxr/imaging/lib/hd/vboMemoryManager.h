@@ -37,6 +37,7 @@
 #include "pxr/base/tf/token.h"
 
 #include <boost/shared_ptr.hpp>
+#include <limits>
 #include <list>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -48,7 +49,10 @@ PXR_NAMESPACE_OPEN_SCOPE
 ///
 class HdVBOMemoryManager : public HdAggregationStrategy {
 public:
-    HdVBOMemoryManager(bool isImmutable) : _isImmutable(isImmutable) {}
+    HdVBOMemoryManager(bool isImmutable)
+        : _isImmutable(isImmutable),
+          _compactionBytesRemaining(std::numeric_limits<size_t>::max()),
+          _deferredCompaction(false) {}
 
     /// Factory for creating HdBufferArray managed by
     /// HdVBOMemoryManager aggregation.
@@ -73,12 +77,34 @@ public:
 
     /// Returns the size of the GPU memory used by the passed buffer array
     virtual size_t GetResourceAllocation(
-        HdBufferArraySharedPtr const &bufferArray, 
+        HdBufferArraySharedPtr const &bufferArray,
         VtDictionary &result) const;
 
+    /// Resets the per-pass compaction budget, so the next garbage
+    /// collection pass again relocates up to HD_VBO_COMPACTION_BUDGET
+    /// bytes.
+    HD_API
+    virtual void StartGarbageCollection();
+
+    /// Returns true if a buffer array deferred its compaction to stay
+    /// within the budget during the last pass.
+    HD_API
+    virtual bool NeedsMoreGarbageCollection() const;
+
 private:
     bool _isImmutable;
 
+    // Bounds the bytes the garbage collection pass currently under way
+    // may relocate; buffer arrays whose compaction doesn't fit stay
+    // marked and set _deferredCompaction so another pass is scheduled.
+    size_t _compactionBytesRemaining;
+    bool _deferredCompaction;
+
+    // Claims up to \p bytes of the current pass's compaction budget.
+    // Returns false (and flags the deferral) when the budget has run
+    // out.
+    bool _ConsumeCompactionBudget(size_t bytes);
+
 protected:
     class _StripedBufferArray;
 
@@ -229,7 +255,8 @@ protected:
     public:
         /// Constructor.
         HD_API
-        _StripedBufferArray(TfToken const &role,
+        _StripedBufferArray(HdVBOMemoryManager *manager,
+                            TfToken const &role,
                             HdBufferSpecVector const &bufferSpecs,
                             bool isImmutable);
 
@@ -306,6 +333,9 @@ protected:
                                             int stride);
 
     private:
+        // The memory manager that created this buffer array; consulted
+        // for the per-pass compaction budget.
+        HdVBOMemoryManager *_manager;
 
         bool _needsCompaction;
         int _totalCapacity;
@@ -30,8 +30,17 @@
 
 #include "pxr/imaging/hf/perfLog.h"
 
+#include "pxr/base/arch/defines.h"
 #include "pxr/base/work/loops.h"
 
+#include <atomic>
+#include <memory>
+
+#if defined(ARCH_CPU_INTEL) && defined(__SSE2__)
+#include <emmintrin.h>
+#define HD_ADJACENCY_USE_SSE2
+#endif
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 
@@ -50,6 +59,64 @@ Hd_VertexAdjacency::~Hd_VertexAdjacency()
 }
 
 
+#if defined(HD_ADJACENCY_USE_SSE2)
+
+// Loads a GfVec3f into the low three lanes of an SSE register without
+// reading past the end of the points array.
+static inline __m128
+_LoadVec3(GfVec3f const &v)
+{
+    return _mm_set_ps(0.0f, v[2], v[1], v[0]);
+}
+
+// Cross product using the same per-component operations as GfCross, so
+// the result is bit-identical to the scalar path.
+static inline __m128
+_CrossVec3(__m128 a, __m128 b)
+{
+    __m128 aYZX = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3,0,2,1));
+    __m128 bZXY = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3,1,0,2));
+    __m128 aZXY = _mm_shuffle_ps(a, a, _MM_SHUFFLE(3,1,0,2));
+    __m128 bYZX = _mm_shuffle_ps(b, b, _MM_SHUFFLE(3,0,2,1));
+    return _mm_sub_ps(_mm_mul_ps(aYZX, bZXY), _mm_mul_ps(aZXY, bYZX));
+}
+
+// Accumulates the cross products of the edges incident to a point,
+// computing all three normal components at once.
+static inline GfVec3f
+_AccumulateNormal(GfVec3f const *pointsPtr, GfVec3f const &curr,
+                  int const *e, int valence)
+{
+    __m128 c = _LoadVec3(curr);
+    __m128 normal = _mm_setzero_ps();
+    for (int j = 0; j < valence; ++j) {
+        __m128 prev = _mm_sub_ps(_LoadVec3(pointsPtr[*e++]), c);
+        __m128 next = _mm_sub_ps(_LoadVec3(pointsPtr[*e++]), c);
+        // All meshes have all been converted to rightHanded
+        normal = _mm_add_ps(normal, _CrossVec3(next, prev));
+    }
+    float result[4];
+    _mm_storeu_ps(result, normal);
+    return GfVec3f(result[0], result[1], result[2]);
+}
+
+#endif // HD_ADJACENCY_USE_SSE2
+
+template <typename SrcVec3Type>
+static inline SrcVec3Type
+_AccumulateNormal(SrcVec3Type const *pointsPtr, SrcVec3Type const &curr,
+                  int const *e, int valence)
+{
+    SrcVec3Type normal(0);
+    for (int j = 0; j < valence; ++j) {
+        SrcVec3Type const & prev = pointsPtr[*e++];
+        SrcVec3Type const & next = pointsPtr[*e++];
+        // All meshes have all been converted to rightHanded
+        normal += GfCross(next-curr, prev-curr);
+    }
+    return normal;
+}
+
 template <typename SrcVec3Type, typename DstType>
 class _SmoothNormalsWorker
 {
@@ -71,14 +138,8 @@ public:
             int valence = _adjacencyTable[offsetIdx + 1];
 
             int const * e = &_adjacencyTable[offset];
-            SrcVec3Type normal(0);
-            SrcVec3Type const & curr = _pointsPtr[i];
-            for (int j=0; j<valence; ++j) {
-                SrcVec3Type const & prev = _pointsPtr[*e++];
-                SrcVec3Type const & next = _pointsPtr[*e++];
-                // All meshes have all been converted to rightHanded
-                normal += GfCross(next-curr, prev-curr);
-            }
+            SrcVec3Type normal =
+                _AccumulateNormal(_pointsPtr, _pointsPtr[i], e, valence);
             if (true) { // Could defer normalization to shader code
                 normal.Normalize();
             }
@@ -166,35 +227,62 @@ Hd_VertexAdjacency::BuildAdjacencyTable(HdMeshTopology const *topology)
         topology->GetFaceVertexIndices());
 
 
-    // Track the number of entries needed the adjacency table.
-    // We start by needing 2 per point (offset and valence).
-    size_t numEntries = _numPoints * 2;
-
-
-    // Compute the size of each entry, so we can work out the offsets.
-    std::vector<int> vertexValence(_numPoints);
-
+    int numPoints = _numPoints;
 
+    // Compute the offset of the first vertex of each face within the
+    // index buffer, so faces can be processed in parallel below.
+    std::vector<int> faceOffsets(numFaces);
     int vertIndex = 0;
     for (int i=0; i<numFaces; ++i) {
-        int nv = numVertsPtr[i];
-        for (int j=0; j<nv; ++j) {
-            int index = vertsPtr[vertIndex++];
-            if (index < 0 || index >= _numPoints) {
-                TF_CODING_ERROR("vertex index out of range "
-                                "index: %d numPoints: %d", index, _numPoints);
-                _numPoints = 0;
-                _adjacencyTable.clear();
-                return false;
-            }
-            ++vertexValence[index];
-        }
-
-        // Increase the number of entries needed by 2 (prev & next index).
-        // for every vertex in the face.
-        numEntries += 2 * nv;
+        faceOffsets[i] = vertIndex;
+        vertIndex += numVertsPtr[i];
     }
+    int numCorners = vertIndex;
 
+    // Track the number of entries needed the adjacency table.
+    // We need 2 per point (offset and valence), plus 2 (prev & next
+    // index) for every vertex in every face.
+    size_t numEntries = numPoints * 2 + numCorners * 2;
+
+    // Compute the valence of each point as a parallel histogram,
+    // validating indices as we go.  The counters are reused to claim
+    // entry slots when the table is filled out below.
+    std::unique_ptr<std::atomic<int>[]> counts(
+        new std::atomic<int>[numPoints]);
+    WorkParallelForN(numPoints,
+        [&counts](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                counts[i].store(0, std::memory_order_relaxed);
+            }
+        });
+
+    std::atomic<bool> valid(true);
+    std::atomic<int> invalidIndex(0);
+    WorkParallelForN(numFaces,
+        [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                int nv = numVertsPtr[i];
+                int const * verts = vertsPtr + faceOffsets[i];
+                for (int j=0; j<nv; ++j) {
+                    int index = verts[j];
+                    if (index < 0 || index >= numPoints) {
+                        invalidIndex.store(index,
+                                           std::memory_order_relaxed);
+                        valid.store(false, std::memory_order_relaxed);
+                        return;
+                    }
+                    counts[index].fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    if (!valid.load()) {
+        TF_CODING_ERROR("vertex index out of range "
+                        "index: %d numPoints: %d",
+                        invalidIndex.load(), _numPoints);
+        _numPoints = 0;
+        _adjacencyTable.clear();
+        return false;
+    }
 
     // Each entry is a count followed by pairs of adjacent vertex indices.
     // We use a uniform entry size for all vertices, this allows faster
@@ -208,35 +296,105 @@ Hd_VertexAdjacency::BuildAdjacencyTable(HdMeshTopology const *topology)
     HD_PERF_COUNTER_ADD(HdPerfTokens->adjacencyBufSize,
                                                       numEntries * sizeof(int));
 
-    // Fill out first part of buffer with offsets.  Even though we
-    // know counts, don't fill them out now, so we know how many indices
-    // we've written so far.
-    int currentOffset = _numPoints * 2;
-    for (int pointNum = 0; pointNum < _numPoints; ++pointNum) {
-        _adjacencyTable[pointNum * 2] = currentOffset;
-        currentOffset += 2*vertexValence[pointNum];
-    }
-
-    vertIndex = 0;
-    for (int i=0; i<numFaces; ++i) {
-        int nv = numVertsPtr[i];
-        for (int j=0; j<nv; ++j) {
-            int prev = vertsPtr[vertIndex+(j+nv-1)%nv];
-            int curr = vertsPtr[vertIndex+j];
-            int next = vertsPtr[vertIndex+(j+1)%nv];
-            if (flip) std::swap(prev, next);
-
-            int entryOffset = _adjacencyTable[curr * 2 + 0];
-            int &entryCount = _adjacencyTable[curr * 2 + 1];
-
-            int pairOffset = entryOffset + entryCount * 2;
-            ++entryCount;
-
-            _adjacencyTable[pairOffset + 0] = prev;
-            _adjacencyTable[pairOffset + 1] = next;
-        }
-        vertIndex += nv;
+    // Fill out first part of buffer with offsets and valences, as a
+    // blocked prefix sum over the valence histogram: sum each block in
+    // parallel, scan the (few) block totals serially, then write out
+    // each block's entries in parallel.
+    static const size_t blockSize = 1 << 16;
+    const size_t numBlocks = (numPoints + blockSize - 1) / blockSize;
+    std::vector<size_t> blockOffsets(numBlocks);
+    WorkParallelForN(numBlocks,
+        [&](size_t begin, size_t end) {
+            for (size_t b = begin; b < end; ++b) {
+                size_t blockEnd = std::min((b + 1) * blockSize,
+                                           static_cast<size_t>(numPoints));
+                size_t sum = 0;
+                for (size_t p = b * blockSize; p < blockEnd; ++p) {
+                    sum += 2 * counts[p].load(std::memory_order_relaxed);
+                }
+                blockOffsets[b] = sum;
+            }
+        });
+    size_t runningOffset = numPoints * 2;
+    for (size_t b = 0; b < numBlocks; ++b) {
+        size_t blockTotal = blockOffsets[b];
+        blockOffsets[b] = runningOffset;
+        runningOffset += blockTotal;
     }
+    WorkParallelForN(numBlocks,
+        [&](size_t begin, size_t end) {
+            for (size_t b = begin; b < end; ++b) {
+                size_t blockEnd = std::min((b + 1) * blockSize,
+                                           static_cast<size_t>(numPoints));
+                int currentOffset = blockOffsets[b];
+                for (size_t p = b * blockSize; p < blockEnd; ++p) {
+                    int valence = counts[p].load(std::memory_order_relaxed);
+                    _adjacencyTable[p * 2] = currentOffset;
+                    _adjacencyTable[p * 2 + 1] = valence;
+                    currentOffset += 2*valence;
+
+                    // reset for use as a slot claim counter below.
+                    counts[p].store(0, std::memory_order_relaxed);
+                }
+            }
+        });
+
+    // Fill out the entries in parallel; every face vertex claims a pair
+    // slot through its point's counter.  The claim order varies from run
+    // to run, so record which face vertex produced each pair and restore
+    // the deterministic ordering of a serial build afterwards.
+    std::vector<int> pairCorner(numCorners);
+    WorkParallelForN(numFaces,
+        [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                int nv = numVertsPtr[i];
+                int const * verts = vertsPtr + faceOffsets[i];
+                for (int j=0; j<nv; ++j) {
+                    int prev = verts[(j+nv-1)%nv];
+                    int curr = verts[j];
+                    int next = verts[(j+1)%nv];
+                    if (flip) std::swap(prev, next);
+
+                    int entryOffset = _adjacencyTable[curr * 2 + 0];
+                    int slot = counts[curr].fetch_add(
+                        1, std::memory_order_relaxed);
+
+                    int pairOffset = entryOffset + slot * 2;
+                    _adjacencyTable[pairOffset + 0] = prev;
+                    _adjacencyTable[pairOffset + 1] = next;
+                    pairCorner[(pairOffset - numPoints * 2) / 2] =
+                        faceOffsets[i] + j;
+                }
+            }
+        });
+
+    WorkParallelForN(numPoints,
+        [&](size_t begin, size_t end) {
+            for (size_t p = begin; p < end; ++p) {
+                int offset  = _adjacencyTable[p * 2];
+                int valence = _adjacencyTable[p * 2 + 1];
+                if (valence < 2) continue;
+
+                int *pairs = &_adjacencyTable[offset];
+                int *keys  = &pairCorner[(offset - numPoints * 2) / 2];
+
+                // valences are small; insertion sort in place.
+                for (int a = 1; a < valence; ++a) {
+                    int key  = keys[a];
+                    int prev = pairs[a * 2];
+                    int next = pairs[a * 2 + 1];
+                    int b = a - 1;
+                    for (; b >= 0 && keys[b] > key; --b) {
+                        keys[b + 1] = keys[b];
+                        pairs[(b + 1) * 2]     = pairs[b * 2];
+                        pairs[(b + 1) * 2 + 1] = pairs[b * 2 + 1];
+                    }
+                    keys[b + 1] = key;
+                    pairs[(b + 1) * 2]     = prev;
+                    pairs[(b + 1) * 2 + 1] = next;
+                }
+            }
+        });
 
     return true;
 }
@@ -31,8 +31,10 @@
 
 #include "pxr/base/gf/vec2i.h"
 #include "pxr/base/gf/vec4i.h"
+#include "pxr/base/work/loops.h"
 
 #include <algorithm>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -44,66 +46,106 @@ InterpolateVarying(size_t numVerts, VtIntArray const & vertexCounts, TfToken wra
     VtArray<T> outputValues(numVerts);
 
     int vStep;
-    size_t srcIndex = 0;
-    size_t dstIndex = 0;
 
     if (wrap == HdTokens->periodic) {
         // XXX : Add support for periodic curves
-        TF_WARN("Varying data is only supported for non-periodic curves.");     
+        TF_WARN("Varying data is only supported for non-periodic curves.");
     }
 
     if(basis == HdTokens->bezier) {
         vStep = 3;
-    } 
+    }
     else {
         vStep = 1;
     }
 
-    TF_FOR_ALL(itVertexCount, vertexCounts) {
-        int nVerts = *itVertexCount;
+    // Compute each curve's offset into the source and destination arrays
+    // with a cheap serial scan, then expand the curves in parallel; each
+    // curve reads and writes its own disjoint range.
+    size_t numCurves = vertexCounts.size();
+    int const * vertexCountsPtr = vertexCounts.cdata();
+    std::vector<size_t> srcOffsets(numCurves);
+    std::vector<size_t> dstOffsets(numCurves);
+    size_t srcIndex = 0;
+    size_t dstIndex = 0;
+    for (size_t curveNum = 0; curveNum < numCurves; ++curveNum) {
+        srcOffsets[curveNum] = srcIndex;
+        dstOffsets[curveNum] = dstIndex;
 
-        // Handling for the case of potentially incorrect vertex counts 
+        int nVerts = vertexCountsPtr[curveNum];
+
+        // Handling for the case of potentially incorrect vertex counts
         if(nVerts < 1) {
             continue;
         }
 
         if(vStep == 1) {
-            // For splines with a vstep of 1, we are doing linear interpolation 
-            // between segments, so all we do here is duplicate the first and 
-            // last outputValues. Since these are never acutally used during 
-            // drawing, it would also work just to set the to 0.
-            outputValues[dstIndex] = authoredValues[srcIndex];
-            ++ dstIndex;
-            for(int i = 1;i < nVerts - 1 ; ++i) {
-                outputValues[dstIndex] = authoredValues[srcIndex];
-                ++ dstIndex; ++ srcIndex;
-            }
-            outputValues[dstIndex] = authoredValues[srcIndex - 1];
-            ++ dstIndex;
+            dstIndex += 2 + std::max(nVerts - 2, 0);
+            srcIndex += std::max(nVerts - 2, 0);
         }
         else {
-            // For splines with a larger vstep, control points that do not have 
-            // an authored width get their value as a linear interpolation 
-            // between the two nearest control points with outputValues.
-
-            // First control points always has a value
-            outputValues[dstIndex] = authoredValues[srcIndex];
-            ++dstIndex; ++ srcIndex;
-
-            // vstep - 1 control points will have an interpolated value
-            for(int i = 1;i < nVerts; i += vStep) {
-                T diff = authoredValues[srcIndex] - authoredValues[srcIndex - 1];
-                diff /= vStep;
-                for(int v = 1;v < vStep; ++v) {
-                    outputValues[dstIndex] = authoredValues[srcIndex -1] + diff * v;
+            // One value for the first control point, then one more per
+            // segment of vStep control points.
+            int numSegs = (nVerts + vStep - 2) / vStep;
+            dstIndex += 1 + numSegs * vStep;
+            srcIndex += 1 + numSegs;
+        }
+    }
+
+    T const * srcPtr = authoredValues.cdata();
+    T * dstPtr = outputValues.data();
+
+    WorkParallelForN(numCurves,
+        [&](size_t begin, size_t end) {
+            for (size_t curveNum = begin; curveNum < end; ++curveNum) {
+                int nVerts = vertexCountsPtr[curveNum];
+                if(nVerts < 1) {
+                    continue;
+                }
+
+                size_t srcIndex = srcOffsets[curveNum];
+                size_t dstIndex = dstOffsets[curveNum];
+
+                if(vStep == 1) {
+                    // For splines with a vstep of 1, we are doing linear
+                    // interpolation between segments, so all we do here is
+                    // duplicate the first and last outputValues. Since these
+                    // are never acutally used during drawing, it would also
+                    // work just to set the to 0.
+                    dstPtr[dstIndex] = srcPtr[srcIndex];
+                    ++ dstIndex;
+                    for(int i = 1;i < nVerts - 1 ; ++i) {
+                        dstPtr[dstIndex] = srcPtr[srcIndex];
+                        ++ dstIndex; ++ srcIndex;
+                    }
+                    dstPtr[dstIndex] = srcPtr[srcIndex - 1];
                     ++ dstIndex;
                 }
-                outputValues[dstIndex] = authoredValues[srcIndex];
-                ++ dstIndex;
-                ++ srcIndex;
+                else {
+                    // For splines with a larger vstep, control points that do
+                    // not have an authored width get their value as a linear
+                    // interpolation between the two nearest control points
+                    // with outputValues.
+
+                    // First control points always has a value
+                    dstPtr[dstIndex] = srcPtr[srcIndex];
+                    ++dstIndex; ++ srcIndex;
+
+                    // vstep - 1 control points will have an interpolated value
+                    for(int i = 1;i < nVerts; i += vStep) {
+                        T diff = srcPtr[srcIndex] - srcPtr[srcIndex - 1];
+                        diff /= vStep;
+                        for(int v = 1;v < vStep; ++v) {
+                            dstPtr[dstIndex] = srcPtr[srcIndex - 1] + diff * v;
+                            ++ dstIndex;
+                        }
+                        dstPtr[dstIndex] = srcPtr[srcIndex];
+                        ++ dstIndex;
+                        ++ srcIndex;
+                    }
+                }
             }
-        }
-    }
+        });
 
     TF_VERIFY(dstIndex == numVerts);
     return outputValues;
@@ -167,23 +209,29 @@ HdSt_BasisCurvesIndexBuilderComputation::_BuildLinesIndexArray()
         size_t lineCount = indices.size();
         int maxIndex = curveIndices.size() - 1;
 
-        for (size_t lineNum = 0; lineNum < lineCount; ++lineNum)
-        {
-            const GfVec2i &line = indices[lineNum];
+        GfVec2i const * linesPtr = indices.data();
+        int const * curveIndicesPtr = curveIndices.cdata();
+        GfVec2i * finalIndicesPtr = finalIndices.data();
 
-            int i0 = std::min(line[0], maxIndex);
-            int i1 = std::min(line[1], maxIndex);
+        WorkParallelForN(lineCount,
+            [&](size_t begin, size_t end) {
+                for (size_t lineNum = begin; lineNum < end; ++lineNum) {
+                    const GfVec2i &line = linesPtr[lineNum];
 
-            int v0 = curveIndices[i0];
-            int v1 = curveIndices[i1];
+                    int i0 = std::min(line[0], maxIndex);
+                    int i1 = std::min(line[1], maxIndex);
 
-            finalIndices[lineNum].Set(v0, v1);
-        }
+                    int v0 = curveIndicesPtr[i0];
+                    int v1 = curveIndicesPtr[i1];
+
+                    finalIndicesPtr[lineNum].Set(v0, v1);
+                }
+            });
     }
 
     VtIntArray finalPrimIndices(primIndices.size());
-    std::copy(  primIndices.begin(), 
-                primIndices.end(), 
+    std::copy(  primIndices.begin(),
+                primIndices.end(),
                 finalPrimIndices.begin());
 
     return IndexAndPrimIndex(VtValue(finalIndices), VtValue(finalPrimIndices));
@@ -232,18 +280,24 @@ HdSt_BasisCurvesIndexBuilderComputation::_BuildLineSegmentIndexArray()
         size_t lineCount = indices.size();
         int maxIndex = curveIndices.size() - 1;
 
-        for (size_t lineNum = 0; lineNum < lineCount; ++lineNum)
-        {
-            const GfVec2i &line = indices[lineNum];
+        GfVec2i const * linesPtr = indices.data();
+        int const * curveIndicesPtr = curveIndices.cdata();
+        GfVec2i * finalIndicesPtr = finalIndices.data();
 
-            int i0 = std::min(line[0], maxIndex);
-            int i1 = std::min(line[1], maxIndex);
+        WorkParallelForN(lineCount,
+            [&](size_t begin, size_t end) {
+                for (size_t lineNum = begin; lineNum < end; ++lineNum) {
+                    const GfVec2i &line = linesPtr[lineNum];
 
-            int v0 = curveIndices[i0];
-            int v1 = curveIndices[i1];
+                    int i0 = std::min(line[0], maxIndex);
+                    int i1 = std::min(line[1], maxIndex);
 
-            finalIndices[lineNum].Set(v0, v1);
-        }
+                    int v0 = curveIndicesPtr[i0];
+                    int v1 = curveIndicesPtr[i1];
+
+                    finalIndicesPtr[lineNum].Set(v0, v1);
+                }
+            });
     }
 
     VtIntArray finalPrimIndices(primIndices.size());
@@ -358,22 +412,28 @@ HdSt_BasisCurvesIndexBuilderComputation::_BuildSmoothCurveIndexArray()
         size_t lineCount = indices.size();
         int maxIndex = curveIndices.size() - 1;
 
-        for (size_t lineNum = 0; lineNum < lineCount; ++lineNum)
-        {
-            const GfVec4i &line = indices[lineNum];
+        GfVec4i const * linesPtr = indices.data();
+        int const * curveIndicesPtr = curveIndices.cdata();
+        GfVec4i * finalIndicesPtr = finalIndices.data();
 
-            int i0 = std::min(line[0], maxIndex);
-            int i1 = std::min(line[1], maxIndex);
-            int i2 = std::min(line[2], maxIndex);
-            int i3 = std::min(line[3], maxIndex);
+        WorkParallelForN(lineCount,
+            [&](size_t begin, size_t end) {
+                for (size_t lineNum = begin; lineNum < end; ++lineNum) {
+                    const GfVec4i &line = linesPtr[lineNum];
 
-            int v0 = curveIndices[i0];
-            int v1 = curveIndices[i1];
-            int v2 = curveIndices[i2];
-            int v3 = curveIndices[i3];
+                    int i0 = std::min(line[0], maxIndex);
+                    int i1 = std::min(line[1], maxIndex);
+                    int i2 = std::min(line[2], maxIndex);
+                    int i3 = std::min(line[3], maxIndex);
 
-            finalIndices[lineNum].Set(v0, v1, v2, v3);
-        }
+                    int v0 = curveIndicesPtr[i0];
+                    int v1 = curveIndicesPtr[i1];
+                    int v2 = curveIndicesPtr[i2];
+                    int v3 = curveIndicesPtr[i3];
+
+                    finalIndicesPtr[lineNum].Set(v0, v1, v2, v3);
+                }
+            });
     }
 
     VtIntArray finalPrimIndices(primIndices.size());
@@ -467,9 +527,7 @@ HdSt_BasisCurvesWidthsInterpolaterComputation::Resolve()
     if(size <= 1) {
         // Uniform or missing data
         float width = size==0 ? 1.f : _authoredWidths[0];
-        for(size_t i = 0; i < numVerts; ++ i) {
-            widths[i] = width;
-        }
+        std::fill(widths.begin(), widths.end(), width);
     }
     else if(size == numVerts) {
         // Vertex data
@@ -483,9 +541,7 @@ HdSt_BasisCurvesWidthsInterpolaterComputation::Resolve()
     }
     else {
         // Fallback
-        for(size_t i = 0; i < numVerts; ++ i) {
-            widths[i] = 1.0;
-        }
+        std::fill(widths.begin(), widths.end(), 1.0f);
         TF_WARN("Incorrect number of widths, using default 1.0 for rendering.");
     }
 
@@ -535,10 +591,7 @@ HdSt_BasisCurvesNormalsInterpolaterComputation::Resolve()
 
     if(size == 1) {
         // Uniform data
-        GfVec3f normal = _authoredNormals[0];
-        for(size_t i = 0; i < numVerts; ++ i) {
-            normals[i] = normal;
-        }
+        std::fill(normals.begin(), normals.end(), _authoredNormals[0]);
     }
     else if(size == numVerts) {
         // Vertex data
@@ -552,10 +605,7 @@ HdSt_BasisCurvesNormalsInterpolaterComputation::Resolve()
     }
     else {
         // Fallback
-        GfVec3f normal(1.0,0.0,0.0);
-        for(size_t i = 0; i < numVerts; ++ i) {
-            normals[i] = normal;
-        }
+        std::fill(normals.begin(), normals.end(), GfVec3f(1.0, 0.0, 0.0));
         TF_WARN("Incorrect number of normals, using default GfVec3f(1,0,0) for rendering.");
     }
 
@@ -37,21 +37,31 @@
 
 #include "pxr/base/gf/matrix4f.h"
 #include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/tf/envSetting.h"
 #include "pxr/base/tf/stl.h"
 
 #include "pxr/base/work/loops.h"
 
 #include <boost/functional/hash.hpp>
 
+#include <tbb/concurrent_unordered_map.h>
+#include <tbb/concurrent_vector.h>
+
+#include <algorithm>
 #include <functional>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
 
+TF_DEFINE_ENV_SETTING(HD_ENABLE_SHADER_PREWARM, true,
+                      "Compile drawing programs for new draw batches at "
+                      "prepare time rather than during draw");
+
 HdStCommandBuffer::HdStCommandBuffer()
     : _visibleSize(0)
     , _visChangeCount(0)
     , _shaderBindingsVersion(0)
+    , _needsProgramPrewarm(false)
 {
     /*NOTHING*/
 }
@@ -86,6 +96,22 @@ HdStCommandBuffer::PrepareDraw(HdRenderPassStateSharedPtr const &renderPassState
     }
 }
 
+void
+HdStCommandBuffer::PrewarmDrawingPrograms(
+    HdRenderPassStateSharedPtr const &renderPassState,
+    HdStResourceRegistrySharedPtr const &resourceRegistry)
+{
+    static bool enabled = TfGetEnvSetting(HD_ENABLE_SHADER_PREWARM);
+    if (!enabled || !_needsProgramPrewarm) return;
+
+    HD_TRACE_FUNCTION();
+
+    TF_FOR_ALL(batchIt, _drawBatches) {
+        (*batchIt)->CompileDrawingProgram(renderPassState, resourceRegistry);
+    }
+    _needsProgramPrewarm = false;
+}
+
 void
 HdStCommandBuffer::ExecuteDraw(HdRenderPassStateSharedPtr const &renderPassState,
                              HdStResourceRegistrySharedPtr const &resourceRegistry)
@@ -118,8 +144,27 @@ void
 HdStCommandBuffer::SwapDrawItems(std::vector<HdDrawItem const*>* items,
                                unsigned currentShaderBindingsVersion)
 {
+    // Collection updates commonly leave the draw item list unchanged
+    // (e.g. a visibility toggle) or only append a few items; rebucketing
+    // every draw item in those cases is wasted work, so keep the
+    // existing batches and only bucket the appended items. Removals
+    // still trigger a full rebuild.
+    size_t previousSize = _drawItems.size();
+    bool isAppend =
+        previousSize > 0 &&
+        !_drawBatches.empty() &&
+        items->size() >= previousSize &&
+        std::equal(_drawItems.begin(), _drawItems.end(), items->begin());
+
     _drawItems.swap(*items);
-    _RebuildDrawBatches();
+
+    if (isAppend) {
+        if (_drawItems.size() > previousSize) {
+            _AppendDrawItems(previousSize);
+        }
+    } else {
+        _RebuildDrawBatches();
+    }
     _shaderBindingsVersion = currentShaderBindingsVersion;
 }
 
@@ -142,6 +187,24 @@ HdStCommandBuffer::RebuildDrawBatchesIfNeeded(unsigned currentShaderBindingsVers
     _shaderBindingsVersion = currentShaderBindingsVersion;
 }
 
+// Computes the batch key of a draw item. All draw items sharing a key are
+// candidates for aggregation into the same batch.
+static size_t
+_ComputeBatchKey(HdDrawItem const *drawItem, bool bindlessTexture)
+{
+    size_t key = drawItem->GetGeometricShader()->ComputeHash();
+    boost::hash_combine(key, drawItem->GetBufferArraysHash());
+
+    if (!bindlessTexture) {
+        // Geometric, RenderPass and Lighting shaders should never break
+        // batches, however materials can. We consider the material
+        // parameters to be part of the batch key here for that reason.
+        boost::hash_combine(key, HdShaderParam::ComputeHash(
+                                drawItem->GetMaterial()->GetParams()));
+    }
+    return key;
+}
+
 void
 HdStCommandBuffer::_RebuildDrawBatches()
 {
@@ -151,17 +214,47 @@ HdStCommandBuffer::_RebuildDrawBatches()
 
     _drawBatches.clear();
     _drawItemInstances.clear();
-    _drawItemInstances.reserve(_drawItems.size());
+    _batchMap.clear();
 
     HD_PERF_COUNTER_INCR(HdPerfTokens->rebuildBatches);
 
     bool bindlessTexture = HdRenderContextCaps::GetInstance()
                                                .bindlessTextureEnabled;
 
+    size_t numDrawItems = _drawItems.size();
+
     // XXX: Temporary sorting by shader.
-    std::map<size_t, HdSt_DrawBatchSharedPtr> batchMap;
+    //
+    // Batch keys are hashed and the items are bucketed by key
+    // concurrently; each draw item lands in exactly one bucket, so the
+    // batches of different buckets can then also be built concurrently.
+    typedef tbb::concurrent_vector<size_t> _ItemIndices;
+    typedef tbb::concurrent_unordered_map<size_t, _ItemIndices> _BucketMap;
+    _BucketMap buckets;
+
+    WorkParallelForN(numDrawItems, [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            HdDrawItem const * drawItem = _drawItems[i];
+            if (!drawItem->GetGeometricShader()) {
+                // reported below, while creating the instances.
+                continue;
+            }
+
+            size_t key = _ComputeBatchKey(drawItem, bindlessTexture);
+
+            TF_DEBUG(HD_DRAW_BATCH).Msg("%lu (%lu)\n",
+                    key,
+                    drawItem->GetBufferArraysHash());
+                    //, drawItem->GetRprimID().GetText());
 
-    for (size_t i = 0; i < _drawItems.size(); i++) {
+            buckets[key].push_back(i);
+        }
+    });
+
+    // Create the draw item instances serially, so that they appear in
+    // draw item order for visibility sync and culling.
+    std::vector<HdStDrawItemInstance *> instances(numDrawItems, nullptr);
+    for (size_t i = 0; i < numDrawItems; i++) {
         HdDrawItem const * drawItem = _drawItems[i];
 
         HdShaderCodeSharedPtr const &geometricShader
@@ -172,32 +265,103 @@ HdStCommandBuffer::_RebuildDrawBatches()
         }
 
         _drawItemInstances.push_back(HdStDrawItemInstance(drawItem));
-        HdStDrawItemInstance* drawItemInstance = &_drawItemInstances.back();
+        instances[i] = &_drawItemInstances.back();
+    }
+
+    // Build the batches of each bucket.
+    struct _BucketResult {
+        size_t key;
+        size_t firstItem;
+        HdSt_DrawBatchSharedPtrVector batches;
+    };
+    std::vector<_BucketResult> results(buckets.size());
+    std::vector<_ItemIndices *> bucketList;
+    bucketList.reserve(buckets.size());
+    for (_BucketMap::iterator it = buckets.begin();
+         it != buckets.end(); ++it) {
+        results[bucketList.size()].key = it->first;
+        bucketList.push_back(&it->second);
+    }
 
-        size_t key = geometricShader->ComputeHash();
-        boost::hash_combine(key, drawItem->GetBufferArraysHash());
+    WorkParallelForN(bucketList.size(), [&](size_t begin, size_t end) {
+        for (size_t b = begin; b < end; ++b) {
+            _ItemIndices &itemIndices = *bucketList[b];
 
-        if (!bindlessTexture) {
-            // Geometric, RenderPass and Lighting shaders should never break
-            // batches, however materials can. We consider the material 
-            // parameters to be part of the batch key here for that reason.
-            boost::hash_combine(key, HdShaderParam::ComputeHash(
-                                    drawItem->GetMaterial()->GetParams()));
+            // restore draw item order within the bucket; the concurrent
+            // insertion above appends in a nondeterministic order.
+            std::sort(itemIndices.begin(), itemIndices.end());
+
+            _BucketResult &result = results[b];
+            result.firstItem = itemIndices[0];
+
+            HdSt_DrawBatchSharedPtr batch;
+            for (size_t i : itemIndices) {
+                HdStDrawItemInstance* drawItemInstance = instances[i];
+                if (!drawItemInstance) continue;
+
+                if (!batch || !batch->Append(drawItemInstance)) {
+                    batch = _NewDrawBatch(drawItemInstance);
+                    result.batches.push_back(batch);
+                }
+            }
         }
+    });
+
+    // Concatenate the per-bucket batches in draw item order, and
+    // remember the open batch of each key for incremental appends.
+    std::sort(results.begin(), results.end(),
+              [](_BucketResult const &a, _BucketResult const &b) {
+                  return a.firstItem < b.firstItem;
+              });
+    for (_BucketResult const &result : results) {
+        _drawBatches.insert(_drawBatches.end(),
+                            result.batches.begin(), result.batches.end());
+        if (!result.batches.empty()) {
+            _batchMap[result.key] = result.batches.back();
+        }
+    }
 
-        TF_DEBUG(HD_DRAW_BATCH).Msg("%lu (%lu)\n", 
-                key, 
-                drawItem->GetBufferArraysHash());
-                //, drawItem->GetRprimID().GetText());
+    _needsProgramPrewarm = true;
+}
+
+void
+HdStCommandBuffer::_AppendDrawItems(size_t firstItem)
+{
+    HD_TRACE_FUNCTION();
+
+    bool bindlessTexture = HdRenderContextCaps::GetInstance()
+                                               .bindlessTextureEnabled;
+
+    for (size_t i = firstItem; i < _drawItems.size(); i++) {
+        HdDrawItem const * drawItem = _drawItems[i];
+
+        HdShaderCodeSharedPtr const &geometricShader
+            = drawItem->GetGeometricShader();
+        if (!TF_VERIFY(geometricShader, "%s",
+                       drawItem->GetRprimID().GetText())) {
+            continue;
+        }
+
+        _drawItemInstances.push_back(HdStDrawItemInstance(drawItem));
+        HdStDrawItemInstance* drawItemInstance = &_drawItemInstances.back();
+
+        size_t key = _ComputeBatchKey(drawItem, bindlessTexture);
 
         HdSt_DrawBatchSharedPtr batch;
-        TfMapLookup(batchMap, key, &batch);
+        TfMapLookup(_batchMap, key, &batch);
         if (!batch || !batch->Append(drawItemInstance)) {
             batch = _NewDrawBatch(drawItemInstance);
             _drawBatches.push_back(batch);
-            batchMap[key] = batch;
+            _batchMap[key] = batch;
         }
     }
+
+    // The appended instances start out with the visibility of their draw
+    // items; force a resync so _visibleSize is recounted.
+    _visibleSize = 0;
+    _visChangeCount = 0;
+
+    _needsProgramPrewarm = true;
 }
 
 void
@@ -263,7 +427,7 @@ HdStCommandBuffer::FrustumCull(GfMatrix4d const &viewProjMatrix)
 
     struct _Worker {
         static
-        void cull(std::vector<HdStDrawItemInstance> * drawItemInstances,
+        void cull(std::deque<HdStDrawItemInstance> * drawItemInstances,
                 GfMatrix4d const &viewProjMatrix,
                 size_t begin, size_t end) 
         {
@@ -35,6 +35,8 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include <deque>
+#include <unordered_map>
 #include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -69,6 +71,14 @@ public:
     void PrepareDraw(HdRenderPassStateSharedPtr const &renderPassState,
                      HdStResourceRegistrySharedPtr const &resourceRegistry);
 
+    /// Compiles the drawing programs of all batches if any batch has been
+    /// created or rebuilt since the last call, so that new shader variants
+    /// link before drawing starts rather than mid-draw.
+    HDST_API
+    void PrewarmDrawingPrograms(
+                     HdRenderPassStateSharedPtr const &renderPassState,
+                     HdStResourceRegistrySharedPtr const &resourceRegistry);
+
     /// Execute the command buffer
     HDST_API
     void ExecuteDraw(HdRenderPassStateSharedPtr const &renderPassState,
@@ -84,6 +94,8 @@ public:
 
     /// Destructively swaps the contents of \p items with the internal list of
     /// all draw items. Culling state is reset, with no items visible.
+    /// If the new list only appends items to the current one, the existing
+    /// batches are kept and only the appended items are bucketed.
     HDST_API
     void SwapDrawItems(std::vector<HdDrawItem const*>* items,
                        unsigned currentShaderBindingsVersion);
@@ -105,13 +117,19 @@ public:
 
 private:
     void _RebuildDrawBatches();
+    void _AppendDrawItems(size_t firstItem);
 
     std::vector<HdDrawItem const*> _drawItems;
-    std::vector<HdStDrawItemInstance> _drawItemInstances;
+    // deque, so that appending items doesn't invalidate the instance
+    // pointers held by existing batches.
+    std::deque<HdStDrawItemInstance> _drawItemInstances;
     HdSt_DrawBatchSharedPtrVector _drawBatches;
+    // the open batch for each batch key, for incremental appends.
+    std::unordered_map<size_t, HdSt_DrawBatchSharedPtr> _batchMap;
     size_t _visibleSize;
     unsigned _visChangeCount;
     unsigned _shaderBindingsVersion;
+    bool _needsProgramPrewarm;
 };
 
 
@@ -35,22 +35,25 @@ TF_DEFINE_PRIVATE_TOKENS(
     ((noCounting,       "ViewFrustumCull.NoCounting"))
     ((tinyCull,         "ViewFrustumCull.TinyCull"))
     ((noTinyCull,       "ViewFrustumCull.NoTinyCull"))
+    ((occlusionCull,    "ViewFrustumCull.OcclusionCull"))
+    ((noOcclusionCull,  "ViewFrustumCull.NoOcclusionCull"))
     ((isVisible,        "ViewFrustumCull.IsVisible"))
     ((mainInstancingVS, "ViewFrustumCull.VertexInstancing"))
     ((mainVS,           "ViewFrustumCull.Vertex"))
 );
 
 HdSt_CullingShaderKey::HdSt_CullingShaderKey(
-    bool instancing, bool tinyCull, bool counting)
+    bool instancing, bool tinyCull, bool counting, bool occlusionCull)
     : glslfx(_tokens->baseGLSLFX)
 {
 
     VS[0] = _tokens->instancing;
     VS[1] = counting ? _tokens->counting : _tokens->noCounting;
     VS[2] = tinyCull ? _tokens->tinyCull : _tokens->noTinyCull;
-    VS[3] = _tokens->isVisible;
-    VS[4] = instancing ? _tokens->mainInstancingVS : _tokens->mainVS;
-    VS[5] = TfToken();
+    VS[3] = occlusionCull ? _tokens->occlusionCull : _tokens->noOcclusionCull;
+    VS[4] = _tokens->isVisible;
+    VS[5] = instancing ? _tokens->mainInstancingVS : _tokens->mainVS;
+    VS[6] = TfToken();
 }
 
 HdSt_CullingShaderKey::~HdSt_CullingShaderKey()
@@ -35,7 +35,8 @@ PXR_NAMESPACE_OPEN_SCOPE
 
 struct HdSt_CullingShaderKey
 {
-    HdSt_CullingShaderKey(bool instancing, bool tinyCull, bool counting);
+    HdSt_CullingShaderKey(bool instancing, bool tinyCull, bool counting,
+                          bool occlusionCull);
     ~HdSt_CullingShaderKey();
 
     TfToken const &GetGlslfxFile() const { return glslfx; }
@@ -53,7 +54,7 @@ struct HdSt_CullingShaderKey
     bool IsFaceVarying() const { return false; }
 
     TfToken glslfx;
-    TfToken VS[6];
+    TfToken VS[7];
 };
 
 
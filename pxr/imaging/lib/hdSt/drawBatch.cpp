@@ -185,6 +185,15 @@ HdSt_DrawBatch::Rebuild()
     return true;
 }
 
+/*virtual*/
+void
+HdSt_DrawBatch::CompileDrawingProgram(
+    HdRenderPassStateSharedPtr const &renderPassState,
+    HdStResourceRegistrySharedPtr const &resourceRegistry)
+{
+    _GetDrawingProgram(renderPassState, /*indirect=*/false, resourceRegistry);
+}
+
 HdSt_DrawBatch::_DrawingProgram &
 HdSt_DrawBatch::_GetDrawingProgram(HdRenderPassStateSharedPtr const &state,
                                  bool indirect,
@@ -238,11 +247,8 @@ HdSt_DrawBatch::_GetDrawingProgram(HdRenderPassStateSharedPtr const &state,
             // code is broken and needs to be fixed.  When we open up more
             // shaders for customization, we will need to check them as well.
             
-            typedef boost::shared_ptr<class GlfGLSLFX> GlfGLSLFXSharedPtr;
-
-            GlfGLSLFXSharedPtr glslSurfaceFallback = 
-                GlfGLSLFXSharedPtr(
-                        new GlfGLSLFX(HdPackageFallbackSurfaceShader()));
+            GlfGLSLFXSharedPtr glslSurfaceFallback =
+                GlfGLSLFX::GetShared(HdPackageFallbackSurfaceShader());
 
             HdShaderCodeSharedPtr fallbackSurface =
                 HdShaderCodeSharedPtr(
@@ -315,10 +321,19 @@ HdSt_DrawBatch::_DrawingProgram::CompileShader(
             resourceRegistry->RegisterGLSLProgram(hash, &programInstance);
 
         if (programInstance.IsFirstInstance()) {
-            HdGLSLProgramSharedPtr glslProgram = codeGen.Compile();
-            if (glslProgram && _Link(glslProgram)) {
-                // store the program into the program registry.
-                programInstance.SetValue(glslProgram);
+            // Check the persistent binary cache before generating and
+            // compiling source for this permutation.
+            HdGLSLProgramSharedPtr cachedProgram(
+                new HdGLSLProgram(HdTokens->drawingShader));
+            if (cachedProgram->LoadProgramBinary(hash)) {
+                programInstance.SetValue(cachedProgram);
+            } else {
+                HdGLSLProgramSharedPtr glslProgram = codeGen.Compile();
+                if (glslProgram && _Link(glslProgram)) {
+                    glslProgram->SaveProgramBinary(hash);
+                    // store the program into the program registry.
+                    programInstance.SetValue(glslProgram);
+                }
             }
         }
 
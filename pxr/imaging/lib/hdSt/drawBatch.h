@@ -77,6 +77,14 @@ public:
     HDST_API
     bool Rebuild();
 
+    /// Compiles and caches the drawing program for this batch without
+    /// executing any draw commands, so that a freshly created batch doesn't
+    /// stall on glLinkProgram during ExecuteDraw.
+    HDST_API
+    virtual void CompileDrawingProgram(
+        HdRenderPassStateSharedPtr const &renderPassState,
+        HdStResourceRegistrySharedPtr const &resourceRegistry);
+
     /// Validates that all batches are referring up to date bufferarrays.
     /// If not, returns false
     virtual bool Validate(bool deepValidation) = 0;
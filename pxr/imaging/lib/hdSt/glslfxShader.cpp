@@ -44,7 +44,9 @@ HdStGLSLFXShader::~HdStGLSLFXShader()
 void
 HdStGLSLFXShader::Reload()
 {
-    GlfGLSLFXSharedPtr newGlslFx(new GlfGLSLFX(_glslfx->GetFilePath()));
+    // GetShared only re-parses the file if it (or an import) changed on
+    // disk, which is exactly the reload condition.
+    GlfGLSLFXSharedPtr newGlslFx = GlfGLSLFX::GetShared(_glslfx->GetFilePath());
 
     if (newGlslFx->IsValid())
     {
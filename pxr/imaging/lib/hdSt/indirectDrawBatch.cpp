@@ -64,6 +64,9 @@ TF_DEFINE_ENV_SETTING(HD_ENABLE_GPU_COUNT_VISIBLE_INSTANCES, false,
                       "Enable GPU frustum culling visible count query");
 TF_DEFINE_ENV_SETTING(HD_ENABLE_GPU_INSTANCE_FRUSTUM_CULLING, true,
                       "Enable GPU per-instance frustum culling");
+TF_DEFINE_ENV_SETTING(HD_ENABLE_GPU_OCCLUSION_CULLING, false,
+                      "Enable GPU occlusion culling against the depth pyramid "
+                      "provided by the render pass state");
 
 HdSt_IndirectDrawBatch::HdSt_IndirectDrawBatch(
     HdStDrawItemInstance * drawItemInstance)
@@ -72,6 +75,7 @@ HdSt_IndirectDrawBatch::HdSt_IndirectDrawBatch(
     , _numVisibleItems(0)
     , _numTotalElements(0)
     , _lastTinyPrimCulling(false)
+    , _lastOcclusionCulling(false)
     , _instanceCountOffset(0)
     , _cullInstanceCountOffset(0)
     , _cullResultSync(0)
@@ -103,21 +107,29 @@ HdSt_IndirectDrawBatch::_Init(HdStDrawItemInstance * drawItemInstance)
 
     if (_useGpuCulling) {
         _cullingProgram.Initialize(
-            _useDrawArrays, _useGpuInstanceCulling, _bufferArraysHash);
+            _useDrawArrays, _useGpuInstanceCulling,
+            /*useOcclusionCulling=*/false, _bufferArraysHash);
     }
 }
 
 HdSt_IndirectDrawBatch::_CullingProgram &
 HdSt_IndirectDrawBatch::_GetCullingProgram(
-    HdStResourceRegistrySharedPtr const &resourceRegistry)
+    HdStResourceRegistrySharedPtr const &resourceRegistry,
+    bool useOcclusionCulling)
 {
     if (!_cullingProgram.GetGLSLProgram() || 
-        _lastTinyPrimCulling != IsEnabledGPUTinyPrimCulling()) {
+        _lastTinyPrimCulling != IsEnabledGPUTinyPrimCulling() ||
+        _lastOcclusionCulling != useOcclusionCulling) {
     
+        _cullingProgram.Initialize(
+            _useDrawArrays, _useGpuInstanceCulling,
+            useOcclusionCulling, _bufferArraysHash);
+
         // create a culling shader key
         HdSt_CullingShaderKey shaderKey(_useGpuInstanceCulling,
                                       IsEnabledGPUTinyPrimCulling(),
-                                      IsEnabledGPUCountVisibleInstances());
+                                      IsEnabledGPUCountVisibleInstances(),
+                                      useOcclusionCulling);
 
         // sharing the culling geometric shader for the same configuration.
         Hd_GeometricShaderSharedPtr cullShader =
@@ -131,6 +143,10 @@ HdSt_IndirectDrawBatch::_GetCullingProgram(
         // track the last tiny prim culling state as it can be modified at
         // runtime via TF_DEBUG_CODE HD_DISABLE_TINY_PRIM_CULLING
         _lastTinyPrimCulling = IsEnabledGPUTinyPrimCulling();
+
+        // track whether the occlusion stage was built in, as its
+        // availability depends on the render pass state
+        _lastOcclusionCulling = useOcclusionCulling;
     }
     return _cullingProgram;
 }
@@ -172,6 +188,15 @@ HdSt_IndirectDrawBatch::IsEnabledGPUTinyPrimCulling()
         !TfDebug::IsEnabled(HD_DISABLE_TINY_PRIM_CULLING);
 }
 
+/* static */
+bool
+HdSt_IndirectDrawBatch::IsEnabledGPUOcclusionCulling()
+{
+    static bool isEnabledGPUOcclusionCulling =
+        TfGetEnvSetting(HD_ENABLE_GPU_OCCLUSION_CULLING);
+    return isEnabledGPUOcclusionCulling;
+}
+
 /* static */
 bool
 HdSt_IndirectDrawBatch::IsEnabledGPUInstanceFrustumCulling()
@@ -1219,7 +1244,13 @@ HdSt_IndirectDrawBatch::_GPUFrustumCulling(
     HdBufferArrayRangeGLSharedPtr cullDispatchBar =
         _dispatchBufferCullInput->GetBufferArrayRange();
 
-    _CullingProgram cullingProgram = _GetCullingProgram(resourceRegistry);
+    // The occlusion stage can only be used when the render pass
+    // provided a depth pyramid of the previous frame.
+    bool useOcclusionCulling = IsEnabledGPUOcclusionCulling() &&
+        (renderPassState->GetOcclusionTestTextureId() != 0);
+
+    _CullingProgram cullingProgram =
+        _GetCullingProgram(resourceRegistry, useOcclusionCulling);
 
     HdGLSLProgramSharedPtr const &
         glslProgram = cullingProgram.GetGLSLProgram();
@@ -1268,6 +1299,18 @@ HdSt_IndirectDrawBatch::_GPUFrustumCulling(
     if (IsEnabledGPUTinyPrimCulling()) {
         binder.BindUniformf(HdTokens->ulocDrawRangeNDC, 2, drawRangeNDC.GetArray());
     }
+    if (useOcclusionCulling) {
+        int occlusionMipLevels =
+            renderPassState->GetOcclusionTestTextureMipLevels();
+        binder.BindUniformi(HdTokens->ulocOcclusionMipLevels,
+                            1, &occlusionMipLevels);
+
+        // the occlusion texture is declared with binding=0 in
+        // frustumCull.glslfx.
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D,
+                      renderPassState->GetOcclusionTestTextureId());
+    }
 
     // run culling shader
     bool validProgram = true;
@@ -1325,6 +1368,11 @@ HdSt_IndirectDrawBatch::_GPUFrustumCulling(
     binder.UnbindBuffer(HdTokens->dispatchBuffer,
                         _dispatchBuffer->GetEntireResource());
 
+    if (useOcclusionCulling) {
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
     // make sure the culling results (instanceIndices and instanceCount)
     // are synchronized for the next drawing.
     glMemoryBarrier(
@@ -1355,7 +1403,11 @@ HdSt_IndirectDrawBatch::_GPUFrustumCullingXFB(
     HdBufferArrayRangeGLSharedPtr cullDispatchBar =
         _dispatchBufferCullInput->GetBufferArrayRange();
 
-    _CullingProgram &cullingProgram = _GetCullingProgram(resourceRegistry);
+    // XFB culling runs on contexts without explicit attrib locations,
+    // where the occlusion stage isn't available.
+    _CullingProgram &cullingProgram =
+        _GetCullingProgram(resourceRegistry,
+                           /*useOcclusionCulling=*/false);
 
     HdGLSLProgramSharedPtr const &
         glslProgram = cullingProgram.GetGLSLProgram();
@@ -1461,6 +1513,15 @@ HdSt_IndirectDrawBatch::DrawItemInstanceChanged(HdStDrawItemInstance const* inst
     }
 }
 
+/*virtual*/
+void
+HdSt_IndirectDrawBatch::CompileDrawingProgram(
+    HdRenderPassStateSharedPtr const &renderPassState,
+    HdStResourceRegistrySharedPtr const &resourceRegistry)
+{
+    _GetDrawingProgram(renderPassState, /*indirect=*/true, resourceRegistry);
+}
+
 void
 HdSt_IndirectDrawBatch::_BeginGPUCountVisibleInstances(
     HdStResourceRegistrySharedPtr const &resourceRegistry)
@@ -1533,17 +1594,20 @@ HdSt_IndirectDrawBatch::_EndGPUCountVisibleInstances(GLsync resultSync, size_t *
 
 void
 HdSt_IndirectDrawBatch::_CullingProgram::Initialize(
-    bool useDrawArrays, bool useInstanceCulling, size_t bufferArrayHash)
+    bool useDrawArrays, bool useInstanceCulling,
+    bool useOcclusionCulling, size_t bufferArrayHash)
 {
-    if (useDrawArrays      != _useDrawArrays      ||
-        useInstanceCulling != _useInstanceCulling ||
-        bufferArrayHash    != _bufferArrayHash) {
+    if (useDrawArrays       != _useDrawArrays       ||
+        useInstanceCulling  != _useInstanceCulling  ||
+        useOcclusionCulling != _useOcclusionCulling ||
+        bufferArrayHash     != _bufferArrayHash) {
         // reset shader
         Reset();
     }
 
     _useDrawArrays = useDrawArrays;
     _useInstanceCulling = useInstanceCulling;
+    _useOcclusionCulling = useOcclusionCulling;
     _bufferArrayHash = bufferArrayHash;
 }
 
@@ -1564,6 +1628,10 @@ HdSt_IndirectDrawBatch::_CullingProgram::_GetCustomBindings(
                                                HdTokens->ulocDrawRangeNDC));
     customBindings->push_back(HdBindingRequest(HdBinding::UNIFORM,
                                                HdTokens->ulocCullMatrix));
+    if (_useOcclusionCulling) {
+        customBindings->push_back(HdBindingRequest(HdBinding::UNIFORM,
+                                      HdTokens->ulocOcclusionMipLevels));
+    }
 
     if (_useInstanceCulling) {
         customBindings->push_back(
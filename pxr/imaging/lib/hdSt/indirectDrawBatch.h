@@ -70,6 +70,12 @@ public:
     HDST_API
     virtual void DrawItemInstanceChanged(HdStDrawItemInstance const* instance);
 
+    /// Compiles the indirect drawing program for this batch.
+    HDST_API
+    virtual void CompileDrawingProgram(
+        HdRenderPassStateSharedPtr const &renderPassState,
+        HdStResourceRegistrySharedPtr const &resourceRegistry) override;
+
     /// Returns whether to do frustum culling on the GPU
     HDST_API
     static bool IsEnabledGPUFrustumCulling();
@@ -88,6 +94,12 @@ public:
     HDST_API
     static bool IsEnabledGPUInstanceFrustumCulling();
 
+    /// Returns whether to do occlusion culling against the depth pyramid
+    /// provided by the render pass state during GPU culling.
+    /// Disabled by default.
+    HDST_API
+    static bool IsEnabledGPUOcclusionCulling();
+
 protected:
     HDST_API
     virtual void _Init(HdStDrawItemInstance * drawItemInstance) override;
@@ -109,9 +121,10 @@ private:
         _CullingProgram()
             : _useDrawArrays(false)
             , _useInstanceCulling(false)
+            , _useOcclusionCulling(false)
             , _bufferArrayHash(0) { }
         void Initialize(bool useDrawArrays, bool useInstanceCulling,
-                        size_t bufferArrayHash);
+                        bool useOcclusionCulling, size_t bufferArrayHash);
     protected:
         // _DrawingProgram overrides
         virtual void _GetCustomBindings(
@@ -121,11 +134,13 @@ private:
     private:
         bool _useDrawArrays;
         bool _useInstanceCulling;
+        bool _useOcclusionCulling;
         size_t _bufferArrayHash;
     };
 
     _CullingProgram &_GetCullingProgram(
-        HdStResourceRegistrySharedPtr const &resourceRegistry);
+        HdStResourceRegistrySharedPtr const &resourceRegistry,
+        bool useOcclusionCulling);
 
     void _CompileBatch(HdStResourceRegistrySharedPtr const &resourceRegistry);
 
@@ -158,6 +173,7 @@ private:
 
     _CullingProgram _cullingProgram;
     bool _lastTinyPrimCulling;
+    bool _lastOcclusionCulling;
 
     bool _useDrawArrays;
     bool _useInstancing;
@@ -388,7 +388,15 @@ _QuadrangulatePrimVar(HdBufferSourceSharedPtr const &source,
 {
     if (!TF_VERIFY(computations)) return source;
 
-    if (!HdRenderContextCaps::GetInstance().gpuComputeEnabled) {
+    // The GPU quadrangulation kernel only handles float and double
+    // component types; other primvars take the CPU path even when GPU
+    // compute is available.
+    GLenum dataType = source->GetGLComponentDataType();
+    bool gpuQuadrangulation =
+        HdRenderContextCaps::GetInstance().gpuComputeEnabled &&
+        (dataType == GL_FLOAT || dataType == GL_DOUBLE);
+
+    if (!gpuQuadrangulation) {
         // CPU quadrangulation
         // set quadrangulation as source instead of original source.
         HdBufferSourceSharedPtr quadsource =
@@ -406,7 +414,7 @@ _QuadrangulatePrimVar(HdBufferSourceSharedPtr const &source,
         // transfered
         HdComputationSharedPtr computation =
             topology->GetQuadrangulateComputationGPU(
-                source->GetName(), source->GetGLComponentDataType(), id);
+                source->GetName(), dataType, id);
         // computation can be null for all quad mesh.
         if (computation) {
             computations->push_back(computation);
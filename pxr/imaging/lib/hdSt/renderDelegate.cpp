@@ -243,7 +243,8 @@ HdStRenderDelegate::DestroyBprim(HdBprim *bPrim)
 HdSprim *
 HdStRenderDelegate::_CreateFallbackShaderPrim()
 {
-    GlfGLSLFXSharedPtr glslfx(new GlfGLSLFX(HdPackageFallbackSurfaceShader()));
+    GlfGLSLFXSharedPtr glslfx =
+        GlfGLSLFX::GetShared(HdPackageFallbackSurfaceShader());
 
     HdStSurfaceShaderSharedPtr fallbackShaderCode(new HdStGLSLFXShader(glslfx));
 
@@ -273,6 +274,12 @@ HdStRenderDelegate::CommitResources(HdChangeTracker *tracker)
         _resourceRegistry->GarbageCollect();
         tracker->ClearGarbageCollectionNeeded();
         tracker->MarkAllCollectionsDirty();
+
+        // Compaction work may have been bounded to keep this frame's
+        // cost stable; come back for the rest on the next frame.
+        if (_resourceRegistry->NeedsMoreGarbageCollection()) {
+            tracker->SetGarbageCollectionNeeded();
+        }
     }
 
     // see bug126621. currently dispatch buffers need to be released
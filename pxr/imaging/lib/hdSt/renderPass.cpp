@@ -69,6 +69,8 @@ HdSt_RenderPass::_Execute(HdRenderPassStateSharedPtr const &renderPassState,
     if (renderTags.empty()) {
         for (_HdStCommandBufferMap::iterator it  = _cmdBuffers.begin();
                                            it != _cmdBuffers.end(); it++) {
+            it->second.PrewarmDrawingPrograms(renderPassState,
+                                              resourceRegistry);
             it->second.PrepareDraw(renderPassState, resourceRegistry);
             it->second.ExecuteDraw(renderPassState, resourceRegistry);
         }
@@ -79,6 +81,8 @@ HdSt_RenderPass::_Execute(HdRenderPassStateSharedPtr const &renderPassState,
                 continue;
             }
 
+            _cmdBuffers[*tag].PrewarmDrawingPrograms(renderPassState,
+                                                     resourceRegistry);
             // GPU frustum culling (if chosen)
             _cmdBuffers[*tag].PrepareDraw(renderPassState, resourceRegistry);
             _cmdBuffers[*tag].ExecuteDraw(renderPassState, resourceRegistry);
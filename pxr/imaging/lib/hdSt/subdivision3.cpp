@@ -42,6 +42,7 @@
 #include "pxr/imaging/pxOsd/tokens.h"
 
 #include "pxr/base/gf/vec4i.h"
+#include "pxr/base/work/dispatcher.h"
 
 #include <opensubdiv/version.h>
 #include <opensubdiv/far/patchTable.h>
@@ -191,6 +192,7 @@ public:
                                bool adaptive,
                                int level,
                                SdfPath const &id);
+    virtual ~HdSt_Osd3TopologyComputation();
 
     /// overrides
     virtual bool Resolve();
@@ -199,8 +201,18 @@ protected:
     virtual bool _CheckValid() const;
 
 private:
+    // Runs the Far analysis. It is scheduled on a background task as
+    // soon as this computation is created, so that it overlaps scene
+    // sync and the rest of commit instead of stalling the resolve phase.
+    void _DoFarAnalysis();
+
     HdSt_Osd3Subdivision *_subdivision;
     bool _adaptive;
+
+    WorkDispatcher _dispatcher;
+    OpenSubdiv::Far::StencilTable const *_vertexStencils;
+    OpenSubdiv::Far::StencilTable const *_varyingStencils;
+    OpenSubdiv::Far::PatchTable const *_patchTable;
 };
 
 // ---------------------------------------------------------------------------
@@ -416,28 +428,69 @@ HdSt_Osd3TopologyComputation::HdSt_Osd3TopologyComputation(
     HdSt_MeshTopology *topology,
     bool adaptive, int level, SdfPath const &id)
     : HdSt_OsdTopologyComputation(topology, level, id),
-      _subdivision(subdivision), _adaptive(adaptive)
+      _subdivision(subdivision), _adaptive(adaptive),
+      _vertexStencils(NULL), _varyingStencils(NULL), _patchTable(NULL)
 {
+    // kick off the far analysis in the background right away; the
+    // registered topology is immutable, and Resolve() joins the task
+    // before handing the tables over.
+    _dispatcher.Run([this]() { _DoFarAnalysis(); });
+}
+
+HdSt_Osd3TopologyComputation::~HdSt_Osd3TopologyComputation()
+{
+    // make sure the background analysis has finished before tearing down.
+    _dispatcher.Wait();
+
+    // if the tables were never handed over to the subdivision
+    // (e.g. this computation never resolved), drop them.
+    delete _vertexStencils;
+    delete _varyingStencils;
+    delete _patchTable;
 }
 
 bool
 HdSt_Osd3TopologyComputation::Resolve()
 {
-    using namespace OpenSubdiv;
-
     if (!_TryLock()) return false;
 
     HD_TRACE_FUNCTION();
     HF_MALLOC_TAG_FUNCTION();
 
-    // do far analysis and set stencils and patch table into HdSt_Subdivision.
+    // collect the stencil and patch tables computed by the background
+    // far analysis and set them into HdSt_Subdivision.
+    _dispatcher.Wait();
+
+    if (!TF_VERIFY(_subdivision)) {
+        _SetResolved();
+        return true;
+    }
+
+    // set tables to topology
+    // HdSt_Subdivision takes an ownership of stencilTable and patchTable.
+    _subdivision->SetRefinementTables(_vertexStencils, _varyingStencils,
+                                      _patchTable, _adaptive);
+    _vertexStencils = NULL;
+    _varyingStencils = NULL;
+    _patchTable = NULL;
+
+    _SetResolved();
+    return true;
+}
+
+void
+HdSt_Osd3TopologyComputation::_DoFarAnalysis()
+{
+    using namespace OpenSubdiv;
+
+    HD_TRACE_FUNCTION();
+    HF_MALLOC_TAG_FUNCTION();
 
     // create topology refiner
     PxOsdTopologyRefinerSharedPtr refiner;
 
     if (!TF_VERIFY(_topology)) {
-        _SetResolved();
-        return true;
+        return;
     }
 
     // for empty topology, we don't need to refine anything.
@@ -449,11 +502,6 @@ HdSt_Osd3TopologyComputation::Resolve()
                                               TfToken(_id.GetText()));
     }
 
-    if (!TF_VERIFY(_subdivision)) {
-        _SetResolved();
-        return true;
-    }
-
     // refine
     //  and
     // create stencil/patch table
@@ -471,6 +519,19 @@ HdSt_Osd3TopologyComputation::Resolve()
                 refiner->RefineUniform(_level);
             }
         }
+        // the table factories only read the refined topology, so the
+        // patch table can be built concurrently with the stencil tables.
+        WorkDispatcher dispatcher;
+        dispatcher.Run([&]() {
+            HD_TRACE_SCOPE("patch factory");
+            Far::PatchTableFactory::Options options;
+            if (_adaptive) {
+                options.endCapType =
+                    Far::PatchTableFactory::Options::ENDCAP_BSPLINE_BASIS;
+            }
+
+            patchTable = Far::PatchTableFactory::Create(*refiner, options);
+        });
         {
             HD_TRACE_SCOPE("stencil factory");
             Far::StencilTableFactory::Options options;
@@ -484,16 +545,7 @@ HdSt_Osd3TopologyComputation::Resolve()
                 Far::StencilTableFactory::INTERPOLATE_VARYING;
             varyingStencils = Far::StencilTableFactory::Create(*refiner, options);
         }
-        {
-            HD_TRACE_SCOPE("patch factory");
-            Far::PatchTableFactory::Options options;
-            if (_adaptive) {
-                options.endCapType =
-                    Far::PatchTableFactory::Options::ENDCAP_BSPLINE_BASIS;
-            }
-
-            patchTable = Far::PatchTableFactory::Create(*refiner, options);
-        }
+        dispatcher.Wait();
     }
 
     // merge endcap
@@ -517,13 +569,11 @@ HdSt_Osd3TopologyComputation::Resolve()
         }
     }
 
-    // set tables to topology
-    // HdSt_Subdivision takes an ownership of stencilTable and patchTable.
-    _subdivision->SetRefinementTables(vertexStencils, varyingStencils,
-                                      patchTable, _adaptive);
-
-    _SetResolved();
-    return true;
+    // keep the tables until Resolve() hands them over to the
+    // subdivision.
+    _vertexStencils = vertexStencils;
+    _varyingStencils = varyingStencils;
+    _patchTable = patchTable;
 }
 
 bool
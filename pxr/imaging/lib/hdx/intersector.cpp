@@ -202,13 +202,11 @@ private:
 };
 
 bool
-HdxIntersector::Query(HdxIntersector::Params const& params,
-                      HdRprimCollection const& pickablesCol,
-                      HdEngine* engine,
-                      HdxIntersector::Result* result)
+HdxIntersector::_Render(HdxIntersector::Params const& params,
+                        HdRprimCollection const& pickablesCol,
+                        HdEngine* engine,
+                        GlfDrawTargetRefPtr *drawTargetOut)
 {
-    TRACE_FUNCTION();
-
     // Make sure we're in a sane GL state before attempting anything.
     if (GlfHasLegacyGraphics()) {
         TF_RUNTIME_ERROR("framebuffer object not supported");
@@ -367,6 +365,26 @@ HdxIntersector::Query(HdxIntersector::Params const& params,
 
     GLF_POST_PENDING_GL_ERRORS();
 
+    *drawTargetOut = drawTarget;
+    return true;
+}
+
+bool
+HdxIntersector::Query(HdxIntersector::Params const& params,
+                      HdRprimCollection const& pickablesCol,
+                      HdEngine* engine,
+                      HdxIntersector::Result* result)
+{
+    TRACE_FUNCTION();
+
+    GlfDrawTargetRefPtr drawTarget;
+    if (!_Render(params, pickablesCol, engine, &drawTarget)) {
+        return false;
+    }
+
+    GfVec2i size(drawTarget->GetSize());
+    GfVec4i viewport(0, 0, size[0], size[1]);
+
     //
     // Capture the result buffers to be resolved later.
     //
@@ -409,6 +427,221 @@ HdxIntersector::Query(HdxIntersector::Params const& params,
     return true;
 }
 
+bool
+HdxIntersector::QueryAsync(HdxIntersector::Params const& params,
+                           HdRprimCollection const& pickablesCol,
+                           HdEngine* engine,
+                           HdxIntersector::ResultFuture* future)
+{
+    TRACE_FUNCTION();
+
+    if (!TF_VERIFY(future)) {
+        return false;
+    }
+    if (!glFenceSync) {
+        TF_RUNTIME_ERROR("sync objects not supported");
+        return false;
+    }
+
+    GlfDrawTargetRefPtr drawTarget;
+    if (!_Render(params, pickablesCol, engine, &drawTarget)) {
+        return false;
+    }
+
+    GfVec2i size(drawTarget->GetSize());
+    GfVec4i viewport(0, 0, size[0], size[1]);
+    size_t len = size[0] * size[1];
+
+    //
+    // Schedule the result buffer copies into pixel buffer objects and fence
+    // them, rather than reading them back synchronously. The caller polls
+    // the returned future and resolves it once the GPU has caught up.
+    //
+    GLuint pbos[4];
+    glGenBuffers(4, pbos);
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, pbos[0]);
+    glBufferData(GL_PIXEL_PACK_BUFFER, len*4, NULL, GL_STREAM_READ);
+    glBindTexture(GL_TEXTURE_2D,
+        drawTarget->GetAttachments().at("primId")->GetGlTextureName());
+    glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, pbos[1]);
+    glBufferData(GL_PIXEL_PACK_BUFFER, len*4, NULL, GL_STREAM_READ);
+    glBindTexture(GL_TEXTURE_2D,
+        drawTarget->GetAttachments().at("instanceId")->GetGlTextureName());
+    glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, pbos[2]);
+    glBufferData(GL_PIXEL_PACK_BUFFER, len*4, NULL, GL_STREAM_READ);
+    glBindTexture(GL_TEXTURE_2D,
+        drawTarget->GetAttachments().at("elementId")->GetGlTextureName());
+    glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, pbos[3]);
+    glBufferData(GL_PIXEL_PACK_BUFFER, len*sizeof(float), NULL,
+                 GL_STREAM_READ);
+    glBindTexture(GL_TEXTURE_2D,
+        drawTarget->GetAttachments().at("depth")->GetGlTextureName());
+    glGetTexImage(GL_TEXTURE_2D, 0, GL_DEPTH_COMPONENT, GL_FLOAT, 0);
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    // Submit the copies now so polling the fence can ever succeed.
+    glFlush();
+
+    drawTarget->Unbind();
+    GLF_POST_PENDING_GL_ERRORS();
+
+    *future = ResultFuture(pbos, fence, drawTarget, _index, params, viewport);
+    return true;
+}
+
+HdxIntersector::ResultFuture::ResultFuture()
+    : _fence(nullptr)
+    , _index(nullptr)
+    , _viewport(0,0,0,0)
+{
+    _pbos[0] = _pbos[1] = _pbos[2] = _pbos[3] = 0;
+}
+
+HdxIntersector::ResultFuture::ResultFuture(unsigned int const pbos[4],
+                                           _GLsync fence,
+                                           GlfDrawTargetRefPtr const &drawTarget,
+                                           HdRenderIndex const *index,
+                                           Params const &params,
+                                           GfVec4i viewport)
+    : _fence(fence)
+    , _drawTarget(drawTarget)
+    , _index(index)
+    , _params(params)
+    , _viewport(viewport)
+{
+    for (int i = 0; i < 4; ++i) {
+        _pbos[i] = pbos[i];
+    }
+}
+
+HdxIntersector::ResultFuture::~ResultFuture()
+{
+    _Release();
+}
+
+HdxIntersector::ResultFuture::ResultFuture(ResultFuture &&other)
+    : _fence(other._fence)
+    , _drawTarget(other._drawTarget)
+    , _index(other._index)
+    , _params(other._params)
+    , _viewport(other._viewport)
+{
+    for (int i = 0; i < 4; ++i) {
+        _pbos[i] = other._pbos[i];
+        other._pbos[i] = 0;
+    }
+    other._fence = nullptr;
+    other._drawTarget = TfNullPtr;
+}
+
+HdxIntersector::ResultFuture&
+HdxIntersector::ResultFuture::operator=(ResultFuture &&other)
+{
+    if (this != &other) {
+        _Release();
+        _fence = other._fence;
+        _drawTarget = other._drawTarget;
+        _index = other._index;
+        _params = other._params;
+        _viewport = other._viewport;
+        for (int i = 0; i < 4; ++i) {
+            _pbos[i] = other._pbos[i];
+            other._pbos[i] = 0;
+        }
+        other._fence = nullptr;
+        other._drawTarget = TfNullPtr;
+    }
+    return *this;
+}
+
+void
+HdxIntersector::ResultFuture::_Release()
+{
+    if (_fence) {
+        if (glDeleteSync) {
+            glDeleteSync(_fence);
+        }
+        _fence = nullptr;
+    }
+    if (_pbos[0]) {
+        if (glDeleteBuffers) {
+            glDeleteBuffers(4, _pbos);
+        }
+        _pbos[0] = _pbos[1] = _pbos[2] = _pbos[3] = 0;
+    }
+    _drawTarget = TfNullPtr;
+}
+
+bool
+HdxIntersector::ResultFuture::IsReady() const
+{
+    if (!_fence) {
+        return false;
+    }
+    GLenum status = glClientWaitSync(_fence, 0, 0);
+    return status == GL_ALREADY_SIGNALED || status == GL_CONDITION_SATISFIED;
+}
+
+bool
+HdxIntersector::ResultFuture::Resolve(HdxIntersector::Result* result)
+{
+    TRACE_FUNCTION();
+
+    if (!IsValid()) {
+        return false;
+    }
+
+    // Wait for the copies to land if the caller didn't poll IsReady().
+    GLenum status = glClientWaitSync(_fence, GL_SYNC_FLUSH_COMMANDS_BIT,
+                                     1000000000 /*1 sec*/);
+    while (status == GL_TIMEOUT_EXPIRED) {
+        status = glClientWaitSync(_fence, GL_SYNC_FLUSH_COMMANDS_BIT,
+                                  1000000000 /*1 sec*/);
+    }
+    if (status == GL_WAIT_FAILED) {
+        _Release();
+        return false;
+    }
+
+    size_t len = _viewport[2] * _viewport[3];
+    std::unique_ptr<unsigned char[]> primId(new unsigned char[len*4]);
+    std::unique_ptr<unsigned char[]> instanceId(new unsigned char[len*4]);
+    std::unique_ptr<unsigned char[]> elementId(new unsigned char[len*4]);
+    std::unique_ptr<float[]> depths(new float[len]);
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, _pbos[0]);
+    glGetBufferSubData(GL_PIXEL_PACK_BUFFER, 0, len*4, &primId[0]);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, _pbos[1]);
+    glGetBufferSubData(GL_PIXEL_PACK_BUFFER, 0, len*4, &instanceId[0]);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, _pbos[2]);
+    glGetBufferSubData(GL_PIXEL_PACK_BUFFER, 0, len*4, &elementId[0]);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, _pbos[3]);
+    glGetBufferSubData(GL_PIXEL_PACK_BUFFER, 0, len*sizeof(float),
+                       &depths[0]);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    GLF_POST_PENDING_GL_ERRORS();
+
+    if (result) {
+        *result = HdxIntersector::Result(
+            std::move(primId), std::move(instanceId), std::move(elementId),
+            std::move(depths), _index, _params, _viewport);
+    }
+
+    _Release();
+    return true;
+}
+
 HdxIntersector::Result::Result()
     : _index(nullptr)
     , _viewport(0,0,0,0)
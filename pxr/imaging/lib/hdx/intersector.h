@@ -62,6 +62,7 @@ class HdxIntersector {
 public:
     struct Params;
     class Result;
+    class ResultFuture;
     struct Hit;
 
     HDX_API
@@ -81,6 +82,19 @@ public:
                HdEngine*,
                HdxIntersector::Result*);
 
+    /// Variant of Query that does not stall on the ID buffer readback.
+    /// The ID render is issued as usual, but the result buffers are copied
+    /// into pixel buffer objects and fenced instead of being read back
+    /// immediately. Poll ResultFuture::IsReady() between frames and call
+    /// ResultFuture::Resolve() once it returns true; multiple hit queries
+    /// against the same region can then share the single ID render through
+    /// the Result's Resolve* methods.
+    HDX_API
+    bool QueryAsync(HdxIntersector::Params const&,
+                    HdRprimCollection const&,
+                    HdEngine*,
+                    HdxIntersector::ResultFuture*);
+
     /// Set the resolution of the intersector in pixels. Note that setting this
     /// resolution frequently may result in poor preformance.
     HDX_API
@@ -156,6 +170,63 @@ public:
     typedef std::vector<Hit> HitVector;
     typedef std::unordered_set<Hit, Hit::HitSetHash, Hit::HitSetEq> HitSet;
 
+    /// The in-flight readback of a QueryAsync call. Must be polled and
+    /// resolved on a context that shares objects with the one the query
+    /// was issued on.
+    class ResultFuture {
+    public:
+        HDX_API
+        ResultFuture();
+        HDX_API
+        ~ResultFuture();
+
+        HDX_API
+        ResultFuture(ResultFuture &&);
+        HDX_API
+        ResultFuture& operator=(ResultFuture &&);
+
+        /// Returns true if this future refers to an outstanding query.
+        inline bool IsValid() const {
+            return _fence != nullptr;
+        }
+
+        /// Returns true once the GPU has finished writing the ID buffers
+        /// into the readback buffers. Never blocks.
+        HDX_API
+        bool IsReady() const;
+
+        /// Builds the result from the readback buffers and releases the
+        /// GL resources held by this future. Blocks on the fence if the
+        /// copy hasn't finished yet, so poll IsReady() first to keep the
+        /// draw loop unblocked. Returns false if the future is invalid.
+        HDX_API
+        bool Resolve(HdxIntersector::Result* result);
+
+    private:
+        friend class HdxIntersector;
+
+        // GLsync is not defined in gl.h. It's defined in spec as an opaque
+        // pointer:
+        typedef struct __GLsync *_GLsync;
+
+        ResultFuture(unsigned int const pbos[4],
+                     _GLsync fence,
+                     GlfDrawTargetRefPtr const &drawTarget,
+                     HdRenderIndex const *index,
+                     Params const &params,
+                     GfVec4i viewport);
+
+        void _Release();
+
+        unsigned int _pbos[4];
+        _GLsync _fence;
+        // Keeps the cloned attachments alive until the copy completes.
+        GlfDrawTargetRefPtr _drawTarget;
+        HdRenderIndex const *_index;
+        Params _params;
+        GfVec4i _viewport;
+    };
+
     class Result {
     public:
         HDX_API
@@ -213,6 +284,13 @@ public:
 private:
     void _Init(GfVec2i const&);
 
+    // Issues the ID render into a drawTarget cloned for the current
+    // context, leaving it bound for readback.
+    bool _Render(Params const&,
+                 HdRprimCollection const&,
+                 HdEngine*,
+                 GlfDrawTargetRefPtr *drawTarget);
+
     // Create a shared render pass for pickables and unpickables
     HdRenderPassSharedPtr _pickableRenderPass;
     HdRenderPassSharedPtr _unpickableRenderPass;
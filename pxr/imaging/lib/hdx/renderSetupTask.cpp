@@ -29,6 +29,8 @@
 #include "pxr/imaging/hdSt/camera.h"
 #include "pxr/imaging/hdSt/glslfxShader.h"
 
+#include "pxr/imaging/glf/glslfx.h"
+
 #include "pxr/imaging/hd/changeTracker.h"
 #include "pxr/imaging/hd/package.h"
 #include "pxr/imaging/hd/renderIndex.h"
@@ -192,8 +194,7 @@ HdxRenderSetupTask::_CreateOverrideShader()
         {
             if (!_overrideShader) {
                 GlfGLSLFXSharedPtr glslfx =
-                        GlfGLSLFXSharedPtr(
-                               new GlfGLSLFX(HdPackageFallbackSurfaceShader()));
+                        GlfGLSLFX::GetShared(HdPackageFallbackSurfaceShader());
 
                 _overrideShader =
                               HdShaderCodeSharedPtr(
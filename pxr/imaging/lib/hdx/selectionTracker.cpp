@@ -30,8 +30,10 @@
 #include "pxr/base/tracelite/trace.h"
 #include "pxr/base/work/loops.h"
 
+#include <algorithm>
 #include <limits>
 #include <iomanip>
+#include <unordered_map>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -139,6 +141,145 @@ namespace {
             }
         }
     }
+
+    int const SELECT_ALL = 1;
+    int const SELECT_NONE = 0;
+
+    // Returns the number of ints occupied by the element and instance
+    // sub-tables of a selected object. Must mirror _EncodeSubTables below.
+    size_t _ComputeSubTableSize(
+        VtIntArray const *faceIndices,
+        std::vector<VtIntArray> const *instances)
+    {
+        size_t size = 0;
+
+        if (faceIndices && faceIndices->size()) {
+            int minElem = std::numeric_limits<int>::max();
+            int maxElem = std::numeric_limits<int>::lowest();
+
+            for (int const& elemId : *faceIndices) {
+                minElem = std::min(minElem, elemId);
+                maxElem = std::max(maxElem, elemId);
+            }
+
+            size += maxElem - minElem + 1 + 2;
+        }
+
+        if (instances) {
+            // Different instances can have different number of levels.
+            int numLevels = std::numeric_limits<int>::max();
+            size_t numInst = instances->size();
+            if (numInst == 0) {
+                numLevels = 0;
+            } else {
+                for (size_t instNum = 0; instNum < numInst; ++instNum) {
+                    size_t levelsForInst = instances->at(instNum).size();
+                    numLevels = std::min(numLevels,
+                                         static_cast<int>(levelsForInst));
+                }
+            }
+
+            for (int level = 0; level < numLevels; ++level) {
+                int levelMin = std::numeric_limits<int>::max();
+                int levelMax = std::numeric_limits<int>::lowest();
+                for (VtIntArray const &instVec : *instances) {
+                    int instId = instVec[level];
+                    levelMin = std::min(levelMin, instId);
+                    levelMax = std::max(levelMax, instId);
+                }
+                size += levelMax - levelMin + 2 + 1;
+            }
+        }
+
+        return size;
+    }
+
+    // Writes the element and instance sub-tables of a selected object at
+    // \p offset and returns the value to store in the object's slot:
+    // SELECT_ALL when the whole object is selected, or the offset of the
+    // outermost sub-table.
+    int _EncodeSubTables(
+        VtIntArray const *faceIndices,
+        std::vector<VtIntArray> const *instances,
+        size_t offset,
+        std::vector<int> *output)
+    {
+        // ------------------------------------------------------------------ //
+        // Elements
+        // ------------------------------------------------------------------ //
+        int elemOffset = SELECT_ALL;
+        if (faceIndices && faceIndices->size()) {
+            int minElem = std::numeric_limits<int>::max();
+            int maxElem = std::numeric_limits<int>::lowest();
+
+            for (int const& elemId : *faceIndices) {
+                minElem = std::min(minElem, elemId);
+                maxElem = std::max(maxElem, elemId);
+            }
+
+            (*output)[offset+0] = minElem;
+            (*output)[offset+1] = maxElem+1;
+
+            for (int elemId : *faceIndices) {
+                // TODO: Add support for edge and point selection.
+                (*output)[2+offset+ (elemId-minElem)] = SELECT_ALL;
+            }
+
+            elemOffset = static_cast<int>(offset);
+            offset += maxElem - minElem + 1 + 2;
+        }
+
+        // ------------------------------------------------------------------ //
+        // Instances
+        // ------------------------------------------------------------------ //
+        // Initialize prevLevel to elemOffset which removes a special case in
+        // the loops below.
+        int prevLevelOffset = elemOffset;
+        int objectValue = elemOffset;
+
+        if (instances) {
+            // Different instances can have different number of levels.
+            int numLevels = std::numeric_limits<int>::max();
+            size_t numInst = instances->size();
+            if (numInst == 0) {
+                numLevels = 0;
+            } else {
+                for (size_t instNum = 0; instNum < numInst; ++instNum) {
+                    size_t levelsForInst = instances->at(instNum).size();
+                    numLevels = std::min(numLevels,
+                                         static_cast<int>(levelsForInst));
+                }
+            }
+
+            for (int level = 0; level < numLevels; ++level) {
+                // Find the required size of the instance vectors.
+                int levelMin = std::numeric_limits<int>::max();
+                int levelMax = std::numeric_limits<int>::lowest();
+                for (VtIntArray const &instVec : *instances) {
+                    int instId = instVec[level];
+                    levelMin = std::min(levelMin, instId);
+                    levelMax = std::max(levelMax, instId);
+                }
+
+                int levelOffset = static_cast<int>(offset);
+                (*output)[levelOffset + 0] = levelMin;
+                (*output)[levelOffset + 1] = levelMax + 1;
+                for (VtIntArray const& instVec : *instances) {
+                    int instId = instVec[level] - levelMin+2;
+                    (*output)[levelOffset+instId] = prevLevelOffset;
+                }
+
+                offset += levelMax - levelMin + 2 + 1;
+                prevLevelOffset = levelOffset;
+            }
+
+            if (numLevels > 0) {
+                objectValue = prevLevelOffset;
+            }
+        }
+
+        return objectValue;
+    }
 }
 
 /*virtual*/
@@ -175,13 +316,13 @@ HdxSelectionTracker::GetSelectionOffsetBuffer(HdRenderIndex const* index,
     // (i.e., in this case, we avoid the removal of draw items corresponding to 
     // selected objects, and adding them to a pass with selection info). 
 
-    // Given a set of selected objects, we encode it into a integer buffer that 
-    // allows us to perform a minimal set of operations to early-exit for the 
-    // general case, wherein the fragment does not need selection highlighting. 
-    // 
-    // XXX: We currently update the selection buffer in its *entirety* on 
-    // each update, resulting in poor performance when a large number of 
-    // objects are selected.
+    // Given a set of selected objects, we encode it into a integer buffer that
+    // allows us to perform a minimal set of operations to early-exit for the
+    // general case, wherein the fragment does not need selection highlighting.
+    //
+    // The buffer is rebuilt only when the selection version changes (see
+    // HdxSelectionTask), and both its size and the rebuild time scale with
+    // the number of selected objects rather than the size of the scene.
     // -------------------------------------------------------------------------
 
     // Populate a selection offset buffer that holds offset data per selection
@@ -275,11 +416,6 @@ HdxSelectionTracker::_GetSelectionOffsets(HdxSelectionHighlightMode const& mode,
         return false;
     }
 
-    // Note that numeric_limits<float>::min for is surprising, so using lowest()
-    // here instead. Doing this for <int> here to avoid copy and paste bugs.
-    int min = std::numeric_limits<int>::max(),
-        max = std::numeric_limits<int>::lowest();
-
     std::vector<int> ids;
     ids.resize(numPrims);
 
@@ -299,13 +435,20 @@ HdxSelectionTracker::_GetSelectionOffsets(HdxSelectionHighlightMode const& mode,
         }
     });
 
+    // Sorted, uniqued valid ids form the object-level table, so its size
+    // scales with the selection rather than the range of prim ids in use.
+    std::vector<int> sortedIds;
+    sortedIds.reserve(numPrims);
     for (int id : ids) {
-        if (id == INVALID) continue;
-        min = std::min(id, min);
-        max = std::max(id, max);
+        if (id != INVALID) {
+            sortedIds.push_back(id);
+        }
     }
+    std::sort(sortedIds.begin(), sortedIds.end());
+    sortedIds.erase(std::unique(sortedIds.begin(), sortedIds.end()),
+                    sortedIds.end());
 
-    if (max < min) {
+    if (sortedIds.empty()) {
         return false;
     }
 
@@ -315,165 +458,112 @@ HdxSelectionTracker::_GetSelectionOffsets(HdxSelectionHighlightMode const& mode,
     // In the folowing code, we want to build up a buffer that is capable of
     // driving selection highlighting. To do this, we leverage the fact that all
     // shaders have access to the drawing coord, namely the ObjectID,
-    // InstanceID, FaceID, VertexID, etc. The idea is to take one such ID and
-    // compare it against a range of known selected values within a given range.
+    // InstanceID, FaceID, VertexID, etc. The object level is a sparse table
+    // of the selected prim ids, sorted so the shader can binary search it:
     //
-    // For example, imagine the ObjectID is 6, then we can know this object is
-    // selected if ID 6 is in the range of selected objects. We then
-    // hierarchically re-apply this scheme for instances and faces. The buffer
-    // layout is as follows:
+    // Object: [ count | sorted prim ids | (value per prim id) ]
     //
-    // Object: [ start index | end index | (offset to next level per object) ]
-    //
-    // So to test if a given object ID is selected, we check if the ID is in the
-    // range [start,end), if so, the object's offset in the buffer is ID-start.
-    // 
     // The value for an object is one of three cases:
     //
     //  0 - indicates the object is not selected
     //  1 - indicates the object is fully selected
     //  N - an offset to the next level of the hierarchy
     //
-    // The structure described above for objects is also applied for each level
-    // of instancing as well as for faces. All data is aggregated into a single
-    // buffer with the following layout:
+    // Element and instance sub-tables are dense over the range of selected
+    // indices, prefixed with their [start,end) range:
+    //
+    // [ start index | end index | (offset to next level per index) ]
+    //
+    // and the values of each range follow the three cases outlined. Levels
+    // of instancing are chained through these offsets, and all data is
+    // aggregated into a single buffer with the following layout:
     //
     // [ object | element | instance level-N | ... | level 0 ]
-    //  
-    //  Each section above is prefixed with [start,end) ranges and the values of
-    //  each range follow the three cases outlined.
     //
-    //  To see these values built incrementally, enable the TF_DEBUG flag
+    //  To inspect the generated buffer, enable the TF_DEBUG flag
     //  HDX_SELECTION_SETUP.
     // ---------------------------------------------------------------------- //
 
-    // Start with individual arrays. Splice arrays once finished.
-    int const SELECT_ALL = 1;
-    int const SELECT_NONE = 0;
-
     _DebugPrintArray("ids", ids);
 
-    output->insert(output->end(), 2+1+max-min, SELECT_NONE);
-    (*output)[0] = min;
-    (*output)[1] = max+1;
-
     // XXX: currently, _selectedPrims may have duplicated entries
     // (e.g. to instances and to faces) for an objPath.
     // this would cause unreferenced offset buffer allocated in the
     // result buffer.
-
-    _DebugPrintArray("objects", *output);
-
-    for (size_t primIndex = 0; primIndex < ids.size(); primIndex++) {
-        // TODO: store ID and path in "ids" vector
-        SdfPath const& objPath = selectedPrims[primIndex];
-        int id = ids[primIndex];
-        if (id == INVALID) continue;
-
-        TF_DEBUG(HDX_SELECTION_SETUP).Msg("Processing: %d - %s\n",
-                id, objPath.GetText());
-
-        // ------------------------------------------------------------------ //
-        // Elements
-        // ------------------------------------------------------------------ //
-        // Find element sizes, for this object.
-        int elemOffset = output->size();
-        if (VtIntArray const *faceIndices
-            = TfMapLookupPtr(_selection->GetSelectedElements(mode), objPath)) {
-            if (faceIndices->size()) {
-                int minElem = std::numeric_limits<int>::max();
-                int maxElem = std::numeric_limits<int>::lowest();
-
-                for (int const& elemId : *faceIndices) {
-                    minElem = std::min(minElem, elemId);
-                    maxElem = std::max(maxElem, elemId);
-                }
-
-                // Grow the element array to hold elements for this object.
-                output->insert(output->end(), maxElem-minElem+1+2, SELECT_NONE);
-                (*output)[elemOffset+0] = minElem;
-                (*output)[elemOffset+1] = maxElem+1;
-
-                for (int elemId : *faceIndices) {
-                    // TODO: Add support for edge and point selection.
-                    (*output)[2+elemOffset+ (elemId-minElem)] = SELECT_ALL;
-                }
-                _DebugPrintArray("elements", *output);
-            } else {
-                // Entire object/instance is selected
-                elemOffset = SELECT_ALL;
-            }
-        } else {
-            // Entire object/instance is selected
-            elemOffset = SELECT_ALL;
+    // The last entry for an id wins the object slot, matching the
+    // overwrite behavior of a serial walk over the selection.
+    std::unordered_map<int, size_t> lastOccurrence;
+    for (size_t i = 0; i < numPrims; i++) {
+        if (ids[i] != INVALID) {
+            lastOccurrence[ids[i]] = i;
         }
+    }
 
-        // ------------------------------------------------------------------ //
-        // Instances
-        // ------------------------------------------------------------------ //
-        // Initialize prevLevel to elemOffset which removes a special case in
-        // the loops below.
-        int prevLevelOffset = elemOffset;
+    size_t const numSelected = sortedIds.size();
+    size_t const headerSize = 1 + 2*numSelected;
 
-        if (std::vector<VtIntArray> const * a =
-            TfMapLookupPtr(_selection->GetSelectedInstances(mode), objPath)) {
-            // Different instances can have different number of levels.
-            int numLevels = std::numeric_limits<int>::max();
-            size_t numInst= a->size();
-            if (numInst == 0) {
-                numLevels = 0;
-            } else {
-                for (size_t instNum = 0; instNum < numInst; ++instNum) {
-                    size_t levelsForInst = a->at(instNum).size();
-                    numLevels = std::min(numLevels,
-                                         static_cast<int>(levelsForInst));
-                }
-            }
+    HdxSelection::ElementMap const &elements =
+        _selection->GetSelectedElements(mode);
+    HdxSelection::InstanceMap const &instances =
+        _selection->GetSelectedInstances(mode);
 
-            TF_DEBUG(HDX_SELECTION_SETUP).Msg("NumLevels: %d\n", numLevels);
-            if (numLevels == 0) {
-                (*output)[id-min+2] = elemOffset;
+    // The sub-tables are built in two passes so the work can run in
+    // parallel: first compute the size of each entry's sub-tables, then
+    // scan the sizes into offsets and write every entry into its slice.
+    std::vector<size_t> subTableOffsets(numPrims);
+    WorkParallelForN(numPrims/N + 1,
+       [&subTableOffsets, &ids, INVALID, &N, &selectedPrims,
+        &elements, &instances](size_t begin, size_t end) mutable {
+        end = std::min(end*N, subTableOffsets.size());
+        begin = begin*N;
+        for (size_t i = begin; i < end; i++) {
+            if (ids[i] == INVALID) {
+                subTableOffsets[i] = 0;
+                continue;
             }
-            for (int level = 0; level < numLevels; ++level) {
-                // Find the required size of the instance vectors.
-                int levelMin = std::numeric_limits<int>::max();
-                int levelMax = std::numeric_limits<int>::lowest();
-                for (VtIntArray const &instVec : *a) {
-                    _DebugPrintArray("\tinstVec", instVec, false);
-                    int instId = instVec[level];
-                    levelMin = std::min(levelMin, instId);
-                    levelMax = std::max(levelMax, instId);
-                }
+            subTableOffsets[i] = _ComputeSubTableSize(
+                TfMapLookupPtr(elements, selectedPrims[i]),
+                TfMapLookupPtr(instances, selectedPrims[i]));
+        }
+    });
 
-                TF_DEBUG(HDX_SELECTION_SETUP).Msg(
-                    "level-%d: min(%d) max(%d)\n",
-                    level, levelMin, levelMax);
+    size_t total = headerSize;
+    for (size_t i = 0; i < numPrims; i++) {
+        size_t subTableSize = subTableOffsets[i];
+        subTableOffsets[i] = total;
+        total += subTableSize;
+    }
 
-                int objLevelSize = levelMax - levelMin +2+1;
-                int levelOffset = output->size();
-                output->insert(output->end(), objLevelSize, SELECT_NONE);
-                (*output)[levelOffset + 0] = levelMin;
-                (*output)[levelOffset + 1] = levelMax + 1;
-                for (VtIntArray const& instVec : *a) {
-                    int instId = instVec[level] - levelMin+2;
-                    (*output)[levelOffset+instId] = prevLevelOffset; 
-                }
+    output->clear();
+    output->resize(total, SELECT_NONE);
+    (*output)[0] = static_cast<int>(numSelected);
+    std::copy(sortedIds.begin(), sortedIds.end(), output->begin() + 1);
 
-                if (level == numLevels-1) {
-                    (*output)[id-min+2] = levelOffset;
-                }
-
-                if (ARCH_UNLIKELY(TfDebug::IsEnabled(HDX_SELECTION_SETUP))){
-                    std::stringstream name;
-                    name << "level[" << level << "]";
-                    _DebugPrintArray(name.str(), *output);
-                }
-                prevLevelOffset = levelOffset;
+    // Each entry writes only its own slice and, for the last occurrence
+    // of its id, the object slot, so the fill is safely parallel.
+    WorkParallelForN(numPrims/N + 1,
+       [&output, &ids, INVALID, &N, &selectedPrims, &elements, &instances,
+        &lastOccurrence, &sortedIds, &subTableOffsets,
+        numSelected](size_t begin, size_t end) mutable {
+        end = std::min(end*N, ids.size());
+        begin = begin*N;
+        for (size_t i = begin; i < end; i++) {
+            int id = ids[i];
+            if (id == INVALID) continue;
+
+            int value = _EncodeSubTables(
+                TfMapLookupPtr(elements, selectedPrims[i]),
+                TfMapLookupPtr(instances, selectedPrims[i]),
+                subTableOffsets[i], output);
+
+            if (lastOccurrence.find(id)->second == i) {
+                size_t slot = std::lower_bound(sortedIds.begin(),
+                                               sortedIds.end(), id)
+                              - sortedIds.begin();
+                (*output)[1 + numSelected + slot] = value;
             }
-        } else {
-            (*output)[id-min+2] = elemOffset;
         }
-    }
+    });
 
     _DebugPrintArray("final output", *output);
 
@@ -42,12 +42,20 @@
 
 #include "pxr/imaging/glf/simpleLightingContext.h"
 
+#include "pxr/base/tf/envSetting.h"
+
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(HD_ENABLE_SHADOW_MAP_CACHING, true,
+                      "Reuse shadow maps whose view of the scene is "
+                      "unchanged instead of re-rendering them every frame");
 
 HdxShadowTask::HdxShadowTask(HdSceneDelegate* delegate, SdfPath const& id)
     : HdSceneTask(delegate, id)
     , _collectionVersion(0)
+    , _sceneChangeCount(0)
+    , _shadowMapSize(0)
+    , _numShadowMapLayers(0)
     , _depthBiasEnable(false)
     , _depthBiasConstantFactor(0.0f)
     , _depthBiasSlopeFactor(1.0f)
@@ -82,6 +90,12 @@ HdxShadowTask::_Execute(HdTaskContext* ctx)
     GlfSimpleShadowArrayRefPtr const shadows = lightingContext->GetShadows();
     for(size_t shadowId = 0; shadowId < shadows->GetNumLayers(); shadowId++) {
 
+        // Reuse the previous capture if nothing visible to this shadow
+        // map has changed since it was last rendered.
+        if (!_shadowMapStates[shadowId].needsUpdate) {
+            continue;
+        }
+
         // Bind the framebuffer that will store shadowId shadow map
         shadows->BeginCapture(shadowId, true);
 
@@ -90,6 +104,8 @@ HdxShadowTask::_Execute(HdTaskContext* ctx)
 
         // Unbind the buffer and move on to the next shadow map
         shadows->EndCapture(shadowId);
+
+        _shadowMapStates[shadowId].needsUpdate = false;
     }
 
     // restore GL states to default
@@ -142,6 +158,7 @@ HdxShadowTask::_Sync(HdTaskContext* ctx)
         // and create a pass for each
         _passes.clear();
         _renderPassStates.clear();
+        _shadowMapStates.clear();
 
         HdSceneDelegate* delegate = GetDelegate();
         HdRenderIndex &renderIndex = delegate->GetRenderIndex();
@@ -231,11 +248,48 @@ HdxShadowTask::_Sync(HdTaskContext* ctx)
         }
     }
 
+    static const bool cachingEnabled =
+        TfGetEnvSetting(HD_ENABLE_SHADOW_MAP_CACHING);
+
+    // A shadow map can be reused when its frustum is unchanged, no rprim
+    // has been dirtied since its last capture, and the shadow array still
+    // holds its texels. We don't know which frusta the dirty rprims fall
+    // in, so any rprim change conservatively invalidates every map; for a
+    // static scene with a moving light only that light's map re-renders.
+    HdChangeTracker &changeTracker =
+        GetDelegate()->GetRenderIndex().GetChangeTracker();
+
+    const unsigned sceneChangeCount = changeTracker.GetChangeCount();
+    const bool sceneChanged = (_sceneChangeCount != sceneChangeCount);
+    _sceneChangeCount = sceneChangeCount;
+
+    const bool shadowArrayRealloc =
+        (_shadowMapSize != shadows->GetSize() ||
+         _numShadowMapLayers != shadows->GetNumLayers());
+    _shadowMapSize = shadows->GetSize();
+    _numShadowMapLayers = shadows->GetNumLayers();
+
+    // Newly created entries start out needing an update.
+    _shadowMapStates.resize(_passes.size());
+
     for(size_t passId = 0; passId < _passes.size() ; passId++) {
+        const GfMatrix4d viewMatrix = shadows->GetViewMatrix(passId);
+        const GfMatrix4d projectionMatrix =
+            shadows->GetProjectionMatrix(passId);
+
+        _ShadowMapState &state = _shadowMapStates[passId];
+        if (!cachingEnabled || sceneChanged || shadowArrayRealloc ||
+            state.viewMatrix != viewMatrix ||
+            state.projectionMatrix != projectionMatrix) {
+            state.viewMatrix = viewMatrix;
+            state.projectionMatrix = projectionMatrix;
+            state.needsUpdate = true;
+        }
+
         // Move the camera to the correct position to take the shadow map
-        _renderPassStates[passId]->SetCamera( 
-            shadows->GetViewMatrix(passId), 
-            shadows->GetProjectionMatrix(passId),
+        _renderPassStates[passId]->SetCamera(
+            viewMatrix,
+            projectionMatrix,
             GfVec4d(0,0,shadows->GetSize()[0],shadows->GetSize()[1]));
 
         _renderPassStates[passId]->Sync(
@@ -32,7 +32,9 @@
 #include "pxr/imaging/hd/task.h"
 #include "pxr/imaging/hd/renderPassShader.h"
 
+#include "pxr/base/gf/matrix4d.h"
 #include "pxr/base/gf/vec2f.h"
+#include "pxr/base/gf/vec2i.h"
 #include "pxr/base/gf/vec4f.h"
 #include "pxr/base/gf/vec4d.h"
 
@@ -72,10 +74,34 @@ protected:
     virtual void _Sync(HdTaskContext* ctx);
 
 private:
+    // Per-pass dirty tracking, used to skip re-rendering shadow maps
+    // whose view of the scene is unchanged since their last capture.
+    struct _ShadowMapState {
+        _ShadowMapState()
+            : viewMatrix(1.0)
+            , projectionMatrix(1.0)
+            , needsUpdate(true)
+            {}
+
+        GfMatrix4d viewMatrix;
+        GfMatrix4d projectionMatrix;
+        bool needsUpdate;
+    };
+
     HdRenderPassSharedPtrVector _passes;
     HdRenderPassStateSharedPtrVector _renderPassStates;
+    std::vector<_ShadowMapState> _shadowMapStates;
     int _collectionVersion;
 
+    // Change tracker state as of the last sync, used to detect whether
+    // any rprim has been dirtied since the shadow maps were captured.
+    unsigned _sceneChangeCount;
+
+    // Shadow array dimensions as of the last sync; resizing the array
+    // frees its texels, invalidating all cached maps.
+    GfVec2i _shadowMapSize;
+    size_t _numShadowMapLayers;
+
     /// Polygon Offset State
     bool _depthBiasEnable;
     float _depthBiasConstantFactor;
@@ -95,6 +95,9 @@ HdxTaskController::HdxTaskController(HdRenderIndex *renderIndex,
                                      SdfPath const& controllerId)
     : _index(renderIndex)
     , _controllerId(controllerId)
+    , _progressiveRenderingEnabled(false)
+    , _reducedQuality(false)
+    , _idleFramesLeft(0)
     , _intersector(new HdxIntersector(renderIndex))
     , _delegate(renderIndex, controllerId)
 {
@@ -236,6 +239,14 @@ HdxTaskController::GetTasks(TfToken const& taskSet)
 {
     _tasks.clear();
 
+    // Advance the progressive rendering state machine: once the camera has
+    // been idle for a few frames, restore the full-quality params.
+    if (_reducedQuality && _idleFramesLeft > 0) {
+        if (--_idleFramesLeft == 0) {
+            _SetReducedQuality(false);
+        }
+    }
+
     // Light
     if (!_activeLightTaskId.IsEmpty()) {
         _tasks.push_back(GetRenderIndex()->GetTask(_activeLightTaskId));
@@ -280,6 +291,17 @@ HdxTaskController::SetCollection(HdRprimCollection const& collection)
     }
 }
 
+// Returns a cheaper variant of \p params for use during camera motion.
+static HdxRenderTaskParams
+_ReduceQuality(HdxRenderTaskParams params)
+{
+    params.complexity = HdComplexityLow;
+    params.tessLevel = std::min(params.tessLevel, 1.0f);
+    // Skip prims smaller than a few pixels while interacting.
+    params.drawingRange[0] = std::max(params.drawingRange[0], 3.0f);
+    return params;
+}
+
 void
 HdxTaskController::SetRenderParams(HdxRenderTaskParams const& params)
 {
@@ -295,6 +317,13 @@ HdxTaskController::SetRenderParams(HdxRenderTaskParams const& params)
     mergedParams.camera = oldParams.camera;
     mergedParams.viewport = oldParams.viewport;
 
+    if (!params.enableIdRender) {
+        _fullQualityParams = mergedParams;
+        if (_reducedQuality) {
+            mergedParams = _ReduceQuality(mergedParams);
+        }
+    }
+
     if (mergedParams != oldParams) {
         _delegate.SetParameter(task, HdTokens->params, mergedParams);
         GetRenderIndex()->GetChangeTracker().MarkTaskDirty(
@@ -486,6 +515,7 @@ HdxTaskController::SetCameraMatrices(GfMatrix4d const& viewMatrix,
         // Invalidate the camera
         GetRenderIndex()->GetChangeTracker().MarkSprimDirty(_cameraId,
             HdStCamera::DirtyViewMatrix);
+        _NoteCameraMotion();
     }
 
     GfMatrix4d oldProj = _delegate.GetParameter<GfMatrix4d>(_cameraId,
@@ -498,6 +528,7 @@ HdxTaskController::SetCameraMatrices(GfMatrix4d const& viewMatrix,
         // Invalidate the camera
         GetRenderIndex()->GetChangeTracker().MarkSprimDirty(_cameraId,
             HdStCamera::DirtyProjMatrix);
+        _NoteCameraMotion();
     }
 }
 
@@ -526,6 +557,7 @@ HdxTaskController::SetCameraViewport(GfVec4d const& viewport)
         GetRenderIndex()->GetChangeTracker().MarkTaskDirty(
             tasks[i], HdChangeTracker::DirtyParams);
     }
+    _fullQualityParams.viewport = viewport;
 }
 
 void
@@ -563,4 +595,55 @@ HdxTaskController::IsConverged() const
         ->IsConverged();
 }
 
+void
+HdxTaskController::SetEnableProgressiveRendering(bool enable)
+{
+    if (_progressiveRenderingEnabled == enable) {
+        return;
+    }
+    _progressiveRenderingEnabled = enable;
+    if (enable) {
+        // Capture the current color render params as the quality to
+        // restore after interaction.
+        _fullQualityParams = _delegate.GetParameter<HdxRenderTaskParams>(
+            _renderTaskId, HdTokens->params);
+    } else {
+        _idleFramesLeft = 0;
+        _SetReducedQuality(false);
+    }
+}
+
+void
+HdxTaskController::_NoteCameraMotion()
+{
+    if (!_progressiveRenderingEnabled) {
+        return;
+    }
+    // The number of consecutive idle GetTasks() calls before we consider
+    // the camera at rest and converge at full quality.
+    static const int idleFramesBeforeConverge = 3;
+    _idleFramesLeft = idleFramesBeforeConverge;
+    _SetReducedQuality(true);
+}
+
+void
+HdxTaskController::_SetReducedQuality(bool reduced)
+{
+    if (_reducedQuality == reduced) {
+        return;
+    }
+    _reducedQuality = reduced;
+
+    HdxRenderTaskParams params = reduced ? _ReduceQuality(_fullQualityParams)
+                                         : _fullQualityParams;
+    _delegate.SetParameter(_renderTaskId, HdTokens->params, params);
+    GetRenderIndex()->GetChangeTracker().MarkTaskDirty(
+        _renderTaskId, HdChangeTracker::DirtyParams);
+
+    if (!reduced) {
+        // Start converging the full-quality image from scratch.
+        ResetImage();
+    }
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
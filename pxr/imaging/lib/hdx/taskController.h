@@ -181,6 +181,16 @@ public:
     HDX_API
     bool IsConverged() const;
 
+    /// Enables reduced-quality rendering while the camera is moving.
+    /// While enabled, camera changes switch the color render task to a
+    /// cheaper parameter set (low complexity, clamped tessellation and
+    /// small-prim culling through the drawing range); once the camera has
+    /// been idle for a few frames, the full-quality parameters are restored
+    /// and the image is reset so that renderers converge at full quality.
+    /// Disabled by default.
+    HDX_API
+    void SetEnableProgressiveRendering(bool enable);
+
 private:
     ///
     /// This class is not intended to be copied.
@@ -194,6 +204,19 @@ private:
     HdTaskSharedPtrVector _tasks;
     std::unique_ptr<HdxIntersector> _intersector;
 
+    // Progressive rendering state machine; see
+    // SetEnableProgressiveRendering(). _NoteCameraMotion() arms the
+    // reduced-quality state, which GetTasks() disarms after the camera
+    // has been idle for a few frames.
+    void _NoteCameraMotion();
+    void _SetReducedQuality(bool reduced);
+
+    bool _progressiveRenderingEnabled;
+    bool _reducedQuality;
+    int _idleFramesLeft;
+    // The color render task params to restore after interaction.
+    HdxRenderTaskParams _fullQualityParams;
+
     // Create taskController objects. Since the camera is a parameter
     // to the tasks, _CreateCamera() should be called first.
     void _CreateCamera();
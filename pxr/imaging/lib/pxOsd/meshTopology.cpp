@@ -29,11 +29,46 @@
 #include "pxr/imaging/pxOsd/tokens.h"
 
 #include "pxr/base/tracelite/trace.h"
+#include "pxr/base/arch/hash.h"
 #include "pxr/base/tf/diagnostic.h"
 #include "pxr/base/tf/debug.h"
+#include "pxr/base/work/loops.h"
+
+#include <algorithm>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+namespace {
+
+// Hash a large buffer by hashing fixed-size chunks in parallel and then
+// hashing the per-chunk digests.  The chunking is independent of the thread
+// count, so the result is deterministic.  Small buffers hash directly.
+uint64_t
+_ParallelHashBuffer(char const *data, size_t numBytes, uint64_t seed)
+{
+    static const size_t chunkBytes = 1024*1024;
+    if (numBytes <= chunkBytes) {
+        return ArchHash64(data, numBytes, seed);
+    }
+    const size_t numChunks = (numBytes + chunkBytes - 1) / chunkBytes;
+    std::vector<uint64_t> chunkHashes(numChunks);
+    WorkParallelForN(
+        numChunks,
+        [&](size_t begin, size_t end) {
+            for (size_t i = begin; i != end; ++i) {
+                const size_t offset = i * chunkBytes;
+                chunkHashes[i] = ArchHash64(
+                    data + offset,
+                    std::min(chunkBytes, numBytes - offset), seed);
+            }
+        });
+    return ArchHash64((char const *)chunkHashes.data(),
+                      numChunks * sizeof(uint64_t), seed);
+}
+
+} // end anonymous namespace
+
 
 PxOsdMeshTopology::PxOsdMeshTopology() :
     _scheme(PxOsdOpenSubdivTokens->bilinear),
@@ -49,7 +84,35 @@ PxOsdMeshTopology::PxOsdMeshTopology(PxOsdMeshTopology const & src) :
     _faceVertexCounts(src._faceVertexCounts),
     _faceVertexIndices(src._faceVertexIndices),
     _holeIndices(src._holeIndices),
-    _subdivTags(src._subdivTags) { }
+    _subdivTags(src._subdivTags)
+{
+    // The copy owns its own subdiv tags, so its hash is cacheable even if
+    // the source's was not; carry over the cached value when it is valid.
+    if (src._hashValid.load(std::memory_order_acquire)) {
+        _hash.store(src._hash.load(std::memory_order_relaxed),
+                    std::memory_order_relaxed);
+        _hashValid.store(true, std::memory_order_relaxed);
+    }
+}
+
+PxOsdMeshTopology &
+PxOsdMeshTopology::operator=(PxOsdMeshTopology const & src)
+{
+    _scheme = src._scheme;
+    _orientation = src._orientation;
+    _faceVertexCounts = src._faceVertexCounts;
+    _faceVertexIndices = src._faceVertexIndices;
+    _holeIndices = src._holeIndices;
+    _subdivTags = src._subdivTags;
+    if (src._hashValid.load(std::memory_order_acquire)) {
+        _hash.store(src._hash.load(std::memory_order_relaxed),
+                    std::memory_order_relaxed);
+        _hashValid.store(true, std::memory_order_relaxed);
+    } else {
+        _DirtyHash();
+    }
+    return *this;
+}
 
 PxOsdMeshTopology::PxOsdMeshTopology(TfToken scheme,
                                      TfToken orientation,
@@ -86,15 +149,25 @@ PxOsdMeshTopology::ComputeHash() const {
 
     TRACE_FUNCTION();
 
+    const bool cacheable = !_hashUncacheable.load(std::memory_order_relaxed);
+    if (cacheable && _hashValid.load(std::memory_order_acquire)) {
+        return _hash.load(std::memory_order_relaxed);
+    }
+
     ID hash = _subdivTags.ComputeHash();
     hash = ArchHash64((const char*)&_scheme, sizeof(TfToken), hash);
     hash = ArchHash64((const char*)&_orientation, sizeof(TfToken), hash);
-    hash = ArchHash64((const char*)_faceVertexCounts.cdata(),
-                      _faceVertexCounts.size() * sizeof(int), hash);
-    hash = ArchHash64((const char*)_faceVertexIndices.cdata(),
-                      _faceVertexIndices.size() * sizeof(int), hash);
-    hash = ArchHash64((const char*)_holeIndices.cdata(),
-                      _holeIndices.size() * sizeof(int), hash);
+    hash = _ParallelHashBuffer((const char*)_faceVertexCounts.cdata(),
+                               _faceVertexCounts.size() * sizeof(int), hash);
+    hash = _ParallelHashBuffer((const char*)_faceVertexIndices.cdata(),
+                               _faceVertexIndices.size() * sizeof(int), hash);
+    hash = _ParallelHashBuffer((const char*)_holeIndices.cdata(),
+                               _holeIndices.size() * sizeof(int), hash);
+
+    if (cacheable) {
+        _hash.store(hash, std::memory_order_relaxed);
+        _hashValid.store(true, std::memory_order_release);
+    }
     return hash;
 }
 
@@ -126,6 +199,7 @@ PxOsdMeshTopology::SetHoleIndices(VtIntArray const &holeIndices)
         }
     }
     _holeIndices = holeIndices;
+    _DirtyHash();
 }
 
 std::ostream&
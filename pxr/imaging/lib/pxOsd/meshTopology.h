@@ -38,6 +38,8 @@
 #include <boost/shared_ptr.hpp>
 #include <boost/weak_ptr.hpp>
 
+#include <atomic>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 
@@ -77,6 +79,9 @@ public:
         VtIntArray faceVertexIndices,
         VtIntArray holeIndices);
 
+    PXOSD_API
+    PxOsdMeshTopology &operator=(const PxOsdMeshTopology &);
+
 public:
 
     /// Returns the subdivision scheme
@@ -91,6 +96,7 @@ public:
     /// compatibility, but has been deprecated.
     void SetScheme(TfToken const& scheme) {
         _scheme = scheme;
+        _DirtyHash();
     }
 
     /// Returns face vertex counts.
@@ -136,6 +142,7 @@ public:
     /// Sets subdivision tags
     void SetSubdivTags(PxOsdSubdivTags const &subdivTags) {
         _subdivTags = subdivTags;
+        _DirtyHash();
     }
 
     /// Returns subdivision tags
@@ -145,6 +152,10 @@ public:
 
     /// Returns subdivision tags (non-const)
     PxOsdSubdivTags & GetSubdivTags() {
+        // We can't see mutations made through the returned reference, so
+        // stop trusting the cached hash for this object for good.
+        _hashUncacheable.store(true, std::memory_order_relaxed);
+        _DirtyHash();
         return _subdivTags;
     }
 
@@ -153,6 +164,10 @@ public:
 public:
 
     /// Returns the hash value of this topology to be used for instancing.
+    ///
+    /// The hash is computed on first use and cached; mutating the topology
+    /// through any of the Set methods invalidates it, so repeated
+    /// identity checks do not re-read the index arrays.
     PXOSD_API
     ID ComputeHash() const;
 
@@ -160,6 +175,13 @@ public:
     PXOSD_API
     bool operator==(PxOsdMeshTopology const &other) const;
 
+private:
+
+    // Invalidate the cached topology hash.  Every mutator must call this.
+    void _DirtyHash() {
+        _hashValid.store(false, std::memory_order_relaxed);
+    }
+
 private:
 
     // note: if you're going to add more members, make sure
@@ -173,6 +195,15 @@ private:
     VtIntArray _holeIndices;
 
     PxOsdSubdivTags _subdivTags;
+
+    // Cached result of ComputeHash.  Computing the hash re-reads every
+    // index array, so it is memoized here; a benign race may recompute it
+    // concurrently, but all writers store the same value.  The cache is
+    // disabled permanently once a caller obtains a mutable reference to
+    // the subdiv tags, since mutations through it are invisible to us.
+    mutable std::atomic<ID> _hash{0};
+    mutable std::atomic<bool> _hashValid{false};
+    mutable std::atomic<bool> _hashUncacheable{false};
 };
 
 PXOSD_API
@@ -51,6 +51,9 @@ TF_DEFINE_ENV_SETTING(HDEMBREE_AMBIENT_OCCLUSION_SAMPLES, 16,
 TF_DEFINE_ENV_SETTING(HDEMBREE_SUBDIVISION_CACHE, 128*1024*1024,
         "Number of bytes to allocate for the embree subdivision surface cache (must be >= 128MB)");
 
+TF_DEFINE_ENV_SETTING(HDEMBREE_ADAPTIVE_SAMPLING, 1,
+        "Should HdEmbree stop sampling pixels whose variance has converged? (values > 0 are true)");
+
 TF_DEFINE_ENV_SETTING(HDEMBREE_FIX_RANDOM_SEED, 0,
         "Should HdEmbree sampling use a fixed random seed? (values > 0 are true)");
 
@@ -76,6 +79,7 @@ HdEmbreeConfig::HdEmbreeConfig()
             TfGetEnvSetting(HDEMBREE_AMBIENT_OCCLUSION_SAMPLES));
     subdivisionCache = std::max(128*1024*1024,
             TfGetEnvSetting(HDEMBREE_SUBDIVISION_CACHE));
+    adaptiveSampling = (TfGetEnvSetting(HDEMBREE_ADAPTIVE_SAMPLING) > 0);
     fixRandomSeed = (TfGetEnvSetting(HDEMBREE_FIX_RANDOM_SEED) > 0);
     useFaceColors = (TfGetEnvSetting(HDEMBREE_USE_FACE_COLORS) > 0);
     cameraLightIntensity = (std::max(100,
@@ -94,6 +98,8 @@ HdEmbreeConfig::HdEmbreeConfig()
             <<    ambientOcclusionSamples << "\n"
             << "  subdivisionCache           = "
             <<    subdivisionCache        << "\n"
+            << "  adaptiveSampling           = "
+            <<    adaptiveSampling        << "\n"
             << "  fixRandomSeed              = "
             <<    fixRandomSeed           << "\n"
             << "  useFaceColors              = "
@@ -76,6 +76,15 @@ public:
     /// Override with *HDEMBREE_SUBDIVISION_CACHE*.
     unsigned int subdivisionCache;
 
+    /// Should the renderpass distribute samples adaptively? When enabled,
+    /// pixels whose accumulated color variance has fallen below an internal
+    /// threshold stop receiving samples, leaving more of the frame budget
+    /// for the pixels that are still noisy.
+    ///
+    /// Override with *HDEMBREE_ADAPTIVE_SAMPLING*. Integer values greater
+    /// than zero are considered "true".
+    bool adaptiveSampling;
+
     /// Should the renderpass's sampling functions use a fixed random seed?
     /// (Helpful for things like unit tests, to get consistent results).
     ///
@@ -37,7 +37,7 @@ PXR_NAMESPACE_OPEN_SCOPE
 /// \class HdEmbreePrototypeContext
 ///
 /// A small bit of state attached to each bit of prototype geometry in embree,
-/// for the benefit of HdEmbreeRenderPass::_TraceRay.
+/// for the benefit of HdEmbreeRenderPass::_Shade.
 ///
 struct HdEmbreePrototypeContext
 {
@@ -52,7 +52,7 @@ struct HdEmbreePrototypeContext
 /// \class HdEmbreeInstanceContext
 ///
 /// A small bit of state attached to each bit of instanced geometry in embree,
-/// for the benefit of HdEmbreeRenderPass::_TraceRay.
+/// for the benefit of HdEmbreeRenderPass::_Shade.
 ///
 struct HdEmbreeInstanceContext
 {
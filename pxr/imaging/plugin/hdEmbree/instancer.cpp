@@ -34,6 +34,9 @@
 #include "pxr/base/gf/rotation.h"
 #include "pxr/base/gf/quaternion.h"
 #include "pxr/base/tf/staticTokens.h"
+#include "pxr/base/work/loops.h"
+
+#include <memory>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -128,60 +131,86 @@ HdEmbreeInstancer::ComputeInstanceTransforms(SdfPath const &prototypeId)
         GetDelegate()->GetInstanceIndices(GetId(), prototypeId);
 
     VtMatrix4dArray transforms(instanceIndices.size());
-    for (size_t i = 0; i < instanceIndices.size(); ++i) {
-        transforms[i] = instancerTransform;
-    }
 
-    // "translate" holds a translation vector for each index.
+    // Create a sampler for each authored transform component. The samplers
+    // only read the cached primvar buffers, so the per-index composition
+    // below is pure math and can be distributed across the worker threads;
+    // large instancers (forests, crowds) routinely have millions of indices.
+    std::unique_ptr<HdEmbreeBufferSampler> translateSampler;
     if (_primvarMap.count(_tokens->translate) > 0) {
-        HdEmbreeBufferSampler sampler(*_primvarMap[_tokens->translate]);
-        for (size_t i = 0; i < instanceIndices.size(); ++i) {
-            GfVec3f translate;
-            if (sampler.Sample(instanceIndices[i], &translate)) {
-                GfMatrix4d translateMat(1);
-                translateMat.SetTranslate(GfVec3d(translate));
-                transforms[i] = translateMat * transforms[i];
-            }
-        }
+        translateSampler.reset(
+            new HdEmbreeBufferSampler(*_primvarMap[_tokens->translate]));
     }
-
-    // "rotate" holds a quaternion in <real, i, j, k> format for each index.
+    std::unique_ptr<HdEmbreeBufferSampler> rotateSampler;
     if (_primvarMap.count(_tokens->rotate) > 0) {
-        HdEmbreeBufferSampler sampler(*_primvarMap[_tokens->rotate]);
-        for (size_t i = 0; i < instanceIndices.size(); ++i) {
-            GfVec4f quat;
-            if (sampler.Sample(instanceIndices[i], &quat)) {
-                GfMatrix4d rotateMat(1);
-                rotateMat.SetRotate(GfRotation(GfQuaternion(
-                    quat[0], GfVec3d(quat[1], quat[2], quat[3]))));
-                transforms[i] = rotateMat * transforms[i];
-            }
-        }
+        rotateSampler.reset(
+            new HdEmbreeBufferSampler(*_primvarMap[_tokens->rotate]));
     }
-
-    // "scale" holds an axis-aligned scale vector for each index.
+    std::unique_ptr<HdEmbreeBufferSampler> scaleSampler;
     if (_primvarMap.count(_tokens->scale) > 0) {
-        HdEmbreeBufferSampler sampler(*_primvarMap[_tokens->scale]);
-        for (size_t i = 0; i < instanceIndices.size(); ++i) {
-            GfVec3f scale;
-            if (sampler.Sample(instanceIndices[i], &scale)) {
-                GfMatrix4d scaleMat(1);
-                scaleMat.SetScale(GfVec3d(scale));
-                transforms[i] = scaleMat * transforms[i];
-            }
-        }
+        scaleSampler.reset(
+            new HdEmbreeBufferSampler(*_primvarMap[_tokens->scale]));
     }
-
-    // "instanceTransform" holds a 4x4 transform matrix for each index.
+    std::unique_ptr<HdEmbreeBufferSampler> instanceTransformSampler;
     if (_primvarMap.count(_tokens->instanceTransform) > 0) {
-        HdEmbreeBufferSampler sampler(*_primvarMap[_tokens->instanceTransform]);
-        for (size_t i = 0; i < instanceIndices.size(); ++i) {
-            GfMatrix4d instanceTransform;
-            if (sampler.Sample(instanceIndices[i], &instanceTransform)) {
-                transforms[i] = instanceTransform * transforms[i];
+        instanceTransformSampler.reset(
+            new HdEmbreeBufferSampler(*_primvarMap[_tokens->instanceTransform]));
+    }
+
+    // Detach the output array once, up front; the worker threads then write
+    // disjoint elements through the raw pointer.
+    GfMatrix4d *transformsData = transforms.data();
+
+    WorkParallelForN(instanceIndices.size(),
+        [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            GfMatrix4d transform = instancerTransform;
+
+            // "translate" holds a translation vector for each index.
+            if (translateSampler) {
+                GfVec3f translate;
+                if (translateSampler->Sample(instanceIndices[i], &translate)) {
+                    GfMatrix4d translateMat(1);
+                    translateMat.SetTranslate(GfVec3d(translate));
+                    transform = translateMat * transform;
+                }
             }
+
+            // "rotate" holds a quaternion in <real, i, j, k> format for each
+            // index.
+            if (rotateSampler) {
+                GfVec4f quat;
+                if (rotateSampler->Sample(instanceIndices[i], &quat)) {
+                    GfMatrix4d rotateMat(1);
+                    rotateMat.SetRotate(GfRotation(GfQuaternion(
+                        quat[0], GfVec3d(quat[1], quat[2], quat[3]))));
+                    transform = rotateMat * transform;
+                }
+            }
+
+            // "scale" holds an axis-aligned scale vector for each index.
+            if (scaleSampler) {
+                GfVec3f scale;
+                if (scaleSampler->Sample(instanceIndices[i], &scale)) {
+                    GfMatrix4d scaleMat(1);
+                    scaleMat.SetScale(GfVec3d(scale));
+                    transform = scaleMat * transform;
+                }
+            }
+
+            // "instanceTransform" holds a 4x4 transform matrix for each
+            // index.
+            if (instanceTransformSampler) {
+                GfMatrix4d instanceTransform;
+                if (instanceTransformSampler->Sample(instanceIndices[i],
+                                                     &instanceTransform)) {
+                    transform = instanceTransform * transform;
+                }
+            }
+
+            transformsData[i] = transform;
         }
-    }
+    });
 
     if (GetParentId().IsEmpty()) {
         return transforms;
@@ -202,13 +231,20 @@ HdEmbreeInstancer::ComputeInstanceTransforms(SdfPath const &prototypeId)
         static_cast<HdEmbreeInstancer*>(parentInstancer)->
             ComputeInstanceTransforms(GetId());
 
+    // The flattened product can be quadratically bigger than either input,
+    // so compute it in parallel as well; each parent index writes a disjoint
+    // slice of the output.
     VtMatrix4dArray final(parentTransforms.size() * transforms.size());
-    for (size_t i = 0; i < parentTransforms.size(); ++i) {
-        for (size_t j = 0; j < transforms.size(); ++j) {
-            final[i * transforms.size() + j] = transforms[j] *
-                                               parentTransforms[i];
+    GfMatrix4d *finalData = final.data();
+    WorkParallelForN(parentTransforms.size(),
+        [&](size_t begin, size_t end) {
+        for (size_t i = begin; i < end; ++i) {
+            for (size_t j = 0; j < transforms.size(); ++j) {
+                finalData[i * transforms.size() + j] = transforms[j] *
+                                                       parentTransforms[i];
+            }
         }
-    }
+    });
     return final;
 }
 
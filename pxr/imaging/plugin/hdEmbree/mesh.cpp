@@ -32,6 +32,7 @@
 #include "pxr/imaging/pxOsd/tokens.h"
 #include "pxr/base/gf/matrix4f.h"
 #include "pxr/base/gf/matrix4d.h"
+#include "pxr/base/work/loops.h"
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -787,10 +788,21 @@ HdEmbreeMesh::_PopulateRtMesh(HdSceneDelegate* sceneDelegate,
             rtcSetUserData(scene, _rtcInstanceIds[i], ctx);
         }
 
-        // Update transforms.
+        // Combine the local transform and the instance transforms. This is
+        // pure matrix math, so stage it in parallel before the (serial)
+        // embree API calls below.
+        std::vector<GfMatrix4f> composedTransforms(transforms.size());
+        WorkParallelForN(transforms.size(),
+            [&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                composedTransforms[i] = _transform * GfMatrix4f(transforms[i]);
+            }
+        });
+
+        // Update transforms. The embree scene update functions aren't
+        // documented to be thread-safe, so this loop stays serial.
         for (size_t i = 0; i < transforms.size(); ++i) {
-            // Combine the local transform and the instance transform.
-            GfMatrix4f matf = _transform * GfMatrix4f(transforms[i]);
+            GfMatrix4f const& matf = composedTransforms[i];
             // Update the transform in the BVH.
             rtcSetTransform(scene, _rtcInstanceIds[i],
                 RTC_MATRIX_COLUMN_MAJOR_ALIGNED16, matf.GetArray());
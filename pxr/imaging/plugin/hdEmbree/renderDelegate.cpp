@@ -106,13 +106,15 @@ HdEmbreeRenderDelegate::HdEmbreeRenderDelegate()
     // Create the top-level scene.
     //
     // RTC_SCENE_DYNAMIC indicates we'll be updating the scene between draw
-    // calls. RTC_INTERSECT1 indicates we'll be casting single rays, and
+    // calls. RTC_INTERSECT1 indicates we'll be casting single rays,
+    // RTC_INTERSECT_STREAM indicates we'll also be casting ray streams
+    // (used by the render pass for per-tile packet traversal), and
     // RTC_INTERPOLATE indicates we'll be storing primvars in embree objects
     // and querying them with rtcInterpolate.
     //
     // XXX: Investigate ray packets.
     _rtcScene = rtcDeviceNewScene(_rtcDevice, RTC_SCENE_DYNAMIC,
-        RTC_INTERSECT1 | RTC_INTERPOLATE);
+        RTC_INTERSECT1 | RTC_INTERSECT_STREAM | RTC_INTERPOLATE);
 
     // Store top-level embree objects inside a render param that can be
     // passed to prims during Sync().
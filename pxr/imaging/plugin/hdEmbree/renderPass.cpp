@@ -45,6 +45,7 @@ HdEmbreeRenderPass::HdEmbreeRenderPass(HdRenderIndex *index,
                                        RTCScene scene)
     : HdRenderPass(index, collection)
     , _pendingResetImage(false)
+    , _completedSamples(0)
     , _width(0)
     , _height(0)
     , _scene(scene)
@@ -68,12 +69,12 @@ HdEmbreeRenderPass::ResetImage()
 bool
 HdEmbreeRenderPass::IsConverged() const
 {
-    // A super simple heuristic: consider ourselves converged after N
-    // samples. Since we currently uniformly sample the framebuffer, we can
-    // use the sample count from pixel(0,0).
+    // A super simple heuristic: consider ourselves converged after N full
+    // sample passes. (Individual pixels may have fewer samples if adaptive
+    // sampling retired them early.)
     unsigned int samplesToConvergence =
         HdEmbreeConfig::GetInstance().samplesToConvergence;
-    return (_sampleBuffer[3] >= samplesToConvergence);
+    return (_completedSamples >= samplesToConvergence);
 }
 
 void
@@ -90,8 +91,19 @@ HdEmbreeRenderPass::_Execute(HdRenderPassStateSharedPtr const& renderPassState,
     // XXX: Add collection and renderTags support.
     // XXX: Add clip planes support.
 
-    _inverseViewMatrix = renderPassState->GetWorldToViewMatrix().GetInverse();
-    _inverseProjMatrix = renderPassState->GetProjectionMatrix().GetInverse();
+    // If the camera has moved, the accumulated samples no longer describe
+    // the current view; restart progressive accumulation. When the camera
+    // is still, samples keep accumulating across frames.
+    GfMatrix4d inverseViewMatrix =
+        renderPassState->GetWorldToViewMatrix().GetInverse();
+    GfMatrix4d inverseProjMatrix =
+        renderPassState->GetProjectionMatrix().GetInverse();
+    if (_inverseViewMatrix != inverseViewMatrix ||
+        _inverseProjMatrix != inverseProjMatrix) {
+        _inverseViewMatrix = inverseViewMatrix;
+        _inverseProjMatrix = inverseProjMatrix;
+        _pendingResetImage = true;
+    }
 
     // If the viewport has changed, resize the sample buffer.
     GfVec4f vp = renderPassState->GetViewport();
@@ -99,6 +111,7 @@ HdEmbreeRenderPass::_Execute(HdRenderPassStateSharedPtr const& renderPassState,
         _width = vp[2];
         _height = vp[3];
         _sampleBuffer.resize(_width*_height*4);
+        _squaredLumBuffer.resize(_width*_height);
         _colorBuffer.resize(_width*_height*4);
         _pendingResetImage = true;
     }
@@ -106,6 +119,8 @@ HdEmbreeRenderPass::_Execute(HdRenderPassStateSharedPtr const& renderPassState,
     // Reset the sample buffer if it's been requested.
     if (_pendingResetImage) {
         memset(&_sampleBuffer[0], 0, _width*_height*4*sizeof(float));
+        memset(&_squaredLumBuffer[0], 0, _width*_height*sizeof(float));
+        _completedSamples = 0;
         _pendingResetImage = false;
     }
     
@@ -146,6 +161,27 @@ HdEmbreeRenderPass::_Render()
     WorkParallelForN(numTilesX*numTilesY,
         std::bind(&HdEmbreeRenderPass::_RenderTiles, this,
                   std::placeholders::_1, std::placeholders::_2));
+
+    ++_completedSamples;
+}
+
+/// Fill in an RTCRay structure from the given parameters.
+static void
+_PopulateRay(RTCRay *ray, GfVec3f const& origin,
+             GfVec3f const& dir, float nearest)
+{
+    ray->org[0] = origin[0];
+    ray->org[1] = origin[1];
+    ray->org[2] = origin[2];
+    ray->dir[0] = dir[0];
+    ray->dir[1] = dir[1];
+    ray->dir[2] = dir[2];
+    ray->tnear = nearest;
+    ray->tfar = std::numeric_limits<float>::infinity();
+    ray->geomID = RTC_INVALID_GEOMETRY_ID;
+    ray->primID = RTC_INVALID_GEOMETRY_ID;
+    ray->mask = -1;
+    ray->time = 0.0f;
 }
 
 void
@@ -169,10 +205,43 @@ HdEmbreeRenderPass::_RenderTiles(size_t tileStart, size_t tileEnd)
         const unsigned int x1 = std::min(x0+tileSize, _width);
         const unsigned int y1 = std::min(y0+tileSize, _height);
 
-        // Loop over pixels casting rays.
+        const bool adaptiveSampling =
+            HdEmbreeConfig::GetInstance().adaptiveSampling;
+        // Minimum samples before a pixel's variance estimate is trusted,
+        // and the relative variance below which a pixel stops sampling.
+        const float minAdaptiveSamples = 16.0f;
+        const float varianceThreshold = 0.0001f;
+
+        // Generate the tile's camera rays; with adaptive sampling, pixels
+        // whose estimate has converged are skipped, so keep the pixel
+        // index of each ray alongside it.
+        std::vector<RTCRay> rays;
+        std::vector<unsigned int> pixelIds;
+        rays.reserve((x1-x0) * (y1-y0));
+        pixelIds.reserve((x1-x0) * (y1-y0));
         for (unsigned int y = y0; y < y1; ++y) {
             for (unsigned int x = x0; x < x1; ++x) {
 
+                const unsigned int idx = y*_width+x;
+                const float numSamples = _sampleBuffer[idx*4+3];
+                if (adaptiveSampling && numSamples >= minAdaptiveSamples) {
+                    // Estimate the pixel's luminance variance from the
+                    // accumulated luminance (luminance is linear, so the
+                    // mean luminance is the luminance of the mean color)
+                    // and accumulated squared luminance.
+                    const float invN = 1.0f / numSamples;
+                    const float meanLum =
+                        (0.2126f * _sampleBuffer[idx*4+0] +
+                         0.7152f * _sampleBuffer[idx*4+1] +
+                         0.0722f * _sampleBuffer[idx*4+2]) * invN;
+                    const float varLum =
+                        _squaredLumBuffer[idx] * invN - meanLum * meanLum;
+                    if (varLum <= varianceThreshold *
+                                  (meanLum * meanLum + 0.01f)) {
+                        continue;
+                    }
+                }
+
                 // Initialize the RNG with a fixed seed or with entropy,
                 // depending on environment settings.
                 std::default_random_engine random(0x12345678);
@@ -211,37 +280,41 @@ HdEmbreeRenderPass::_RenderTiles(size_t tileStart, size_t tileEnd)
                 origin = _inverseViewMatrix.Transform(origin);
                 dir = _inverseViewMatrix.TransformDir(dir).GetNormalized();
 
-                // Trace the ray to get pixel color.
-                GfVec3f color = _TraceRay(origin, dir);
-
-                // Add the pixel sample to the sample buffer.
-                int idx = y*_width+x;
-                _sampleBuffer[idx*4+0] += color[0];
-                _sampleBuffer[idx*4+1] += color[1];
-                _sampleBuffer[idx*4+2] += color[2];
-                _sampleBuffer[idx*4+3] += 1.0f;
+                rays.push_back(RTCRay());
+                _PopulateRay(&rays.back(), origin, dir, 0.0f);
+                pixelIds.push_back(idx);
             }
         }
-    }
-}
 
-/// Fill in an RTCRay structure from the given parameters.
-static void
-_PopulateRay(RTCRay *ray, GfVec3f const& origin, 
-             GfVec3f const& dir, float nearest)
-{
-    ray->org[0] = origin[0];
-    ray->org[1] = origin[1];
-    ray->org[2] = origin[2];
-    ray->dir[0] = dir[0];
-    ray->dir[1] = dir[1];
-    ray->dir[2] = dir[2];
-    ray->tnear = nearest; 
-    ray->tfar = std::numeric_limits<float>::infinity();
-    ray->geomID = RTC_INVALID_GEOMETRY_ID;
-    ray->primID = RTC_INVALID_GEOMETRY_ID;
-    ray->mask = -1;
-    ray->time = 0.0f;
+        if (rays.empty()) {
+            continue;
+        }
+
+        // Intersect the tile's rays as a single coherent stream, which
+        // lets embree use packet traversal internally instead of tracing
+        // one ray at a time.
+        RTCIntersectContext context;
+        context.flags = RTC_INTERSECT_COHERENT;
+        context.userRayExt = NULL;
+        rtcIntersect1M(_scene, &context, &rays[0], rays.size(),
+                       sizeof(RTCRay));
+
+        // Shade the hits and add the pixel samples to the sample buffer.
+        for (size_t i = 0; i < rays.size(); ++i) {
+            GfVec3f color = _Shade(rays[i]);
+
+            const unsigned int idx = pixelIds[i];
+            _sampleBuffer[idx*4+0] += color[0];
+            _sampleBuffer[idx*4+1] += color[1];
+            _sampleBuffer[idx*4+2] += color[2];
+            _sampleBuffer[idx*4+3] += 1.0f;
+
+            const float lum = 0.2126f * color[0] +
+                              0.7152f * color[1] +
+                              0.0722f * color[2];
+            _squaredLumBuffer[idx] += lum * lum;
+        }
+    }
 }
 
 /// Generate a uniformly random direction ray.
@@ -262,12 +335,9 @@ _RandomDirection(T& random_engine)
 
 
 GfVec3f
-HdEmbreeRenderPass::_TraceRay(GfVec3f const &origin, GfVec3f const &dir)
+HdEmbreeRenderPass::_Shade(RTCRay const &ray)
 {
-    // Intersect the camera ray.
-    RTCRay ray;
-    _PopulateRay(&ray, origin, dir, 0.0f);
-    rtcIntersect(_scene, ray);
+    GfVec3f dir = GfVec3f(ray.dir[0], ray.dir[1], ray.dir[2]);
 
     if (ray.geomID == RTC_INVALID_GEOMETRY_ID) {
         // Ray miss gets the clear color.
@@ -355,26 +425,32 @@ HdEmbreeRenderPass::_ComputeAmbientOcclusion(GfVec3f const& position,
             time_since_epoch().count());
     }
 
-    float occlusionFactor = 0.0f;
-
-    // Trace ambient occlusion rays. The occlusion factor is the fraction of
-    // the hemisphere that's occluded when rays are traced to infinity,
-    // computed by uniform random sampling over the hemisphere.
+    // Generate ambient occlusion rays, sampled uniformly over the
+    // hemisphere centered on the face normal.
+    std::vector<RTCRay> shadows(ambientOcclusionSamples);
     for (unsigned int i = 0; i < ambientOcclusionSamples; i++)
     {
-        // We sample in the hemisphere centered on the face normal.
         GfVec3f shadowDir = _RandomDirection(random);
         if (GfDot(shadowDir, normal) < 0) shadowDir = -shadowDir;
 
-        // Trace shadow ray, using the fast interface (rtcOccluded) since
-        // we only care about intersection status, not intersection id.
-        RTCRay shadow;
-        _PopulateRay(&shadow, position, shadowDir, 0.001f);
-        rtcOccluded(_scene, shadow);
+        _PopulateRay(&shadows[i], position, shadowDir, 0.001f);
+    }
 
-        // Record this AO ray's contribution to the occlusion factor: a
-        // boolean [In shadow/Not in shadow].
-        if (shadow.geomID != RTC_INVALID_GEOMETRY_ID)
+    // Trace the shadow rays as one stream, using the fast occlusion
+    // interface since we only care about intersection status, not
+    // intersection id.
+    RTCIntersectContext context;
+    context.flags = RTC_INTERSECT_INCOHERENT;
+    context.userRayExt = NULL;
+    rtcOccluded1M(_scene, &context, &shadows[0], ambientOcclusionSamples,
+                  sizeof(RTCRay));
+
+    // The occlusion factor is the fraction of the hemisphere that's
+    // occluded when rays are traced to infinity.
+    float occlusionFactor = 0.0f;
+    for (unsigned int i = 0; i < ambientOcclusionSamples; i++)
+    {
+        if (shadows[i].geomID != RTC_INVALID_GEOMETRY_ID)
             occlusionFactor += 1.0f;
     }
     // Compute the average of the occlusion samples.
@@ -31,6 +31,7 @@
 #include "pxr/base/gf/matrix4d.h"
 
 #include <embree2/rtcore.h>
+#include <embree2/rtcore_ray.h>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -94,14 +95,14 @@ private:
     void _Render();
 
     // Render square tiles of pixels. This function is one unit of threadpool
-    // work. For each tile, iterate over pixels in the tile, generating camera
-    // rays, and following them/calculating color with _TraceRay. This function
-    // renders all tiles between tileStart and tileEnd.
+    // work. For each tile, generate the tile's camera rays, intersect them
+    // as a single coherent ray stream, and shade each hit with _Shade. This
+    // function renders all tiles between tileStart and tileEnd.
     void _RenderTiles(size_t tileStart, size_t tileEnd);
 
-    // Cast a ray into the scene and if it hits an object, return the
-    // computed color; otherwise return _clearColor.
-    GfVec3f _TraceRay(GfVec3f const& origin, GfVec3f const& dir);
+    // Compute the color for an already-intersected camera ray; a ray miss
+    // returns _clearColor.
+    GfVec3f _Shade(RTCRay const& ray);
 
     // Compute the ambient occlusion term at a given point by firing rays
     // from "position" in the hemisphere centered on "normal"; the occlusion
@@ -122,10 +123,21 @@ private:
     // color value is then pixel[0-2] / pixel[3].
     std::vector<float> _sampleBuffer;
 
+    // Per-pixel accumulated squared luminance, used together with
+    // _sampleBuffer to estimate the sample variance of a pixel for
+    // adaptive sampling.
+    std::vector<float> _squaredLumBuffer;
+
     // The resolved output buffer, in GL_RGBA. This is an intermediate between
     // _sampleBuffer and the GL framebuffer.
     std::vector<uint8_t> _colorBuffer;
 
+    // The number of full sample passes accumulated into the sample buffer
+    // since the last reset. With adaptive sampling individual pixels may
+    // stop receiving samples early, so this, not a pixel's sample count,
+    // drives IsConverged().
+    unsigned int _completedSamples;
+
     // The width of the viewport we're rendering into.
     unsigned int _width;
     // The height of the viewport we're rendering into.
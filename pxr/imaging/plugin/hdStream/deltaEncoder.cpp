@@ -0,0 +1,343 @@
+//
+// Copyright 2017 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#include "pxr/pxr.h"
+#include "pxr/imaging/hdStream/deltaEncoder.h"
+
+#include "pxr/imaging/hd/meshTopology.h"
+#include "pxr/imaging/hd/renderIndex.h"
+#include "pxr/imaging/hd/sceneDelegate.h"
+#include "pxr/imaging/hd/tokens.h"
+
+#include "pxr/base/tf/fastCompression.h"
+#include "pxr/base/vt/value.h"
+
+#include <cstring>
+#include <istream>
+#include <memory>
+#include <ostream>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+
+namespace {
+
+// Frame header: magic, format version, payload sizes. The payload that
+// follows is an LZ4 blob holding a uint32 prim count and that many prim
+// records.
+const uint32_t _frameMagic   = 0x48445344; // 'HDSD'
+const uint32_t _frameVersion = 1;
+
+template <typename T>
+void
+_Append(std::vector<char> *buf, T const &value)
+{
+    const char *p = reinterpret_cast<const char *>(&value);
+    buf->insert(buf->end(), p, p + sizeof(T));
+}
+
+void
+_AppendBytes(std::vector<char> *buf, void const *data, size_t size)
+{
+    const char *p = static_cast<const char *>(data);
+    buf->insert(buf->end(), p, p + size);
+}
+
+void
+_AppendString(std::vector<char> *buf, std::string const &str)
+{
+    _Append<uint32_t>(buf, (uint32_t)str.size());
+    _AppendBytes(buf, str.data(), str.size());
+}
+
+// Cursor over a decoded payload; every read is bounds-checked so a
+// truncated or corrupt frame fails rather than reading past the end.
+struct _Cursor
+{
+    _Cursor(std::vector<char> const &buf) : data(buf.data()),
+                                            size(buf.size()),
+                                            pos(0) {}
+
+    template <typename T>
+    bool Read(T *value)
+    {
+        if (pos + sizeof(T) > size) {
+            return false;
+        }
+        memcpy(value, data + pos, sizeof(T));
+        pos += sizeof(T);
+        return true;
+    }
+
+    bool ReadBytes(void *dst, size_t numBytes)
+    {
+        if (pos + numBytes > size) {
+            return false;
+        }
+        memcpy(dst, data + pos, numBytes);
+        pos += numBytes;
+        return true;
+    }
+
+    bool ReadString(std::string *str)
+    {
+        uint32_t len = 0;
+        if (!Read(&len) || pos + len > size) {
+            return false;
+        }
+        str->assign(data + pos, len);
+        pos += len;
+        return true;
+    }
+
+    const char *data;
+    size_t size;
+    size_t pos;
+};
+
+template <typename ElementType, typename ArrayType>
+bool
+_ReadArray(_Cursor *cursor, ArrayType *array)
+{
+    uint64_t count = 0;
+    if (!cursor->Read(&count)) {
+        return false;
+    }
+    array->resize(count);
+    return count == 0 ||
+           cursor->ReadBytes(array->data(), count * sizeof(ElementType));
+}
+
+} // anonymous namespace
+
+
+HdStreamDeltaEncoder::HdStreamDeltaEncoder(HdRenderIndex *renderIndex)
+    : _renderIndex(renderIndex)
+    , _lastChangeCount(0)
+{
+}
+
+size_t
+HdStreamDeltaEncoder::EncodeFrame(std::ostream &out)
+{
+    HdChangeTracker &tracker = _renderIndex->GetChangeTracker();
+    if (tracker.GetChangeCount() == _lastChangeCount) {
+        return 0;
+    }
+    _lastChangeCount = tracker.GetChangeCount();
+
+    std::vector<char> records;
+    uint32_t numPrims = 0;
+
+    SdfPathVector const &ids = _renderIndex->GetRprimIds();
+    TF_FOR_ALL(idIt, ids) {
+        HdDirtyBits bits = tracker.GetRprimDirtyBits(*idIt);
+        if (bits == HdChangeTracker::Clean) {
+            continue;
+        }
+        _EncodePrim(*idIt, bits, &records);
+        ++numPrims;
+    }
+
+    if (numPrims == 0) {
+        return 0;
+    }
+
+    std::vector<char> payload;
+    payload.reserve(sizeof(uint32_t) + records.size());
+    _Append<uint32_t>(&payload, numPrims);
+    _AppendBytes(&payload, records.data(), records.size());
+
+    const size_t maxCompressedSize =
+        TfFastCompression::GetCompressedBufferSize(payload.size());
+    std::unique_ptr<char[]> compressed(new char[maxCompressedSize]);
+    const size_t compressedSize = TfFastCompression::CompressToBuffer(
+        payload.data(), compressed.get(), payload.size());
+    if (compressedSize == size_t(~0)) {
+        return 0;
+    }
+
+    out.write(reinterpret_cast<const char *>(&_frameMagic),
+              sizeof(_frameMagic));
+    out.write(reinterpret_cast<const char *>(&_frameVersion),
+              sizeof(_frameVersion));
+    const uint64_t uncompressedSize = payload.size();
+    const uint64_t frameCompressedSize = compressedSize;
+    out.write(reinterpret_cast<const char *>(&uncompressedSize),
+              sizeof(uncompressedSize));
+    out.write(reinterpret_cast<const char *>(&frameCompressedSize),
+              sizeof(frameCompressedSize));
+    out.write(compressed.get(), compressedSize);
+    out.flush();
+
+    return numPrims;
+}
+
+void
+HdStreamDeltaEncoder::_EncodePrim(SdfPath const &id, HdDirtyBits bits,
+                                  std::vector<char> *buf)
+{
+    HdSceneDelegate *delegate = _renderIndex->GetSceneDelegateForRprim(id);
+    if (!delegate) {
+        return;
+    }
+
+    _AppendString(buf, id.GetString());
+    _Append<uint64_t>(buf, bits);
+
+    if (bits & HdChangeTracker::DirtyTransform) {
+        GfMatrix4d transform = delegate->GetTransform(id);
+        _AppendBytes(buf, transform.GetArray(), 16 * sizeof(double));
+    }
+
+    if (bits & HdChangeTracker::DirtyVisibility) {
+        _Append<uint8_t>(buf, delegate->GetVisible(id) ? 1 : 0);
+    }
+
+    if (bits & HdChangeTracker::DirtyExtent) {
+        GfRange3d extent = delegate->GetExtent(id);
+        _AppendBytes(buf, extent.GetMin().data(), 3 * sizeof(double));
+        _AppendBytes(buf, extent.GetMax().data(), 3 * sizeof(double));
+    }
+
+    if (bits & HdChangeTracker::DirtyTopology) {
+        // Non-mesh rprims report empty topology here; the arrays are
+        // written (possibly empty) whenever the bit is set so that the
+        // decoder can rely on the dirty bits alone for framing.
+        HdMeshTopology topology = delegate->GetMeshTopology(id);
+        VtIntArray const &counts = topology.GetFaceVertexCounts();
+        VtIntArray const &indices = topology.GetFaceVertexIndices();
+        _Append<uint64_t>(buf, counts.size());
+        _AppendBytes(buf, counts.cdata(), counts.size() * sizeof(int));
+        _Append<uint64_t>(buf, indices.size());
+        _AppendBytes(buf, indices.cdata(), indices.size() * sizeof(int));
+    }
+
+    if (bits & HdChangeTracker::DirtyPoints) {
+        VtValue pointsValue = delegate->Get(id, HdTokens->points);
+        VtVec3fArray points;
+        if (pointsValue.IsHolding<VtVec3fArray>()) {
+            points = pointsValue.UncheckedGet<VtVec3fArray>();
+        }
+        _Append<uint64_t>(buf, points.size());
+        _AppendBytes(buf, points.cdata(), points.size() * sizeof(GfVec3f));
+    }
+}
+
+/* static */
+bool
+HdStreamDeltaEncoder::DecodeFrame(std::istream &in,
+                                  std::vector<HdStreamPrimDelta> *deltas)
+{
+    uint32_t magic = 0, version = 0;
+    uint64_t uncompressedSize = 0, compressedSize = 0;
+    in.read(reinterpret_cast<char *>(&magic), sizeof(magic));
+    in.read(reinterpret_cast<char *>(&version), sizeof(version));
+    in.read(reinterpret_cast<char *>(&uncompressedSize),
+            sizeof(uncompressedSize));
+    in.read(reinterpret_cast<char *>(&compressedSize),
+            sizeof(compressedSize));
+    if (!in || magic != _frameMagic || version != _frameVersion) {
+        return false;
+    }
+
+    std::vector<char> compressed(compressedSize);
+    in.read(compressed.data(), compressedSize);
+    if (!in) {
+        return false;
+    }
+
+    std::vector<char> payload(uncompressedSize);
+    const size_t decompressedSize = TfFastCompression::DecompressFromBuffer(
+        compressed.data(), payload.data(), compressedSize, uncompressedSize);
+    if (decompressedSize != uncompressedSize) {
+        return false;
+    }
+
+    _Cursor cursor(payload);
+    uint32_t numPrims = 0;
+    if (!cursor.Read(&numPrims)) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < numPrims; ++i) {
+        HdStreamPrimDelta delta;
+
+        std::string pathString;
+        uint64_t bits = 0;
+        if (!cursor.ReadString(&pathString) || !cursor.Read(&bits)) {
+            return false;
+        }
+        delta.path = SdfPath(pathString);
+        delta.dirtyBits = (HdDirtyBits)bits;
+
+        if (bits & HdChangeTracker::DirtyTransform) {
+            double m[16];
+            if (!cursor.ReadBytes(m, sizeof(m))) {
+                return false;
+            }
+            delta.transform = GfMatrix4d(
+                m[ 0], m[ 1], m[ 2], m[ 3],
+                m[ 4], m[ 5], m[ 6], m[ 7],
+                m[ 8], m[ 9], m[10], m[11],
+                m[12], m[13], m[14], m[15]);
+        }
+
+        if (bits & HdChangeTracker::DirtyVisibility) {
+            uint8_t visible = 1;
+            if (!cursor.Read(&visible)) {
+                return false;
+            }
+            delta.visible = (visible != 0);
+        }
+
+        if (bits & HdChangeTracker::DirtyExtent) {
+            double minMax[6];
+            if (!cursor.ReadBytes(minMax, sizeof(minMax))) {
+                return false;
+            }
+            delta.extent = GfRange3d(
+                GfVec3d(minMax[0], minMax[1], minMax[2]),
+                GfVec3d(minMax[3], minMax[4], minMax[5]));
+        }
+
+        if (bits & HdChangeTracker::DirtyTopology) {
+            if (!_ReadArray<int>(&cursor, &delta.faceVertexCounts) ||
+                !_ReadArray<int>(&cursor, &delta.faceVertexIndices)) {
+                return false;
+            }
+        }
+
+        if (bits & HdChangeTracker::DirtyPoints) {
+            if (!_ReadArray<GfVec3f>(&cursor, &delta.points)) {
+                return false;
+            }
+        }
+
+        deltas->push_back(delta);
+    }
+
+    return true;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,109 @@
+//
+// Copyright 2017 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef HDSTREAM_DELTA_ENCODER_H
+#define HDSTREAM_DELTA_ENCODER_H
+
+#include "pxr/pxr.h"
+#include "pxr/imaging/hd/changeTracker.h"
+
+#include "pxr/base/gf/matrix4d.h"
+#include "pxr/base/gf/range3d.h"
+#include "pxr/base/vt/types.h"
+#include "pxr/usd/sdf/path.h"
+
+#include <iosfwd>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+class HdRenderIndex;
+
+/// \class HdStreamPrimDelta
+///
+/// Decoded per-prim state from a delta frame. Only the members whose
+/// corresponding bits are set in \c dirtyBits carry meaningful values.
+struct HdStreamPrimDelta
+{
+    HdStreamPrimDelta()
+        : dirtyBits(HdChangeTracker::Clean)
+        , transform(1.0)
+        , visible(true)
+    {
+    }
+
+    SdfPath path;
+    HdDirtyBits dirtyBits;
+    GfMatrix4d transform;
+    bool visible;
+    GfRange3d extent;
+    VtIntArray faceVertexCounts;
+    VtIntArray faceVertexIndices;
+    VtVec3fArray points;
+};
+
+/// \class HdStreamDeltaEncoder
+///
+/// Serializes render index changes into compact, self-delimiting frames
+/// for remote inspection of live renders. Each call to EncodeFrame walks
+/// the rprims whose change-tracker bits are dirty and writes only their
+/// changed state (transform, visibility, extent, topology, points),
+/// LZ4-compressed via TfFastCompression, to the given stream. Bandwidth
+/// is therefore proportional to what changed, not to scene size; the
+/// first frame after the index is populated carries the full scene since
+/// every prim starts fully dirty.
+///
+/// The transport is left to the host: frames are length-prefixed, so the
+/// stream can be a file, a pipe or a socket streambuf. A viewer process
+/// reconstructs prim state on its end with DecodeFrame.
+class HdStreamDeltaEncoder
+{
+public:
+    HdStreamDeltaEncoder(HdRenderIndex *renderIndex);
+
+    /// Encode one delta frame onto \p out, covering every rprim with
+    /// dirty change-tracker bits. Returns the number of prims encoded;
+    /// if nothing changed since the last call, writes nothing and
+    /// returns 0. Call this before the render pass syncs the index,
+    /// since syncing cleans the dirty bits this relies on.
+    size_t EncodeFrame(std::ostream &out);
+
+    /// Read one frame from \p in and append the decoded prim deltas to
+    /// \p deltas. Returns false on a malformed or truncated frame.
+    static bool DecodeFrame(std::istream &in,
+                            std::vector<HdStreamPrimDelta> *deltas);
+
+private:
+    void _EncodePrim(SdfPath const &id, HdDirtyBits bits,
+                     std::vector<char> *buf);
+
+    HdRenderIndex *_renderIndex;
+
+    // Change count observed at the last encoded frame, used to skip
+    // frames when the scene is static.
+    unsigned _lastChangeCount;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // HDSTREAM_DELTA_ENCODER_H
@@ -49,6 +49,23 @@ def GetFlattenedLayerStack(filePath):
     stage = Usd.Stage.Open(filePath, Usd.Stage.LoadNone)
     return UsdUtils.FlattenLayerStack(stage)
 
+def WriteToStdout(usdData):
+    '''Writes usdData to stdout as text in bounded chunks.
+
+    ExportToString() would materialize the entire text representation
+    as a single in-memory string first, which for multi-gigabyte
+    layers roughly doubles the tool's peak memory.  Instead, export to
+    a temporary file -- the text writer emits it incrementally -- and
+    stream that to stdout.'''
+    import shutil
+    from pxr import Tf
+    chunkSize = 16 * 1024 * 1024
+    with Tf.NamedTemporaryFile(suffix='.usda') as tmp:
+        if not usdData.Export(tmp.name):
+            raise Exception("failed to write temporary file '%s'" % tmp.name)
+        with open(tmp.name, 'r') as f:
+            shutil.copyfileobj(f, sys.stdout, chunkSize)
+
 def main():
     parser = argparse.ArgumentParser(
         description='Write usd file(s) either as text to stdout or to a '
@@ -185,11 +202,15 @@ def main():
                 exitCode = 1
         else:
             try:
-                sys.stdout.write(usdData.ExportToString())
+                WriteToStdout(usdData)
             except Exception as e:
                 _Err("Error writing '%s' to stdout; %s" % (inputFile, e))
                 exitCode = 1
 
+        # Release the input data before moving to the next file so peak
+        # memory covers one input at a time.
+        del usdData
+
     return exitCode
 
 if __name__ == "__main__":
@@ -32,24 +32,46 @@ if __name__ == '__main__':
         help='One or more files to check')
     parser.add_argument('--quiet', '-q', action='store_true',
         help='Suppress OK/ERR output')
+    parser.add_argument('--validate', action='store_true',
+        help='Open each file as a stage and run the UsdUtils validation '
+             'rules over it, in parallel across prims and across files')
+    parser.add_argument('--stats', action='store_true',
+        help='With --validate, print per-rule error counts and timing')
     opts = parser.parse_args()
 
     def status(ok, path):
         if not opts.quiet:
             print '{:3} {}'.format('OK' if ok else 'ERR', path)
 
-    from pxr import Sdf, Tf
-
     exitCode = 0
-    for p in opts.filePaths:
-        try:
-            Sdf.Layer.FindOrOpen(p)
-            status(True, p)
-        except Exception as e:
-            status(False, p)
-            if not opts.quiet:
-                print e
-            exitCode = 2
+    if opts.validate:
+        from pxr import UsdUtils
+        engine = UsdUtils.ValidationEngine()
+        for path, errors in zip(opts.filePaths,
+                                engine.Validate(opts.filePaths)):
+            status(not errors, path)
+            if errors:
+                exitCode = 1
+                if not opts.quiet:
+                    for e in errors:
+                        print '    [{}] {}: {}'.format(
+                            e.rule, e.path, e.message)
+        if opts.stats and not opts.quiet:
+            for s in engine.GetLastRuleStats():
+                print '{:32} {:8d} errors {:10.3f}s'.format(
+                    s.rule, s.numErrors, s.timeSeconds)
+    else:
+        from pxr import Sdf, Tf
+
+        for p in opts.filePaths:
+            try:
+                Sdf.Layer.FindOrOpen(p)
+                status(True, p)
+            except Exception as e:
+                status(False, p)
+                if not opts.quiet:
+                    print e
+                exitCode = 2
 
     import sys
     sys.exit(exitCode)
@@ -130,6 +130,42 @@ def _tryEdit(fileName, tempFileName, usdcatCmd, fileType, flattened):
     
     return _convertTo(tempFileName, fileName, usdcatCmd, flatten=None, fmt=fileType)
 
+def _runBriefDiff(baseline, comparison, flatten):
+    '''Compares the two files natively, spec by spec, without writing
+    either out as text.  Only reports whether they differ, so this is
+    much faster and leaner than a text diff on large binary files.'''
+    from pxr import Sdf, Usd, UsdUtils
+
+    def _openLayer(path):
+        # An empty file isn't valid usd but is also not a difference
+        # if both files are empty.
+        if os.stat(path).st_size == 0:
+            return None
+        if flatten:
+            stage = Usd.Stage.Open(path)
+            if not stage:
+                _exit('Error: failed to open %s.' % path, ERROR_EXIT_CODE)
+            return UsdUtils.FlattenLayerStack(stage)
+        layer = Sdf.Layer.FindOrOpen(path)
+        if not layer:
+            _exit('Error: failed to open %s.' % path, ERROR_EXIT_CODE)
+        return layer
+
+    baselineLayer = _openLayer(baseline)
+    comparisonLayer = _openLayer(comparison)
+
+    if (baselineLayer is None) != (comparisonLayer is None):
+        differ = True
+    elif baselineLayer is None:
+        differ = False
+    else:
+        differ = UsdUtils.LayersDiffer(baselineLayer, comparisonLayer)
+
+    if differ:
+        print 'Files %s and %s differ' % (baseline, comparison)
+        return DIFF_FOUND_EXIT_CODE
+    return NO_DIFF_FOUND_EXIT_CODE
+
 def _runDiff(baseline, comparison, flatten, noeffect):
     from pxr import Tf
 
@@ -292,16 +328,25 @@ def main():
     parser.add_argument('-f', '--flatten', action='store_true',
                         help='Fully compose both layers as Usd Stages and '
                              'flatten into single layers.')
+    parser.add_argument('-q', '--brief', action='store_true',
+                        help='Do not show the differences; only report '
+                             'whether the files differ. This compares the '
+                             'files natively, spec by spec, instead of '
+                             'text-diffing them, so it is much faster on '
+                             'large binary files.')
 
     results = parser.parse_args()
-    diffResult = NO_DIFF_FOUND_EXIT_CODE 
+    diffResult = NO_DIFF_FOUND_EXIT_CODE
 
     try:
         baselineOnly, common, comparisonOnly = _findFiles(results.files)
 
         for (baseline, comparison) in common:
-            if _runDiff(baseline, comparison, 
-                        results.flatten, results.noeffect):
+            if results.brief:
+                if _runBriefDiff(baseline, comparison, results.flatten):
+                    diffResult = DIFF_FOUND_EXIT_CODE
+            elif _runDiff(baseline, comparison,
+                          results.flatten, results.noeffect):
                 diffResult = DIFF_FOUND_EXIT_CODE
 
         mismatchMsg = 'No corresponding file found for %s, skipping.'
@@ -44,29 +44,85 @@ def PrintReport(fname, info, summaryOnly):
             sec.name, sec.size, sec.start)
     print ''
 
+def PrintLayout(fname):
+    # Do a representative stage open; the crate reader records which pages
+    # each read touches and in what order, and reports them when the file
+    # is closed.  Flush first since that report goes directly to stdout.
+    print '@%s@ page access order for a representative stage open:' % fname
+    sys.stdout.flush()
+    try:
+        stage = Usd.Stage.Open(fname)
+    except Exception as e:
+        Err('Failed to open %s\n %s' % (fname, e))
+        return
+    if not stage:
+        Err('Failed to open %s' % fname)
+        return
+    del stage
+    sys.stdout.flush()
+
+def OptimizeLayout(fname):
+    # A fresh pack writes the file sequentially: structural sections are
+    # laid out back to back in the order the reader consumes them, values
+    # are deduplicated, time samples are collocated by time, and dead space
+    # left by incremental saves is dropped.  That front-loads the data a
+    # cold open needs, so reads stream instead of seeking.
+    root, ext = os.path.splitext(fname)
+    outName = root + '.packed' + (ext or '.usdc')
+    try:
+        layer = Sdf.Layer.FindOrOpen(fname)
+    except Exception as e:
+        Err('Failed to open %s\n %s' % (fname, e))
+        return
+    if not layer:
+        Err('Failed to open %s' % fname)
+        return
+    if not layer.Export(outName):
+        Err('Failed to write %s' % outName)
+        return
+    print '@%s@ repacked to @%s@ (%d -> %d bytes)' % (
+        fname, outName, os.path.getsize(fname), os.path.getsize(outName))
+
 def main():
     parser = argparse.ArgumentParser(
         prog=os.path.basename(sys.argv[0]), 
         description='Write information about a usd crate (usdc) file to stdout')
 
     parser.add_argument('inputFiles', nargs='+')
-    parser.add_argument('-s', '--summary', action='store_true', 
+    parser.add_argument('-s', '--summary', action='store_true',
                         help='report only a short summary')
+    parser.add_argument('-l', '--layout', action='store_true',
+                        help='instead of the structural report, open each '
+                        'file as a stage and report the page access order '
+                        'the crate reader recorded, for layout analysis')
+    parser.add_argument('-o', '--optimize', action='store_true',
+                        help='rewrite each file freshly packed (compacted '
+                        'and laid out sequentially) as <file>.packed.usdc')
 
     args = parser.parse_args()
 
+    if args.layout:
+        # The crate reader consults this once, at the first crate file open
+        # in the process, so it must be set before we touch any input file.
+        os.environ['USDC_DUMP_PAGE_MAPS'] = '*'
+
     print 'Usd crate software version', Usd.CrateInfo().GetSoftwareVersion()
 
     for fname in args.inputFiles:
-        try:
-            info = Usd.CrateInfo.Open(fname)
-            if not info:
-                Err('Failed to read %s' % fname)
+        if args.layout:
+            PrintLayout(fname)
+        else:
+            try:
+                info = Usd.CrateInfo.Open(fname)
+                if not info:
+                    Err('Failed to read %s' % fname)
+                    continue
+            except Exception as e:
+                Err('Failed to read %s\n %s' % (fname,e))
                 continue
-        except Exception as e:
-            Err('Failed to read %s\n %s' % (fname,e))
-            continue
-        PrintReport(fname, info, args.summary)
+            PrintReport(fname, info, args.summary)
+        if args.optimize:
+            OptimizeLayout(fname)
             
 if __name__ == "__main__":
     # Restore signal handling defaults to allow output redirection and the like.
@@ -40,6 +40,11 @@ parser = argparse.ArgumentParser( \
 parser.add_argument('usdFiles', nargs='+')
 parser.add_argument('-o', '--out', action='store',
                     help='specify a file to write out to')
+parser.add_argument('--parallel', action='store_true',
+                    help='merge the input files with a parallel tree '
+                         'reduction instead of sequentially; the result '
+                         'is identical but large jobs complete much '
+                         'faster')
 results = parser.parse_args()
 assert results.out != None, "must specify output file"
 
@@ -63,9 +68,13 @@ assert len(unopened) == 0, 'unable to open file(s) %s' %erroredFiles
     
 # the extra computation and fail more gracefully
 try:
-    for usdFile in openedFiles:
-        UsdUtils.StitchLayers(outLayer, usdFile)
+    if results.parallel:
+        UsdUtils.StitchLayers(outLayer, openedFiles)
         outLayer.Save()
+    else:
+        for usdFile in openedFiles:
+            UsdUtils.StitchLayers(outLayer, usdFile)
+            outLayer.Save()
 # if something in the authoring fails, remove the output file
 except Exception as e:
     print 'Failed to complete stitching, removing output file %s' % results.out
@@ -30,6 +30,7 @@
 
 #include "pxr/base/arch/fileSystem.h"
 #include "pxr/base/arch/systemInfo.h"
+#include "pxr/base/arch/timing.h"
 #include "pxr/base/tf/getenv.h"
 #include "pxr/base/tf/fileUtils.h"
 #include "pxr/base/tf/pathUtils.h"
@@ -58,7 +59,18 @@ struct ArDefaultResolver::_Cache
 };
 
 ArDefaultResolver::ArDefaultResolver()
+    : _negativeCacheTtlNs(0)
+    , _useSearchPathSnapshots(false)
 {
+    const int negativeCacheTtl = TfGetenvInt(
+        "PXR_AR_DEFAULT_SEARCH_PATH_NEGATIVE_CACHE_TTL", 0);
+    if (negativeCacheTtl > 0) {
+        _negativeCacheTtlNs = uint64_t(negativeCacheTtl) * 1000000000;
+    }
+
+    _useSearchPathSnapshots = TfGetenvBool(
+        "PXR_AR_DEFAULT_SEARCH_PATH_SNAPSHOT", false);
+
     std::vector<std::string> searchPath = *_SearchPath;
 
     const std::string envPath = TfGetenv("PXR_AR_DEFAULT_SEARCH_PATH");
@@ -183,6 +195,33 @@ _Resolve(
     return TfPathExists(resolvedPath) ? resolvedPath : std::string();
 }
 
+std::string
+ArDefaultResolver::_ResolveFromSnapshot(
+    const std::string& searchPath,
+    const std::string& path)
+{
+    const std::string candidate =
+        TfNormPath(TfStringCatPaths(searchPath, path));
+    const std::string dirPath = TfGetPathName(candidate);
+
+    _DirSnapshotMap::accessor accessor;
+    if (_dirSnapshots.insert(accessor, dirPath)) {
+        // First thread to consult this directory takes the snapshot;
+        // other threads block on the accessor until it's ready.
+        std::set<std::string>* entries = new std::set<std::string>;
+        for (std::string entry : TfListDir(dirPath)) {
+            if (!entry.empty() && entry.back() == '/') {
+                entry.erase(entry.size() - 1);
+            }
+            entries->insert(TfGetBaseName(entry));
+        }
+        accessor->second.reset(entries);
+    }
+
+    return accessor->second->count(TfGetBaseName(candidate)) ?
+        candidate : std::string();
+}
+
 std::string
 ArDefaultResolver::_ResolveNoCache(const std::string& path)
 {
@@ -191,6 +230,19 @@ ArDefaultResolver::_ResolveNoCache(const std::string& path)
     }
 
     if (IsRelativePath(path)) {
+        const bool isSearchPath = IsSearchPath(path);
+
+        // Serve repeated failing search-path lookups from the negative
+        // cache while their entries are still within the TTL.
+        if (isSearchPath && _negativeCacheTtlNs > 0) {
+            _NegativeCacheMap::const_accessor accessor;
+            if (_negativeCache.find(accessor, path) &&
+                ArchTicksToNanoseconds(ArchGetTickTime()) <
+                    accessor->second) {
+                return std::string();
+            }
+        }
+
         // First try to resolve relative paths against the current
         // working directory.
         std::string resolvedPath = _Resolve(ArchGetCwd(), path);
@@ -200,13 +252,23 @@ ArDefaultResolver::_ResolveNoCache(const std::string& path)
 
         // If that fails and the path is a search path, try to resolve
         // against each directory in the specified search paths.
-        if (IsSearchPath(path)) {
+        if (isSearchPath) {
             for (const auto& searchPath : _searchPath) {
-                resolvedPath = _Resolve(searchPath, path);
+                resolvedPath = _useSearchPathSnapshots ?
+                    _ResolveFromSnapshot(searchPath, path) :
+                    _Resolve(searchPath, path);
                 if (!resolvedPath.empty()) {
                     return resolvedPath;
                 }
             }
+
+            if (_negativeCacheTtlNs > 0) {
+                _NegativeCacheMap::accessor accessor;
+                _negativeCache.insert(accessor, path);
+                accessor->second =
+                    ArchTicksToNanoseconds(ArchGetTickTime()) +
+                    _negativeCacheTtlNs;
+            }
         }
 
         return std::string();
@@ -325,9 +387,13 @@ ArDefaultResolver::CreateDefaultContextForDirectory(
     return ArResolverContext();
 }
 
-void 
+void
 ArDefaultResolver::RefreshContext(const ArResolverContext& context)
 {
+    // Drop the negative cache and directory snapshots so subsequent
+    // resolves see the current state of the filesystem.
+    _negativeCache.clear();
+    _dirSnapshots.clear();
 }
 
 ArResolverContext
@@ -30,9 +30,12 @@
 #include "pxr/usd/ar/api.h"
 #include "pxr/usd/ar/resolver.h"
 
+#include <tbb/concurrent_hash_map.h>
 #include <tbb/enumerable_thread_specific.h>
 
+#include <cstdint>
 #include <memory>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -54,9 +57,25 @@ PXR_NAMESPACE_OPEN_SCOPE
 ///
 ///    - ArDefaultResolver::SetDefaultSearchPath
 ///    - The environment variable PXR_AR_DEFAULT_SEARCH_PATH. This is
-///      expected to be a list of directories delimited by the platform's 
+///      expected to be a list of directories delimited by the platform's
 ///      standard path separator.
 ///
+/// Two optional caches can be enabled to reduce filesystem traffic when
+/// the search path directories live on slow storage (e.g. NFS):
+///
+///    - Setting PXR_AR_DEFAULT_SEARCH_PATH_NEGATIVE_CACHE_TTL to a
+///      number of seconds caches failed search-path resolutions for
+///      that long, so repeated probes for a missing asset do not re-stat
+///      every search path entry. An asset created during the TTL window
+///      will not be found until the window expires.
+///    - Setting PXR_AR_DEFAULT_SEARCH_PATH_SNAPSHOT to 1 serves
+///      existence checks under the search path entries from cached
+///      directory listings instead of per-file stats, one listing per
+///      directory consulted. Filesystem changes after a directory has
+///      been snapshotted are not seen until the caches are refreshed.
+///
+/// Both caches are dropped by RefreshContext().
+///
 class ArDefaultResolver
     : public ArResolver
 {
@@ -152,9 +171,26 @@ private:
 
     std::string _ResolveNoCache(const std::string& path);
 
+    std::string _ResolveFromSnapshot(
+        const std::string& searchPath, const std::string& path);
+
 private:
     std::vector<std::string> _searchPath;
 
+    // Cache of failed search-path resolutions, mapping asset path to the
+    // tick count (in nanoseconds) at which the entry expires. Only
+    // consulted when a TTL has been configured.
+    using _NegativeCacheMap = tbb::concurrent_hash_map<std::string, uint64_t>;
+    _NegativeCacheMap _negativeCache;
+    uint64_t _negativeCacheTtlNs;
+
+    // Lazily-populated snapshots of the contents of directories consulted
+    // during search-path resolution, keyed by directory path.
+    using _DirSnapshot = std::shared_ptr<const std::set<std::string>>;
+    using _DirSnapshotMap = tbb::concurrent_hash_map<std::string, _DirSnapshot>;
+    _DirSnapshotMap _dirSnapshots;
+    bool _useSearchPathSnapshots;
+
     using _CachePtrStack = std::vector<_CachePtr>;
     using _PerThreadCachePtrStack = 
         tbb::enumerable_thread_specific<_CachePtrStack>;
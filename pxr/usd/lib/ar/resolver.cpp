@@ -70,6 +70,24 @@ ArResolver::~ArResolver()
 {
 }
 
+std::vector<std::string>
+ArResolver::ResolveBatch(const std::vector<std::string>& paths)
+{
+    std::vector<std::string> resolvedPaths;
+    resolvedPaths.reserve(paths.size());
+    for (const std::string& path : paths) {
+        resolvedPaths.push_back(Resolve(path));
+    }
+    return resolvedPaths;
+}
+
+WorkFuture<std::string>
+ArResolver::ResolveAsync(const std::string& path)
+{
+    ArResolver* resolver = this;
+    return WorkAsync([resolver, path]() { return resolver->Resolve(path); });
+}
+
 // ------------------------------------------------------------
 
 static std::string 
@@ -28,8 +28,10 @@
 
 #include "pxr/pxr.h"
 #include "pxr/usd/ar/api.h"
+#include "pxr/base/work/future.h"
 #include <boost/noncopyable.hpp>
 #include <string>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -115,6 +117,32 @@ public:
     AR_API
     virtual std::string Resolve(const std::string& path) = 0;
 
+    /// Resolves every element of \p paths as if by Resolve(), returning
+    /// the resolved paths in corresponding order.
+    ///
+    /// The default implementation simply loops over \p paths calling
+    /// Resolve() on each. Resolver implementations that are backed by a
+    /// database or other remote service should override this to service
+    /// the entire batch with a single bulk query; clients that have many
+    /// paths in hand (e.g., prim composition) will funnel them through
+    /// this entry point.
+    AR_API
+    virtual std::vector<std::string> ResolveBatch(
+        const std::vector<std::string>& paths);
+
+    /// Begins resolving \p path as if by Resolve() without waiting for
+    /// the result, returning a future that will contain the resolved
+    /// path once it is available.
+    ///
+    /// The default implementation runs Resolve() on a worker thread via
+    /// WorkAsync. Note that scoped resolution caches apply only to the
+    /// thread that created them, so a resolve issued through this entry
+    /// point may not see a cache established on the calling thread;
+    /// implementations with their own asynchronous machinery should
+    /// override this to queue the request directly.
+    AR_API
+    virtual WorkFuture<std::string> ResolveAsync(const std::string& path);
+
     /// @}
 
     // --------------------------------------------------------------------- //
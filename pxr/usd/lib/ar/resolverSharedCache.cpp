@@ -0,0 +1,146 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/usd/ar/resolverSharedCache.h"
+#include "pxr/usd/ar/resolver.h"
+#include "pxr/usd/ar/resolverContext.h"
+
+#include <boost/functional/hash.hpp>
+
+#include <tbb/concurrent_hash_map.h>
+
+#include <atomic>
+#include <utility>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+// Cache key: hash of the resolver context that was bound when the path
+// was resolved, plus the asset path itself.
+typedef std::pair<size_t, std::string> _Key;
+
+struct _KeyHashCompare {
+    static size_t hash(const _Key& key) {
+        size_t seed = key.first;
+        boost::hash_combine(seed, key.second);
+        return seed;
+    }
+    static bool equal(const _Key& x, const _Key& y) {
+        return x == y;
+    }
+};
+
+typedef tbb::concurrent_hash_map<_Key, std::string, _KeyHashCompare>
+    _PathToResolvedPathMap;
+
+} // end anonymous namespace
+
+static std::atomic<int> _numActiveScopes(0);
+
+static _PathToResolvedPathMap&
+_GetMap()
+{
+    // Never destroyed, so entries remain valid during static teardown.
+    static _PathToResolvedPathMap* map = new _PathToResolvedPathMap;
+    return *map;
+}
+
+static size_t
+_GetCurrentContextHash()
+{
+    return hash_value(ArGetResolver().GetCurrentContext());
+}
+
+bool
+ArResolverSharedCache::IsActive()
+{
+    return _numActiveScopes.load(std::memory_order_acquire) > 0;
+}
+
+bool
+ArResolverSharedCache::Lookup(
+    const std::string& path, std::string* resolvedPath)
+{
+    if (!IsActive()) {
+        return false;
+    }
+
+    _PathToResolvedPathMap::const_accessor accessor;
+    if (_GetMap().find(accessor, _Key(_GetCurrentContextHash(), path))) {
+        *resolvedPath = accessor->second;
+        return true;
+    }
+    return false;
+}
+
+void
+ArResolverSharedCache::Store(
+    const std::string& path, const std::string& resolvedPath)
+{
+    if (!IsActive()) {
+        return;
+    }
+
+    _GetMap().insert(
+        std::make_pair(_Key(_GetCurrentContextHash(), path), resolvedPath));
+}
+
+void
+ArResolverSharedCache::Invalidate()
+{
+    _GetMap().clear();
+}
+
+void
+ArResolverSharedCache::Invalidate(const std::string& path)
+{
+    // Traversal is not safe against concurrent modification, but per the
+    // header invalidation may only be called at quiescent points.
+    _PathToResolvedPathMap& map = _GetMap();
+    std::vector<_Key> staleKeys;
+    for (_PathToResolvedPathMap::iterator it = map.begin();
+         it != map.end(); ++it) {
+        if (it->first.second == path) {
+            staleKeys.push_back(it->first);
+        }
+    }
+    for (const _Key& key : staleKeys) {
+        map.erase(key);
+    }
+}
+
+ArResolverSharedCacheScope::ArResolverSharedCacheScope()
+{
+    ++_numActiveScopes;
+}
+
+ArResolverSharedCacheScope::~ArResolverSharedCacheScope()
+{
+    --_numActiveScopes;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,105 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef AR_RESOLVER_SHARED_CACHE_H
+#define AR_RESOLVER_SHARED_CACHE_H
+
+/// \file ar/resolverSharedCache.h
+
+#include "pxr/pxr.h"
+#include "pxr/usd/ar/api.h"
+#include <boost/noncopyable.hpp>
+#include <string>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class ArResolverSharedCache
+///
+/// A process-wide cache of resolution results shared by all threads,
+/// keyed by the currently-bound resolver context and the asset path.
+///
+/// Unlike ArResolverScopedCache, which delegates caching to the resolver
+/// implementation and applies only to the thread that created it, this
+/// cache is maintained by Ar itself and is visible to every thread while
+/// at least one ArResolverSharedCacheScope is alive.  Parallel prim
+/// composition establishes such a scope so that worker threads resolving
+/// the same asset paths hit the cache instead of each re-issuing the
+/// same resolver queries.
+///
+/// Entries persist across scopes until explicitly invalidated.  The
+/// invalidation functions must not be called concurrently with threads
+/// that are actively resolving; they are intended for quiescent points
+/// such as reloading layers or refreshing a resolver context.
+class ArResolverSharedCache
+{
+public:
+    /// Returns true if at least one ArResolverSharedCacheScope is alive.
+    AR_API
+    static bool IsActive();
+
+    /// If the cache is active and holds a result for \p path under the
+    /// currently-bound resolver context, fill \p resolvedPath and return
+    /// true.
+    AR_API
+    static bool Lookup(const std::string& path, std::string* resolvedPath);
+
+    /// If the cache is active, record \p resolvedPath as the result of
+    /// resolving \p path under the currently-bound resolver context.
+    AR_API
+    static void Store(const std::string& path,
+                      const std::string& resolvedPath);
+
+    /// Remove all entries from the cache.
+    AR_API
+    static void Invalidate();
+
+    /// Remove the entries for \p path under every resolver context.
+    AR_API
+    static void Invalidate(const std::string& path);
+};
+
+/// \class ArResolverSharedCacheScope
+///
+/// RAII object that activates the process-wide shared resolution cache.
+/// The cache is active while at least one instance is alive, regardless
+/// of which thread created it; instances may overlap freely.
+///
+/// \see ArResolverSharedCache
+class ArResolverSharedCacheScope
+    : public boost::noncopyable
+{
+public:
+    /// Activate the shared resolution cache.
+    AR_API
+    ArResolverSharedCacheScope();
+
+    /// Deactivate the shared resolution cache.  The cache contents are
+    /// retained for the next scope; use ArResolverSharedCache::Invalidate
+    /// to drop them.
+    AR_API
+    ~ArResolverSharedCacheScope();
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // AR_RESOLVER_SHARED_CACHE_H
@@ -26,9 +26,11 @@
 #include "pxr/usd/pcp/cache.h"
 #include "pxr/usd/pcp/arc.h"
 #include "pxr/usd/pcp/changes.h"
+#include "pxr/usd/pcp/composeSite.h"
 #include "pxr/usd/pcp/diagnostic.h"
 #include "pxr/usd/pcp/debugCodes.h"
 #include "pxr/usd/pcp/dependencies.h"
+#include "pxr/usd/pcp/layerPrefetchRequest.h"
 #include "pxr/usd/pcp/layerStack.h"
 #include "pxr/usd/pcp/layerStackIdentifier.h"
 #include "pxr/usd/pcp/layerStackRegistry.h"
@@ -36,9 +38,11 @@
 #include "pxr/usd/pcp/pathTranslation.h"
 #include "pxr/usd/pcp/payloadDecorator.h"
 #include "pxr/usd/pcp/primIndex.h"
+#include "pxr/usd/pcp/primIndexCacheFile.h"
 #include "pxr/usd/pcp/propertyIndex.h"
 #include "pxr/usd/pcp/statistics.h"
 #include "pxr/usd/pcp/targetIndex.h"
+#include "pxr/usd/pcp/utils.h"
 
 #include "pxr/usd/ar/resolver.h"
 #include "pxr/usd/ar/resolverScopedCache.h"
@@ -54,7 +58,10 @@
 #include "pxr/base/tf/envSetting.h"
 #include "pxr/base/tf/registryManager.h"
 
+#include <boost/functional/hash.hpp>
+
 #include <tbb/atomic.h>
+#include <tbb/concurrent_hash_map.h>
 #include <tbb/concurrent_queue.h>
 #include <tbb/concurrent_vector.h>
 #include <tbb/spin_rw_mutex.h>
@@ -108,6 +115,84 @@ private:
     PcpChanges _immediateChanges;
 };
 
+// Memo of authored variant selections composed from individual sites
+// during prim indexing.  Variant evaluation walks strength-ordered
+// sites for every prim with variants, so sibling prims that share
+// selection sources would otherwise repeat identical layer stack
+// walks.  Negative results are recorded too, since most sites
+// consulted have no opinion for a given variant set.  Keys hold their
+// layer stack by ref ptr so a live entry can never alias a recycled
+// layer stack; the owning cache clears the memo wholesale when
+// changes are applied.
+class Pcp_VariantSelectionMemo {
+public:
+    // Returns the authored selection for \p vset at the site
+    // (\p layerStack, \p path), composing and recording it on a miss.
+    // Returns true and fills \p vsel if the site has an authored
+    // opinion.
+    bool Compose(const PcpLayerStackRefPtr& layerStack,
+                 const SdfPath& path,
+                 const std::string& vset,
+                 std::string* vsel)
+    {
+        _Key key;
+        key.layerStack = layerStack;
+        key.path = path;
+        key.vset = vset;
+
+        {
+            _Map::const_accessor accessor;
+            if (_map.find(accessor, key)) {
+                if (accessor->second.first) {
+                    *vsel = accessor->second.second;
+                }
+                return accessor->second.first;
+            }
+        }
+
+        std::string composed;
+        const bool hasSelection = PcpComposeSiteVariantSelection(
+            layerStack, path, vset, &composed);
+        _map.insert(std::make_pair(key,
+                                   std::make_pair(hasSelection, composed)));
+        if (hasSelection) {
+            *vsel = composed;
+        }
+        return hasSelection;
+    }
+
+    void Clear()
+    {
+        _map.clear();
+    }
+
+private:
+    struct _Key {
+        PcpLayerStackRefPtr layerStack;
+        SdfPath path;
+        std::string vset;
+    };
+
+    struct _HashEq {
+        static bool equal(const _Key& lhs, const _Key& rhs) {
+            return lhs.layerStack == rhs.layerStack &&
+                   lhs.path == rhs.path &&
+                   lhs.vset == rhs.vset;
+        }
+        static size_t hash(const _Key& key) {
+            size_t seed = SdfPath::Hash()(key.path);
+            boost::hash_combine(seed, key.layerStack);
+            boost::hash_combine(seed, key.vset);
+            return seed;
+        }
+    };
+
+    typedef tbb::concurrent_hash_map<
+        _Key, std::pair<bool, std::string>, _HashEq> _Map;
+
+    _Map _map;
+};
+
 PcpCache::PcpCache(
     const PcpLayerStackIdentifier & layerStackIdentifier,
     const std::string& targetSchema,
@@ -120,7 +205,8 @@ PcpCache::PcpCache(
     _targetSchema(targetSchema),
     _payloadDecorator(payloadDecorator),
     _layerStackCache(Pcp_LayerStackRegistry::New(_targetSchema, _usd)),
-    _primDependencies(new Pcp_Dependencies())
+    _primDependencies(new Pcp_Dependencies()),
+    _variantSelectionMemo(new Pcp_VariantSelectionMemo())
 {
     // Do nothing
 }
@@ -140,6 +226,11 @@ PcpCache::~PcpCache()
     // that it can safely unregister itself.
     TfReset(_layerStack);
 
+    // Drop the variant selection memo before the parallel teardown
+    // below; its keys hold layer stack references and the layer stack
+    // registry is not prepared to handle concurrent expiry.
+    _variantSelectionMemo->Clear();
+
     // Tear down some of our datastructures in parallel, since it can take quite
     // a bit of time.
     WorkArenaDispatcher wd;
@@ -280,7 +371,46 @@ PcpCache::RequestPayloads( const SdfPathSet & pathsToInclude,
     }
 }
 
-void 
+void
+PcpCache::PrefetchPayloads(const SdfPathSet &primIndexPaths,
+                           PcpLayerPrefetchRequest *request) const
+{
+    TRACE_FUNCTION();
+
+    // A payload decorator may select per-payload file format arguments
+    // that this pre-fetch cannot predict; opening the layers without
+    // them would warm the registry with the wrong layer identities.
+    if (GetPayloadDecorator()) {
+        return;
+    }
+
+    SdfLayer::FileFormatArguments args;
+    Pcp_GetArgumentsForTargetSchema(_targetSchema, &args);
+
+    for (const SdfPath &path : primIndexPaths) {
+        const PcpPrimIndex *primIndex = FindPrimIndex(path);
+        if (!primIndex || !primIndex->HasPayload()) {
+            continue;
+        }
+        for (const PcpNodeRef &node : primIndex->GetNodeRange()) {
+            if (!node.CanContributeSpecs()) {
+                continue;
+            }
+            SdfPayload payload;
+            SdfLayerHandle sourceLayer;
+            PcpComposeSitePayload(node, &payload, &sourceLayer);
+            if (!payload) {
+                continue;
+            }
+            request->RequestPayloadLayer(
+                SdfLayerRefPtr(sourceLayer), payload.GetAssetPath(), args);
+        }
+    }
+
+    request->Run(_layerStackCache->_GetMutedLayers());
+}
+
+void
 PcpCache::RequestLayerMuting(const std::vector<std::string>& layersToMute,
                              const std::vector<std::string>& layersToUnmute,
                              PcpChanges* changes)
@@ -419,6 +549,19 @@ PcpCache::FindPrimIndex(const SdfPath & path) const
     return _GetPrimIndex(path);
 }
 
+bool
+PcpCache::ExportPrimIndexCache(const std::string &cacheFilePath) const
+{
+    return Pcp_PrimIndexCacheFile::Write(*this, cacheFilePath);
+}
+
+bool
+PcpCache::ImportPrimIndexCache(const std::string &cacheFilePath,
+                               PcpErrorVector *allErrors)
+{
+    return Pcp_PrimIndexCacheFile::Read(this, cacheFilePath, allErrors);
+}
+
 void
 PcpCache::ComputeRelationshipTargetPaths(const SdfPath & relPath, 
                                          SdfPathVector *paths,
@@ -865,11 +1008,23 @@ PcpCache::Apply(const PcpCacheChanges& changes, PcpLifeboat* lifeboat)
 {
     TRACE_FUNCTION();
 
+    // Any of these changes may affect authored variant selections,
+    // and the memo does not track fine-grained dependencies, so drop
+    // it wholesale.
+    _variantSelectionMemo->Clear();
+
     // Check for special case of blowing everything.
     if (changes.didChangeSignificantly.count(SdfPath::AbsoluteRootPath())) {
-        // Clear everything for scene graph objects.
-        _primIndexCache.clear();
-        _propertyIndexCache.clear();
+        // Clear everything for scene graph objects.  This is the path a
+        // sublayer mute or unmute takes, and on large stages the index
+        // tables dominate, so tear them down in parallel as ~PcpCache
+        // does.  The dependencies must still be torn down afterwards,
+        // since they hold the layer stack references that keep the layer
+        // stack registry from seeing concurrent expiry.
+        WorkArenaDispatcher wd;
+        wd.Run([this]() { _primIndexCache.ClearInParallel(); });
+        wd.Run([this]() { TfReset(_propertyIndexCache); });
+        wd.Wait();
         _primDependencies->RemoveAll(lifeboat);
     }
     else {
@@ -1394,6 +1549,12 @@ struct Pcp_ParallelIndexer
                 locked = lock.try_acquire(_primIndexCacheMutex, /*write=*/true);
             }
             if (locked) {
+                // Entries in the cache table are stable, so we can
+                // collect the published indexes and register their
+                // dependencies after releasing the lock; the dependency
+                // map takes its own finer-grained locks.
+                vector<const PcpPrimIndex *> published;
+                published.reserve(_consumerScratch.size());
                 for (auto &index: _consumerScratch) {
                     // Save the prim index in the cache.
                     const SdfPath &path = index.GetPath();
@@ -1402,11 +1563,14 @@ struct Pcp_ParallelIndexer
                                   "PrimIndex for %s already exists in cache",
                                   entry.GetPath().GetText())) {
                         entry.Swap(index);
-                        _cache->_primDependencies->Add(entry);
+                        published.push_back(&entry);
                     }
                 }
                 lock.release();
                 _consumerScratch.clear();
+                for (const PcpPrimIndex *entry: published) {
+                    _cache->_primDependencies->Add(*entry);
+                }
             }
         }
     }
@@ -1536,6 +1700,15 @@ PcpCache::_ComputePrimIndexWithCompatibleInputs(
     return cacheEntry;
 }
 
+bool
+PcpCache::_ComposeSiteVariantSelection(const PcpLayerStackRefPtr& layerStack,
+                                       const SdfPath& path,
+                                       const std::string& vset,
+                                       std::string* vsel)
+{
+    return _variantSelectionMemo->Compose(layerStack, path, vset, vsel);
+}
+
 PcpPropertyIndex*
 PcpCache::_GetPropertyIndex(const SdfPath& path)
 {
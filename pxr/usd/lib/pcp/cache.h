@@ -49,10 +49,12 @@ PXR_NAMESPACE_OPEN_SCOPE
 class PcpChanges;
 class PcpCacheChanges;
 class Pcp_Dependencies;
+class PcpLayerPrefetchRequest;
 class PcpLayerStackIdentifier;
 class PcpLifeboat;
 class PcpNodeRef;
 class PcpMapFunction;
+class Pcp_VariantSelectionMemo;
 
 TF_DECLARE_WEAK_AND_REF_PTRS(PcpLayerStack);
 TF_DECLARE_WEAK_AND_REF_PTRS(Pcp_LayerStackRegistry);
@@ -180,11 +182,28 @@ public:
     /// \note If a path is listed in both pathsToInclude and pathsToExclude,
     /// it will be treated as an inclusion only.
     ///
-    PCP_API 
+    PCP_API
     void RequestPayloads( const SdfPathSet & pathsToInclude,
                           const SdfPathSet & pathsToExclude,
                           PcpChanges* changes = NULL );
 
+    /// Pre-fetch, in parallel, the payload layers needed to include the
+    /// payloads at the prim index paths in \p primIndexPaths, along with
+    /// their sublayer stacks, using \p request.  This is purely a warm-up
+    /// for a subsequent RequestPayloads call covering the same paths: the
+    /// layers are found or opened exactly as composition would open them,
+    /// so the recomposition that includes the payloads finds them already
+    /// in memory.  \p request retains the opened layers; keep it alive
+    /// until recomposition has adopted them into layer stacks.
+    ///
+    /// Paths with no computed prim index, or whose prim index has no
+    /// payload, are ignored.  If this cache uses a payload decorator this
+    /// function does nothing, since the decorator may select per-payload
+    /// file format arguments this pre-fetch cannot predict.
+    PCP_API
+    void PrefetchPayloads(const SdfPathSet &primIndexPaths,
+                          PcpLayerPrefetchRequest *request) const;
+
     /// Request layers to be muted or unmuted in this cache.  Muted layers
     /// are ignored during composition and do not appear in any layer
     /// stacks.  The root layer of this stage may not be muted; attempting
@@ -354,6 +373,29 @@ public:
     const PcpPrimIndex *
     FindPrimIndex(const SdfPath &primPath) const;
 
+    /// Writes this cache's computed prim indexes to \p cacheFilePath,
+    /// along with signatures for every layer that contributed to them,
+    /// so that a later process composing the same assets can warm-start
+    /// via ImportPrimIndexCache() instead of recomputing.  Returns false
+    /// if the results cannot be revalidated from disk state -- for
+    /// example, if any contributing layer is dirty or anonymous -- or if
+    /// the file could not be written.  The file format is specific to
+    /// the host architecture and build and is not an archival format.
+    PCP_API
+    bool ExportPrimIndexCache(const std::string &cacheFilePath) const;
+
+    /// Reads prim indexes previously written by ExportPrimIndexCache()
+    /// from \p cacheFilePath and adds them to this cache.  The recorded
+    /// layer signatures are revalidated first; if any contributing layer
+    /// has changed on disk, or the file was written by an incompatible
+    /// build or a differently-configured cache, the entire file is
+    /// rejected and no prim indexes are imported.  Returns true if the
+    /// indexes were imported.  \p allErrors will contain any errors
+    /// encountered while rebuilding layer stacks.
+    PCP_API
+    bool ImportPrimIndexCache(const std::string &cacheFilePath,
+                              PcpErrorVector *allErrors);
+
     /// Compute and return a reference to the cached result for the
     /// property index for the given path. \p allErrors will contain any
     /// errors encountered while performing this operation.
@@ -557,6 +599,7 @@ public:
 
 private:
     friend class PcpChanges;
+    friend class Pcp_PrimIndexCacheFile;
     friend class Pcp_Statistics;
 
     template <class ChildPredicate>
@@ -648,6 +691,26 @@ private:
     PcpPropertyIndex* _GetPropertyIndex(const SdfPath& path);
     const PcpPropertyIndex* _GetPropertyIndex(const SdfPath& path) const;
 
+    // Returns the authored variant selection for \p vset at the site
+    // (\p layerStack, \p path), memoizing the result so that sibling
+    // prims drawing selections from the same site do not repeat the
+    // layer stack walk.  Returns true and fills \p vsel if the site
+    // has an authored opinion.  The memo is cleared when changes are
+    // applied; see Apply().
+    bool _ComposeSiteVariantSelection(const PcpLayerStackRefPtr& layerStack,
+                                      const SdfPath& path,
+                                      const std::string& vset,
+                                      std::string* vsel);
+
+    // Friend to allow low-level indexing code access to the above.
+    friend bool
+    Pcp_ComposeSiteVariantSelectionWithCache(
+        PcpCache& cache,
+        const PcpLayerStackRefPtr& layerStack,
+        const SdfPath& path,
+        const std::string& vset,
+        std::string* vsel);
+
 private:
     // Fixed evaluation parameters, set when the cache is created.  Note that
     // _rootLayer and _sessionLayer are not const because we want to mutate them
@@ -693,6 +756,12 @@ private:
     _PrimIndexCache  _primIndexCache;
     _PropertyIndexCache  _propertyIndexCache;
     std::unique_ptr<Pcp_Dependencies> _primDependencies;
+
+    // Memoized authored variant selections composed from individual
+    // sites during prim indexing.  Only consulted for computations
+    // whose results and dependencies land in this cache, so Apply()
+    // can invalidate it by clearing it wholesale.
+    std::unique_ptr<Pcp_VariantSelectionMemo> _variantSelectionMemo;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
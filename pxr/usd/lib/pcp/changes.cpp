@@ -38,6 +38,7 @@
 #include "pxr/usd/sdf/layerUtils.h"
 #include "pxr/usd/ar/resolverContextBinder.h"
 #include "pxr/base/tracelite/trace.h"
+#include "pxr/base/work/arenaDispatcher.h"
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -101,7 +102,14 @@ PcpLifeboat::Retain(const PcpLayerStackRefPtr& layerStack)
     _layerStacks.insert(layerStack);
 }
 
-const std::set<PcpLayerStackRefPtr>& 
+void
+PcpLifeboat::Absorb(const PcpLifeboat& other)
+{
+    _layers.insert(other._layers.begin(), other._layers.end());
+    _layerStacks.insert(other._layerStacks.begin(), other._layerStacks.end());
+}
+
+const std::set<PcpLayerStackRefPtr>&
 PcpLifeboat::GetLayerStacks() const
 {
     return _layerStacks;
@@ -1338,9 +1346,31 @@ PcpChanges::Apply() const
         }
     }
 
-    // Now apply cache changes.
-    TF_FOR_ALL(i, _cacheChanges) {
-        i->first->Apply(i->second, &_lifeboat);
+    // Now apply cache changes.  Caches are independent of one another --
+    // each owns its layer stack registry and indexes -- so when several
+    // caches are affected, fan the applications out, giving each its own
+    // lifeboat to avoid contention and absorbing them at the end.
+    if (_cacheChanges.size() <= 1) {
+        TF_FOR_ALL(i, _cacheChanges) {
+            i->first->Apply(i->second, &_lifeboat);
+        }
+    }
+    else {
+        std::vector<PcpLifeboat> lifeboats(_cacheChanges.size());
+        WorkArenaDispatcher dispatcher;
+        size_t cacheNum = 0;
+        TF_FOR_ALL(i, _cacheChanges) {
+            PcpCache* cache = i->first;
+            const PcpCacheChanges* changes = &i->second;
+            PcpLifeboat* lifeboat = &lifeboats[cacheNum++];
+            dispatcher.Run([cache, changes, lifeboat]() {
+                cache->Apply(*changes, lifeboat);
+            });
+        }
+        dispatcher.Wait();
+        for (const PcpLifeboat& lifeboat : lifeboats) {
+            _lifeboat.Absorb(lifeboat);
+        }
     }
 }
 
@@ -147,6 +147,10 @@ public:
     /// Ensure that \p layerStack exists until this object is destroyed.
     void Retain(const PcpLayerStackRefPtr& layerStack);
 
+    /// Ensure that everything retained by \p other also exists until
+    /// this object is destroyed.
+    void Absorb(const PcpLifeboat& other);
+
     /// Returns reference to the set of layer stacks currently being held
     /// in the lifeboat.
     const std::set<PcpLayerStackRefPtr>& GetLayerStacks() const;
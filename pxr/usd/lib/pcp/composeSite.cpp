@@ -29,8 +29,16 @@
 #include "pxr/usd/sdf/layerUtils.h"
 #include "pxr/usd/sdf/listOp.h"
 #include "pxr/usd/sdf/primSpec.h"
+#include "pxr/base/tf/staticData.h"
 
+#include <boost/functional/hash.hpp>
+
+#include <tbb/concurrent_hash_map.h>
+
+#include <algorithm>
 #include <functional>
+#include <utility>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -44,12 +52,65 @@ PXR_NAMESPACE_OPEN_SCOPE
 // expressed the opinion as the basis for relative paths.
 
 
+// Fetch the value of \p field at \p path by reference into \p layer's
+// storage when the data object can expose one, avoiding a copy; fall
+// back to a HasField copy into \p storage otherwise.  Returns NULL if
+// the field is not set or does not hold a T.
+template <class LayerPtr, class T>
+static const T *
+_GetFieldValue(const LayerPtr& layer, const SdfPath& path,
+               const TfToken& field, T* storage)
+{
+    if (const VtValue* value = layer->GetFieldRef(path, field)) {
+        if (value->IsHolding<T>()) {
+            return &value->UncheckedGet<T>();
+        }
+    }
+    return layer->HasField(path, field, storage) ? storage : nullptr;
+}
+
+// Batch-compute the anchored form of every asset path appearing in any
+// of \p listOp's item lists, so that a single resolver round trip (via
+// ArResolver::ResolveBatch) covers the whole list op.  Returns a map
+// from authored asset path to its anchored form.
+static std::map<std::string, std::string>
+_ComputeAnchoredAssetPaths(const SdfLayerHandle& layer,
+                           const SdfReferenceListOp& listOp)
+{
+    std::vector<std::string> assetPaths;
+    for (const SdfListOpType opType : { SdfListOpTypeExplicit,
+                                        SdfListOpTypeAdded,
+                                        SdfListOpTypePrepended,
+                                        SdfListOpTypeAppended,
+                                        SdfListOpTypeDeleted,
+                                        SdfListOpTypeOrdered }) {
+        for (const SdfReference& ref : listOp.GetItems(opType)) {
+            if (!ref.GetAssetPath().empty()) {
+                assetPaths.push_back(ref.GetAssetPath());
+            }
+        }
+    }
+    std::sort(assetPaths.begin(), assetPaths.end());
+    assetPaths.erase(std::unique(assetPaths.begin(), assetPaths.end()),
+                     assetPaths.end());
+
+    const std::vector<std::string> anchoredPaths =
+        SdfComputeAssetPathsRelativeToLayer(layer, assetPaths);
+
+    std::map<std::string, std::string> result;
+    for (size_t i = 0; i != assetPaths.size(); ++i) {
+        result[assetPaths[i]] = anchoredPaths[i];
+    }
+    return result;
+}
+
 // List-op composition callback that computes absolute asset paths
 // relative to the layer where they were expressed.
 static boost::optional<SdfReference>
-_ResolveReference( const SdfLayerHandle& layer, 
+_ResolveReference( const SdfLayerHandle& layer,
                    const SdfLayerOffset& layerOffset,
                    std::map<SdfReference, PcpSourceReferenceInfo>* infoMap,
+                   const std::map<std::string, std::string>* anchoredPaths,
                    SdfListOpType opType,
                    const SdfReference& ref)
 {
@@ -57,9 +118,13 @@ _ResolveReference( const SdfLayerHandle& layer,
     // instead of the authored asset path. This ensures that references
     // with the same relative asset path but anchored to different
     // locations will not be considered duplicates.
-    const std::string assetPath = ref.GetAssetPath().empty() ? 
-        ref.GetAssetPath() : 
-        SdfComputeAssetPathRelativeToLayer(layer, ref.GetAssetPath());
+    std::string assetPath;
+    if (!ref.GetAssetPath().empty()) {
+        const std::map<std::string, std::string>::const_iterator it =
+            anchoredPaths->find(ref.GetAssetPath());
+        assetPath = it != anchoredPaths->end() ? it->second :
+            SdfComputeAssetPathRelativeToLayer(layer, ref.GetAssetPath());
+    }
 
     SdfReference result( assetPath, 
                         ref.GetPrimPath(), 
@@ -72,6 +137,71 @@ _ResolveReference( const SdfLayerHandle& layer,
     return result;
 }
 
+namespace {
+
+// Memo cache for composed list-op chains.  Wide reference fan-outs
+// compose the same arc fields over the same layer stacks once per
+// referencing prim; keying on the chain of authored list ops by value
+// lets every site with identical opinions share one composed result.
+// Layer edits need no explicit invalidation: an edited list op compares
+// unequal to the chain its result was memoized under, so changed sites
+// simply miss the cache, and retained entries are bounded by the number
+// of distinct chains encountered.
+template <class ListOpType>
+struct _ListOpChainCache
+{
+    typedef std::vector<ListOpType> Chain;
+    typedef typename ListOpType::ItemVector ItemVector;
+
+    // Apply \p chain, weakest operand first, onto *result.
+    void Apply(const Chain &chain, ItemVector *result)
+    {
+        // The memoized results are composed onto an empty list, so if
+        // the caller hands us partial results to compose onto we must
+        // apply the chain directly.
+        if (!result->empty()) {
+            _ApplyDirectly(chain, result);
+            return;
+        }
+        {
+            typename _Map::const_accessor accessor;
+            if (_map.find(accessor, chain)) {
+                *result = accessor->second;
+                return;
+            }
+        }
+        _ApplyDirectly(chain, result);
+        _map.insert(std::make_pair(chain, *result));
+    }
+
+private:
+    static void _ApplyDirectly(const Chain &chain, ItemVector *result)
+    {
+        TF_FOR_ALL(listOp, chain) {
+            listOp->ApplyOperations(result);
+        }
+    }
+
+    struct _HashEq
+    {
+        static bool equal(const Chain &lhs, const Chain &rhs) {
+            return lhs == rhs;
+        }
+        static size_t hash(const Chain &chain) {
+            return boost::hash_range(chain.begin(), chain.end());
+        }
+    };
+
+    typedef tbb::concurrent_hash_map<Chain, ItemVector, _HashEq> _Map;
+
+    _Map _map;
+};
+
+TfStaticData<_ListOpChainCache<SdfPathListOp> > _pathListOpChainCache;
+TfStaticData<_ListOpChainCache<SdfStringListOp> > _stringListOpChainCache;
+
+} // anonymous namespace
+
 void
 PcpComposeSiteReferences(PcpLayerStackRefPtr const &layerStack,
                          SdfPath const &path,
@@ -86,18 +216,21 @@ PcpComposeSiteReferences(PcpLayerStackRefPtr const &layerStack,
     std::map<SdfReference, PcpSourceReferenceInfo> infoMap;
 
     const SdfLayerRefPtrVector& layers = layerStack->GetLayers();
-    SdfReferenceListOp curListOp;
+    SdfReferenceListOp listOpStorage;
 
     result->clear();
     for (size_t i = layers.size(); i-- != 0; ) {
         const SdfLayerHandle& layer = layers[i];
-        if (layer->HasField(path, field, &curListOp)) {
+        if (const SdfReferenceListOp* curListOp =
+            _GetFieldValue(layer, path, field, &listOpStorage)) {
             const SdfLayerOffset* layerOffset =
                 layerStack->GetLayerOffsetForLayer(i);
-            curListOp.ApplyOperations(result,
+            const std::map<std::string, std::string> anchoredPaths =
+                _ComputeAnchoredAssetPaths(layer, *curListOp);
+            curListOp->ApplyOperations(result,
                   std::bind( &_ResolveReference, std::ref(layer),
                              layerOffset ? *layerOffset : SdfLayerOffset(),
-                             &infoMap,
+                             &infoMap, &anchoredPaths,
                              std::placeholders::_1, std::placeholders::_2));
         }
     }
@@ -181,10 +314,11 @@ PcpComposeSiteRelocates(PcpLayerStackRefPtr const &layerStack,
 {
     static const TfToken field = SdfFieldKeys->Relocates;
 
-    SdfRelocatesMap relocMap;
+    SdfRelocatesMap relocMapStorage;
     TF_REVERSE_FOR_ALL(layer, layerStack->GetLayers()) {
-        if ((*layer)->HasField(path, field, &relocMap)) {
-            TF_FOR_ALL(reloc, relocMap) {
+        if (const SdfRelocatesMap* relocMap =
+            _GetFieldValue(*layer, path, field, &relocMapStorage)) {
+            TF_FOR_ALL(reloc, *relocMap) {
                 SdfPath source = reloc->first .MakeAbsolutePath(path);
                 SdfPath target = reloc->second.MakeAbsolutePath(path);
                 (*result)[source] = target;
@@ -199,12 +333,17 @@ PcpComposeSiteInherits( const PcpLayerStackRefPtr &layerStack,
 {
     static const TfToken field = SdfFieldKeys->InheritPaths;
 
-    SdfPathListOp inheritListOp;
+    SdfPathListOp listOpStorage;
+    _ListOpChainCache<SdfPathListOp>::Chain chain;
     TF_REVERSE_FOR_ALL(layer, layerStack->GetLayers()) {
-        if ((*layer)->HasField(path, field, &inheritListOp)) {
-            inheritListOp.ApplyOperations(result);
+        if (const SdfPathListOp* inheritListOp =
+            _GetFieldValue(*layer, path, field, &listOpStorage)) {
+            chain.push_back(*inheritListOp);
         }
     }
+    if (!chain.empty()) {
+        _pathListOpChainCache->Apply(chain, result);
+    }
 }
 
 void
@@ -213,12 +352,17 @@ PcpComposeSiteSpecializes(PcpLayerStackRefPtr const &layerStack,
 {
     static const TfToken field = SdfFieldKeys->Specializes;
 
-    SdfPathListOp specializesListOp;
+    SdfPathListOp listOpStorage;
+    _ListOpChainCache<SdfPathListOp>::Chain chain;
     TF_REVERSE_FOR_ALL(layer, layerStack->GetLayers()) {
-        if ((*layer)->HasField(path, field, &specializesListOp)) {
-            specializesListOp.ApplyOperations(result);
+        if (const SdfPathListOp* specializesListOp =
+            _GetFieldValue(*layer, path, field, &listOpStorage)) {
+            chain.push_back(*specializesListOp);
         }
     }
+    if (!chain.empty()) {
+        _pathListOpChainCache->Apply(chain, result);
+    }
 }
 
 void
@@ -228,12 +372,17 @@ PcpComposeSiteVariantSets(PcpLayerStackRefPtr const &layerStack,
 {
     static const TfToken field = SdfFieldKeys->VariantSetNames;
 
-    SdfStringListOp vsetListOp;
+    SdfStringListOp listOpStorage;
+    _ListOpChainCache<SdfStringListOp>::Chain chain;
     TF_REVERSE_FOR_ALL(layer, layerStack->GetLayers()) {
-        if ((*layer)->HasField(path, field, &vsetListOp)) {
-            vsetListOp.ApplyOperations(result);
+        if (const SdfStringListOp* vsetListOp =
+            _GetFieldValue(*layer, path, field, &listOpStorage)) {
+            chain.push_back(*vsetListOp);
         }
     }
+    if (!chain.empty()) {
+        _stringListOpChainCache->Apply(chain, result);
+    }
 }
 
 void
@@ -245,10 +394,11 @@ PcpComposeSiteVariantSetOptions(PcpLayerStackRefPtr const &layerStack,
     static const TfToken field = SdfChildrenKeys->VariantChildren;
 
     const SdfPath vsetPath = path.AppendVariantSelection(vsetName, "");
-    TfTokenVector vsetNames;
+    TfTokenVector vsetNamesStorage;
     for (auto const &layer: layerStack->GetLayers()) {
-        if (layer->HasField(vsetPath, field, &vsetNames)) {
-            TF_FOR_ALL(name, vsetNames) {
+        if (const TfTokenVector* vsetNames =
+            _GetFieldValue(layer, vsetPath, field, &vsetNamesStorage)) {
+            TF_FOR_ALL(name, *vsetNames) {
                 result->insert(name->GetString());
             }
         }
@@ -263,14 +413,15 @@ PcpComposeSiteVariantSelection(PcpLayerStackRefPtr const &layerStack,
 {
     static const TfToken field = SdfFieldKeys->VariantSelection;
 
-    SdfVariantSelectionMap vselMap;
+    SdfVariantSelectionMap vselMapStorage;
     for (auto const &layer: layerStack->GetLayers()) {
-        if (layer->HasField(path, field, &vselMap)) {
-            SdfVariantSelectionMap::const_iterator i = vselMap.find(vsetName);
-            if (i != vselMap.end()) {
+        if (const SdfVariantSelectionMap* vselMap =
+            _GetFieldValue(layer, path, field, &vselMapStorage)) {
+            SdfVariantSelectionMap::const_iterator i = vselMap->find(vsetName);
+            if (i != vselMap->end()) {
                 *result = i->second;
                 return true;
-            } 
+            }
         }
     }
     return false;
@@ -283,10 +434,11 @@ PcpComposeSiteVariantSelections(PcpLayerStackRefPtr const &layerStack,
 {
     static const TfToken field = SdfFieldKeys->VariantSelection;
 
-    SdfVariantSelectionMap vselMap;
+    SdfVariantSelectionMap vselMapStorage;
     for (auto const &layer: layerStack->GetLayers()) {
-        if (layer->HasField(path, field, &vselMap)) {
-            result->insert(vselMap.begin(), vselMap.end());
+        if (const SdfVariantSelectionMap* vselMap =
+            _GetFieldValue(layer, path, field, &vselMapStorage)) {
+            result->insert(vselMap->begin(), vselMap->end());
         }
     }
 }
@@ -29,7 +29,18 @@
 
 PXR_NAMESPACE_OPEN_SCOPE
 
-TF_DEBUG_CODES(
+// These codes are checked on very hot composition paths, so builds that
+// define PXR_DISABLE_PCP_DEBUG_OUTPUT compile the checks (and the message
+// code behind them) out entirely instead of testing a flag at run time.
+#ifdef PXR_DISABLE_PCP_DEBUG_OUTPUT
+#define PCP_DEBUG_CODES_COMPILE_TIME_ENABLED false
+#else
+#define PCP_DEBUG_CODES_COMPILE_TIME_ENABLED true
+#endif
+
+TF_CONDITIONALLY_COMPILE_TIME_ENABLED_DEBUG_CODES(
+
+    PCP_DEBUG_CODES_COMPILE_TIME_ENABLED,
 
     PCP_CHANGES,
     PCP_DEPENDENCIES,
@@ -83,9 +83,6 @@ Pcp_Dependencies::Add(const PcpPrimIndex &primIndex)
         const int curNodeIndex = nodeIndex++;
         const PcpDependencyFlags depFlags = PcpClassifyNodeDependency(n);
         if (_ShouldStoreDependency(depFlags)) {
-            _SiteDepMap &siteDepMap = _deps[n.GetLayerStack()];
-            std::vector<SdfPath> &deps = siteDepMap[n.GetPath()];
-
             TF_DEBUG(PCP_DEPENDENCIES)
                 .Msg(" - Node %i (%s %s): <%s> %s\n",
                      curNodeIndex,
@@ -94,7 +91,11 @@ Pcp_Dependencies::Add(const PcpPrimIndex &primIndex)
                      n.GetPath().GetText(),
                      TfStringify(n.GetLayerStack()->GetIdentifier()).c_str());
 
-            deps.push_back(primIndexPath);
+            const PcpLayerStackRefPtr &layerStack = n.GetLayerStack();
+            _Shard &shard = _shards[_GetShardIndex(get_pointer(layerStack))];
+            tbb::spin_rw_mutex::scoped_lock lock(shard.mutex, /*write=*/true);
+            _SiteDepMap &siteDepMap = shard.deps[layerStack];
+            siteDepMap[n.GetPath()].push_back(primIndexPath);
             count++;
         }
     }
@@ -122,9 +123,6 @@ Pcp_Dependencies::Remove(const PcpPrimIndex &primIndex, PcpLifeboat *lifeboat)
             continue;
         }
 
-        _SiteDepMap &siteDepMap = _deps[n.GetLayerStack()];
-        std::vector<SdfPath> &deps = siteDepMap[n.GetPath()];
-
         TF_DEBUG(PCP_DEPENDENCIES)
             .Msg(" - Node %i (%s %s): <%s> %s\n",
                  curNodeIndex,
@@ -133,6 +131,12 @@ Pcp_Dependencies::Remove(const PcpPrimIndex &primIndex, PcpLifeboat *lifeboat)
                  n.GetPath().GetText(),
                  TfStringify(n.GetLayerStack()->GetIdentifier()).c_str());
 
+        const PcpLayerStackRefPtr &layerStack = n.GetLayerStack();
+        _Shard &shard = _shards[_GetShardIndex(get_pointer(layerStack))];
+        tbb::spin_rw_mutex::scoped_lock lock(shard.mutex, /*write=*/true);
+        _SiteDepMap &siteDepMap = shard.deps[layerStack];
+        std::vector<SdfPath> &deps = siteDepMap[n.GetPath()];
+
         // Swap with last element, then remove that.
         // We are using the vector as an unordered set.
         std::vector<SdfPath>::iterator i =
@@ -178,9 +182,9 @@ Pcp_Dependencies::Remove(const PcpPrimIndex &primIndex, PcpLifeboat *lifeboat)
                 // Check if the entire table is empty.
                 if (siteDepMap.empty()) {
                     if (lifeboat) {
-                        lifeboat->Retain(n.GetLayerStack());
+                        lifeboat->Retain(layerStack);
                     }
-                    _deps.erase(n.GetLayerStack());
+                    shard.deps.erase(layerStack);
 
                     TF_DEBUG(PCP_DEPENDENCIES)
                         .Msg("    Removed last dep on %s\n",
@@ -198,46 +202,61 @@ Pcp_Dependencies::RemoveAll(PcpLifeboat* lifeboat)
     TF_DEBUG(PCP_DEPENDENCIES).Msg(
         "Pcp_Dependencies::RemoveAll: Clearing all dependencies\n");
 
-    // Retain all layerstacks in the lifeboat.
-    if (lifeboat) {
-        TF_FOR_ALL(i, _deps) {
-            lifeboat->Retain(i->first);
+    for (_Shard &shard : _shards) {
+        tbb::spin_rw_mutex::scoped_lock lock(shard.mutex, /*write=*/true);
+
+        // Retain all layerstacks in the lifeboat.
+        if (lifeboat) {
+            TF_FOR_ALL(i, shard.deps) {
+                lifeboat->Retain(i->first);
+            }
         }
-    }
 
-    _deps.clear();
+        shard.deps.clear();
+    }
 }
 
-SdfLayerHandleSet 
+SdfLayerHandleSet
 Pcp_Dependencies::GetUsedLayers() const
 {
     SdfLayerHandleSet reachedLayers;
 
-    TF_FOR_ALL(layerStack, _deps) {
-        const SdfLayerRefPtrVector& layers = layerStack->first->GetLayers();
-        reachedLayers.insert(layers.begin(), layers.end());
+    for (const _Shard &shard : _shards) {
+        tbb::spin_rw_mutex::scoped_lock lock(shard.mutex, /*write=*/false);
+        TF_FOR_ALL(layerStack, shard.deps) {
+            const SdfLayerRefPtrVector& layers = layerStack->first->GetLayers();
+            reachedLayers.insert(layers.begin(), layers.end());
+        }
     }
 
     return reachedLayers;
 }
 
-SdfLayerHandleSet 
+SdfLayerHandleSet
 Pcp_Dependencies::GetUsedRootLayers() const
 {
     SdfLayerHandleSet reachedRootLayers;
 
-    TF_FOR_ALL(i, _deps) {
-        const PcpLayerStackPtr& layerStack = i->first;
-        reachedRootLayers.insert(layerStack->GetIdentifier().rootLayer );
+    for (const _Shard &shard : _shards) {
+        tbb::spin_rw_mutex::scoped_lock lock(shard.mutex, /*write=*/false);
+        TF_FOR_ALL(i, shard.deps) {
+            const PcpLayerStackPtr& layerStack = i->first;
+            reachedRootLayers.insert(layerStack->GetIdentifier().rootLayer );
+        }
     }
 
     return reachedRootLayers;
 }
 
-bool 
+bool
 Pcp_Dependencies::UsesLayerStack(const PcpLayerStackPtr& layerStack) const
 {
-    return _deps.find(layerStack) != _deps.end();
+    if (!layerStack) {
+        return false;
+    }
+    const _Shard &shard = _shards[_GetShardIndex(get_pointer(layerStack))];
+    tbb::spin_rw_mutex::scoped_lock lock(shard.mutex, /*write=*/false);
+    return shard.deps.find(layerStack) != shard.deps.end();
 }
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -40,6 +40,9 @@
 #include <boost/noncopyable.hpp>
 #include <boost/unordered_map.hpp>
 
+#include <tbb/spin_rw_mutex.h>
+
+#include <cstdint>
 #include <iosfwd>
 #include <set>
 
@@ -55,6 +58,14 @@ TF_DECLARE_WEAK_PTRS(PcpLayerStack);
 /// Tracks the dependencies of PcpPrimIndex entries in a PcpCache.
 /// This is an internal class only meant for use by PcpCache.
 ///
+/// The dependency map is sharded by layer stack and each shard is
+/// guarded by its own reader-writer mutex, so registration and queries
+/// may run concurrently -- in particular, parallel prim indexing
+/// registers dependencies from multiple threads while composition
+/// queries read.  Callbacks passed to ForEachDependencyOnSite() run
+/// under the shard's read lock and must not re-enter the registration
+/// methods.
+///
 class Pcp_Dependencies : boost::noncopyable {
 public:
     /// Construct with no dependencies.
@@ -109,8 +120,14 @@ public:
                              bool recurseBelowSite,
                              const FN &fn ) const
     {
-        _LayerStackDepMap::const_iterator i = _deps.find(siteLayerStack); 
-        if (i == _deps.end()) {
+        if (!siteLayerStack) {
+            return;
+        }
+        const _Shard &shard =
+            _shards[_GetShardIndex(get_pointer(siteLayerStack))];
+        tbb::spin_rw_mutex::scoped_lock lock(shard.mutex, /*write=*/false);
+        _LayerStackDepMap::const_iterator i = shard.deps.find(siteLayerStack);
+        if (i == shard.deps.end()) {
             return;
         }
         const _SiteDepMap & siteDepMap = i->second;
@@ -171,7 +188,22 @@ private:
     typedef boost::unordered_map<PcpLayerStackRefPtr, _SiteDepMap>
         _LayerStackDepMap;
 
-    _LayerStackDepMap _deps;
+    // The map is split into shards, each guarded by its own mutex.
+    // A given layer stack always hashes to the same shard, so per-layer-
+    // stack operations touch exactly one lock.
+    static const size_t _NumShards = 16;
+    struct _Shard {
+        mutable tbb::spin_rw_mutex mutex;
+        _LayerStackDepMap deps;
+    };
+
+    static size_t _GetShardIndex(const void *layerStack) {
+        // Shift off alignment zero bits so consecutive allocations
+        // spread across shards.
+        return (reinterpret_cast<uintptr_t>(layerStack) >> 6) % _NumShards;
+    }
+
+    mutable _Shard _shards[_NumShards];
 };
 
 template <typename FN>
@@ -37,6 +37,15 @@ TF_DEFINE_ENV_SETTING(
     "  0: NEVER computes instanceable (always returns false)\n"
     "  1: always compute instanceable, whether in USD mode or not.");
 
+TF_DEFINE_ENV_SETTING(
+    PCP_IMPLICIT_INSTANCEABLE, false,
+    "If enabled, prim indexes that introduce instanceable data (e.g. a "
+    "direct reference) are treated as instanceable even when no "
+    "'instanceable' opinion is authored, allowing structurally identical "
+    "prim indexes to be deduplicated via their instance keys without "
+    "requiring instanceable = true tagging.  Authored 'instanceable' "
+    "opinions still take precedence.");
+
 // Visitor to determine if a prim index has instanceable data.
 // This essentially checks if a prim index had a direct composition arc
 // (e.g. a reference or class) that could be shared with other prims.
@@ -115,7 +124,14 @@ Pcp_PrimIndexIsInstanceable(
     };
 
     bool isInstance = false;
-    _Helper::ComposeInstance(primIndex.GetRootNode(), &isInstance);
+    if (!_Helper::ComposeInstance(primIndex.GetRootNode(), &isInstance)) {
+        // No authored opinion.  Normally unauthored prims are not
+        // instanceable, but with implicit instancing enabled any prim
+        // index with instanceable data is shared by default.
+        static const bool implicitInstanceable =
+            TfGetEnvSetting(PCP_IMPLICIT_INSTANCEABLE);
+        isInstance = implicitInstanceable;
+    }
     return isInstance;
 }
 
@@ -26,6 +26,8 @@
 #include "pxr/usd/pcp/layerPrefetchRequest.h"
 #include "pxr/usd/pcp/layerStackRegistry.h"
 #include "pxr/usd/sdf/layerUtils.h"
+#include "pxr/usd/ar/resolverScopedCache.h"
+#include "pxr/base/tracelite/trace.h"
 #include "pxr/base/work/arenaDispatcher.h"
 #include "pxr/base/work/threadLimits.h"
 
@@ -38,9 +40,11 @@ namespace {
 struct _Opener
 {
     explicit _Opener(const Pcp_MutedLayers& mutedLayers,
-                     std::set<SdfLayerRefPtr> *retainedLayers) 
+                     std::set<SdfLayerRefPtr> *retainedLayers,
+                     const ArResolverScopedCache *parentCache)
         : _mutedLayers(mutedLayers)
-        , _retainedLayers(retainedLayers) {}
+        , _retainedLayers(retainedLayers)
+        , _parentCache(parentCache) {}
 
     ~_Opener() { _dispatcher.Wait(); }
 
@@ -52,10 +56,25 @@ struct _Opener
         }
     }
 
+    void OpenPayloadLayer(const SdfLayerRefPtr &anchorLayer,
+                          const std::string &assetPath,
+                          const SdfLayer::FileFormatArguments &layerArgs) {
+        // A payload layer is opened exactly like a sublayer: relative to
+        // the layer that authored it, then recursively through its own
+        // sublayer stack.
+        _dispatcher.Run(
+            &_Opener::_OpenSublayer, this, assetPath, anchorLayer, layerArgs);
+    }
+
 private:
     void _OpenSublayer(std::string path,
                        const SdfLayerRefPtr &anchorLayer,
                        const SdfLayer::FileFormatArguments &layerArgs) {
+        // Share the caller's resolver cache scope so that asset paths
+        // resolved here are reused by other tasks and by the serial
+        // layer stack build that follows the prefetch.
+        ArResolverScopedCache taskCache(_parentCache);
+
         if (_mutedLayers.IsLayerMuted(anchorLayer, path)) {
             return;
         }
@@ -81,6 +100,7 @@ private:
     WorkArenaDispatcher _dispatcher;
     const Pcp_MutedLayers& _mutedLayers;
     std::set<SdfLayerRefPtr> *_retainedLayers;
+    const ArResolverScopedCache *_parentCache;
     mutable tbb::spin_mutex _retainedLayersMutex;
 };
 
@@ -94,9 +114,21 @@ PcpLayerPrefetchRequest::RequestSublayerStack(
     _sublayerRequests.insert(std::make_pair(layer, args));
 }
 
+void
+PcpLayerPrefetchRequest::RequestPayloadLayer(
+    const SdfLayerRefPtr &anchorLayer,
+    const std::string &assetPath,
+    const SdfLayer::FileFormatArguments &args)
+{
+    _payloadRequests.insert(
+        std::make_pair(std::make_pair(anchorLayer, args), assetPath));
+}
+
 void
 PcpLayerPrefetchRequest::Run(const Pcp_MutedLayers& mutedLayers)
 {
+    TRACE_FUNCTION();
+
     if (WorkGetConcurrencyLimit() <= 1) {
         // Do not bother pre-fetching if we do not have extra threads
         // available.
@@ -111,10 +143,22 @@ PcpLayerPrefetchRequest::Run(const Pcp_MutedLayers& mutedLayers)
     std::set<_Request> requests;
     requests.swap(_sublayerRequests);
 
+    std::set<_PayloadRequest> payloadRequests;
+    payloadRequests.swap(_payloadRequests);
+
+    // Open a resolver cache scope on this thread.  Worker tasks share
+    // this scope, so each asset path is resolved once across the whole
+    // request, and any enclosing scope held by the caller sees the
+    // resolved results after we return.
+    ArResolverScopedCache parentCache;
+
     // Open all the sublayers in the request.
-    _Opener opener(mutedLayers, &_retainedLayers);
+    _Opener opener(mutedLayers, &_retainedLayers, &parentCache);
     TF_FOR_ALL(req, requests)
         opener.OpenSublayers(req->first, req->second);
+    TF_FOR_ALL(req, payloadRequests)
+        opener.OpenPayloadLayer(req->first.first, req->second,
+                                req->first.second);
 }
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -54,6 +54,18 @@ public:
         const SdfLayerRefPtr &layer,
         const SdfLayer::FileFormatArguments &args);
 
+    /// Enqueue a request to pre-fetch the layer referred to by
+    /// \a assetPath, anchored to \a anchorLayer, along with its complete
+    /// sublayer stack. Arguments in \a args will be passed to Sdf when
+    /// finding or opening the layers. This is used to warm the layer
+    /// registry with payload layers before a bulk load recomposes the
+    /// affected subtrees.
+    PCP_API
+    void RequestPayloadLayer(
+        const SdfLayerRefPtr &anchorLayer,
+        const std::string &assetPath,
+        const SdfLayer::FileFormatArguments &args);
+
     /// Run the queued requests, returning when complete.
     PCP_API
     void Run(const Pcp_MutedLayers& mutedLayers);
@@ -64,6 +76,11 @@ private:
     typedef std::pair<SdfLayerRefPtr, SdfLayer::FileFormatArguments> _Request;
     std::set<_Request> _sublayerRequests;
 
+    // Payload requests additionally carry the asset path to open
+    // relative to the anchor layer.
+    typedef std::pair<_Request, std::string> _PayloadRequest;
+    std::set<_PayloadRequest> _payloadRequests;
+
     std::set<SdfLayerRefPtr> _retainedLayers;
 };
 
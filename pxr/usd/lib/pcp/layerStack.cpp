@@ -33,6 +33,7 @@
 #include "pxr/usd/sdf/layerUtils.h"
 #include "pxr/usd/sdf/primSpec.h"
 #include "pxr/usd/ar/resolverContextBinder.h"
+#include "pxr/usd/ar/resolverScopedCache.h"
 #include "pxr/base/tracelite/trace.h"
 #include "pxr/base/tf/envSetting.h"
 #include "pxr/base/tf/mallocTag.h"
@@ -50,12 +51,15 @@ PXR_NAMESPACE_OPEN_SCOPE
 ////////////////////////////////////////////////////////////////////////
 // Computing layer stacks
 
-// XXX Parallel layer prefetch is disabled until Sd thread-safety issues
-// can be fixed, specifically plugin loading:
-// - FileFormat plugins
-// - value type plugins for parsing AnimSplines
+// Parallel layer prefetch used to be disabled due to Sd thread-safety
+// issues around plugin loading.  Plug now serializes plugin loads behind
+// its own mutex, and parallel prim indexing already opens layers (via
+// payload inclusion) from multiple threads, so the prefetch pass is held
+// to the same thread-safety requirements as the rest of composition.
+// This setting remains as an escape hatch for misbehaving file format
+// plugins.
 TF_DEFINE_ENV_SETTING(
-    PCP_ENABLE_PARALLEL_LAYER_PREFETCH, false,
+    PCP_ENABLE_PARALLEL_LAYER_PREFETCH, true,
     "Enables parallel, threaded pre-fetch of sublayers.");
 
 struct Pcp_SublayerInfo {
@@ -613,6 +617,11 @@ PcpLayerStack::_Compute(const std::string &targetSchema,
     // Bind the resolver context.
     ArResolverContextBinder binder(_identifier.pathResolverContext);
 
+    // Hold a resolver cache scope across the parallel prefetch and the
+    // serial build below, so sublayer asset paths resolved during the
+    // prefetch are not resolved a second time when stitching the tree.
+    ArResolverScopedCache resolverCache;
+
     // Get any special file format arguments we need to use when finding
     // or opening sublayers.
     const SdfLayer::FileFormatArguments layerArgs =
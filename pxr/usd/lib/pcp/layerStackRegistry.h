@@ -128,10 +128,13 @@ private:
     // computation can easily query whether a layer is muted.
     const Pcp_MutedLayers& _GetMutedLayers() const;
 
-    // PcpLayerStack can access private _GetTargetSchema(), 
+    // PcpLayerStack can access private _GetTargetSchema(),
     // _Remove(), and _SetLayers().
     friend class PcpLayerStack;
 
+    // PcpCache needs _GetMutedLayers() to run layer pre-fetch requests.
+    friend class PcpCache;
+
 private:
     std::unique_ptr<Pcp_LayerStackRegistryData> _data;
 };
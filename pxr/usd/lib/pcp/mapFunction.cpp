@@ -30,7 +30,12 @@
 #include "pxr/base/tf/mallocTag.h"
 #include "pxr/base/tf/staticData.h"
 
+#include <boost/functional/hash.hpp>
+
+#include <tbb/concurrent_hash_map.h>
+
 #include <limits>
+#include <utility>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -371,6 +376,37 @@ PcpMapFunction::MapTargetToSource(const SdfPath & path) const
     return _Map(path, data._pairs, data._numPairs, /* invert */ true);
 }
 
+namespace {
+
+// Memo cache for Compose() results.  Map functions are flyweighted, so a
+// pair of function identities keys a previously-composed result cheaply:
+// equality and hashing are on the interned representation pointers, and
+// holding the functions by value keeps those representations from being
+// recycled out from under the keys.  The cache is never invalidated --
+// map functions are pure values -- and, like the flyweight pool itself,
+// it is bounded by the number of distinct compositions in the scene.
+typedef std::pair<PcpMapFunction, PcpMapFunction> _ComposeCacheKey;
+
+struct _ComposeCacheHashEq
+{
+    static bool equal(const _ComposeCacheKey &lhs,
+                      const _ComposeCacheKey &rhs) {
+        return lhs.first == rhs.first && lhs.second == rhs.second;
+    }
+    static size_t hash(const _ComposeCacheKey &key) {
+        size_t h = key.first.Hash();
+        boost::hash_combine(h, key.second.Hash());
+        return h;
+    }
+};
+
+typedef tbb::concurrent_hash_map<
+    _ComposeCacheKey, PcpMapFunction, _ComposeCacheHashEq> _ComposeCache;
+
+TfStaticData<_ComposeCache> _composeCache;
+
+} // anonymous namespace
+
 PcpMapFunction
 PcpMapFunction::Compose(const PcpMapFunction &inner) const
 {
@@ -384,6 +420,16 @@ PcpMapFunction::Compose(const PcpMapFunction &inner) const
     if (inner.IsIdentity())
         return *this;
 
+    // Deep reference chains re-derive the same compositions once per
+    // prim, so check the memo cache before doing any real work.
+    const _ComposeCacheKey cacheKey(*this, inner);
+    {
+        _ComposeCache::const_accessor accessor;
+        if (_composeCache->find(accessor, cacheKey)) {
+            return accessor->second;
+        }
+    }
+
     // The composition of this function over inner is the result
     // of first applying inner, then this function.  Build a list
     // of all of the (source,target) path pairs that result.
@@ -420,7 +466,16 @@ PcpMapFunction::Compose(const PcpMapFunction &inner) const
 
     _Canonicalize(&pairs);
 
-    return PcpMapFunction(pairs, data_outer._offset * data_inner._offset);
+    PcpMapFunction composed(pairs, data_outer._offset * data_inner._offset);
+
+    {
+        _ComposeCache::accessor accessor;
+        if (_composeCache->insert(accessor, cacheKey)) {
+            accessor->second = composed;
+        }
+    }
+
+    return composed;
 }
 
 PcpMapFunction
@@ -30,6 +30,7 @@
 #include "pxr/usd/sdf/types.h"
 #include "pxr/base/tf/iterator.h"
 #include "pxr/base/tf/hashset.h"
+#include "pxr/base/tf/smallVector.h"
 
 #include <boost/operators.hpp>
 #include <boost/iterator/iterator_facade.hpp>
@@ -309,7 +310,10 @@ hash_value(const PcpNodeRef& x)
 }
 
 typedef TfHashSet<PcpNodeRef, PcpNodeRef::Hash> PcpNodeRefHashSet;
-typedef std::vector<PcpNodeRef> PcpNodeRefVector;
+
+// Most nodes have only a handful of child arcs, so node vectors are
+// kept inline up to that size to avoid heap-allocating them.
+typedef TfSmallVector<PcpNodeRef, 8> PcpNodeRefVector;
 
 /// \class PcpNodeRef_ChildrenIterator
 ///
@@ -2996,6 +2996,19 @@ _EvalImpliedSpecializes(
 ////////////////////////////////////////////////////////////////////////
 // Variants
 
+// Friend to allow the indexing code to use the variant selection memo
+// in the PcpCache.  See cache.h.
+bool
+Pcp_ComposeSiteVariantSelectionWithCache(
+    PcpCache &cache,
+    const PcpLayerStackRefPtr &layerStack,
+    const SdfPath &path,
+    const std::string &vset,
+    std::string *vsel)
+{
+    return cache._ComposeSiteVariantSelection(layerStack, path, vset, vsel);
+}
+
 static bool
 _ComposeVariantSelectionForNode(
     const PcpNodeRef& node,
@@ -3003,6 +3016,7 @@ _ComposeVariantSelectionForNode(
     const std::string & vset,
     std::string *vsel,
     PcpNodeRef *nodeWithVsel,
+    PcpCache *cache,
     PcpPrimIndexOutputs *outputs)
 {
     TF_VERIFY(!pathInNode.IsEmpty());
@@ -3029,8 +3043,15 @@ _ComposeVariantSelectionForNode(
                 node.GetPath());
         }
 
-        if (PcpComposeSiteVariantSelection(
-                site.layerStack, site.path, vset, vsel)) {
+        // Consult the memo in the PcpCache, when one is supplied, so
+        // that sibling prims drawing selections from this site do not
+        // repeat the layer stack walk.
+        const bool foundSelection = cache
+            ? Pcp_ComposeSiteVariantSelectionWithCache(
+                *cache, site.layerStack, site.path, vset, vsel)
+            : PcpComposeSiteVariantSelection(
+                site.layerStack, site.path, vset, vsel);
+        if (foundSelection) {
             *nodeWithVsel = node;
             return true;
         }
@@ -3081,11 +3102,12 @@ _ComposeVariantSelectionAcrossStackFrames(
     std::string *vsel,
     _StackFrameAndChildNodeVector *stackFrames,
     PcpNodeRef *nodeWithVsel,
+    PcpCache *cache,
     PcpPrimIndexOutputs *outputs)
 {
     // Compose variant selection in strong-to-weak order.
     if (_ComposeVariantSelectionForNode(
-            node, pathInNode, vset, vsel, nodeWithVsel, outputs)) {
+            node, pathInNode, vset, vsel, nodeWithVsel, cache, outputs)) {
         return true;
     }
 
@@ -3113,8 +3135,8 @@ _ComposeVariantSelectionAcrossStackFrames(
 
         if (!pathInChildNode.IsEmpty()) {
             return _ComposeVariantSelectionAcrossStackFrames(
-                childNode, pathInChildNode, vset, vsel, stackFrames, 
-                nodeWithVsel, outputs);
+                childNode, pathInChildNode, vset, vsel, stackFrames,
+                nodeWithVsel, cache, outputs);
         }
 
         return false;
@@ -3128,7 +3150,7 @@ _ComposeVariantSelectionAcrossStackFrames(
         if (!pathInChildNode.IsEmpty() &&
             _ComposeVariantSelectionAcrossStackFrames(
                 *child, pathInChildNode, vset, vsel, stackFrames,
-                nodeWithVsel, outputs)) {
+                nodeWithVsel, cache, outputs)) {
             return true;
         }
     }
@@ -3145,6 +3167,7 @@ _ComposeVariantSelection(
     const std::string &vset,
     std::string *vsel,
     PcpNodeRef *nodeWithVsel,
+    PcpCache *cache,
     PcpPrimIndexOutputs *outputs)
 {
     TRACE_FUNCTION();
@@ -3234,7 +3257,7 @@ _ComposeVariantSelection(
     // looking for a variant selection.
     _ComposeVariantSelectionAcrossStackFrames(
         rootNode, pathInRoot, vset, vsel, &previousStackFrames,
-        nodeWithVsel, outputs);
+        nodeWithVsel, cache, outputs);
 }
 
 static bool
@@ -3444,7 +3467,7 @@ _EvalNodeAuthoredVariant(
                              indexer->previousFrame, node,
                              node.GetPath().StripAllVariantSelections(),
                              vset, &vsel, &nodeWithVsel,
-                             indexer->outputs);
+                             indexer->inputs.cache, indexer->outputs);
     if (!vsel.empty()) {
         PCP_INDEXING_MSG(
             indexer, node, "Found variant selection {%s=%s} at %s",
@@ -251,6 +251,7 @@ public:
 
 private:
     friend class PcpPrimIterator;
+    friend class Pcp_PrimIndexCacheFile;
     friend struct Pcp_PrimIndexer;
     friend void Pcp_RescanForSpecs(PcpPrimIndex*, bool usd,
                                    bool updateHasSpecs);
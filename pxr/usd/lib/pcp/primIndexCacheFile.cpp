@@ -0,0 +1,708 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#include "pxr/pxr.h"
+#include "pxr/usd/pcp/primIndexCacheFile.h"
+#include "pxr/usd/pcp/cache.h"
+#include "pxr/usd/pcp/dependencies.h"
+#include "pxr/usd/pcp/layerStack.h"
+#include "pxr/usd/pcp/mapExpression.h"
+#include "pxr/usd/pcp/mapFunction.h"
+#include "pxr/usd/pcp/primIndex.h"
+#include "pxr/usd/pcp/primIndex_Graph.h"
+#include "pxr/usd/pcp/site.h"
+#include "pxr/usd/pcp/types.h"
+
+#include "pxr/usd/ar/resolver.h"
+#include "pxr/usd/ar/resolverContextBinder.h"
+#include "pxr/usd/sdf/layer.h"
+#include "pxr/base/tf/stringUtils.h"
+#include "pxr/base/tracelite/trace.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+// File format constants. Bump _version whenever the record layout changes;
+// importers reject files with a mismatched version outright.
+const char _magic[] = "PcpIdxCache";
+const uint32_t _version = 1;
+
+// Encodings for layer references in the layer stack table. The cache's own
+// root and session layers are recorded symbolically so that an importing
+// process, whose anonymous session layer necessarily has a different
+// identifier, can rebind them.
+enum : uint8_t {
+    _LayerRefNone = 0,
+    _LayerRefIdentifier = 1,
+    _LayerRefCacheRoot = 2,
+    _LayerRefCacheSession = 3
+};
+
+// Encodings for layer signature entries.
+enum : uint8_t {
+    _SignatureAsset = 0,
+    _SignatureEmptySessionLayer = 1
+};
+
+// Encodings for map expressions.
+enum : uint8_t {
+    _MapExprNull = 0,
+    _MapExprIdentity = 1,
+    _MapExprConstant = 2
+};
+
+// Guard against allocating absurd amounts of memory when reading
+// counts from a corrupt file.
+const uint64_t _maxReasonableCount = 1ull << 24;
+
+template <class T>
+void
+_Write(std::ostream& out, const T& value)
+{
+    out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+void
+_WriteBytes(std::ostream& out, const void* data, size_t numBytes)
+{
+    out.write(static_cast<const char*>(data), numBytes);
+}
+
+void
+_WriteString(std::ostream& out, const std::string& s)
+{
+    _Write<uint64_t>(out, s.size());
+    out.write(s.data(), s.size());
+}
+
+void
+_WritePath(std::ostream& out, const SdfPath& path)
+{
+    _WriteString(out, path.GetString());
+}
+
+void
+_WriteMapExpression(std::ostream& out, const PcpMapExpression& expr)
+{
+    if (expr.IsNull()) {
+        _Write<uint8_t>(out, _MapExprNull);
+        return;
+    }
+
+    const PcpMapFunction& fn = expr.Evaluate();
+    if (fn.IsIdentity()) {
+        _Write<uint8_t>(out, _MapExprIdentity);
+        return;
+    }
+
+    _Write<uint8_t>(out, _MapExprConstant);
+    const PcpMapFunction::PathMap pathMap = fn.GetSourceToTargetMap();
+    _Write<uint64_t>(out, pathMap.size());
+    for (const auto& entry : pathMap) {
+        _WritePath(out, entry.first);
+        _WritePath(out, entry.second);
+    }
+    _Write<double>(out, fn.GetTimeOffset().GetOffset());
+    _Write<double>(out, fn.GetTimeOffset().GetScale());
+}
+
+template <class T>
+bool
+_Read(std::istream& in, T* value)
+{
+    in.read(reinterpret_cast<char*>(value), sizeof(*value));
+    return in.good();
+}
+
+bool
+_ReadBytes(std::istream& in, void* data, size_t numBytes)
+{
+    in.read(static_cast<char*>(data), numBytes);
+    return in.good();
+}
+
+bool
+_ReadString(std::istream& in, std::string* s)
+{
+    uint64_t size = 0;
+    if (!_Read(in, &size) || size > _maxReasonableCount) {
+        return false;
+    }
+    s->resize(size);
+    if (size) {
+        in.read(&(*s)[0], size);
+    }
+    return in.good();
+}
+
+bool
+_ReadPath(std::istream& in, SdfPath* path)
+{
+    std::string pathString;
+    if (!_ReadString(in, &pathString)) {
+        return false;
+    }
+    *path = pathString.empty() ? SdfPath() : SdfPath(pathString);
+    return true;
+}
+
+bool
+_ReadMapExpression(std::istream& in, PcpMapExpression* expr)
+{
+    uint8_t type = 0;
+    if (!_Read(in, &type)) {
+        return false;
+    }
+
+    switch (type) {
+    case _MapExprNull:
+        *expr = PcpMapExpression();
+        return true;
+
+    case _MapExprIdentity:
+        *expr = PcpMapExpression::Identity();
+        return true;
+
+    case _MapExprConstant: {
+        uint64_t numPairs = 0;
+        if (!_Read(in, &numPairs) || numPairs > _maxReasonableCount) {
+            return false;
+        }
+        PcpMapFunction::PathMap pathMap;
+        for (uint64_t i = 0; i != numPairs; ++i) {
+            SdfPath source, target;
+            if (!_ReadPath(in, &source) || !_ReadPath(in, &target)) {
+                return false;
+            }
+            pathMap[source] = target;
+        }
+        double offset = 0.0, scale = 1.0;
+        if (!_Read(in, &offset) || !_Read(in, &scale)) {
+            return false;
+        }
+        *expr = PcpMapExpression::Constant(
+            PcpMapFunction::Create(pathMap, SdfLayerOffset(offset, scale)));
+        return true;
+    }
+    }
+
+    return false;
+}
+
+void
+_WriteVariantFallbacks(std::ostream& out, const PcpVariantFallbackMap& map)
+{
+    _Write<uint64_t>(out, map.size());
+    for (const auto& entry : map) {
+        _WriteString(out, entry.first);
+        _Write<uint64_t>(out, entry.second.size());
+        for (const auto& fallback : entry.second) {
+            _WriteString(out, fallback);
+        }
+    }
+}
+
+bool
+_ReadVariantFallbacks(std::istream& in, PcpVariantFallbackMap* map)
+{
+    uint64_t numEntries = 0;
+    if (!_Read(in, &numEntries) || numEntries > _maxReasonableCount) {
+        return false;
+    }
+    for (uint64_t i = 0; i != numEntries; ++i) {
+        std::string name;
+        uint64_t numFallbacks = 0;
+        if (!_ReadString(in, &name) ||
+            !_Read(in, &numFallbacks) ||
+            numFallbacks > _maxReasonableCount) {
+            return false;
+        }
+        std::vector<std::string>& fallbacks = (*map)[name];
+        fallbacks.resize(numFallbacks);
+        for (uint64_t j = 0; j != numFallbacks; ++j) {
+            if (!_ReadString(in, &fallbacks[j])) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+} // anonymous namespace
+
+bool
+Pcp_PrimIndexCacheFile::Write(
+    const PcpCache& cache, const std::string& filePath)
+{
+    TRACE_FUNCTION();
+
+    // Payload decorators can alter indexing results in ways we cannot
+    // revalidate from layer state alone.
+    if (cache.GetPayloadDecorator()) {
+        return false;
+    }
+
+    const PcpLayerStackIdentifier cacheId = cache.GetLayerStackIdentifier();
+    ArResolver& resolver = ArGetResolver();
+    ArResolverContextBinder binder(cacheId.pathResolverContext);
+
+    // Record a signature for every layer that contributed to this cache's
+    // computations. The cache's (anonymous) session layer may participate
+    // only if it is empty, since there is nothing on disk to revalidate
+    // its contents against.
+    std::ostringstream signatureData;
+    uint64_t numSignatures = 0;
+    for (const SdfLayerHandle& layer : cache.GetUsedLayers()) {
+        if (!layer) {
+            continue;
+        }
+        if (layer->IsDirty()) {
+            return false;
+        }
+        if (layer->IsAnonymous()) {
+            if (layer == cacheId.sessionLayer && layer->IsEmpty()) {
+                _Write<uint8_t>(signatureData, _SignatureEmptySessionLayer);
+                ++numSignatures;
+                continue;
+            }
+            return false;
+        }
+
+        const std::string& identifier = layer->GetIdentifier();
+        const std::string& realPath = layer->GetRealPath();
+        const VtValue timestamp =
+            resolver.GetModificationTimestamp(identifier, realPath);
+        if (timestamp.IsEmpty()) {
+            return false;
+        }
+
+        _Write<uint8_t>(signatureData, _SignatureAsset);
+        _WriteString(signatureData, identifier);
+        _WriteString(signatureData, realPath);
+        _WriteString(signatureData, TfStringify(timestamp));
+        ++numSignatures;
+    }
+
+    // Encode a layer handle for the layer stack table, or return false
+    // if it cannot be re-resolved by an importing process.
+    auto encodeLayer = [&cacheId](std::ostream& out,
+                                  const SdfLayerHandle& layer) {
+        if (!layer) {
+            _Write<uint8_t>(out, _LayerRefNone);
+        }
+        else if (layer == cacheId.rootLayer) {
+            _Write<uint8_t>(out, _LayerRefCacheRoot);
+        }
+        else if (layer == cacheId.sessionLayer) {
+            _Write<uint8_t>(out, _LayerRefCacheSession);
+        }
+        else if (layer->IsAnonymous()) {
+            return false;
+        }
+        else {
+            _Write<uint8_t>(out, _LayerRefIdentifier);
+            _WriteString(out, layer->GetIdentifier());
+        }
+        return true;
+    };
+
+    // Serialize the prim index records, building the layer stack table
+    // as layer stacks are first encountered.
+    std::ostringstream tableData;
+    std::ostringstream indexData;
+    std::map<PcpLayerStackRefPtr, uint32_t> layerStackIndexes;
+    uint64_t numIndexes = 0;
+
+    auto getLayerStackIndex = [&](const PcpLayerStackRefPtr& layerStack,
+                                  uint32_t* tableIndex) {
+        auto inserted = layerStackIndexes.emplace(
+            layerStack, static_cast<uint32_t>(layerStackIndexes.size()));
+        *tableIndex = inserted.first->second;
+        if (inserted.second) {
+            const PcpLayerStackIdentifier& id = layerStack->GetIdentifier();
+            if (!encodeLayer(tableData, id.rootLayer) ||
+                !encodeLayer(tableData, id.sessionLayer)) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    for (const auto& entry : cache._primIndexCache) {
+        const PcpPrimIndex& index = entry.second;
+        if (!index.IsValid()) {
+            continue;
+        }
+        // Skip indexes with local composition errors; they are cheap to
+        // recompute and not worth revalidating.
+        if (index._localErrors && !index._localErrors->empty()) {
+            continue;
+        }
+        // Payload inclusion is per-session policy, so indexes that
+        // authored a payload are always recomputed.
+        if (index.HasPayload()) {
+            continue;
+        }
+
+        const PcpPrimIndex_GraphRefPtr& graph = index._graph;
+        const size_t numNodes = graph->_GetNumNodes();
+        if (numNodes == 0 ||
+            numNodes >= PcpPrimIndex_Graph::_Node::_invalidNodeIndex) {
+            continue;
+        }
+
+        std::ostringstream record;
+        _WritePath(record, entry.first);
+        _Write<uint8_t>(record, graph->_data->hasPayload);
+        _Write<uint8_t>(record, graph->_data->instanceable);
+        _Write<uint8_t>(record, graph->_data->finalized);
+        _Write<uint32_t>(record, static_cast<uint32_t>(numNodes));
+
+        bool encoded = true;
+        for (size_t i = 0; i != numNodes && encoded; ++i) {
+            const PcpPrimIndex_Graph::_Node& node = graph->_GetNode(i);
+            uint32_t tableIndex = 0;
+            encoded = getLayerStackIndex(node.layerStack, &tableIndex);
+            _Write<uint32_t>(record, tableIndex);
+            _WriteMapExpression(record, node.mapToRoot);
+            _WriteMapExpression(record, node.mapToParent);
+            _WriteBytes(record, &node.smallInts, sizeof(node.smallInts));
+        }
+        if (!encoded) {
+            return false;
+        }
+
+        for (size_t i = 0; i != numNodes; ++i) {
+            _WritePath(record, graph->_nodeSitePaths[i]);
+        }
+        for (size_t i = 0; i != numNodes; ++i) {
+            _Write<uint8_t>(record, graph->_nodeHasSpecs[i] ? 1 : 0);
+        }
+
+        _Write<uint64_t>(record, index._primStack.size());
+        for (const Pcp_CompressedSdSite& site : index._primStack) {
+            _Write<uint16_t>(record, site.nodeIndex);
+            _Write<uint16_t>(record, site.layerIndex);
+        }
+
+        const std::string recordString = record.str();
+        indexData.write(recordString.data(), recordString.size());
+        ++numIndexes;
+    }
+
+    // Assemble the file.
+    std::ofstream out(filePath.c_str(),
+                      std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!out) {
+        return false;
+    }
+
+    out.write(_magic, sizeof(_magic));
+    _Write<uint32_t>(out, _version);
+    _Write<uint32_t>(
+        out, sizeof(PcpPrimIndex_Graph::_Node::_SmallInts));
+    _Write<uint8_t>(out, cache.IsUsd() ? 1 : 0);
+    _WriteString(out, cache.GetTargetSchema());
+    _WriteVariantFallbacks(out, cache.GetVariantFallbacks());
+
+    _Write<uint64_t>(out, numSignatures);
+    const std::string signatureString = signatureData.str();
+    out.write(signatureString.data(), signatureString.size());
+
+    _Write<uint32_t>(out, static_cast<uint32_t>(layerStackIndexes.size()));
+    const std::string tableString = tableData.str();
+    out.write(tableString.data(), tableString.size());
+
+    _Write<uint64_t>(out, numIndexes);
+    const std::string indexString = indexData.str();
+    out.write(indexString.data(), indexString.size());
+
+    return out.good();
+}
+
+bool
+Pcp_PrimIndexCacheFile::Read(
+    PcpCache* cache, const std::string& filePath, PcpErrorVector* allErrors)
+{
+    TRACE_FUNCTION();
+
+    std::ifstream in(filePath.c_str(), std::ios::in | std::ios::binary);
+    if (!in) {
+        return false;
+    }
+
+    // Header and configuration checks.
+    char magic[sizeof(_magic)] = { 0 };
+    uint32_t version = 0, smallIntsSize = 0;
+    uint8_t usdFlag = 0;
+    std::string targetSchema;
+    PcpVariantFallbackMap variantFallbacks;
+    if (!_ReadBytes(in, magic, sizeof(magic)) ||
+        memcmp(magic, _magic, sizeof(_magic)) != 0 ||
+        !_Read(in, &version) || version != _version ||
+        !_Read(in, &smallIntsSize) ||
+        smallIntsSize != sizeof(PcpPrimIndex_Graph::_Node::_SmallInts) ||
+        !_Read(in, &usdFlag) ||
+        !_ReadString(in, &targetSchema) ||
+        !_ReadVariantFallbacks(in, &variantFallbacks)) {
+        return false;
+    }
+    if ((usdFlag != 0) != cache->IsUsd() ||
+        targetSchema != cache->GetTargetSchema() ||
+        variantFallbacks != cache->GetVariantFallbacks()) {
+        return false;
+    }
+
+    const PcpLayerStackIdentifier cacheId = cache->GetLayerStackIdentifier();
+    ArResolver& resolver = ArGetResolver();
+    ArResolverContextBinder binder(cacheId.pathResolverContext);
+
+    // Revalidate the recorded layer signatures against current asset state.
+    uint64_t numSignatures = 0;
+    if (!_Read(in, &numSignatures) || numSignatures > _maxReasonableCount) {
+        return false;
+    }
+    for (uint64_t i = 0; i != numSignatures; ++i) {
+        uint8_t type = 0;
+        if (!_Read(in, &type)) {
+            return false;
+        }
+        if (type == _SignatureEmptySessionLayer) {
+            if (!cacheId.sessionLayer || !cacheId.sessionLayer->IsEmpty()) {
+                return false;
+            }
+            continue;
+        }
+        if (type != _SignatureAsset) {
+            return false;
+        }
+
+        std::string identifier, realPath, timestamp;
+        if (!_ReadString(in, &identifier) ||
+            !_ReadString(in, &realPath) ||
+            !_ReadString(in, &timestamp)) {
+            return false;
+        }
+        if (resolver.Resolve(identifier) != realPath) {
+            return false;
+        }
+        const VtValue currentTimestamp =
+            resolver.GetModificationTimestamp(identifier, realPath);
+        if (currentTimestamp.IsEmpty() ||
+            TfStringify(currentTimestamp) != timestamp) {
+            return false;
+        }
+        // If the layer is already open with unsaved edits, the on-disk
+        // timestamp no longer describes the opinions we would compose.
+        if (SdfLayerHandle layer = SdfLayer::Find(identifier)) {
+            if (layer->IsDirty()) {
+                return false;
+            }
+        }
+    }
+
+    // Rebuild the layer stack table.
+    uint32_t numLayerStacks = 0;
+    if (!_Read(in, &numLayerStacks) || numLayerStacks > _maxReasonableCount) {
+        return false;
+    }
+
+    // Hold opened layers by ref so they survive until their layer stacks
+    // take ownership.
+    std::vector<SdfLayerRefPtr> openedLayers;
+    auto decodeLayer = [&](SdfLayerHandle* layer) {
+        uint8_t type = 0;
+        if (!_Read(in, &type)) {
+            return false;
+        }
+        switch (type) {
+        case _LayerRefNone:
+            *layer = TfNullPtr;
+            return true;
+        case _LayerRefCacheRoot:
+            *layer = cacheId.rootLayer;
+            return bool(*layer);
+        case _LayerRefCacheSession:
+            *layer = cacheId.sessionLayer;
+            return bool(*layer);
+        case _LayerRefIdentifier: {
+            std::string identifier;
+            if (!_ReadString(in, &identifier)) {
+                return false;
+            }
+            SdfLayerRefPtr opened = SdfLayer::FindOrOpen(identifier);
+            if (!opened) {
+                return false;
+            }
+            openedLayers.push_back(opened);
+            *layer = opened;
+            return true;
+        }
+        }
+        return false;
+    };
+
+    std::vector<PcpLayerStackRefPtr> layerStacks;
+    layerStacks.reserve(numLayerStacks);
+    for (uint32_t i = 0; i != numLayerStacks; ++i) {
+        SdfLayerHandle rootLayer, sessionLayer;
+        if (!decodeLayer(&rootLayer) || !decodeLayer(&sessionLayer)) {
+            return false;
+        }
+        const PcpLayerStackRefPtr layerStack = cache->ComputeLayerStack(
+            PcpLayerStackIdentifier(
+                rootLayer, sessionLayer, cacheId.pathResolverContext),
+            allErrors);
+        if (!layerStack) {
+            return false;
+        }
+        layerStacks.push_back(layerStack);
+    }
+
+    // Read and rebuild the prim index records. Everything is staged in a
+    // local vector so a malformed record cannot leave the cache partially
+    // populated.
+    uint64_t numIndexes = 0;
+    if (!_Read(in, &numIndexes) || numIndexes > _maxReasonableCount) {
+        return false;
+    }
+
+    std::vector<std::pair<SdfPath, PcpPrimIndex>> importedIndexes;
+    importedIndexes.resize(numIndexes);
+    for (uint64_t recordNum = 0; recordNum != numIndexes; ++recordNum) {
+        SdfPath path;
+        uint8_t hasPayload = 0, instanceable = 0, finalized = 0;
+        uint32_t numNodes = 0;
+        if (!_ReadPath(in, &path) || path.IsEmpty() ||
+            !_Read(in, &hasPayload) ||
+            !_Read(in, &instanceable) ||
+            !_Read(in, &finalized) ||
+            !_Read(in, &numNodes) ||
+            numNodes == 0 ||
+            numNodes >= PcpPrimIndex_Graph::_Node::_invalidNodeIndex) {
+            return false;
+        }
+
+        std::vector<uint32_t> nodeLayerStacks(numNodes);
+        std::vector<PcpMapExpression> mapsToRoot(numNodes);
+        std::vector<PcpMapExpression> mapsToParent(numNodes);
+        std::vector<char> smallInts(
+            numNodes * sizeof(PcpPrimIndex_Graph::_Node::_SmallInts));
+        for (uint32_t i = 0; i != numNodes; ++i) {
+            if (!_Read(in, &nodeLayerStacks[i]) ||
+                nodeLayerStacks[i] >= layerStacks.size() ||
+                !_ReadMapExpression(in, &mapsToRoot[i]) ||
+                !_ReadMapExpression(in, &mapsToParent[i]) ||
+                !_ReadBytes(
+                    in,
+                    &smallInts[i *
+                        sizeof(PcpPrimIndex_Graph::_Node::_SmallInts)],
+                    sizeof(PcpPrimIndex_Graph::_Node::_SmallInts))) {
+                return false;
+            }
+        }
+
+        std::vector<SdfPath> sitePaths(numNodes);
+        for (uint32_t i = 0; i != numNodes; ++i) {
+            if (!_ReadPath(in, &sitePaths[i])) {
+                return false;
+            }
+        }
+        std::vector<bool> hasSpecs(numNodes);
+        for (uint32_t i = 0; i != numNodes; ++i) {
+            uint8_t flag = 0;
+            if (!_Read(in, &flag)) {
+                return false;
+            }
+            hasSpecs[i] = (flag != 0);
+        }
+
+        uint64_t primStackSize = 0;
+        if (!_Read(in, &primStackSize) ||
+            primStackSize > _maxReasonableCount) {
+            return false;
+        }
+        Pcp_CompressedSdSiteVector primStack;
+        primStack.reserve(primStackSize);
+        for (uint64_t i = 0; i != primStackSize; ++i) {
+            uint16_t nodeIndex = 0, layerIndex = 0;
+            if (!_Read(in, &nodeIndex) || !_Read(in, &layerIndex)) {
+                return false;
+            }
+            primStack.push_back(Pcp_CompressedSdSite(nodeIndex, layerIndex));
+        }
+
+        // Reconstitute the graph.
+        PcpPrimIndex_GraphRefPtr graph = PcpPrimIndex_Graph::New(
+            PcpLayerStackSite(layerStacks[nodeLayerStacks[0]], sitePaths[0]),
+            cache->IsUsd());
+        graph->_data->nodes.resize(numNodes);
+        for (uint32_t i = 0; i != numNodes; ++i) {
+            PcpPrimIndex_Graph::_Node& node = graph->_data->nodes[i];
+            node.layerStack = layerStacks[nodeLayerStacks[i]];
+            node.mapToRoot = mapsToRoot[i];
+            node.mapToParent = mapsToParent[i];
+            memcpy(&node.smallInts,
+                   &smallInts[i *
+                       sizeof(PcpPrimIndex_Graph::_Node::_SmallInts)],
+                   sizeof(node.smallInts));
+        }
+        graph->_data->hasPayload = hasPayload;
+        graph->_data->instanceable = instanceable;
+        graph->_data->finalized = finalized;
+        graph->_nodeSitePaths.swap(sitePaths);
+        graph->_nodeHasSpecs.swap(hasSpecs);
+
+        PcpPrimIndex index;
+        index.SetGraph(graph);
+        index._primStack.swap(primStack);
+
+        importedIndexes[recordNum].first = path;
+        importedIndexes[recordNum].second.Swap(index);
+    }
+
+    // Commit the staged indexes, registering dependencies exactly as
+    // _ComputePrimIndexWithCompatibleInputs does for freshly-computed
+    // indexes. Existing valid entries are left alone.
+    for (auto& imported : importedIndexes) {
+        PcpPrimIndex& cacheEntry = cache->_primIndexCache[imported.first];
+        if (cacheEntry.IsValid()) {
+            continue;
+        }
+        cache->_primDependencies->Add(imported.second);
+        cacheEntry.Swap(imported.second);
+    }
+
+    return true;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,74 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef PCP_PRIM_INDEX_CACHE_FILE_H
+#define PCP_PRIM_INDEX_CACHE_FILE_H
+
+#include "pxr/pxr.h"
+#include "pxr/usd/pcp/errors.h"
+
+#include <string>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+class PcpCache;
+
+/// \class Pcp_PrimIndexCacheFile
+///
+/// Reads and writes the binary prim index cache files behind
+/// PcpCache::ExportPrimIndexCache() and PcpCache::ImportPrimIndexCache().
+///
+/// A cache file records a PcpCache's computed prim indexes along with
+/// signatures -- resolved paths and modification timestamps -- for every
+/// layer that contributed to them.  On import the signatures are
+/// revalidated against the current state of the assets; if any
+/// contributing layer has changed, the entire file is rejected and the
+/// importing cache is left untouched.
+///
+/// The format depends on the host architecture and build, and is meant
+/// as a transient warm-start cache, not an archival interchange format.
+///
+class Pcp_PrimIndexCacheFile
+{
+public:
+    /// Writes \p cache's computed prim indexes to \p filePath.
+    /// Returns false without writing a usable file if the cache's
+    /// results could not be revalidated from disk state on a subsequent
+    /// import -- for example, if any contributing layer is dirty or
+    /// anonymous, or if the cache uses a payload decorator.
+    static bool Write(const PcpCache& cache, const std::string& filePath);
+
+    /// Reads prim indexes from \p filePath into \p cache.  Returns false
+    /// without importing any prim indexes if the file is missing or
+    /// malformed, was written by an incompatible build or
+    /// differently-configured cache, or if any recorded layer signature
+    /// no longer matches.
+    /// Errors encountered while rebuilding layer stacks are appended to
+    /// \p allErrors.
+    static bool Read(PcpCache* cache, const std::string& filePath,
+                     PcpErrorVector* allErrors);
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PCP_PRIM_INDEX_CACHE_FILE_H
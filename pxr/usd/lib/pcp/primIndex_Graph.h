@@ -239,6 +239,10 @@ private:
     // Allow Pcp_Statistics access to internal data for diagnostics.
     friend class Pcp_Statistics;
 
+    // Allow the prim index cache file reader/writer to serialize and
+    // reconstitute the node pool directly.
+    friend class Pcp_PrimIndexCacheFile;
+
     struct _Node {
         static const size_t _nodeIndexSize = 15;
         static const size_t _childrenSize  = 10;
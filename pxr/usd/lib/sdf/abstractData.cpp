@@ -428,6 +428,69 @@ SdfAbstractData::ListDictKeys(const SdfAbstractDataSpecId& id,
     return result;
 }
 
+const VtValue*
+SdfAbstractData::GetFieldRef(const SdfAbstractDataSpecId& id,
+                             const TfToken& fieldName) const
+{
+    return NULL;
+}
+
+namespace
+{
+
+// Default stream implementation built on ListTimeSamplesForPath() and
+// QueryTimeSample().  Each sample value is copied into a value owned by
+// the stream, whose storage is reused from sample to sample.
+class _FallbackTimeSampleStream : public SdfAbstractDataTimeSampleStream
+{
+public:
+    _FallbackTimeSampleStream(const SdfAbstractData& data,
+                              const SdfAbstractDataSpecId& id)
+        : _data(data)
+        , _path(id.GetFullSpecPath())
+        , _times(data.ListTimeSamplesForPath(id))
+        , _curTime(_times.begin())
+    {
+    }
+
+    virtual bool Next(double* time, const VtValue** value)
+    {
+        while (_curTime != _times.end()) {
+            const double t = *_curTime++;
+            if (_data.QueryTimeSample(
+                    SdfAbstractDataSpecId(&_path), t, &_value)) {
+                *time = t;
+                *value = &_value;
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    const SdfAbstractData& _data;
+    const SdfPath _path;
+    const std::set<double> _times;
+    std::set<double>::const_iterator _curTime;
+    VtValue _value;
+};
+
+} // end anonymous namespace
+
+SdfAbstractDataTimeSampleStream::~SdfAbstractDataTimeSampleStream()
+{
+}
+
+std::unique_ptr<SdfAbstractDataTimeSampleStream>
+SdfAbstractData::OpenTimeSampleStream(const SdfAbstractDataSpecId& id) const
+{
+    if (GetNumTimeSamplesForPath(id) == 0) {
+        return std::unique_ptr<SdfAbstractDataTimeSampleStream>();
+    }
+    return std::unique_ptr<SdfAbstractDataTimeSampleStream>(
+        new _FallbackTimeSampleStream(*this, id));
+}
+
 
 ////////////////////////////////////////////////////////////
 
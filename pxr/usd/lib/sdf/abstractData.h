@@ -37,6 +37,7 @@
 #include "pxr/base/tf/declarePtrs.h"
 
 #include <boost/optional.hpp>
+#include <memory>
 #include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -46,6 +47,33 @@ class SdfAbstractDataSpecVisitor;
 class SdfAbstractDataConstValue;
 class SdfAbstractDataValue;
 
+/// \class SdfAbstractDataTimeSampleStream
+///
+/// A cursor over the time samples authored for a single property in an
+/// SdfAbstractData object, ordered by increasing time.  Obtained from
+/// SdfAbstractData::OpenTimeSampleStream().
+///
+/// Implementations hand out sample values by reference into the underlying
+/// storage where possible, so iterating does not box a new VtValue per
+/// sample.  A stream is only valid as long as the originating data object
+/// is alive and its time samples are not mutated; callers must drain or
+/// discard the stream before authoring time samples.
+///
+class SdfAbstractDataTimeSampleStream
+{
+public:
+    SDF_API
+    virtual ~SdfAbstractDataTimeSampleStream();
+
+    /// Advance to the next time sample, filling \p time with its time and
+    /// \p value with a pointer to its value.  Returns false when the
+    /// samples are exhausted, leaving \p time and \p value untouched.
+    ///
+    /// The returned value pointer is valid only until the next call to
+    /// Next() or the destruction of the stream, whichever comes first.
+    virtual bool Next(double* time, const VtValue** value) = 0;
+};
+
 
 #define SDF_DATA_TOKENS                  \
         ((TimeSamples, "timeSamples"))
@@ -240,9 +268,21 @@ public:
     /// Return the value for the given \a id and \a fieldName. Returns an
     /// empty value if none is set.
     SDF_API
-    virtual VtValue Get(const SdfAbstractDataSpecId& id, 
+    virtual VtValue Get(const SdfAbstractDataSpecId& id,
                         const TfToken& fieldName) const = 0;
 
+    /// Return a pointer to the stored value for the given \a id and
+    /// \a fieldName, or NULL if no value is set or this object's storage
+    /// cannot expose a stable reference to it. A NULL return therefore
+    /// does not imply the field is absent; callers must fall back to
+    /// Has() or Get(). The pointer is valid until this object is next
+    /// mutated.
+    ///
+    /// The default implementation always returns NULL.
+    SDF_API
+    virtual const VtValue* GetFieldRef(const SdfAbstractDataSpecId& id,
+                                       const TfToken& fieldName) const;
+
     /// Set the value of the given \a id and \a fieldName.
     ///
     /// It's an error to set a field on a spec that does not exist. Setting a
@@ -368,6 +408,20 @@ public:
                                     double time,
                                     double* tLower, double* tUpper) const = 0;
 
+    /// Open a stream over the time samples authored for the property
+    /// identified by \p id, ordered by increasing time.  Returns a null
+    /// pointer if no time samples are authored for \p id.
+    ///
+    /// Implementations avoid copying a VtValue per sample where their
+    /// underlying storage permits.  See SdfAbstractDataTimeSampleStream
+    /// for the validity requirements on the returned stream.
+    ///
+    /// The default implementation is built on ListTimeSamplesForPath()
+    /// and QueryTimeSample() and copies each sample value.
+    SDF_API
+    virtual std::unique_ptr<SdfAbstractDataTimeSampleStream>
+    OpenTimeSampleStream(const SdfAbstractDataSpecId& id) const;
+
     SDF_API
     virtual bool
     QueryTimeSample(const SdfAbstractDataSpecId& id, double time,
@@ -187,6 +187,12 @@ SdfChangeList::DidChangeInfo(const SdfPath & path, const TfToken & key,
     if (insertStatus.second) {
         changeEntry.first = oldVal;
     }
+    else if (changeEntry.first == newVal) {
+        // The value has been restored to what it was when this round of
+        // change processing began; the net change is a no-op.
+        GetEntry(path).infoChanged.erase(insertStatus.first);
+        return;
+    }
     changeEntry.second = newVal;
 }
 
@@ -270,10 +276,68 @@ SdfChangeList::DidAddPrim(const SdfPath &path, bool inert)
 void
 SdfChangeList::DidRemovePrim(const SdfPath &path, bool inert)
 {
-    if (inert)
-        GetEntry(path).flags.didRemoveInertPrim = true;
-    else
-        GetEntry(path).flags.didRemoveNonInertPrim = true;
+    Entry &entry = GetEntry(path);
+
+    // If the spec was added earlier in this same round of change
+    // processing, the add and this remove cancel out; downstream
+    // consumers would otherwise process both edits only to find no net
+    // change.
+    if (entry.flags.didAddInertPrim || entry.flags.didAddNonInertPrim) {
+        if (entry.flags.didRemoveInertPrim ||
+            entry.flags.didRemoveNonInertPrim) {
+            // The spec also existed before this round; the net effect
+            // is that original removal.
+            Entry collapsed;
+            collapsed.flags.didRemoveInertPrim =
+                entry.flags.didRemoveInertPrim;
+            collapsed.flags.didRemoveNonInertPrim =
+                entry.flags.didRemoveNonInertPrim;
+            entry = collapsed;
+        } else {
+            _entries.erase(path);
+        }
+        _PruneDescendantEntries(path);
+        return;
+    }
+
+    if (inert) {
+        entry.flags.didRemoveInertPrim = true;
+    } else {
+        entry.flags.didRemoveNonInertPrim = true;
+        // The entire subtree is going away; non-structural hints
+        // accumulated beneath it are subsumed by this removal.
+        _PruneDescendantEntries(path);
+    }
+}
+
+void
+SdfChangeList::_PruneDescendantEntries(const SdfPath &parentPath)
+{
+    // Paths prefixed by parentPath form a contiguous run in the
+    // lexicographically ordered entry map, starting just past the parent
+    // itself.  Drop the ones that carry only non-structural hints
+    // (info/field changes, reorders, connection edits, etc.); keep
+    // add/remove/rename records, which other consumers may still need to
+    // see even when an ancestor is removed.
+    EntryList::iterator it = _entries.upper_bound(parentPath);
+    while (it != _entries.end() && it->first.HasPrefix(parentPath)) {
+        const Entry &entry = it->second;
+        const Entry::_Flags &flags = entry.flags;
+        const bool structural =
+            flags.didRename ||
+            flags.didAddInertPrim || flags.didAddNonInertPrim ||
+            flags.didRemoveInertPrim || flags.didRemoveNonInertPrim ||
+            flags.didAddProperty ||
+            flags.didAddPropertyWithOnlyRequiredFields ||
+            flags.didRemoveProperty ||
+            flags.didRemovePropertyWithOnlyRequiredFields ||
+            !entry.oldPath.IsEmpty();
+        if (structural) {
+            ++it;
+        } else {
+            it = _entries.erase(it);
+        }
+    }
 }
 
 void
@@ -332,10 +396,30 @@ SdfChangeList::DidAddProperty(const SdfPath &path, bool hasOnlyRequiredFields)
 void
 SdfChangeList::DidRemoveProperty(const SdfPath &path, bool hasOnlyRequiredFields)
 {
+    Entry &entry = GetEntry(path);
+
+    // As with prims, an add and remove of the same property within one
+    // round of change processing cancel out.
+    if (entry.flags.didAddProperty ||
+        entry.flags.didAddPropertyWithOnlyRequiredFields) {
+        if (entry.flags.didRemoveProperty ||
+            entry.flags.didRemovePropertyWithOnlyRequiredFields) {
+            Entry collapsed;
+            collapsed.flags.didRemoveProperty =
+                entry.flags.didRemoveProperty;
+            collapsed.flags.didRemovePropertyWithOnlyRequiredFields =
+                entry.flags.didRemovePropertyWithOnlyRequiredFields;
+            entry = collapsed;
+        } else {
+            _entries.erase(path);
+        }
+        return;
+    }
+
     if (hasOnlyRequiredFields)
-        GetEntry(path).flags.didRemovePropertyWithOnlyRequiredFields = true;
+        entry.flags.didRemovePropertyWithOnlyRequiredFields = true;
     else
-        GetEntry(path).flags.didRemoveProperty = true;
+        entry.flags.didRemoveProperty = true;
 }
 
 void
@@ -179,6 +179,11 @@ public:
     Entry& GetEntry( const SdfPath & );
 
 private:
+    // Erase accumulated entries for paths beneath \p parentPath that carry
+    // no structural (add/remove/rename) changes; used to drop hints that
+    // are subsumed when the subtree at \p parentPath is removed.
+    void _PruneDescendantEntries(const SdfPath &parentPath);
+
     EntryList _entries;
 };
 
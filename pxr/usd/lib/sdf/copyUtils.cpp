@@ -33,8 +33,11 @@
 
 #include "pxr/base/tf/token.h"
 #include "pxr/base/vt/value.h"
+#include "pxr/base/work/arenaDispatcher.h"
 
+#include <atomic>
 #include <deque>
+#include <memory>
 #include <utility>
 #include <vector>
 
@@ -48,6 +51,8 @@ namespace {
         SdfPath srcPath;
         SdfPath dstPath;
 
+        _CopyStackEntry() = default;
+
         _CopyStackEntry(const SdfPath& srcPath, const SdfPath& dstPath) :
             srcPath(srcPath), dstPath(dstPath) { };
     };
@@ -77,6 +82,17 @@ namespace {
 
     typedef std::vector<_SpecDataEntry> _CopyEntryList;
 
+    // Node in the tree of specs being gathered for copying.  Each node
+    // records the copy request it was created for, the data gathered for
+    // that spec, and its child requests in discovery order, so the tree
+    // can be flattened back into the same order a serial traversal would
+    // have produced.
+    struct _CopyTreeNode {
+        _CopyStackEntry request;
+        std::unique_ptr<_SpecDataEntry> data;
+        std::vector<std::unique_ptr<_CopyTreeNode>> children;
+    };
+
 } // end anonymous namespace
 
 // Returns lists of value and children field names to be handled during
@@ -487,7 +503,98 @@ _ForEachField(
     }
 }
 
-bool 
+// Gather the data to be copied for the spec identified by node->request,
+// then create child nodes for any children specs that also need to be
+// copied and fan their gathering out across the given dispatcher.  This
+// only reads from the source and destination layers; no layer is modified
+// here.  If an error is encountered, \p hadError is set and gathering of
+// the affected subtree stops.
+static void
+_GatherSpecDataToCopy(
+    _CopyTreeNode* node,
+    const SdfLayerHandle& srcLayer,
+    const SdfLayerHandle& dstLayer,
+    const SdfShouldCopyValueFn& shouldCopyValueFn,
+    const SdfShouldCopyChildrenFn& shouldCopyChildrenFn,
+    WorkArenaDispatcher* dispatcher,
+    std::atomic<bool>* hadError)
+{
+    const _CopyStackEntry& toCopy = node->request;
+
+    // If the source path is empty, it indicates that the spec at the
+    // destination path should be removed. Add an entry to reflect that.
+    if (toCopy.srcPath.IsEmpty()) {
+        node->data.reset(
+            new _SpecDataEntry(toCopy.dstPath, SdfSpecTypeUnknown));
+        return;
+    }
+
+    // Figure out the concrete type of the spec we're copying. The spec type
+    // dictates copying behavior below.
+    const SdfSpecType specType = srcLayer->GetSpecType(toCopy.srcPath);
+    if (specType == SdfSpecTypeUnknown) {
+        TF_CODING_ERROR("Cannot copy unknown spec at <%s> from layer <%s>",
+            toCopy.srcPath.GetText(), srcLayer->GetIdentifier().c_str());
+        hadError->store(true);
+        return;
+    }
+
+    node->data.reset(new _SpecDataEntry(toCopy.dstPath, specType));
+
+    // Determine what data is present for the current source and dest specs
+    // and what needs to be copied. Divide the present fields into those
+    // that contain values and those that index children specs.
+    std::vector<TfToken> dstValueFields;
+    std::vector<TfToken> dstChildrenFields;
+    _GetFieldNames(
+        dstLayer, toCopy.dstPath, &dstValueFields, &dstChildrenFields);
+
+    std::vector<TfToken> srcValueFields;
+    std::vector<TfToken> srcChildrenFields;
+    _GetFieldNames(
+        srcLayer, toCopy.srcPath, &srcValueFields, &srcChildrenFields);
+
+    // From the list of value fields, retrieve all values that the copy
+    // policy says we need to copy over to the destination.
+    _ForEachField(
+        srcValueFields, dstValueFields,
+        [&](const TfToken& field, bool fieldInSrc, bool fieldInDst) {
+            _AddFieldValueToCopy(
+                specType, field,
+                srcLayer, toCopy.srcPath, fieldInSrc,
+                dstLayer, toCopy.dstPath, fieldInDst,
+                shouldCopyValueFn, &node->data->dataToCopy);
+        });
+
+    // Collect the children specs that need to be copied, then gather each
+    // of them as a separate task.  Children are recorded in the same order
+    // the serial traversal would have visited them so the tree can later
+    // be flattened back to that order.
+    _CopyStack childRequests;
+    _ForEachField(
+        srcChildrenFields, dstChildrenFields,
+        [&](const TfToken& field, bool fieldInSrc, bool fieldInDst) {
+            _ProcessChildField(
+                field,
+                srcLayer, toCopy.srcPath, fieldInSrc,
+                dstLayer, toCopy.dstPath, fieldInDst,
+                shouldCopyChildrenFn, &childRequests);
+        });
+
+    node->children.reserve(childRequests.size());
+    for (_CopyStackEntry& childRequest : childRequests) {
+        node->children.emplace_back(new _CopyTreeNode);
+        node->children.back()->request = std::move(childRequest);
+    }
+
+    for (const std::unique_ptr<_CopyTreeNode>& child : node->children) {
+        dispatcher->Run(
+            &_GatherSpecDataToCopy, child.get(), srcLayer, dstLayer,
+            shouldCopyValueFn, shouldCopyChildrenFn, dispatcher, hadError);
+    }
+}
+
+bool
 SdfCopySpec(
     const SdfLayerHandle& srcLayer, const SdfPath& srcPath,
     const SdfLayerHandle& dstLayer, const SdfPath& dstPath,
@@ -525,81 +632,41 @@ SdfCopySpec(
         return false;
     }
 
-    // This function collects all of the data that will be copied for each
-    // spec into this list, then applies it to the layer at the very end.
-    // This allows us to do some analysis on the data first.
-    _CopyEntryList dataToCopy;
-
-    // Create a stack of source/dest copy requests, initially populated with
-    // the passed parameters.  The copy routine will add additional requests
-    // as needed to handle children etc... and runs until the stack is empty.
-    _CopyStack copyStack(1, _CopyStackEntry(srcPath, dstPath));
-    while (!copyStack.empty()) {
-        const _CopyStackEntry toCopy = copyStack.front();
-        copyStack.pop_front();
-
-        // If the source path is empty, it indicates that the spec at the
-        // destination path should be removed. Add an entry to the queue
-        // to reflect that.
-        if (toCopy.srcPath.IsEmpty()) {
-            _SpecDataEntry removeEntry(toCopy.dstPath, SdfSpecTypeUnknown);
-            dataToCopy.push_back(removeEntry);
-            continue;
-        }
+    // Gather all of the data that will be copied for each spec before
+    // applying any of it to the destination layer.  This allows us to do
+    // some analysis on the data first, and since gathering only reads from
+    // the layers, it can fan out across threads: each spec is gathered as
+    // its own dispatcher task, spawning further tasks for its children.
+    _CopyTreeNode root;
+    root.request = _CopyStackEntry(srcPath, dstPath);
+
+    std::atomic<bool> hadError(false);
+    WorkArenaDispatcher dispatcher;
+    dispatcher.Run(
+        &_GatherSpecDataToCopy, &root, srcLayer, dstLayer,
+        shouldCopyValueFn, shouldCopyChildrenFn, &dispatcher, &hadError);
+    dispatcher.Wait();
+
+    if (hadError) {
+        return false;
+    }
 
-        // Figure out the concrete type of the spec we're copying. The spec type
-        // dictates copying behavior below.
-        const SdfSpecType specType = srcLayer->GetSpecType(toCopy.srcPath);
-        if (specType == SdfSpecTypeUnknown) {
-            TF_CODING_ERROR("Cannot copy unknown spec at <%s> from layer <%s>",
-                srcPath.GetText(), srcLayer->GetIdentifier().c_str());
-            return false;
+    // Flatten the gathered tree breadth-first so that the data is applied
+    // to the destination layer in the same order a serial traversal using
+    // a copy stack would have produced.
+    _CopyEntryList dataToCopy;
+    std::deque<_CopyTreeNode*> flattenQueue(1, &root);
+    while (!flattenQueue.empty()) {
+        _CopyTreeNode* node = flattenQueue.front();
+        flattenQueue.pop_front();
+
+        dataToCopy.push_back(std::move(*node->data));
+        for (const std::unique_ptr<_CopyTreeNode>& child : node->children) {
+            flattenQueue.push_back(child.get());
         }
+    }
 
-        _SpecDataEntry copyEntry(toCopy.dstPath, specType);
-
-        // Determine what data is present for the current source and dest specs
-        // and what needs to be copied. Divide the present fields into those
-        // that contain values and those that index children specs.
-        std::vector<TfToken> dstValueFields;
-        std::vector<TfToken> dstChildrenFields;
-        _GetFieldNames(
-            dstLayer, toCopy.dstPath, &dstValueFields, &dstChildrenFields);
-
-        std::vector<TfToken> srcValueFields;
-        std::vector<TfToken> srcChildrenFields;
-        _GetFieldNames(
-            srcLayer, toCopy.srcPath, &srcValueFields, &srcChildrenFields);
-
-        // From the list of value fields, retrieve all values that the copy
-        // policy says we need to copy over to the destination.
-        _ForEachField(
-            srcValueFields, dstValueFields,
-            [&](const TfToken& field, bool fieldInSrc, bool fieldInDst) {
-                _AddFieldValueToCopy(
-                    specType, field, 
-                    srcLayer, toCopy.srcPath, fieldInSrc,
-                    dstLayer, toCopy.dstPath, fieldInDst,
-                    shouldCopyValueFn, &copyEntry.dataToCopy);
-            });
-    
-        // Add an entry for all of the data we're copying for this spec.
-        dataToCopy.push_back(copyEntry);
-
-        // Now add any children specs that need to be copied to our
-        // copy stack.
-        _ForEachField(
-            srcChildrenFields, dstChildrenFields,
-            [&](const TfToken& field, bool fieldInSrc, bool fieldInDst) {
-                _ProcessChildField(
-                    field,
-                    srcLayer, toCopy.srcPath, fieldInSrc,
-                    dstLayer, toCopy.dstPath, fieldInDst,
-                    shouldCopyChildrenFn, &copyStack);
-            });
-    }
-
-    // Now that we have all the data we want to copy, set it into the 
+    // Now that we have all the data we want to copy, set it into the
     // destination layer.
     SdfChangeBlock block;
 
@@ -616,7 +683,7 @@ SdfCopySpec(
                 specData.dstPath, fieldValue.first, fieldValue.second);
         }
     }
-    
+
     return true;
 }
 
@@ -138,8 +138,14 @@ using SdfShouldCopyChildrenFn = std::function<
 /// made; client code should arrange for relationship targets and connections to
 /// be specified as prepended, appended, deleted, and/or ordered, as needed.
 ///
+/// The data to be copied is gathered from the source and destination layers
+/// concurrently across child specs, so \p shouldCopyValueFn and
+/// \p shouldCopyChildrenFn may be invoked from multiple threads and must be
+/// safe to call concurrently.  All modifications to \p destLayer are still
+/// made serially, after gathering completes.
+///
 SDF_API
-bool 
+bool
 SdfCopySpec(
     const SdfLayerHandle& srcLayer, const SdfPath& srcPath,
     const SdfLayerHandle& dstLayer, const SdfPath& dstPath,
@@ -27,60 +27,208 @@
 #include "pxr/base/tracelite/trace.h"
 #include "pxr/base/work/utils.h"
 
+#include <algorithm>
+#include <new>
+
 #include <iostream>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+SdfData::_FieldValuePair *
+SdfData::_FieldArena::Allocate(size_t n)
+{
+    const size_t bytes = n * sizeof(_FieldValuePair);
+    if (bytes > _chunkSpace) {
+        // Any space left in the current chunk is abandoned.
+        const size_t chunkBytes = std::max<size_t>(bytes, 64 * 1024);
+        _chunks.emplace_back(new char[chunkBytes]);
+        _chunkPtr = _chunks.back().get();
+        _chunkSpace = chunkBytes;
+    }
+    char *result = _chunkPtr;
+    _chunkPtr += bytes;
+    _chunkSpace -= bytes;
+    return reinterpret_cast<_FieldValuePair *>(result);
+}
+
+SdfData::_SpecTable::Entry *
+SdfData::_SpecTable::_FindEntry(const SdfPath &key)
+{
+    if (entries.empty()) {
+        return nullptr;
+    }
+    const size_t mask = entries.size() - 1;
+    size_t i = _KeyHash()(key) & mask;
+    for (;;) {
+        Entry &entry = entries[i];
+        if (entry.state == EmptySlot) {
+            return nullptr;
+        }
+        if (entry.state == FullSlot && entry.key == key) {
+            return &entry;
+        }
+        i = (i + 1) & mask;
+    }
+}
+
+SdfData::_SpecData *
+SdfData::_SpecTable::Find(const SdfPath &key)
+{
+    Entry *entry = _FindEntry(key);
+    return entry ? &entry->spec : nullptr;
+}
+
+std::pair<SdfData::_SpecData *, bool>
+SdfData::_SpecTable::FindOrCreate(const SdfPath &key)
+{
+    // Grow at 3/4 occupancy, counting tombstones so probe chains cannot
+    // degenerate in erase-heavy workloads.
+    if ((numUsed + numTombstones + 1) * 4 >= entries.size() * 3) {
+        _Grow();
+    }
+
+    const size_t mask = entries.size() - 1;
+    size_t i = _KeyHash()(key) & mask;
+    Entry *tombstone = nullptr;
+    for (;;) {
+        Entry &entry = entries[i];
+        if (entry.state == EmptySlot) {
+            Entry *slot = tombstone ? tombstone : &entry;
+            if (slot->state == TombstoneSlot) {
+                --numTombstones;
+            }
+            slot->key = key;
+            slot->state = FullSlot;
+            ++numUsed;
+            return std::make_pair(&slot->spec, true);
+        }
+        if (entry.state == FullSlot && entry.key == key) {
+            return std::make_pair(&entry.spec, false);
+        }
+        if (entry.state == TombstoneSlot && !tombstone) {
+            tombstone = &entry;
+        }
+        i = (i + 1) & mask;
+    }
+}
+
+void
+SdfData::_SpecTable::Erase(const SdfPath &key)
+{
+    Entry *entry = _FindEntry(key);
+    if (!entry) {
+        return;
+    }
+    entry->key = SdfPath();
+    entry->spec = _SpecData();
+    entry->state = TombstoneSlot;
+    --numUsed;
+    ++numTombstones;
+}
+
+void
+SdfData::_SpecTable::_Grow()
+{
+    const size_t newSize = entries.empty() ? 16 : entries.size() * 2;
+    std::vector<Entry> oldEntries;
+    oldEntries.swap(entries);
+    entries.resize(newSize);
+    numTombstones = 0;
+
+    const size_t mask = newSize - 1;
+    for (Entry &entry : oldEntries) {
+        if (entry.state != FullSlot) {
+            continue;
+        }
+        size_t i = _KeyHash()(entry.key) & mask;
+        while (entries[i].state == FullSlot) {
+            i = (i + 1) & mask;
+        }
+        entries[i].key = std::move(entry.key);
+        entries[i].spec = entry.spec;
+        entries[i].state = FullSlot;
+    }
+}
+
+SdfData::_Storage::~_Storage()
+{
+    // Field-value pairs are constructed in arena storage, so the arena's
+    // chunks cannot be released until every live pair has been destroyed.
+    for (_SpecTable::Entry &entry : table.entries) {
+        if (entry.state == _SpecTable::FullSlot) {
+            _DestroyFields(&entry.spec);
+        }
+    }
+}
+
+void
+SdfData::_DestroyFields(_SpecData *spec)
+{
+    for (uint32_t j = 0; j != spec->numFields; ++j) {
+        spec->fields[j].~_FieldValuePair();
+    }
+    spec->fields = nullptr;
+    spec->numFields = 0;
+    spec->fieldCapacity = 0;
+}
+
 SdfData::~SdfData()
 {
-    // Clear out _data in parallel, since it can get big.
-    WorkSwapDestroyAsync(_data);
+    // Clear out the backing storage in parallel, since it can get big.
+    WorkSwapDestroyAsync(_storage);
 }
 
 bool
 SdfData::HasSpec(const SdfAbstractDataSpecId& id) const
 {
-    return (_data.find(id.GetFullSpecPath()) != _data.end());
+    return _storage.table.Find(id.GetFullSpecPath());
 }
 
 void
 SdfData::EraseSpec(const SdfAbstractDataSpecId& id)
 {
-    _HashTable::iterator i = _data.find(id.GetFullSpecPath());
-    if (!TF_VERIFY(i != _data.end(), 
+    const SdfPath path = id.GetFullSpecPath();
+    _SpecData *spec = _storage.table.Find(path);
+    if (!TF_VERIFY(spec,
             "No spec to erase at <%s>", id.GetString().c_str())) {
         return;
     }
-    _data.erase(i);
+    _DestroyFields(spec);
+    _storage.table.Erase(path);
 }
 
 void
-SdfData::MoveSpec(const SdfAbstractDataSpecId& oldId, 
+SdfData::MoveSpec(const SdfAbstractDataSpecId& oldId,
                   const SdfAbstractDataSpecId& newId)
 {
     const SdfPath oldPath = oldId.GetFullSpecPath();
     const SdfPath newPath = newId.GetFullSpecPath();
 
-    _HashTable::iterator old = _data.find(oldPath);
-    if (!TF_VERIFY(old != _data.end(),
+    if (!TF_VERIFY(_storage.table.Find(oldPath),
             "No spec to move at <%s>", oldPath.GetString().c_str())) {
         return;
     }
-    bool inserted = _data.insert(std::make_pair(newPath,old->second)).second;
-    if (!TF_VERIFY(inserted)) {
+    std::pair<_SpecData *, bool> inserted = _storage.table.FindOrCreate(newPath);
+    if (!TF_VERIFY(inserted.second)) {
         return;
     }
-    _data.erase(old);
+    // Re-find the old spec, since creating the new entry may have grown
+    // the table.  The field extent transfers by pointer; relinquish it
+    // from the old spec before erasing so it is not destroyed.
+    _SpecData *oldSpec = _storage.table.Find(oldPath);
+    *inserted.first = *oldSpec;
+    *oldSpec = _SpecData();
+    _storage.table.Erase(oldPath);
 }
 
 SdfSpecType
 SdfData::GetSpecType(const SdfAbstractDataSpecId& id) const
 {
-    _HashTable::const_iterator i = _data.find(id.GetFullSpecPath());
-    if (i == _data.end()) {
+    const _SpecData *spec = _storage.table.Find(id.GetFullSpecPath());
+    if (!spec) {
         return SdfSpecTypeUnknown;
     }
-    return i->second.specType;
+    return spec->specType;
 }
 
 void
@@ -89,14 +237,17 @@ SdfData::CreateSpec(const SdfAbstractDataSpecId& id, SdfSpecType specType)
     if (!TF_VERIFY(specType != SdfSpecTypeUnknown)) {
         return;
     }
-    _data[id.GetFullSpecPath()].specType = specType;
+    _storage.table.FindOrCreate(id.GetFullSpecPath()).first->specType = specType;
 }
 
 void
 SdfData::_VisitSpecs(SdfAbstractDataSpecVisitor* visitor) const
 {
-    TF_FOR_ALL(it, _data) {
-        if (!visitor->VisitSpec(*this, SdfAbstractDataSpecId(&it->first))) {
+    for (const _SpecTable::Entry &entry : _storage.table.entries) {
+        if (entry.state != _SpecTable::FullSlot) {
+            continue;
+        }
+        if (!visitor->VisitSpec(*this, SdfAbstractDataSpecId(&entry.key))) {
             break;
         }
     }
@@ -128,16 +279,14 @@ SdfData::Has(const SdfAbstractDataSpecId& id, const TfToken & field,
     return false;
 }
 
-const VtValue* 
+const VtValue*
 SdfData::_GetFieldValue(const SdfAbstractDataSpecId& id,
                         const TfToken& field) const
 {
-    _HashTable::const_iterator i = _data.find(id.GetFullSpecPath());
-    if (i != _data.end()) {
-        const _SpecData & spec = i->second;
-        for (size_t j=0, jEnd = spec.fields.size(); j != jEnd; ++j) {
-            if (spec.fields[j].first == field) {
-                return &spec.fields[j].second;
+    if (const _SpecData *spec = _storage.table.Find(id.GetFullSpecPath())) {
+        for (uint32_t j=0, jEnd = spec->numFields; j != jEnd; ++j) {
+            if (spec->fields[j].first == field) {
+                return &spec->fields[j].second;
             }
         }
     }
@@ -152,6 +301,13 @@ SdfData::Get(const SdfAbstractDataSpecId& id, const TfToken & field) const
     return VtValue();
 }
 
+const VtValue*
+SdfData::GetFieldRef(const SdfAbstractDataSpecId& id,
+                     const TfToken & field) const
+{
+    return _GetFieldValue(id, field);
+}
+
 void 
 SdfData::Set(const SdfAbstractDataSpecId& id, const TfToken & field, 
              const VtValue& value)
@@ -185,36 +341,52 @@ VtValue*
 SdfData::_GetOrCreateFieldValue(const SdfAbstractDataSpecId& id,
                                 const TfToken& field)
 {
-    _HashTable::iterator i = _data.find(id.GetFullSpecPath());
-    if (!TF_VERIFY(i != _data.end(),
+    _SpecData *spec = _storage.table.Find(id.GetFullSpecPath());
+    if (!TF_VERIFY(spec,
                       "No spec at <%s> when trying to set field '%s'",
                       id.GetString().c_str(), field.GetText())) {
         return NULL;
     }
 
-    _SpecData & spec = i->second;
-    for (size_t j=0, jEnd = spec.fields.size(); j != jEnd; ++j) {
-        if (spec.fields[j].first == field) {
-            return &spec.fields[j].second;
+    for (uint32_t j=0, jEnd = spec->numFields; j != jEnd; ++j) {
+        if (spec->fields[j].first == field) {
+            return &spec->fields[j].second;
+        }
+    }
+
+    if (spec->numFields == spec->fieldCapacity) {
+        // Move the spec's fields to a larger extent; the outgrown extent
+        // is abandoned in the arena.
+        const uint32_t newCapacity =
+            spec->fieldCapacity ? spec->fieldCapacity * 2 : 2;
+        _FieldValuePair *newFields = _storage.arena.Allocate(newCapacity);
+        for (uint32_t j=0, jEnd = spec->numFields; j != jEnd; ++j) {
+            new (newFields + j) _FieldValuePair(std::move(spec->fields[j]));
+            spec->fields[j].~_FieldValuePair();
         }
+        spec->fields = newFields;
+        spec->fieldCapacity = newCapacity;
     }
 
-    spec.fields.push_back( _FieldValuePair(field, VtValue()) );
-    return &spec.fields.back().second;
+    new (spec->fields + spec->numFields) _FieldValuePair(field, VtValue());
+    return &spec->fields[spec->numFields++].second;
 }
 
 void 
 SdfData::Erase(const SdfAbstractDataSpecId& id, const TfToken & field)
 {
-    _HashTable::iterator i = _data.find(id.GetFullSpecPath());
-    if (i == _data.end()) {
+    _SpecData *spec = _storage.table.Find(id.GetFullSpecPath());
+    if (!spec) {
         return;
     }
-    
-    _SpecData &spec = i->second;
-    for (size_t j=0, jEnd = spec.fields.size(); j != jEnd; ++j) {
-        if (spec.fields[j].first == field) {
-            spec.fields.erase(spec.fields.begin()+j);
+
+    for (uint32_t j=0, jEnd = spec->numFields; j != jEnd; ++j) {
+        if (spec->fields[j].first == field) {
+            for (uint32_t k = j; k + 1 != jEnd; ++k) {
+                spec->fields[k] = std::move(spec->fields[k + 1]);
+            }
+            spec->fields[jEnd - 1].~_FieldValuePair();
+            --spec->numFields;
             return;
         }
     }
@@ -223,14 +395,11 @@ SdfData::Erase(const SdfAbstractDataSpecId& id, const TfToken & field)
 std::vector<TfToken>
 SdfData::List(const SdfAbstractDataSpecId& id) const
 {
-    _HashTable::const_iterator i = _data.find(id.GetFullSpecPath());
-    if (i != _data.end()) {
-        const _SpecData & spec = i->second;
-
+    if (const _SpecData *spec = _storage.table.Find(id.GetFullSpecPath())) {
         std::vector<TfToken> names;
-        names.reserve(spec.fields.size());
-        for (size_t j=0, jEnd = spec.fields.size(); j != jEnd; ++j) {
-            names.push_back(spec.fields[j].first);
+        names.reserve(spec->numFields);
+        for (uint32_t j=0, jEnd = spec->numFields; j != jEnd; ++j) {
+            names.push_back(spec->fields[j].first);
         }
         return names;
     }
@@ -249,9 +418,12 @@ SdfData::ListAllTimeSamples() const
     // Use a set to determine unique times.
     std::set<double> times;
 
-    TF_FOR_ALL(i, _data) {
-        std::set<double> timesForPath = 
-            ListTimeSamplesForPath(SdfAbstractDataSpecId(&i->first));
+    for (const _SpecTable::Entry &entry : _storage.table.entries) {
+        if (entry.state != _SpecTable::FullSlot) {
+            continue;
+        }
+        std::set<double> timesForPath =
+            ListTimeSamplesForPath(SdfAbstractDataSpecId(&entry.key));
         times.insert(timesForPath.begin(), timesForPath.end());
     }
 
@@ -354,8 +526,55 @@ SdfData::GetBracketingTimeSamplesForPath(
     return false;
 }
 
+namespace
+{
+
+// Stream over the SdfTimeSampleMap stored in a spec's timeSamples field.
+// Sample values are handed out by reference into the stored map, so no
+// copies are made; the map must stay unmutated while the stream is open.
+class _TimeSampleMapStream : public SdfAbstractDataTimeSampleStream
+{
+public:
+    explicit _TimeSampleMapStream(const SdfTimeSampleMap& samples)
+        : _cur(samples.begin())
+        , _end(samples.end())
+    {
+    }
+
+    virtual bool Next(double* time, const VtValue** value)
+    {
+        if (_cur == _end) {
+            return false;
+        }
+        *time = _cur->first;
+        *value = &_cur->second;
+        ++_cur;
+        return true;
+    }
+
+private:
+    SdfTimeSampleMap::const_iterator _cur;
+    SdfTimeSampleMap::const_iterator _end;
+};
+
+} // end anonymous namespace
+
+std::unique_ptr<SdfAbstractDataTimeSampleStream>
+SdfData::OpenTimeSampleStream(const SdfAbstractDataSpecId& id) const
+{
+    const VtValue *fval = _GetFieldValue(id, SdfDataTokens->TimeSamples);
+    if (fval && fval->IsHolding<SdfTimeSampleMap>()) {
+        auto const &tsmap = fval->UncheckedGet<SdfTimeSampleMap>();
+        if (!tsmap.empty()) {
+            return std::unique_ptr<SdfAbstractDataTimeSampleStream>(
+                new _TimeSampleMapStream(tsmap));
+        }
+    }
+    return std::unique_ptr<SdfAbstractDataTimeSampleStream>();
+}
+
 bool
-SdfData::QueryTimeSample(const SdfAbstractDataSpecId& id, double time, 
+SdfData::QueryTimeSample(const SdfAbstractDataSpecId& id, double time,
                          VtValue *value) const
 {
     const VtValue *fval = _GetFieldValue(id, SdfDataTokens->TimeSamples);
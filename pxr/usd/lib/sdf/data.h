@@ -29,10 +29,12 @@
 #include "pxr/usd/sdf/abstractData.h"
 #include "pxr/usd/sdf/path.h"
 #include "pxr/base/tf/declarePtrs.h"
-#include "pxr/base/tf/hashmap.h"
 #include "pxr/base/tf/token.h"
 #include "pxr/base/vt/value.h"
 
+#include <cstdint>
+#include <memory>
+#include <utility>
 #include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -44,7 +46,10 @@ TF_DECLARE_WEAK_AND_REF_PTRS(SdfData);
 /// SdfData provides concrete scene description data storage.
 ///
 /// An SdfData is an implementation of SdfAbstractData that simply
-/// stores specs and fields in a map keyed by path.
+/// stores specs and fields in a map keyed by path.  Specs live in an
+/// open-addressed hash table and their field entries are carved out of a
+/// layer-owned arena, so populating a large layer makes a handful of
+/// block allocations rather than one per spec.
 ///
 class SdfData : public SdfAbstractData
 {
@@ -74,9 +79,12 @@ public:
     virtual bool Has(const SdfAbstractDataSpecId& id, const TfToken& fieldName,
                      VtValue *value = NULL) const;
     SDF_API
-    virtual VtValue Get(const SdfAbstractDataSpecId& id, 
+    virtual VtValue Get(const SdfAbstractDataSpecId& id,
                         const TfToken& fieldName) const;
     SDF_API
+    virtual const VtValue* GetFieldRef(const SdfAbstractDataSpecId& id,
+                                       const TfToken& fieldName) const;
+    SDF_API
     virtual void Set(const SdfAbstractDataSpecId& id, const TfToken& fieldName,
                      const VtValue & value);
     SDF_API
@@ -110,6 +118,10 @@ public:
                                     double time,
                                     double* tLower, double* tUpper) const;
 
+    SDF_API
+    virtual std::unique_ptr<SdfAbstractDataTimeSampleStream>
+    OpenTimeSampleStream(const SdfAbstractDataSpecId& id) const;
+
     SDF_API
     virtual bool
     QueryTimeSample(const SdfAbstractDataSpecId& id, double time,
@@ -140,21 +152,110 @@ private:
                                     const TfToken& field);
 
 private:
-    // Backing storage for a single "spec" -- prim, property, etc.
+    // Backing storage for a single "spec" -- prim, property, etc.  The
+    // field entries live in the layer's field arena, not in a per-spec
+    // heap vector; the spec just records the extent it owns there.
     typedef std::pair<TfToken, VtValue> _FieldValuePair;
     struct _SpecData {
-        _SpecData() : specType(SdfSpecTypeUnknown) {}
-        
+        _SpecData()
+            : fields(nullptr)
+            , numFields(0)
+            , fieldCapacity(0)
+            , specType(SdfSpecTypeUnknown) {}
+
+        _FieldValuePair *fields;
+        uint32_t numFields;
+        uint32_t fieldCapacity;
         SdfSpecType specType;
-        std::vector<_FieldValuePair> fields;
     };
 
-    // Hashtable storing _SpecData.
     typedef SdfPath _Key;
     typedef SdfPath::Hash _KeyHash;
-    typedef TfHashMap<_Key, _SpecData, _KeyHash> _HashTable;
 
-    _HashTable _data;
+    // Bump allocator handing out uninitialized storage for field-value
+    // pairs in large chunks.  Storage is never returned individually;
+    // outgrown extents are abandoned in place and everything is freed
+    // wholesale when the layer's data is destroyed.  This trades some
+    // slack during editing for an allocation count proportional to the
+    // number of chunks rather than the number of specs, and keeps field
+    // entries densely packed for traversal.
+    class _FieldArena {
+    public:
+        _FieldArena() : _chunkSpace(0), _chunkPtr(nullptr) {}
+
+        _FieldArena(_FieldArena &&) = default;
+        _FieldArena &operator=(_FieldArena &&) = default;
+
+        // Return uninitialized storage for \p n field-value pairs.
+        _FieldValuePair *Allocate(size_t n);
+
+    private:
+        std::vector<std::unique_ptr<char[]>> _chunks;
+        size_t _chunkSpace;
+        char *_chunkPtr;
+    };
+
+    // Open-addressed hash table of _SpecData keyed by path, using linear
+    // probing over a power-of-two entry array.  Erased slots are
+    // tombstoned so probe chains stay intact; the table grows at 3/4
+    // occupancy counting tombstones.  Entries are stored inline, so
+    // visiting every spec is a scan of one contiguous array.
+    class _SpecTable {
+    public:
+        enum SlotState { EmptySlot, FullSlot, TombstoneSlot };
+
+        struct Entry {
+            Entry() : state(EmptySlot) {}
+            SdfPath key;
+            _SpecData spec;
+            uint8_t state;
+        };
+
+        _SpecTable() : numUsed(0), numTombstones(0) {}
+
+        // Return the spec stored under \p key, or null if absent.
+        _SpecData *Find(const SdfPath &key);
+        const _SpecData *Find(const SdfPath &key) const {
+            return const_cast<_SpecTable *>(this)->Find(key);
+        }
+
+        // Return the spec stored under \p key, creating it if absent;
+        // second is true if an entry was created.  May grow the table,
+        // invalidating any previously returned spec pointers.
+        std::pair<_SpecData *, bool> FindOrCreate(const SdfPath &key);
+
+        // Remove the entry for \p key.  The spec's field storage must
+        // already have been destroyed or moved elsewhere.
+        void Erase(const SdfPath &key);
+
+        size_t GetSize() const { return numUsed; }
+
+        std::vector<Entry> entries;
+        size_t numUsed;
+        size_t numTombstones;
+
+    private:
+        Entry *_FindEntry(const SdfPath &key);
+        void _Grow();
+    };
+
+    // The spec table and the arena its field extents live in; bundled so
+    // the whole backing store can be destroyed asynchronously as a unit.
+    struct _Storage {
+        _Storage() {}
+        _Storage(_Storage &&) = default;
+        _Storage &operator=(_Storage &&) = default;
+        ~_Storage();
+
+        _SpecTable table;
+        _FieldArena arena;
+    };
+
+    // Destroy the constructed field-value pairs owned by \p spec and
+    // relinquish its extent.
+    static void _DestroyFields(_SpecData *spec);
+
+    _Storage _storage;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -55,6 +55,7 @@
 #include "pxr/base/arch/errno.h"
 #include "pxr/base/tracelite/trace.h"
 #include "pxr/base/tf/debug.h"
+#include "pxr/base/tf/envSetting.h"
 #include "pxr/base/tf/fileUtils.h"
 #include "pxr/base/tf/iterator.h"
 #include "pxr/base/tf/mallocTag.h"
@@ -87,6 +88,13 @@ TF_REGISTRY_FUNCTION(TfType)
     TfType::Define< SdfLayer, TfType::Bases<SdfLayerBase> >();
 }
 
+TF_DEFINE_ENV_SETTING(
+    SDF_LAYER_RELOAD_FINE_GRAINED_DIFF, true,
+    "If enabled, reloading a streaming layer diffs the newly-read data "
+    "against the layer's existing data and sends spec-level change "
+    "notification for just the differences, rather than notifying that "
+    "the entire layer content was replaced.");
+
 // Muted Layers stores the paths of layers that should be muted.  The stored
 // paths should be asset paths, when applicable, or identifiers if no asset
 // path exists for the desired layers.
@@ -128,7 +136,8 @@ SdfLayer::SdfLayer(
     _mutedLayersRevisionCache(0),
     _isMutedCache(false),
     _permissionToEdit(true),
-    _permissionToSave(true)
+    _permissionToSave(true),
+    _reloadInProgress(false)
 {
     const string realPathFinal =
         TfIsRelativePath(realPath) ? realPath : TfAbsPath(realPath);
@@ -676,10 +685,24 @@ SdfLayer::FindOrOpen(const string &identifier,
     if (!_ComputeInfoToFindOrOpenLayer(identifier, args, &layerInfo))
         return TfNullPtr;
 
-    // Resolve the path before we take the lock, since doing the resolution is
-    // slow.
     bool isAnonymous = IsAnonymousLayerIdentifier(layerInfo.layerPath);
 
+    // Fast path: look for a layer cached under exactly this identifier.
+    // This avoids both path resolution and the registry mutex, so finds of
+    // already-open layers do not contend with concurrent opens of other
+    // layers. Relative layer paths are excluded since they must be anchored
+    // before consulting the registry.
+    if (isAnonymous || !ArGetResolver().IsRelativePath(layerInfo.layerPath)) {
+        if (SdfLayerRefPtr layer =
+            _layerRegistry->FindAndAcquireByIdentifier(layerInfo.identifier)) {
+            return layer->_WaitForInitializationAndCheckIfSuccessful() ?
+                layer : TfNullPtr;
+        }
+    }
+
+    // Resolve the path before we take the lock, since doing the resolution is
+    // slow.
+    //
     // If we're trying to open an anonymous layer, do not try to compute the
     // real path for it.
     ArAssetInfo assetInfo;
@@ -840,7 +863,11 @@ SdfLayer::_Reload(bool force)
             return _ReloadSkipped;
         }
 
-        if (!_Read(GetIdentifier(), realPath, /* metadataOnly = */ false)) {
+        _reloadInProgress = true;
+        const bool readSucceeded =
+            _Read(GetIdentifier(), realPath, /* metadataOnly = */ false);
+        _reloadInProgress = false;
+        if (!readSucceeded) {
             return _ReloadFailed;
         }
 
@@ -953,10 +980,21 @@ SdfLayer::Find(const string &identifier,
     if (!_ComputeInfoToFindOrOpenLayer(identifier, args, &layerInfo))
         return TfNullPtr;
 
-    // Resolve the path before we take the lock, since doing the resolution is
-    // slow.
     bool isAnonymous = IsAnonymousLayerIdentifier(layerInfo.layerPath);
 
+    // Fast path: look for a layer cached under exactly this identifier,
+    // avoiding path resolution and the registry mutex. See FindOrOpen.
+    if (isAnonymous || !ArGetResolver().IsRelativePath(layerInfo.layerPath)) {
+        if (SdfLayerRefPtr layer =
+            _layerRegistry->FindAndAcquireByIdentifier(layerInfo.identifier)) {
+            return layer->_WaitForInitializationAndCheckIfSuccessful() ?
+                layer : TfNullPtr;
+        }
+    }
+
+    // Resolve the path before we take the lock, since doing the resolution is
+    // slow.
+    //
     // If we're trying to open an anonymous layer, do not try to compute the
     // real path for it.
     const string resolvedPath = isAnonymous ? layerInfo.layerPath :
@@ -3074,6 +3112,13 @@ SdfLayer::GetField(const SdfAbstractDataSpecId& id,
     return result;
 }
 
+const VtValue*
+SdfLayer::GetFieldRef(const SdfAbstractDataSpecId& id,
+    const TfToken& fieldName) const
+{
+    return _data->GetFieldRef(id, fieldName);
+}
+
 VtValue
 SdfLayer::GetFieldDictValueByKey(const SdfAbstractDataSpecId& id,
                                  const TfToken& fieldName,
@@ -3251,16 +3296,21 @@ SdfLayer::_SetData(const SdfAbstractDataPtr &newData)
     // of Sd.  Do all this in a single changeblock.
     SdfChangeBlock block;
 
-    // If this layer streams its data on demand, we cannot perform 
-    // fine-grained change notification because that would cause all of 
-    // the data in the layer to be streamed in from disk.
-    // So, all we can do is move the new data into place and
-    // notify the world that this layer may have changed arbitrarily.
+    // If this layer streams its data on demand, fine-grained change
+    // notification would ordinarily cause all of the data in the layer to
+    // be streamed in from disk, so by default we just move the new data
+    // into place and notify the world that this layer may have changed
+    // arbitrarily.  On reload, however, both the old and new data are
+    // typically already resident and largely identical, so we accept the
+    // cost of the diff in exchange for minimal downstream invalidation.
     if (GetFileFormat()->IsStreamingLayer(*this)) {
-        _data = newData;
-        Sdf_ChangeManager::Get()
-            .DidReplaceLayerContent(SdfCreateHandle(this));
-        return;
+        if (!_reloadInProgress ||
+            !TfGetEnvSetting(SDF_LAYER_RELOAD_FINE_GRAINED_DIFF)) {
+            _data = newData;
+            Sdf_ChangeManager::Get()
+                .DidReplaceLayerContent(SdfCreateHandle(this));
+            return;
+        }
     }
 
     // Remove specs that no longer exist or whose required fields changed.
@@ -564,6 +564,17 @@ public:
     VtValue GetField(const SdfAbstractDataSpecId& id,
                      const TfToken& fieldName) const;
 
+    /// Return a pointer to the value for the given \a id and \a fieldName
+    /// if one is set and the underlying data object can expose a stable
+    /// reference to it; otherwise return NULL. Unlike GetField, this does
+    /// not copy the value and does not consult required-field fallbacks,
+    /// so a NULL return does not imply the field is absent; callers must
+    /// fall back to HasField or GetField. The pointer is valid until the
+    /// layer is next edited.
+    SDF_API
+    const VtValue* GetFieldRef(const SdfAbstractDataSpecId& id,
+                               const TfToken& fieldName) const;
+
     /// Return the value for the given \a id and \a fieldName. Returns the
     /// provided \a defaultValue value if none is set.
     template <class T>
@@ -672,6 +683,9 @@ public:
     SDF_API
     VtValue GetField(const SdfPath& path, const TfToken& fieldName) const;
     SDF_API
+    const VtValue* GetFieldRef(const SdfPath& path,
+                               const TfToken& fieldName) const;
+    SDF_API
     VtValue GetFieldDictValueByKey(
         const SdfPath& path, const TfToken& fieldName,
         const TfToken &keyPath) const;
@@ -1716,6 +1730,12 @@ private:
     bool _permissionToEdit;
     bool _permissionToSave;
 
+    // True while Reload() is rereading this layer's asset.  Enables the
+    // fine-grained diff path in _SetData() for streaming layers, so a
+    // reload produces spec-level change notification instead of a
+    // whole-layer content replacement.
+    bool _reloadInProgress;
+
     // Allow access to _FindLayerForData() and _IsInert().
     friend class SdfSpec;
     friend class SdfPropertySpec;
@@ -1788,10 +1808,16 @@ SdfLayer::HasFieldDictKey(const SdfPath& path, const TfToken &name,
     return HasFieldDictKey(SdfAbstractDataSpecId(&path), name, keyPath);
 }
 
-inline VtValue 
+inline VtValue
 SdfLayer::GetField(const SdfPath& path, const TfToken& fieldName) const
-{ 
-    return GetField(SdfAbstractDataSpecId(&path), fieldName); 
+{
+    return GetField(SdfAbstractDataSpecId(&path), fieldName);
+}
+
+inline const VtValue*
+SdfLayer::GetFieldRef(const SdfPath& path, const TfToken& fieldName) const
+{
+    return GetFieldRef(SdfAbstractDataSpecId(&path), fieldName);
 }
 
 inline VtValue
@@ -153,14 +153,19 @@ Sdf_LayerRegistry::InsertOrUpdate(
                 Sdf_LayerDebugRepr(layer).c_str(),
                 existingLayer->GetFileFormat()->GetFormatId().GetText(),
                 Sdf_LayerDebugRepr(existingLayer).c_str());
+            return;
         }
     }
+
+    _UpdateIdentifierCache(layer);
 }
 
 void
 Sdf_LayerRegistry::Erase(
     const SdfLayerHandle& layer)
 {
+    _EraseFromIdentifierCache(layer);
+
     bool erased = _layers.erase(layer);
 
     TF_DEBUG(SDF_LAYER).Msg(
@@ -169,6 +174,82 @@ Sdf_LayerRegistry::Erase(
         erased ? "Success" : "Failed");
 }
 
+Sdf_LayerRegistry::_CacheStripe&
+Sdf_LayerRegistry::_GetCacheStripe(
+    const string& identifier) const
+{
+    return _cacheStripes[TfHash()(identifier) % _NumCacheStripes];
+}
+
+void
+Sdf_LayerRegistry::_UpdateIdentifierCache(
+    const SdfLayerHandle& layer)
+{
+    const string& identifier = layer->GetIdentifier();
+
+    // If the layer was previously cached under a different identifier,
+    // drop the old entry so it cannot outlive the layer.
+    auto keyIt = _cacheKeyForLayer.find(layer);
+    if (keyIt != _cacheKeyForLayer.end()) {
+        if (keyIt->second == identifier) {
+            return;
+        }
+        _CacheStripe& oldStripe = _GetCacheStripe(keyIt->second);
+        tbb::spin_rw_mutex::scoped_lock lock(oldStripe.mutex, /*write=*/true);
+        auto entryIt = oldStripe.map.find(keyIt->second);
+        if (entryIt != oldStripe.map.end() && entryIt->second == layer) {
+            oldStripe.map.erase(entryIt);
+        }
+    }
+
+    _CacheStripe& stripe = _GetCacheStripe(identifier);
+    {
+        tbb::spin_rw_mutex::scoped_lock lock(stripe.mutex, /*write=*/true);
+        stripe.map[identifier] = layer;
+    }
+    _cacheKeyForLayer[layer] = identifier;
+}
+
+void
+Sdf_LayerRegistry::_EraseFromIdentifierCache(
+    const SdfLayerHandle& layer)
+{
+    auto keyIt = _cacheKeyForLayer.find(layer);
+    if (keyIt == _cacheKeyForLayer.end()) {
+        return;
+    }
+
+    _CacheStripe& stripe = _GetCacheStripe(keyIt->second);
+    {
+        tbb::spin_rw_mutex::scoped_lock lock(stripe.mutex, /*write=*/true);
+        auto entryIt = stripe.map.find(keyIt->second);
+        if (entryIt != stripe.map.end() && entryIt->second == layer) {
+            stripe.map.erase(entryIt);
+        }
+    }
+    _cacheKeyForLayer.erase(keyIt);
+}
+
+SdfLayerRefPtr
+Sdf_LayerRegistry::FindAndAcquireByIdentifier(
+    const string& identifier) const
+{
+    _CacheStripe& stripe = _GetCacheStripe(identifier);
+    tbb::spin_rw_mutex::scoped_lock lock(stripe.mutex, /*write=*/false);
+
+    auto entryIt = stripe.map.find(identifier);
+    if (entryIt == stripe.map.end()) {
+        return TfNullPtr;
+    }
+
+    // While we hold the stripe lock, the layer's TfRefBase cannot be
+    // destroyed: a dying layer is erased from this stripe under the stripe
+    // write lock before its destructor can complete. If the layer is
+    // already expiring, this returns null and the caller falls back to the
+    // locked registry path, which handles erasing expiring layers.
+    return TfCreateRefPtrFromProtectedWeakPtr(entryIt->second);
+}
+
 SdfLayerHandle
 Sdf_LayerRegistry::Find(
     const string &inputLayerPath,
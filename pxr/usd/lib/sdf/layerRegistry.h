@@ -29,12 +29,15 @@
 #include "pxr/pxr.h"
 #include "pxr/usd/sdf/declareHandles.h"
 #include "pxr/base/tf/hash.h"
+#include "pxr/base/tf/hashmap.h"
 
 #include <boost/multi_index_container.hpp>
 #include <boost/multi_index/hashed_index.hpp>
 #include <boost/multi_index/identity.hpp>
 #include <boost/noncopyable.hpp>
 
+#include <tbb/spin_rw_mutex.h>
+
 #include <string>
 #include <iosfwd>
 
@@ -74,6 +77,15 @@ public:
     /// with the \p layerPath as provided.
     SdfLayerHandle FindByIdentifier(const std::string& layerPath) const;
 
+    /// Returns a layer cached under exactly \p identifier with an ownership
+    /// stake acquired, or a null ref ptr if no such layer is cached or the
+    /// cached layer is expiring. Unlike the other Find functions, this may
+    /// be called without holding the global registry lock; it only takes a
+    /// read lock on the cache stripe for \p identifier, so concurrent
+    /// lookups of different layers do not contend with each other.
+    SdfLayerRefPtr FindAndAcquireByIdentifier(
+        const std::string& identifier) const;
+
     /// Returns a layer from the registry, consulting the by_repository_path index
     /// with the \p layerPath as provided.
     SdfLayerHandle FindByRepositoryPath(const std::string& layerPath) const;
@@ -157,7 +169,32 @@ private:
     // Repository path index.
     typedef _Layers::index<by_repository_path>::type _LayersByRepositoryPath;
 
+    // A striped cache mapping layer identifiers to layers, used to answer
+    // exact-identifier lookups without taking the global registry mutex.
+    // Each stripe carries its own lock, so lookups of different layers do
+    // not contend with each other. Mutations happen only in InsertOrUpdate
+    // and Erase, which are always called with the global registry write
+    // lock held; a layer's cache entries are dropped under the stripe lock
+    // before the layer's destruction can complete, which is what makes the
+    // protected weak ptr acquisition in FindAndAcquireByIdentifier safe.
+    static const size_t _NumCacheStripes = 32;
+    struct _CacheStripe {
+        tbb::spin_rw_mutex mutex;
+        TfHashMap<std::string, SdfLayerHandle, TfHash> map;
+    };
+
+    _CacheStripe& _GetCacheStripe(const std::string& identifier) const;
+    void _UpdateIdentifierCache(const SdfLayerHandle& layer);
+    void _EraseFromIdentifierCache(const SdfLayerHandle& layer);
+
     _Layers _layers;
+
+    mutable _CacheStripe _cacheStripes[_NumCacheStripes];
+
+    // Maps each cached layer to the identifier it is cached under, so a
+    // re-keyed or dying layer's stale entry can be evicted. Only accessed
+    // with the global registry write lock held.
+    TfHashMap<SdfLayerHandle, std::string, TfHash> _cacheKeyForLayer;
 };
 
 std::ostream&
@@ -30,6 +30,7 @@
 #include "pxr/usd/sdf/layer.h"
 
 #include "pxr/usd/ar/resolver.h"
+#include "pxr/usd/ar/resolverSharedCache.h"
 #include "pxr/base/tracelite/trace.h"
 
 using std::string;
@@ -41,14 +42,20 @@ SdfComputeAssetPathRelativeToLayer(
     const SdfLayerHandle& anchor,
     const string& assetPath)
 {
+    return SdfComputeAssetPathsRelativeToLayer(
+        anchor, std::vector<string>(1, assetPath)).front();
+}
+
+std::vector<string>
+SdfComputeAssetPathsRelativeToLayer(
+    const SdfLayerHandle& anchor,
+    const std::vector<string>& assetPaths)
+{
+    std::vector<string> result(assetPaths.size());
+
     if (!anchor) {
         TF_CODING_ERROR("Invalid anchor layer");
-        return string();
-    }
-
-    if (assetPath.empty()) {
-        TF_CODING_ERROR("Layer path is empty");
-        return string();
+        return result;
     }
 
     TRACE_FUNCTION();
@@ -57,15 +64,48 @@ SdfComputeAssetPathRelativeToLayer(
 
     // Relative paths are resolved using the look-here-first scheme, in
     // which we first look relative to the layer, then fall back to search
-    // path resolution.
-    string finalLayerPath = anchor->ComputeAbsolutePath(assetPath);
-    if (!SdfLayer::IsAnonymousLayerIdentifier(finalLayerPath)) {
-        if (resolver.IsSearchPath(assetPath) &&
-            resolver.Resolve(finalLayerPath).empty())
-            return assetPath;
+    // path resolution.  Anchor every path up front, remembering which
+    // ones are search paths whose anchored form must be probed with the
+    // resolver.
+    std::vector<size_t> probeIndices;
+    std::vector<string> probePaths;
+    for (size_t i = 0; i != assetPaths.size(); ++i) {
+        if (assetPaths[i].empty()) {
+            TF_CODING_ERROR("Layer path is empty");
+            continue;
+        }
+        result[i] = anchor->ComputeAbsolutePath(assetPaths[i]);
+        if (!SdfLayer::IsAnonymousLayerIdentifier(result[i]) &&
+            resolver.IsSearchPath(assetPaths[i])) {
+            // When the process-wide shared cache is active, a probe
+            // another thread already issued need not be repeated.
+            string cachedPath;
+            if (ArResolverSharedCache::Lookup(result[i], &cachedPath)) {
+                if (cachedPath.empty()) {
+                    result[i] = assetPaths[i];
+                }
+            }
+            else {
+                probeIndices.push_back(i);
+                probePaths.push_back(result[i]);
+            }
+        }
     }
-    
-    return finalLayerPath;
+
+    // A single batch query covers all of the probes; search paths whose
+    // anchored form does not exist fall back to the authored path.
+    if (!probeIndices.empty()) {
+        const std::vector<string> resolvedPaths =
+            resolver.ResolveBatch(probePaths);
+        for (size_t i = 0; i != probeIndices.size(); ++i) {
+            ArResolverSharedCache::Store(probePaths[i], resolvedPaths[i]);
+            if (resolvedPaths[i].empty()) {
+                result[probeIndices[i]] = assetPaths[probeIndices[i]];
+            }
+        }
+    }
+
+    return result;
 }
 
 SdfLayerRefPtr
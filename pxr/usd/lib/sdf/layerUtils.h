@@ -32,6 +32,7 @@
 #include "pxr/usd/sdf/layer.h"
 
 #include <string>
+#include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -49,6 +50,18 @@ SdfComputeAssetPathRelativeToLayer(
     const SdfLayerHandle& anchor,
     const std::string& assetPath);
 
+/// Batch form of \ref SdfComputeAssetPathRelativeToLayer.  Returns the
+/// path to each asset in \p assetPaths, in corresponding order, following
+/// the same rules as the single-path form.  All of the resolver probes
+/// needed by the batch are issued through a single call to
+/// ArResolver::ResolveBatch, so resolvers with a bulk query can service
+/// them in one round trip.  Elements of \p assetPaths that are empty
+/// raise a coding error and produce an empty result path.
+SDF_API std::vector<std::string>
+SdfComputeAssetPathsRelativeToLayer(
+    const SdfLayerHandle& anchor,
+    const std::vector<std::string>& assetPaths);
+
 /// Returns a layer with the given \p layerPath relative to the \p anchor 
 /// layer.  This function uses \ref SdfComputeAssetPathRelativeToLayer with
 /// \p anchor and \p layerPath to compute the layer path to find or open.
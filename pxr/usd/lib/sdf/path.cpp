@@ -83,6 +83,95 @@ TF_REGISTRY_FUNCTION(VtValue)
     VtValue::RegisterCast<SdfPath, TfToken>(&_CastFromSdfPathToTfToken);
 }
 
+static inline bool
+_IsIdentFirstChar(char c)
+{
+    return c == '_' ||
+        (c >= 'A' && c <= 'Z') ||
+        (c >= 'a' && c <= 'z');
+}
+
+static inline bool
+_IsIdentChar(char c)
+{
+    return _IsIdentFirstChar(c) || (c >= '0' && c <= '9');
+}
+
+// Fast parse for the overwhelmingly common case of a simple absolute
+// path: /Prim/Child/Leaf with an optional .property suffix, where every
+// element is a plain identifier (possibly namespaced, for the property).
+// Returns true if the string was handled, filling *node.  Anything with
+// variant selections, targets, relative elements, and so on is left
+// untouched and returns false, so the full grammar runs instead.
+static bool
+_ParseSimpleAbsolutePath(const std::string &path,
+                         Sdf_PathNodeConstRefPtr *node)
+{
+    const char *p = path.c_str();
+    if (*p != '/') {
+        return false;
+    }
+
+    Sdf_PathNodeConstRefPtr cur = Sdf_PathNode::GetAbsoluteRootNode();
+    if (p[1] == '\0') {
+        node->swap(cur);
+        return true;
+    }
+    ++p;
+
+    for (;;) {
+        // Parse one prim name.
+        const char *start = p;
+        if (!_IsIdentFirstChar(*p)) {
+            return false;
+        }
+        ++p;
+        while (_IsIdentChar(*p)) {
+            ++p;
+        }
+        cur = Sdf_PathNode::FindOrCreatePrim(
+            cur, TfToken(std::string(start, p - start)));
+
+        if (*p == '/') {
+            ++p;
+            continue;
+        }
+        if (*p == '\0') {
+            break;
+        }
+        if (*p == '.') {
+            // Parse a possibly namespaced property name, which must end
+            // the path.
+            ++p;
+            start = p;
+            if (!_IsIdentFirstChar(*p)) {
+                return false;
+            }
+            ++p;
+            for (;;) {
+                while (_IsIdentChar(*p)) {
+                    ++p;
+                }
+                if (*p == ':' && _IsIdentFirstChar(p[1])) {
+                    p += 2;
+                    continue;
+                }
+                break;
+            }
+            if (*p != '\0') {
+                return false;
+            }
+            cur = Sdf_PathNode::FindOrCreatePrimProperty(
+                cur, TfToken(std::string(start, p - start)));
+            break;
+        }
+        return false;
+    }
+
+    node->swap(cur);
+    return true;
+}
+
 void
 SdfPath::_InitWithString(const std::string &path) {
 
@@ -90,6 +179,12 @@ SdfPath::_InitWithString(const std::string &path) {
     TfAutoMallocTag tag2("SdfPath::_InitWithString");
     TRACE_FUNCTION();
 
+    // Try the fast parse first; it handles the common simple absolute
+    // paths directly and leaves everything else to the full grammar.
+    if (_ParseSimpleAbsolutePath(path, &_pathNode)) {
+        return;
+    }
+
     Sdf_PathParserContext context;
 
     // Initialize the scanner, allowing it to be reentrant.
@@ -129,11 +129,36 @@ struct _HashParentAnd<_ParentAnd<void> >
     }
 };
 
+// Each table is sharded by parent node hash: minting a path node only
+// touches the shard that owns its parent, so threads creating paths under
+// different parents insert into independent maps instead of contending on
+// one map's buckets.
 template <class T>
-struct _Table {
+struct _ShardedTable {
+    typedef _ParentAnd<T> Key;
     typedef tbb::concurrent_hash_map<
-        _ParentAnd<T>, const Sdf_PathNode *,
-        _HashParentAnd<_ParentAnd<T> > > Type;
+        Key, const Sdf_PathNode *, _HashParentAnd<Key> > Shard;
+
+    // Power of two; 32 shards keeps bucket contention negligible for
+    // 32+ client threads without bloating the per-table footprint.
+    static const size_t NumShards = 32;
+
+    inline Shard &GetShard(const Sdf_PathNode *parent) {
+        return shards[hash_value(parent) & (NumShards - 1)];
+    }
+
+    void RehashAll(size_t totalBuckets) {
+        for (Shard &shard : shards) {
+            shard.rehash(totalBuckets / NumShards);
+        }
+    }
+
+    Shard shards[NumShards];
+};
+
+template <class T>
+struct _Table {
+    typedef _ShardedTable<T> Type;
 };
 
 typedef _Table<TfToken>::Type _TokenTable;
@@ -147,8 +172,9 @@ _FindOrCreate(Table &table,
               const Sdf_PathNodeConstRefPtr &parent,
               const Arg &arg)
 {
-    typename Table::accessor accessor;
-    if (table.insert(accessor, _MakeParentAnd(parent.get(), arg)) ||
+    typename Table::Shard &shard = table.GetShard(parent.get());
+    typename Table::Shard::accessor accessor;
+    if (shard.insert(accessor, _MakeParentAnd(parent.get(), arg)) ||
         Access::GetRefCount(accessor->second).fetch_and_increment() == 0) {
         // Either there was no entry in the table, or there was but it had begun
         // dying (another client dropped its refcount to 0).  We have to create
@@ -166,8 +192,9 @@ template <class PathNode, class Table>
 inline Sdf_PathNodeConstRefPtr
 _FindOrCreate(Table &table, const Sdf_PathNodeConstRefPtr &parent)
 {
-    typename Table::accessor accessor;
-    if (table.insert(accessor, _MakeParentAnd(parent.get())) ||
+    typename Table::Shard &shard = table.GetShard(parent.get());
+    typename Table::Shard::accessor accessor;
+    if (shard.insert(accessor, _MakeParentAnd(parent.get())) ||
         Access::GetRefCount(accessor->second).fetch_and_increment() == 0) {
         // Either there was no entry in the table, or there was but it had begun
         // dying (another client dropped its refcount to 0).  We have to create
@@ -190,10 +217,11 @@ _Remove(const Sdf_PathNode *pathNode,
     // there's an entry present it may not be pathNode, since another node may
     // have been created since we decremented our refcount and started being
     // destroyed.  If it is this node, we remove it.
-    typename Table::accessor accessor;
-    if (table.find(accessor, _MakeParentAnd(parent.get(), arg)) &&
+    typename Table::Shard &shard = table.GetShard(parent.get());
+    typename Table::Shard::accessor accessor;
+    if (shard.find(accessor, _MakeParentAnd(parent.get(), arg)) &&
         accessor->second == pathNode) {
-        table.erase(accessor);
+        shard.erase(accessor);
     }
 }
 
@@ -206,10 +234,11 @@ _Remove(const Sdf_PathNode *pathNode,
     // there's an entry present it may not be pathNode, since another node may
     // have been created since we decremented our refcount and started being
     // destroyed.  If it is this node, we remove it.
-    typename Table::accessor accessor;
-    if (table.find(accessor, _MakeParentAnd(parent.get())) &&
+    typename Table::Shard &shard = table.GetShard(parent.get());
+    typename Table::Shard::accessor accessor;
+    if (shard.find(accessor, _MakeParentAnd(parent.get())) &&
         accessor->second == pathNode) {
-        table.erase(accessor);
+        shard.erase(accessor);
     }
 }
 
@@ -220,9 +249,9 @@ TF_MAKE_STATIC_DATA(_PathTable, _mapperNodes) {}
 TF_MAKE_STATIC_DATA(_PathTable, _targetNodes) {}
 TF_MAKE_STATIC_DATA(_TokenTable, _mapperArgNodes) {}
 TF_MAKE_STATIC_DATA(_TokenTable, _primNodes) {
-    _primNodes->rehash(32768); }
+    _primNodes->RehashAll(32768); }
 TF_MAKE_STATIC_DATA(_TokenTable, _primPropertyNodes) {
-    _primPropertyNodes->rehash(32768); }
+    _primPropertyNodes->RehashAll(32768); }
 TF_MAKE_STATIC_DATA(_TokenTable, _relAttrNodes) {}
 TF_MAKE_STATIC_DATA(_VarSelTable, _primVarSelNodes) {}
 TF_MAKE_STATIC_DATA(_VoidTable, _expressionNodes) {}
@@ -563,9 +592,11 @@ _GatherChildrenFrom(Sdf_PathNode const *parent,
                     Table const &table,
                     vector<Sdf_PathNodeConstRefPtr> *result)
 {
-    TF_FOR_ALL(i, table) {
-        if (i->first.parent == parent)
-            result->push_back(i->second);
+    for (typename Table::Shard const &shard : table.shards) {
+        TF_FOR_ALL(i, shard) {
+            if (i->first.parent == parent)
+                result->push_back(i->second);
+        }
     }
 }
 
@@ -747,6 +747,35 @@ SdfSchemaBase::_RegisterStandardFields()
     _Define(SdfSpecTypeVariant)
         .CopyFrom(*GetSpecDefinition(SdfSpecTypePrim));
 
+    // The standard field set is now complete; seal it into the fast
+    // lookup table.  Plugin metadata fields registered afterwards only
+    // live in the dynamic map.
+    _BuildStandardFieldLookupTable();
+}
+
+void
+SdfSchemaBase::_BuildStandardFieldLookupTable()
+{
+    // Size the table to a power of two with a load factor of at most 1/2.
+    size_t size = 8;
+    while (size < _fieldDefinitions.size() * 2) {
+        size <<= 1;
+    }
+
+    _standardFieldTable.assign(
+        size, std::make_pair(TfToken(),
+                             static_cast<const FieldDefinition *>(nullptr)));
+
+    // The map is node-based, so the definitions' addresses remain stable
+    // as plugin fields are added to it later.
+    const size_t mask = size - 1;
+    TF_FOR_ALL(it, _fieldDefinitions) {
+        size_t bucket = it->first.Hash() & mask;
+        while (_standardFieldTable[bucket].second) {
+            bucket = (bucket + 1) & mask;
+        }
+        _standardFieldTable[bucket] = std::make_pair(it->first, &it->second);
+    }
 }
 
 SdfSchemaBase::FieldDefinition& 
@@ -807,9 +836,26 @@ SdfSchemaBase::_ExtendSpecDefinition(SdfSpecType specType)
     return _SpecDefiner(this, specDef);
 }
 
-const SdfSchemaBase::FieldDefinition* 
+const SdfSchemaBase::FieldDefinition*
 SdfSchemaBase::GetFieldDefinition(const TfToken &fieldKey) const
 {
+    // Standard fields are fixed once registered and served from the
+    // immutable probed table; plugin metadata fields (and misses) fall
+    // through to the dynamic map.
+    if (!_standardFieldTable.empty()) {
+        const size_t mask = _standardFieldTable.size() - 1;
+        for (size_t bucket = fieldKey.Hash() & mask; ;
+             bucket = (bucket + 1) & mask) {
+            const _StandardFieldTable::value_type &entry =
+                _standardFieldTable[bucket];
+            if (!entry.second) {
+                break;
+            }
+            if (entry.first == fieldKey) {
+                return entry.second;
+            }
+        }
+    }
     return TfMapLookupPtr(_fieldDefinitions, fieldKey);
 }
 
@@ -42,6 +42,7 @@
 
 #include <boost/function.hpp>
 #include <string>
+#include <utility>
 #include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -482,6 +483,10 @@ private:
 
     void _AddRequiredFieldName(const TfToken &name);
 
+    // Build the immutable probed table serving standard field lookups.
+    // Called once at the end of _RegisterStandardFields.
+    void _BuildStandardFieldLookupTable();
+
     const SpecDefinition* _CheckAndGetSpecDefinition(SdfSpecType type) const;
 
     friend struct Sdf_SchemaFieldTypeRegistrar;
@@ -498,11 +503,21 @@ private:
         const TfToken &fieldKey, const VtValue &fallback);
 
 private:
-    typedef TfHashMap<TfToken, SdfSchemaBase::FieldDefinition, 
-                                 TfToken::HashFunctor> 
+    typedef TfHashMap<TfToken, SdfSchemaBase::FieldDefinition,
+                                 TfToken::HashFunctor>
         _FieldDefinitionMap;
     _FieldDefinitionMap _fieldDefinitions;
-    
+
+    // Flat open-addressed table over the standard fields, sealed once they
+    // have all been registered.  Field lookups are on the spec validation
+    // and value authoring hot paths; serving the fixed standard set from
+    // an immutable power-of-two probed table keeps those lookups to a
+    // couple of contiguous probes and leaves the dynamic map to handle
+    // plugin metadata fields, which may be registered later.
+    typedef std::vector<std::pair<TfToken, const FieldDefinition *> >
+        _StandardFieldTable;
+    _StandardFieldTable _standardFieldTable;
+
     typedef TfHashMap<SdfSpecType, SdfSchemaBase::SpecDefinition, 
                                  TfHash> 
         _SpecDefinitionMap;
@@ -26,6 +26,7 @@
 
 #include "pxr/pxr.h"
 #include "pxr/usd/sdf/textFileFormat.h"
+#include "pxr/usd/sdf/textFileFormatParallel.h"
 #include "pxr/usd/sdf/fileIO.h"
 #include "pxr/usd/sdf/fileIO_Common.h"
 #include "pxr/usd/sdf/layer.h"
@@ -169,12 +170,23 @@ SdfTextFileFormat::Read(
     fseek(*fp, 0, SEEK_SET);
 
     SdfAbstractDataRefPtr data = InitData(layerBase->GetFileFormatArguments());
-    if (!Sdf_ParseMenva(resolvedPath, *fp, 
-                           GetFormatId(),
-                           GetVersionString(),
-                           metadataOnly,
-                           TfDynamic_cast<SdfDataRefPtr>(data))) {
-        return false;
+
+    // Large files are split at top-level prim boundaries and parsed
+    // concurrently when possible; if that's not applicable (or fails),
+    // fall back to the serial parser, which re-reports any errors with
+    // correct line numbers.
+    if (metadataOnly ||
+        !Sdf_ParseMenvaInParallel(resolvedPath, *fp,
+                                  GetFormatId(),
+                                  GetVersionString(),
+                                  TfDynamic_cast<SdfDataRefPtr>(data))) {
+        if (!Sdf_ParseMenva(resolvedPath, *fp,
+                            GetFormatId(),
+                            GetVersionString(),
+                            metadataOnly,
+                            TfDynamic_cast<SdfDataRefPtr>(data))) {
+            return false;
+        }
     }
 
     if (_LayerIsLoadingAsNew(layer)) {
@@ -323,6 +335,9 @@ SdfTextFileFormat::WriteToFile(
     // open file
     string reason;
     TfAtomicOfstreamWrapper wrapper(filePath);
+    // The text serializer makes many small writes; coalesce them into
+    // large sequential writes to the file system.
+    wrapper.SetBufferSize(1024 * 1024);
     if (!wrapper.Open(&reason)) {
         TF_RUNTIME_ERROR(reason);
         return false;
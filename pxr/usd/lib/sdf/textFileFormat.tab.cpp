@@ -105,6 +105,7 @@
 #include "pxr/pxr.h"
 #include "pxr/base/arch/errno.h"
 #include "pxr/base/arch/fileSystem.h"
+#include "pxr/base/arch/systemInfo.h"
 #include "pxr/base/vt/array.h"
 #include "pxr/base/vt/dictionary.h"
 #include "pxr/usd/sdf/allowed.h"
@@ -6505,6 +6506,7 @@ public:
 private:
     yy_buffer_state *_flexBuffer;
 
+    ArchMutableFileMapping _fileMapping;
     std::unique_ptr<char[]> _fileBuffer;
 
     yyscan_t _scanner;
@@ -6524,10 +6526,36 @@ Sdf_MemoryFlexBuffer::Sdf_MemoryFlexBuffer(FILE* file,
     }
 
     // flex requires 2 bytes of null padding at the end of any buffers it is
-    // given.  We'll allocate a buffer with 2 padding bytes, then read the
-    // entire file in.
+    // given.
     static const size_t paddingBytesRequired = 2;
 
+    // Prefer to scan the file in place from a copy-on-write private mapping
+    // rather than copying it into a file-sized heap buffer.  A private
+    // mapping is writable (as flex requires, since it temporarily pokes
+    // null terminators into the buffer while scanning) and zero-filled
+    // through the end of its final page, so unless the file size is within
+    // the padding of a page boundary the terminators flex needs after the
+    // contents can be written into the mapping directly.
+    const int64_t pageSize = ArchGetPageSize();
+    const int64_t lastPageBytes = fileSize % pageSize;
+    if (fileSize > 0 &&
+        lastPageBytes != 0 &&
+        lastPageBytes <= pageSize - static_cast<int64_t>(paddingBytesRequired)) {
+        ArchFileMappingOptions options;
+        options.advice = ArchMemAdviceSequential;
+        if (ArchMutableFileMapping mapping =
+                ArchMapFileReadWrite(file, options)) {
+            char* mapStart = mapping.get();
+            mapStart[fileSize] = mapStart[fileSize + 1] = '\0';
+            _fileMapping = std::move(mapping);
+            _flexBuffer = textFileFormatYy_scan_buffer(
+                mapStart, fileSize + paddingBytesRequired, _scanner);
+            return;
+        }
+        // Fall through to the copying path if the mapping failed.
+    }
+
+    // Allocate a buffer with 2 padding bytes, then read the entire file in.
     std::unique_ptr<char[]> buffer(new char[fileSize + paddingBytesRequired]);
 
     fseek(file, 0, SEEK_SET);
@@ -0,0 +1,408 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+///
+/// \file Sdf/textFileFormatParallel.cpp
+
+#include "pxr/pxr.h"
+#include "pxr/usd/sdf/textFileFormatParallel.h"
+#include "pxr/usd/sdf/abstractData.h"
+#include "pxr/usd/sdf/data.h"
+#include "pxr/usd/sdf/path.h"
+#include "pxr/usd/sdf/schema.h"
+
+#include "pxr/base/arch/fileSystem.h"
+#include "pxr/base/tf/errorMark.h"
+#include "pxr/base/tf/getenv.h"
+#include "pxr/base/tf/token.h"
+#include "pxr/base/tracelite/trace.h"
+#include "pxr/base/work/loops.h"
+#include "pxr/base/work/threadLimits.h"
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+// The reentrant YACC menva parser; each invocation carries all of its
+// state in a private context, so independent invocations may run
+// concurrently.
+extern bool Sdf_ParseMenvaFromString(
+    const std::string& menvaString,
+    const std::string& magicId,
+    const std::string& versionString,
+    PXR_NS::SdfDataRefPtr data);
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+// Scan \p buffer for the byte offsets at which top-level prim statements
+// begin, i.e. 'def', 'class' or 'over' keywords outside any string,
+// comment, asset reference or bracketed construct.  The menva grammar
+// only admits these keywords and 'reorder rootPrims' statements at the
+// top level, so a brace/quote-aware scan is sufficient to find safe
+// split points without running the real lexer.
+//
+// Returns false if the scan cannot confidently split the file: a
+// top-level reorder statement appearing between prims (it would land in
+// an arbitrary chunk and its effect on the layer would be lost), or a
+// construct left open at end-of-file.
+bool
+_ScanTopLevelPrimStarts(
+    const char* buffer, size_t size, std::vector<size_t>* primStarts)
+{
+    size_t depth = 0;
+    size_t i = 0;
+
+    auto isIdentChar = [](char c) {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+               (c >= '0' && c <= '9') || c == '_';
+    };
+
+    bool prevIsIdent = false;
+    while (i < size) {
+        const char c = buffer[i];
+
+        if (c == '#') {
+            // Comment (or the magic cookie line); runs to end-of-line.
+            while (i < size && buffer[i] != '\n') {
+                ++i;
+            }
+            prevIsIdent = false;
+            continue;
+        }
+
+        if (c == '"' || c == '\'') {
+            // Quoted string; triple-quoted strings may span lines and
+            // contain unbalanced brackets, so skip to the closing quote.
+            const char quote = c;
+            const bool triple =
+                i + 2 < size && buffer[i+1] == quote && buffer[i+2] == quote;
+            i += triple ? 3 : 1;
+            while (i < size) {
+                if (buffer[i] == '\\') {
+                    i += 2;
+                    continue;
+                }
+                if (buffer[i] == quote) {
+                    if (!triple) {
+                        ++i;
+                        break;
+                    }
+                    if (i + 2 < size &&
+                        buffer[i+1] == quote && buffer[i+2] == quote) {
+                        i += 3;
+                        break;
+                    }
+                }
+                else if (buffer[i] == '\n' && !triple) {
+                    // Unterminated single-line string; the real parser
+                    // will report it.
+                    break;
+                }
+                ++i;
+            }
+            if (i >= size) {
+                return false;
+            }
+            prevIsIdent = false;
+            continue;
+        }
+
+        if (c == '@') {
+            // Asset reference: @...@ or @@@...@@@.
+            const bool triple =
+                i + 2 < size && buffer[i+1] == '@' && buffer[i+2] == '@';
+            i += triple ? 3 : 1;
+            while (i < size) {
+                if (buffer[i] == '\\') {
+                    i += 2;
+                    continue;
+                }
+                if (buffer[i] == '@') {
+                    if (!triple) {
+                        ++i;
+                        break;
+                    }
+                    if (i + 2 < size &&
+                        buffer[i+1] == '@' && buffer[i+2] == '@') {
+                        i += 3;
+                        break;
+                    }
+                }
+                else if (buffer[i] == '\n' && !triple) {
+                    break;
+                }
+                ++i;
+            }
+            if (i >= size) {
+                return false;
+            }
+            prevIsIdent = false;
+            continue;
+        }
+
+        if (c == '(' || c == '[' || c == '{') {
+            ++depth;
+            ++i;
+            prevIsIdent = false;
+            continue;
+        }
+        if (c == ')' || c == ']' || c == '}') {
+            if (depth == 0) {
+                return false;
+            }
+            --depth;
+            ++i;
+            prevIsIdent = false;
+            continue;
+        }
+
+        if (depth == 0 && !prevIsIdent && isIdentChar(c) &&
+            !(c >= '0' && c <= '9')) {
+            size_t j = i + 1;
+            while (j < size && isIdentChar(buffer[j])) {
+                ++j;
+            }
+            const size_t len = j - i;
+            if ((len == 3 && strncmp(buffer + i, "def", 3) == 0) ||
+                (len == 4 && strncmp(buffer + i, "over", 4) == 0) ||
+                (len == 5 && strncmp(buffer + i, "class", 5) == 0)) {
+                primStarts->push_back(i);
+            }
+            else if (len == 7 && strncmp(buffer + i, "reorder", 7) == 0 &&
+                     !primStarts->empty()) {
+                // A reorder between prims would be swallowed by whatever
+                // chunk it lands in; let the serial parser handle it.
+                return false;
+            }
+            i = j;
+            prevIsIdent = true;
+            continue;
+        }
+
+        prevIsIdent = isIdentChar(c);
+        ++i;
+    }
+
+    return depth == 0;
+}
+
+// Visitor that copies every spec from one SdfData into another.  The
+// pseudo-root is skipped; its only shard-authored field (primChildren)
+// is merged separately to preserve file order across chunks.
+class _MergeSpecsVisitor : public SdfAbstractDataSpecVisitor
+{
+public:
+    explicit _MergeSpecsVisitor(SdfData* target) : _target(target) {}
+
+    virtual bool VisitSpec(
+        const SdfAbstractData& data, const SdfAbstractDataSpecId& id) override
+    {
+        if (id.GetFullSpecPath() == SdfPath::AbsoluteRootPath()) {
+            return true;
+        }
+        _target->CreateSpec(id, data.GetSpecType(id));
+        for (const TfToken& field : data.List(id)) {
+            _target->Set(id, field, data.Get(id, field));
+        }
+        return true;
+    }
+
+    virtual void Done(const SdfAbstractData&) override
+    {
+        // Do nothing
+    }
+
+private:
+    SdfData* _target;
+};
+
+// Append \p data's root prim names to \p rootPrimNames.
+void
+_AppendRootPrimNames(
+    const SdfDataRefPtr& data, std::vector<TfToken>* rootPrimNames)
+{
+    const SdfAbstractDataSpecId pseudoRootId(&SdfPath::AbsoluteRootPath());
+    const VtValue children =
+        data->Get(pseudoRootId, SdfChildrenKeys->PrimChildren);
+    if (children.IsHolding<std::vector<TfToken>>()) {
+        const std::vector<TfToken>& names =
+            children.UncheckedGet<std::vector<TfToken>>();
+        rootPrimNames->insert(rootPrimNames->end(), names.begin(), names.end());
+    }
+}
+
+} // end anonymous namespace
+
+bool
+Sdf_ParseMenvaInParallel(
+    const std::string& fileContext,
+    FILE* fin,
+    const std::string& magicId,
+    const std::string& versionString,
+    SdfDataRefPtr data)
+{
+    static const bool parallelParsingEnabled =
+        TfGetenvBool("SDF_TEXT_FILE_PARALLEL_PARSING", true);
+    static const int64_t minFileSize =
+        TfGetenvInt("SDF_TEXT_FILE_PARALLEL_PARSING_MIN_BYTES", 8 * 1024 * 1024);
+
+    if (!parallelParsingEnabled || WorkGetConcurrencyLimit() <= 1) {
+        return false;
+    }
+
+    const int64_t fileSize = ArchGetFileLength(fin);
+    if (fileSize < minFileSize) {
+        return false;
+    }
+
+    TRACE_FUNCTION();
+
+    // Map the file read-only and scan and slice it in place; only the
+    // chunk strings handed to the parsers are copied.
+    ArchFileMappingOptions mappingOptions;
+    mappingOptions.advice = ArchMemAdviceSequential;
+    ArchConstFileMapping mapping = ArchMapFileReadOnly(fin, mappingOptions);
+    if (!mapping) {
+        // Let the serial parser diagnose the failure.
+        return false;
+    }
+    const char* const buffer = mapping.get();
+
+    // Locate split points at top-level prim boundaries.
+    std::vector<size_t> primStarts;
+    {
+        TRACE_SCOPE("Sdf_ParseMenvaInParallel (scan)");
+        if (!_ScanTopLevelPrimStarts(buffer, fileSize, &primStarts) ||
+            primStarts.size() < 2) {
+            return false;
+        }
+    }
+
+    // The header chunk -- everything up to the first prim, including the
+    // magic cookie line and layer metadata -- parses as-is.  Every other
+    // chunk is a run of whole top-level prims with the file's own cookie
+    // line prepended so it forms a complete (metadata-free) layer.
+    const char* const cookieLineEnd =
+        static_cast<const char*>(memchr(buffer, '\n', fileSize));
+    if (!cookieLineEnd) {
+        return false;
+    }
+    const std::string cookieLine(
+        buffer, cookieLineEnd - buffer + 1);
+
+    // Group prims into chunks of roughly equal size, a few per worker so
+    // an unusually expensive chunk does not serialize the tail.
+    const size_t primBytes = fileSize - primStarts[0];
+    const size_t maxChunks =
+        std::min<size_t>(primStarts.size(), WorkGetConcurrencyLimit() * 4);
+    const size_t chunkGoal = std::max<size_t>(primBytes / maxChunks, 1);
+
+    std::vector<std::pair<size_t, size_t>> chunks;
+    {
+        size_t chunkBegin = primStarts[0];
+        for (size_t p = 1; p != primStarts.size(); ++p) {
+            if (primStarts[p] - chunkBegin >= chunkGoal) {
+                chunks.push_back(std::make_pair(chunkBegin, primStarts[p]));
+                chunkBegin = primStarts[p];
+            }
+        }
+        chunks.push_back(
+            std::make_pair(chunkBegin, static_cast<size_t>(fileSize)));
+    }
+
+    // Parse the header and every chunk concurrently, each into its own
+    // SdfData shard.  Chunk errors are discarded: the serial fallback
+    // will re-report them against correct line numbers.
+    const size_t numShards = chunks.size() + 1;
+    std::vector<SdfDataRefPtr> shards(numShards);
+    std::atomic<bool> anyFailed(false);
+    {
+        TRACE_SCOPE("Sdf_ParseMenvaInParallel (parse)");
+        WorkParallelForN(
+            numShards,
+            [&](size_t begin, size_t end) {
+                for (size_t i = begin; i != end; ++i) {
+                    if (anyFailed) {
+                        continue;
+                    }
+                    std::string chunkText;
+                    if (i == 0) {
+                        chunkText.assign(buffer, primStarts[0]);
+                    }
+                    else {
+                        const std::pair<size_t, size_t>& range = chunks[i-1];
+                        chunkText = cookieLine;
+                        chunkText.append(
+                            buffer + range.first,
+                            range.second - range.first);
+                    }
+
+                    SdfDataRefPtr shard = TfCreateRefPtr(new SdfData);
+                    TfErrorMark m;
+                    if (Sdf_ParseMenvaFromString(
+                            chunkText, magicId, versionString, shard)) {
+                        shards[i] = shard;
+                    }
+                    else {
+                        m.Clean();
+                        anyFailed = true;
+                    }
+                }
+            });
+    }
+    if (anyFailed) {
+        return false;
+    }
+
+    // Merge the shards.  The header shard contributes the pseudo-root
+    // and all of its fields; prim chunks contribute their specs, with
+    // root prim names concatenated in file order.
+    {
+        TRACE_SCOPE("Sdf_ParseMenvaInParallel (merge)");
+
+        const SdfAbstractDataSpecId pseudoRootId(&SdfPath::AbsoluteRootPath());
+        data->CreateSpec(pseudoRootId, SdfSpecTypePseudoRoot);
+        for (const TfToken& field : shards[0]->List(pseudoRootId)) {
+            data->Set(pseudoRootId, field, shards[0]->Get(pseudoRootId, field));
+        }
+
+        std::vector<TfToken> rootPrimNames;
+        _MergeSpecsVisitor visitor(get_pointer(data));
+        for (const SdfDataRefPtr& shard : shards) {
+            shard->VisitSpecs(&visitor);
+            _AppendRootPrimNames(shard, &rootPrimNames);
+        }
+        if (!rootPrimNames.empty()) {
+            data->Set(pseudoRootId, SdfChildrenKeys->PrimChildren,
+                      VtValue(rootPrimNames));
+        }
+    }
+
+    return true;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,64 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef SDF_TEXT_FILE_FORMAT_PARALLEL_H
+#define SDF_TEXT_FILE_FORMAT_PARALLEL_H
+
+/// \file sdf/textFileFormatParallel.h
+
+#include "pxr/pxr.h"
+#include "pxr/base/tf/declarePtrs.h"
+
+#include <cstdio>
+#include <string>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+TF_DECLARE_WEAK_AND_REF_PTRS(SdfData);
+
+/// Attempt to parse the menva file \p fin by splitting it at top-level
+/// prim boundaries and parsing the resulting chunks concurrently, merging
+/// the per-chunk results into \p data.
+///
+/// Since the menva parser is reentrant, each chunk can be parsed with an
+/// independent parser instance; only the final merge is serial.  The fast
+/// pre-scan that locates prim boundaries is conservative: if the file is
+/// small, the feature is disabled via SDF_TEXT_FILE_PARALLEL_PARSING, or
+/// the scan cannot confidently split the file (e.g. a top-level reorder
+/// statement between prims), this function returns false without touching
+/// \p data and the caller should fall back to the serial parser.  Any
+/// chunk parse failure also returns false with its errors discarded, so
+/// the serial parser can re-report them with correct line numbers.
+///
+/// Returns true only if the entire file was successfully parsed into
+/// \p data.
+bool Sdf_ParseMenvaInParallel(
+    const std::string& fileContext,
+    FILE* fin,
+    const std::string& magicId,
+    const std::string& versionString,
+    SdfDataRefPtr data);
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // SDF_TEXT_FILE_FORMAT_PARALLEL_H
@@ -26,11 +26,16 @@
 
 #include "pxr/usd/usd/stage.h"
 
+#include "pxr/usd/ar/resolverScopedCache.h"
 #include "pxr/usd/sdf/types.h"
+#include "pxr/base/tf/pyLock.h"
 #include "pxr/base/tracelite/trace.h"
+#include "pxr/base/work/loops.h"
 
 #include <boost/preprocessor/seq/for_each.hpp>
 
+#include <atomic>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 
@@ -149,7 +154,59 @@ UsdAttributeQuery::Get(VtValue* value, UsdTimeCode time) const
     return foundValue;
 }
 
-bool 
+bool
+UsdAttributeQuery::GetBatch(const std::vector<UsdAttributeQuery>& queries,
+                            std::vector<VtValue>* values,
+                            UsdTimeCode time)
+{
+    return GetBatch(queries, values, std::vector<UsdTimeCode>(1, time));
+}
+
+bool
+UsdAttributeQuery::GetBatch(const std::vector<UsdAttributeQuery>& queries,
+                            std::vector<VtValue>* values,
+                            const std::vector<UsdTimeCode>& times)
+{
+    TRACE_FUNCTION();
+
+    const size_t numTimes = times.size();
+    values->clear();
+    values->resize(queries.size() * numTimes);
+
+    if (queries.empty() || times.empty()) {
+        return true;
+    }
+
+    TF_PY_ALLOW_THREADS_IN_SCOPE();
+
+    // Share a single resolver cache scope across the batch so that asset
+    // resolution performed during value resolution (e.g. for clip layers
+    // or asset path values) is done at most once per asset.
+    ArResolverScopedCache resolverCache;
+
+    std::atomic<bool> allFound(true);
+    WorkParallelForN(
+        queries.size(),
+        [&queries, &times, numTimes, values, &allFound](
+            size_t begin, size_t end) {
+            for (size_t i = begin; i != end; ++i) {
+                const UsdAttributeQuery& query = queries[i];
+                if (!query.IsValid()) {
+                    allFound = false;
+                    continue;
+                }
+                for (size_t j = 0; j != numTimes; ++j) {
+                    if (!query.Get(&(*values)[i * numTimes + j], times[j])) {
+                        allFound = false;
+                    }
+                }
+            }
+        });
+
+    return allFound;
+}
+
+bool
 UsdAttributeQuery::GetTimeSamples(std::vector<double>* times) const
 {
     return _attr._GetStage()->_GetTimeSamplesInIntervalFromResolveInfo(
@@ -136,7 +136,36 @@ public:
     /// Type-erased access, often not as efficient as typed access.
     USD_API
     bool Get(VtValue* value, UsdTimeCode time = UsdTimeCode::Default()) const;
-    
+
+    /// Resolve values for all \p queries at \p time in one batch.
+    ///
+    /// \p values is resized to line up 1-to-1 with \p queries; entries for
+    /// queries that produce no value are left empty.  Returns true if every
+    /// query produced a value, false otherwise.
+    ///
+    /// This is equivalent to calling Get() on each query in turn, but a
+    /// single resolver cache scope is shared across the batch and large
+    /// batches are resolved in parallel, which substantially reduces
+    /// per-call overhead for consumers that pull many attributes per frame
+    /// (e.g. imaging population and sync).
+    USD_API
+    static bool GetBatch(const std::vector<UsdAttributeQuery>& queries,
+                         std::vector<VtValue>* values,
+                         UsdTimeCode time = UsdTimeCode::Default());
+
+    /// \overload
+    /// Resolve values for all \p queries at each time in \p times.
+    ///
+    /// \p values is resized to `queries.size() * times.size()` with the
+    /// values for `queries[i]` stored contiguously, i.e. the value for
+    /// `queries[i]` at `times[j]` is at index `i * times.size() + j`.
+    /// Returns true if every query produced a value at every time.
+    USD_API
+    static bool GetBatch(const std::vector<UsdAttributeQuery>& queries,
+                         std::vector<VtValue>* values,
+                         const std::vector<UsdTimeCode>& times);
+
+
     /// Populates a vector with authored sample times. 
     /// Returns false only on error. 
     //
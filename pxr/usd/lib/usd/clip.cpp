@@ -1225,12 +1225,21 @@ Usd_Clip::GetBracketingTimeSamplesForPath(
 std::set<Usd_Clip::InternalTime>
 Usd_Clip::_GetMergedTimeSamplesForPath(const SdfAbstractDataSpecId& id) const
 {
-    std::set<Usd_Clip::InternalTime> timeSamplesInClip = 
+    const SdfPath specPath = id.GetFullSpecPath();
+    _TimeSampleMap::const_iterator it = _timeSampleCache.find(specPath);
+    if (it != _timeSampleCache.end()) {
+        return *it->second;
+    }
+
+    std::set<Usd_Clip::InternalTime> timeSamplesInClip =
         _GetLayerForClip()->ListTimeSamplesForPath(_TranslateIdToClip(id).id);
     for (const TimeMapping& t : times) {
         timeSamplesInClip.insert(t.internalTime);
     }
 
+    _timeSampleCache.insert(std::make_pair(
+        specPath,
+        std::make_shared<const std::set<InternalTime> >(timeSamplesInClip)));
     return timeSamplesInClip;
 }
 
@@ -34,10 +34,13 @@
 
 #include <boost/optional.hpp>
 
+#include <tbb/concurrent_unordered_map.h>
+
 #include <iosfwd>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <set>
 #include <utility>
 #include <vector>
 
@@ -254,6 +257,19 @@ public:
     /// open, it will generally be kept open for the life of the stage.
     SdfLayerHandle GetLayerIfOpen() const;
 
+    /// Return true if this clip's layer has been opened (or created, for
+    /// clips whose layers failed to open), false otherwise.
+    bool HasOpenedLayer() const {
+        return _hasLayer;
+    }
+
+    /// Open this clip's layer if it is not already open.  Safe to call from
+    /// background threads; used to warm upcoming clips ahead of queries so
+    /// crossing a clip boundary does not stall on layer open.
+    void PrefetchLayer() const {
+        _GetLayerForClip();
+    }
+
     /// Layer stack, prim spec path, and index of layer where this clip
     /// was introduced.
     PcpLayerStackPtr sourceLayerStack;
@@ -317,6 +333,15 @@ private:
     mutable bool _hasLayer;
     mutable std::mutex _layerMutex;
     mutable SdfLayerRefPtr _layer;
+
+    // Cache of merged time samples per spec path.  A clip's contents are
+    // immutable once its layer is open (invalidation discards the whole
+    // Usd_Clip), so entries are only ever inserted; the concurrent map
+    // lets queries hit the cache without taking a lock.
+    typedef tbb::concurrent_unordered_map<
+        SdfPath, std::shared_ptr<const std::set<InternalTime> >,
+        SdfPath::Hash> _TimeSampleMap;
+    mutable _TimeSampleMap _timeSampleCache;
 };
 
 typedef std::shared_ptr<Usd_Clip> Usd_ClipRefPtr;
@@ -37,19 +37,63 @@
 
 #include "pxr/base/vt/array.h"
 #include "pxr/base/gf/vec2d.h"
+#include "pxr/base/tf/envSetting.h"
 #include "pxr/base/tf/ostreamMethods.h"
 
+#include <algorithm>
+#include <limits>
 #include <string>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
+TF_DEFINE_ENV_SETTING(
+    USD_CLIP_PREFETCH_COUNT, 2,
+    "Number of upcoming clip layers to open on background threads when "
+    "value resolution reads from a clip.  Zero disables prefetch.");
 
 Usd_ClipCache::Usd_ClipCache()
+    : _lastPrefetchTime(-std::numeric_limits<double>::max())
 {
 }
 
 Usd_ClipCache::~Usd_ClipCache()
 {
+    _prefetchDispatcher.Wait();
+}
+
+void
+Usd_ClipCache::PrefetchNeighboringClipLayers(
+    const Usd_ClipRefPtrVector& clips, size_t activeClipIndex,
+    double time) const
+{
+    static const size_t numToPrefetch =
+        std::max(0, TfGetEnvSetting(USD_CLIP_PREFETCH_COUNT));
+    if (numToPrefetch == 0 || clips.size() < 2) {
+        return;
+    }
+
+    const double lastTime = _lastPrefetchTime.exchange(time);
+    const bool forward = time >= lastTime;
+
+    for (size_t n = 1; n <= numToPrefetch; ++n) {
+        size_t idx;
+        if (forward) {
+            idx = activeClipIndex + n;
+            if (idx >= clips.size()) {
+                break;
+            }
+        } else {
+            if (activeClipIndex < n) {
+                break;
+            }
+            idx = activeClipIndex - n;
+        }
+
+        const Usd_ClipRefPtr& clip = clips[idx];
+        if (!clip->HasOpenedLayer()) {
+            _prefetchDispatcher.Run([clip]() { clip->PrefetchLayer(); });
+        }
+    }
 }
 
 struct Usd_ClipEntry {
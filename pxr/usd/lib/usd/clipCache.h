@@ -27,8 +27,10 @@
 #include "pxr/pxr.h"
 #include "pxr/usd/usd/clip.h"
 #include "pxr/usd/sdf/pathTable.h"
+#include "pxr/base/work/arenaDispatcher.h"
 
 #include <tbb/mutex.h>
+#include <atomic>
 #include <vector>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -94,9 +96,20 @@ public:
     /// The returned vector contains all clips that affect the prim at \p path
     /// in strength order. Each individual list of value clips will be ordered
     /// by start time.
-    const std::vector<Clips>& 
+    const std::vector<Clips>&
     GetClipsForPrim(const SdfPath& path) const;
 
+    /// Open the layers for the clips following \p clips[activeClipIndex] on
+    /// background threads, so that value resolution does not stall on a
+    /// layer open when it crosses into the next clip.  The direction of
+    /// travel is inferred from \p time relative to the previous call; the
+    /// number of clips warmed is controlled by USD_CLIP_PREFETCH_COUNT.
+    /// Clips whose layers are already open are skipped, so this is cheap
+    /// to call on every clip-valued query.
+    void PrefetchNeighboringClipLayers(
+        const Usd_ClipRefPtrVector& clips, size_t activeClipIndex,
+        double time) const;
+
     /// \struct Lifeboat
     ///
     /// Structure for keeping invalidated clip data alive.
@@ -124,6 +137,14 @@ private:
     typedef SdfPathTable<std::vector<Clips> >_ClipTable;
     _ClipTable _table;
     mutable tbb::mutex _mutex;
+
+    // Dispatcher running background clip layer opens; tasks hold their
+    // clips by refptr, so invalidation cannot leave them dangling.
+    mutable WorkArenaDispatcher _prefetchDispatcher;
+
+    // Most recent time passed to PrefetchNeighboringClipLayers, used to
+    // infer the direction of travel through time.
+    mutable std::atomic<double> _lastPrefetchTime;
 };
 
 
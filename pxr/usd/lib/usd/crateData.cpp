@@ -410,6 +410,20 @@ public:
         return false;
     }
 
+    inline const VtValue *
+    GetFieldRef(const SdfAbstractDataSpecId& id, const TfToken & field) const {
+        VtValue const *fieldValue = _GetFieldValue(id, field);
+        // Values still packed as ValueReps and time sample fields require
+        // transformation on read, so no stable reference can be exposed
+        // for them; callers fall back to Has()/Get().
+        if (fieldValue &&
+            (fieldValue->IsHolding<ValueRep>() ||
+             fieldValue->IsHolding<TimeSamples>())) {
+            return nullptr;
+        }
+        return fieldValue;
+    }
+
     inline VtValue Get(const SdfAbstractDataSpecId& id,
                        const TfToken & field) const {
         VtValue result;
@@ -590,6 +604,57 @@ public:
         return QueryTimeSample(id, time, &vtVal) && value->StoreValue(vtVal);
     }
 
+    // Stream over a TimeSamples object stored in a spec's timeSamples
+    // field.  In-memory values are handed out by reference; file-backed
+    // values are unpacked into a value owned by the stream, whose storage
+    // is reused from sample to sample.
+    class _TimeSampleStream : public SdfAbstractDataTimeSampleStream
+    {
+    public:
+        _TimeSampleStream(Usd_CrateDataImpl const *impl,
+                          TimeSamples const &samples)
+            : _impl(impl), _samples(&samples), _index(0) {}
+
+        virtual bool Next(double* time, const VtValue** value) {
+            auto const &times = _samples->times.Get();
+            if (_index == times.size())
+                return false;
+            *time = times[_index];
+            VtValue const *stored = _samples->IsInMemory() ?
+                &_samples->values[_index] : nullptr;
+            if (stored && !stored->IsHolding<ValueRep>()) {
+                *value = stored;
+            } else {
+                _value = _impl->_DetachValue(
+                    _impl->_crateFile->GetTimeSampleValue(*_samples, _index));
+                *value = &_value;
+            }
+            ++_index;
+            return true;
+        }
+
+    private:
+        Usd_CrateDataImpl const *_impl;
+        TimeSamples const *_samples;
+        size_t _index;
+        VtValue _value;
+    };
+
+    inline std::unique_ptr<SdfAbstractDataTimeSampleStream>
+    OpenTimeSampleStream(const SdfAbstractDataSpecId& id) const {
+        if (VtValue const *fieldValue =
+            _GetFieldValue(id, SdfDataTokens->TimeSamples)) {
+            if (fieldValue->IsHolding<TimeSamples>()) {
+                auto const &ts = fieldValue->UncheckedGet<TimeSamples>();
+                if (!ts.times.Get().empty()) {
+                    return std::unique_ptr<SdfAbstractDataTimeSampleStream>(
+                        new _TimeSampleStream(this, ts));
+                }
+            }
+        }
+        return std::unique_ptr<SdfAbstractDataTimeSampleStream>();
+    }
+
     inline void
     SetTimeSample(const SdfAbstractDataSpecId& id, double time,
                   const VtValue & value) {
@@ -691,19 +756,54 @@ private:
                 }),
             specs.end());
 
+        // Kick off unpacking of the live field sets now; that work only
+        // depends on the fields and fieldSets arrays, so it can proceed
+        // concurrently with the spec sort and hash table construction
+        // below.
+        typedef Usd_Shared<_FieldValuePairVector> SharedFieldValuePairVector;
+
+        unordered_map<
+            FieldSetIndex, SharedFieldValuePairVector, _Hasher> liveFieldSets;
+
+        for (auto fsBegin = fieldSets.begin(),
+                 fsEnd = find(fsBegin, fieldSets.end(), FieldIndex());
+             fsBegin != fieldSets.end();
+             fsBegin = fsEnd + 1,
+                 fsEnd = find(fsBegin, fieldSets.end(), FieldIndex())) {
+
+            // Add this range to liveFieldSets.
+            TfAutoMallocTag tag2("field data");
+            auto &fieldValuePairs =
+                liveFieldSets[FieldSetIndex(fsBegin-fieldSets.begin())];
+
+            dispatcher.Run(
+                [this, fsBegin, fsEnd, &fields, &fieldValuePairs]() mutable {
+                    // XXX Won't need first two tags when bug #132031 is
+                    // addressed
+                    TfAutoMallocTag2 tag("Usd", "Usd_CrateDataImpl::Open");
+                    TfAutoMallocTag tag2("field data");
+                    auto &pairs = fieldValuePairs.GetMutable();
+                    pairs.resize(fsEnd-fsBegin);
+                    for (size_t i = 0; fsBegin != fsEnd; ++fsBegin, ++i) {
+                        auto const &field = fields[fsBegin->value];
+                        pairs[i].first = _crateFile->GetToken(field.tokenIndex);
+                        pairs[i].second = _UnpackForField(field.valueRep);
+                    }
+                });
+        }
+
         // Sort by path fast-less-than, need same order that _Table will
-        // store.
-        dispatcher.Run([this, &specs]() {
-                tbb::parallel_sort(
-                    specs.begin(), specs.end(),
-                    [this](CrateFile::Spec const &l, CrateFile::Spec const &r) {
-                        SdfPath::FastLessThan flt;
-                        return flt(_crateFile->GetPath(l.pathIndex),
-                                   _crateFile->GetPath(r.pathIndex));
-                    });
+        // store.  Run the sort on this thread rather than through the
+        // dispatcher so we do not have to wait for the field set tasks
+        // spawned above.
+        tbb::parallel_sort(
+            specs.begin(), specs.end(),
+            [this](CrateFile::Spec const &l, CrateFile::Spec const &r) {
+                SdfPath::FastLessThan flt;
+                return flt(_crateFile->GetPath(l.pathIndex),
+                           _crateFile->GetPath(r.pathIndex));
             });
-        dispatcher.Wait();
-        
+
         // This function object just turns a CrateFile::Spec into the spec data
         // type that we want to store in _flatData.  It has to be a function
         // object instead of a lambda because boost::transform_iterator requires
@@ -753,38 +853,6 @@ private:
                 _flatTypes.resize(specs.size());
             });
 
-        typedef Usd_Shared<_FieldValuePairVector> SharedFieldValuePairVector;
-
-        unordered_map<
-            FieldSetIndex, SharedFieldValuePairVector, _Hasher> liveFieldSets;
-
-        for (auto fsBegin = fieldSets.begin(),
-                 fsEnd = find(fsBegin, fieldSets.end(), FieldIndex());
-             fsBegin != fieldSets.end();
-             fsBegin = fsEnd + 1,
-                 fsEnd = find(fsBegin, fieldSets.end(), FieldIndex())) {
-
-            // Add this range to liveFieldSets.
-            TfAutoMallocTag tag2("field data");
-            auto &fieldValuePairs =
-                liveFieldSets[FieldSetIndex(fsBegin-fieldSets.begin())];
-
-            dispatcher.Run(
-                [this, fsBegin, fsEnd, &fields, &fieldValuePairs]() mutable {
-                    // XXX Won't need first two tags when bug #132031 is
-                    // addressed
-                    TfAutoMallocTag2 tag("Usd", "Usd_CrateDataImpl::Open");
-                    TfAutoMallocTag tag2("field data");
-                    auto &pairs = fieldValuePairs.GetMutable();
-                    pairs.resize(fsEnd-fsBegin);
-                    for (size_t i = 0; fsBegin != fsEnd; ++fsBegin, ++i) {
-                        auto const &field = fields[fsBegin->value];
-                        pairs[i].first = _crateFile->GetToken(field.tokenIndex);
-                        pairs[i].second = _UnpackForField(field.valueRep);
-                    }
-                });
-        }
-
         dispatcher.Wait();
 
         dispatcher.Run(
@@ -1127,6 +1195,13 @@ Usd_CrateData::Has(const SdfAbstractDataSpecId& id,
     return _impl->Has(id, field, value);
 }
 
+const VtValue *
+Usd_CrateData::GetFieldRef(const SdfAbstractDataSpecId& id,
+                           const TfToken & field) const
+{
+    return _impl->GetFieldRef(id, field);
+}
+
 VtValue
 Usd_CrateData::Get(const SdfAbstractDataSpecId& id, const TfToken & field) const
 {
@@ -1195,6 +1270,12 @@ Usd_CrateData::GetBracketingTimeSamplesForPath(
     return _impl->GetBracketingTimeSamplesForPath(id, time, tLower, tUpper);
 }
 
+std::unique_ptr<SdfAbstractDataTimeSampleStream>
+Usd_CrateData::OpenTimeSampleStream(const SdfAbstractDataSpecId& id) const
+{
+    return _impl->OpenTimeSampleStream(id);
+}
+
 bool
 Usd_CrateData::QueryTimeSample(const SdfAbstractDataSpecId& id,
                                double time, VtValue *value) const
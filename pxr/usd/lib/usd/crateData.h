@@ -65,8 +65,10 @@ public:
                      SdfAbstractDataValue* value) const;
     virtual bool Has(const SdfAbstractDataSpecId& id, const TfToken& fieldName,
                      VtValue *value=NULL) const;
-    virtual VtValue Get(const SdfAbstractDataSpecId& id, 
+    virtual VtValue Get(const SdfAbstractDataSpecId& id,
                         const TfToken& fieldName) const;
+    virtual const VtValue* GetFieldRef(const SdfAbstractDataSpecId& id,
+                                       const TfToken& fieldName) const;
     virtual void Set(const SdfAbstractDataSpecId& id, const TfToken& fieldName,
                      const VtValue& value);
     virtual void Set(const SdfAbstractDataSpecId& id, const TfToken& fieldName,
@@ -95,6 +97,9 @@ public:
                                     double time,
                                     double* tLower, double* tUpper) const;
     
+    virtual std::unique_ptr<SdfAbstractDataTimeSampleStream>
+    OpenTimeSampleStream(const SdfAbstractDataSpecId& id) const;
+
     virtual bool
     QueryTimeSample(const SdfAbstractDataSpecId& id, double time,
                     SdfAbstractDataValue *value) const;
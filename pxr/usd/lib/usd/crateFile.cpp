@@ -78,6 +78,7 @@
 
 #include <tbb/concurrent_queue.h>
 
+#include <cstdint>
 #include <iostream>
 #include <memory>
 #include <tuple>
@@ -99,6 +100,50 @@ TF_DEFINE_ENV_SETTING(
     "equal minor and patch versions.  This is only for new files; saving "
     "edits to an existing file preserves its version.");
 
+TF_DEFINE_ENV_SETTING(
+    USDC_COMPRESSION, "lz4",
+    "The codec used when writing compressed sections in crate files.  "
+    "Valid values are 'lz4' and 'zstd'.  'zstd' requires a build with "
+    "PXR_ENABLE_ZSTD_SUPPORT and produces files that only zstd-enabled "
+    "builds can read; reading always auto-detects the codec.");
+
+static TfFastCompression::Codec
+_GetWriteCompressionCodec()
+{
+    static TfFastCompression::Codec codec = []() {
+        std::string setting = TfGetEnvSetting(USDC_COMPRESSION);
+        if (setting == "zstd") {
+            if (TfFastCompression::IsCodecSupported(TfFastCompression::Zstd)) {
+                return TfFastCompression::Zstd;
+            }
+            TF_WARN("USDC_COMPRESSION is 'zstd' but this build does not "
+                    "have Zstd support enabled; writing lz4 instead.");
+        } else if (setting != "lz4") {
+            TF_WARN("Unknown USDC_COMPRESSION value '%s'; writing lz4.",
+                    setting.c_str());
+        }
+        return TfFastCompression::LZ4;
+    }();
+    return codec;
+}
+
+TF_DEFINE_ENV_SETTING(
+    USDC_ENABLE_ZERO_COPY_ARRAYS, true,
+    "If enabled, large arrays of trivially-copyable types read from "
+    "memory-mapped crate files alias the mapping directly instead of "
+    "copying, until a client mutates them.");
+
+// Arrays smaller than this many bytes are copied rather than aliased; for
+// small arrays the bookkeeping costs more than the copy.
+constexpr size_t ZeroCopyArrayMinBytes = 2048;
+
+static bool
+_EnableZeroCopyArrays()
+{
+    static bool enabled = TfGetEnvSetting(USDC_ENABLE_ZERO_COPY_ARRAYS);
+    return enabled;
+}
+
 TF_DEFINE_ENV_SETTING(
     USDC_MMAP_PREFETCH_KB, 0,
     "If set to a nonzero value, attempt to disable the OS's prefetching "
@@ -410,7 +455,7 @@ template <> struct _IsBitwiseReadWrite<_ListOpHeader> : std::true_type {};
 struct _MmapStream {
     
     explicit _MmapStream(ArchConstFileMapping const &mapStart,
-                         char *debugPageMap)
+                         _DebugPageMap *debugPageMap)
         : _cur(mapStart.get())
         , _mapStart(mapStart.get())
         , _length(ArchGetFileMappingLength(mapStart))
@@ -426,7 +471,7 @@ struct _MmapStream {
         if (ARCH_UNLIKELY(_debugPageMap)) {
             int64_t pageStart = (_cur - _mapStart) / PAGESIZE;
             int64_t pageEnd = ((_cur + nBytes - 1 - _mapStart) / PAGESIZE) + 1;
-            memset(_debugPageMap + pageStart, 1, pageEnd-pageStart);
+            _debugPageMap->RecordRead(pageStart, pageEnd);
         }
 
         if (_prefetchKB) {
@@ -454,11 +499,24 @@ struct _MmapStream {
         ArchMemAdvise(_mapStart + offset, size, ArchMemAdviceWillNeed);
     }
 
+    // Return a pointer to \p nBytes at the current position in the mapping
+    // and advance past them, letting callers alias file content in place
+    // rather than copying it.
+    inline char const *GetZeroCopyRange(size_t nBytes) {
+        char const *result = _cur;
+        _cur += nBytes;
+        return result;
+    }
+    inline void PrefetchMany(ArchPReadRequest const *reqs, size_t numReqs) {
+        for (size_t i = 0; i != numReqs; ++i)
+            Prefetch(reqs[i].offset, reqs[i].count);
+    }
+
 private:
     char const *_cur;
     char const *_mapStart;
     size_t _length;
-    char *_debugPageMap;
+    _DebugPageMap *_debugPageMap;
     int _prefetchKB;
 };
 
@@ -472,6 +530,14 @@ struct _PreadStream {
     inline void Prefetch(int64_t offset, int64_t size) {
         ArchFileAdvise(_file, offset, size, ArchFileAdviceWillNeed);
     }
+    inline void PrefetchMany(ArchPReadRequest const *reqs, size_t numReqs) {
+        // Issue the reads concurrently to populate the file system cache;
+        // on high-latency storage this overlaps the per-extent round trips.
+        ArchPReadMultiple(_file, reqs, numReqs);
+    }
+
+    // Not a mapped stream -- no zero-copy ranges.
+    inline char const *GetZeroCopyRange(size_t) { return nullptr; }
 
 private:
     int64_t _cur;
@@ -841,6 +907,10 @@ public:
 
     void Prefetch(int64_t offset, int64_t size) { src.Prefetch(offset, size); }
 
+    void PrefetchMany(ArchPReadRequest const *reqs, size_t numReqs) {
+        src.PrefetchMany(reqs, numReqs);
+    }
+
     void Seek(uint64_t offset) { src.Seek(offset); }
 
     // Map helper.
@@ -1303,6 +1373,20 @@ struct CrateFile::_ArrayValueHandlerBase<
         if (array.empty())
             return result;
 
+        // Identity fast path.  Copies of an array share copy-on-write
+        // storage, so they can be deduplicated by data pointer without
+        // hashing or comparing contents.  The content table below retains
+        // each unique array as its key, which keeps the data pointer valid
+        // for the lifetime of the packing context.
+        if (!_arrayIdentityDedup) {
+            _arrayIdentityDedup.reset(
+                new typename decltype(_arrayIdentityDedup)::element_type);
+        }
+        auto identResult = _arrayIdentityDedup->emplace(array.cdata(), result);
+        if (!identResult.second) {
+            return identResult.first->second;
+        }
+
         if (!_arrayDedup) {
             _arrayDedup.reset(
                 new typename decltype(_arrayDedup)::element_type);
@@ -1311,11 +1395,31 @@ struct CrateFile::_ArrayValueHandlerBase<
         auto iresult = _arrayDedup->emplace(array, result);
         ValueRep &target = iresult.first->second;
         if (iresult.second) {
-            // Not yet present.
+            // Not yet present.  For large arrays, pad so the element data
+            // (which starts 8 bytes past the payload) lands on an 8-byte
+            // boundary, letting mmap readers alias it in place.  Readers
+            // locate data only through stored offsets, so the padding is
+            // invisible to older software.
+            if (array.size() * sizeof(T) >= ZeroCopyArrayMinBytes) {
+                static char const zeros[8] = { 0 };
+                size_t pad = (8 - (w.Tell() & 7)) & 7;
+                if (pad) {
+                    w.WriteContiguous(zeros, pad);
+                }
+            }
             target.SetPayload(w.Tell());
             w.WriteAs<uint32_t>(1);
             w.WriteAs<uint32_t>(array.size());
             w.WriteContiguous(array.data(), array.size());
+            identResult.first->second = target;
+        }
+        else {
+            // Equal content in different storage.  The content table does
+            // not retain this array's storage, so its data pointer may be
+            // recycled once the caller drops the array -- drop the identity
+            // entry rather than risk matching a future array at the same
+            // address.
+            _arrayIdentityDedup->erase(identResult.first);
         }
         return target;
     }
@@ -1330,7 +1434,36 @@ struct CrateFile::_ArrayValueHandlerBase<
         reader.Seek(rep.GetPayload());
         // Read and discard shape size.
         reader.template Read<uint32_t>();
-        out->resize(reader.template Read<uint32_t>());
+        size_t size = reader.template Read<uint32_t>();
+
+        // Large arrays of bitwise types read from a mapped file alias the
+        // mapping in place rather than copying, if the data is suitably
+        // aligned.  The resulting arrays pin the mapping until they are
+        // destroyed or detached by mutation.
+        size_t const numBytes = size * sizeof(T);
+        if (_IsBitwiseReadWrite<T>::value &&
+            numBytes >= ZeroCopyArrayMinBytes &&
+            _EnableZeroCopyArrays()) {
+            char const *data = reader.src.GetZeroCopyRange(numBytes);
+            if (data &&
+                (reinterpret_cast<uintptr_t>(data) % alignof(T)) == 0) {
+                std::shared_ptr<ArchConstFileMapping> mapping =
+                    reader.crate->_mapStart;
+                *out = VtArray<T>::FromForeignData(
+                    reinterpret_cast<T const *>(data), size,
+                    [mapping](T const *) {
+                        // The capture pins the file mapping; there is
+                        // nothing else to release.
+                    });
+                return;
+            }
+            if (data) {
+                // Unaligned -- rewind past the range we claimed and copy.
+                reader.Seek(rep.GetPayload() + 2*sizeof(uint32_t));
+            }
+        }
+
+        out->resize(size);
         reader.ReadContiguous(out->data(), out->size());
     }
 
@@ -1356,9 +1489,12 @@ struct CrateFile::_ArrayValueHandlerBase<
     void Clear() {
         // Invoke base implementation to clear scalar table.
         _ScalarValueHandlerBase<T>::Clear();
+        _arrayIdentityDedup.reset();
         _arrayDedup.reset();
     }
-    
+
+    std::unique_ptr<
+        std::unordered_map<T const *, ValueRep, _Hasher>> _arrayIdentityDedup;
     std::unique_ptr<
         std::unordered_map<VtArray<T>, ValueRep, _Hasher>> _arrayDedup;
 };
@@ -1406,7 +1542,13 @@ CrateFile::CreateNew()
 ArchConstFileMapping
 CrateFile::_MmapFile(char const *fileName, FILE *file)
 {
-    ArchConstFileMapping map = ArchMapFileReadOnly(file);
+    ArchFileMappingOptions options;
+    // Transparent huge pages reduce fault counts and TLB pressure for large
+    // crate files; pre-population trades open latency for fault-free reads.
+    // Both are opt-in since they can increase memory pressure.
+    options.requestHugePages = TfGetenvBool("USDC_MMAP_HUGE_PAGES", false);
+    options.populate = TfGetenvBool("USDC_MMAP_POPULATE", false);
+    ArchConstFileMapping map = ArchMapFileReadOnly(file, options);
     if (!map)
         TF_RUNTIME_ERROR("Couldn't map file '%s'", fileName);
     return map;
@@ -1467,7 +1609,7 @@ CrateFile::CrateFile(bool useMmap)
 }
 
 CrateFile::CrateFile(string const &fileName, ArchConstFileMapping mapStart)
-    : _mapStart(std::move(mapStart))
+    : _mapStart(std::make_shared<ArchConstFileMapping>(std::move(mapStart)))
     , _fileName(fileName)
     , _useMmap(true)
 {
@@ -1477,12 +1619,12 @@ CrateFile::CrateFile(string const &fileName, ArchConstFileMapping mapStart)
 
 void
 CrateFile::_InitMMap() {
-    if (_mapStart) {
-        int64_t fileSize = ArchGetFileMappingLength(_mapStart);
-        
+    if (_mapStart && *_mapStart) {
+        int64_t fileSize = ArchGetFileMappingLength(*_mapStart);
+
         // Mark the whole file as random access to start to avoid large NFS
         // prefetch.  We explicitly prefetch the structural sections later.
-        ArchMemAdvise(_mapStart.get(), fileSize, ArchMemAdviceRandomAccess);
+        ArchMemAdvise(_mapStart->get(), fileSize, ArchMemAdviceRandomAccess);
 
         // If we're debugging access, allocate a debug page map. 
         static string debugPageMapPattern = TfGetenv("USDC_DUMP_PAGE_MAPS");
@@ -1491,15 +1633,14 @@ CrateFile::_InitMMap() {
             (debugPageMapPattern == "*" || debugPageMapPattern == "1" ||
              ArchRegex(debugPageMapPattern, ArchRegex::GLOB).Match(_fileName))) {
             int64_t npages = (fileSize + PAGESIZE-1) / PAGESIZE;
-            _debugPageMap.reset(new char[npages]);
-            memset(_debugPageMap.get(), 0, npages);
-        } 
+            _debugPageMap.reset(new _DebugPageMap(npages));
+        }
 
         // Make an mmap stream but disable auto prefetching -- the
         // _ReadStructuralSections() call manages prefetching itself using
         // higher-level knowledge.
         auto reader = _MakeReader(
-            _MmapStream(_mapStart, _debugPageMap.get()).DisablePrefetch());
+            _MmapStream(*_mapStart, _debugPageMap.get()).DisablePrefetch());
         TfErrorMark m;
         _ReadStructuralSections(reader, fileSize);
         if (!m.IsClean())
@@ -1507,7 +1648,7 @@ CrateFile::_InitMMap() {
 
         // Restore default prefetch behavior if we're not doing custom prefetch.
         if (!_GetMMapPrefetchKB())
-            ArchMemAdvise(_mapStart.get(), fileSize, ArchMemAdviceNormal);
+            ArchMemAdvise(_mapStart->get(), fileSize, ArchMemAdviceNormal);
     } else {
         _fileName.clear();
     }
@@ -1542,11 +1683,11 @@ CrateFile::~CrateFile()
     static std::mutex outputMutex;
 
     // Dump a debug page map if requested.
-    if (_useMmap && _mapStart && _debugPageMap) {
-        int64_t length = ArchGetFileMappingLength(_mapStart);
+    if (_useMmap && _mapStart && *_mapStart && _debugPageMap) {
+        int64_t length = ArchGetFileMappingLength(*_mapStart);
         int64_t npages = (length + PAGESIZE-1) / PAGESIZE;
         std::unique_ptr<unsigned char []> mincoreMap(new unsigned char[npages]);
-        void const *p = static_cast<void const *>(_mapStart.get());
+        void const *p = static_cast<void const *>(_mapStart->get());
         if (!ArchQueryMappedMemoryResidency(p, length, mincoreMap.get())) {
             TF_WARN("failed to obtain memory residency information");
             return;
@@ -1556,7 +1697,8 @@ CrateFile::~CrateFile()
         int64_t pagesAccessed = 0;
         for (int64_t i = 0; i != npages; ++i) {
             bool inCore = mincoreMap[i] & 1;
-            bool accessed = _debugPageMap[i] & 1;
+            bool accessed = _debugPageMap->pageOrder[i].load(
+                std::memory_order_relaxed) != 0;
             pagesInCore += (int)inCore;
             pagesAccessed += (int)accessed;
             if (accessed && inCore) {
@@ -1596,7 +1738,49 @@ CrateFile::~CrateFile()
                 col = -1;
             }
         }
-        printf("\n<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<"
+
+        // Report first-touch order as runs of consecutively accessed pages,
+        // each tagged with the structural section it falls in.  Every run
+        // boundary is a seek on a cold open, which is what layout
+        // optimization tries to drive down -- see usddumpcrate --layout.
+        vector<pair<int64_t, int64_t>> accessOrder; // (order, page)
+        accessOrder.reserve(pagesAccessed);
+        for (int64_t i = 0; i != npages; ++i) {
+            int64_t order =
+                _debugPageMap->pageOrder[i].load(std::memory_order_relaxed);
+            if (order)
+                accessOrder.emplace_back(order, i);
+        }
+        std::sort(accessOrder.begin(), accessOrder.end());
+        auto sectionForPage = [this](int64_t page) -> char const * {
+            int64_t offset = page * PAGESIZE;
+            for (_Section const &s: _toc.sections) {
+                if (offset >= s.start && offset < s.start + s.size)
+                    return s.name;
+            }
+            return "<data>";
+        };
+        int64_t numRuns = accessOrder.empty() ? 0 : 1;
+        for (size_t i = 1; i < accessOrder.size(); ++i) {
+            if (accessOrder[i].second != accessOrder[i-1].second + 1)
+                ++numRuns;
+        }
+        printf("\nfirst-touch order: %zd pages in %zd runs "
+               "(%zd seeks on a cold open)\n",
+               pagesAccessed, numRuns, numRuns ? numRuns-1 : 0);
+        for (size_t i = 0; i != accessOrder.size(); ) {
+            size_t j = i + 1;
+            while (j != accessOrder.size() &&
+                   accessOrder[j].second == accessOrder[j-1].second + 1) {
+                ++j;
+            }
+            printf("  %16s pages %zd-%zd (%zd)\n",
+                   sectionForPage(accessOrder[i].second),
+                   accessOrder[i].second, accessOrder[j-1].second,
+                   static_cast<int64_t>(j - i));
+            i = j;
+        }
+        printf("<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<"
                "<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<<\n");
     }
 
@@ -1611,9 +1795,14 @@ CrateFile::StartPacking(string const &fileName)
     // We open the file using the TfSafeOutputFile helper so that we can avoid
     // stomping on the file for other processes currently observing it, in the
     // case that we're replacing it.  In the case where we're actually updating
-    // an existing file, we have no choice but to modify it in place.
+    // an existing file, we have no choice but to modify it in place -- unless
+    // zero-copy arrays still alias our mapping.  Updating in place would
+    // change those arrays' contents out from under their holders, so in that
+    // case we write a new file and rename it over, leaving the old inode (and
+    // the aliasing arrays) intact.
+    bool const haveZeroCopyAliases = _mapStart && !_mapStart.unique();
     TfErrorMark m;
-    auto out = _fileName.empty() ?
+    auto out = (_fileName.empty() || haveZeroCopyAliases) ?
         TfSafeOutputFile::Replace(fileName) :
         TfSafeOutputFile::Update(fileName);
     if (m.IsClean()) {
@@ -1661,10 +1850,14 @@ CrateFile::Packer::Close()
     // Reset the mapping or file so we can read values from the newly
     // written file.
     if (_crate->_useMmap) {
-        // Must remap the file.
-        _crate->_mapStart = _MmapFile(_crate->_fileName.c_str(), file.get());
-        if (!_crate->_mapStart)
+        // Must remap the file.  The old mapping object is left to any
+        // zero-copy arrays that still alias it.
+        ArchConstFileMapping newMap =
+            _MmapFile(_crate->_fileName.c_str(), file.get());
+        if (!newMap)
             return false;
+        _crate->_mapStart =
+            std::make_shared<ArchConstFileMapping>(std::move(newMap));
         _crate->_InitMMap();
     } else {
         // Must adopt the file handle if we don't already have one.
@@ -1922,7 +2115,7 @@ CrateFile::_GetTimeSampleValueImpl(TimeSamples const &ts, size_t i) const
     // Need to read the rep from the file for index i.
     auto offset = ts.valuesFileOffset + i * sizeof(ValueRep);
     if (_useMmap) {
-        auto reader = _MakeReader(_MmapStream(_mapStart, _debugPageMap.get()));
+        auto reader = _MakeReader(_MmapStream(*_mapStart, _debugPageMap.get()));
         reader.Seek(offset);
         return VtValue(reader.Read<ValueRep>());
     } else {
@@ -1938,7 +2131,7 @@ CrateFile::_MakeTimeSampleValuesMutableImpl(TimeSamples &ts) const
     // Read out the reps into the vector.
     ts.values.resize(ts.times.Get().size());
     if (_useMmap) {
-        auto reader = _MakeReader(_MmapStream(_mapStart, _debugPageMap.get()));
+        auto reader = _MakeReader(_MmapStream(*_mapStart, _debugPageMap.get()));
         reader.Seek(ts.valuesFileOffset);
         for (size_t i = 0, n = ts.times.Get().size(); i != n; ++i)
             ts.values[i] = reader.Read<ValueRep>();
@@ -1964,7 +2157,8 @@ CrateFile::_WriteFields(_Writer &w)
         // Total # of fields.
         w.WriteAs<uint64_t>(_fields.size());
 
-        // Token index values.
+        // The token index and value rep streams are independent, so
+        // compress them in parallel, then write the results in order.
         vector<uint32_t> tokenIndexVals(_fields.size());
         std::transform(_fields.begin(), _fields.end(),
                        tokenIndexVals.begin(),
@@ -1973,23 +2167,37 @@ CrateFile::_WriteFields(_Writer &w)
             new char[Usd_IntegerCompression::
                      GetCompressedBufferSize(tokenIndexVals.size())]);
 
-        size_t tokenIndexesSize = Usd_IntegerCompression::CompressToBuffer(
-            tokenIndexVals.data(), tokenIndexVals.size(), compBuffer.get());
-        w.WriteAs<uint64_t>(tokenIndexesSize);
-        w.WriteContiguous(compBuffer.get(), tokenIndexesSize);
-
-        // ValueReps.
         vector<uint64_t> reps(_fields.size());
         std::transform(_fields.begin(), _fields.end(),
                        reps.begin(),
                        [](Field const &f) { return f.valueRep.data; });
 
+        TfFastCompression::Codec codec = _GetWriteCompressionCodec();
         std::unique_ptr<char[]> compBuffer2(
             new char[TfFastCompression::
-                     GetCompressedBufferSize(reps.size() * sizeof(reps[0]))]);
-        uint64_t repsSize = TfFastCompression::CompressToBuffer(
-            reinterpret_cast<char *>(reps.data()),
-            compBuffer2.get(), reps.size() * sizeof(reps[0]));
+                     GetCompressedBufferSize(reps.size() * sizeof(reps[0]),
+                                             codec)]);
+
+        size_t tokenIndexesSize = 0;
+        uint64_t repsSize = 0;
+        WorkArenaDispatcher wd;
+        wd.Run([&tokenIndexesSize, &tokenIndexVals, &compBuffer]() {
+                tokenIndexesSize = Usd_IntegerCompression::CompressToBuffer(
+                    tokenIndexVals.data(), tokenIndexVals.size(),
+                    compBuffer.get());
+            });
+        wd.Run([&repsSize, &reps, &compBuffer2, codec]() {
+                repsSize = TfFastCompression::CompressToBuffer(
+                    reinterpret_cast<char *>(reps.data()),
+                    compBuffer2.get(), reps.size() * sizeof(reps[0]), codec);
+            });
+        wd.Wait();
+
+        // Token index values.
+        w.WriteAs<uint64_t>(tokenIndexesSize);
+        w.WriteContiguous(compBuffer.get(), tokenIndexesSize);
+
+        // ValueReps.
         w.WriteAs<uint64_t>(repsSize);
         w.WriteContiguous(compBuffer2.get(), repsSize);
     }
@@ -2064,38 +2272,48 @@ CrateFile::_WriteSpecs(_Writer &w)
         w.Write(_specs);
     } else {
         // Version 0.4.0 introduces compressed specs.  We write three lists of
-        // integers here, pathIndexes, fieldSetIndexes, specTypes.
-        std::unique_ptr<char[]> compBuffer(
-            new char[Usd_IntegerCompression::
-                     GetCompressedBufferSize(_specs.size())]);
-        vector<uint32_t> tmp(_specs.size());
-        
-        // Total # of specs.
-        w.WriteAs<uint64_t>(_specs.size());
-        
-        // pathIndexes.
-        std::transform(_specs.begin(), _specs.end(), tmp.begin(),
+        // integers here, pathIndexes, fieldSetIndexes, specTypes.  The three
+        // streams are independent, so compress them in parallel, then write
+        // the results in order.
+        vector<uint32_t> pathIndexes(_specs.size());
+        vector<uint32_t> fsetIndexes(_specs.size());
+        vector<uint32_t> specTypes(_specs.size());
+        std::transform(_specs.begin(), _specs.end(), pathIndexes.begin(),
                        [](Spec const &s) { return s.pathIndex.value; });
-        size_t pathIndexesSize = Usd_IntegerCompression::CompressToBuffer(
-            tmp.data(), tmp.size(), compBuffer.get());
-        w.WriteAs<uint64_t>(pathIndexesSize);
-        w.WriteContiguous(compBuffer.get(), pathIndexesSize);
-        
-        // fieldSetIndexes.
-        std::transform(_specs.begin(), _specs.end(), tmp.begin(),
+        std::transform(_specs.begin(), _specs.end(), fsetIndexes.begin(),
                        [](Spec const &s) { return s.fieldSetIndex.value; });
-        size_t fsetIndexesSize = Usd_IntegerCompression::CompressToBuffer(
-            tmp.data(), tmp.size(), compBuffer.get());
-        w.WriteAs<uint64_t>(fsetIndexesSize);
-        w.WriteContiguous(compBuffer.get(), fsetIndexesSize);
-        
-        // specTypes.
-        std::transform(_specs.begin(), _specs.end(), tmp.begin(),
+        std::transform(_specs.begin(), _specs.end(), specTypes.begin(),
                        [](Spec const &s) { return s.specType; });
-        size_t specTypesSize = Usd_IntegerCompression::CompressToBuffer(
-            tmp.data(), tmp.size(), compBuffer.get());
-        w.WriteAs<uint64_t>(specTypesSize);
-        w.WriteContiguous(compBuffer.get(), specTypesSize);
+
+        size_t const bufSize =
+            Usd_IntegerCompression::GetCompressedBufferSize(_specs.size());
+        std::unique_ptr<char[]> compBuffers[] = {
+            std::unique_ptr<char[]>(new char[bufSize]),
+            std::unique_ptr<char[]>(new char[bufSize]),
+            std::unique_ptr<char[]>(new char[bufSize])
+        };
+
+        size_t compSizes[3] = { 0, 0, 0 };
+        vector<uint32_t> const *streams[] = {
+            &pathIndexes, &fsetIndexes, &specTypes };
+        WorkArenaDispatcher wd;
+        for (int i = 0; i != 3; ++i) {
+            wd.Run([i, &compSizes, &streams, &compBuffers]() {
+                    compSizes[i] = Usd_IntegerCompression::CompressToBuffer(
+                        streams[i]->data(), streams[i]->size(),
+                        compBuffers[i].get());
+                });
+        }
+        wd.Wait();
+
+        // Total # of specs.
+        w.WriteAs<uint64_t>(_specs.size());
+
+        // pathIndexes, fieldSetIndexes, specTypes.
+        for (int i = 0; i != 3; ++i) {
+            w.WriteAs<uint64_t>(compSizes[i]);
+            w.WriteContiguous(compBuffers[i].get(), compSizes[i]);
+        }
     }
 }
 
@@ -2276,29 +2494,44 @@ CrateFile::_WriteCompressedPathData(_Writer &w, Container const &pathVec)
         index, pathVec.begin(), pathVec.end(),
         pathIndexes, elementTokenIndexes, jumps);
 
-    // Compress and store the arrays.
-    std::unique_ptr<char[]> compBuffer(
-        new char[Usd_IntegerCompression::
-                 GetCompressedBufferSize(pathVec.size())]);
+    // Compress the three arrays in parallel, then write the results in
+    // order.
+    size_t const bufSize =
+        Usd_IntegerCompression::GetCompressedBufferSize(pathVec.size());
+    std::unique_ptr<char[]> compBuffers[] = {
+        std::unique_ptr<char[]>(new char[bufSize]),
+        std::unique_ptr<char[]>(new char[bufSize]),
+        std::unique_ptr<char[]>(new char[bufSize])
+    };
+
+    uint64_t pathIndexesSize = 0, elemToksSize = 0, jumpsSize = 0;
+    WorkArenaDispatcher wd;
+    wd.Run([&pathIndexesSize, &pathIndexes, &compBuffers]() {
+            pathIndexesSize = Usd_IntegerCompression::CompressToBuffer(
+                pathIndexes.data(), pathIndexes.size(), compBuffers[0].get());
+        });
+    wd.Run([&elemToksSize, &elementTokenIndexes, &compBuffers]() {
+            elemToksSize = Usd_IntegerCompression::CompressToBuffer(
+                elementTokenIndexes.data(), elementTokenIndexes.size(),
+                compBuffers[1].get());
+        });
+    wd.Run([&jumpsSize, &jumps, &compBuffers]() {
+            jumpsSize = Usd_IntegerCompression::CompressToBuffer(
+                jumps.data(), jumps.size(), compBuffers[2].get());
+        });
+    wd.Wait();
 
     // pathIndexes.
-    uint64_t pathIndexesSize = Usd_IntegerCompression::CompressToBuffer(
-        pathIndexes.data(), pathIndexes.size(), compBuffer.get());
     w.WriteAs<uint64_t>(pathIndexesSize);
-    w.WriteContiguous(compBuffer.get(), pathIndexesSize);
+    w.WriteContiguous(compBuffers[0].get(), pathIndexesSize);
 
     // elementTokenIndexes.
-    uint64_t elemToksSize = Usd_IntegerCompression::CompressToBuffer(
-        elementTokenIndexes.data(), elementTokenIndexes.size(),
-        compBuffer.get());
     w.WriteAs<uint64_t>(elemToksSize);
-    w.WriteContiguous(compBuffer.get(), elemToksSize);
+    w.WriteContiguous(compBuffers[1].get(), elemToksSize);
 
     // jumps.
-    uint64_t jumpsSize = Usd_IntegerCompression::CompressToBuffer(
-        jumps.data(), jumps.size(), compBuffer.get());
     w.WriteAs<uint64_t>(jumpsSize);
-    w.WriteContiguous(compBuffer.get(), jumpsSize);
+    w.WriteContiguous(compBuffers[2].get(), jumpsSize);
 }
 
 void
@@ -2325,10 +2558,12 @@ CrateFile::_WriteTokens(_Writer &w) {
             tokenData.insert(tokenData.end(), cstr, cstr + str.size() + 1);
         }
         w.WriteAs<uint64_t>(tokenData.size());
+        TfFastCompression::Codec codec = _GetWriteCompressionCodec();
         std::unique_ptr<char[]> compressed(
-            new char[TfFastCompression::GetCompressedBufferSize(tokenData.size())]);
+            new char[TfFastCompression::GetCompressedBufferSize(
+                tokenData.size(), codec)]);
         uint64_t compressedSize = TfFastCompression::CompressToBuffer(
-            tokenData.data(), compressed.get(), tokenData.size());
+            tokenData.data(), compressed.get(), tokenData.size(), codec);
         w.WriteAs<uint64_t>(compressedSize);
         w.WriteContiguous(compressed.get(), compressedSize);
     }
@@ -2380,18 +2615,17 @@ template <class Reader>
 void
 CrateFile::_PrefetchStructuralSections(Reader reader) const
 {
-    // Go through the _toc and find its maximal range, then ask the reader to
-    // prefetch that range.
-    int64_t min = -1, max = -1;
+    // Go through the _toc and ask the reader to prefetch each section's
+    // extent as a batch, so gaps between sections are skipped and the
+    // pread-based reader can overlap the fetches.
+    vector<ArchPReadRequest> extents;
+    extents.reserve(_toc.sections.size());
     for (_Section const &sec: _toc.sections) {
-        if (min == -1 || (sec.start < min))
-            min = sec.start;
-        int64_t end = sec.start + sec.size;
-        if (max == -1 || (end > max))
-            max = end;
+        extents.push_back(ArchPReadRequest {
+                nullptr, static_cast<size_t>(sec.size), sec.start });
     }
-    if (min != -1 && max != -1)
-        reader.Prefetch(min, max-min);
+    if (!extents.empty())
+        reader.PrefetchMany(extents.data(), extents.size());
 }
 
 template <class Reader>
@@ -2810,7 +3044,7 @@ void
 CrateFile::_ReadRawBytes(int64_t start, int64_t size, char *buf) const
 {
     if (_useMmap) {
-        auto reader = _MakeReader(_MmapStream(_mapStart, _debugPageMap.get()));
+        auto reader = _MakeReader(_MmapStream(*_mapStart, _debugPageMap.get()));
         reader.Seek(start);
         reader.template ReadContiguous<char>(buf, size);
     } else {
@@ -2972,7 +3206,7 @@ CrateFile::_UnpackValue(ValueRep rep, T *out) const
 {
     auto const &h = _GetValueHandler<T>();
     if (_useMmap) {
-        h.Unpack(_MakeReader(_MmapStream(_mapStart,
+        h.Unpack(_MakeReader(_MmapStream(*_mapStart,
                                          _debugPageMap.get())), rep, out);
     } else {
         h.Unpack(_MakeReader(_PreadStream(_inputFile.get())), rep, out);
@@ -2984,7 +3218,7 @@ void
 CrateFile::_UnpackValue(ValueRep rep, VtArray<T> *out) const {
     auto const &h = _GetValueHandler<T>();
     if (_useMmap) {
-        h.UnpackArray(_MakeReader(_MmapStream(_mapStart,
+        h.UnpackArray(_MakeReader(_MmapStream(*_mapStart,
                                               _debugPageMap.get())), rep, out);
     } else {
         h.UnpackArray(_MakeReader(_PreadStream(_inputFile.get())), rep, out);
@@ -3057,7 +3291,7 @@ void CrateFile::_DoTypeRegistration() {
     _unpackValueFunctionsMmap[typeEnumIndex] =
         [this, valueHandler](ValueRep rep, VtValue *out) {
             valueHandler->UnpackVtValue(
-                _MakeReader(_MmapStream(_mapStart,
+                _MakeReader(_MmapStream(*_mapStart,
                                         _debugPageMap.get())), rep, out);
         };
 
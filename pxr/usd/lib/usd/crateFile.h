@@ -43,8 +43,10 @@
 
 #include <tbb/spin_rw_mutex.h>
 
+#include <atomic>
 #include <cstdint>
 #include <iosfwd>
+#include <memory>
 #include <string>
 #include <type_traits>
 #include <typeindex>
@@ -262,6 +264,34 @@ struct _Hasher {
     }
 };
 
+// Debug page-access record, allocated by CrateFile when USDC_DUMP_PAGE_MAPS
+// requests it.  For each page of the mapped file we record the order in which
+// that page was first read (1-based; 0 means never read), so in addition to
+// coverage the CrateFile destructor can report the access pattern that a
+// representative open produces.  See usddumpcrate --layout.
+struct _DebugPageMap {
+    explicit _DebugPageMap(int64_t numPages)
+        : pageOrder(new std::atomic<int64_t>[numPages])
+        , accessCounter(0) {
+        for (int64_t i = 0; i != numPages; ++i)
+            pageOrder[i].store(0, std::memory_order_relaxed);
+    }
+
+    // Record a read touching pages [pageStart, pageEnd).  Only the first read
+    // of each page is recorded; later reads leave its order unchanged.
+    inline void RecordRead(int64_t pageStart, int64_t pageEnd) {
+        for (int64_t i = pageStart; i != pageEnd; ++i) {
+            if (pageOrder[i].load(std::memory_order_relaxed) == 0) {
+                int64_t expected = 0;
+                pageOrder[i].compare_exchange_strong(expected, ++accessCounter);
+            }
+        }
+    }
+
+    std::unique_ptr<std::atomic<int64_t> []> pageOrder;
+    std::atomic<int64_t> accessCounter;
+};
+
 class CrateFile
 {
 public:
@@ -727,14 +757,17 @@ private:
     _BootStrap _boot; // only valid if we read a file.
 
     // We'll only have one of these, depending on whether we're doing mmap() or
-    // pread().
-    ArchConstFileMapping _mapStart; // NULL if this wasn't populated from file.
+    // pread().  The mapping is held by shared_ptr since zero-copy arrays
+    // handed out by UnpackValue() alias it and must keep it alive after this
+    // object remaps or is destroyed.
+    std::shared_ptr<ArchConstFileMapping>
+        _mapStart; // NULL if this wasn't populated from file.
     _UniqueFILE _inputFile; // NULL if this wasn't populated from file.
 
     std::string _fileName; // Empty if this file data is in-memory only.
 
-    std::unique_ptr<char []> _debugPageMap; // Debug page access map, see
-                                            // USDC_DUMP_PAGE_MAPS.
+    std::unique_ptr<_DebugPageMap> _debugPageMap; // Debug page access map, see
+                                                  // USDC_DUMP_PAGE_MAPS.
 
     const bool _useMmap; // If true, use mmap for reads, otherwise use pread.
 };
@@ -71,9 +71,12 @@ Usd_InstanceCache::RegisterInstancePrimIndex(const PcpPrimIndex& index)
     const bool masterAlreadyExists = 
         (keyToMasterIt != _instanceKeyToMasterMap.end());
 
-    tbb::spin_mutex::scoped_lock lock(_mutex);
+    // Only the shard this key lands in needs to be locked; the key's
+    // hash was computed at construction, above, outside the lock.
+    _PendingAddShard& shard = _pendingAddedPrimIndexes[_GetShardIndex(key)];
+    tbb::spin_mutex::scoped_lock lock(shard.mutex);
 
-    _PrimIndexPaths& pendingIndexes = _pendingAddedPrimIndexes[key];
+    _PrimIndexPaths& pendingIndexes = shard.map[key];
     pendingIndexes.push_back(index.GetPath());
 
     // A new master must be created for this instance if one doesn't
@@ -123,9 +126,11 @@ Usd_InstanceCache::ProcessChanges(Usd_InstanceChanges* changes)
 
         // Ignore any unregistered prim index that was subsequently
         // re-registered.
-        _InstanceKeyToPrimIndexesMap::const_iterator registeredIt = 
-            _pendingAddedPrimIndexes.find(key);
-        if (registeredIt != _pendingAddedPrimIndexes.end()) {
+        const _InstanceKeyToPrimIndexesMap& addedMap =
+            _pendingAddedPrimIndexes[_GetShardIndex(key)].map;
+        _InstanceKeyToPrimIndexesMap::const_iterator registeredIt =
+            addedMap.find(key);
+        if (registeredIt != addedMap.end()) {
             _PrimIndexPaths registered = registeredIt->second;
             _PrimIndexPaths unregistered;
             unregistered.swap(primIndexes);
@@ -148,26 +153,29 @@ Usd_InstanceCache::ProcessChanges(Usd_InstanceChanges* changes)
         // ensure we have a consistent assignment of instances to masters.
         typedef std::map<SdfPath, Usd_InstanceKey> _PrimIndexPathToKey;
         std::map<SdfPath, Usd_InstanceKey> keysToProcess;
-        for (_InstanceKeyToPrimIndexesMap::value_type& v:
-                 _pendingAddedPrimIndexes) {
-            const Usd_InstanceKey& key = v.first;
-            const _PrimIndexPaths& primIndexes = v.second;
-            if (TF_VERIFY(!primIndexes.empty())) {
-                TF_VERIFY(
-                    keysToProcess.emplace(primIndexes.front(), key).second);
+        for (_PendingAddShard& shard: _pendingAddedPrimIndexes) {
+            for (_InstanceKeyToPrimIndexesMap::value_type& v: shard.map) {
+                const Usd_InstanceKey& key = v.first;
+                const _PrimIndexPaths& primIndexes = v.second;
+                if (TF_VERIFY(!primIndexes.empty())) {
+                    TF_VERIFY(
+                        keysToProcess.emplace(primIndexes.front(), key).second);
+                }
             }
         }
 
         for (const _PrimIndexPathToKey::value_type& v: keysToProcess) {
             const Usd_InstanceKey& key = v.second;
-            _PrimIndexPaths& primIndexes = _pendingAddedPrimIndexes[key];
+            _PrimIndexPaths& primIndexes =
+                _pendingAddedPrimIndexes[_GetShardIndex(key)].map[key];
             _CreateOrUpdateMasterForInstances(key, &primIndexes, changes);
         }
     }
     else {
-        for(_InstanceKeyToPrimIndexesMap::value_type& v:
-                _pendingAddedPrimIndexes) {
-            _CreateOrUpdateMasterForInstances(v.first, &v.second, changes);
+        for (_PendingAddShard& shard: _pendingAddedPrimIndexes) {
+            for (_InstanceKeyToPrimIndexesMap::value_type& v: shard.map) {
+                _CreateOrUpdateMasterForInstances(v.first, &v.second, changes);
+            }
         }
     }
 
@@ -177,7 +185,9 @@ Usd_InstanceCache::ProcessChanges(Usd_InstanceChanges* changes)
         _RemoveMasterIfNoInstances(v.first, changes);
     }
 
-    _pendingAddedPrimIndexes.clear();
+    for (_PendingAddShard& shard: _pendingAddedPrimIndexes) {
+        shard.map.clear();
+    }
     _pendingRemovedPrimIndexes.clear();
 }
 
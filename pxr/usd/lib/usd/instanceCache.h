@@ -215,8 +215,6 @@ private:
     SdfPath _GetNextMasterPath(const Usd_InstanceKey& key);
     
 private:
-    tbb::spin_mutex _mutex;
-
     // Mapping from instance key <-> master prim path.
     // This stores the path of the master prim that should be used
     // for all instanceable prim indexes with the given instance key.
@@ -244,14 +242,33 @@ private:
     _PrimIndexToMasterMap _primIndexToMasterMap;
 
     // Map from instance key -> list of prim index paths
-    // These maps contain lists of pending changes and are the only containers 
+    // These maps contain lists of pending changes and are the only containers
     // that should be modified during registration and unregistration.
     typedef TfHashMap<
-        Usd_InstanceKey, _PrimIndexPaths, boost::hash<Usd_InstanceKey> > 
+        Usd_InstanceKey, _PrimIndexPaths, boost::hash<Usd_InstanceKey> >
         _InstanceKeyToPrimIndexesMap;
-    _InstanceKeyToPrimIndexesMap _pendingAddedPrimIndexes;
+
+    // Pending registrations are sharded by instance key hash so that
+    // concurrent registration during parallel composition does not
+    // serialize on a single mutex.  A key always lands in the same
+    // shard, so the first-registration check in
+    // RegisterInstancePrimIndex only needs that shard's lock.
+    static const size_t _NumShards = 32;
+    struct _PendingAddShard {
+        tbb::spin_mutex mutex;
+        _InstanceKeyToPrimIndexesMap map;
+    };
+    _PendingAddShard _pendingAddedPrimIndexes[_NumShards];
+
+    // Unregistration only happens during single-threaded change
+    // processing, so the removal map is not sharded.
     _InstanceKeyToPrimIndexesMap _pendingRemovedPrimIndexes;
 
+    // Returns the shard that pending registrations for \p key land in.
+    static size_t _GetShardIndex(const Usd_InstanceKey& key) {
+        return hash_value(key) % _NumShards;
+    }
+
     // Index of last master prim created. Used to create
     // master prim names.
     size_t _lastMasterIndex;
@@ -31,6 +31,7 @@ PXR_NAMESPACE_OPEN_SCOPE
 
 Usd_InstanceKey::Usd_InstanceKey()
 {
+    _ComputeHash();
 }
 
 Usd_InstanceKey::Usd_InstanceKey(const PcpPrimIndex& instance)
@@ -40,12 +41,14 @@ Usd_InstanceKey::Usd_InstanceKey(const PcpPrimIndex& instance)
     if (Usd_ResolveClipInfo(instance, &clipInfo)) {
         _clipInfo.swap(clipInfo);
     }
+    _ComputeHash();
 }
 
-bool 
+bool
 Usd_InstanceKey::operator==(const Usd_InstanceKey& rhs) const
 {
-    return _pcpInstanceKey == rhs._pcpInstanceKey &&
+    return _hash == rhs._hash &&
+        _pcpInstanceKey == rhs._pcpInstanceKey &&
         _clipInfo == rhs._clipInfo;
 }
 
@@ -55,14 +58,18 @@ Usd_InstanceKey::operator!=(const Usd_InstanceKey& rhs) const
     return !(*this == rhs);
 }
 
-size_t hash_value(const Usd_InstanceKey& key)
+void
+Usd_InstanceKey::_ComputeHash()
 {
-    size_t hash = hash_value(key._pcpInstanceKey);
-    for (const Usd_ResolvedClipInfo& clipInfo: key._clipInfo) {
-        boost::hash_combine(hash, clipInfo.GetHash());
+    _hash = hash_value(_pcpInstanceKey);
+    for (const Usd_ResolvedClipInfo& clipInfo: _clipInfo) {
+        boost::hash_combine(_hash, clipInfo.GetHash());
     }
+}
 
-    return hash;
+size_t hash_value(const Usd_InstanceKey& key)
+{
+    return key._hash;
 }
 
 PXR_NAMESPACE_CLOSE_SCOPE
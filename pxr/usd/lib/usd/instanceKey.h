@@ -56,7 +56,9 @@ public:
     bool operator==(const Usd_InstanceKey& rhs) const;
     bool operator!=(const Usd_InstanceKey& rhs) const;
 
-    /// Returns the hash value for this instance key.
+    /// Returns the hash value for this instance key.  The hash is
+    /// computed once at construction, so it can be retrieved under
+    /// contention without recomputing it.
     friend size_t hash_value(const Usd_InstanceKey& key);
 
     /// Returns string representation of this instance key
@@ -64,8 +66,13 @@ public:
     std::string GetString() const;
 
 private:
+    // Computes and stores the hash for this key.  Called from the
+    // constructors, so the expensive part happens outside any lock.
+    void _ComputeHash();
+
     PcpInstanceKey _pcpInstanceKey;
     std::vector<Usd_ResolvedClipInfo> _clipInfo;
+    size_t _hash;
 };
 
 
@@ -22,6 +22,7 @@
 // language governing permissions and limitations under the Apache License.
 //
 #include "pxr/pxr.h"
+#include "pxr/base/arch/defines.h"
 #include "pxr/base/tf/diagnostic.h"
 #include "pxr/base/tf/fastCompression.h"
 #include "pxr/usd/usd/integerCoding.h"
@@ -32,6 +33,15 @@
 #include <memory>
 #include <unordered_map>
 
+// The SSSE3 decode kernel is compiled with the target attribute so it does
+// not raise the ISA floor of the build; it is only invoked after a runtime
+// CPU feature check.
+#if defined(ARCH_CPU_INTEL) && defined(__SSE2__) && \
+    (defined(__GNUC__) || defined(__clang__)) && !defined(ARCH_OS_WINDOWS)
+#include <tmmintrin.h>
+#define USD_INTEGERCODING_USE_SSE
+#endif
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 /*
@@ -279,6 +289,106 @@ _EncodeIntegers(Int const *begin, size_t numInts, char *output)
     return vintsOut - output;
 }
 
+#ifdef USD_INTEGERCODING_USE_SSE
+
+static bool
+_SupportsSsse3()
+{
+    static bool supported = __builtin_cpu_supports("ssse3");
+    return supported;
+}
+
+// Per-code-byte tables driving the SSSE3 decode kernel.  For each of the
+// 256 possible code bytes we precompute a pshufb mask that gathers the
+// variable-width delta bytes into the low end of four 32-bit lanes, the
+// per-lane constants that sign-extend 8- and 16-bit deltas, a mask
+// selecting the lanes that take the common value, and the total number of
+// variable-length bytes the code byte consumes.
+struct _SseTables
+{
+    _SseTables() {
+        static const int lens[] = { 0, 1, 2, 4 };
+        for (int code = 0; code != 256; ++code) {
+            memset(shuffle[code], 0x80, sizeof(shuffle[code]));
+            int offset = 0;
+            for (int i = 0; i != 4; ++i) {
+                int c = (code >> (2 * i)) & 3;
+                int len = lens[c];
+                for (int b = 0; b != len; ++b) {
+                    shuffle[code][4 * i + b] =
+                        static_cast<int8_t>(offset + b);
+                }
+                offset += len;
+                signFix[code][i] =
+                    (c == 1) ? 0x80 : (c == 2) ? 0x8000 : 0;
+                commonMask[code][i] = (c == 0) ? -1 : 0;
+            }
+            vintLen[code] = static_cast<uint8_t>(offset);
+        }
+    }
+
+    alignas(16) int8_t shuffle[256][16];
+    alignas(16) int32_t signFix[256][4];
+    alignas(16) int32_t commonMask[256][4];
+    uint8_t vintLen[256];
+};
+
+// Decode \p numGroups full groups of 4 integers.  The caller guarantees
+// that reading 16 bytes from \p vintsIn at the start of every group stays
+// within the encoded buffer: the buffer reserves 4 bytes per integer, so
+// with 4 or more integers left at least 16 bytes of capacity remain.
+__attribute__((target("ssse3")))
+static void
+_DecodeIntegersSse(char const *&codesIn, char const *&vintsIn,
+                   int32_t commonValue, size_t numGroups,
+                   int32_t &prevVal, uint32_t *&output)
+{
+    static _SseTables const tables;
+
+    __m128i commonVec = _mm_set1_epi32(commonValue);
+    __m128i prevVec = _mm_set1_epi32(prevVal);
+
+    for (size_t i = 0; i != numGroups; ++i) {
+        uint8_t codeByte = static_cast<uint8_t>(*codesIn++);
+
+        // Gather this group's deltas into four 32-bit lanes, zero-extended.
+        __m128i raw = _mm_loadu_si128(
+            reinterpret_cast<__m128i const *>(vintsIn));
+        __m128i deltas = _mm_shuffle_epi8(
+            raw, _mm_load_si128(
+                reinterpret_cast<__m128i const *>(
+                    tables.shuffle[codeByte])));
+
+        // Sign-extend the 8- and 16-bit lanes: (x ^ s) - s with s the
+        // lane's sign bit.
+        __m128i signBits = _mm_load_si128(
+            reinterpret_cast<__m128i const *>(tables.signFix[codeByte]));
+        deltas = _mm_sub_epi32(_mm_xor_si128(deltas, signBits), signBits);
+
+        // Common-value lanes decoded to zero above; fill them in.
+        deltas = _mm_add_epi32(
+            deltas, _mm_and_si128(
+                commonVec, _mm_load_si128(
+                    reinterpret_cast<__m128i const *>(
+                        tables.commonMask[codeByte]))));
+
+        // Inclusive prefix sum across the four lanes, then add the
+        // running value.
+        deltas = _mm_add_epi32(deltas, _mm_slli_si128(deltas, 4));
+        deltas = _mm_add_epi32(deltas, _mm_slli_si128(deltas, 8));
+        deltas = _mm_add_epi32(deltas, prevVec);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(output), deltas);
+        output += 4;
+        prevVec = _mm_shuffle_epi32(deltas, _MM_SHUFFLE(3, 3, 3, 3));
+        vintsIn += tables.vintLen[codeByte];
+    }
+
+    prevVal = _mm_cvtsi128_si32(prevVec);
+}
+
+#endif // USD_INTEGERCODING_USE_SSE
+
 template <class Int>
 size_t _DecodeIntegers(char const *data, size_t numInts, Int *result)
 {
@@ -294,6 +404,24 @@ size_t _DecodeIntegers(char const *data, size_t numInts, Int *result)
 
     SInt prevVal = 0;
     auto intsLeft = numInts;
+
+#ifdef USD_INTEGERCODING_USE_SSE
+    // Decode all full groups of 4 with the vectorized kernel when the CPU
+    // supports it; signed and unsigned decode are identical bit patterns,
+    // since everything is two's complement addition mod 2^32.
+    if (intsLeft >= 4 && _SupportsSsse3()) {
+        size_t numGroups = intsLeft / 4;
+        int32_t prev = static_cast<int32_t>(prevVal);
+        uint32_t *out = reinterpret_cast<uint32_t *>(result);
+        _DecodeIntegersSse(codesIn, vintsIn,
+                           static_cast<int32_t>(commonValue),
+                           numGroups, prev, out);
+        result = reinterpret_cast<Int *>(out);
+        prevVal = static_cast<SInt>(prev);
+        intsLeft -= numGroups * 4;
+    }
+#endif
+
     while (intsLeft >= 4) {
         _DecodeNHelper<4>(codesIn, vintsIn, commonValue, prevVal, result);
         intsLeft -= 4;
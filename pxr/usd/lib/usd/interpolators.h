@@ -30,6 +30,7 @@
 #include "pxr/usd/usd/valueUtils.h"
 #include "pxr/usd/sdf/layer.h"
 #include "pxr/base/gf/math.h"
+#include "pxr/base/vt/arraySimd.h"
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -176,6 +177,28 @@ Usd_Lerp(double alpha, const GfQuatd &lower, const GfQuatd &upper)
     return GfSlerp(alpha, lower, upper);
 }
 
+/// Lerp the elements of \p lower in place against \p upper, leaving the
+/// result in \p lower.  The Vt_SimdLerp kernels handle arrays of float,
+/// double, GfVec3f, and GfMatrix4d (selecting an instruction set at
+/// runtime); the generic overloads decline, and every other element type
+/// takes the per-element Usd_Lerp loop.
+template <class T>
+inline void
+Usd_LerpArrayInPlace(double alpha, VtArray<T>* lower, const VtArray<T> &upper)
+{
+    if (lower->empty()) {
+        return;
+    }
+
+    T* dst = lower->data();
+    const T* src = upper.cdata();
+    if (!Vt_SimdLerp(alpha, dst, src, dst, lower->size())) {
+        for (size_t i = 0, j = lower->size(); i != j; ++i) {
+            dst[i] = Usd_Lerp(alpha, dst[i], src[i]);
+        }
+    }
+}
+
 /// \class Usd_LinearInterpolator
 ///
 /// Object implementing linear interpolation for attribute values.
@@ -304,13 +327,22 @@ private:
         }
 
         const double parametricTime = (time - lower) / (upper - lower);
-        for (size_t i = 0, j = _result->size(); i != j; ++i) {
-            (*_result)[i] = Usd_Lerp(
-                parametricTime, (*_result)[i], upperValue[i]);
+
+        // If the requested time lands exactly on one of the bracketing
+        // samples there is nothing to blend; hand back that sample as-is.
+        // This keeps _result sharing storage with the queried value rather
+        // than detaching it with per-element writes.
+        if (parametricTime == 0.0) {
+            return true;
+        }
+        if (parametricTime == 1.0) {
+            _result->swap(upperValue);
+            return true;
         }
 
+        Usd_LerpArrayInPlace(parametricTime, _result, upperValue);
         return true;
-    }        
+    }
 
 private:
     VtArray<T>* _result;
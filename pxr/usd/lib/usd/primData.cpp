@@ -25,6 +25,7 @@
 #include "pxr/usd/usd/prim.h"
 
 #include "pxr/usd/usd/debugCodes.h"
+#include "pxr/usd/usd/resolver.h"
 #include "pxr/usd/usd/schemaBase.h"
 #include "pxr/usd/usd/schemaRegistry.h"
 #include "pxr/usd/usd/stage.h"
@@ -119,10 +120,34 @@ Usd_PrimData::_ComposeAndCacheFlags(Usd_PrimDataConstPtr parent,
         _flags[Usd_PrimMasterFlag] = isMasterPrim;
     } 
     else {
-        // Compose and cache 'active'.
-        UsdPrim self(Usd_PrimDataIPtr(this), SdfPath());
+        // Compose and cache 'active', and 'kind' if the model hierarchy
+        // rules below will need it.  Neither field is list-edited and
+        // 'active' has a constant fallback (true), so the strongest
+        // authored opinion wins and we can resolve both fields in a single
+        // walk over the prim index instead of two generic GetMetadata
+        // resolutions -- this runs for every prim on the stage.
         bool active = true;
-        self.GetMetadata(SdfFieldKeys->Active, &active);
+        TfToken kind;
+        {
+            bool foundActive = false, foundKind = false;
+            const bool wantKind = parent->IsGroup();
+            for (Usd_Resolver res(_primIndex); res.IsValid();
+                 res.NextLayer()) {
+                if (!foundActive &&
+                    res.GetLayer()->HasField(
+                        res.GetLocalPath(), SdfFieldKeys->Active, &active)) {
+                    foundActive = true;
+                }
+                if (wantKind && !foundKind &&
+                    res.GetLayer()->HasField(
+                        res.GetLocalPath(), SdfFieldKeys->Kind, &kind)) {
+                    foundKind = true;
+                }
+                if (foundActive && (foundKind || !wantKind)) {
+                    break;
+                }
+            }
+        }
         _flags[Usd_PrimActiveFlag] = active;
 
         // Cache whether or not this prim has a payload.
@@ -141,15 +166,10 @@ Usd_PrimData::_ComposeAndCacheFlags(Usd_PrimDataConstPtr parent,
         // Group, then this prim cannot be a model (or a model group).
         // Otherwise we look up the kind metadata and consult the kind registry.
         bool isGroup = false, isModel = false;
-        if (parent->IsGroup()) {
-            static TfToken kindToken("kind");
-            TfToken kind;
-            self.GetMetadata(kindToken, &kind);
+        if (parent->IsGroup() && !kind.IsEmpty()) {
             // Use the kind registry to determine model/groupness.
-            if (!kind.IsEmpty()) {
-                isGroup = KindRegistry::IsA(kind, KindTokens->group);
-                isModel = isGroup || KindRegistry::IsA(kind, KindTokens->model);
-            }
+            isGroup = KindRegistry::IsA(kind, KindTokens->group);
+            isModel = isGroup || KindRegistry::IsA(kind, KindTokens->model);
         }
         _flags[Usd_PrimGroupFlag] = isGroup;
         _flags[Usd_PrimModelFlag] = isModel;
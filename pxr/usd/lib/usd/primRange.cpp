@@ -28,6 +28,9 @@
 #include "pxr/usd/usd/stage.h"
 
 #include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/tf/pyLock.h"
+#include "pxr/base/tracelite/trace.h"
+#include "pxr/base/work/arenaDispatcher.h"
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -49,6 +52,58 @@ UsdPrimRange::Stage(const UsdStagePtr &stage,
     return ret;
 }
 
+namespace {
+
+// Helper for UsdPrimRange::ParallelForEach: visits one prim and spawns a
+// task per child subtree on the shared dispatcher, which work-steals the
+// subtrees across the worker threads.
+struct _ParallelVisitor
+{
+    void VisitSubtree(UsdPrim prim) {
+        if (!(*func)(prim)) {
+            return;
+        }
+        for (const auto &child : prim.GetFilteredChildren(predicate)) {
+            dispatcher.Run(&_ParallelVisitor::VisitSubtree, this, child);
+        }
+    }
+
+    WorkArenaDispatcher dispatcher;
+    Usd_PrimFlagsPredicate predicate;
+    std::function<bool (UsdPrim const &)> const *func;
+};
+
+} // anonymous namespace
+
+void
+UsdPrimRange::ParallelForEach(
+    const std::function<bool (UsdPrim const &)> &func) const
+{
+    TRACE_FUNCTION();
+
+    if (_postOrder) {
+        TF_CODING_ERROR("Pre- and post-order ranges cannot be traversed "
+                        "in parallel");
+        return;
+    }
+
+    TF_PY_ALLOW_THREADS_IN_SCOPE();
+
+    _ParallelVisitor visitor;
+    visitor.predicate = _predicate;
+    visitor.func = &func;
+
+    // Seed a task per top-level prim in the range.  Pruning at every prim
+    // makes the serial iterator enumerate exactly those prims: the range's
+    // root for subtree ranges, or each root prim for Stage() ranges.
+    for (iterator it = begin(); it != end(); ++it) {
+        visitor.dispatcher.Run(
+            &_ParallelVisitor::VisitSubtree, &visitor, *it);
+        it.PruneChildren();
+    }
+    visitor.dispatcher.Wait();
+}
+
 void
 UsdPrimRange::iterator::PruneChildren()
 {
@@ -30,6 +30,7 @@
 #include "pxr/usd/usd/prim.h"
 #include "pxr/usd/usd/primFlags.h"
 
+#include <functional>
 #include <vector>
 #include <iterator>
 
@@ -349,6 +350,21 @@ public:
     /// Return true if this range contains one or more prims, false otherwise.
     explicit operator bool() const { return !empty(); }
 
+    /// Call \p func for every prim in this range, fanning independent
+    /// subtrees out to worker threads.
+    ///
+    /// Return true from \p func to continue into the prim's children;
+    /// returning false behaves as iterator::PruneChildren() does for serial
+    /// iteration: the prim's subtree is skipped.  Parents are always
+    /// visited before their children, but no other visitation order is
+    /// guaranteed, and \p func must be safe to call concurrently.
+    ///
+    /// Pre- and post-order ranges are not supported; calling this on one
+    /// issues a coding error and visits nothing.
+    USD_API
+    void ParallelForEach(
+        const std::function<bool (UsdPrim const &)> &func) const;
+
     /// Return true if this range is equivalent to \p other.
     bool operator==(UsdPrimRange const &other) const {
         return this == &other ||
@@ -37,7 +37,9 @@
 #include "pxr/usd/sdf/relationshipSpec.h"
 #include "pxr/usd/sdf/schema.h"
 
+#include "pxr/base/arch/fileSystem.h"
 #include "pxr/base/tf/fileUtils.h"
+#include "pxr/base/tf/getenv.h"
 #include "pxr/base/tf/instantiateSingleton.h"
 #include "pxr/base/tf/registryManager.h"
 #include "pxr/base/tf/token.h"
@@ -107,15 +109,80 @@ _AddSchema(SdfLayerRefPtr const &source, SdfLayerRefPtr const &target,
     }
 }
 
+static string
+_GetGeneratedSchemaPath(const PlugPluginPtr &plugin)
+{
+    return TfStringCatPaths(plugin->GetResourcePath(),
+                            "generatedSchema.usda");
+}
+
 static SdfLayerRefPtr
 _GetGeneratedSchema(const PlugPluginPtr &plugin)
 {
     // Look for generatedSchema in Resources.
-    const string fname = TfStringCatPaths(plugin->GetResourcePath(),
-                                          "generatedSchema.usda");
+    const string fname = _GetGeneratedSchemaPath(plugin);
     return TfIsFile(fname) ? SdfLayer::OpenAsAnonymous(fname) : TfNullPtr;
 }
 
+// Composing the schematics from every plugin's generatedSchema.usda costs
+// tens of milliseconds of text parsing per process.  When
+// USD_SCHEMA_CACHE_PATH names a crate (.usdc) file, the composed schematics
+// are exported there once and later processes map that file directly,
+// skipping the parse and composition entirely.  The cache carries a
+// signature -- the path and mtime of every plugin's generatedSchema file --
+// in its custom layer data and is ignored if any schema changed.
+
+static string
+_GetSchemaCachePath()
+{
+    return TfGetenv("USD_SCHEMA_CACHE_PATH");
+}
+
+static VtDictionary
+_ComputeSchemaCacheSignature(const std::vector<PlugPluginPtr> &plugins)
+{
+    VtDictionary signature;
+    for (const PlugPluginPtr &plugin : plugins) {
+        const string fname = _GetGeneratedSchemaPath(plugin);
+        double mtime;
+        if (ArchGetModificationTime(fname.c_str(), &mtime)) {
+            signature[fname] = mtime;
+        }
+    }
+    return signature;
+}
+
+static SdfLayerRefPtr
+_ReadCachedSchematics(const VtDictionary &signature)
+{
+    const string cachePath = _GetSchemaCachePath();
+    if (cachePath.empty() || !TfIsFile(cachePath)) {
+        return TfNullPtr;
+    }
+
+    SdfLayerRefPtr cached = SdfLayer::OpenAsAnonymous(cachePath);
+    if (!cached || cached->GetCustomLayerData() != signature) {
+        return TfNullPtr;
+    }
+    return cached;
+}
+
+static void
+_WriteCachedSchematics(const SdfLayerRefPtr &schematics,
+                       const VtDictionary &signature)
+{
+    const string cachePath = _GetSchemaCachePath();
+    if (cachePath.empty()) {
+        return;
+    }
+
+    // Export writes through a temporary file and renames it into place, so
+    // concurrent processes racing to fill the cache are safe; last writer
+    // wins with identical content.
+    schematics->SetCustomLayerData(signature);
+    schematics->Export(cachePath);
+}
+
 void
 UsdSchemaRegistry::_BuildPrimTypePropNameToSpecIdMap(
     const TfToken &typeName, const SdfPath &primPath)
@@ -166,33 +233,46 @@ UsdSchemaRegistry::_FindAndAddPluginSchema()
         }
     }
     
-    // For each plugin, if it has generated schema, add it to the schematics.
-    std::vector<SdfLayerRefPtr> generatedSchemas(plugins.size());
-    {
-        WorkArenaDispatcher dispatcher;
-        dispatcher.Run([&plugins, &generatedSchemas]() {
-            WorkParallelForN(
-                plugins.size(), 
-                [&plugins, &generatedSchemas](size_t begin, size_t end) {
-                    for (; begin != end; ++begin) {
-                        generatedSchemas[begin] = 
-                            _GetGeneratedSchema(plugins[begin]);
-                    }
+    // If a cached binary schematics file matches the current set of schema
+    // files, use it in place of the anonymous layer and skip parsing and
+    // composing the per-plugin schemas entirely.
+    const VtDictionary cacheSignature = _ComputeSchemaCacheSignature(plugins);
+    if (SdfLayerRefPtr cached = _ReadCachedSchematics(cacheSignature)) {
+        _schematics = cached;
+    } else {
+        // For each plugin, if it has generated schema, add it to the
+        // schematics.
+        std::vector<SdfLayerRefPtr> generatedSchemas(plugins.size());
+        {
+            WorkArenaDispatcher dispatcher;
+            dispatcher.Run([&plugins, &generatedSchemas]() {
+                WorkParallelForN(
+                    plugins.size(),
+                    [&plugins, &generatedSchemas](size_t begin, size_t end) {
+                        for (; begin != end; ++begin) {
+                            generatedSchemas[begin] =
+                                _GetGeneratedSchema(plugins[begin]);
+                        }
+                    });
                 });
-            });
-    }
-
-    // Get list of disallowed fields in schemas and sort them so that
-    // helper functions in _AddSchema can binary search through them.
-    std::vector<TfToken> disallowedFields = GetDisallowedFields();
-    std::sort(disallowedFields.begin(), disallowedFields.end(),
-              TfTokenFastArbitraryLessThan());
+        }
 
-    SdfChangeBlock block;
-    for (const SdfLayerRefPtr& generatedSchema : generatedSchemas) {
-        if (generatedSchema) {
-            _AddSchema(generatedSchema, _schematics, disallowedFields);
+        // Get list of disallowed fields in schemas and sort them so that
+        // helper functions in _AddSchema can binary search through them.
+        std::vector<TfToken> disallowedFields = GetDisallowedFields();
+        std::sort(disallowedFields.begin(), disallowedFields.end(),
+                  TfTokenFastArbitraryLessThan());
+
+        {
+            SdfChangeBlock block;
+            for (const SdfLayerRefPtr& generatedSchema : generatedSchemas) {
+                if (generatedSchema) {
+                    _AddSchema(generatedSchema, _schematics, disallowedFields);
+                }
+            }
         }
+
+        _WriteCachedSchematics(_schematics, cacheSignature);
     }
 
     // Add them to the type -> path and typeName -> path maps, and the type ->
@@ -48,6 +48,7 @@
 
 #include "pxr/usd/pcp/changes.h"
 #include "pxr/usd/pcp/errors.h"
+#include "pxr/usd/pcp/layerPrefetchRequest.h"
 #include "pxr/usd/pcp/layerStack.h"
 #include "pxr/usd/pcp/layerStackIdentifier.h"
 #include "pxr/usd/pcp/site.h"
@@ -67,6 +68,7 @@
 #include "pxr/usd/ar/resolverContext.h"
 #include "pxr/usd/ar/resolverContextBinder.h"
 #include "pxr/usd/ar/resolverScopedCache.h"
+#include "pxr/usd/ar/resolverSharedCache.h"
 
 #include "pxr/base/gf/interval.h"
 #include "pxr/base/gf/multiInterval.h"
@@ -590,6 +592,7 @@ UsdStage::_InstantiateStage(const SdfLayerRefPtr &rootLayer,
         new UsdStage(rootLayer, sessionLayer, pathResolverContext, mask, load));
 
     ArResolverScopedCache resolverCache;
+    ArResolverSharedCacheScope sharedResolverCache;
 
     // Populate the stage, request payloads according to InitialLoadSet load.
     stage->_ComposePrimIndexesInParallel(
@@ -786,6 +789,28 @@ UsdStage::Open(const std::string& filePath,
     return Open(rootLayer, pathResolverContext, load);
 }
 
+/* static */
+WorkFuture<UsdStageRefPtr>
+UsdStage::OpenAsync(const std::string& filePath, InitialLoadSet load)
+{
+    // Capture by value; the worker thread outlives this frame. Errors are
+    // reported by the eventual Open() call and a TfNullPtr result.
+    return WorkAsync([filePath, load]() {
+        return UsdStage::Open(filePath, load);
+    });
+}
+
+/* static */
+WorkFuture<UsdStageRefPtr>
+UsdStage::OpenAsync(const std::string& filePath,
+                    const ArResolverContext& pathResolverContext,
+                    InitialLoadSet load)
+{
+    return WorkAsync([filePath, pathResolverContext, load]() {
+        return UsdStage::Open(filePath, pathResolverContext, load);
+    });
+}
+
 /* static */
 UsdStageRefPtr
 UsdStage::OpenMasked(const std::string& filePath,
@@ -1723,9 +1748,6 @@ UsdStage::GetPrimAtPath(const SdfPath &path) const
 Usd_PrimDataConstPtr
 UsdStage::_GetPrimDataAtPath(const SdfPath &path) const
 {
-    tbb::spin_rw_mutex::scoped_lock lock;
-    if (_primMapMutex)
-        lock.acquire(*_primMapMutex, /*write=*/false);
     PathToNodeMap::const_iterator entry = _primMap.find(path);
     return entry != _primMap.end() ? entry->second.get() : NULL;
 }
@@ -1733,9 +1755,6 @@ UsdStage::_GetPrimDataAtPath(const SdfPath &path) const
 Usd_PrimDataPtr
 UsdStage::_GetPrimDataAtPath(const SdfPath &path)
 {
-    tbb::spin_rw_mutex::scoped_lock lock;
-    if (_primMapMutex)
-        lock.acquire(*_primMapMutex, /*write=*/false);
     PathToNodeMap::const_iterator entry = _primMap.find(path);
     return entry != _primMap.end() ? entry->second.get() : NULL;
 }
@@ -2088,6 +2107,18 @@ UsdStage::_LoadAndUnload(const SdfPathSet &loadSet,
 
     ArResolverScopedCache resolverCache;
 
+    // Pre-fetch the payload layers for everything we're about to load.
+    // This resolves and opens the layers and their sublayer stacks in
+    // parallel up front, so the recomposition below finds them already
+    // in memory and can recompose all of the affected subtrees in one
+    // parallel pass instead of faulting each payload's layers in as it
+    // goes.  The request retains the opened layers until recomposition
+    // has adopted them into layer stacks.
+    PcpLayerPrefetchRequest payloadPrefetch;
+    if (!finalLoadSet.empty()) {
+        _cache->PrefetchPayloads(finalLoadSet, &payloadPrefetch);
+    }
+
     // Send include/exclude sets to the PcpCache.
     PcpChanges changes;
     _cache->RequestPayloads(finalLoadSet, finalUnloadSet, &changes);
@@ -2300,14 +2331,8 @@ UsdStage::_InstantiatePrim(const SdfPath &primPath)
 
     // Instantiate new prim data instance.
     Usd_PrimDataPtr p = new Usd_PrimData(this, primPath);
-    pair<PathToNodeMap::iterator, bool> result;
-    std::pair<SdfPath, Usd_PrimDataPtr> payload(primPath, p);
-    {
-        tbb::spin_rw_mutex::scoped_lock lock;
-        if (_primMapMutex)
-            lock.acquire(*_primMapMutex);
-        result = _primMap.insert(payload);
-    }
+    pair<PathToNodeMap::iterator, bool> result =
+        _primMap.insert(std::make_pair(primPath, p));
 
     // Insert entry into the map -- should always succeed.
     TF_VERIFY(result.second, "Newly instantiated prim <%s> already present in "
@@ -2626,9 +2651,8 @@ UsdStage::_ComposeSubtreesInParallel(
     // Begin a subtree composition in parallel.  Calling _ComposeChildren and
     // passing recurse=true will spawn a task for each subtree.
 
-    _primMapMutex = boost::in_place();
     _dispatcher = boost::in_place();
-    
+
     for (size_t i = 0; i != prims.size(); ++i) {
         Usd_PrimDataPtr p = prims[i];
         _dispatcher->Run(
@@ -2638,7 +2662,7 @@ UsdStage::_ComposeSubtreesInParallel(
     }
 
     _dispatcher = boost::none;
-    _primMapMutex = boost::none;
+    _FlushDeadPrimEntries();
 }
 
 void
@@ -2740,9 +2764,8 @@ UsdStage::_DestroyPrimsInParallel(const vector<SdfPath>& paths)
 
     TRACE_FUNCTION();
 
-    TF_AXIOM(!_dispatcher && !_primMapMutex);
+    TF_AXIOM(!_dispatcher);
 
-    _primMapMutex = boost::in_place();
     _dispatcher = boost::in_place();
 
     for (const auto& path : paths) {
@@ -2755,7 +2778,7 @@ UsdStage::_DestroyPrimsInParallel(const vector<SdfPath>& paths)
     }
 
     _dispatcher = boost::none;
-    _primMapMutex = boost::none;
+    _FlushDeadPrimEntries();
 }
 
 void
@@ -2791,18 +2814,35 @@ UsdStage::_DestroyPrim(Usd_PrimDataPtr prim)
     // NOTE: The above was true in gcc 4.4 but not in gcc 4.8, nor is it
     //       true in boost::unordered_map or std::unordered_map.
     if (!_isClosingStage) {
-        SdfPath primPath = prim->GetPath(); 
-        tbb::spin_rw_mutex::scoped_lock lock;
-        const bool hasMutex = static_cast<bool>(_primMapMutex);
-        if (hasMutex)
-            lock.acquire(*_primMapMutex);
-        bool erased = _primMap.erase(primPath);
-        if (hasMutex)
-            lock.release();
-        TF_VERIFY(erased, 
+        SdfPath primPath = prim->GetPath();
+        if (_dispatcher) {
+            // Other parallel tasks may be finding or inserting into _primMap
+            // concurrently, and erasure is not safe against either, so just
+            // queue the entry for removal.  The prim is already marked dead,
+            // so a lookup that finds the entry in the meantime produces an
+            // invalid prim, as it would after erasure.  The queued entries
+            // are erased in _FlushDeadPrimEntries() once the task window
+            // closes.
+            _deadPrimEntries.push_back(primPath);
+        } else {
+            bool erased = _primMap.unsafe_erase(primPath);
+            TF_VERIFY(erased,
+                      "Destroyed prim <%s> not present in stage's data "
+                      "structures", primPath.GetString().c_str());
+        }
+    }
+}
+
+void
+UsdStage::_FlushDeadPrimEntries()
+{
+    for (const auto &deadPath : _deadPrimEntries) {
+        bool erased = _primMap.unsafe_erase(deadPath);
+        TF_VERIFY(erased,
                   "Destroyed prim <%s> not present in stage's data structures",
-                  prim->GetPath().GetString().c_str());
+                  deadPath.GetString().c_str());
     }
+    _deadPrimEntries.clear();
 }
 
 void
@@ -2812,6 +2852,10 @@ UsdStage::Reload()
 
     ArResolverScopedCache resolverCache;
 
+    // Layer contents are about to change underneath us; previously
+    // cached resolution results may no longer hold.
+    ArResolverSharedCache::Invalidate();
+
     PcpChanges changes;
     _cache->Reload(&changes);
 
@@ -3699,6 +3743,7 @@ UsdStage::_RecomposePrims(const PcpChanges &changes,
     }
 
     ArResolverScopedCache resolverCache;
+    ArResolverSharedCacheScope sharedResolverCache;
     Usd_InstanceChanges instanceChanges;
     _ComposePrimIndexesInParallel(
         primPathsToRecompose, _IncludeNewPayloadsIfAncestorWasIncluded,
@@ -6332,8 +6377,13 @@ UsdStage::_GetValueFromResolveInfoImpl(const UsdResolveInfo &info,
                 double lower = 0.0;
                 if (clip->GetBracketingTimeSamplesForPath(
                         specId, localTime, &lower, &upper)) {
+                    // Warm the layers for the upcoming clips in the
+                    // background so that playback does not stall on a
+                    // layer open at the next clip boundary.
+                    _clipCache->PrefetchNeighboringClipLayers(
+                        clips, i, localTime);
                     return UsdStage_ResolveInfoAccess::_GetClipValue(
-                        time, attr, info, clip, lower, upper, interpolator, 
+                        time, attr, info, clip, lower, upper, interpolator,
                         result);
                 }
             }
@@ -7259,12 +7309,52 @@ UsdStage::GetFramesPerSecond() const
     return result;
 }
 
-void 
+void
 UsdStage::SetFramesPerSecond(double framesPerSecond) const
 {
     SetMetadata(SdfFieldKeys->FramesPerSecond, framesPerSecond);
 }
 
+void
+UsdStage::PreloadTimeSamples(const SdfPathVector &paths,
+                             const GfInterval &interval) const
+{
+    TRACE_FUNCTION();
+
+    if (paths.empty() || interval.IsEmpty()) {
+        return;
+    }
+
+    TF_PY_ALLOW_THREADS_IN_SCOPE();
+
+    ArResolverScopedCache resolverCache;
+
+    WorkParallelForN(
+        paths.size(),
+        [this, &paths, &interval](size_t begin, size_t end) {
+            for (size_t i = begin; i != end; ++i) {
+                SdfPath const &path = paths[i];
+                if (!path.IsPrimPropertyPath()) {
+                    continue;
+                }
+                UsdPrim prim = GetPrimAtPath(path.GetPrimPath());
+                if (!prim) {
+                    continue;
+                }
+                UsdAttribute attr = prim.GetAttribute(path.GetNameToken());
+                if (!attr) {
+                    continue;
+                }
+                // Computing the resolve info and the samples in the
+                // interval opens any value clip layers and populates the
+                // sample indexes that per-frame value queries consult.
+                // The returned times are discarded; this is a prefetch.
+                std::vector<double> times;
+                _GetTimeSamplesInInterval(attr, interval, &times);
+            }
+        });
+}
+
 void 
 UsdStage::SetColorConfiguration(const SdfAssetPath &colorConfig) const
 {
@@ -46,10 +46,12 @@
 #include "pxr/usd/pcp/cache.h"
 #include "pxr/base/vt/value.h"
 #include "pxr/base/work/arenaDispatcher.h"
+#include "pxr/base/work/future.h"
 
 #include <boost/optional.hpp>
 
 #include <tbb/concurrent_vector.h>
+#include <tbb/concurrent_unordered_map.h>
 #include <tbb/concurrent_unordered_set.h>
 #include <tbb/spin_rw_mutex.h>
 
@@ -254,6 +256,31 @@ public:
          const ArResolverContext& pathResolverContext,
          InitialLoadSet load = LoadAll);
 
+    /// Open a stage without blocking the calling thread.  Layer opening and
+    /// composition run on a worker thread; the returned future yields the
+    /// composed stage, or TfNullPtr on failure.  Attach completion
+    /// callbacks with WorkFuture::Then(), or poll with IsReady().
+    ///
+    /// For progressive readiness on very large scenes, open with \p load =
+    /// LoadNone: the stage composes without pulling in any payloads, which
+    /// makes the root hierarchy available quickly, and payloads can then be
+    /// brought in incrementally with Load() / LoadAndUnload() while the UI
+    /// is already up.
+    ///
+    /// Because the open runs on a worker thread, UsdStageCacheContext
+    /// objects bound on the calling stack are not consulted; callers that
+    /// want caching should insert the resulting stage into a cache from
+    /// their completion callback.
+    USD_API
+    static WorkFuture<UsdStageRefPtr>
+    OpenAsync(const std::string& filePath, InitialLoadSet load = LoadAll);
+    /// \overload
+    USD_API
+    static WorkFuture<UsdStageRefPtr>
+    OpenAsync(const std::string& filePath,
+              const ArResolverContext& pathResolverContext,
+              InitialLoadSet load = LoadAll);
+
     /// Create a new stage and recursively compose prims defined within and
     /// referenced by the layer at \p filePath which must already exist, subject
     /// to \p mask.
@@ -1297,7 +1324,24 @@ public:
     /// \sa GetFramesPerSecond()
     USD_API
     void SetFramesPerSecond(double framesPerSecond) const;
-    
+
+    /// Warm time-sample data for the attributes identified by \p paths
+    /// over \p interval.
+    ///
+    /// For each attribute, this computes its value resolution source and
+    /// queries its authored time samples in \p interval, in parallel.
+    /// This opens any value clip layers and populates the per-attribute
+    /// sample indexes that per-frame value queries consult, so a
+    /// subsequent playback loop over \p interval does not pay first-touch
+    /// resolution costs mid-frame.  Paths that do not identify attributes
+    /// on this stage are ignored.
+    ///
+    /// This is purely a prefetch; it does not affect the stage's contents
+    /// or the results of any query.
+    USD_API
+    void PreloadTimeSamples(const SdfPathVector &paths,
+                            const GfInterval &interval) const;
+
     /// @}
 
     // --------------------------------------------------------------------- //
@@ -1654,6 +1698,11 @@ private:
     // Invoke _DestroyPrim() on all of \p prim's direct children.
     void _DestroyDescendents(Usd_PrimDataPtr prim);
 
+    // Erase the _primMap entries queued on _deadPrimEntries by _DestroyPrim()
+    // while a parallel task window was open.  Must be called at a serial
+    // point, after _dispatcher has been retired.
+    void _FlushDeadPrimEntries();
+
     // Returns true if the object at the given path is a descendant of
     // an instance prim, i.e. a prim beneath an instance prim, or a property
     // of a prim beneath an instance prim.
@@ -2001,11 +2050,17 @@ private:
     std::unique_ptr<Usd_ClipCache> _clipCache;
     std::unique_ptr<Usd_InstanceCache> _instanceCache;
 
-    // A map from Path to Prim, for fast random access.
-    typedef TfHashMap<
+    // A map from Path to Prim, for fast random access.  This is a concurrent
+    // hash map so that readers never take a lock: lookups may proceed from
+    // any number of threads while parallel composition tasks insert new
+    // entries.  Erasure is not concurrency-safe, so prims destroyed while a
+    // parallel task window is open (_dispatcher engaged) are only marked
+    // dead and their paths queued on _deadPrimEntries; the entries are
+    // erased at the serial point where the dispatcher is retired.
+    typedef tbb::concurrent_unordered_map<
         SdfPath, Usd_PrimDataIPtr, SdfPath::Hash> PathToNodeMap;
     PathToNodeMap _primMap;
-    mutable boost::optional<tbb::spin_rw_mutex> _primMapMutex;
+    tbb::concurrent_vector<SdfPath> _deadPrimEntries;
 
     // The interpolation type used for all attributes on the stage.
     UsdInterpolationType _interpolationType;
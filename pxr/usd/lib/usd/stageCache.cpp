@@ -30,6 +30,8 @@
 
 #include "pxr/usd/ar/resolverContext.h"
 
+#include "pxr/base/arch/fileSystem.h"
+
 #include <boost/functional/hash.hpp>
 #include <boost/multi_index_container.hpp>
 #include <boost/multi_index/hashed_index.hpp>
@@ -64,13 +66,39 @@ std::atomic_long idCounter(9223000);
 
 Id GetNextId() { return Id::FromLongInt(++idCounter); }
 
+std::atomic<size_t> useCounter(0);
+
 struct Entry {
-    Entry() {}
-    Entry(const UsdStageRefPtr &stage, Id id) : stage(stage), id(id) {}
+    Entry() : lastUse(0), approxBytes(0) {}
+    Entry(const UsdStageRefPtr &stage, Id id)
+        : stage(stage), id(id), lastUse(0), approxBytes(0) {}
     UsdStageRefPtr stage;
     Id id;
+    // Recency stamp and size estimate used for memory-budgeted eviction.
+    // These are mutable since multi_index elements are const, but neither
+    // participates in any index.
+    mutable size_t lastUse;
+    mutable size_t approxBytes;
 };
 
+// Mark entry as most recently used.
+void TouchEntry(const Entry &entry) { entry.lastUse = ++useCounter; }
+
+// Return an approximate resident size in bytes for stage, computed by summing
+// the on-disk sizes of its used layers.  This is a cheap proxy for true
+// memory use: crate files are mapped more or less wholesale, and text layers
+// generally expand rather than shrink when parsed.  Anonymous layers with no
+// file backing count as zero.
+size_t EstimateStageSizeInBytes(const UsdStageRefPtr &stage) {
+    size_t numBytes = 0;
+    for (auto const &layer: stage->GetUsedLayers()) {
+        int64_t length = ArchGetFileLength(layer->GetRealPath().c_str());
+        if (length > 0)
+            numBytes += length;
+    }
+    return numBytes;
+}
+
 struct ById {};
 
 struct ByStage {};
@@ -213,11 +241,42 @@ UsdStageCacheRequest::_DataDeleter::operator()(UsdStageCacheRequest::_Data *d)
 
 struct Usd_StageCacheImpl
 {
+    Usd_StageCacheImpl() : memoryBudget(0) {}
+
     StageContainer stages;
     std::vector<UsdStageCacheRequest *> pendingRequests;
     string debugName;
+    size_t memoryBudget;
+    std::function<void (const UsdStageRefPtr &)> evictionCallback;
 };
 
+namespace {
+
+// Evict least-recently-used entries until the cache's approximate memory use
+// fits within its budget, always retaining at least one entry.  Caller must
+// hold the cache lock.  Evicted entries are appended to *evicted so the
+// caller can invoke the eviction callback after releasing the lock.
+void EnforceMemoryBudget(Usd_StageCacheImpl *impl, vector<Entry> *evicted) {
+    if (impl->memoryBudget == 0)
+        return;
+    StagesById &byId = impl->stages.get<ById>();
+    size_t totalBytes = 0;
+    for (auto const &entry: byId)
+        totalBytes += entry.approxBytes;
+    while (totalBytes > impl->memoryBudget && byId.size() > 1) {
+        auto lru = byId.begin();
+        for (auto iter = byId.begin(); iter != byId.end(); ++iter) {
+            if (iter->lastUse < lru->lastUse)
+                lru = iter;
+        }
+        totalBytes -= lru->approxBytes;
+        evicted->push_back(*lru);
+        byId.erase(lru);
+    }
+}
+
+} // anonymous ns
+
 UsdStageCache::UsdStageCache() : _impl(new _Impl)
 {
 }
@@ -285,9 +344,12 @@ UsdStageCache::RequestStage(UsdStageCacheRequest &&request)
     { LockGuard lock(_mutex);
         // Does the cache currently have a match?  If so, done.
         StagesByStage &byStage = _impl->stages.get<ByStage>();
-        for (auto const &entry: byStage)
-            if (request.IsSatisfiedBy(entry.stage))
+        for (auto const &entry: byStage) {
+            if (request.IsSatisfiedBy(entry.stage)) {
+                TouchEntry(entry);
                 return std::make_pair(entry.stage, false);
+            }
+        }
 
         // Check to see if any pending requests can satisfy.
         for (auto *pending: _impl->pendingRequests) {
@@ -349,6 +411,8 @@ UsdStageCache::Find(Id id) const
     { LockGuard lock(_mutex);
         StagesById &byId = _impl->stages.get<ById>();
         StagesById::const_iterator iter = byId.find(id);
+        if (iter != byId.end())
+            TouchEntry(*iter);
         result = iter != byId.end() ? iter->stage : TfNullPtr;
     }
 
@@ -367,6 +431,8 @@ UsdStageCache::FindOneMatching(const SdfLayerHandle &rootLayer) const
     { LockGuard lock(_mutex);
         StagesByRootLayer &byRootLayer = _impl->stages.get<ByRootLayer>();
         auto iter = byRootLayer.find(rootLayer);
+        if (iter != byRootLayer.end())
+            TouchEntry(*iter);
         result = iter != byRootLayer.end() ? iter->stage : TfNullPtr;
     }
 
@@ -390,6 +456,7 @@ UsdStageCache::FindOneMatching(const SdfLayerHandle &rootLayer,
         for (auto entryIt = range.first; entryIt != range.second; ++entryIt) { 
             const auto& entry = *entryIt;
             if (entry.stage->GetSessionLayer() == sessionLayer) {
+                TouchEntry(entry);
                 result = entry.stage;
                 break;
             }
@@ -419,6 +486,7 @@ UsdStageCache::FindOneMatching(
         for (auto entryIt = range.first; entryIt != range.second; ++entryIt) { 
             const auto& entry = *entryIt;
             if (entry.stage->GetPathResolverContext() == pathResolverContext) {
+                TouchEntry(entry);
                 result = entry.stage;
                 break;
             }
@@ -448,6 +516,7 @@ UsdStageCache::FindOneMatching(
             const auto& entry = *entryIt;
             if (entry.stage->GetSessionLayer() == sessionLayer &&
                 entry.stage->GetPathResolverContext() == pathResolverContext) {
+                TouchEntry(entry);
                 result = entry.stage;
                 break;
             }
@@ -550,18 +619,82 @@ UsdStageCache::Insert(const UsdStageRefPtr &stage)
     }
 
     DebugHelper debug(*this, "inserted");
+    DebugHelper evictDebug(*this, "evicted");
     Id ret;
 
+    // Estimate the stage's size outside the lock; this stats the stage's
+    // layer files, which we don't want to do with the lock held.  It is
+    // wasted work if there is no memory budget, but it's cheap.
+    const size_t approxBytes = EstimateStageSizeInBytes(stage);
+
+    vector<Entry> evicted;
+    std::function<void (const UsdStageRefPtr &)> callback;
     { LockGuard lock(_mutex);
         StagesByStage &byStage = _impl->stages.get<ByStage>();
         auto iresult = byStage.insert(Entry(stage, GetNextId()));
         if (iresult.second && debug.IsEnabled())
             debug.AddEntry(*iresult.first);
+        iresult.first->approxBytes = approxBytes;
+        TouchEntry(*iresult.first);
         ret = iresult.first->id;
+        EnforceMemoryBudget(_impl.get(), &evicted);
+        if (!evicted.empty())
+            callback = _impl->evictionCallback;
+    }
+
+    // Invoke the eviction callback outside the lock so it may call back into
+    // this cache.
+    if (!evicted.empty()) {
+        if (evictDebug.IsEnabled())
+            evictDebug.AddEntries(evicted);
+        if (callback) {
+            for (auto const &entry: evicted)
+                callback(entry.stage);
+        }
     }
     return ret;
 }
 
+void
+UsdStageCache::SetMemoryBudget(size_t numBytes)
+{
+    DebugHelper debug(*this, "evicted");
+    vector<Entry> evicted;
+    std::function<void (const UsdStageRefPtr &)> callback;
+    { LockGuard lock(_mutex);
+        _impl->memoryBudget = numBytes;
+        // A shrunken budget may put the cache over; evict immediately rather
+        // than waiting for the next insertion.
+        EnforceMemoryBudget(_impl.get(), &evicted);
+        if (!evicted.empty())
+            callback = _impl->evictionCallback;
+    }
+
+    if (!evicted.empty()) {
+        if (debug.IsEnabled())
+            debug.AddEntries(evicted);
+        if (callback) {
+            for (auto const &entry: evicted)
+                callback(entry.stage);
+        }
+    }
+}
+
+size_t
+UsdStageCache::GetMemoryBudget() const
+{
+    LockGuard lock(_mutex);
+    return _impl->memoryBudget;
+}
+
+void
+UsdStageCache::SetEvictionCallback(
+    std::function<void (const UsdStageRefPtr &)> callback)
+{
+    LockGuard lock(_mutex);
+    _impl->evictionCallback = std::move(callback);
+}
+
 bool
 UsdStageCache::Erase(Id id)
 {
@@ -32,6 +32,7 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/operators.hpp>
 
+#include <functional>
 #include <string>
 #include <memory>
 #include <mutex>
@@ -341,6 +342,36 @@ public:
     USD_API
     void Clear();
 
+    /// Set an approximate memory budget for this cache in bytes.  If nonzero,
+    /// then whenever a stage is inserted (directly via Insert() or indirectly
+    /// via RequestStage()) and the cache's approximate memory use exceeds
+    /// \p numBytes, least-recently-used stages are evicted until the cache
+    /// fits within the budget again, though the most recently inserted stage
+    /// is always retained.  A stage's memory use is estimated by summing the
+    /// on-disk sizes of its used layers; anonymous layers with no file
+    /// backing count as zero.  Find(), FindOneMatching(), and RequestStage()
+    /// hits mark a stage as recently used.  The default budget of zero
+    /// disables eviction entirely.  Since the cache contains UsdStageRefPtr,
+    /// evicting a stage will only destroy the stage if no other
+    /// UsdStageRefPtrs exist referring to it.
+    USD_API
+    void SetMemoryBudget(size_t numBytes);
+
+    /// Return this cache's memory budget in bytes, as set by
+    /// SetMemoryBudget().  A budget of zero (the default) means eviction is
+    /// disabled.
+    USD_API
+    size_t GetMemoryBudget() const;
+
+    /// Set a callback to invoke with each stage evicted to satisfy the
+    /// memory budget (see SetMemoryBudget()).  The callback is invoked after
+    /// the stage has been removed from the cache and without the cache's
+    /// internal lock held, so it may call back into this cache.  Pass an
+    /// empty function to remove a previously set callback.
+    USD_API
+    void SetEvictionCallback(
+        std::function<void (const UsdStageRefPtr &)> callback);
+
     /// Assign a debug name to this cache.  This will be emitted in debug output
     /// messages when the USD_STAGE_CACHES debug flag is enabled.  If set to the
     /// empty string, the cache's address will be used instead.
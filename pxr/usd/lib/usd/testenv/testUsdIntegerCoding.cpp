@@ -29,12 +29,29 @@
 #include "../integerCoding.h"
 
 #include <cstdlib>
+#include <memory>
+#include <random>
 #include <vector>
 #include <string>
 #include <tuple>
 
 PXR_NAMESPACE_USING_DIRECTIVE
 
+static void
+_TestRoundTrip(std::vector<uint32_t> const &ints)
+{
+    std::unique_ptr<char[]> compressed(
+        new char[Usd_IntegerCompression::GetCompressedBufferSize(ints.size())]);
+    size_t compressedSize = Usd_IntegerCompression::CompressToBuffer(
+        ints.data(), ints.size(), compressed.get());
+
+    std::vector<uint32_t> decoded(ints.size());
+    Usd_IntegerCompression::DecompressFromBuffer(
+        compressed.get(), compressedSize, decoded.data(), ints.size());
+
+    TF_AXIOM(decoded == ints);
+}
+
 int main(int argc, char** argv) {
 
     std::vector<uint32_t> ints {
@@ -137,6 +154,22 @@ int main(int argc, char** argv) {
 
     TF_AXIOM(decoded == ints);
 
+    // Randomized round trips across sizes, covering all the decode tail
+    // cases and the full range of delta widths.
+    std::mt19937 rng(18384);
+    for (size_t numInts = 0; numInts != 67; ++numInts) {
+        std::vector<uint32_t> random(numInts);
+        for (size_t i = 0; i != numInts; ++i) {
+            switch (rng() % 4) {
+            case 0: random[i] = rng() % 3; break;
+            case 1: random[i] = rng() % 200; break;
+            case 2: random[i] = rng() % 40000; break;
+            default: random[i] = rng(); break;
+            }
+        }
+        _TestRoundTrip(random);
+    }
+
     printf("SUCCEEDED\n");
     return 0;
 
@@ -382,6 +382,41 @@ class TestUsdStageCache(unittest.TestCase):
         # The dontCareSession should be either noSession or explicitSession or
         # implicitSession, since it didn't specify a sessionLayer argument.
         assert dontCareSession in (noSession, explicitSession, implicitSession)
-    
+
+    def test_MemoryBudget(self):
+        cache = Usd.StageCache()
+
+        # The default budget is zero, meaning eviction is disabled.
+        self.assertEqual(cache.GetMemoryBudget(), 0)
+
+        # Create a handful of file-backed stages; the cache's size accounting
+        # is based on layer file sizes, so anonymous layers won't do here.
+        stages = []
+        for i in range(4):
+            layer = Sdf.Layer.CreateNew('testBudget_%d.usda' % i)
+            stage = Usd.Stage.Open(layer)
+            stage.DefinePrim('/Prim%d' % i)
+            layer.Save()
+            stages.append(stage)
+            cache.Insert(stage)
+
+        self.assertEqual(cache.Size(), 4)
+
+        # A generous budget evicts nothing.
+        cache.SetMemoryBudget(100 * 1024 * 1024)
+        self.assertEqual(cache.Size(), 4)
+
+        # A tiny budget evicts down to a single entry, and the survivor is
+        # the most recently used (here, most recently inserted) stage.
+        cache.SetMemoryBudget(1)
+        self.assertEqual(cache.Size(), 1)
+        assert cache.Contains(stages[-1])
+
+        # Disabling the budget allows the cache to grow again.
+        cache.SetMemoryBudget(0)
+        for stage in stages:
+            cache.Insert(stage)
+        self.assertEqual(cache.Size(), 4)
+
 if __name__ == "__main__":
     unittest.main()
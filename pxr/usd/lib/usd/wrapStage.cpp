@@ -488,6 +488,9 @@ void wrapUsdStage()
         .def("GetFramesPerSecond", &UsdStage::GetFramesPerSecond)
         .def("SetFramesPerSecond", &UsdStage::SetFramesPerSecond)
 
+        .def("PreloadTimeSamples", &UsdStage::PreloadTimeSamples,
+             (arg("paths"), arg("interval")))
+
         .def("GetColorConfiguration", &UsdStage::GetColorConfiguration)
         .def("SetColorConfiguration", &UsdStage::SetColorConfiguration)
 
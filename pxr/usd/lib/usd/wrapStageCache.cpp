@@ -145,6 +145,10 @@ void wrapUsdStageCache()
 
         .def("Clear", &UsdStageCache::Clear)
 
+        .def("SetMemoryBudget", &UsdStageCache::SetMemoryBudget,
+             arg("numBytes"))
+        .def("GetMemoryBudget", &UsdStageCache::GetMemoryBudget)
+
         .def("SetDebugName", &UsdStageCache::SetDebugName)
         .def("GetDebugName", &UsdStageCache::GetDebugName)
         ;
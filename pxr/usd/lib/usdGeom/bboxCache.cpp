@@ -33,6 +33,7 @@
 #include "pxr/usd/usdGeom/xform.h"
 
 #include "pxr/usd/usd/primRange.h"
+#include "pxr/base/work/loops.h"
 #include "pxr/base/tracelite/trace.h"
 
 #include "pxr/base/tf/pyLock.h"
@@ -497,21 +498,37 @@ UsdGeomBBoxCache::_ComputePointInstanceBoundsHelper(
     VtMatrix4dArray const &cinstanceTransforms = instanceTransforms;
 
     const UsdStagePtr stage = instancer.GetPrim().GetStage();
-    
+
+    // Resolve the bounds for each prototype that the requested instances
+    // refer to.  This mutates cache state, so it must happen serially; the
+    // per-instance work that remains is pure math, which can go wide.
+    std::vector<bool> protoNeeded(protoPaths.size(), false);
     for (int64_t const *iid = instanceIdBegin, * const iend = iid + numIds;
          iid != iend; ++iid) {
+        protoNeeded[cprotoIndices[*iid]] = true;
+    }
 
-        const int protoIndex = cprotoIndices[*iid];
-        const SdfPath& protoPath = protoPaths[protoIndex];
-        const UsdPrim& protoPrim = stage->GetPrimAtPath(protoPath);
-
-        // Get the prototype bounding box and apply the instance transform and
-        // the caller's transform.
-        GfBBox3d &thisBounds = *result++;
-        thisBounds = ComputeUntransformedBound(protoPrim);
-        thisBounds.Transform(cinstanceTransforms[*iid] * xform);
+    std::vector<GfBBox3d> protoBounds(protoPaths.size());
+    for (size_t protoIndex = 0; protoIndex != protoPaths.size(); ++protoIndex) {
+        if (protoNeeded[protoIndex]) {
+            protoBounds[protoIndex] = ComputeUntransformedBound(
+                stage->GetPrimAtPath(protoPaths[protoIndex]));
+        }
     }
-    
+
+    // Apply the instance transforms and the caller's transform to each
+    // prototype bound in parallel.
+    WorkParallelForN(
+        numIds,
+        [&](size_t begin, size_t end) {
+            for (size_t i = begin; i != end; ++i) {
+                const int64_t instanceId = instanceIdBegin[i];
+                GfBBox3d &thisBounds = result[i];
+                thisBounds = protoBounds[cprotoIndices[instanceId]];
+                thisBounds.Transform(cinstanceTransforms[instanceId] * xform);
+            }
+        });
+
     return true;
 }
 
@@ -579,6 +596,58 @@ UsdGeomBBoxCache::Clear()
     _bboxCache.clear();
 }
 
+void
+UsdGeomBBoxCache::Invalidate(const SdfPathVector& subtreePaths)
+{
+    if (subtreePaths.empty())
+        return;
+
+    TF_DEBUG(USDGEOM_BBOX).Msg("[BBox Cache] INVALIDATING %zu subtree(s)\n",
+                               subtreePaths.size());
+
+    SdfPathVector roots = subtreePaths;
+    std::sort(roots.begin(), roots.end());
+
+    // The invalidated prims' transforms may have changed too.
+    _ctmCache.Invalidate(roots);
+
+    for (_PrimBBoxHashMap::iterator it = _bboxCache.begin();
+         it != _bboxCache.end(); ) {
+        const SdfPath& primPath = it->first.GetPath();
+
+        // Entries at and below an invalidated subtree root are dropped
+        // entirely: their queries and cached computed-purpose may be stale,
+        // and after a resync the prims themselves may no longer exist.
+        if (SdfPathFindLongestPrefix(roots.begin(), roots.end(), primPath)
+            != roots.end()) {
+            _bboxCache.erase(it++);
+            continue;
+        }
+
+        // Ancestors of an invalidated subtree accumulate its bounds, so
+        // their cached bboxes must be recomputed; their queries remain
+        // valid.
+        for (const SdfPath& root : roots) {
+            if (root.HasPrefix(primPath)) {
+                it->second.isComplete = false;
+                it->second.bboxes.clear();
+                break;
+            }
+        }
+        ++it;
+    }
+}
+
+void
+UsdGeomBBoxCache::Invalidate(const UsdNotice::ObjectsChanged& notice)
+{
+    SdfPathVector paths = notice.GetResyncedPaths();
+    for (const SdfPath& p : notice.GetChangedInfoOnlyPaths()) {
+        paths.push_back(p.GetPrimPath());
+    }
+    Invalidate(paths);
+}
+
 void
 UsdGeomBBoxCache::SetIncludedPurposes(const TfTokenVector& includedPurposes)
 {
@@ -933,7 +1002,8 @@ UsdGeomBBoxCache::_Resolve(
         bboxesForMasters.Resolve(masterPrims);
     }
 
-    // XXX: This swapping out is dubious... see XXX below.
+    // Seed the calling thread's per-thread cache with the main cache's
+    // entries; all the per-thread caches are merged back below.
     _ThreadXformCache xfCaches;
     xfCaches.local().Swap(_ctmCache);
 
@@ -947,12 +1017,14 @@ UsdGeomBBoxCache::_Resolve(
                                          this, &xfCaches);
     tbb::task::spawn_root_and_wait(rootTask);
 
-    // We save the result of one of the caches, but it might be interesting to
-    // merge them all here at some point.
-    // XXX: Is this valid?  This only makes sense if we're *100% certain* that
-    // rootTask above runs in this thread.  If it's picked up by another worker
-    // it won't populate the local xfCaches we're swapping with.
+    // Swap the calling thread's cache back in, then merge in the entries
+    // accumulated by every other worker.  The root task is not guaranteed to
+    // have executed on this thread, so merging is the only way to reliably
+    // retain the transforms computed above for future queries.
     xfCaches.local().Swap(_ctmCache);
+    TF_FOR_ALL(cacheIt, xfCaches) {
+        _ctmCache.Merge(*cacheIt);
+    }
 
     // Note: the map may contain unresolved entries, but future queries will
     // populate them.
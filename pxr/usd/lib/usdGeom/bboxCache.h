@@ -29,6 +29,7 @@
 #include "pxr/usd/usdGeom/xformCache.h"
 #include "pxr/usd/usdGeom/pointInstancer.h"
 #include "pxr/usd/usd/attributeQuery.h"
+#include "pxr/usd/usd/notice.h"
 #include "pxr/base/gf/bbox3d.h"
 #include "pxr/base/tf/hashmap.h"
 
@@ -289,6 +290,22 @@ public:
     USDGEOM_API
     void Clear();
 
+    /// Invalidate cached bounds for the prims at and below each path in
+    /// \p subtreePaths, and for all of their ancestors, whose accumulated
+    /// child bounds include them.  Cached bounds for all other prims are
+    /// retained, making this much cheaper than Clear() when reacting to a
+    /// localized change such as an interactive manipulation.  The cached
+    /// transforms for the invalidated subtrees are also discarded.
+    USDGEOM_API
+    void Invalidate(const SdfPathVector& subtreePaths);
+
+    /// \overload
+    /// Invalidate cached bounds affected by \p notice.  This is equivalent
+    /// to calling Invalidate() with the union of the notice's resynced and
+    /// changed-info prim paths.
+    USDGEOM_API
+    void Invalidate(const UsdNotice::ObjectsChanged& notice);
+
     /// Indicate the set of \p includedPurposes to use when resolving child
     /// bounds. Each child's purpose must match one of the elements of this set
     /// to be included in the computation; if it does not, child is excluded.
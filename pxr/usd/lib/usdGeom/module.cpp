@@ -64,4 +64,7 @@ TF_WRAP_MODULE
                             TF_WRAP(UsdGeomNurbsCurves);
                 TF_WRAP(UsdGeomPointInstancer);
     TF_WRAP(UsdGeomSubset);
+
+    // Depends on UsdGeomSubset's container conversions.
+    TF_WRAP(UsdGeomSubsetQuery);
 }
@@ -296,7 +296,9 @@ PXR_NAMESPACE_CLOSE_SCOPE
 
 #include "pxr/base/tf/enum.h"
 #include "pxr/base/tf/envSetting.h"
+#include "pxr/base/gf/quatd.h"
 #include "pxr/base/gf/transform.h"
+#include "pxr/base/work/loops.h"
 #include "pxr/usd/usdGeom/bboxCache.h"
 #include "pxr/usd/usdGeom/xformCache.h"
 
@@ -585,6 +587,50 @@ UsdGeomPointInstancer::ComputeMaskAtTime(UsdTimeCode time,
     return mask;
 }
 
+// Compose a scale-rotate-translate matrix directly from the authored
+// instance data.  This is equivalent to going through GfTransform with an
+// identity pivot, but expands the quaternion to a matrix in place instead
+// of round-tripping through axis/angle, which costs inverse trig per
+// instance.  The expansion matches GfMatrix4d::SetRotate().
+static GfMatrix4d
+_ComputeInstanceTransform(const GfVec3f* scale,
+                          const GfQuath* orientation,
+                          const GfVec3f& position)
+{
+    GfMatrix4d m(1.0);
+
+    if (orientation) {
+        const GfQuatd quat = GfQuatd(*orientation).GetNormalized();
+        const double  r = quat.GetReal();
+        const GfVec3d i = quat.GetImaginary();
+
+        m[0][0] = 1.0 - 2.0 * (i[1] * i[1] + i[2] * i[2]);
+        m[0][1] =       2.0 * (i[0] * i[1] + i[2] *    r);
+        m[0][2] =       2.0 * (i[2] * i[0] - i[1] *    r);
+
+        m[1][0] =       2.0 * (i[0] * i[1] - i[2] *    r);
+        m[1][1] = 1.0 - 2.0 * (i[2] * i[2] + i[0] * i[0]);
+        m[1][2] =       2.0 * (i[1] * i[2] + i[0] *    r);
+
+        m[2][0] =       2.0 * (i[2] * i[0] + i[1] *    r);
+        m[2][1] =       2.0 * (i[1] * i[2] - i[0] *    r);
+        m[2][2] = 1.0 - 2.0 * (i[1] * i[1] + i[0] * i[0]);
+    }
+
+    if (scale) {
+        // Scale is applied before the rotation, which with row vectors
+        // means scaling row i of the rotation by scale[i].
+        for (int row = 0; row != 3; ++row) {
+            m[row][0] *= (*scale)[row];
+            m[row][1] *= (*scale)[row];
+            m[row][2] *= (*scale)[row];
+        }
+    }
+
+    m.SetTranslateOnly(GfVec3d(position));
+    return m;
+}
+
 bool
 UsdGeomPointInstancer::ComputeInstanceTransformsAtTime(
     VtArray<GfMatrix4d>* xforms,
@@ -687,41 +733,55 @@ UsdGeomPointInstancer::ComputeInstanceTransformsAtTime(
     }
 
     UsdStageWeakPtr stage = GetPrim().GetStage();
-    UsdGeomXformCache xformCache(time);
 
-    xforms->assign(protoIndices.size(), GfMatrix4d(1.0));
-    for (size_t instanceId = 0; instanceId < protoIndices.size(); ++instanceId) {
-        if (!mask.empty() && !mask[instanceId]) {
-            continue;
+    // Resolve each prototype's local transformation once up front, rather
+    // than once per instance.
+    std::vector<GfMatrix4d> protoXforms;
+    if (doProtoXforms == IncludeProtoXform) {
+        UsdGeomXformCache xformCache(time);
+        protoXforms.assign(protoPaths.size(), GfMatrix4d(1.0));
+        for (size_t protoIndex = 0; protoIndex != protoPaths.size();
+             ++protoIndex) {
+            if (const UsdPrim protoPrim =
+                stage->GetPrimAtPath(protoPaths[protoIndex])) {
+                bool resetsXformStack;
+                protoXforms[protoIndex] = xformCache.GetLocalTransformation(
+                    protoPrim, &resetsXformStack);
+            }
         }
+    }
 
-        GfTransform instanceTransform;
-
-        if (!scales.empty()) {
-            instanceTransform.SetScale(scales[instanceId]);
-        }
+    // The remaining per-instance work is pure math over contiguous arrays,
+    // so it can go wide.  Unauthored scales and orientations simply drop
+    // out of the composition instead of composing with identity.
+    const GfVec3f* scalesData = scales.empty() ? NULL : scales.cdata();
+    const GfQuath* orientationsData =
+        orientations.empty() ? NULL : orientations.cdata();
+    const GfVec3f* positionsData = positions.cdata();
+    const int* protoIndicesData = protoIndices.cdata();
 
-        if (!orientations.empty()) {
-            instanceTransform.SetRotation(GfRotation(orientations[instanceId]));
-        }
+    xforms->assign(protoIndices.size(), GfMatrix4d(1.0));
+    GfMatrix4d* xformsData = xforms->data();
+
+    WorkParallelForN(
+        protoIndices.size(),
+        [&](size_t begin, size_t end) {
+            for (size_t instanceId = begin; instanceId != end; ++instanceId) {
+                if (!mask.empty() && !mask[instanceId]) {
+                    continue;
+                }
 
-        instanceTransform.SetTranslation(positions[instanceId]);
+                const GfMatrix4d instanceXform = _ComputeInstanceTransform(
+                    scalesData ? scalesData + instanceId : NULL,
+                    orientationsData ? orientationsData + instanceId : NULL,
+                    positionsData[instanceId]);
 
-        GfMatrix4d protoXform(1.0);
-        if (doProtoXforms == IncludeProtoXform) {
-            const int protoIndex = protoIndices[instanceId];
-            const SdfPath& protoPath = protoPaths[protoIndex];
-            const UsdPrim& protoPrim = stage->GetPrimAtPath(protoPath);
-            if (protoPrim) {
-                // Get the prototype's local transformation.
-                bool resetsXformStack;
-                protoXform = xformCache.GetLocalTransformation(protoPrim,
-                                                               &resetsXformStack);
+                xformsData[instanceId] = protoXforms.empty()
+                    ? instanceXform
+                    : protoXforms[protoIndicesData[instanceId]] *
+                      instanceXform;
             }
-        }
-
-        (*xforms)[instanceId] = protoXform * instanceTransform.GetMatrix();
-    }
+        });
 
     return ApplyMaskToArray(mask, xforms);
 }
@@ -29,6 +29,9 @@
 #include "pxr/usd/usd/attribute.h"
 #include "pxr/usd/usdGeom/tokens.h"
 
+#include "pxr/base/work/loops.h"
+
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -717,19 +720,55 @@ UsdGeomPrimvar::_ComputeFlattenedHelper(const VtArray<ScalarType> &authored,
                                         const VtIntArray &indices,
                                         VtArray<ScalarType> *value) const
 {
-    value->resize(indices.size());
-    bool success = true;
-    for (size_t i=0; i < indices.size(); i++) {
-        int index = indices[i];
-        if (index >= 0 && index < authored.size()) {
-            (*value)[i] = authored[index];
-        } else {
-            TF_WARN("Index %d at element %zu is out of range [0,%ld) for "
-                "primvar <%s>.", index, i, authored.size(),
-                _attr.GetPath().GetText());
-            success = false;
+    const int *indexData = indices.cdata();
+    const size_t numIndices = indices.size();
+    const size_t numAuthored = authored.size();
+
+    // If the indices are the identity, the flattened result is the
+    // authored array itself; share its representation rather than
+    // copying the data.
+    bool isIdentity = (numIndices == numAuthored);
+    for (size_t i = 0; isIdentity && i < numIndices; ++i) {
+        isIdentity = (indexData[i] == static_cast<int>(i));
+    }
+    if (isIdentity) {
+        *value = authored;
+        return true;
+    }
+
+    value->resize(numIndices);
+
+    // Gather through raw pointers so the inner loop avoids the
+    // per-element copy-on-write checks and can be vectorized.  For
+    // large primvars (e.g. faceVarying UVs on heavy meshes), split the
+    // index range across threads.
+    const ScalarType *authoredData = authored.cdata();
+    ScalarType *valueData = value->data();
+    std::atomic<bool> success(true);
+
+    const auto gatherRange = [&](size_t begin, size_t end) {
+        for (size_t i = begin; i != end; ++i) {
+            const int index = indexData[i];
+            if (index >= 0 && static_cast<size_t>(index) < numAuthored) {
+                valueData[i] = authoredData[index];
+            } else {
+                TF_WARN("Index %d at element %zu is out of range [0,%ld) for "
+                    "primvar <%s>.", index, i, authored.size(),
+                    _attr.GetPath().GetText());
+                success = false;
+            }
         }
+    };
+
+    // Avoid the parallel scheduling overhead for small primvars.
+    static const size_t parallelThreshold = 4096;
+    if (numIndices < parallelThreshold) {
+        gatherRange(0, numIndices);
     }
+    else {
+        WorkParallelForN(numIndices, gatherRange);
+    }
+
     return success;
 }
 
@@ -0,0 +1,72 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#include "pxr/pxr.h"
+#include "pxr/usd/usdGeom/subsetQuery.h"
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+UsdGeomSubsetQuery::UsdGeomSubsetQuery(
+    const std::vector<UsdGeomSubset> &subsets,
+    size_t elementCount,
+    const UsdTimeCode &time /* UsdTimeCode::EarliestTime() */)
+    : _subsets(subsets)
+    , _elementCount(elementCount)
+    , _elementToSubset(elementCount, -1)
+{
+    for (size_t subsetIndex = 0; subsetIndex < _subsets.size();
+         ++subsetIndex) {
+        VtIntArray indices;
+        _subsets[subsetIndex].GetIndicesAttr().Get(&indices, time);
+        for (const int index : indices) {
+            if (index < 0 || static_cast<size_t>(index) >= elementCount) {
+                continue;
+            }
+            // The earliest subset claiming an element wins.
+            if (_elementToSubset[index] == -1) {
+                _elementToSubset[index] = subsetIndex;
+            }
+        }
+    }
+}
+
+UsdGeomSubset
+UsdGeomSubsetQuery::GetSubsetForElement(int elementIndex) const
+{
+    const int subsetIndex = GetSubsetIndexForElement(elementIndex);
+    return subsetIndex == -1 ? UsdGeomSubset() : _subsets[subsetIndex];
+}
+
+VtIntArray
+UsdGeomSubsetQuery::GetUnassignedIndices() const
+{
+    VtIntArray result;
+    for (size_t index = 0; index < _elementCount; ++index) {
+        if (_elementToSubset[index] == -1) {
+            result.push_back(index);
+        }
+    }
+    return result;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
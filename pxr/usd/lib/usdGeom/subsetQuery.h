@@ -0,0 +1,111 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef USDGEOM_SUBSET_QUERY_H
+#define USDGEOM_SUBSET_QUERY_H
+
+#include "pxr/pxr.h"
+#include "pxr/usd/usdGeom/api.h"
+#include "pxr/usd/usdGeom/subset.h"
+
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class UsdGeomSubsetQuery
+///
+/// An inverted index over a set of GeomSubsets, mapping each element
+/// (e.g., face) index to the subset that contains it.  The index is built
+/// once at construction by reading every subset's indices, after which
+/// membership lookups are constant time; this is much cheaper than
+/// re-scanning all the subsets for each query, as the static API on
+/// UsdGeomSubset must.
+///
+/// The query holds plain integer data and does not listen for change
+/// notification; if the subsets' indices or the geometry's topology
+/// changes, a new query must be built.
+///
+class UsdGeomSubsetQuery
+{
+public:
+    /// Construct an empty, invalid query.
+    UsdGeomSubsetQuery() : _elementCount(0) {}
+
+    /// Construct a query for the given \p subsets, which must all apply to
+    /// the same geometry with \p elementCount total elements.  Indices are
+    /// read at the given \p time.
+    ///
+    /// If an element is claimed by more than one subset (which is only
+    /// legal in an "unrestricted" family), the earliest subset in
+    /// \p subsets wins.  Out-of-bounds indices are ignored.
+    USDGEOM_API
+    UsdGeomSubsetQuery(const std::vector<UsdGeomSubset> &subsets,
+                       size_t elementCount,
+                       const UsdTimeCode &time=UsdTimeCode::EarliestTime());
+
+    /// Return the subsets this query was built from, in the order given at
+    /// construction.
+    const std::vector<UsdGeomSubset> &GetSubsets() const {
+        return _subsets;
+    }
+
+    /// Return the total number of elements this query was built with.
+    size_t GetElementCount() const {
+        return _elementCount;
+    }
+
+    /// Return the index into GetSubsets() of the subset containing
+    /// \p elementIndex, or -1 if the element is unassigned or out of
+    /// bounds.
+    int GetSubsetIndexForElement(int elementIndex) const {
+        if (elementIndex < 0 ||
+            static_cast<size_t>(elementIndex) >= _elementCount) {
+            return -1;
+        }
+        return _elementToSubset[elementIndex];
+    }
+
+    /// Return the subset containing \p elementIndex, or an invalid subset
+    /// if the element is unassigned or out of bounds.
+    USDGEOM_API
+    UsdGeomSubset GetSubsetForElement(int elementIndex) const;
+
+    /// Return the indices of all the elements that do not belong to any of
+    /// the subsets.  This is equivalent to
+    /// UsdGeomSubset::GetUnassignedIndices(), but reads off the prebuilt
+    /// index instead of re-resolving every subset's indices.
+    USDGEOM_API
+    VtIntArray GetUnassignedIndices() const;
+
+private:
+    std::vector<UsdGeomSubset> _subsets;
+    size_t _elementCount;
+
+    // For each element, the index into _subsets of the subset that
+    // contains it, or -1 if unassigned.
+    std::vector<int> _elementToSubset;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // USDGEOM_SUBSET_QUERY_H
@@ -159,6 +159,12 @@ class TestUsdGeomPrimvarAPI(unittest.TestCase):
             self.assertTrue(Gf.IsClose(a, b, 1e-5))
         self.assertNotEqual(u1.ComputeFlattened(), u1.Get())
 
+        # Flattening identity indices should return the authored value
+        # unchanged.
+        self.assertTrue(u1.SetIndices(Vt.IntArray([0, 1, 2])))
+        self.assertEqual(u1.ComputeFlattened(), u1.Get())
+        self.assertTrue(u1.SetIndices(indices))
+
         self.assertEqual(u1.GetUnauthoredValuesIndex(), -1)
         self.assertTrue(u1.SetUnauthoredValuesIndex(2))
         self.assertEqual(u1.GetUnauthoredValuesIndex(), 2)
@@ -150,5 +150,33 @@ class testUsdGeomSubset(unittest.TestCase):
                 UsdGeom.Imageable(sphere))
         self.assertEqual(len(allGeomSubsets), 21)
 
+    def test_SubsetQuery(self):
+        geom = UsdGeom.Imageable(sphere)
+        materialBindSubsets = UsdGeom.Subset.GetGeomSubsets(geom,
+            elementType=UsdGeom.Tokens.face,
+            familyName='materialBind')
+
+        query = UsdGeom.SubsetQuery(materialBindSubsets, 16)
+        self.assertEqual(query.GetElementCount(), 16)
+        self.assertEqual(len(query.GetSubsets()), len(materialBindSubsets))
+
+        # Every element's reverse lookup must agree with the subsets'
+        # authored indices.
+        for subsetIndex, subset in enumerate(materialBindSubsets):
+            for element in subset.GetIndicesAttr().Get():
+                self.assertEqual(query.GetSubsetIndexForElement(element),
+                                 subsetIndex)
+                self.assertEqual(query.GetSubsetForElement(element).GetPrim(),
+                                 subset.GetPrim())
+
+        # Out-of-bounds lookups are unassigned.
+        self.assertEqual(query.GetSubsetIndexForElement(-1), -1)
+        self.assertEqual(query.GetSubsetIndexForElement(16), -1)
+
+        # The prebuilt index must agree with the scanning implementation.
+        self.assertEqual(
+            list(query.GetUnassignedIndices()),
+            list(UsdGeom.Subset.GetUnassignedIndices(materialBindSubsets, 16)))
+
 if __name__ == "__main__":
     unittest.main()
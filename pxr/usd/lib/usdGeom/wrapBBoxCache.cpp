@@ -161,6 +161,9 @@ void wrapUsdGeomBBoxCache()
              (arg("instancer"), arg("instanceId")))
         
         .def("Clear", &BBoxCache::Clear)
+        .def("Invalidate",
+             (void (BBoxCache::*)(const SdfPathVector &))
+             &BBoxCache::Invalidate, arg("subtreePaths"))
         .def("SetIncludedPurposes", &BBoxCache::SetIncludedPurposes,
              arg("includedPurposes"))
         .def("GetIncludedPurposes", &BBoxCache::GetIncludedPurposes,
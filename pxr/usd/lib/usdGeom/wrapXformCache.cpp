@@ -59,6 +59,9 @@ void wrapUsdGeomXformCache()
         .def("GetLocalTransformation",
              &_GetLocalTransformation, arg("prim"))
         .def("Clear", &XformCache::Clear)
+        .def("Invalidate",
+             (void (XformCache::*)(const SdfPathVector &))
+             &XformCache::Invalidate, arg("subtreePaths"))
         .def("SetTime", &XformCache::SetTime, arg("time"))
         .def("GetTime", &XformCache::GetTime)
 
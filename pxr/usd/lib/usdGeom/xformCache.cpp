@@ -28,6 +28,13 @@
 #include "pxr/base/tracelite/trace.h"
 
 #include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/tf/pyLock.h"
+#include "pxr/base/work/loops.h"
+
+#include <tbb/enumerable_thread_specific.h>
+
+#include <algorithm>
+#include <numeric>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -59,6 +66,60 @@ UsdGeomXformCache::GetLocalToWorldTransform(const UsdPrim& prim)
     return *_GetCtm(prim);
 }
 
+void
+UsdGeomXformCache::ComputeLocalToWorldTransforms(
+    const std::vector<UsdPrim>& prims,
+    std::vector<GfMatrix4d>* xforms)
+{
+    TRACE_FUNCTION();
+
+    xforms->resize(prims.size());
+    if (prims.empty())
+        return;
+
+    // Drop the GIL before spawning parallel work; resolving attribute
+    // values in worker threads may invoke plugin code that needs it.
+    TF_PY_ALLOW_THREADS_IN_SCOPE();
+
+    // Evaluate the request in path-sorted order so that ancestors are
+    // visited before their descendants; each prim then typically extends a
+    // cached ancestor transform by a single step instead of walking all the
+    // way to the root.
+    std::vector<size_t> order(prims.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(),
+              [&prims](size_t a, size_t b) {
+                  return prims[a].GetPath() < prims[b].GetPath();
+              });
+
+    // Each worker accumulates transforms into its own cache, since the Get*
+    // methods are not thread safe.  WorkParallelForN hands out contiguous
+    // chunks of the sorted order, so a worker tends to stay within a single
+    // subtree and rarely recomputes another worker's ancestors.
+    UsdGeomXformCache workerProto(_time);
+    workerProto.SetWorldPath(_worldPath);
+    tbb::enumerable_thread_specific<UsdGeomXformCache>
+        workerCaches(workerProto);
+
+    WorkParallelForN(
+        prims.size(),
+        [&prims, &order, &workerCaches, xforms](size_t begin,
+                                                size_t end) {
+            UsdGeomXformCache& cache = workerCaches.local();
+            for (size_t i = begin; i != end; ++i) {
+                const size_t request = order[i];
+                (*xforms)[request] =
+                    cache.GetLocalToWorldTransform(prims[request]);
+            }
+        });
+
+    // Fold the per-thread caches back into this cache so that subsequent
+    // single-prim queries hit.
+    for (const UsdGeomXformCache& cache : workerCaches) {
+        Merge(cache);
+    }
+}
+
 GfMatrix4d
 UsdGeomXformCache::GetParentToWorldTransform(const UsdPrim& prim)
 {
@@ -191,11 +252,44 @@ UsdGeomXformCache::SetTime(UsdTimeCode time)
     _time = time;
 }
 
-void 
-UsdGeomXformCache::Clear() { 
+void
+UsdGeomXformCache::Clear() {
     _ctmCache.clear();
 }
 
+void
+UsdGeomXformCache::Invalidate(const SdfPathVector& subtreePaths)
+{
+    if (subtreePaths.empty())
+        return;
+
+    SdfPathVector roots = subtreePaths;
+    std::sort(roots.begin(), roots.end());
+
+    // Erase entries at and below any invalidated subtree root; both the
+    // cached ctm and the xform query may be stale for those prims.
+    for (_PrimHashMap::iterator it = _ctmCache.begin();
+         it != _ctmCache.end(); ) {
+        if (SdfPathFindLongestPrefix(
+                roots.begin(), roots.end(), it->first.GetPath())
+            != roots.end()) {
+            _ctmCache.erase(it++);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void
+UsdGeomXformCache::Invalidate(const UsdNotice::ObjectsChanged& notice)
+{
+    SdfPathVector paths = notice.GetResyncedPaths();
+    for (const SdfPath& p : notice.GetChangedInfoOnlyPaths()) {
+        paths.push_back(p.GetPrimPath());
+    }
+    Invalidate(paths);
+}
+
 void
 UsdGeomXformCache::SetWorldPath(const SdfPath& rootPath)
 {
@@ -220,5 +314,16 @@ UsdGeomXformCache::Swap(UsdGeomXformCache& other)
     std::swap(_worldPath, other._worldPath);
 }
 
+void
+UsdGeomXformCache::Merge(const UsdGeomXformCache& other)
+{
+    if (other._time != _time || other._worldPath != _worldPath)
+        return;
+
+    TF_FOR_ALL(it, other._ctmCache) {
+        _ctmCache.insert(*it);
+    }
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
 
@@ -27,6 +27,7 @@
 #include "pxr/pxr.h"
 #include "pxr/usd/usdGeom/api.h"
 #include "pxr/usd/usd/attributeQuery.h"
+#include "pxr/usd/usd/notice.h"
 #include "pxr/usd/usd/prim.h"
 
 #include "pxr/usd/usdGeom/xformable.h"
@@ -74,6 +75,20 @@ public:
     USDGEOM_API
     GfMatrix4d GetLocalToWorldTransform(const UsdPrim& prim);
 
+    /// Compute transformation matrices for all the prims in \p prims,
+    /// writing the result for prims[i] to (*xforms)[i].  \p xforms is
+    /// resized to match \p prims.
+    ///
+    /// This is equivalent to calling GetLocalToWorldTransform() for each
+    /// prim, but the request is evaluated in path-sorted order so each
+    /// unique ancestor transform is computed only once, and the evaluation
+    /// is distributed across threads.  The transforms computed by the
+    /// worker threads are merged back into this cache, so subsequent
+    /// single-prim queries will hit.  All prims must be valid.
+    USDGEOM_API
+    void ComputeLocalToWorldTransforms(const std::vector<UsdPrim>& prims,
+                                       std::vector<GfMatrix4d>* xforms);
+
     /// Compute the transformation matrix for the given \p prim, but do NOT
     /// include the transform authored on the prim itself.
     ///
@@ -116,6 +131,22 @@ public:
     USDGEOM_API
     void Clear();
 
+    /// Invalidate cached values for the prims at and below each path in
+    /// \p subtreePaths.  Since a prim's world transform depends only on
+    /// itself and its ancestors, invalidating the subtree rooted at each
+    /// changed prim is sufficient; cached values for all other prims are
+    /// retained.  This is much cheaper than Clear() when reacting to a
+    /// localized change such as an interactive manipulation.
+    USDGEOM_API
+    void Invalidate(const SdfPathVector& subtreePaths);
+
+    /// \overload
+    /// Invalidate cached values affected by \p notice.  This is equivalent
+    /// to calling Invalidate() with the union of the notice's resynced and
+    /// changed-info prim paths.
+    USDGEOM_API
+    void Invalidate(const UsdNotice::ObjectsChanged& notice);
+
     /// Use the new \p time when computing values and may clear any existing
     /// values cached for the previous time. Setting \p time to the current time
     /// is a no-op.
@@ -147,6 +178,16 @@ public:
     USDGEOM_API
     void Swap(UsdGeomXformCache& other);
 
+    /// Add the entries cached in \p other to this cache.  Entries already
+    /// present in this cache are retained.  Entries are only compatible
+    /// between caches reading at the same time and with the same world path;
+    /// if \p other differs in either, this call does nothing.
+    ///
+    /// This is useful for combining the per-thread caches built up during a
+    /// parallel computation.
+    USDGEOM_API
+    void Merge(const UsdGeomXformCache& other);
+
 private:
 
     // Traverses backwards the hierarchy starting from prim
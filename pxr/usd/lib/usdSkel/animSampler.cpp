@@ -0,0 +1,196 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#include "pxr/pxr.h"
+#include "pxr/usd/usdSkel/animSampler.h"
+
+#include "pxr/base/gf/quatf.h"
+#include "pxr/base/gf/vec3h.h"
+#include "pxr/base/vt/types.h"
+
+#include <cmath>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+UsdSkelAnimSampler::UsdSkelAnimSampler()
+    : _numJoints(0)
+    , _maxFrames(0)
+    , _useCounter(0)
+{
+}
+
+UsdSkelAnimSampler::UsdSkelAnimSampler(
+    const UsdSkelPackedJointAnimation &anim,
+    size_t maxFrames /* = 16 */)
+    : _anim(anim)
+    , _numJoints(0)
+    , _maxFrames(maxFrames)
+    , _useCounter(0)
+{
+    if (!_anim) {
+        return;
+    }
+
+    SdfPathVector jointPaths;
+    if (_anim.GetJointsRel().GetTargets(&jointPaths) &&
+        !jointPaths.empty()) {
+        _numJoints = jointPaths.size();
+    } else {
+        // Self-contained animations without an authored joints rel are
+        // sized by their rotation data.
+        VtQuatfArray rotations;
+        _anim.GetRotationsAttr().Get(&rotations,
+                                     UsdTimeCode::EarliestTime());
+        _numJoints = rotations.size();
+    }
+
+    if (_numJoints == 0) {
+        TF_WARN("PackedJointAnimation <%s> has no joints.",
+                _anim.GetPath().GetText());
+    }
+}
+
+bool
+UsdSkelAnimSampler::_DecodeFrame(UsdTimeCode time, _Frame *frame) const
+{
+    VtVec3fArray translations;
+    VtQuatfArray rotations;
+    VtVec3hArray scales;
+    _anim.GetTranslationsAttr().Get(&translations, time);
+    _anim.GetRotationsAttr().Get(&rotations, time);
+    _anim.GetScalesAttr().Get(&scales, time);
+
+    if (translations.size() != _numJoints ||
+        rotations.size() != _numJoints) {
+        return false;
+    }
+    const bool hasScales = scales.size() == _numJoints;
+
+    frame->translations.resize(_numJoints * 3);
+    frame->rotations.resize(_numJoints * 4);
+    frame->scales.resize(_numJoints * 3);
+
+    // GfVec3f is a contiguous float triple.
+    const float *translationsData =
+        reinterpret_cast<const float *>(translations.cdata());
+    std::copy(translationsData, translationsData + _numJoints * 3,
+              frame->translations.begin());
+
+    // Unpack quaternions as (ix, iy, iz, real) quadruples.  The flat
+    // normalization loop below vectorizes well.
+    const GfQuatf *rotationsData = rotations.cdata();
+    float *quads = &frame->rotations[0];
+    for (size_t i = 0; i < _numJoints; ++i) {
+        const GfVec3f &imaginary = rotationsData[i].GetImaginary();
+        quads[i * 4 + 0] = imaginary[0];
+        quads[i * 4 + 1] = imaginary[1];
+        quads[i * 4 + 2] = imaginary[2];
+        quads[i * 4 + 3] = rotationsData[i].GetReal();
+    }
+    for (size_t i = 0; i < _numJoints; ++i) {
+        const float lengthSq =
+            quads[i * 4 + 0] * quads[i * 4 + 0] +
+            quads[i * 4 + 1] * quads[i * 4 + 1] +
+            quads[i * 4 + 2] * quads[i * 4 + 2] +
+            quads[i * 4 + 3] * quads[i * 4 + 3];
+        const float invLength =
+            lengthSq > 0.0f ? 1.0f / std::sqrt(lengthSq) : 0.0f;
+        quads[i * 4 + 0] *= invLength;
+        quads[i * 4 + 1] *= invLength;
+        quads[i * 4 + 2] *= invLength;
+        quads[i * 4 + 3] *= invLength;
+    }
+
+    if (hasScales) {
+        const GfVec3h *scalesData = scales.cdata();
+        for (size_t i = 0; i < _numJoints; ++i) {
+            frame->scales[i * 3 + 0] = scalesData[i][0];
+            frame->scales[i * 3 + 1] = scalesData[i][1];
+            frame->scales[i * 3 + 2] = scalesData[i][2];
+        }
+    } else {
+        std::fill(frame->scales.begin(), frame->scales.end(), 1.0f);
+    }
+
+    return true;
+}
+
+bool
+UsdSkelAnimSampler::Sample(UsdTimeCode time,
+                           const float **translations,
+                           const float **rotations,
+                           const float **scales)
+{
+    if (!IsValid()) {
+        return false;
+    }
+
+    std::map<UsdTimeCode, _Frame>::iterator it = _frames.find(time);
+    if (it == _frames.end()) {
+        _Frame frame;
+        if (!_DecodeFrame(time, &frame)) {
+            return false;
+        }
+        it = _frames.insert(std::make_pair(time, _Frame())).first;
+        it->second.translations.swap(frame.translations);
+        it->second.rotations.swap(frame.rotations);
+        it->second.scales.swap(frame.scales);
+        it->second.lastUse = ++_useCounter;
+
+        // Slide the window: evict the least recently sampled frames.
+        // The frame just decoded is always the most recent, so it is
+        // never the eviction candidate.
+        while (_maxFrames > 0 && _frames.size() > _maxFrames &&
+               _frames.size() > 1) {
+            std::map<UsdTimeCode, _Frame>::iterator oldest = _frames.begin();
+            for (std::map<UsdTimeCode, _Frame>::iterator fit =
+                     _frames.begin(); fit != _frames.end(); ++fit) {
+                if (fit->second.lastUse < oldest->second.lastUse) {
+                    oldest = fit;
+                }
+            }
+            _frames.erase(oldest);
+        }
+    } else {
+        it->second.lastUse = ++_useCounter;
+    }
+
+    if (translations) {
+        *translations = &it->second.translations[0];
+    }
+    if (rotations) {
+        *rotations = &it->second.rotations[0];
+    }
+    if (scales) {
+        *scales = &it->second.scales[0];
+    }
+    return true;
+}
+
+void
+UsdSkelAnimSampler::Clear()
+{
+    _frames.clear();
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
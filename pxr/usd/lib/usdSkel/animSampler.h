@@ -0,0 +1,120 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef USDSKEL_ANIMSAMPLER_H
+#define USDSKEL_ANIMSAMPLER_H
+
+/// \file usdSkel/animSampler.h
+
+#include "pxr/pxr.h"
+#include "pxr/usd/usdSkel/api.h"
+#include "pxr/usd/usdSkel/packedJointAnimation.h"
+
+#include "pxr/usd/usd/timeCode.h"
+
+#include <map>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class UsdSkelAnimSampler
+///
+/// Windowed decode cache for UsdSkelPackedJointAnimation.
+///
+/// Scrubbing a packed joint animation through the generated attribute API
+/// re-reads and re-boxes the whole translations/rotations/scales arrays
+/// on every frame.  A sampler instead decodes each requested frame once
+/// into flat float buffers -- normalizing quaternions as it goes -- and
+/// retains a sliding window of recently used frames, evicting the least
+/// recently sampled frame when the window is full.  The flat layout is
+/// directly consumable by CPU skinning inner loops and by GPU upload.
+///
+/// Per frame, a sample holds numJoints entries of:
+/// \li translations: 3 floats (x, y, z)
+/// \li rotations:    4 floats (ix, iy, iz, real), unit length
+/// \li scales:       3 floats; all ones if the animation has no scales
+///
+/// Returned buffer pointers remain valid until their frame is evicted or
+/// the sampler is cleared or destroyed.  The sampler is \em not
+/// threadsafe for concurrent use.
+class UsdSkelAnimSampler
+{
+public:
+    /// Construct an invalid sampler.
+    USDSKEL_API
+    UsdSkelAnimSampler();
+
+    /// Construct a sampler over \p anim, retaining at most \p maxFrames
+    /// decoded frames.
+    ///
+    /// The joint count is fixed at construction from the animation's
+    /// \em joints relationship, falling back to the size of the rotations
+    /// array at the earliest time when the relationship has no targets.
+    USDSKEL_API
+    explicit UsdSkelAnimSampler(const UsdSkelPackedJointAnimation &anim,
+                                size_t maxFrames = 16);
+
+    /// Return true if the sampler is bound to an animation with joints.
+    bool IsValid() const { return _numJoints > 0; }
+
+    /// Return the number of joints in each decoded frame.
+    size_t GetNumJoints() const { return _numJoints; }
+
+    /// Return the maximum number of decoded frames retained.
+    size_t GetMaxFrames() const { return _maxFrames; }
+
+    /// Decode the animation at \p time, or fetch the already-decoded
+    /// frame, and return pointers to its flat buffers.  Any of the
+    /// output pointers may be NULL if the caller does not need that
+    /// component.  Returns false if the sampler is invalid or the
+    /// animation's arrays at \p time do not match the joint count.
+    USDSKEL_API
+    bool Sample(UsdTimeCode time,
+                const float **translations,
+                const float **rotations,
+                const float **scales);
+
+    /// Drop all decoded frames.
+    USDSKEL_API
+    void Clear();
+
+private:
+    struct _Frame {
+        size_t lastUse;
+        std::vector<float> translations;
+        std::vector<float> rotations;
+        std::vector<float> scales;
+    };
+
+    bool _DecodeFrame(UsdTimeCode time, _Frame *frame) const;
+
+    UsdSkelPackedJointAnimation _anim;
+    size_t _numJoints;
+    size_t _maxFrames;
+    size_t _useCounter;
+    std::map<UsdTimeCode, _Frame> _frames;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // USDSKEL_ANIMSAMPLER_H
@@ -30,5 +30,7 @@ TF_WRAP_MODULE
     TF_WRAP(UsdSkelSkeleton);
     TF_WRAP(UsdSkelPackedJointAnimation);
     TF_WRAP(UsdSkelBindingAPI);
+    TF_WRAP(UsdSkelAnimSampler);
+    TF_WRAP(UsdSkelSkinningEngine);
     TF_WRAP(UsdSkelTokens);
 }
@@ -0,0 +1,368 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#include "pxr/pxr.h"
+#include "pxr/usd/usdSkel/skinningEngine.h"
+
+#include "pxr/base/gf/matrix4f.h"
+#include "pxr/base/gf/quatd.h"
+#include "pxr/base/gf/quatf.h"
+#include "pxr/base/gf/vec3h.h"
+#include "pxr/base/tf/pyLock.h"
+#include "pxr/base/work/loops.h"
+
+#include <algorithm>
+#include <map>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+namespace {
+
+// Builds a joint-local matrix from the packed animation's TRS components,
+// expanding the rotation directly as in GfMatrix4d::SetRotate.  A NULL
+// scale means identity scaling.
+GfMatrix4d
+_ComposeJointLocalTransform(const GfVec3f &translation,
+                            const GfQuatf &rotation,
+                            const GfVec3h *scale)
+{
+    GfMatrix4d m(1.0);
+
+    const GfQuatd quat = GfQuatd(rotation).GetNormalized();
+    const double r = quat.GetReal();
+    const GfVec3d &i = quat.GetImaginary();
+
+    m[0][0] = 1.0 - 2.0 * (i[1] * i[1] + i[2] * i[2]);
+    m[0][1] =       2.0 * (i[0] * i[1] + i[2] *    r);
+    m[0][2] =       2.0 * (i[2] * i[0] - i[1] *    r);
+
+    m[1][0] =       2.0 * (i[0] * i[1] - i[2] *    r);
+    m[1][1] = 1.0 - 2.0 * (i[2] * i[2] + i[0] * i[0]);
+    m[1][2] =       2.0 * (i[1] * i[2] + i[0] *    r);
+
+    m[2][0] =       2.0 * (i[2] * i[0] + i[1] *    r);
+    m[2][1] =       2.0 * (i[1] * i[2] - i[0] *    r);
+    m[2][2] = 1.0 - 2.0 * (i[0] * i[0] + i[1] * i[1]);
+
+    if (scale) {
+        for (int row = 0; row < 3; ++row) {
+            const double s = (*scale)[row];
+            m[row][0] *= s;
+            m[row][1] *= s;
+            m[row][2] *= s;
+        }
+    }
+
+    m.SetTranslateOnly(GfVec3d(translation));
+    return m;
+}
+
+} // anonymous namespace
+
+UsdSkelSkinningEngine::UsdSkelSkinningEngine()
+{
+}
+
+UsdSkelSkinningEngine::UsdSkelSkinningEngine(
+    const UsdSkelSkeleton &skeleton,
+    const UsdSkelPackedJointAnimation &anim)
+    : _anim(anim)
+{
+    SdfPathVector jointPaths;
+    if (!skeleton ||
+        !skeleton.GetJointsRel().GetTargets(&jointPaths) ||
+        jointPaths.empty()) {
+        TF_WARN("Skeleton <%s> has no joints.",
+                skeleton.GetPath().GetText());
+        return;
+    }
+
+    VtMatrix4dArray restXforms;
+    if (!skeleton.GetRestTransformsAttr().Get(&restXforms) ||
+        restXforms.size() != jointPaths.size()) {
+        TF_WARN("Skeleton <%s>: restTransforms do not match the joint "
+                "count (%zu joints, %zu rest transforms).",
+                skeleton.GetPath().GetText(),
+                jointPaths.size(), restXforms.size());
+        return;
+    }
+
+    const size_t numJoints = jointPaths.size();
+
+    // Derive the joint hierarchy from the namespace hierarchy of the
+    // joint paths: a joint's parent is its closest ancestor path that is
+    // itself a joint.
+    std::map<SdfPath, int> jointIndicesByPath;
+    for (size_t i = 0; i < numJoints; ++i) {
+        jointIndicesByPath[jointPaths[i]] = i;
+    }
+
+    _parentIndices.assign(numJoints, -1);
+    for (size_t i = 0; i < numJoints; ++i) {
+        for (SdfPath p = jointPaths[i].GetParentPath();
+             p != SdfPath::AbsoluteRootPath() && !p.IsEmpty();
+             p = p.GetParentPath()) {
+            std::map<SdfPath, int>::const_iterator parentIt =
+                jointIndicesByPath.find(p);
+            if (parentIt != jointIndicesByPath.end()) {
+                _parentIndices[i] = parentIt->second;
+                break;
+            }
+        }
+    }
+
+    // Parents always have strictly fewer path elements than their
+    // children, so depth order gives a valid composition order.
+    _depthOrder.resize(numJoints);
+    for (size_t i = 0; i < numJoints; ++i) {
+        _depthOrder[i] = i;
+    }
+    std::sort(_depthOrder.begin(), _depthOrder.end(),
+              [&jointPaths](size_t a, size_t b) {
+                  const size_t depthA = jointPaths[a].GetPathElementCount();
+                  const size_t depthB = jointPaths[b].GetPathElementCount();
+                  return depthA != depthB ? depthA < depthB : a < b;
+              });
+
+    _restLocalXforms.assign(restXforms.begin(), restXforms.end());
+
+    // Compose the rest pose into skeleton space to obtain the inverse
+    // bind transforms.
+    std::vector<GfMatrix4d> restSkelXforms(numJoints);
+    for (const size_t jointIndex : _depthOrder) {
+        const int parent = _parentIndices[jointIndex];
+        restSkelXforms[jointIndex] = parent < 0
+            ? _restLocalXforms[jointIndex]
+            : _restLocalXforms[jointIndex] * restSkelXforms[parent];
+    }
+    _inverseBindXforms.resize(numJoints);
+    for (size_t i = 0; i < numJoints; ++i) {
+        _inverseBindXforms[i] = restSkelXforms[i].GetInverse();
+    }
+
+    // Map animation joints onto skeleton joints.  An animation without an
+    // authored joints rel is taken to target the skeleton's joints in
+    // order, which we denote with an empty mapping.
+    SdfPathVector animJointPaths;
+    if (_anim && _anim.GetJointsRel().GetTargets(&animJointPaths) &&
+        !animJointPaths.empty()) {
+        _animToSkelIndices.reserve(animJointPaths.size());
+        for (const SdfPath &animJointPath : animJointPaths) {
+            std::map<SdfPath, int>::const_iterator it =
+                jointIndicesByPath.find(animJointPath);
+            _animToSkelIndices.push_back(
+                it == jointIndicesByPath.end() ? -1 : it->second);
+        }
+    }
+}
+
+void
+UsdSkelSkinningEngine::_ComputeJointSkelTransforms(
+    UsdTimeCode time,
+    std::vector<GfMatrix4d> *xforms) const
+{
+    const size_t numJoints = _restLocalXforms.size();
+
+    // Joints the animation does not override hold their rest transforms.
+    std::vector<GfMatrix4d> localXforms = _restLocalXforms;
+
+    if (_anim) {
+        VtVec3fArray translations;
+        VtQuatfArray rotations;
+        VtVec3hArray scales;
+        _anim.GetTranslationsAttr().Get(&translations, time);
+        _anim.GetRotationsAttr().Get(&rotations, time);
+        _anim.GetScalesAttr().Get(&scales, time);
+
+        // Translations and rotations must agree on the animated joint
+        // count; scales are optional.
+        const size_t numAnimJoints = rotations.size();
+        if (numAnimJoints > 0 && translations.size() == numAnimJoints) {
+            const bool hasScales = scales.size() == numAnimJoints;
+            for (size_t i = 0; i < numAnimJoints; ++i) {
+                int skelIndex = -1;
+                if (_animToSkelIndices.empty()) {
+                    if (i < numJoints) {
+                        skelIndex = i;
+                    }
+                } else if (i < _animToSkelIndices.size()) {
+                    skelIndex = _animToSkelIndices[i];
+                }
+                if (skelIndex < 0) {
+                    continue;
+                }
+                localXforms[skelIndex] = _ComposeJointLocalTransform(
+                    translations[i], rotations[i],
+                    hasScales ? &scales[i] : NULL);
+            }
+        }
+    }
+
+    xforms->resize(numJoints);
+    for (const size_t jointIndex : _depthOrder) {
+        const int parent = _parentIndices[jointIndex];
+        (*xforms)[jointIndex] = parent < 0
+            ? localXforms[jointIndex]
+            : localXforms[jointIndex] * (*xforms)[parent];
+    }
+}
+
+bool
+UsdSkelSkinningEngine::ComputeSkinningTransforms(
+    UsdTimeCode time,
+    VtMatrix4dArray *xforms)
+{
+    if (!IsValid()) {
+        return false;
+    }
+
+    std::map<UsdTimeCode, VtMatrix4dArray>::const_iterator it =
+        _xformCache.find(time);
+    if (it == _xformCache.end()) {
+        std::vector<GfMatrix4d> skelXforms;
+        _ComputeJointSkelTransforms(time, &skelXforms);
+
+        VtMatrix4dArray skinningXforms(skelXforms.size());
+        for (size_t i = 0; i < skelXforms.size(); ++i) {
+            skinningXforms[i] = _inverseBindXforms[i] * skelXforms[i];
+        }
+        it = _xformCache.insert(
+            std::make_pair(time, skinningXforms)).first;
+    }
+
+    if (xforms) {
+        *xforms = it->second;
+    }
+    return true;
+}
+
+bool
+UsdSkelSkinningEngine::SkinPoints(
+    UsdTimeCode time,
+    const GfMatrix4d &geomBindTransform,
+    const VtIntArray &jointIndices,
+    const VtFloatArray &jointWeights,
+    int numInfluencesPerPoint,
+    VtVec3fArray *points)
+{
+    VtMatrix4dArray skinningXforms;
+    if (!ComputeSkinningTransforms(time, &skinningXforms)) {
+        return false;
+    }
+    return ComputeSkinnedPoints(geomBindTransform, skinningXforms,
+                                jointIndices, jointWeights,
+                                numInfluencesPerPoint, points);
+}
+
+void
+UsdSkelSkinningEngine::Clear()
+{
+    _xformCache.clear();
+}
+
+bool
+UsdSkelSkinningEngine::ComputeSkinnedPoints(
+    const GfMatrix4d &geomBindTransform,
+    const VtMatrix4dArray &skinningTransforms,
+    const VtIntArray &jointIndices,
+    const VtFloatArray &jointWeights,
+    int numInfluencesPerPoint,
+    VtVec3fArray *points)
+{
+    if (!points) {
+        TF_CODING_ERROR("Null points pointer.");
+        return false;
+    }
+    if (numInfluencesPerPoint <= 0 ||
+        jointIndices.size() != jointWeights.size()) {
+        return false;
+    }
+
+    const size_t numPoints = points->size();
+    const size_t stride = numInfluencesPerPoint;
+    const bool constantInterp = jointIndices.size() == stride;
+    if (!constantInterp && jointIndices.size() != numPoints * stride) {
+        return false;
+    }
+
+    const size_t numXforms = skinningTransforms.size();
+    for (const int jointIndex : jointIndices) {
+        if (jointIndex < 0 || static_cast<size_t>(jointIndex) >= numXforms) {
+            return false;
+        }
+    }
+
+    // Fold the geomBindTransform into each skinning transform and demote
+    // to single precision, so the per-point blend is float-only.  Points
+    // whose weights do not sum to one are handled by the homogeneous
+    // divide in Transform().
+    std::vector<GfMatrix4f> xforms(numXforms);
+    for (size_t i = 0; i < numXforms; ++i) {
+        xforms[i] = GfMatrix4f(geomBindTransform * skinningTransforms[i]);
+    }
+
+    const int *indicesData = jointIndices.cdata();
+    const float *weightsData = jointWeights.cdata();
+    GfVec3f *pointsData = points->data();
+
+    if (constantInterp) {
+        // A single influence set rigidly deforms every point.
+        GfMatrix4f blend(0.0f);
+        for (size_t k = 0; k < stride; ++k) {
+            const float weight = weightsData[k];
+            if (weight != 0.0f) {
+                blend += xforms[indicesData[k]] * weight;
+            }
+        }
+        TF_PY_ALLOW_THREADS_IN_SCOPE();
+        WorkParallelForN(
+            numPoints,
+            [&blend, pointsData](size_t start, size_t end) {
+                for (size_t i = start; i < end; ++i) {
+                    pointsData[i] = blend.Transform(pointsData[i]);
+                }
+            });
+        return true;
+    }
+
+    TF_PY_ALLOW_THREADS_IN_SCOPE();
+    WorkParallelForN(
+        numPoints,
+        [&xforms, indicesData, weightsData, pointsData, stride](
+            size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                GfMatrix4f blend(0.0f);
+                const size_t offset = i * stride;
+                for (size_t k = 0; k < stride; ++k) {
+                    const float weight = weightsData[offset + k];
+                    if (weight != 0.0f) {
+                        blend += xforms[indicesData[offset + k]] * weight;
+                    }
+                }
+                pointsData[i] = blend.Transform(pointsData[i]);
+            }
+        });
+    return true;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,164 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef USDSKEL_SKINNINGENGINE_H
+#define USDSKEL_SKINNINGENGINE_H
+
+/// \file usdSkel/skinningEngine.h
+
+#include "pxr/pxr.h"
+#include "pxr/usd/usdSkel/api.h"
+#include "pxr/usd/usdSkel/packedJointAnimation.h"
+#include "pxr/usd/usdSkel/skeleton.h"
+
+#include "pxr/usd/usd/timeCode.h"
+
+#include "pxr/base/gf/matrix4d.h"
+#include "pxr/base/vt/array.h"
+#include "pxr/base/vt/types.h"
+
+#include <map>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \class UsdSkelSkinningEngine
+///
+/// Evaluation engine for skeletal deformation.
+///
+/// A skinning engine binds a UsdSkelSkeleton to a
+/// UsdSkelPackedJointAnimation and computes the skinning transform of
+/// every joint -- the transform taking a point from its bind position in
+/// skeleton space to its deformed position -- at a requested time.
+/// Decoded skinning transforms are cached per time, so interleaved
+/// evaluation of several gprims bound to the same skeleton only pays the
+/// joint decode and hierarchy composition cost once per time.
+///
+/// Computed skinning transforms feed the linear-blend skinning kernel
+/// ComputeSkinnedPoints(), which consumes the packed joint influences
+/// authored through UsdSkelBindingAPI (\em jointIndices, \em jointWeights
+/// and \em geomBindTransform) and deforms points in parallel.
+///
+/// The engine reads the skeleton's topology and rest transforms once, at
+/// construction.  It is not a listener; if the skeleton or animation is
+/// edited, discard the engine and construct a new one.  Clear() drops
+/// only the per-time transform cache.
+///
+/// This class is \em not threadsafe for concurrent use; clients should
+/// use a separate engine per thread, or serialize calls.
+class UsdSkelSkinningEngine
+{
+public:
+    /// Construct an invalid engine.
+    USDSKEL_API
+    UsdSkelSkinningEngine();
+
+    /// Construct an engine that poses \p skeleton with \p anim.
+    ///
+    /// The skeleton must have a \em joints relationship and matching
+    /// \em restTransforms; otherwise the engine is invalid.  Joints that
+    /// the animation does not target hold their rest transforms.
+    USDSKEL_API
+    UsdSkelSkinningEngine(const UsdSkelSkeleton &skeleton,
+                          const UsdSkelPackedJointAnimation &anim);
+
+    /// Return true if the engine was successfully bound to a skeleton.
+    bool IsValid() const { return !_restLocalXforms.empty(); }
+
+    /// Return the number of joints in the bound skeleton.
+    size_t GetNumJoints() const { return _restLocalXforms.size(); }
+
+    /// Compute the skinning transform of every joint at \p time, in the
+    /// ordering imposed by the skeleton's \em joints relationship.
+    ///
+    /// The result of each distinct time is cached; repeated queries at
+    /// the same time return the cached transforms.  Returns false if the
+    /// engine is invalid.
+    USDSKEL_API
+    bool ComputeSkinningTransforms(UsdTimeCode time,
+                                   VtMatrix4dArray *xforms);
+
+    /// Deform \p points in place at \p time using linear-blend skinning.
+    ///
+    /// This is a convenience combining ComputeSkinningTransforms() with
+    /// the ComputeSkinnedPoints() kernel; see the latter for the meaning
+    /// of the influence arguments.  Returns false if the engine is
+    /// invalid or the influence data is malformed.
+    USDSKEL_API
+    bool SkinPoints(UsdTimeCode time,
+                    const GfMatrix4d &geomBindTransform,
+                    const VtIntArray &jointIndices,
+                    const VtFloatArray &jointWeights,
+                    int numInfluencesPerPoint,
+                    VtVec3fArray *points);
+
+    /// Drop all cached per-time skinning transforms.
+    USDSKEL_API
+    void Clear();
+
+    /// Deform \p points in place with linear-blend skinning.
+    ///
+    /// \p jointIndices and \p jointWeights are packed influence arrays of
+    /// \p numInfluencesPerPoint entries per point, as authored through
+    /// UsdSkelBindingAPI with \em vertex interpolation.  If the arrays
+    /// hold exactly \p numInfluencesPerPoint entries in total they are
+    /// treated as \em constant interpolation: the single influence set
+    /// rigidly deforms every point.  \p geomBindTransform takes points
+    /// from gprim object space into skeleton space.
+    ///
+    /// Influences with zero weight are skipped, and joint indices out of
+    /// range of \p skinningTransforms invalidate the whole computation.
+    /// The blend is performed in single precision across points in
+    /// parallel.  Returns false and leaves \p points untouched on
+    /// malformed input.
+    USDSKEL_API
+    static bool ComputeSkinnedPoints(const GfMatrix4d &geomBindTransform,
+                                     const VtMatrix4dArray &skinningTransforms,
+                                     const VtIntArray &jointIndices,
+                                     const VtFloatArray &jointWeights,
+                                     int numInfluencesPerPoint,
+                                     VtVec3fArray *points);
+
+private:
+    // Compose the animated joint-local transforms at \p time into
+    // skeleton space, in skeleton joint order.
+    void _ComputeJointSkelTransforms(UsdTimeCode time,
+                                     std::vector<GfMatrix4d> *xforms) const;
+
+    UsdSkelPackedJointAnimation _anim;
+
+    // Skeleton topology, in the order of the skeleton's joints rel.
+    std::vector<int> _parentIndices;      // -1 for root joints.
+    std::vector<size_t> _depthOrder;      // parents precede children.
+    std::vector<GfMatrix4d> _restLocalXforms;
+    std::vector<GfMatrix4d> _inverseBindXforms;
+
+    // Maps each animation joint to a skeleton joint, -1 if untargeted.
+    std::vector<int> _animToSkelIndices;
+
+    std::map<UsdTimeCode, VtMatrix4dArray> _xformCache;
+};
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // USDSKEL_SKINNINGENGINE_H
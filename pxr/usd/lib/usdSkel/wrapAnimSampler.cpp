@@ -0,0 +1,82 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#include "pxr/pxr.h"
+#include "pxr/usd/usdSkel/animSampler.h"
+
+#include "pxr/base/vt/types.h"
+
+#include <boost/python/class.hpp>
+#include <boost/python/object.hpp>
+#include <boost/python/tuple.hpp>
+
+using namespace boost::python;
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+// Python callers receive copies of the decoded buffers as a
+// (translations, rotations, scales) tuple of flat float arrays, or None
+// if the frame could not be decoded.
+object
+_Sample(UsdSkelAnimSampler &self, UsdTimeCode time)
+{
+    const float *translations = NULL;
+    const float *rotations = NULL;
+    const float *scales = NULL;
+    if (!self.Sample(time, &translations, &rotations, &scales)) {
+        return object();
+    }
+
+    const size_t numJoints = self.GetNumJoints();
+    VtFloatArray translationsArray(numJoints * 3);
+    VtFloatArray rotationsArray(numJoints * 4);
+    VtFloatArray scalesArray(numJoints * 3);
+    std::copy(translations, translations + numJoints * 3,
+              translationsArray.data());
+    std::copy(rotations, rotations + numJoints * 4,
+              rotationsArray.data());
+    std::copy(scales, scales + numJoints * 3,
+              scalesArray.data());
+
+    return boost::python::make_tuple(
+        translationsArray, rotationsArray, scalesArray);
+}
+
+} // anonymous namespace
+
+void wrapUsdSkelAnimSampler()
+{
+    typedef UsdSkelAnimSampler This;
+
+    class_<This>("AnimSampler")
+        .def(init<const UsdSkelPackedJointAnimation &, size_t>(
+            (arg("anim"), arg("maxFrames")=16)))
+        .def("IsValid", &This::IsValid)
+        .def("GetNumJoints", &This::GetNumJoints)
+        .def("GetMaxFrames", &This::GetMaxFrames)
+        .def("Sample", &_Sample, arg("time"))
+        .def("Clear", &This::Clear)
+        ;
+}
@@ -0,0 +1,103 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#include "pxr/pxr.h"
+#include "pxr/usd/usdSkel/skinningEngine.h"
+
+#include <boost/python/class.hpp>
+#include <boost/python/object.hpp>
+
+using namespace boost::python;
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+object
+_ComputeSkinningTransforms(UsdSkelSkinningEngine &self, UsdTimeCode time)
+{
+    VtMatrix4dArray xforms;
+    if (!self.ComputeSkinningTransforms(time, &xforms)) {
+        return object();
+    }
+    return object(xforms);
+}
+
+object
+_SkinPoints(UsdSkelSkinningEngine &self,
+            UsdTimeCode time,
+            const GfMatrix4d &geomBindTransform,
+            const VtIntArray &jointIndices,
+            const VtFloatArray &jointWeights,
+            int numInfluencesPerPoint,
+            VtVec3fArray points)
+{
+    if (!self.SkinPoints(time, geomBindTransform, jointIndices,
+                         jointWeights, numInfluencesPerPoint, &points)) {
+        return object();
+    }
+    return object(points);
+}
+
+object
+_ComputeSkinnedPoints(const GfMatrix4d &geomBindTransform,
+                      const VtMatrix4dArray &skinningTransforms,
+                      const VtIntArray &jointIndices,
+                      const VtFloatArray &jointWeights,
+                      int numInfluencesPerPoint,
+                      VtVec3fArray points)
+{
+    if (!UsdSkelSkinningEngine::ComputeSkinnedPoints(
+            geomBindTransform, skinningTransforms, jointIndices,
+            jointWeights, numInfluencesPerPoint, &points)) {
+        return object();
+    }
+    return object(points);
+}
+
+} // anonymous namespace
+
+void wrapUsdSkelSkinningEngine()
+{
+    typedef UsdSkelSkinningEngine This;
+
+    class_<This>("SkinningEngine")
+        .def(init<const UsdSkelSkeleton &,
+                  const UsdSkelPackedJointAnimation &>(
+            (arg("skeleton"), arg("anim"))))
+        .def("IsValid", &This::IsValid)
+        .def("GetNumJoints", &This::GetNumJoints)
+        .def("ComputeSkinningTransforms", &_ComputeSkinningTransforms,
+             arg("time"))
+        .def("SkinPoints", &_SkinPoints,
+             (arg("time"), arg("geomBindTransform"), arg("jointIndices"),
+              arg("jointWeights"), arg("numInfluencesPerPoint"),
+              arg("points")))
+        .def("Clear", &This::Clear)
+        .def("ComputeSkinnedPoints", &_ComputeSkinnedPoints,
+             (arg("geomBindTransform"), arg("skinningTransforms"),
+              arg("jointIndices"), arg("jointWeights"),
+              arg("numInfluencesPerPoint"), arg("points")))
+        .staticmethod("ComputeSkinnedPoints")
+        ;
+}
@@ -26,7 +26,10 @@
 #include "pxr/pxr.h"
 #include "pxr/usd/usdUtils/dependencies.h"
 
+#include "pxr/usd/ar/resolver.h"
+#include "pxr/usd/sdf/fileFormat.h"
 #include "pxr/usd/sdf/layer.h"
+#include "pxr/usd/sdf/layerUtils.h"
 #include "pxr/usd/sdf/primSpec.h"
 #include "pxr/usd/sdf/reference.h"
 #include "pxr/usd/sdf/textReferenceParser.h"
@@ -34,8 +37,14 @@
 #include "pxr/usd/sdf/variantSetSpec.h"
 #include "pxr/usd/sdf/variantSpec.h"
 #include "pxr/usd/usd/usdaFileFormat.h"
+#include "pxr/base/tf/pyLock.h"
 #include "pxr/base/tracelite/trace.h"
+#include "pxr/base/work/loops.h"
 
+#include <tbb/concurrent_unordered_set.h>
+#include <tbb/concurrent_vector.h>
+
+#include <algorithm>
 #include <stack>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -228,6 +237,114 @@ UsdUtilsExtractExternalReferences(
     }
 }
 
+namespace {
+
+// Copies a concurrently-gathered result into the (optional) output
+// vector, sorted and uniqued so the walk's scheduling does not leak
+// into the returned order.
+static void
+_SortUniqueInto(const tbb::concurrent_vector<string>& found,
+                vector<string>* result)
+{
+    if (!result) {
+        return;
+    }
+    result->assign(found.begin(), found.end());
+    std::sort(result->begin(), result->end());
+    result->erase(std::unique(result->begin(), result->end()),
+                  result->end());
+}
+
+} // anonymous namespace
+
+void
+UsdUtilsComputeAllDependencies(
+    const string& assetPath,
+    vector<string>* layers,
+    vector<string>* assets,
+    vector<string>* unresolvedPaths)
+{
+    TRACE_FUNCTION();
+
+    // The walk spawns workers that may need the GIL when invoked from
+    // Python; see UsdUtilsStitchClipsTopology.
+    TF_PY_ALLOW_THREADS_IN_SCOPE();
+
+    tbb::concurrent_unordered_set<string> visited;
+    tbb::concurrent_vector<string> foundLayers;
+    tbb::concurrent_vector<string> foundAssets;
+    tbb::concurrent_vector<string> foundUnresolved;
+
+    vector<string> frontier(1, assetPath);
+    visited.insert(assetPath);
+
+    // Breadth-first over waves of layers: each wave's layers are opened
+    // and scanned in parallel, and feed the next wave.
+    while (!frontier.empty()) {
+        tbb::concurrent_vector<string> next;
+
+        WorkParallelForN(frontier.size(),
+            [&frontier, &visited, &next,
+             &foundLayers, &foundAssets, &foundUnresolved](
+                size_t start, size_t end)
+            {
+                for (size_t i = start; i != end; ++i) {
+                    const string& identifier = frontier[i];
+                    SdfLayerRefPtr layer = SdfLayer::FindOrOpen(identifier);
+                    if (!layer) {
+                        foundUnresolved.push_back(identifier);
+                        continue;
+                    }
+                    foundLayers.push_back(identifier);
+
+                    vector<string> sublayers, references, payloads;
+                    UsdUtilsExtractExternalReferences(
+                        layer->GetRealPath(),
+                        &sublayers, &references, &payloads);
+
+                    vector<string> raw;
+                    raw.reserve(sublayers.size() + references.size() +
+                                payloads.size());
+                    raw.insert(raw.end(), sublayers.begin(),
+                               sublayers.end());
+                    raw.insert(raw.end(), references.begin(),
+                               references.end());
+                    raw.insert(raw.end(), payloads.begin(),
+                               payloads.end());
+                    if (raw.empty()) {
+                        continue;
+                    }
+
+                    // Anchor everything this layer mentions in a single
+                    // batched resolver query.
+                    const vector<string> anchored =
+                        SdfComputeAssetPathsRelativeToLayer(layer, raw);
+
+                    for (const string& dep : anchored) {
+                        if (dep.empty() ||
+                            !visited.insert(dep).second) {
+                            continue;
+                        }
+                        if (SdfFileFormat::FindByExtension(
+                                SdfFileFormat::GetFileExtension(dep))) {
+                            next.push_back(dep);
+                        } else if (ArGetResolver().Resolve(dep).empty()) {
+                            foundUnresolved.push_back(dep);
+                        } else {
+                            foundAssets.push_back(dep);
+                        }
+                    }
+                }
+            });
+
+        frontier.assign(next.begin(), next.end());
+    }
+
+    _SortUniqueInto(foundLayers, layers);
+    _SortUniqueInto(foundAssets, assets);
+    _SortUniqueInto(foundUnresolved, unresolvedPaths);
+}
+
 
 PXR_NAMESPACE_CLOSE_SCOPE
 
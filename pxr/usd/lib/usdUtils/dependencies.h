@@ -52,6 +52,28 @@ void UsdUtilsExtractExternalReferences(
     std::vector<std::string>* references,
     std::vector<std::string>* payloads);
 
+/// Recursively computes the full set of external dependencies of the
+/// asset at \p assetPath: every layer reachable through sublayers,
+/// references and payloads, plus all non-layer assets (textures, etc.)
+/// those layers mention through asset-valued fields.
+///
+/// Discovered layer paths are returned in \p layers (including the root
+/// asset itself), non-layer asset paths in \p assets, and paths that
+/// could not be resolved in \p unresolvedPaths.  All returned paths are
+/// anchored against their referencing layer, and each output vector is
+/// sorted and unique.
+///
+/// The walk proceeds breadth-first, scanning each frontier of layers in
+/// parallel and anchoring the paths each layer yields through a single
+/// batched resolver query, so scans over high-latency file systems
+/// overlap their I/O.  Any of the output pointers may be NULL.
+USDUTILS_API
+void UsdUtilsComputeAllDependencies(
+    const std::string& assetPath,
+    std::vector<std::string>* layers,
+    std::vector<std::string>* assets,
+    std::vector<std::string>* unresolvedPaths);
+
 
 PXR_NAMESPACE_CLOSE_SCOPE
 
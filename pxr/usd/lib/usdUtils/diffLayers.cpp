@@ -0,0 +1,257 @@
+//
+// Copyright 2017 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+/// \file usdUtils/diffLayers.cpp
+#include "pxr/pxr.h"
+#include "pxr/usd/usdUtils/diffLayers.h"
+
+#include "pxr/usd/sdf/layer.h"
+#include "pxr/usd/sdf/schema.h"
+#include "pxr/base/tf/diagnostic.h"
+#include "pxr/base/tf/pyLock.h"
+#include "pxr/base/tracelite/trace.h"
+#include "pxr/base/work/loops.h"
+
+#include <tbb/concurrent_vector.h>
+
+#include <algorithm>
+#include <atomic>
+#include <set>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+using std::vector;
+
+namespace {
+
+// Collects every spec path in the layer, sorted so membership can be
+// tested by binary search.
+static vector<SdfPath>
+_GatherSpecPaths(const SdfLayerHandle& layer)
+{
+    vector<SdfPath> paths;
+    layer->Traverse(SdfPath::AbsoluteRootPath(),
+                    [&paths](const SdfPath& path) {
+                        paths.push_back(path);
+                    });
+    std::sort(paths.begin(), paths.end());
+    return paths;
+}
+
+static bool
+_Contains(const vector<SdfPath>& sortedPaths, const SdfPath& path)
+{
+    return std::binary_search(sortedPaths.begin(), sortedPaths.end(), path);
+}
+
+// Collects the differences found while comparing.  In early-out mode
+// the first difference poisons the comparison and the remaining work
+// returns immediately, so callers that only need a boolean don't pay
+// for a full scan.
+struct _DiffAccumulator {
+    explicit _DiffAccumulator(bool earlyOut_) :
+        earlyOut(earlyOut_), differs(false) { }
+
+    bool Done() const
+    {
+        return earlyOut && differs;
+    }
+
+    void Add(const SdfPath& path, const TfToken& field,
+             UsdUtilsLayerDiffEntryType entryType)
+    {
+        differs = true;
+        if (!earlyOut) {
+            entries.push_back(UsdUtilsLayerDiffEntry(path, field, entryType));
+        }
+    }
+
+    const bool earlyOut;
+    std::atomic<bool> differs;
+    tbb::concurrent_vector<UsdUtilsLayerDiffEntry> entries;
+};
+
+// Compares the time samples authored on path in the two layers,
+// value by value so a difference near the start of a long clip is
+// found without decoding the rest.
+static void
+_CompareTimeSamples(
+    const SdfLayerHandle& baseline,
+    const SdfLayerHandle& comparison,
+    const SdfPath& path,
+    _DiffAccumulator* diffs)
+{
+    const std::set<double> baselineTimes =
+        baseline->ListTimeSamplesForPath(path);
+    const std::set<double> comparisonTimes =
+        comparison->ListTimeSamplesForPath(path);
+    if (baselineTimes != comparisonTimes) {
+        diffs->Add(path, TfToken(), UsdUtilsLayerDiffTimeSamplesDiffer);
+        return;
+    }
+    for (double time : baselineTimes) {
+        if (diffs->Done()) {
+            return;
+        }
+        VtValue baselineValue, comparisonValue;
+        const bool baselineHas =
+            baseline->QueryTimeSample(path, time, &baselineValue);
+        const bool comparisonHas =
+            comparison->QueryTimeSample(path, time, &comparisonValue);
+        if (baselineHas != comparisonHas ||
+            baselineValue != comparisonValue) {
+            diffs->Add(path, TfToken(), UsdUtilsLayerDiffTimeSamplesDiffer);
+            return;
+        }
+    }
+}
+
+// Compares the spec at path, which exists in both layers.
+static void
+_CompareSpecs(
+    const SdfLayerHandle& baseline,
+    const SdfLayerHandle& comparison,
+    const SdfPath& path,
+    _DiffAccumulator* diffs)
+{
+    if (baseline->GetSpecType(path) != comparison->GetSpecType(path)) {
+        diffs->Add(path, TfToken(), UsdUtilsLayerDiffSpecTypeDiffers);
+        if (diffs->earlyOut) {
+            return;
+        }
+    }
+
+    // Compare the union of the authored fields.  Time samples are
+    // compared separately, sample by sample, so we never materialize
+    // an attribute's entire time sample map at once.
+    vector<TfToken> fields = baseline->ListFields(path);
+    const vector<TfToken> comparisonFields = comparison->ListFields(path);
+    fields.insert(fields.end(),
+                  comparisonFields.begin(), comparisonFields.end());
+    std::sort(fields.begin(), fields.end());
+    fields.erase(std::unique(fields.begin(), fields.end()), fields.end());
+
+    bool compareTimeSamples = false;
+    for (const TfToken& field : fields) {
+        if (diffs->Done()) {
+            return;
+        }
+        if (field == SdfFieldKeys->TimeSamples) {
+            compareTimeSamples = true;
+            continue;
+        }
+        if (baseline->GetField(path, field) !=
+                comparison->GetField(path, field)) {
+            diffs->Add(path, field, UsdUtilsLayerDiffFieldDiffers);
+        }
+    }
+    if (compareTimeSamples && !diffs->Done()) {
+        _CompareTimeSamples(baseline, comparison, path, diffs);
+    }
+}
+
+static bool
+_ComputeLayerDiff(
+    const SdfLayerHandle& baseline,
+    const SdfLayerHandle& comparison,
+    vector<UsdUtilsLayerDiffEntry>* entries)
+{
+    TRACE_FUNCTION();
+
+    if (!baseline || !comparison) {
+        TF_CODING_ERROR("Invalid layer");
+        return false;
+    }
+
+    // The comparison spawns workers that may need the GIL when invoked
+    // from Python; see UsdUtilsStitchClipsTopology.
+    TF_PY_ALLOW_THREADS_IN_SCOPE();
+
+    const vector<SdfPath> baselinePaths = _GatherSpecPaths(baseline);
+    const vector<SdfPath> comparisonPaths = _GatherSpecPaths(comparison);
+
+    vector<SdfPath> allPaths;
+    allPaths.reserve(baselinePaths.size() + comparisonPaths.size());
+    std::set_union(baselinePaths.begin(), baselinePaths.end(),
+                   comparisonPaths.begin(), comparisonPaths.end(),
+                   std::back_inserter(allPaths));
+
+    _DiffAccumulator diffs(/* earlyOut = */ !entries);
+
+    // Each worker takes a contiguous range of the path union; since
+    // the union is sorted, a range is roughly a subtree.
+    WorkParallelForN(allPaths.size(),
+        [&baseline, &comparison, &baselinePaths, &comparisonPaths,
+         &allPaths, &diffs](size_t start, size_t end)
+        {
+            for (size_t i = start; i != end; ++i) {
+                if (diffs.Done()) {
+                    return;
+                }
+                const SdfPath& path = allPaths[i];
+                if (!_Contains(comparisonPaths, path)) {
+                    diffs.Add(path, TfToken(),
+                              UsdUtilsLayerDiffSpecOnlyInBaseline);
+                }
+                else if (!_Contains(baselinePaths, path)) {
+                    diffs.Add(path, TfToken(),
+                              UsdUtilsLayerDiffSpecOnlyInComparison);
+                }
+                else {
+                    _CompareSpecs(baseline, comparison, path, &diffs);
+                }
+            }
+        });
+
+    if (entries) {
+        entries->assign(diffs.entries.begin(), diffs.entries.end());
+        std::sort(entries->begin(), entries->end(),
+                  [](const UsdUtilsLayerDiffEntry& lhs,
+                     const UsdUtilsLayerDiffEntry& rhs) {
+                      return lhs.path != rhs.path ?
+                          lhs.path < rhs.path : lhs.field < rhs.field;
+                  });
+    }
+    return diffs.differs;
+}
+
+} // anonymous namespace
+
+bool
+UsdUtilsLayersDiffer(
+    const SdfLayerHandle& baseline,
+    const SdfLayerHandle& comparison)
+{
+    return _ComputeLayerDiff(baseline, comparison, NULL);
+}
+
+bool
+UsdUtilsComputeLayerDiff(
+    const SdfLayerHandle& baseline,
+    const SdfLayerHandle& comparison,
+    vector<UsdUtilsLayerDiffEntry>* entries)
+{
+    return _ComputeLayerDiff(baseline, comparison, entries);
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
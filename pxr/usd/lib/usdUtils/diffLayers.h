@@ -0,0 +1,109 @@
+//
+// Copyright 2017 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef USDUTILS_DIFF_LAYERS_H_
+#define USDUTILS_DIFF_LAYERS_H_
+
+/// \file usdUtils/diffLayers.h
+///
+/// Utilities for comparing the scene description of two layers.
+
+#include "pxr/pxr.h"
+#include "pxr/usd/usdUtils/api.h"
+#include "pxr/usd/sdf/declareHandles.h"
+#include "pxr/usd/sdf/path.h"
+#include "pxr/base/tf/token.h"
+
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+SDF_DECLARE_HANDLES(SdfLayer);
+
+/// \enum UsdUtilsLayerDiffEntryType
+///
+/// The kind of difference a \c UsdUtilsLayerDiffEntry describes.
+///
+enum UsdUtilsLayerDiffEntryType {
+    /// The spec exists in the baseline layer only.
+    UsdUtilsLayerDiffSpecOnlyInBaseline,
+    /// The spec exists in the comparison layer only.
+    UsdUtilsLayerDiffSpecOnlyInComparison,
+    /// The spec exists in both layers with different spec types.
+    UsdUtilsLayerDiffSpecTypeDiffers,
+    /// A field on the spec has different values in the two layers.
+    UsdUtilsLayerDiffFieldDiffers,
+    /// The spec's time samples differ between the two layers.
+    UsdUtilsLayerDiffTimeSamplesDiffer
+};
+
+/// \class UsdUtilsLayerDiffEntry
+///
+/// A single difference found between two layers: the path of the spec
+/// it was found on, the field that differs (empty for whole-spec and
+/// time sample differences) and the kind of difference.
+///
+struct UsdUtilsLayerDiffEntry {
+    UsdUtilsLayerDiffEntry() :
+        entryType(UsdUtilsLayerDiffFieldDiffers) { }
+    UsdUtilsLayerDiffEntry(const SdfPath& path_,
+                           const TfToken& field_,
+                           UsdUtilsLayerDiffEntryType entryType_) :
+        path(path_), field(field_), entryType(entryType_) { }
+
+    SdfPath path;
+    TfToken field;
+    UsdUtilsLayerDiffEntryType entryType;
+};
+
+/// Returns \c true if the scene description in \p baseline and
+/// \p comparison differs.
+///
+/// The layers are compared spec by spec through the Sdf data API --
+/// fields, spec types and time samples -- without serializing either
+/// layer to text, so multi-gigabyte crate files can be compared in
+/// bounded memory.  Subtrees of the two layers are compared in
+/// parallel and the comparison stops at the first difference found.
+USDUTILS_API
+bool UsdUtilsLayersDiffer(
+    const SdfLayerHandle& baseline,
+    const SdfLayerHandle& comparison);
+
+/// Computes every difference between the scene description in
+/// \p baseline and \p comparison, returning them in \p entries sorted
+/// by spec path.  Returns \c true if any difference was found.
+///
+/// Like UsdUtilsLayersDiffer() this compares specs directly through
+/// the Sdf data API with parallel per-subtree comparison, but it
+/// visits every spec rather than stopping at the first difference.
+/// \p entries may be NULL, in which case this is equivalent to
+/// UsdUtilsLayersDiffer().
+USDUTILS_API
+bool UsdUtilsComputeLayerDiff(
+    const SdfLayerHandle& baseline,
+    const SdfLayerHandle& comparison,
+    std::vector<UsdUtilsLayerDiffEntry>* entries);
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif /* USDUTILS_DIFF_LAYERS_H_ */
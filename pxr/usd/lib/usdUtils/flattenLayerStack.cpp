@@ -581,6 +581,17 @@ _FlattenSpec(const PcpLayerStackRefPtr &layerStack,
     }
 }
 
+static void
+_FlattenLayerStackInto(const SdfLayerRefPtr &outputLayer,
+                       const PcpLayerStackRefPtr &layerStack)
+{
+    ArResolverContextBinder arBinder(
+        layerStack->GetIdentifier().pathResolverContext);
+    SdfChangeBlock changeBlock;
+    _FlattenFields(layerStack, outputLayer->GetPseudoRoot());
+    _FlattenSpec(layerStack, outputLayer->GetPseudoRoot());
+}
+
 SdfLayerRefPtr
 UsdUtils_FlattenLayerStack(const PcpLayerStackRefPtr &layerStack,
                            std::string tag)
@@ -591,12 +602,8 @@ UsdUtils_FlattenLayerStack(const PcpLayerStackRefPtr &layerStack,
     if (!TfStringEndsWith(tag, ".usda")) {
         tag += ".usda";
     }
-    ArResolverContextBinder arBinder(
-        layerStack->GetIdentifier().pathResolverContext);
-    SdfChangeBlock changeBlock;
     SdfLayerRefPtr outputLayer = SdfLayer::CreateAnonymous(tag);
-    _FlattenFields(layerStack, outputLayer->GetPseudoRoot());
-    _FlattenSpec(layerStack, outputLayer->GetPseudoRoot());
+    _FlattenLayerStackInto(outputLayer, layerStack);
     return outputLayer;
 }
 
@@ -607,4 +614,23 @@ UsdUtilsFlattenLayerStack(const UsdStagePtr &stage, const std::string& tag)
     return UsdUtils_FlattenLayerStack(index.GetRootNode().GetLayerStack(), tag);
 }
 
+bool
+UsdUtilsFlattenLayerStackToFile(const UsdStagePtr &stage,
+                                const std::string &filePath)
+{
+    // Author the flattened result straight into the file-backed output
+    // layer, so serialization does not require materializing a second
+    // copy of the result (e.g. through an anonymous layer and Export).
+    SdfLayerRefPtr outputLayer = SdfLayer::CreateNew(filePath);
+    if (!outputLayer) {
+        TF_RUNTIME_ERROR("Could not create output layer at '%s'",
+                         filePath.c_str());
+        return false;
+    }
+
+    PcpPrimIndex index = stage->GetPseudoRoot().GetPrimIndex();
+    _FlattenLayerStackInto(outputLayer, index.GetRootNode().GetLayerStack());
+    return outputLayer->Save();
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
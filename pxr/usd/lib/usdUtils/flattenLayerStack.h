@@ -66,6 +66,26 @@ SdfLayerRefPtr
 UsdUtilsFlattenLayerStack(const UsdStagePtr &stage,
                           const std::string& tag = std::string());
 
+/// Flatten the root layer stack of the given \p stage directly into a
+/// new layer at \p filePath, and save it.
+///
+/// The file format is chosen from the extension of \p filePath, so this
+/// can emit binary (crate) output directly.  Unlike flattening into an
+/// anonymous layer and exporting afterwards, the flattened opinions are
+/// authored straight into the file-backed output layer, so no second
+/// copy of the result is materialized for serialization.  Peak memory
+/// still includes the output layer's own data; Sdf does not currently
+/// provide an incremental writer that could bound it below that.
+///
+/// The flattening semantics are identical to UsdUtilsFlattenLayerStack().
+/// Returns true on success; on failure, raises a runtime error and
+/// returns false.
+///
+USDUTILS_API
+bool
+UsdUtilsFlattenLayerStackToFile(const UsdStagePtr &stage,
+                                const std::string &filePath);
+
 PXR_NAMESPACE_CLOSE_SCOPE
 
 #endif /* USDUTILS_FLATTEN_LAYER_STACK_H_ */
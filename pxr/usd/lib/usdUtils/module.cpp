@@ -31,6 +31,7 @@ TF_WRAP_MODULE
     TF_WRAP( Authoring );
     TF_WRAP( CoalescingDiagnosticDelegate );
     TF_WRAP( Dependencies );
+    TF_WRAP( DiffLayers );
     TF_WRAP( FlattenLayerStack );
     TF_WRAP( Introspection );
     TF_WRAP( Pipeline );
@@ -38,4 +39,5 @@ TF_WRAP_MODULE
     TF_WRAP( StageCache );
     TF_WRAP( Stitch );
     TF_WRAP( StitchClips );
+    TF_WRAP( Validator );
 }
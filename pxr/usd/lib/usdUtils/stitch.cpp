@@ -36,6 +36,9 @@
 #include "pxr/base/tf/warning.h"
 #include "pxr/base/tf/token.h"
 
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_reduce.h>
+
 #include <set>
 #include <string>
 #include <algorithm>
@@ -523,5 +526,72 @@ UsdUtilsStitchLayers(const SdfLayerHandle& strongLayer,
     _VerifyLayerIntegrity(strongLayer);
 }
 
+namespace {
+    // Reduction body for the parallel tree merge in the layer-vector
+    // overload of UsdUtilsStitchLayers. Each body accumulates its
+    // subrange of the inputs into an anonymous layer; join() folds a
+    // weaker subrange's accumulation into a stronger one.
+    // tbb::parallel_reduce only ever joins adjacent subranges in input
+    // order, so opinion strength matches what a serial fold over the
+    // vector would produce.
+    struct _StitchLayerVectorResult {
+        SdfLayerRefPtr accumulated;
+        bool ignoreTimeSamples;
+
+        explicit _StitchLayerVectorResult(bool ignoreTimeSamples)
+            : accumulated(SdfLayer::CreateAnonymous())
+            , ignoreTimeSamples(ignoreTimeSamples)
+        {
+        }
+
+        _StitchLayerVectorResult(_StitchLayerVectorResult& s, tbb::split)
+            : accumulated(SdfLayer::CreateAnonymous())
+            , ignoreTimeSamples(s.ignoreTimeSamples)
+        {
+        }
+
+        void operator()(
+            const tbb::blocked_range<
+                SdfLayerHandleVector::const_iterator>& range)
+        {
+            for (const auto& layer : range) {
+                UsdUtilsStitchLayers(accumulated, layer, ignoreTimeSamples);
+            }
+        }
+
+        void join(_StitchLayerVectorResult& rhs)
+        {
+            UsdUtilsStitchLayers(accumulated, rhs.accumulated,
+                                 ignoreTimeSamples);
+        }
+    };
+} // end anon namespace
+
+void
+UsdUtilsStitchLayers(const SdfLayerHandle& strongLayer,
+                     const SdfLayerHandleVector& weakLayers,
+                     bool ignoreTimeSamples,
+                     size_t batchSize)
+{
+    if (batchSize == 0) {
+        batchSize = 1;
+    }
+
+    // Reduce the inputs one batch at a time, folding each batch's result
+    // into the output before starting the next, so that the anonymous
+    // intermediate layers alive at any moment cover at most one batch.
+    for (size_t i = 0; i < weakLayers.size(); i += batchSize) {
+        const size_t batchEnd = std::min(i + batchSize, weakLayers.size());
+
+        _StitchLayerVectorResult result(ignoreTimeSamples);
+        tbb::blocked_range<SdfLayerHandleVector::const_iterator>
+            batchRange(weakLayers.begin() + i, weakLayers.begin() + batchEnd);
+        tbb::parallel_reduce(batchRange, result);
+
+        UsdUtilsStitchLayers(strongLayer, result.accumulated,
+                             ignoreTimeSamples);
+    }
+}
+
 PXR_NAMESPACE_CLOSE_SCOPE
 
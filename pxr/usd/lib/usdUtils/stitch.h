@@ -97,10 +97,28 @@ SDF_DECLARE_HANDLES(SdfLayer);
 /// outside of the range were provided or if a begin frame is missing to 
 /// corresponding end frame or vise-versa.
 USDUTILS_API
-void UsdUtilsStitchLayers(const SdfLayerHandle& strongLayer, 
+void UsdUtilsStitchLayers(const SdfLayerHandle& strongLayer,
                           const SdfLayerHandle& weakLayer,
                           bool ignoreTimeSamples = false);
 
+/// Stitch the data in \p weakLayers into \p strongLayer, producing the
+/// same result as calling the pairwise overload above serially for each
+/// layer in order: \p strongLayer has the strongest opinions, and
+/// earlier entries in \p weakLayers are stronger than later ones.
+///
+/// The merge is done as a parallel tree reduction -- pairs of inputs
+/// are stitched into anonymous intermediate layers concurrently and the
+/// intermediates are merged hierarchically -- which substantially
+/// shortens large per-frame consolidation jobs.  To bound the memory
+/// held by intermediate layers, the inputs are processed \p batchSize
+/// layers at a time, with each batch's result folded into
+/// \p strongLayer before the next batch begins.
+USDUTILS_API
+void UsdUtilsStitchLayers(const SdfLayerHandle& strongLayer,
+                          const SdfLayerHandleVector& weakLayers,
+                          bool ignoreTimeSamples = false,
+                          size_t batchSize = 64);
+
 /// This function will stitch all data collectable with ListInfoKeys()
 /// from the SdfLayer API. In the case of dictionaries, it will do 
 /// a dictionary style composition. In the case of flat data, 
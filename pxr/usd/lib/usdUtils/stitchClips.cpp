@@ -125,37 +125,30 @@ namespace {
             value);
     }
 
-    // Appends the collection at \p path in the rhs layer
-    // to the lhs at the same prim path. This is useful for 
-    // joining collections outside which can't subscribe to our
-    // notion of precedence in stitching.
-    template <typename C>
+    // Appends \p values to the collection at \p path in \p layer.  This
+    // is how the aggregated clip metadata, accumulated in flat vectors
+    // during parallel stitching, lands in the result layer in one
+    // authoring pass per collection.
+    template <typename C, typename T>
     void
-    _AppendCollection(const SdfLayerRefPtr& lhs, 
-                      const SdfLayerRefPtr& rhs, 
-                      const SdfPath& path, 
-                      const TfToken& key,
-                      const TfToken& clipSet)
+    _AppendValues(const SdfLayerRefPtr& layer,
+                  const SdfPath& path,
+                  const TfToken& key,
+                  const std::vector<T>& values,
+                  const TfToken& clipSet)
     {
-        const C lhsValues = _GetUnboxedValue<C>(lhs, path, key, clipSet);
-        const C rhsValues = _GetUnboxedValue<C>(rhs, path, key, clipSet);
-
-        C result;
-        result.reserve(lhsValues.size() + rhsValues.size());
-
-        for (const auto& value : lhsValues) {
-            result.push_back(value);
-        }
+        C result = _GetUnboxedValue<C>(layer, path, key, clipSet);
+        result.reserve(result.size() + values.size());
 
-        for (const auto& value : rhsValues) {
+        for (const auto& value : values) {
             result.push_back(value);
         }
 
-        _SetValue(lhs, path, key, result, clipSet);
+        _SetValue(layer, path, key, result, clipSet);
     }
 
-    // Retime a set of clipActives that have been joined together with 
-    // _MergeRootLayerMetadata.
+    // Retime a set of clipActives that have been joined together during
+    // the parallel reduction.
     void 
     _RetimeClipActive(const SdfLayerHandle& layer, 
                       const SdfPath& path,
@@ -242,31 +235,6 @@ namespace {
                   result, clipSet);
     }
 
-    // Merge to root layers metadata by joining the collections.
-    // This works differently from traditional stitching in the following way:
-    //
-    // Given layers lhs and rhs, and some property x which holds a VtVec2dArray
-    // In traditional stitching, if lhs has a valid x, we keep it. Else if
-    // rhs has a valid x, we'll take that. In this approach, we combine
-    // lhs's x and rhs's x. This is useful when we have multiple root layers
-    // created during parallel stitching.
-    void 
-    _MergeRootLayerMetadata(const SdfLayerRefPtr& lhs,
-                            const SdfLayerRefPtr& rhs,
-                            const SdfPath& clipPath,
-                            const TfToken& clipSet) 
-    {
-        _AppendCollection<_SdfAssetArray>(lhs, rhs, clipPath, 
-                                          UsdClipsAPIInfoKeys->assetPaths,
-                                          clipSet);
-        _AppendCollection<VtVec2dArray>(lhs, rhs, clipPath, 
-                                        UsdClipsAPIInfoKeys->times,
-                                        clipSet);
-        _AppendCollection<VtVec2dArray>(lhs, rhs, clipPath, 
-                                        UsdClipsAPIInfoKeys->active,
-                                        clipSet);
-    }
-
     // Add the clipPrimPath metadata at the specified \p stitchPath
     // within the \p resultLayer. The \p startTimeCode is used to determine
     void
@@ -341,79 +309,6 @@ namespace {
 
     ////////////////////////////////////////////////////////////////////////////
 
-    void
-    _StitchClipActive(const SdfLayerRefPtr& resultLayer,
-                      const SdfLayerRefPtr& clipLayer,
-                      const SdfPath& stitchPath,
-                      const TfToken& clipSet)
-    {
-        VtVec2dArray currentClipActive 
-            = _GetUnboxedValue<VtVec2dArray>(resultLayer,
-                                             stitchPath,
-                                             UsdClipsAPIInfoKeys->active,
-                                             clipSet);
-
-        // grab the number of elements in clipAssetPaths
-        // note that this code is contingent on _StitchClipAssetPath()
-        // being called first in _StitchClipMetadata()
-        const double clipIndex = static_cast<double> (
-            _GetUnboxedValue<VtArray<SdfAssetPath>>(
-                resultLayer, stitchPath, 
-                UsdClipsAPIInfoKeys->assetPaths, clipSet)
-            .size()) - 1;
-
-        if (resultLayer->GetPrimAtPath(stitchPath)) {
-            const double startTimeCode = _GetStartTimeCode(clipLayer);
-            const double endTimeCode = _GetEndTimeCode(clipLayer);
-            const double timeSpent = endTimeCode - startTimeCode;
-
-            // if it is our first clip
-            if (currentClipActive.empty()) {
-                currentClipActive.push_back(GfVec2d(startTimeCode, 
-                                                    clipIndex));
-            } else {
-                currentClipActive.push_back(GfVec2d(startTimeCode+timeSpent,
-                                                    clipIndex));
-            }
-            _SetValue(resultLayer, stitchPath, UsdClipsAPIInfoKeys->active, 
-                      currentClipActive, clipSet);
-        }
-    }
-
-    // Add the clipTime metadata at the specified \p stitchPath
-    // within the \p resultLayer. The \p startTimeCode is used to determine
-    // the current stage frame which is incremented as we add clipTimes
-    void 
-    _StitchClipTime(const SdfLayerRefPtr& resultLayer,
-                    const SdfLayerRefPtr& clipLayer,
-                    const SdfPath& stitchPath,
-                    const TfToken& clipSet)
-    {
-        VtVec2dArray currentClipTimes 
-            = _GetUnboxedValue<VtVec2dArray>(resultLayer,
-                                             stitchPath,
-                                             UsdClipsAPIInfoKeys->times,
-                                             clipSet);
-
-        if (resultLayer->GetPrimAtPath(stitchPath)) {
-            const double startTimeCode = _GetStartTimeCode(clipLayer);
-            const double endTimeCode = _GetEndTimeCode(clipLayer);
-            const double timeSpent = endTimeCode - startTimeCode;
-
-            // insert the sample pair into the cliptimes
-            currentClipTimes.push_back(GfVec2d(startTimeCode, startTimeCode));
-
-            // We need not author duplicate pairs
-            if (timeSpent != 0) {
-                currentClipTimes.push_back(GfVec2d(startTimeCode + timeSpent,
-                                           endTimeCode));
-            }
-
-            _SetValue(resultLayer, stitchPath, UsdClipsAPIInfoKeys->times, 
-                      currentClipTimes, clipSet);
-        }
-    }
-
     void
     _StitchClipsTopologySubLayerPath(const SdfLayerRefPtr& resultLayer,
                                      const std::string& topIdentifier)
@@ -429,32 +324,6 @@ namespace {
         }
     }
 
-    // Add the clipAssetPath metadata at the specified \p stitchPath
-    // within the \p resultLayer.
-    void
-    _StitchClipAssetPath(const SdfLayerRefPtr& resultLayer,
-                         const SdfLayerRefPtr& clipLayer,
-                         const SdfPath& stitchPath,
-                         const TfToken& clipSet)
-    {
-       _SdfAssetArray currentAssets 
-            = _GetUnboxedValue<_SdfAssetArray>(resultLayer,
-                                               stitchPath,
-                                               UsdClipsAPIInfoKeys->assetPaths,
-                                               clipSet);
-       
-       if (resultLayer->GetPrimAtPath(stitchPath)) {
-            std::string clipId = 
-                _GetRelativePathIfPossible(clipLayer->GetIdentifier(),
-                                           clipLayer->GetRealPath(),
-                                           resultLayer->GetRealPath());
-
-            currentAssets.push_back(SdfAssetPath(clipId));
-            _SetValue(resultLayer, stitchPath, UsdClipsAPIInfoKeys->assetPaths, 
-                      currentAssets, clipSet);
-        }
-    }
-
     // Add the clipManifestAssetPath metadata at the specified \p stitchPath
     // within the \p resultLayer.
     void
@@ -473,56 +342,7 @@ namespace {
                   SdfAssetPath(manifestAssetPath), clipSet);
     }
 
-    // Stitching can also be done on per frame data using the notion of
-    // model clips. 
-    // 
-    // Model clip stitching works by creating a set of "overs" given the
-    // specified topology file and stitchPath.
-    // 
-    // After creating the the new structure, the clip data is aggregated, this
-    // includes clipManifestAssetPath, clipActive, 
-    //          clipTimes, clipAssetPaths, clipPrimPath.
-    //
-    // For each layer, we add its layer identifier as an asset
-    // to clipAssetPaths, set its clipTimes to its frame number,
-    // retain the clipPrimPath and set clipActive to its position in the asset
-    // array(the end of the array during this operation, since the asset was just
-    // pushed on). If the layer is located at or under the same directory as
-    // the output layer, its entry in clipAssetPaths will be a relative path.
-    //
-    // \p resultLayer the layer being merged into
-    // \p clipLayer the layer we are merging clip data from
-    // \p topologyLayer the layer with a reference topology
-    // \p stitchPath the prim path in the reference topolgy we need to emulate
-    // \p startTimeCode a frame number to start at for stage frames, 
-    //    if no startTimeCode is supplied, the number will be taken from the most
-    //    recently added clip data. If there is no other clip data, its taken 
-    //    from the startTimeCode in clipLayer.
-    // 
-    //
-    // Note: The clipLayer's start and end frame values reflect the
-    // time sample values that the function will use
-    void
-    _StitchClipMetadata(const SdfLayerRefPtr& resultLayer,
-                        const SdfLayerRefPtr& clipLayer,
-                        const SdfPath& stitchPath,
-                        const double startTimeCode,
-                        const TfToken& clipSet)
-    {
-        // Create overs to match structure
-        SdfCreatePrimInLayer(resultLayer, stitchPath);
-
-        // Set the search path for this prim and its accompanying clip data
-        // note that the ordering of these operations is important, as 
-        // _StitchClipActive() and _StitchClipTime() rely on _ClipAssetPath()
-        // having been called.
-        _StitchClipPrimPath(resultLayer, stitchPath, clipSet);
-        _StitchClipAssetPath(resultLayer, clipLayer, stitchPath, clipSet);
-        _StitchClipActive(resultLayer, clipLayer, stitchPath, clipSet);
-        _StitchClipTime(resultLayer, clipLayer, stitchPath, clipSet);
-    }
-
-    // This allows one to set the start and end frame data in 
+    // This allows one to set the start and end frame data in
     // a \p resultLayer, based on model clip data contained at 
     // \p stitchPath. This function will take the minimum available 
     // startTimeCode(unless one is supplied) from inside of the clipTimes at the 
@@ -577,17 +397,27 @@ namespace {
 
 
 
+    // For each layer, we add its layer identifier as an asset
+    // to clipAssetPaths, set its clipTimes to its frame number,
+    // and set clipActive to its position in the asset array (the end of
+    // the array during this operation, since the asset was just pushed
+    // on).  The metadata collections are accumulated in flat vectors
+    // rather than re-authored into an anonymous layer per clip, so each
+    // clip's extraction is O(1) instead of re-boxing whole arrays.
+    // Joins concatenate adjacent subranges in order, which keeps the
+    // aggregated output deterministic and in clip order.
     struct _StitchLayersResult {
         SdfPath clipPath;
-        SdfLayerRefPtr topology; 
-        SdfLayerRefPtr root; 
+        SdfLayerRefPtr topology;
         TfToken clipSet;
-            
+        std::vector<SdfAssetPath> assetPaths;
+        std::vector<GfVec2d> times;
+        std::vector<GfVec2d> active;
+
         _StitchLayersResult(const SdfPath& _clipPath,
-                            const TfToken& _clipSet) 
+                            const TfToken& _clipSet)
             : clipPath(_clipPath),
-              topology(SdfLayer::CreateAnonymous()), 
-              root(SdfLayer::CreateAnonymous()),
+              topology(SdfLayer::CreateAnonymous()),
               clipSet(_clipSet)
         {
         }
@@ -604,18 +434,46 @@ namespace {
                 UsdUtilsStitchLayers(topology, layer,
                                      /*ignoreTimeSamples=*/ true);
                 if (clipPath != SdfPath::AbsoluteRootPath()) {
-                    _StitchClipMetadata(root, layer, clipPath,  
-                                        _GetStartTimeCode(layer),
-                                        clipSet);
+                    const double startTimeCode = _GetStartTimeCode(layer);
+                    const double endTimeCode = _GetEndTimeCode(layer);
+                    const double timeSpent = endTimeCode - startTimeCode;
+
+                    // The asset paths are normalized against the result
+                    // layer in a post-processing pass; see
+                    // _NormalizeClipAssetPaths.
+                    assetPaths.push_back(
+                        SdfAssetPath(layer->GetIdentifier()));
+
+                    // The clip indices are local to this subrange; they
+                    // are rewritten after the reduction by
+                    // _RetimeClipActive.
+                    const double clipIndex =
+                        static_cast<double>(assetPaths.size()) - 1;
+                    active.push_back(active.empty()
+                        ? GfVec2d(startTimeCode, clipIndex)
+                        : GfVec2d(startTimeCode + timeSpent, clipIndex));
+
+                    times.push_back(GfVec2d(startTimeCode, startTimeCode));
+                    // We need not author duplicate pairs
+                    if (timeSpent != 0) {
+                        times.push_back(GfVec2d(startTimeCode + timeSpent,
+                                                endTimeCode));
+                    }
                 }
-            } 
+            }
         }
 
         void join(_StitchLayersResult& rhs) {
             UsdUtilsStitchLayers(topology, rhs.topology,
-                                 /*ignoreTimeSamples=*/ true);  
+                                 /*ignoreTimeSamples=*/ true);
             if (clipPath != SdfPath::AbsoluteRootPath()) {
-                _MergeRootLayerMetadata(root, rhs.root, clipPath, clipSet);
+                assetPaths.insert(assetPaths.end(),
+                                  rhs.assetPaths.begin(),
+                                  rhs.assetPaths.end());
+                times.insert(times.end(),
+                             rhs.times.begin(), rhs.times.end());
+                active.insert(active.end(),
+                              rhs.active.begin(), rhs.active.end());
             }
         }
     };
@@ -655,15 +513,25 @@ namespace {
             topologyLayer, clipLayers, clipPath, clipSet);
         UsdUtilsStitchLayers(topologyLayer, result.topology, true);
 
-        // if the rootLayer has no clip-metadata authored 
+        // if the rootLayer has no clip-metadata authored
         if (!resultLayer->GetPrimAtPath(clipPath)) {
-            // we need to run traditional stitching to add the prim structure
-            UsdUtilsStitchLayers(resultLayer, result.root, true);
-        } else {
-            _MergeRootLayerMetadata(resultLayer, result.root, 
-                                    clipPath, clipSet);
+            // Create overs to match structure
+            SdfCreatePrimInLayer(resultLayer, clipPath);
+            _StitchClipPrimPath(resultLayer, clipPath, clipSet);
         }
 
+        // Land the aggregated collections in a single authoring pass
+        // per collection, appending to any pre-existing metadata.
+        _AppendValues<_SdfAssetArray>(resultLayer, clipPath,
+                                      UsdClipsAPIInfoKeys->assetPaths,
+                                      result.assetPaths, clipSet);
+        _AppendValues<VtVec2dArray>(resultLayer, clipPath,
+                                    UsdClipsAPIInfoKeys->times,
+                                    result.times, clipSet);
+        _AppendValues<VtVec2dArray>(resultLayer, clipPath,
+                                    UsdClipsAPIInfoKeys->active,
+                                    result.active, clipSet);
+
         // we need to retime in either case, because the clips
         // may be aggregated in parallel, and thus will have clipActives
         // which are out of sync with one another.
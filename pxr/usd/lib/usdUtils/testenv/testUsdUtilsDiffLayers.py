@@ -0,0 +1,87 @@
+#!/pxrpythonsubst
+#
+# Copyright 2017 Pixar
+#
+# Licensed under the Apache License, Version 2.0 (the "Apache License")
+# with the following modification; you may not use this file except in
+# compliance with the Apache License and the following modification to it:
+# Section 6. Trademarks. is deleted and replaced with:
+#
+# 6. Trademarks. This License does not grant permission to use the trade
+#    names, trademarks, service marks, or product names of the Licensor
+#    and its affiliates, except as required to comply with Section 4(c) of
+#    the License and to reproduce the content of the NOTICE file.
+#
+# You may obtain a copy of the Apache License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the Apache License with the above modification is
+# distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied. See the Apache License for the specific
+# language governing permissions and limitations under the Apache License.
+from pxr import UsdUtils, Sdf
+import unittest
+
+def _layerFromString(contents):
+    layer = Sdf.Layer.CreateAnonymous('.usda')
+    layer.ImportFromString('#usda 1.0\n' + contents)
+    return layer
+
+class TestUsdUtilsDiffLayers(unittest.TestCase):
+    def test_EqualLayers(self):
+        contents = '''
+def Sphere "Ball" {
+    double radius = 2
+    double radius.timeSamples = { 1: 1, 2: 4 }
+}
+'''
+        a = _layerFromString(contents)
+        b = _layerFromString(contents)
+        self.assertFalse(UsdUtils.LayersDiffer(a, b))
+        self.assertEqual(UsdUtils.ComputeLayerDiff(a, b), [])
+
+    def test_FieldDifference(self):
+        a = _layerFromString('def Sphere "Ball" { double radius = 2 }')
+        b = _layerFromString('def Sphere "Ball" { double radius = 3 }')
+        self.assertTrue(UsdUtils.LayersDiffer(a, b))
+        diff = UsdUtils.ComputeLayerDiff(a, b)
+        self.assertEqual(len(diff), 1)
+        self.assertEqual(diff[0].path, Sdf.Path('/Ball.radius'))
+        self.assertEqual(diff[0].field, 'default')
+        self.assertEqual(diff[0].entryType,
+                         UsdUtils.LayerDiffEntryType.FieldDiffers)
+
+    def test_SpecDifference(self):
+        a = _layerFromString('def Sphere "Ball" { }\ndef Cube "Box" { }')
+        b = _layerFromString('def Sphere "Ball" { }')
+        diff = UsdUtils.ComputeLayerDiff(a, b)
+        self.assertEqual(
+            [d for d in diff if d.path == Sdf.Path('/Box')][0].entryType,
+            UsdUtils.LayerDiffEntryType.SpecOnlyInBaseline)
+        diff = UsdUtils.ComputeLayerDiff(b, a)
+        self.assertEqual(
+            [d for d in diff if d.path == Sdf.Path('/Box')][0].entryType,
+            UsdUtils.LayerDiffEntryType.SpecOnlyInComparison)
+
+    def test_TimeSampleDifference(self):
+        a = _layerFromString('''
+def Sphere "Ball" {
+    double radius.timeSamples = { 1: 1, 2: 4 }
+}
+''')
+        b = _layerFromString('''
+def Sphere "Ball" {
+    double radius.timeSamples = { 1: 1, 2: 5 }
+}
+''')
+        self.assertTrue(UsdUtils.LayersDiffer(a, b))
+        diff = UsdUtils.ComputeLayerDiff(a, b)
+        self.assertEqual(len(diff), 1)
+        self.assertEqual(diff[0].path, Sdf.Path('/Ball.radius'))
+        self.assertEqual(diff[0].entryType,
+                         UsdUtils.LayerDiffEntryType.TimeSamplesDiffer)
+
+if __name__=="__main__":
+    unittest.main()
@@ -149,5 +149,17 @@ class TestUsdUtilsFlattenLayerStack(unittest.TestCase):
         self.assertTrue(layer.GetObjectAtPath(
             '/Sphere{vset_1=default}{vset_2=default}ChildFromNestedVariant'))
 
+    def test_FlattenToFile(self):
+        src_stage = Usd.Stage.Open('root.usda')
+        self.assertTrue(
+            UsdUtils.FlattenLayerStackToFile(src_stage, 'flattened.usda'))
+
+        # The on-disk result must match flattening into memory.
+        layer = UsdUtils.FlattenLayerStack(src_stage)
+        disk_layer = Sdf.Layer.FindOrOpen('flattened.usda')
+        self.assertTrue(disk_layer)
+        self.assertEqual(layer.ExportToString(),
+                         disk_layer.ExportToString())
+
 if __name__=="__main__":
     unittest.main()
@@ -114,6 +114,19 @@ class TestUsdUtilsStitch(unittest.TestCase):
                          [Sdf.Path('/World/fx/Letters.interface:value')],
                          'Connection on attribute has wrong target')
 
+    def test_ParallelStitchMatchesSerial(self):
+        serial = Sdf.Layer.CreateAnonymous()
+        for layer in self.layers[4:7]:
+            UsdUtils.StitchLayers(serial, layer)
+
+        # A batch size smaller than the input count exercises both the
+        # in-batch reduction and the fold across batch boundaries.
+        parallel = Sdf.Layer.CreateAnonymous()
+        UsdUtils.StitchLayers(parallel, self.layers[4:7], batchSize=2)
+
+        self.assertEqual(serial.ExportToString(), parallel.ExportToString(),
+                         'Parallel stitch differs from serial stitch')
+
 
 if __name__ == '__main__':
     unittest.main()
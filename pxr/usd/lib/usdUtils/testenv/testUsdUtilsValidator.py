@@ -0,0 +1,65 @@
+#!/pxrpythonsubst
+#
+# Copyright 2017 Pixar
+#
+# Licensed under the Apache License, Version 2.0 (the "Apache License")
+# with the following modification; you may not use this file except in
+# compliance with the Apache License and the following modification to it:
+# Section 6. Trademarks. is deleted and replaced with:
+#
+# 6. Trademarks. This License does not grant permission to use the trade
+#    names, trademarks, service marks, or product names of the Licensor
+#    and its affiliates, except as required to comply with Section 4(c) of
+#    the License and to reproduce the content of the NOTICE file.
+#
+# You may obtain a copy of the Apache License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the Apache License with the above modification is
+# distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+# KIND, either express or implied. See the Apache License for the specific
+# language governing permissions and limitations under the Apache License.
+
+from pxr import Sdf, Usd, UsdUtils
+import unittest
+
+class TestUsdUtilsValidator(unittest.TestCase):
+    def test_RuleDiscovery(self):
+        engine = UsdUtils.ValidationEngine()
+        names = engine.GetRuleNames()
+        self.assertIn('MissingDefaultPrim', names)
+        self.assertIn('UnresolvedAssetPaths', names)
+        # Rules run in a stable order.
+        self.assertEqual(names, sorted(names))
+
+    def test_ValidateStage(self):
+        stage = Usd.Stage.CreateInMemory()
+        prim = stage.DefinePrim('/World')
+        attr = prim.CreateAttribute('model:file', Sdf.ValueTypeNames.Asset)
+        attr.Set(Sdf.AssetPath('/no/such/file.usd'))
+
+        engine = UsdUtils.ValidationEngine()
+        errors = engine.Validate(stage)
+        errorRules = set(e.rule for e in errors)
+        self.assertIn('MissingDefaultPrim', errorRules)
+        self.assertIn('UnresolvedAssetPaths', errorRules)
+        for e in errors:
+            if e.rule == 'UnresolvedAssetPaths':
+                self.assertEqual(e.path, Sdf.Path('/World.model:file'))
+                self.assertTrue('/no/such/file.usd' in e.message)
+
+        # Stats cover every loaded rule and account for every error.
+        stats = engine.GetLastRuleStats()
+        self.assertEqual(sorted(s.rule for s in stats),
+                         sorted(engine.GetRuleNames()))
+        self.assertEqual(sum(s.numErrors for s in stats), len(errors))
+
+        # Fixing both problems produces a clean report.
+        stage.SetDefaultPrim(prim)
+        attr.Clear()
+        self.assertEqual(engine.Validate(stage), [])
+
+if __name__=="__main__":
+    unittest.main()
@@ -0,0 +1,324 @@
+//
+// Copyright 2017 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#include "pxr/pxr.h"
+#include "pxr/usd/usdUtils/validator.h"
+
+#include "pxr/usd/usd/attribute.h"
+#include "pxr/usd/usd/primRange.h"
+#include "pxr/usd/usd/stage.h"
+#include "pxr/usd/sdf/assetPath.h"
+#include "pxr/usd/sdf/layer.h"
+
+#include "pxr/base/plug/plugin.h"
+#include "pxr/base/plug/registry.h"
+
+#include "pxr/base/arch/timing.h"
+#include "pxr/base/tf/staticTokens.h"
+#include "pxr/base/tf/stringUtils.h"
+#include "pxr/base/vt/array.h"
+#include "pxr/base/vt/value.h"
+#include "pxr/base/work/loops.h"
+
+#include <tbb/spin_mutex.h>
+
+#include <algorithm>
+#include <atomic>
+#include <set>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+
+TF_DEFINE_PRIVATE_TOKENS(
+    _tokens,
+    ((openStage, "OpenStage"))
+    ((missingDefaultPrim, "MissingDefaultPrim"))
+    ((unresolvedAssetPaths, "UnresolvedAssetPaths"))
+);
+
+TF_REGISTRY_FUNCTION(TfType)
+{
+    TfType::Define<UsdUtilsValidationRule>();
+}
+
+UsdUtilsValidationRule::~UsdUtilsValidationRule()
+{
+}
+
+void
+UsdUtilsValidationRule::CheckStage(const UsdStageRefPtr &,
+                                   UsdUtilsValidationErrorVector *) const
+{
+}
+
+void
+UsdUtilsValidationRule::CheckPrim(const UsdPrim &,
+                                  UsdUtilsValidationErrorVector *) const
+{
+}
+
+// ------------------------------------------------------------------------
+// Built-in rules.
+
+/// Flags stages whose root layer does not name a defaultPrim; such layers
+/// cannot be referenced or payloaded without an explicit prim path.
+class UsdUtils_MissingDefaultPrimRule : public UsdUtilsValidationRule {
+public:
+    virtual TfToken GetRuleName() const override {
+        return _tokens->missingDefaultPrim;
+    }
+
+    virtual void CheckStage(const UsdStageRefPtr &stage,
+                            UsdUtilsValidationErrorVector *errors) const override {
+        if (!stage->GetDefaultPrim()) {
+            errors->emplace_back(
+                GetRuleName(), SdfPath::AbsoluteRootPath(),
+                TfStringPrintf(
+                    "Root layer @%s@ does not specify a defaultPrim, so it "
+                    "cannot be referenced without an explicit prim path.",
+                    stage->GetRootLayer()->GetIdentifier().c_str()));
+        }
+    }
+};
+USDUTILS_DEFINE_VALIDATION_RULE(UsdUtils_MissingDefaultPrimRule);
+
+/// Flags asset-valued attributes whose authored paths the resolver cannot
+/// resolve.
+class UsdUtils_UnresolvedAssetPathsRule : public UsdUtilsValidationRule {
+public:
+    virtual TfToken GetRuleName() const override {
+        return _tokens->unresolvedAssetPaths;
+    }
+
+    virtual void CheckPrim(const UsdPrim &prim,
+                           UsdUtilsValidationErrorVector *errors) const override {
+        for (const UsdAttribute &attr: prim.GetAttributes()) {
+            VtValue val;
+            if (!attr.Get(&val)) {
+                continue;
+            }
+            if (val.IsHolding<SdfAssetPath>()) {
+                _CheckAssetPath(val.UncheckedGet<SdfAssetPath>(),
+                                attr, errors);
+            } else if (val.IsHolding<VtArray<SdfAssetPath>>()) {
+                for (const SdfAssetPath &assetPath:
+                         val.UncheckedGet<VtArray<SdfAssetPath>>()) {
+                    _CheckAssetPath(assetPath, attr, errors);
+                }
+            }
+        }
+    }
+
+private:
+    void _CheckAssetPath(const SdfAssetPath &assetPath,
+                         const UsdAttribute &attr,
+                         UsdUtilsValidationErrorVector *errors) const {
+        if (!assetPath.GetAssetPath().empty() &&
+            assetPath.GetResolvedPath().empty()) {
+            errors->emplace_back(
+                GetRuleName(), attr.GetPath(),
+                TfStringPrintf("Asset path @%s@ could not be resolved.",
+                               assetPath.GetAssetPath().c_str()));
+        }
+    }
+};
+USDUTILS_DEFINE_VALIDATION_RULE(UsdUtils_UnresolvedAssetPathsRule);
+
+// ------------------------------------------------------------------------
+// Engine.
+
+struct UsdUtilsValidationEngine::_RuleEntry {
+    explicit _RuleEntry(UsdUtilsValidationRule *rule)
+        : rule(rule), name(this->rule->GetRuleName())
+        , numErrors(0), ticks(0) {}
+
+    std::unique_ptr<UsdUtilsValidationRule> rule;
+    TfToken name;
+    std::atomic<size_t> numErrors;
+    std::atomic<uint64_t> ticks;
+};
+
+UsdUtilsValidationEngine::UsdUtilsValidationEngine()
+{
+    std::set<TfType> ruleTypes;
+    PlugRegistry::GetAllDerivedTypes(
+        TfType::Find<UsdUtilsValidationRule>(), &ruleTypes);
+
+    for (const TfType &ruleType: ruleTypes) {
+        // Rules supplied by plugins need their plugin loaded before we can
+        // manufacture them.
+        if (PlugPluginPtr plugin =
+            PlugRegistry::GetInstance().GetPluginForType(ruleType)) {
+            plugin->Load();
+        }
+        UsdUtils_ValidationRuleFactoryBase *factory =
+            ruleType.GetFactory<UsdUtils_ValidationRuleFactoryBase>();
+        if (!factory) {
+            TF_CODING_ERROR("Validation rule type '%s' has no factory; "
+                            "was it registered with "
+                            "USDUTILS_DEFINE_VALIDATION_RULE?",
+                            ruleType.GetTypeName().c_str());
+            continue;
+        }
+        if (UsdUtilsValidationRule *rule = factory->New()) {
+            _rules.emplace_back(new _RuleEntry(rule));
+        }
+    }
+
+    // Run rules in a stable name-determined order so reports and stats are
+    // reproducible from run to run.
+    std::sort(_rules.begin(), _rules.end(),
+              [](const std::unique_ptr<_RuleEntry> &a,
+                 const std::unique_ptr<_RuleEntry> &b) {
+                  return a->name < b->name;
+              });
+}
+
+UsdUtilsValidationEngine::~UsdUtilsValidationEngine()
+{
+}
+
+std::vector<TfToken>
+UsdUtilsValidationEngine::GetRuleNames() const
+{
+    std::vector<TfToken> result;
+    result.reserve(_rules.size());
+    for (const auto &entry: _rules) {
+        result.push_back(entry->name);
+    }
+    return result;
+}
+
+UsdUtilsValidationErrorVector
+UsdUtilsValidationEngine::Validate(const UsdStageRefPtr &stage)
+{
+    _ResetStats();
+    UsdUtilsValidationErrorVector errors;
+    _ValidateStage(stage, &errors);
+    return errors;
+}
+
+std::vector<UsdUtilsValidationErrorVector>
+UsdUtilsValidationEngine::Validate(
+    const std::vector<std::string> &rootLayerPaths)
+{
+    _ResetStats();
+    std::vector<UsdUtilsValidationErrorVector> result(rootLayerPaths.size());
+    WorkParallelForN(
+        rootLayerPaths.size(),
+        [&](size_t begin, size_t end) {
+            for (size_t i = begin; i != end; ++i) {
+                UsdStageRefPtr stage = UsdStage::Open(rootLayerPaths[i]);
+                if (!stage) {
+                    result[i].emplace_back(
+                        _tokens->openStage, SdfPath::AbsoluteRootPath(),
+                        TfStringPrintf("Failed to open stage for @%s@.",
+                                       rootLayerPaths[i].c_str()));
+                    continue;
+                }
+                _ValidateStage(stage, &result[i]);
+            }
+        });
+    return result;
+}
+
+std::vector<UsdUtilsValidationRuleStats>
+UsdUtilsValidationEngine::GetLastRuleStats() const
+{
+    std::vector<UsdUtilsValidationRuleStats> result;
+    result.reserve(_rules.size());
+    for (const auto &entry: _rules) {
+        UsdUtilsValidationRuleStats stats;
+        stats.rule = entry->name;
+        stats.numErrors = entry->numErrors.load(std::memory_order_relaxed);
+        stats.timeSeconds = ArchTicksToNanoseconds(
+            entry->ticks.load(std::memory_order_relaxed)) / 1e9;
+        result.push_back(stats);
+    }
+    return result;
+}
+
+void
+UsdUtilsValidationEngine::_ResetStats()
+{
+    for (const auto &entry: _rules) {
+        entry->numErrors.store(0, std::memory_order_relaxed);
+        entry->ticks.store(0, std::memory_order_relaxed);
+    }
+}
+
+void
+UsdUtilsValidationEngine::_ValidateStage(const UsdStageRefPtr &stage,
+                                         UsdUtilsValidationErrorVector *errors)
+{
+    // Stage-level checks run serially.
+    for (const auto &entry: _rules) {
+        const uint64_t startTicks = ArchGetTickTime();
+        const size_t numErrorsBefore = errors->size();
+        entry->rule->CheckStage(stage, errors);
+        entry->ticks.fetch_add(ArchGetTickTime() - startTicks,
+                               std::memory_order_relaxed);
+        entry->numErrors.fetch_add(errors->size() - numErrorsBefore,
+                                   std::memory_order_relaxed);
+    }
+
+    // One shared traversal feeds every rule.  Collect the prims up front,
+    // including master subtrees, so we can go wide across them.
+    std::vector<UsdPrim> prims;
+    for (const UsdPrim &prim: stage->TraverseAll()) {
+        prims.push_back(prim);
+    }
+    for (const UsdPrim &master: stage->GetMasters()) {
+        for (const UsdPrim &prim: UsdPrimRange(master)) {
+            prims.push_back(prim);
+        }
+    }
+
+    tbb::spin_mutex errorsMutex;
+    WorkParallelForN(
+        prims.size(),
+        [&](size_t begin, size_t end) {
+            UsdUtilsValidationErrorVector localErrors;
+            for (size_t i = begin; i != end; ++i) {
+                for (const auto &entry: _rules) {
+                    const uint64_t startTicks = ArchGetTickTime();
+                    const size_t numErrorsBefore = localErrors.size();
+                    entry->rule->CheckPrim(prims[i], &localErrors);
+                    entry->ticks.fetch_add(ArchGetTickTime() - startTicks,
+                                           std::memory_order_relaxed);
+                    entry->numErrors.fetch_add(
+                        localErrors.size() - numErrorsBefore,
+                        std::memory_order_relaxed);
+                }
+            }
+            if (!localErrors.empty()) {
+                tbb::spin_mutex::scoped_lock lock(errorsMutex);
+                errors->insert(errors->end(),
+                               std::make_move_iterator(localErrors.begin()),
+                               std::make_move_iterator(localErrors.end()));
+            }
+        });
+}
+
+
+PXR_NAMESPACE_CLOSE_SCOPE
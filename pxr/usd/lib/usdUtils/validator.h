@@ -0,0 +1,203 @@
+//
+// Copyright 2017 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef USDUTILS_VALIDATOR_H
+#define USDUTILS_VALIDATOR_H
+
+/// \file usdUtils/validator.h
+///
+/// A rule-based validation engine for USD stages.  Rules plug in via TfType
+/// registration and the engine runs all of them over a single shared stage
+/// traversal, in parallel across prims, rather than each check re-traversing
+/// the stage on its own.
+
+#include "pxr/pxr.h"
+#include "pxr/usd/usdUtils/api.h"
+
+#include "pxr/usd/usd/common.h"
+#include "pxr/usd/usd/prim.h"
+#include "pxr/usd/sdf/path.h"
+
+#include "pxr/base/tf/registryManager.h"
+#include "pxr/base/tf/token.h"
+#include "pxr/base/tf/type.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+/// \struct UsdUtilsValidationError
+///
+/// A single problem reported by a validation rule.
+struct UsdUtilsValidationError {
+    UsdUtilsValidationError() = default;
+    UsdUtilsValidationError(const TfToken &rule, const SdfPath &path,
+                            const std::string &message)
+        : rule(rule), path(path), message(message) {}
+
+    /// Name of the rule that reported this error.
+    TfToken rule;
+    /// Path of the offending object, or the absolute root path for
+    /// stage-level errors.
+    SdfPath path;
+    /// Human-readable description of the problem.
+    std::string message;
+};
+
+typedef std::vector<UsdUtilsValidationError> UsdUtilsValidationErrorVector;
+
+/// \struct UsdUtilsValidationRuleStats
+///
+/// Per-rule accounting for the most recent call to
+/// UsdUtilsValidationEngine::Validate.
+struct UsdUtilsValidationRuleStats {
+    /// Name of the rule.
+    TfToken rule;
+    /// Number of errors the rule reported.
+    size_t numErrors = 0;
+    /// Total time spent inside the rule's checks, summed across all
+    /// threads that ran them.
+    double timeSeconds = 0.0;
+};
+
+/// \class UsdUtilsValidationRule
+///
+/// Base class for validation rules.  Derived classes override CheckStage
+/// and/or CheckPrim and register themselves with
+/// USDUTILS_DEFINE_VALIDATION_RULE so the engine can discover them.
+///
+/// CheckPrim is invoked concurrently from multiple threads, once per prim
+/// of the shared traversal, and must be thread-safe; any state a rule
+/// accumulates must live in the error vector it is handed, which is always
+/// safe to append to.
+class UsdUtilsValidationRule {
+public:
+    USDUTILS_API
+    virtual ~UsdUtilsValidationRule();
+
+    /// Returns the name errors from this rule are reported under.
+    virtual TfToken GetRuleName() const = 0;
+
+    /// Called once per stage, serially, before any prim checks.  The
+    /// default implementation does nothing.
+    USDUTILS_API
+    virtual void CheckStage(const UsdStageRefPtr &stage,
+                            UsdUtilsValidationErrorVector *errors) const;
+
+    /// Called once for each prim delivered by the shared traversal,
+    /// possibly concurrently with other prims.  The default implementation
+    /// does nothing.
+    USDUTILS_API
+    virtual void CheckPrim(const UsdPrim &prim,
+                           UsdUtilsValidationErrorVector *errors) const;
+};
+
+class UsdUtils_ValidationRuleFactoryBase : public TfType::FactoryBase {
+public:
+    USDUTILS_API
+    virtual UsdUtilsValidationRule *New() const = 0;
+};
+
+template <class T>
+class UsdUtils_ValidationRuleFactory : public UsdUtils_ValidationRuleFactoryBase {
+public:
+    virtual UsdUtilsValidationRule *New() const override {
+        return new T;
+    }
+};
+
+/// \def USDUTILS_DEFINE_VALIDATION_RULE
+///
+/// Performs the registrations required for the given rule class to be
+/// discovered by UsdUtilsValidationEngine.  Invoke this in the source file
+/// defining the rule:
+///
+/// \code
+/// // in .cpp file
+/// USDUTILS_DEFINE_VALIDATION_RULE(CustomRuleClass);
+/// \endcode
+#define USDUTILS_DEFINE_VALIDATION_RULE(c)                                \
+TF_REGISTRY_FUNCTION(TfType) {                                            \
+    TfType t = TfType::Define<c, TfType::Bases<UsdUtilsValidationRule>>();\
+    t.SetFactory<UsdUtils_ValidationRuleFactory<c>>();                    \
+}
+
+/// \class UsdUtilsValidationEngine
+///
+/// Runs every registered validation rule over a stage.  Stage-level checks
+/// run first, then the engine makes one traversal of the stage (including
+/// master subtrees) and feeds each prim to every rule, parallel across
+/// prims -- one pass regardless of how many rules are loaded.  The
+/// multi-asset overload additionally validates stages in parallel with one
+/// another.
+class UsdUtilsValidationEngine {
+    UsdUtilsValidationEngine(UsdUtilsValidationEngine const &) = delete;
+    UsdUtilsValidationEngine &operator=(
+        UsdUtilsValidationEngine const &) = delete;
+public:
+    /// Constructs an engine loaded with every registered rule.
+    USDUTILS_API
+    UsdUtilsValidationEngine();
+
+    USDUTILS_API
+    ~UsdUtilsValidationEngine();
+
+    /// Returns the names of the loaded rules, in the order they run.
+    USDUTILS_API
+    std::vector<TfToken> GetRuleNames() const;
+
+    /// Validates \p stage with all loaded rules and returns the errors
+    /// they reported.
+    USDUTILS_API
+    UsdUtilsValidationErrorVector Validate(const UsdStageRefPtr &stage);
+
+    /// Opens and validates each of \p rootLayerPaths, in parallel across
+    /// assets.  Element i of the result holds the errors for
+    /// rootLayerPaths[i]; a file that fails to open yields a single error
+    /// reported under the rule name 'OpenStage'.
+    USDUTILS_API
+    std::vector<UsdUtilsValidationErrorVector>
+    Validate(const std::vector<std::string> &rootLayerPaths);
+
+    /// Returns per-rule error counts and timing for the most recent call
+    /// to Validate, aggregated over all assets and threads.
+    USDUTILS_API
+    std::vector<UsdUtilsValidationRuleStats> GetLastRuleStats() const;
+
+private:
+    struct _RuleEntry;
+
+    void _ResetStats();
+    void _ValidateStage(const UsdStageRefPtr &stage,
+                        UsdUtilsValidationErrorVector *errors);
+
+private:
+    std::vector<std::unique_ptr<_RuleEntry>> _rules;
+};
+
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif /* USDUTILS_VALIDATOR_H */
@@ -46,9 +46,20 @@ _ExtractExternalReferences(
     return bp::make_tuple(subLayers, references, payloads);
 }
 
-} // anonymous namespace 
+static bp::tuple
+_ComputeAllDependencies(
+    const std::string& assetPath)
+{
+    std::vector<std::string> layers, assets, unresolvedPaths;
+    UsdUtilsComputeAllDependencies(assetPath,
+        &layers, &assets, &unresolvedPaths);
+    return bp::make_tuple(layers, assets, unresolvedPaths);
+}
+
+} // anonymous namespace
 
 void wrapDependencies()
 {
     bp::def("ExtractExternalReferences", _ExtractExternalReferences);
+    bp::def("ComputeAllDependencies", _ComputeAllDependencies);
 }
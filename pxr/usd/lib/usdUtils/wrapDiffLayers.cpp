@@ -0,0 +1,78 @@
+//
+// Copyright 2017 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#include "pxr/pxr.h"
+#include <boost/python/class.hpp>
+#include <boost/python/def.hpp>
+#include <boost/python/enum.hpp>
+#include <boost/python/list.hpp>
+
+#include "pxr/usd/usdUtils/diffLayers.h"
+#include "pxr/usd/sdf/layer.h"
+
+using namespace boost::python;
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+static list
+_ComputeLayerDiff(
+    const SdfLayerHandle& baseline,
+    const SdfLayerHandle& comparison)
+{
+    std::vector<UsdUtilsLayerDiffEntry> entries;
+    UsdUtilsComputeLayerDiff(baseline, comparison, &entries);
+    list result;
+    for (const auto& entry : entries) {
+        result.append(entry);
+    }
+    return result;
+}
+
+} // anonymous namespace
+
+void wrapDiffLayers()
+{
+    enum_<UsdUtilsLayerDiffEntryType>("LayerDiffEntryType")
+        .value("SpecOnlyInBaseline", UsdUtilsLayerDiffSpecOnlyInBaseline)
+        .value("SpecOnlyInComparison", UsdUtilsLayerDiffSpecOnlyInComparison)
+        .value("SpecTypeDiffers", UsdUtilsLayerDiffSpecTypeDiffers)
+        .value("FieldDiffers", UsdUtilsLayerDiffFieldDiffers)
+        .value("TimeSamplesDiffer", UsdUtilsLayerDiffTimeSamplesDiffer)
+        ;
+
+    class_<UsdUtilsLayerDiffEntry>("LayerDiffEntry")
+        .def_readonly("path", &UsdUtilsLayerDiffEntry::path)
+        .def_readonly("field", &UsdUtilsLayerDiffEntry::field)
+        .def_readonly("entryType", &UsdUtilsLayerDiffEntry::entryType)
+        ;
+
+    def("LayersDiffer",
+        UsdUtilsLayersDiffer,
+        (arg("baseline"), arg("comparison")));
+
+    def("ComputeLayerDiff",
+        _ComputeLayerDiff,
+        (arg("baseline"), arg("comparison")));
+}
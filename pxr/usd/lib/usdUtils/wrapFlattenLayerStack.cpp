@@ -41,4 +41,8 @@ void wrapFlattenLayerStack()
         (arg("stage"), arg("tag")=std::string()),
         boost::python::return_value_policy<
         TfPyRefPtrFactory<SdfLayerHandle> >());
+
+    def("FlattenLayerStackToFile",
+        UsdUtilsFlattenLayerStackToFile,
+        (arg("stage"), arg("filePath")));
 }
@@ -35,9 +35,20 @@ PXR_NAMESPACE_USING_DIRECTIVE
 void 
 wrapStitch()
 {
-    def("StitchLayers", UsdUtilsStitchLayers, (arg("strongLayer"), 
-                                              arg("weakLayer"),
-                                              arg("ignoreTimeSamples") = false));
+    def("StitchLayers",
+        (void (*)(const SdfLayerHandle&, const SdfLayerHandle&, bool))
+            UsdUtilsStitchLayers,
+        (arg("strongLayer"),
+         arg("weakLayer"),
+         arg("ignoreTimeSamples") = false));
+    def("StitchLayers",
+        (void (*)(const SdfLayerHandle&, const SdfLayerHandleVector&,
+                  bool, size_t))
+            UsdUtilsStitchLayers,
+        (arg("strongLayer"),
+         arg("weakLayers"),
+         arg("ignoreTimeSamples") = false,
+         arg("batchSize") = 64));
     def("StitchInfo", UsdUtilsStitchInfo, arg("strongObj"), arg("weakObj"),
                                           arg("ignoreTimeSamples") = false);
 }
@@ -0,0 +1,115 @@
+//
+// Copyright 2017 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+#include "pxr/pxr.h"
+#include "pxr/usd/usdUtils/validator.h"
+
+#include "pxr/usd/usd/stage.h"
+
+#include <boost/python/class.hpp>
+#include <boost/python/list.hpp>
+#include <boost/python/return_value_policy.hpp>
+
+#include <string>
+#include <vector>
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+using namespace boost::python;
+
+static boost::python::list
+_GetRuleNames(UsdUtilsValidationEngine const &engine)
+{
+    boost::python::list result;
+    for (const auto &name: engine.GetRuleNames()) {
+        result.append(name);
+    }
+    return result;
+}
+
+static boost::python::list
+_ValidateStage(UsdUtilsValidationEngine &engine, const UsdStageRefPtr &stage)
+{
+    boost::python::list result;
+    for (const auto &error: engine.Validate(stage)) {
+        result.append(error);
+    }
+    return result;
+}
+
+static boost::python::list
+_ValidateFiles(UsdUtilsValidationEngine &engine,
+               const std::vector<std::string> &rootLayerPaths)
+{
+    boost::python::list result;
+    for (const auto &errors: engine.Validate(rootLayerPaths)) {
+        boost::python::list fileErrors;
+        for (const auto &error: errors) {
+            fileErrors.append(error);
+        }
+        result.append(fileErrors);
+    }
+    return result;
+}
+
+static boost::python::list
+_GetLastRuleStats(UsdUtilsValidationEngine const &engine)
+{
+    boost::python::list result;
+    for (const auto &stats: engine.GetLastRuleStats()) {
+        result.append(stats);
+    }
+    return result;
+}
+
+void
+wrapValidator()
+{
+    using Error = UsdUtilsValidationError;
+    class_<Error>("ValidationError", no_init)
+        .add_property("rule",
+                      make_getter(&Error::rule,
+                                  return_value_policy<return_by_value>()))
+        .add_property("path",
+                      make_getter(&Error::path,
+                                  return_value_policy<return_by_value>()))
+        .add_property("message",
+                      make_getter(&Error::message,
+                                  return_value_policy<return_by_value>()));
+
+    using Stats = UsdUtilsValidationRuleStats;
+    class_<Stats>("ValidationRuleStats", no_init)
+        .add_property("rule",
+                      make_getter(&Stats::rule,
+                                  return_value_policy<return_by_value>()))
+        .add_property("numErrors", &Stats::numErrors)
+        .add_property("timeSeconds", &Stats::timeSeconds);
+
+    using This = UsdUtilsValidationEngine;
+    class_<This, boost::noncopyable>("ValidationEngine")
+        .def("GetRuleNames", &_GetRuleNames)
+        .def("Validate", &_ValidateStage)
+        .def("Validate", &_ValidateFiles)
+        .def("GetLastRuleStats", &_GetLastRuleStats);
+}
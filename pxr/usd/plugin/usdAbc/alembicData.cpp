@@ -33,6 +33,11 @@
 #include "pxr/base/tf/envSetting.h"
 #include "pxr/base/tf/fileUtils.h"
 
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <utility>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 
@@ -97,11 +102,82 @@ TF_DEFINE_ENV_SETTING(USD_ABC_DISABLE_INSTANCING, false,
                       "Disable instancing on masters created from Alembic.");
 TF_DEFINE_ENV_SETTING(USD_ABC_PARENT_INSTANCES, true,
                       "Make parent of instance source into master where possible.");
+TF_DEFINE_ENV_SETTING(USD_ABC_NUM_CACHED_SAMPLES, 256,
+                      "Number of decoded Alembic time samples to cache "
+                      "(0 disables the cache).");
 
 // The SdfAbstractData time samples type.
 // XXX: SdfAbstractData should typedef this.
 typedef std::set<double> UsdAbc_TimeSamples;
 
+//
+// UsdAbc_AlembicSampleCache
+//
+
+/// \class UsdAbc_AlembicSampleCache
+///
+/// A fixed-capacity LRU of decoded time samples, keyed by property path
+/// and Alembic sample index.  The reader converts a sample from the raw
+/// Alembic data on every value query; this keeps the most recently
+/// queried conversions so scrubbing over the same frames doesn't pay
+/// the conversion again.  Thread-safe.
+///
+class UsdAbc_AlembicSampleCache : boost::noncopyable {
+public:
+    typedef UsdAbc_AlembicDataReader::Index Index;
+
+    explicit UsdAbc_AlembicSampleCache(size_t capacity) :
+        _capacity(capacity), _useCounter(0) { }
+
+    /// Returns \c true and copies the cached sample for (\p path,
+    /// \p index) into \p value, refreshing its age, otherwise returns
+    /// \c false.
+    bool Find(const SdfPath& path, Index index, VtValue* value)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _Map::iterator i = _samples.find(_Key(path, index));
+        if (i == _samples.end()) {
+            return false;
+        }
+        i->second.lastUse = ++_useCounter;
+        *value = i->second.value;
+        return true;
+    }
+
+    /// Adds the sample for (\p path, \p index), evicting the least
+    /// recently used sample if the cache is full.
+    void Insert(const SdfPath& path, Index index, const VtValue& value)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _Sample& sample = _samples[_Key(path, index)];
+        sample.lastUse = ++_useCounter;
+        sample.value   = value;
+        while (_samples.size() > _capacity) {
+            _Map::iterator oldest = _samples.begin();
+            for (_Map::iterator i = _samples.begin();
+                     i != _samples.end(); ++i) {
+                if (i->second.lastUse < oldest->second.lastUse) {
+                    oldest = i;
+                }
+            }
+            _samples.erase(oldest);
+        }
+    }
+
+private:
+    typedef std::pair<SdfPath, Index> _Key;
+    struct _Sample {
+        size_t lastUse;
+        VtValue value;
+    };
+    typedef std::map<_Key, _Sample> _Map;
+
+    const size_t _capacity;
+    std::mutex _mutex;
+    size_t _useCounter;
+    _Map _samples;
+};
+
 //
 // UsdAbc_AlembicData
 //
@@ -149,6 +225,12 @@ UsdAbc_AlembicData::Open(const std::string& filePath)
 
     // Open the archive.
     if (_reader->Open(filePath)) {
+        const size_t numCachedSamples =
+            std::max(0, TfGetEnvSetting(USD_ABC_NUM_CACHED_SAMPLES));
+        if (numCachedSamples != 0) {
+            _sampleCache.reset(
+                new UsdAbc_AlembicSampleCache(numCachedSamples));
+        }
         return true;
     }
 
@@ -162,6 +244,7 @@ UsdAbc_AlembicData::Open(const std::string& filePath)
 void
 UsdAbc_AlembicData::Close()
 {
+    _sampleCache.reset();
     _reader.reset();
 }
 
@@ -354,9 +437,22 @@ UsdAbc_AlembicData::QueryTimeSample(
     SdfAbstractDataValue* value) const
 {
     UsdAbc_AlembicDataReader::Index index;
-    return _reader &&
-           _reader->ListTimeSamplesForPath(id).FindIndex(time, &index) && 
-           _reader->HasValue(id, index, value);
+    if (!_reader ||
+        !_reader->ListTimeSamplesForPath(id).FindIndex(time, &index)) {
+        return false;
+    }
+    if (_sampleCache && value) {
+        VtValue cached;
+        if (_sampleCache->Find(id.GetFullSpecPath(), index, &cached)) {
+            return value->StoreValue(cached);
+        }
+        if (_reader->HasValue(id, index, &cached)) {
+            _sampleCache->Insert(id.GetFullSpecPath(), index, cached);
+            return value->StoreValue(cached);
+        }
+        return false;
+    }
+    return _reader->HasValue(id, index, value);
 }
 
 bool
@@ -366,8 +462,20 @@ UsdAbc_AlembicData::QueryTimeSample(
     VtValue* value) const
 {
     UsdAbc_AlembicDataReader::Index index;
-    return _reader->ListTimeSamplesForPath(id).FindIndex(time, &index) && 
-           _reader->HasValue(id, index, value);
+    if (!_reader->ListTimeSamplesForPath(id).FindIndex(time, &index)) {
+        return false;
+    }
+    if (_sampleCache && value) {
+        if (_sampleCache->Find(id.GetFullSpecPath(), index, value)) {
+            return true;
+        }
+        if (_reader->HasValue(id, index, value)) {
+            _sampleCache->Insert(id.GetFullSpecPath(), index, *value);
+            return true;
+        }
+        return false;
+    }
+    return _reader->HasValue(id, index, value);
 }
 
 void
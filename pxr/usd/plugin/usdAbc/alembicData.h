@@ -114,6 +114,13 @@ protected:
 
 private:
     boost::shared_ptr<class UsdAbc_AlembicDataReader> _reader;
+
+    // A small LRU of decoded time samples.  Alembic sample conversion
+    // happens on every query so repeated queries at the same time (e.g.
+    // scrubbing back and forth) would otherwise re-convert the same
+    // sample each time.  The cache is created by Open() and destroyed
+    // by Close(); its memory tracks the recently queried samples only.
+    boost::shared_ptr<class UsdAbc_AlembicSampleCache> _sampleCache;
 };
 
 
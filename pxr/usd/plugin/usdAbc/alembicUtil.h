@@ -48,6 +48,7 @@
 #include <boost/type_traits/remove_reference.hpp>
 #include <boost/variant.hpp>
 #include <algorithm>
+#include <cstring>
 #include <iosfwd>
 #include <map>
 #include <string>
@@ -744,6 +745,60 @@ struct _ConvertPODToUsdArray<UsdType, UsdType, 1> {
     }
 };
 
+// Copy an array -- bulk copy for Usd types whose memory layout matches
+// the packed Alembic PODs exactly.  This avoids constructing each element
+// through _ConvertPODToUsd, which the compiler cannot always collapse into
+// a single copy.  Note that the quaternion types must never be handled
+// this way since Imath and Gf disagree on component order.
+template <class UsdType, class AlembicType, size_t extent>
+struct _ConvertPODToUsdArrayBulk {
+    void operator()(UsdType* dst, const void* src, size_t size)
+    {
+        static_assert(sizeof(UsdType) == extent * sizeof(AlembicType),
+                      "Usd type is not layout compatible with Alembic data");
+        memcpy(dst, src, size * sizeof(UsdType));
+    }
+};
+template <>
+struct _ConvertPODToUsdArray<GfVec2i, int32_t,   2> :
+    _ConvertPODToUsdArrayBulk<GfVec2i, int32_t,   2>{};
+template <>
+struct _ConvertPODToUsdArray<GfVec2h, GfHalf,    2> :
+    _ConvertPODToUsdArrayBulk<GfVec2h, GfHalf,    2>{};
+template <>
+struct _ConvertPODToUsdArray<GfVec2f, float32_t, 2> :
+    _ConvertPODToUsdArrayBulk<GfVec2f, float32_t, 2>{};
+template <>
+struct _ConvertPODToUsdArray<GfVec2d, float64_t, 2> :
+    _ConvertPODToUsdArrayBulk<GfVec2d, float64_t, 2>{};
+template <>
+struct _ConvertPODToUsdArray<GfVec3i, int32_t,   3> :
+    _ConvertPODToUsdArrayBulk<GfVec3i, int32_t,   3>{};
+template <>
+struct _ConvertPODToUsdArray<GfVec3h, GfHalf,    3> :
+    _ConvertPODToUsdArrayBulk<GfVec3h, GfHalf,    3>{};
+template <>
+struct _ConvertPODToUsdArray<GfVec3f, float32_t, 3> :
+    _ConvertPODToUsdArrayBulk<GfVec3f, float32_t, 3>{};
+template <>
+struct _ConvertPODToUsdArray<GfVec3d, float64_t, 3> :
+    _ConvertPODToUsdArrayBulk<GfVec3d, float64_t, 3>{};
+template <>
+struct _ConvertPODToUsdArray<GfVec4i, int32_t,   4> :
+    _ConvertPODToUsdArrayBulk<GfVec4i, int32_t,   4>{};
+template <>
+struct _ConvertPODToUsdArray<GfVec4h, GfHalf,    4> :
+    _ConvertPODToUsdArrayBulk<GfVec4h, GfHalf,    4>{};
+template <>
+struct _ConvertPODToUsdArray<GfVec4f, float32_t, 4> :
+    _ConvertPODToUsdArrayBulk<GfVec4f, float32_t, 4>{};
+template <>
+struct _ConvertPODToUsdArray<GfVec4d, float64_t, 4> :
+    _ConvertPODToUsdArrayBulk<GfVec4d, float64_t, 4>{};
+template <>
+struct _ConvertPODToUsdArray<GfMatrix4d, float64_t, 16> :
+    _ConvertPODToUsdArrayBulk<GfMatrix4d, float64_t, 16>{};
+
 //
 // POD conversion from Usd.
 //
@@ -60,6 +60,7 @@
 #include "pxr/usd/usdLux/domeLight.h"
 
 #include "pxr/base/work/loops.h"
+#include "pxr/base/work/threadLimits.h"
 
 #include "pxr/base/tf/envSetting.h"
 #include "pxr/base/tf/pyLock.h"
@@ -69,6 +70,7 @@
 
 #include <functional>
 #include <limits>
+#include <mutex>
 #include <string>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -118,6 +120,7 @@ UsdImagingDelegate::UsdImagingDelegate(
     , _visCache(GetTime(), GetRootCompensation())
     , _drawModeCache(UsdTimeCode::EarliestTime(), GetRootCompensation())
     , _displayGuides(true)
+    , _timeVaryingPrimCacheValid(false)
 {
 }
 
@@ -140,6 +143,10 @@ UsdImagingDelegate::~UsdImagingDelegate()
 
     _instancerPrimPaths.clear();
     _refineLevelMap.clear();
+    _inheritedPropertyVariability.clear();
+    _timeVaryingPrimCache.clear();
+    _timeVaryingPrimCacheValid = false;
+    _materialPrimvarsCache.clear();
     _pickablesMap.clear();
     _primInfoMap.clear();
     _usdIds.Clear();
@@ -191,18 +198,9 @@ UsdImagingDelegate::_GetModelDrawMode(UsdPrim const& prim)
 }
 
 
-UsdImagingDelegate::_AdapterSharedPtr const& 
-UsdImagingDelegate::_AdapterLookup(UsdPrim const& prim, bool ignoreInstancing)
+TfToken
+UsdImagingDelegate::_GetAdapterKey(UsdPrim const& prim, bool ignoreInstancing)
 {
-    static UsdImagingDelegate::_AdapterSharedPtr const NULL_ADAPTER;
-
-    // Future Work:
-    //  * Only enable plugins on demand.
-    //
-    //  * Implement a more robust prim typename mapping. This could be a
-    //    secondary map from TfType->token to avoid TfType locks in background
-    //    threads.
-
     TfToken adapterKey;
     if (!ignoreInstancing && prim.IsInstance()) {
         adapterKey = UsdImagingAdapterKeyTokens->instanceAdapterKey;
@@ -211,7 +209,7 @@ UsdImagingDelegate::_AdapterLookup(UsdPrim const& prim, bool ignoreInstancing)
     } else {
         adapterKey = prim.GetTypeName();
         // XXX: transitional code
-        // If we are using material networks, we want Looks to be 
+        // If we are using material networks, we want Looks to be
         // treated like Materials. When not using networks,
         // we want Shaders to be treated like HydraPbsSurface
         // for backwards compatibility.
@@ -227,6 +225,22 @@ UsdImagingDelegate::_AdapterLookup(UsdPrim const& prim, bool ignoreInstancing)
             }
         }
     }
+    return adapterKey;
+}
+
+UsdImagingDelegate::_AdapterSharedPtr const&
+UsdImagingDelegate::_AdapterLookup(UsdPrim const& prim, bool ignoreInstancing)
+{
+    static UsdImagingDelegate::_AdapterSharedPtr const NULL_ADAPTER;
+
+    // Future Work:
+    //  * Only enable plugins on demand.
+    //
+    //  * Implement a more robust prim typename mapping. This could be a
+    //    secondary map from TfType->token to avoid TfType locks in background
+    //    threads.
+
+    TfToken adapterKey = _GetAdapterKey(prim, ignoreInstancing);
 
     _AdapterMap::const_iterator it = _adapterMap.find(adapterKey);
     if (it != _adapterMap.end())
@@ -316,6 +330,14 @@ public:
         }
     }
 
+    // Invalidates the time-varying prim caches for all imaging delegates
+    // that have added tasks to this worker.
+    void InvalidateTimeVaryingPrimCaches() {
+        TF_FOR_ALL(it, _tasks) {
+            it->delegate->_timeVaryingPrimCacheValid = false;
+        }
+    }
+
     // Preps all tasks for parallel update.
     void UpdateVariabilityPrep() {
         TF_FOR_ALL(it, _tasks) {
@@ -449,6 +471,7 @@ UsdImagingIndexProxy::AddPrimInfo(SdfPath const &cachePath,
     primInfo.usdPrim         = usdPrim;
 
     _delegate->_usdIds.Insert(cachePath);
+    _delegate->_timeVaryingPrimCacheValid = false;
 }
 
 void
@@ -658,6 +681,7 @@ UsdImagingIndexProxy::_ProcessRemovals()
 
         _delegate->_primInfoMap.erase(*it);
         _delegate->_usdIds.Remove(*it);
+        _delegate->_timeVaryingPrimCacheValid = false;
     }
     _primInfoToRemove.clear();
 }
@@ -930,70 +954,143 @@ UsdImagingDelegate::_Populate(UsdImagingIndexProxy* proxy)
 
     WorkDispatcher bindingDispatcher;
 
-    // For each root that has been scheduled for repopulation
-    std::vector<std::pair<UsdPrim, _AdapterSharedPtr> > leafPaths;
+    typedef std::vector<std::pair<UsdPrim, _AdapterSharedPtr> > _LeafVector;
+
+    // The adapter map is grown lazily and isn't safe to mutate concurrently,
+    // so the traversal workers below serialize their misses on this mutex;
+    // each worker keeps its own key -> adapter cache so the mutex is only
+    // taken the first time a worker encounters a new prim type.
+    std::mutex adapterMapMutex;
+
+    // Examine a prim, scheduling it for population and material binding
+    // discovery if an adapter is found. Returns true if the traversal should
+    // not descend to the prim's children.
+    auto visitPrim = [&](UsdPrim const& prim,
+                         _AdapterMap *adapterCache,
+                         _LeafVector *leaves) -> bool {
+        if (!prim.GetPath().HasPrefix(_rootPrimPath)) {
+            TF_DEBUG(USDIMAGING_CHANGES).Msg("[Repopulate] Pruned at <%s> "
+                        "not under root prim path <%s>\n",
+                        prim.GetPath().GetText(),
+                        _rootPrimPath.GetText());
+            return true;
+        }
+        if (excludedSet.find(prim.GetPath()) != excludedSet.end()) {
+            TF_DEBUG(USDIMAGING_CHANGES).Msg("[Repopulate] Pruned at <%s> "
+                        "due to exclusion list\n",
+                        prim.GetPath().GetText());
+            return true;
+        }
+
+        _AdapterSharedPtr adapter;
+        TfToken adapterKey = _GetAdapterKey(prim);
+        _AdapterMap::const_iterator it = adapterCache->find(adapterKey);
+        if (it != adapterCache->end()) {
+            adapter = it->second;
+        } else {
+            std::lock_guard<std::mutex> lock(adapterMapMutex);
+            adapter = _AdapterLookup(prim);
+            (*adapterCache)[adapterKey] = adapter;
+        }
+
+        if (adapter) {
+            // We delay populating some parts of the scene (e.g. shaders)
+            // until they are needed by some other prim.
+            if (adapter->IsPopulatedIndirectly()) {
+                return false;
+            }
+            // Schedule the prim for population and discovery
+            // of material bindings.
+            //
+            // If we are using full networks, we will populate the
+            // binding cache that has the strategy to compute the correct
+            // bindings.
+            if (useMaterialNetworks) {
+                _PopulateMaterialNetworkBindingCache wu =
+                    { prim, &_materialNetworkBindingCache};
+                bindingDispatcher.Run(wu);
+            } else {
+                _PopulateMaterialBindingCache wu =
+                    { prim, &_materialBindingCache};
+                bindingDispatcher.Run(wu);
+            }
+
+            leaves->push_back(std::make_pair(prim, adapter));
+            if (adapter->ShouldCullChildren(prim)) {
+               TF_DEBUG(USDIMAGING_CHANGES).Msg("[Repopulate] Pruned "
+                                "children of <%s> due to adapter\n",
+                        prim.GetPath().GetText());
+               return true;
+            }
+        }
+        return false;
+    };
+
+    // Discover all renderable prims under the repopulation roots. Phase 1
+    // serially expands the roots into independent subtrees, visiting each
+    // expanded prim along the way, until there is enough work to keep the
+    // worker threads busy; phase 2 then sweeps the remaining subtrees in
+    // parallel.
+    _LeafVector leafPaths;
     leafPaths.reserve(pathsToRepopulate.size());
 
+    std::vector<UsdPrim> subtreeRoots;
     TF_FOR_ALL(rootPathIt, pathsToRepopulate) {
-        // Discover and insert all renderable prims into the worker for later
-        // execution.
         TF_DEBUG(USDIMAGING_CHANGES).Msg("[Repopulate] Root path: <%s>\n",
                             rootPathIt->GetText());
-
-        UsdPrimRange range(_GetPrim(*rootPathIt));
-        for (auto iter = range.begin(); iter != range.end(); ++iter) {
-            if (!iter->GetPath().HasPrefix(_rootPrimPath)) {
-                iter.PruneChildren();
-                TF_DEBUG(USDIMAGING_CHANGES).Msg("[Repopulate] Pruned at <%s> "
-                            "not under root prim path <%s>\n",
-                            iter->GetPath().GetText(),
-                            _rootPrimPath.GetText());
-                continue;
-            }
-            if (excludedSet.find(iter->GetPath()) != excludedSet.end()) {
-                iter.PruneChildren();
-                TF_DEBUG(USDIMAGING_CHANGES).Msg("[Repopulate] Pruned at <%s> "
-                            "due to exclusion list\n",
-                            iter->GetPath().GetText());
-                continue;
+        UsdPrim rootPrim = _GetPrim(*rootPathIt);
+        if (rootPrim) {
+            subtreeRoots.push_back(rootPrim);
+        }
+    }
+
+    const size_t expandTarget =
+        4 * std::max<size_t>(1, WorkGetConcurrencyLimit());
+    size_t cursor = 0;
+    while (cursor < subtreeRoots.size() &&
+           subtreeRoots.size() - cursor < expandTarget) {
+        UsdPrim prim = subtreeRoots[cursor++];
+        if (!visitPrim(prim, &_adapterMap, &leafPaths)) {
+            for (UsdPrim const& child :
+                     prim.GetFilteredChildren(UsdPrimDefaultPredicate)) {
+                subtreeRoots.push_back(child);
             }
-            if (_AdapterSharedPtr adapter = _AdapterLookup(*iter)) {
-                // We delay populating some parts of the scene (e.g. shaders)
-                // until they are needed by some other prim.
-                if (adapter->IsPopulatedIndirectly()) {
-                    continue;
-                }
-                // Schedule the prim for population and discovery
-                // of material bindings.
-                //
-                // If we are using full networks, we will populate the 
-                // binding cache that has the strategy to compute the correct
-                // bindings.
-                if (useMaterialNetworks) {
-                    _PopulateMaterialNetworkBindingCache wu = 
-                        { *iter, &_materialNetworkBindingCache};
-                    bindingDispatcher.Run(wu);    
-                } else {
-                    _PopulateMaterialBindingCache wu = 
-                        { *iter, &_materialBindingCache};
-                    bindingDispatcher.Run(wu);
-                }
-                
-                leafPaths.push_back(std::make_pair(*iter, adapter));
-                if (adapter->ShouldCullChildren(*iter)) {
-                   TF_DEBUG(USDIMAGING_CHANGES).Msg("[Repopulate] Pruned "
-                                    "children of <%s> due to adapter\n",
-                            iter->GetPath().GetText());
-                   iter.PruneChildren();
+        }
+    }
+
+    // Each subtree accumulates into its own buffer; the index proxy isn't
+    // safe to mutate concurrently, so the buffers are flushed serially below.
+    const size_t numSubtrees = subtreeRoots.size() - cursor;
+    std::vector<_LeafVector> subtreeLeafPaths(numSubtrees);
+    {
+        // Release the GIL to ensure that threaded work won't deadlock if
+        // it also needs the GIL.
+        TF_PY_ALLOW_THREADS_IN_SCOPE();
+        WorkParallelForN(numSubtrees,
+            [&](size_t begin, size_t end) {
+            _AdapterMap adapterCache;
+            for (size_t i = begin; i < end; ++i) {
+                UsdPrimRange range(subtreeRoots[cursor + i]);
+                for (auto iter = range.begin(); iter != range.end(); ++iter) {
+                    if (visitPrim(*iter, &adapterCache,
+                                  &subtreeLeafPaths[i])) {
+                        iter.PruneChildren();
+                    }
                 }
             }
-        }
+        });
     }
 
-    // Populate the RenderIndex while we're still discovering material bindings.
+    // Populate the RenderIndex while we're still discovering material
+    // bindings, flushing the per-subtree buffers in traversal order.
     TF_FOR_ALL(it, leafPaths) {
         it->second->Populate(it->first, proxy);
     }
+    TF_FOR_ALL(bufIt, subtreeLeafPaths) {
+        TF_FOR_ALL(it, *bufIt) {
+            it->second->Populate(it->first, proxy);
+        }
+    }
 
     // In the event that Population finishes before look binding cache 
     // population, we must block here to ensure it isn't running in the
@@ -1017,11 +1114,14 @@ UsdImagingDelegate::_ExecuteWorkForVariabilityUpdate(_Worker* worker)
         // they also need the GIL.
         TF_PY_ALLOW_THREADS_IN_SCOPE();
         WorkParallelForN(
-            worker->GetTaskCount(), 
-            std::bind(&UsdImagingDelegate::_Worker::UpdateVariability, 
+            worker->GetTaskCount(),
+            std::bind(&UsdImagingDelegate::_Worker::UpdateVariability,
                       worker, std::placeholders::_1, std::placeholders::_2));
     }
     worker->EnableValueCacheMutations();
+
+    // Variability may have changed for any of the prims in the worker.
+    worker->InvalidateTimeVaryingPrimCaches();
 }
 
 void 
@@ -1096,6 +1196,7 @@ UsdImagingDelegate::_ProcessChangesForTimeUpdate(UsdTimeCode time)
         _materialNetworkBindingCache.Clear();
         _visCache.Clear();
         _drawModeCache.Clear();
+        _materialPrimvarsCache.clear();
     }
 
     if (!_pathsToResync.empty()) {
@@ -1179,18 +1280,28 @@ UsdImagingDelegate::_ApplyTimeVaryingState()
 
     UsdImagingIndexProxy indexProxy(this, nullptr);
 
-    // Mark varying attributes as dirty and build a work queue for threads to
-    // populate caches for the new time.
-    TF_FOR_ALL(it, _primInfoMap) {
-        const SdfPath &usdPath = it->first;
-        _PrimInfo &primInfo    = it->second;
-
-        if (primInfo.timeVaryingBits != HdChangeTracker::Clean) {
-            primInfo.adapter->MarkDirty(primInfo.usdPrim,
-                                        usdPath,
-                                        primInfo.timeVaryingBits,
-                                        &indexProxy);
+    // Playback fast path: only time-varying prims have anything to mark on
+    // a time change, so iterate a packed list of them rather than the whole
+    // prim map. The list is rebuilt here whenever population or variability
+    // changes have invalidated it.
+    if (!_timeVaryingPrimCacheValid) {
+        _timeVaryingPrimCache.clear();
+        TF_FOR_ALL(it, _primInfoMap) {
+            if (it->second.timeVaryingBits != HdChangeTracker::Clean) {
+                _timeVaryingPrimCache.push_back(
+                    std::make_pair(it->first, &it->second));
+            }
         }
+        _timeVaryingPrimCacheValid = true;
+    }
+
+    // Mark varying attributes as dirty.
+    TF_FOR_ALL(it, _timeVaryingPrimCache) {
+        _PrimInfo *primInfo = it->second;
+        primInfo->adapter->MarkDirty(primInfo->usdPrim,
+                                     it->first,
+                                     primInfo->timeVaryingBits,
+                                     &indexProxy);
     }
 }
 
@@ -1298,6 +1409,19 @@ UsdImagingDelegate::_ResyncPrim(SdfPath const& rootPath,
     TF_DEBUG(USDIMAGING_CHANGES).Msg("[Resync Prim]: <%s>\n",
             rootPath.GetText());
 
+    // A resync may restructure anything below this root, so drop the
+    // recorded variability state for properties in the subtree; it will be
+    // re-learned on the next refresh.
+    SdfPathVector staleVariabilityPaths;
+    TF_FOR_ALL(it, _inheritedPropertyVariability) {
+        if (it->first.HasPrefix(rootPath)) {
+            staleVariabilityPaths.push_back(it->first);
+        }
+    }
+    TF_FOR_ALL(pathIt, staleVariabilityPaths) {
+        _inheritedPropertyVariability.erase(*pathIt);
+    }
+
     // Note: it is only appropriate to call adapter in the primInfo in the code
     // below, since we want the adapter that was registered to handle change
     // processing, which may be different from the default adapter registered
@@ -1530,6 +1654,16 @@ UsdImagingDelegate::_RefreshObject(SdfPath const& usdPath,
     // plugins (such as the PointInstancer).
     
     SdfPathVector affectedPrims;
+
+    // Whether the per-prim variability bits cached in _primInfoMap need to
+    // be recomputed for the affected prims. For most property changes the
+    // cached bits remain valid: a value tweak doesn't change whether the
+    // value is time-varying. Variability only needs re-analysis when the
+    // changed property's own variability transitions (e.g. the first time
+    // sample is authored on it), which we detect against the persistent
+    // per-property record below.
+    bool reanalyzeVariability = true;
+
     if (attrName == UsdGeomTokens->visibility
         || attrName == UsdGeomTokens->purpose
         || UsdGeomXformable::IsTransformationAffectedByAttrNamed(attrName))
@@ -1539,6 +1673,35 @@ UsdImagingDelegate::_RefreshObject(SdfPath const& usdPath,
         HdPrimGather gather;
 
         gather.Subtree(_usdIds.GetIds(), usdPrimPath, &affectedPrims);
+
+        // Walking the subtree with TrackVariability below is expensive; for
+        // interactive tweaks of an inherited attribute (e.g. dragging a
+        // group transform) the variability of every descendant is unchanged
+        // after the first edit, so skip the re-analysis when the changed
+        // property's variability state matches the recorded one.
+        UsdPrim prim = _GetPrim(usdPrimPath);
+        if (prim) {
+            if (UsdAttribute attr = prim.GetAttribute(attrName)) {
+                bool varying = attr.ValueMightBeTimeVarying();
+                _PropertyVariabilityMap::iterator it =
+                    _inheritedPropertyVariability.find(usdPath);
+                if (it != _inheritedPropertyVariability.end()) {
+                    reanalyzeVariability = (it->second != varying);
+                    it->second = varying;
+                } else {
+                    // First refresh of this property: we don't know its
+                    // prior state, so re-analyze conservatively and start
+                    // tracking it.
+                    _inheritedPropertyVariability[usdPath] = varying;
+                }
+            }
+        }
+
+        if (!reanalyzeVariability) {
+            TF_DEBUG(USDIMAGING_CHANGES).Msg("[Refresh Object]: Reusing "
+                    "cached variability below <%s> for property %s\n",
+                    usdPrimPath.GetText(), attrName.GetText());
+        }
     } else {
         // Only include non-inherited properties for prims that we are
         // explicitly tracking in the render index.
@@ -1572,11 +1735,17 @@ UsdImagingDelegate::_RefreshObject(SdfPath const& usdPath,
                                                               attrName);
 
             if (dirtyBits != HdChangeTracker::AllDirty) {
-                // Update Variability
-                adapter->TrackVariabilityPrep(primInfo->usdPrim, usdPath);
-                adapter->TrackVariability(primInfo->usdPrim,
-                                          usdPath,
-                                          &primInfo->timeVaryingBits);
+                // Update Variability. When the changed property's
+                // variability state is known not to have transitioned, the
+                // bits cached in primInfo are still valid and this (deep)
+                // re-analysis can be skipped.
+                if (reanalyzeVariability) {
+                    adapter->TrackVariabilityPrep(primInfo->usdPrim, usdPath);
+                    adapter->TrackVariability(primInfo->usdPrim,
+                                              usdPath,
+                                              &primInfo->timeVaryingBits);
+                    _timeVaryingPrimCacheValid = false;
+                }
 
                 // Propagate the dirty bits back out to the change tracker.
                 HdDirtyBits combinedBits =
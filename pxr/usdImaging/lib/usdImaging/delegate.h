@@ -543,12 +543,26 @@ private:
 
     _PrimInfoMap _primInfoMap;       // Indexed by "Cache Path"
 
+    // Packed list of the prims in _primInfoMap with non-clean time-varying
+    // bits. _ApplyTimeVaryingState uses this as a playback fast path: a time
+    // change only needs to mark these prims dirty, not walk the whole map.
+    // The _PrimInfo pointers stay valid as long as the map isn't mutated;
+    // prim insertion, removal, and variability re-analysis all invalidate
+    // the list, and it is lazily rebuilt on the next time change.
+    typedef std::vector<std::pair<SdfPath, _PrimInfo*> > _TimeVaryingPrimList;
+    _TimeVaryingPrimList _timeVaryingPrimCache;
+    bool _timeVaryingPrimCacheValid;
+
     // List of all prim Id's for sub-tree analysis
     Hd_SortedIds _usdIds;
 
+    // Compute the key used to select an adapter for a prim (typically the
+    // prim's type name, with special keys for instances and draw modes).
+    TfToken _GetAdapterKey(UsdPrim const& prim, bool ignoreInstancing = false);
+
     // Only use this method when we think no existing adapter has been
     // established. For example, during initial Population.
-    _AdapterSharedPtr const& _AdapterLookup(UsdPrim const& prim, 
+    _AdapterSharedPtr const& _AdapterLookup(UsdPrim const& prim,
                                             bool ignoreInstancing = false);
 
     // Obtain the prim tracking data for the given cache path.
@@ -568,6 +582,15 @@ private:
     typedef TfHashMap<SdfPath, int, SdfPath::Hash> _RefineLevelMap;
     _RefineLevelMap _refineLevelMap;
 
+    // Persistent record of whether an inherited property (visibility,
+    // purpose, transform) was time-varying the last time it was refreshed.
+    // A refresh only needs to re-analyze variability over the affected
+    // subtree when this state transitions; plain value tweaks leave the
+    // per-prim variability bits cached in _primInfoMap valid. Entries are
+    // invalidated by prefix when the owning subtree is resynced.
+    typedef TfHashMap<SdfPath, bool, SdfPath::Hash> _PropertyVariabilityMap;
+    _PropertyVariabilityMap _inheritedPropertyVariability;
+
     /// Cached/pre-fetched rprim data.
     UsdImagingValueCache _valueCache;
 
@@ -603,6 +626,18 @@ private:
     UsdImaging_VisCache _visCache;
     UsdImaging_DrawModeCache _drawModeCache;
 
+    // Shared cache of the primvar names each material network requires,
+    // keyed by material path. The name set is a property of the network
+    // alone and the same material is commonly bound to many gprims, so
+    // adapters populate this lazily during (parallel) UpdateForTime and
+    // share the result across prims and frames. Invalidated wholesale
+    // whenever stage changes are processed, like the inherited caches
+    // above. Adapters access it through
+    // UsdImagingPrimAdapter::_GetCachedMaterialPrimvars.
+    typedef tbb::concurrent_unordered_map<SdfPath, TfTokenVector,
+                                          SdfPath::Hash> _MaterialPrimvarsMap;
+    _MaterialPrimvarsMap _materialPrimvarsCache;
+
     // Pickability
     PickabilityMap _pickablesMap;
 
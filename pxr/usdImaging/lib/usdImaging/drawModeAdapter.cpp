@@ -40,6 +40,9 @@
 #include "pxr/usd/usdGeom/modelAPI.h"
 
 #include "pxr/base/tf/type.h"
+#include "pxr/base/work/dispatcher.h"
+
+#include <mutex>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -467,19 +470,55 @@ UsdImagingDrawModeAdapter::UpdateForTime(UsdPrim const& prim,
                 // If no textures are bound, generate the full geometry.
                 if (axes_mask == 0) { axes_mask = xAxis | yAxis | zAxis; }
 
-                // Generate UVs.
-                _GenerateTextureCoordinates(&uv, &assign, axes_mask);
-
-                // Generate geometry based on card type.
-                if (cardGeometry == UsdGeomTokens->cross) {
-                    _GenerateCardsCrossGeometry(&topology, &points, extent,
-                        axes_mask);
-                } else if (cardGeometry == UsdGeomTokens->box) {
-                    _GenerateCardsBoxGeometry(&topology, &points, extent,
-                        axes_mask);
-                } else {
-                    TF_CODING_ERROR("<%s> Unexpected card geometry mode %s",
-                        prim.GetPath().GetText(), cardGeometry.GetText());
+                _CardGeometryKey key;
+                key.cardGeometry = cardGeometry;
+                key.extents = extent;
+                key.axesMask = axes_mask;
+
+                bool cached = false;
+                {
+                    std::lock_guard<std::mutex> lock(_cardGeometryCacheMutex);
+                    _CardGeometryCache::const_iterator it =
+                        _cardGeometryCache.find(key);
+                    if (it != _cardGeometryCache.end()) {
+                        topology = it->second.topology;
+                        points = it->second.points;
+                        uv = it->second.uv;
+                        assign = it->second.assign;
+                        cached = true;
+                    }
+                }
+
+                if (!cached) {
+                    // Generate UVs.
+                    _GenerateTextureCoordinates(&uv, &assign, axes_mask);
+
+                    // Generate geometry based on card type.
+                    if (cardGeometry == UsdGeomTokens->cross) {
+                        _GenerateCardsCrossGeometry(&topology, &points, extent,
+                            axes_mask);
+                    } else if (cardGeometry == UsdGeomTokens->box) {
+                        _GenerateCardsBoxGeometry(&topology, &points, extent,
+                            axes_mask);
+                    } else {
+                        TF_CODING_ERROR("<%s> Unexpected card geometry mode %s",
+                            prim.GetPath().GetText(), cardGeometry.GetText());
+                    }
+
+                    // Share the buffers with other prims that have the same
+                    // configuration. On a race the first writer wins, which
+                    // is harmless since all writers compute the same data.
+                    if (!topology.IsEmpty()) {
+                        std::lock_guard<std::mutex> lock(
+                            _cardGeometryCacheMutex);
+                        _CardGeometry& entry = _cardGeometryCache[key];
+                        if (entry.topology.IsEmpty()) {
+                            entry.topology = topology;
+                            entry.points = points;
+                            entry.uv = uv;
+                            entry.assign = assign;
+                        }
+                    }
                 }
             }
 
@@ -528,6 +567,25 @@ UsdImagingDrawModeAdapter::ProcessPropertyChange(UsdPrim const& prim,
     return HdChangeTracker::AllDirty;
 }
 
+bool
+UsdImagingDrawModeAdapter::_CardGeometryKey::operator<(
+    _CardGeometryKey const& rhs) const
+{
+    if (cardGeometry != rhs.cardGeometry) {
+        return cardGeometry < rhs.cardGeometry;
+    }
+    if (axesMask != rhs.axesMask) {
+        return axesMask < rhs.axesMask;
+    }
+    GfVec3d const &lmin = extents.GetMin(), &lmax = extents.GetMax(),
+                  &rmin = rhs.extents.GetMin(), &rmax = rhs.extents.GetMax();
+    for (int i = 0; i < 3; ++i) {
+        if (lmin[i] != rmin[i]) { return lmin[i] < rmin[i]; }
+        if (lmax[i] != rmax[i]) { return lmax[i] < rmax[i]; }
+    }
+    return false;
+}
+
 void
 UsdImagingDrawModeAdapter::_GenerateOriginGeometry(
         VtValue *topo, VtValue *points, GfRange3d const& extents)
@@ -748,26 +806,36 @@ UsdImagingDrawModeAdapter::_GenerateCardsFromTextureGeometry(
     UsdGeomModelAPI model(prim);
     std::vector<std::pair<GfMatrix4d, int>> faces;
 
-    // Compute the face matrix/texture assignment pairs.
-    GfMatrix4d mat;
-    if (_GetMatrixFromImageMetadata(
-            model.GetModelCardTextureXPosAttr(), &mat))
-        faces.push_back(std::make_pair(mat, xPos));
-    if (_GetMatrixFromImageMetadata(
-            model.GetModelCardTextureYPosAttr(), &mat))
-        faces.push_back(std::make_pair(mat, yPos));
-    if (_GetMatrixFromImageMetadata(
-            model.GetModelCardTextureZPosAttr(), &mat))
-        faces.push_back(std::make_pair(mat, zPos));
-    if (_GetMatrixFromImageMetadata(
-            model.GetModelCardTextureXNegAttr(), &mat))
-        faces.push_back(std::make_pair(mat, xNeg));
-    if (_GetMatrixFromImageMetadata(
-            model.GetModelCardTextureYNegAttr(), &mat))
-        faces.push_back(std::make_pair(mat, yNeg));
-    if (_GetMatrixFromImageMetadata(
-            model.GetModelCardTextureZNegAttr(), &mat))
-        faces.push_back(std::make_pair(mat, zNeg));
+    // Compute the face matrix/texture assignment pairs. The worldtoscreen
+    // matrices come from image metadata, so resolving them opens each of
+    // the (up to six) card textures; issue the reads concurrently rather
+    // than stalling on each file in turn.
+    UsdAttribute textureAttrs[6] = {
+        model.GetModelCardTextureXPosAttr(),
+        model.GetModelCardTextureYPosAttr(),
+        model.GetModelCardTextureZPosAttr(),
+        model.GetModelCardTextureXNegAttr(),
+        model.GetModelCardTextureYNegAttr(),
+        model.GetModelCardTextureZNegAttr(),
+    };
+    static const int faceAssignments[6] =
+        { xPos, yPos, zPos, xNeg, yNeg, zNeg };
+    GfMatrix4d mats[6];
+    bool hasMat[6];
+
+    WorkDispatcher dispatcher;
+    for (int i = 0; i < 6; ++i) {
+        dispatcher.Run([this, &textureAttrs, &mats, &hasMat, i]() {
+            hasMat[i] = _GetMatrixFromImageMetadata(textureAttrs[i], &mats[i]);
+        });
+    }
+    dispatcher.Wait();
+
+    for (int i = 0; i < 6; ++i) {
+        if (hasMat[i]) {
+            faces.push_back(std::make_pair(mats[i], faceAssignments[i]));
+        }
+    }
 
     // Generate points, UV, and assignment primvars, plus index data.
     VtVec3fArray arr_pt = VtVec3fArray(faces.size() * 4);
@@ -905,12 +973,20 @@ UsdImagingDrawModeAdapter::_GenerateTextureCoordinates(
 std::string
 UsdImagingDrawModeAdapter::_GetSurfaceShaderSource()
 {
-    GlfGLSLFX gfx (UsdImagingPackageDrawModeShader());
-    if (!gfx.IsValid()) {
-        TF_CODING_ERROR("Couldn't load UsdImagingPackageDrawModeShader");
-        return std::string();
-    }
-    return gfx.GetSurfaceSource();
+    // The draw mode shader is a fixed package asset; every model drawn as
+    // cards uses the same source, so load and parse the glslfx file once
+    // rather than once per shader sprim.
+    static std::once_flag once;
+    static std::string source;
+    std::call_once(once, []() {
+        GlfGLSLFX gfx (UsdImagingPackageDrawModeShader());
+        if (!gfx.IsValid()) {
+            TF_CODING_ERROR("Couldn't load UsdImagingPackageDrawModeShader");
+            return;
+        }
+        source = gfx.GetSurfaceSource();
+    });
+    return source;
 }
 
 GfRange3d
@@ -29,6 +29,10 @@
 #include "pxr/usdImaging/usdImaging/primAdapter.h"
 
 #include "pxr/usd/usdGeom/xformCache.h"
+#include "pxr/base/gf/range3d.h"
+
+#include <map>
+#include <mutex>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -164,6 +168,29 @@ private:
     // Generate texture coordinates for cards "cross"/"box" mode.
     void _GenerateTextureCoordinates(VtValue* uv, VtValue* assign,
                                      uint8_t axes_mask);
+
+    // Generated cards geometry depends only on the card geometry mode, the
+    // axes mask, and the extents, so models with identical configurations
+    // (e.g. a set dressed with many copies of one asset) share one copy of
+    // the generated buffers instead of regenerating them per prim. VtValue
+    // copies are cheap (copy-on-write). Guarded by _cardGeometryCacheMutex,
+    // since UpdateForTime runs in parallel across prims.
+    struct _CardGeometryKey {
+        TfToken cardGeometry;
+        GfRange3d extents;
+        uint8_t axesMask;
+
+        bool operator<(_CardGeometryKey const& rhs) const;
+    };
+    struct _CardGeometry {
+        VtValue topology;
+        VtValue points;
+        VtValue uv;
+        VtValue assign;
+    };
+    typedef std::map<_CardGeometryKey, _CardGeometry> _CardGeometryCache;
+    _CardGeometryCache _cardGeometryCache;
+    std::mutex _cardGeometryCacheMutex;
 };
 
 
@@ -44,6 +44,8 @@
 // XXX: feels wrong
 #include "pxr/imaging/glf/ptexTexture.h"
 
+#include <algorithm>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 
@@ -203,10 +205,22 @@ UsdImagingGprimAdapter::_DiscoverPrimvars(
     // XXX: Should move this into ShaderAdapter
     if (UsdPrim const& shaderPrim = _GetPrim(shaderPath)) {
         if (UsdShadeShader s = UsdShadeShader(shaderPrim)) {
-            _DiscoverPrimvarsFromShaderNetwork(gprim, cachePath, 
-                                               s, time, valueCache);
+            // The primvar names a network requires are determined by the
+            // network alone and the same material is commonly bound to many
+            // gprims, so the network walk runs once per material and the
+            // name set is shared across prims and frames. The delegate
+            // drops the cache whenever stage changes are processed.
+            TfTokenVector primvarNames;
+            if (!_GetCachedMaterialPrimvars(shaderPath, &primvarNames)) {
+                _DiscoverPrimvarsFromShaderNetwork(s, &primvarNames);
+                _SetCachedMaterialPrimvars(shaderPath, primvarNames);
+            }
+            for (TfToken const& primvarName : primvarNames) {
+                _ComputeAndMergePrimvar(
+                    gprim, cachePath, primvarName, time, valueCache);
+            }
         } else {
-            _DiscoverPrimvarsDeprecated(gprim, cachePath, 
+            _DiscoverPrimvarsDeprecated(gprim, cachePath,
                                         shaderPrim, time, valueCache);
         }
     }
@@ -265,17 +279,13 @@ UsdImagingGprimAdapter::_ComputeAndMergePrimvar(
 
 void
 UsdImagingGprimAdapter::_DiscoverPrimvarsFromShaderNetwork(
-    UsdGeomGprim const& gprim,
-    SdfPath const& cachePath, 
     UsdShadeShader const& shader,
-    UsdTimeCode time,
-    UsdImagingValueCache* valueCache)
+    TfTokenVector* primvarNames) const
 {
     // TODO: It might be convenient to implicitly wire up PtexFaceOffset and
     // PtexFaceIndex primvars.
-    
-    TF_DEBUG(USDIMAGING_SHADERS).Msg("\t Looking for <%s> primvars at <%s>\n",
-                            gprim.GetPrim().GetPath().GetText(),
+
+    TF_DEBUG(USDIMAGING_SHADERS).Msg("\t Looking for primvars at <%s>\n",
                             shader.GetPrim().GetPath().GetText());
     for (UsdShadeInput const& input : shader.GetInputs()) {
 
@@ -285,7 +295,7 @@ UsdImagingGprimAdapter::_DiscoverPrimvarsFromShaderNetwork(
         UsdShadeConnectableAPI source;
         TfToken outputName;
         UsdShadeAttributeType sourceType;
-        if (UsdShadeConnectableAPI::GetConnectedSource(input, &source, 
+        if (UsdShadeConnectableAPI::GetConnectedSource(input, &source,
                 &outputName, &sourceType)) {
             UsdAttribute attr = UsdShadeShader(source).GetIdAttr();
             TfToken id;
@@ -299,15 +309,19 @@ UsdImagingGprimAdapter::_DiscoverPrimvarsFromShaderNetwork(
             if (id == UsdHydraTokens->HwPrimvar_1) {
                 UsdShadeShader sourceShader(source);
                 TfToken t;
-                if (UsdHydraPrimvar(sourceShader).GetVarnameAttr().Get(&t, 
+                if (UsdHydraPrimvar(sourceShader).GetVarnameAttr().Get(&t,
                                             UsdTimeCode::Default())) {
-                    _ComputeAndMergePrimvar(
-                        gprim, cachePath, t, time, valueCache);
+                    // The same primvar is often wired to several inputs;
+                    // only record it once.
+                    if (std::find(primvarNames->begin(), primvarNames->end(),
+                                  t) == primvarNames->end()) {
+                        primvarNames->push_back(t);
+                    }
                 }
             } else {
                 // Recursively look for more primvars
-                _DiscoverPrimvarsFromShaderNetwork(gprim, cachePath, 
-                    UsdShadeShader(source), time, valueCache);
+                _DiscoverPrimvarsFromShaderNetwork(
+                    UsdShadeShader(source), primvarNames);
             }
         }
     }
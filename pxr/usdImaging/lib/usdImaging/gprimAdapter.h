@@ -150,13 +150,12 @@ protected:
 
 private:
 
-    /// Discover required primvars by searching for primvar inputs connected to
-    /// the shader network.
-    void _DiscoverPrimvarsFromShaderNetwork(UsdGeomGprim const& gprim,
-                           SdfPath const& cachePath, 
-                           UsdShadeShader const& shader,
-                           UsdTimeCode time,
-                           UsdImagingValueCache* valueCache);
+    /// Discover required primvar names by searching for primvar inputs
+    /// connected to the shader network. The result is a property of the
+    /// network alone, so callers cache it per material path via
+    /// _SetCachedMaterialPrimvars.
+    void _DiscoverPrimvarsFromShaderNetwork(UsdShadeShader const& shader,
+                           TfTokenVector* primvarNames) const;
 
     // Deprecated shader discovery.
     void _DiscoverPrimvarsDeprecated(UsdGeomGprim const& gprim,
@@ -167,11 +167,28 @@ UsdImagingHydraMaterialAdapter::UpdateForTime(UsdPrim const& prim,
     }
 
     if (requestedBits & HdShader::DirtyParams) {
-        // XXX: The param list isn't actually time-varying... we should find
-        // a way to only do this once.
         HdShaderParamVector& shaderParams =
             valueCache->GetSurfaceShaderParams(cachePath);
-        shaderParams = _GetSurfaceShaderParams(prim);
+
+        // The param list comes from walking the shading network, which is
+        // invariant under time; reuse the description extracted by an
+        // earlier sync unless an authored change has invalidated it.
+        // Time-varying syncs then only re-read parameter values below.
+        bool cached = false;
+        {
+            std::lock_guard<std::mutex> lock(_shaderParamCacheMutex);
+            _ShaderParamCache::const_iterator it =
+                _shaderParamCache.find(cachePath);
+            if (it != _shaderParamCache.end()) {
+                shaderParams = it->second;
+                cached = true;
+            }
+        }
+        if (!cached) {
+            shaderParams = _GetSurfaceShaderParams(prim);
+            std::lock_guard<std::mutex> lock(_shaderParamCacheMutex);
+            _shaderParamCache[cachePath] = shaderParams;
+        }
 
         // Hydra expects values in the value cache for any param that's
         // a "fallback" param (constant, as opposed to texture- or
@@ -193,6 +210,13 @@ UsdImagingHydraMaterialAdapter::ProcessPropertyChange(UsdPrim const& prim,
                                                SdfPath const& cachePath,
                                                TfToken const& propertyName)
 {
+    // An authored change may have rewired the network; drop the cached
+    // description so the next sync re-walks the graph.
+    {
+        std::lock_guard<std::mutex> lock(_shaderParamCacheMutex);
+        _shaderParamCache.erase(cachePath);
+    }
+
     // XXX: This doesn't get notifications for dependent nodes.
     return HdChangeTracker::AllDirty;
 }
@@ -219,6 +243,10 @@ UsdImagingHydraMaterialAdapter::_RemovePrim(SdfPath const& cachePath,
     if (IsChildPath(cachePath)) {
         index->RemoveBprim(HdPrimTypeTokens->texture, cachePath);
     } else {
+        {
+            std::lock_guard<std::mutex> lock(_shaderParamCacheMutex);
+            _shaderParamCache.erase(cachePath);
+        }
         index->RemoveSprim(HdPrimTypeTokens->shader, cachePath);
     }
 }
@@ -28,6 +28,9 @@
 #include "pxr/usdImaging/usdImaging/api.h"
 #include "pxr/usdImaging/usdImaging/primAdapter.h"
 #include "pxr/imaging/hd/shaderParam.h"
+#include "pxr/base/tf/hashmap.h"
+
+#include <mutex>
 
 PXR_NAMESPACE_OPEN_SCOPE
 
@@ -123,6 +126,15 @@ private:
     VtValue _GetSurfaceShaderParamValue(UsdPrim const& prim,
                                         TfToken const& paramName,
                                         UsdTimeCode time) const;
+
+    // Extracted shader network descriptions, keyed by material cache path.
+    // The network structure only changes on authored edits, which arrive
+    // through ProcessPropertyChange or a resync; time-varying syncs reuse
+    // the cached description and only re-read parameter values.
+    typedef TfHashMap<SdfPath, HdShaderParamVector, SdfPath::Hash>
+        _ShaderParamCache;
+    _ShaderParamCache _shaderParamCache;
+    std::mutex _shaderParamCacheMutex;
 };
 
 PXR_NAMESPACE_CLOSE_SCOPE
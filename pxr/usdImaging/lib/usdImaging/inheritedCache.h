@@ -29,6 +29,7 @@
 #include "pxr/usd/usd/prim.h"
 #include "pxr/usd/usd/primRange.h"
 #include "pxr/usd/sdf/path.h"
+#include "pxr/base/arch/hints.h"
 
 #include <boost/functional/hash.hpp>
 #include <tbb/concurrent_unordered_map.h>
@@ -336,11 +337,10 @@ UsdImaging_InheritedCache<S>::_SetCacheEntryForPrim(const UsdPrim &prim,
         entry->version = _GetValidVersion();
     } else {
         while (entry->version != _GetValidVersion()) {
-            // Future work: A suggestion is that rather than literally spinning 
-            // here, we should use the pause instruction, which sleeps for one
-            // cycle while allowing hyper threads to continue. Folly has a nice
-            // implementation of this packaged up as "sleeper", which we could
-            // also implement in Work and Arch.
+            // Another thread won the race to compute this entry; emit a
+            // spin-wait hint so we don't steal pipeline resources from it
+            // (it may be a sibling hyperthread) while it stores the value.
+            ARCH_SPIN_PAUSE();
         }
     }
 }
@@ -373,7 +373,7 @@ UsdImaging_InheritedCache<S>::_GetValue(const UsdPrim& prim) const
         return &default_;
 
     _Entry* entry = _GetCacheEntryForPrim(prim);
-    if (entry->version == _GetValidVersion()) {
+    if (ARCH_LIKELY(entry->version == _GetValidVersion())) {
         // Cache hit
         return &entry->value;
     }
@@ -42,6 +42,9 @@
 #include "pxr/base/tf/staticTokens.h"
 #include "pxr/base/tf/type.h"
 
+#include "pxr/base/work/loops.h"
+
+#include <atomic>
 #include <limits>
 
 PXR_NAMESPACE_OPEN_SCOPE
@@ -646,40 +649,60 @@ UsdImagingInstanceAdapter::_CountAllInstancesToDrawImpl(
 struct UsdImagingInstanceAdapter::_ComputeInstanceTransformFn
 {
     _ComputeInstanceTransformFn(
-        UsdImagingInstanceAdapter* adapter_, const UsdTimeCode& time_) 
-        : adapter(adapter_), time(time_) 
+        UsdImagingInstanceAdapter* adapter_, const UsdTimeCode& time_)
+        : adapter(adapter_), time(time_)
     { }
 
     void Initialize(size_t numInstances)
-    { 
+    {
         result.resize(numInstances);
+        contexts.resize(numInstances);
     }
 
+    // The serial instance traversal just gathers each instance's context;
+    // the (comparatively expensive) transform resolution happens afterwards
+    // in ComputeTransforms, across worker threads.
     bool operator()(
         const std::vector<UsdPrim>& instanceContext, size_t instanceIdx)
     {
         if (!TF_VERIFY(instanceIdx < result.size())) {
             result.resize(instanceIdx + 1);
+            contexts.resize(instanceIdx + 1);
         }
 
+        contexts[instanceIdx] = instanceContext;
+        return true;
+    }
+
+    // Resolves the transforms for all gathered instance contexts in
+    // parallel. The underlying xform cache queries are thread safe; this is
+    // the same cache the parallel sync workers hit.
+    void ComputeTransforms()
+    {
         // Ignore root transform when computing each instance's transform
-        // to avoid a double transformation when applying the instancer 
+        // to avoid a double transformation when applying the instancer
         // transform.
         static const bool ignoreRootTransform = true;
 
-        GfMatrix4d xform(1.0);
-        TF_FOR_ALL(instanceIt, instanceContext) {
-            xform = xform 
-                * adapter->GetTransform(*instanceIt, time, ignoreRootTransform);
-        }
-
-        result[instanceIdx] = xform;
-        return true;
+        GfMatrix4d *resultData = result.data();
+        WorkParallelForN(contexts.size(),
+            [this, resultData](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                GfMatrix4d xform(1.0);
+                TF_FOR_ALL(instanceIt, contexts[i]) {
+                    xform = xform
+                        * adapter->GetTransform(*instanceIt, time,
+                                                ignoreRootTransform);
+                }
+                resultData[i] = xform;
+            }
+        });
     }
 
     UsdImagingInstanceAdapter* adapter;
     UsdTimeCode time;
     VtMatrix4dArray result;
+    std::vector<std::vector<UsdPrim> > contexts;
 };
 
 bool
@@ -690,6 +713,7 @@ UsdImagingInstanceAdapter::_ComputeInstanceTransform(
 {
     _ComputeInstanceTransformFn computeXform(this, time);
     _RunForAllInstancesToDraw(instancer, &computeXform);
+    computeXform.ComputeTransforms();
     outTransforms->swap(computeXform.result);
     return true;
 }
@@ -700,34 +724,56 @@ struct UsdImagingInstanceAdapter::_IsInstanceTransformVaryingFn
         : adapter(adapter_), result(false) { }
 
     void Initialize(size_t numInstances)
-    { }
+    {
+        contexts.reserve(numInstances);
+    }
 
+    // As with _ComputeInstanceTransformFn, the serial traversal only
+    // gathers instance contexts; the per-instance attribute queries run in
+    // parallel in ComputeResult.
     bool operator()(
         const std::vector<UsdPrim>& instanceContext, size_t instanceIdx)
     {
-        HdDirtyBits dirtyBits;
-        TF_FOR_ALL(primIt, instanceContext) {
-            if (adapter->_IsTransformVarying(
-                    *primIt, 
-                    HdChangeTracker::DirtyTransform,
-                    HdTokens->instancer,
-                    &dirtyBits)) {
-                result = true;
-                break;
+        contexts.push_back(instanceContext);
+        return true;
+    }
+
+    // Checks the gathered instance contexts for time-varying transforms
+    // across worker threads, with the workers bailing out (approximately)
+    // as soon as any instance is found to vary.
+    void ComputeResult()
+    {
+        std::atomic<bool> varying(false);
+        WorkParallelForN(contexts.size(),
+            [this, &varying](size_t begin, size_t end) {
+            for (size_t i = begin; i < end && !varying; ++i) {
+                HdDirtyBits dirtyBits;
+                TF_FOR_ALL(primIt, contexts[i]) {
+                    if (adapter->_IsTransformVarying(
+                            *primIt,
+                            HdChangeTracker::DirtyTransform,
+                            HdTokens->instancer,
+                            &dirtyBits)) {
+                        varying = true;
+                        break;
+                    }
+                }
             }
-        }
-        return !result;
+        });
+        result = varying;
     }
 
     UsdImagingInstanceAdapter* adapter;
+    std::vector<std::vector<UsdPrim> > contexts;
     bool result;
 };
 
-bool 
+bool
 UsdImagingInstanceAdapter::_IsInstanceTransformVarying(UsdPrim const& instancer)
 {
     _IsInstanceTransformVaryingFn isTransformVarying(this);
     _RunForAllInstancesToDraw(instancer, &isTransformVarying);
+    isTransformVarying.ComputeResult();
     return isTransformVarying.result;
 }
 
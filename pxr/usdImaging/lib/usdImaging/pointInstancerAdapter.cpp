@@ -41,7 +41,9 @@
 #include "pxr/base/tf/stringUtils.h"
 #include "pxr/base/tf/type.h"
 #include "pxr/base/gf/quath.h"
+#include "pxr/base/work/loops.h"
 
+#include <algorithm>
 #include <limits>
 #include <atomic>
 
@@ -1307,6 +1309,15 @@ UsdImagingPointInstancerAdapter::_UpdateInstanceMap(
     // grabbing the lock, but it's not thread safe.
     std::lock_guard<std::mutex> lock(instrData.mutex);
 
+    // This method is invoked once per proto rprim during the single-threaded
+    // prep pass, so for an instancer with many prototypes we'd otherwise
+    // rebuild the same index arrays many times per frame. The cached indices
+    // can never go stale: any authored change to the instancer resyncs it,
+    // which discards the instancerData entry entirely.
+    if (instrData.indicesValid && instrData.indicesTime == time) {
+        return;
+    }
+
     // Grab the instancer visiblity, if it varies over time.
     if (instrData.dirtyBits & HdChangeTracker::DirtyVisibility) {
         instrData.visible = _GetInstancerVisible(instancerPath, time);
@@ -1318,6 +1329,7 @@ UsdImagingPointInstancerAdapter::_UpdateInstanceMap(
     TF_FOR_ALL(pg, prototypes) {
         (*pg)->indices.resize(0);
     }
+    instrData.indicesValid = false;
 
     UsdAttribute indicesAttr = instancer.GetProtoIndicesAttr();
     VtIntArray indices;
@@ -1331,22 +1343,104 @@ UsdImagingPointInstancerAdapter::_UpdateInstanceMap(
     // If no value is available, mask will be ignored below.
     std::vector<bool> mask = instancer.ComputeMaskAtTime(time);
 
-    for (size_t instanceId = 0; instanceId < indices.size(); ++instanceId) {
-        size_t protoIndex = indices[instanceId];
+    size_t const numInstances = indices.size();
+    size_t const numPrototypes = prototypes.size();
+
+    // For large scatters, bucket the instance ids into per-prototype index
+    // arrays in parallel: count each prototype's instances per protoIndex
+    // chunk, prefix-sum the counts into per-chunk write offsets, then scatter.
+    // Chunks are processed in ascending order in both passes, so the
+    // resulting index arrays are identical to the serial accumulation.
+    static size_t const chunkSize = 65536;
+
+    if (numInstances < chunkSize) {
+        for (size_t instanceId = 0; instanceId < numInstances; ++instanceId) {
+            size_t protoIndex = indices[instanceId];
+
+            if (protoIndex > numPrototypes - 1) {
+                TF_WARN("Invalid index (%lu) found in <%s.%s> for time (%s)\n",
+                        protoIndex, instancer.GetPath().GetText(),
+                        indicesAttr.GetName().GetText(),
+                        TfStringify(time).c_str());
+                continue;
+            }
 
-        if (protoIndex > prototypes.size() - 1) {
-            TF_WARN("Invalid index (%lu) found in <%s.%s> for time (%s)\n",
-                    protoIndex, instancer.GetPath().GetText(), 
-                    indicesAttr.GetName().GetText(),
-                    TfStringify(time).c_str());
-            continue;
+            if (mask.size() == 0 || mask[instanceId]) {
+                prototypes[protoIndex]->indices.push_back(instanceId);
+            }
         }
+    } else {
+        size_t const numChunks = (numInstances + chunkSize - 1) / chunkSize;
+
+        std::vector<std::vector<size_t> > chunkCounts(
+            numChunks, std::vector<size_t>(numPrototypes, 0));
+
+        WorkParallelForN(numChunks, [&](size_t begin, size_t end) {
+            for (size_t chunk = begin; chunk < end; ++chunk) {
+                std::vector<size_t>& counts = chunkCounts[chunk];
+                size_t const instanceEnd = std::min(numInstances,
+                                                    (chunk + 1) * chunkSize);
+                for (size_t instanceId = chunk * chunkSize;
+                            instanceId < instanceEnd; ++instanceId) {
+                    size_t protoIndex = indices[instanceId];
+
+                    if (protoIndex > numPrototypes - 1) {
+                        TF_WARN("Invalid index (%lu) found in <%s.%s> for "
+                                "time (%s)\n",
+                                protoIndex, instancer.GetPath().GetText(),
+                                indicesAttr.GetName().GetText(),
+                                TfStringify(time).c_str());
+                        continue;
+                    }
 
-        if (mask.size() == 0 || mask[instanceId]) {
-            prototypes[protoIndex]->indices.push_back(instanceId);
+                    if (mask.size() == 0 || mask[instanceId]) {
+                        ++counts[protoIndex];
+                    }
+                }
+            }
+        });
+
+        // Turn the per-chunk counts into per-chunk write offsets and size
+        // each prototype's index array to its total.
+        std::vector<int*> protoData(numPrototypes);
+        for (size_t protoIndex = 0; protoIndex < numPrototypes; ++protoIndex) {
+            size_t total = 0;
+            for (size_t chunk = 0; chunk < numChunks; ++chunk) {
+                size_t const count = chunkCounts[chunk][protoIndex];
+                chunkCounts[chunk][protoIndex] = total;
+                total += count;
+            }
+            VtIntArray& protoIndices = prototypes[protoIndex]->indices;
+            protoIndices.resize(total);
+            protoData[protoIndex] = protoIndices.data();
         }
+
+        WorkParallelForN(numChunks, [&](size_t begin, size_t end) {
+            for (size_t chunk = begin; chunk < end; ++chunk) {
+                std::vector<size_t>& offsets = chunkCounts[chunk];
+                size_t const instanceEnd = std::min(numInstances,
+                                                    (chunk + 1) * chunkSize);
+                for (size_t instanceId = chunk * chunkSize;
+                            instanceId < instanceEnd; ++instanceId) {
+                    size_t protoIndex = indices[instanceId];
+
+                    // Invalid indices were already reported above.
+                    if (protoIndex > numPrototypes - 1) {
+                        continue;
+                    }
+
+                    if (mask.size() == 0 || mask[instanceId]) {
+                        protoData[protoIndex][offsets[protoIndex]++] =
+                            instanceId;
+                    }
+                }
+            }
+        });
     }
 
+    instrData.indicesTime = time;
+    instrData.indicesValid = true;
+
     TF_DEBUG(USDIMAGING_POINT_INSTANCER_PROTO_CREATED).Msg(
         "[Instancer Updated]: <%s>\n",
         instancerPrim.GetPath().GetText());
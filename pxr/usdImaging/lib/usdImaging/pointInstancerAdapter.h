@@ -319,13 +319,21 @@ private:
     // technically be split out to avoid two lookups, however it seems cleaner
     // to keep everything bundled up under the instancer path.
     struct _InstancerData {
-        _InstancerData() : initialized(false) {}
+        _InstancerData() : indicesValid(false), initialized(false) {}
         SdfPath parentInstancerPath;
         _ProtoRPrimMap protoRprimMap;
         _UsdToCacheMap usdToCacheMap;
         std::vector<_PrototypeSharedPtr> prototypes;
         std::mutex mutex;
         HdDirtyBits dirtyBits;
+        // The time for which the per-prototype instance indices were last
+        // rebuilt. _UpdateInstanceMap is invoked once per proto rprim during
+        // the single-threaded prep pass; when the indices are already valid
+        // for the requested time the rebuild is skipped. Any authored change
+        // to the instancer resyncs it, which discards this entry entirely,
+        // so the cached indices can never go stale.
+        UsdTimeCode indicesTime;
+        bool indicesValid;
         bool visible;
         bool initialized;
     };
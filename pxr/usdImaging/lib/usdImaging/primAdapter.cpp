@@ -267,6 +267,29 @@ UsdImagingPrimAdapter::_MergePrimvar(
         *it = primvar;
 }
 
+bool
+UsdImagingPrimAdapter::_GetCachedMaterialPrimvars(
+                    SdfPath const& materialPath,
+                    TfTokenVector* primvarNames) const
+{
+    UsdImagingDelegate::_MaterialPrimvarsMap::const_iterator it =
+        _delegate->_materialPrimvarsCache.find(materialPath);
+    if (it == _delegate->_materialPrimvarsCache.end()) {
+        return false;
+    }
+    *primvarNames = it->second;
+    return true;
+}
+
+void
+UsdImagingPrimAdapter::_SetCachedMaterialPrimvars(
+                    SdfPath const& materialPath,
+                    TfTokenVector const& primvarNames)
+{
+    _delegate->_materialPrimvarsCache.insert(
+        std::make_pair(materialPath, primvarNames));
+}
+
 bool 
 UsdImagingPrimAdapter::_IsVarying(UsdPrim prim,
                                   TfToken const& attrName, 
@@ -337,9 +337,24 @@ protected:
                              TfToken const& perfToken,
                              HdDirtyBits* dirtyFlags);
 
-    void _MergePrimvar(UsdImagingValueCache::PrimvarInfo const& primvar, 
+    void _MergePrimvar(UsdImagingValueCache::PrimvarInfo const& primvar,
                        PrimvarInfoVector* vec);
 
+    // Looks up the cached set of primvar names required by the material
+    // network rooted at \p materialPath, filling \p primvarNames and
+    // returning true on a hit. The cache is shared across adapters and
+    // invalidated by the delegate whenever stage changes are processed, so
+    // entries never go stale. Safe to call concurrently.
+    bool _GetCachedMaterialPrimvars(SdfPath const& materialPath,
+                                    TfTokenVector* primvarNames) const;
+
+    // Records the set of primvar names required by the material network
+    // rooted at \p materialPath. Safe to call concurrently; on a race the
+    // first writer wins, which is harmless since all writers compute the
+    // same name set.
+    void _SetCachedMaterialPrimvars(SdfPath const& materialPath,
+                                    TfTokenVector const& primvarNames);
+
     virtual void _RemovePrim(SdfPath const& cachePath,
                              UsdImagingIndexProxy* index) = 0;
 
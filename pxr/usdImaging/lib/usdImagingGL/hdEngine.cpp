@@ -85,7 +85,48 @@ UsdImagingGLHdEngine::UsdImagingGLHdEngine(
     }
 }
 
-UsdImagingGLHdEngine::~UsdImagingGLHdEngine() 
+UsdImagingGLHdEngine::UsdImagingGLHdEngine(
+        UsdImagingGLHdEngineSharedPtr const& shareSource)
+    : UsdImagingGLEngine()
+    , _renderIndex(nullptr)
+    , _selTracker(new HdxSelectionTracker)
+    , _delegateID(shareSource ? shareSource->_delegateID
+                              : SdfPath::AbsoluteRootPath())
+    , _delegate(nullptr)
+    , _renderPlugin(nullptr)
+    , _taskController(nullptr)
+    , _lastViewMatrix(0.0)
+    , _lastViewport(0.0)
+    , _lastRefineLevel(0)
+    , _selectionColor(1.0f, 1.0f, 0.0f, 1.0f)
+    , _rootPath(shareSource ? shareSource->_rootPath
+                            : SdfPath::AbsoluteRootPath())
+    , _excludedPrimPaths(shareSource ? shareSource->_excludedPrimPaths
+                                     : SdfPathVector())
+    , _invisedPrimPaths(shareSource ? shareSource->_invisedPrimPaths
+                                    : SdfPathVector())
+    , _isPopulated(false)
+    , _shareSource(shareSource)
+    , _renderTags()
+{
+    if (!TF_VERIFY(_shareSource, "Null share source engine")) {
+        return;
+    }
+
+    // Borrow the scene data from the source engine; syncing it once per
+    // frame serves every view. Only the task controller (camera, viewport,
+    // lighting, render tasks) is per-view.
+    _renderIndex = _shareSource->_renderIndex;
+    _delegate = _shareSource->_delegate;
+    _renderPlugin = _shareSource->_renderPlugin;
+
+    _taskController = new HdxTaskController(_renderIndex,
+        _delegateID.AppendChild(TfToken(TfStringPrintf(
+            "_UsdImaging_Shared_%p", this))));
+    _taskController->SetSelectionColor(_selectionColor);
+}
+
+UsdImagingGLHdEngine::~UsdImagingGLHdEngine()
 {
     _DeleteHydraResources();
 }
@@ -96,6 +137,16 @@ UsdImagingGLHdEngine::GetRenderIndex() const
     return _renderIndex;
 }
 
+UsdImagingGLHdEngine *
+UsdImagingGLHdEngine::_GetSceneOwner()
+{
+    UsdImagingGLHdEngine *owner = this;
+    while (owner->_shareSource) {
+        owner = owner->_shareSource.get();
+    }
+    return owner;
+}
+
 void
 UsdImagingGLHdEngine::InvalidateBuffers()
 {
@@ -193,11 +244,14 @@ UsdImagingGLHdEngine::PrepareBatch(const UsdPrim& root, RenderParams params)
     HD_TRACE_FUNCTION();
 
     if (_CanPrepareBatch(root, params)) {
-        if (!_isPopulated) {
+        // Population state lives with the engine that owns the delegate, so
+        // that engines sharing one delegate don't repopulate it per view.
+        UsdImagingGLHdEngine *owner = _GetSceneOwner();
+        if (!owner->_isPopulated) {
             _delegate->Populate(root.GetStage()->GetPrimAtPath(_rootPath),
                                _excludedPrimPaths);
             _delegate->SetInvisedPrimPaths(_invisedPrimPaths);
-            _isPopulated = true;
+            owner->_isPopulated = true;
         }
 
         _PreSetTime(root, params);
@@ -312,7 +366,8 @@ UsdImagingGLHdEngine::_Populate(const UsdImagingGLHdEngineSharedPtrVector& engin
     pathsToInvis.reserve(engines.size());
 
     for (size_t i = 0; i < engines.size(); ++i) {
-        if (!engines[i]->_isPopulated) {
+        UsdImagingGLHdEngine *owner = engines[i]->_GetSceneOwner();
+        if (!owner->_isPopulated) {
             delegatesToPopulate.push_back(engines[i]->_delegate);
             primsToPopulate.push_back(
                 rootPrims[i].GetStage()->GetPrimAtPath(engines[i]->_rootPath));
@@ -320,10 +375,10 @@ UsdImagingGLHdEngine::_Populate(const UsdImagingGLHdEngineSharedPtrVector& engin
             pathsToInvis.push_back(engines[i]->_invisedPrimPaths);
 
             // Set _isPopulated to true immediately to weed out any duplicate
-            // engines. This is equivalent to what would happen if the 
-            // consumer called the non-vectorized PrepareBatch on each
-            // engine individually.
-            engines[i]->_isPopulated = true;
+            // engines (including engines that share one delegate). This is
+            // equivalent to what would happen if the consumer called the
+            // non-vectorized PrepareBatch on each engine individually.
+            owner->_isPopulated = true;
         }
     }
 
@@ -942,6 +997,13 @@ UsdImagingGLHdEngine::IsDefaultPluginAvailable()
 bool
 UsdImagingGLHdEngine::SetRendererPlugin(TfToken const &id)
 {
+    if (_shareSource) {
+        TF_CODING_ERROR("Cannot switch renderer plugins on an engine that "
+                        "shares another engine's render index; switch the "
+                        "plugin on the source engine instead");
+        return false;
+    }
+
     HdxRendererPlugin *plugin = nullptr;
     TfToken actualId = id;
 
@@ -1012,6 +1074,15 @@ UsdImagingGLHdEngine::_DeleteHydraResources()
         delete _taskController;
         _taskController = nullptr;
     }
+    if (_shareSource) {
+        // The render index, delegate, and renderer plugin belong to the
+        // source engine; just drop our references to them.
+        _delegate = nullptr;
+        _renderIndex = nullptr;
+        _renderPlugin = nullptr;
+        _shareSource.reset();
+        return;
+    }
     if (_delegate != nullptr) {
         delete _delegate;
         _delegate = nullptr;
@@ -68,6 +68,19 @@ public:
                        const SdfPathVector& invisedPaths=SdfPathVector(),
                        const SdfPath& delegateID = SdfPath::AbsoluteRootPath());
 
+    /// Creates an engine that shares the render index, renderer plugin, and
+    /// UsdImaging delegate of \p shareSource, but owns its own task
+    /// controller. Use this for multi-viewport layouts: the scene is
+    /// populated and synced once through the shared delegate, while each
+    /// sharing engine draws with its own camera, viewport, and lighting
+    /// state. Preparing any one of the sharing engines for a frame prepares
+    /// them all; scene-level calls (SetRootTransform, selection, etc.)
+    /// affect every view. The sharing engine holds a reference to
+    /// \p shareSource, keeping the shared resources alive. Renderer plugin
+    /// switches must be made on the source engine.
+    USDIMAGINGGL_API
+    UsdImagingGLHdEngine(UsdImagingGLHdEngineSharedPtr const& shareSource);
+
     USDIMAGINGGL_API
     static bool IsDefaultPluginAvailable();
 
@@ -213,9 +226,17 @@ private:
                           UsdImagingGLEngine::RenderParams const& params);
 
     // This function disposes of: the render index, the render plugin,
-    // the task controller, and the usd imaging delegate.
+    // the task controller, and the usd imaging delegate. Engines created
+    // with the sharing constructor only dispose of their task controller
+    // and drop their references; the shared resources belong to the
+    // source engine.
     void _DeleteHydraResources();
 
+    // Returns the engine that owns the scene data (render index, delegate,
+    // renderer plugin): this engine itself, unless it was created sharing
+    // another engine's resources.
+    UsdImagingGLHdEngine* _GetSceneOwner();
+
     HdEngine _engine;
 
     HdRenderIndex *_renderIndex;
@@ -247,6 +268,11 @@ private:
     SdfPathVector _invisedPrimPaths;
     bool _isPopulated;
 
+    // Non-null if this engine was created sharing another engine's render
+    // index and delegate; also keeps the source engine (and thus the
+    // shared resources) alive.
+    UsdImagingGLHdEngineSharedPtr _shareSource;
+
     TfTokenVector _renderTags;
 };
 
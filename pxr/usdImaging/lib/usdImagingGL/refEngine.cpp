@@ -79,6 +79,8 @@ UsdImagingGLRefEngine::UsdImagingGLRefEngine(const SdfPathVector &excludedPrimPa
     _ctm(GfMatrix4d(1.0)),
     _vertCount(0),
     _lineVertCount(0),
+    _viewProjForCulling(1.0),
+    _haveViewProjForCulling(false),
     _attribBuffer(0),
     _indexBuffer(0)
 {
@@ -202,6 +204,67 @@ UsdImagingGLRefEngine::GetRprimPathFromPrimId(int primId) const
     return SdfPath();
 }
 
+bool
+UsdImagingGLRefEngine::_IsBoundsVisible(GfRange3d const& bounds) const
+{
+    if (!_haveViewProjForCulling || bounds.IsEmpty()) {
+        return true;
+    }
+
+    // Conservative test: cull only if all eight corners of the bounds fall
+    // outside the same clip plane.
+    uint8_t outside = 0x3f;
+    for (size_t i = 0; i < 8; ++i) {
+        GfVec3d p = bounds.GetCorner(i);
+        GfVec4d c = GfVec4d(p[0], p[1], p[2], 1.0) * _viewProjForCulling;
+        uint8_t corner = 0;
+        if (c[0] < -c[3]) { corner |= 1 << 0; }
+        if (c[0] >  c[3]) { corner |= 1 << 1; }
+        if (c[1] < -c[3]) { corner |= 1 << 2; }
+        if (c[1] >  c[3]) { corner |= 1 << 3; }
+        if (c[2] < -c[3]) { corner |= 1 << 4; }
+        if (c[2] >  c[3]) { corner |= 1 << 5; }
+        outside &= corner;
+        if (!outside) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool
+UsdImagingGLRefEngine::_ComputeVisibleSpans(
+    std::vector<_DrawRange> const& ranges,
+    std::vector<std::pair<size_t, size_t> >* spans) const
+{
+    std::vector<bool> visible(ranges.size());
+    bool anyCulled = false;
+    for (size_t i = 0; i < ranges.size(); ++i) {
+        visible[i] = _IsBoundsVisible(ranges[i].bounds);
+        anyCulled = anyCulled || !visible[i];
+    }
+    if (!anyCulled) {
+        return false;
+    }
+
+    // Prims were appended to the retained buffers in traversal order, so a
+    // run of consecutive visible prims maps to one contiguous span of buffer
+    // data, and can be submitted with a single draw call.
+    size_t i = 0;
+    while (i < ranges.size()) {
+        if (!visible[i]) {
+            ++i;
+            continue;
+        }
+        size_t first = i;
+        while (i < ranges.size() && visible[i]) {
+            ++i;
+        }
+        spans->push_back(std::make_pair(first, i - first));
+    }
+    return true;
+}
+
 void
 UsdImagingGLRefEngine::_DrawPolygons(bool drawID)
 {
@@ -222,14 +285,48 @@ UsdImagingGLRefEngine::_DrawPolygons(bool drawID)
                                      _lineColors.size());
     glColorPointer(3, GL_FLOAT, 0, (GLvoid*)offset);
 
+    // Coarse frustum culling: when some prims fall outside the view, only
+    // submit the contiguous spans of the retained buffers holding visible
+    // prims. Otherwise, draw everything with a single fully batched call.
+    std::vector<std::pair<size_t, size_t> > spans;
+    bool useSpans = _ComputeVisibleSpans(_polyDrawRanges, &spans);
+
     if (!_SupportsPrimitiveRestartIndex()) {
-        glMultiDrawElements(GL_POLYGON,
-                            (GLsizei*)(&(_numVerts[0])),
-                            GL_UNSIGNED_INT,
-                            (const GLvoid**)(&(_vertIdxOffsets[0])),
-                            _numVerts.size());
+        if (useSpans) {
+            TF_FOR_ALL(spanIt, spans) {
+                _DrawRange const& first = _polyDrawRanges[spanIt->first];
+                _DrawRange const& last =
+                    _polyDrawRanges[spanIt->first + spanIt->second - 1];
+                glMultiDrawElements(GL_POLYGON,
+                                    (GLsizei*)(&(_numVerts[first.polyStart])),
+                                    GL_UNSIGNED_INT,
+                                    (const GLvoid**)(
+                                        &(_vertIdxOffsets[first.polyStart])),
+                                    last.polyStart + last.polyCount -
+                                    first.polyStart);
+            }
+        } else {
+            glMultiDrawElements(GL_POLYGON,
+                                (GLsizei*)(&(_numVerts[0])),
+                                GL_UNSIGNED_INT,
+                                (const GLvoid**)(&(_vertIdxOffsets[0])),
+                                _numVerts.size());
+        }
     } else {
-        glDrawElements(GL_POLYGON, _verts.size(), GL_UNSIGNED_INT, 0);
+        if (useSpans) {
+            TF_FOR_ALL(spanIt, spans) {
+                _DrawRange const& first = _polyDrawRanges[spanIt->first];
+                _DrawRange const& last =
+                    _polyDrawRanges[spanIt->first + spanIt->second - 1];
+                glDrawElements(GL_POLYGON,
+                               last.indexStart + last.indexCount -
+                               first.indexStart,
+                               GL_UNSIGNED_INT,
+                               (GLvoid*)(sizeof(GLuint)*first.indexStart));
+            }
+        } else {
+            glDrawElements(GL_POLYGON, _verts.size(), GL_UNSIGNED_INT, 0);
+        }
     }
 }
 
@@ -256,15 +353,48 @@ UsdImagingGLRefEngine::_DrawLines(bool drawID)
         offset += sizeof(GLfloat) * (_lineColors.size() + _IDColors.size());
     glColorPointer(3, GL_FLOAT, 0, (GLvoid*)offset);
 
+    // Coarse frustum culling, as in _DrawPolygons().
+    std::vector<std::pair<size_t, size_t> > spans;
+    bool useSpans = _ComputeVisibleSpans(_lineDrawRanges, &spans);
+
     if (!_SupportsPrimitiveRestartIndex()) {
-        glMultiDrawElements(GL_LINE_STRIP,
-                            (GLsizei*)(&(_numLineVerts[0])),
-                            GL_UNSIGNED_INT,
-                            (const GLvoid**)(&(_lineVertIdxOffsets[0])),
-                            _numLineVerts.size());
+        if (useSpans) {
+            TF_FOR_ALL(spanIt, spans) {
+                _DrawRange const& first = _lineDrawRanges[spanIt->first];
+                _DrawRange const& last =
+                    _lineDrawRanges[spanIt->first + spanIt->second - 1];
+                glMultiDrawElements(GL_LINE_STRIP,
+                                    (GLsizei*)(&(_numLineVerts[first.polyStart])),
+                                    GL_UNSIGNED_INT,
+                                    (const GLvoid**)(
+                                        &(_lineVertIdxOffsets[first.polyStart])),
+                                    last.polyStart + last.polyCount -
+                                    first.polyStart);
+            }
+        } else {
+            glMultiDrawElements(GL_LINE_STRIP,
+                                (GLsizei*)(&(_numLineVerts[0])),
+                                GL_UNSIGNED_INT,
+                                (const GLvoid**)(&(_lineVertIdxOffsets[0])),
+                                _numLineVerts.size());
+        }
     } else {
-        glDrawElements(GL_LINE_STRIP, _lineVerts.size(), GL_UNSIGNED_INT,
-                       (GLvoid*)(sizeof(GLuint)*_verts.size()));
+        if (useSpans) {
+            TF_FOR_ALL(spanIt, spans) {
+                _DrawRange const& first = _lineDrawRanges[spanIt->first];
+                _DrawRange const& last =
+                    _lineDrawRanges[spanIt->first + spanIt->second - 1];
+                glDrawElements(GL_LINE_STRIP,
+                               last.indexStart + last.indexCount -
+                               first.indexStart,
+                               GL_UNSIGNED_INT,
+                               (GLvoid*)(sizeof(GLuint)*
+                                         (_verts.size() + first.indexStart)));
+            }
+        } else {
+            glDrawElements(GL_LINE_STRIP, _lineVerts.size(), GL_UNSIGNED_INT,
+                           (GLvoid*)(sizeof(GLuint)*_verts.size()));
+        }
     }
 }
 
@@ -361,6 +491,8 @@ UsdImagingGLRefEngine::Render(const UsdPrim& root, RenderParams params)
         TfReset(_numLineVerts);
         TfReset(_vertIdxOffsets);
         TfReset(_lineVertIdxOffsets);
+        TfReset(_polyDrawRanges);
+        TfReset(_lineDrawRanges);
         _vertCount = 0;
         _lineVertCount = 0;
         _primIDCounter = 0;
@@ -471,6 +603,11 @@ UsdImagingGLRefEngine::SetCameraState(const GfMatrix4d& viewMatrix,
 
     glMatrixMode(GL_MODELVIEW);
     glLoadMatrixd(viewMatrix.GetArray());
+
+    // Retain the composed view-projection matrix, so draw calls can cull
+    // retained prim bounds against the current view frustum.
+    _viewProjForCulling = viewMatrix * projectionMatrix;
+    _haveViewProjForCulling = true;
 }
 
 void
@@ -806,6 +943,11 @@ UsdImagingGLRefEngine::_HandleCurves(const UsdPrim& prim)
     VtVec3fArray pts;
     curvesSchema.GetPointsAttr().Get(&pts, _params.frame);
 
+    // Record the span of line buffer data this prim occupies, along with its
+    // world-space bounds, for frustum culling at draw time.
+    _DrawRange range;
+    range.indexStart = _lineVerts.size();
+    range.polyStart = _numLineVerts.size();
 
     if (color.size() < 1) {
 
@@ -831,7 +973,8 @@ UsdImagingGLRefEngine::_HandleCurves(const UsdPrim& prim)
         _linePoints.push_back(pt[0]);
         _linePoints.push_back(pt[1]);
         _linePoints.push_back(pt[2]);
-        
+        range.bounds.UnionWith(GfVec3d(pt));
+
         GfVec3f currColor = color[0];
         if (colorInterpolation == UsdGeomTokens->uniform) {
             // XXX uniform not yet supported, fallback to constant
@@ -872,6 +1015,10 @@ UsdImagingGLRefEngine::_HandleCurves(const UsdPrim& prim)
         _lineVertCount += *itr;
     }
 
+    range.indexCount = _lineVerts.size() - range.indexStart;
+    range.polyCount = _numLineVerts.size() - range.polyStart;
+    _lineDrawRanges.push_back(range);
+
     // Ignoring normals and widths, since we are only drawing the unrefined CV's
     // as lines segments.
 }
@@ -1056,13 +1203,20 @@ UsdImagingGLRefEngine::_RenderPrimitive(const UsdPrim &prim,
     // Setup an ID color for picking.
     GfVec4f idColor = _IssueID(prim.GetPath());
 
+    // Record the span of polygon buffer data this prim occupies, along with
+    // its world-space bounds, for frustum culling at draw time.
+    _DrawRange range;
+    range.indexStart = _verts.size();
+    range.polyStart = _numVerts.size();
+
     int index = 0;
     TF_FOR_ALL(itr, pts) {
         GfVec3f pt = _ctm.Transform(*itr);
         _points.push_back(pt[0]);
         _points.push_back(pt[1]);
         _points.push_back(pt[2]);
-        
+        range.bounds.UnionWith(GfVec3d(pt));
+
         GfVec3f currColor = color[0];
         if (colorInterpolation == UsdGeomTokens->uniform) {
             // XXX uniform not yet supported, fallback to constant
@@ -1187,6 +1341,12 @@ UsdImagingGLRefEngine::_RenderPrimitive(const UsdPrim &prim,
             _normals.push_back(-(*itr)[2]);
         }
     }
+
+    // The doublesided duplicate shares the prim's bounds and is part of the
+    // same contiguous span, so it culls with the prim.
+    range.indexCount = _verts.size() - range.indexStart;
+    range.polyCount = _numVerts.size() - range.polyStart;
+    _polyDrawRanges.push_back(range);
 }
 
 PXR_NAMESPACE_CLOSE_SCOPE
@@ -33,6 +33,9 @@
 #include "pxr/usd/usdGeom/gprim.h"
 #include "pxr/usd/usd/notice.h"
 
+#include "pxr/base/gf/matrix4d.h"
+#include "pxr/base/gf/range3d.h"
+
 #include "pxr/base/tf/declarePtrs.h"
 
 #include "pxr/base/tf/hashmap.h"
@@ -115,6 +118,30 @@ private:
     // When drawID is true, draw with ID color instead of vertex color.
     void _DrawLines(bool drawID);
 
+    // Per-prim span of retained buffer data, along with the prim's
+    // world-space bounds. Recorded while the retained buffers are built, so
+    // that draw calls can skip prims outside the view frustum without
+    // rebuilding any buffers.
+    struct _DrawRange {
+        GfRange3d bounds;
+        size_t indexStart;
+        size_t indexCount;
+        size_t polyStart;
+        size_t polyCount;
+    };
+
+    // Returns true if the given world-space bounds intersect the view
+    // frustum from the last SetCameraState() call. Conservative: returns
+    // true for empty bounds or when no camera has been set.
+    bool _IsBoundsVisible(GfRange3d const& bounds) const;
+
+    // Computes runs of consecutive frustum-visible draw ranges, expressed as
+    // (first range, range count) pairs. Returns false if nothing was culled,
+    // in which case callers should use the fully batched draw path.
+    bool _ComputeVisibleSpans(
+        std::vector<_DrawRange> const& ranges,
+        std::vector<std::pair<size_t, size_t> >* spans) const;
+
     // Allocates a new ID and color and associates it with the given path,
     // returns the ID color.
     GfVec4f _IssueID(SdfPath const& path);
@@ -187,6 +214,16 @@ private:
     // raw data of all lines.
     int _lineVertCount;
 
+    // Per-prim spans of the polygon and line buffers, used for coarse
+    // frustum culling at draw time.
+    std::vector<_DrawRange> _polyDrawRanges;
+    std::vector<_DrawRange> _lineDrawRanges;
+
+    // The composed view-projection matrix from the last SetCameraState()
+    // call, used to cull retained prim bounds against the view frustum.
+    GfMatrix4d _viewProjForCulling;
+    bool _haveViewProjForCulling;
+
     // The identifiers for the physical buffers on the card.
     GLuint _attribBuffer;
     GLuint _indexBuffer;
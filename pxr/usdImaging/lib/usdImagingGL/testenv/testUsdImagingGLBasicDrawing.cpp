@@ -28,6 +28,7 @@
 #include "pxr/usdImaging/usdImagingGL/unitTestGLDrawing.h"
 
 #include "pxr/base/arch/systemInfo.h"
+#include "pxr/base/arch/timing.h"
 #include "pxr/base/gf/bbox3d.h"
 #include "pxr/base/gf/frustum.h"
 #include "pxr/base/gf/matrix4d.h"
@@ -35,6 +36,7 @@
 #include "pxr/base/gf/range3d.h"
 #include "pxr/base/gf/rotation.h"
 #include "pxr/base/gf/vec3d.h"
+#include "pxr/base/js/json.h"
 #include "pxr/base/tf/getenv.h"
 
 #include "pxr/imaging/glf/simpleLightingContext.h"
@@ -54,6 +56,7 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
@@ -81,6 +84,15 @@ public:
     virtual void MouseMove(int x, int y, int modKeys);
 
 private:
+    // Computes the model-view matrix from the current rotation/translation
+    // state, including the z-up to y-up correction for z-up stages.
+    GfMatrix4d _ComputeModelViewMatrix() const;
+
+    // Renders a scripted camera orbit for GetBenchmarkFrameCount() frames,
+    // collecting per-frame CPU and GPU timing, and writes the results as
+    // JSON.
+    void _RunBenchmark();
+
     UsdStageRefPtr _stage;
     UsdImagingGLEngineSharedPtr _engine;
     GlfSimpleLightingContextRefPtr _lightingContext;
@@ -198,11 +210,167 @@ My_TestGLDrawing::InitTest()
     }
 }
 
+GfMatrix4d
+My_TestGLDrawing::_ComputeModelViewMatrix() const
+{
+    GfMatrix4d viewMatrix;
+    viewMatrix.SetIdentity();
+    viewMatrix *= GfMatrix4d().SetRotate(GfRotation(GfVec3d(0, 1, 0), _rotate[0]));
+    viewMatrix *= GfMatrix4d().SetRotate(GfRotation(GfVec3d(1, 0, 0), _rotate[1]));
+    viewMatrix *= GfMatrix4d().SetTranslate(GfVec3d(_translate[0], _translate[1], _translate[2]));
+
+    if (UsdGeomGetStageUpAxis(_stage) == UsdGeomTokens->z) {
+        // rotate from z-up to y-up
+        viewMatrix =
+            GfMatrix4d().SetRotate(GfRotation(GfVec3d(1.0,0.0,0.0), -90.0)) *
+            viewMatrix;
+    }
+    return viewMatrix;
+}
+
+void
+My_TestGLDrawing::_RunBenchmark()
+{
+    std::cout << "My_TestGLDrawing::_RunBenchmark()\n";
+
+    int width = GetWidth(), height = GetHeight();
+    double aspectRatio = double(width)/height;
+    GfFrustum frustum;
+    frustum.SetPerspective(60.0, aspectRatio, 1, 100000.0);
+    GfMatrix4d projMatrix = frustum.ComputeProjectionMatrix();
+
+    UsdTimeCode time = UsdTimeCode::Default();
+    if (!GetTimes().empty() && GetTimes()[0] != -999) {
+        time = GetTimes()[0];
+    }
+
+    UsdImagingGLEngine::RenderParams params;
+    params.drawMode = GetDrawMode();
+    params.enableLighting = IsEnabledTestLighting();
+    params.frame = time;
+    params.complexity = _GetComplexity();
+    params.cullStyle = IsEnabledCullBackfaces() ?
+                        UsdImagingGLEngine::CULL_STYLE_BACK :
+                        UsdImagingGLEngine::CULL_STYLE_NOTHING;
+
+    HdPerfLog& perfLog = HdPerfLog::GetInstance();
+    perfLog.Enable();
+
+    // GPU draw time comes from a timer query wrapped around each frame, when
+    // the extension is available.
+    GLuint timerQuery = 0;
+    if (GLEW_ARB_timer_query) {
+        glGenQueries(1, &timerQuery);
+    }
+
+    const int frameCount = GetBenchmarkFrameCount();
+    JsArray cpuMsPerFrame;
+    JsArray gpuMsPerFrame;
+    double firstFrameMs = 0.0;
+    double totalCpuMs = 0.0;
+
+    for (int frame = 0; frame < frameCount; ++frame) {
+        // Scripted camera path: one full orbit of the scene over the course
+        // of the benchmark.
+        _rotate[0] = 360.0f * frame / (float)frameCount;
+
+        GfVec4d viewport(0, 0, width, height);
+        _engine->SetCameraState(_ComputeModelViewMatrix(), projMatrix,
+                                viewport);
+
+        glViewport(0, 0, width, height);
+        GfVec4f const &clearColor = GetClearColor();
+        glClearBufferfv(GL_COLOR, 0, clearColor.data());
+        GLfloat clearDepth[1] = { 1.0f };
+        glClearBufferfv(GL_DEPTH, 0, clearDepth);
+        glEnable(GL_DEPTH_TEST);
+
+        if (IsEnabledTestLighting()) {
+            if (UsdImagingGL::IsEnabledHydra()) {
+                _engine->SetLightingState(_lightingContext);
+            } else {
+                _engine->SetLightingStateFromOpenGL();
+            }
+        }
+
+        if (timerQuery) {
+            glBeginQuery(GL_TIME_ELAPSED, timerQuery);
+        }
+
+        // The CPU time covers delegate sync and command buffer submission;
+        // glFinish() keeps the GPU from running more than one frame behind,
+        // so the timer query reflects a single frame.
+        uint64_t startTicks = ArchGetTickTime();
+        _engine->Render(_stage->GetPseudoRoot(), params);
+        double cpuMs = ArchTicksToNanoseconds(
+            ArchGetTickTime() - startTicks) / 1.0e6;
+
+        if (timerQuery) {
+            glEndQuery(GL_TIME_ELAPSED);
+        }
+        glFinish();
+
+        if (frame == 0) {
+            // The first frame carries stage population and buffer upload;
+            // report it separately rather than folding it into the average.
+            firstFrameMs = cpuMs;
+        } else {
+            totalCpuMs += cpuMs;
+            cpuMsPerFrame.push_back(JsValue(cpuMs));
+            if (timerQuery) {
+                GLuint64 gpuNs = 0;
+                glGetQueryObjectui64v(timerQuery, GL_QUERY_RESULT, &gpuNs);
+                gpuMsPerFrame.push_back(JsValue((double)gpuNs / 1.0e6));
+            }
+        }
+    }
+
+    if (timerQuery) {
+        glDeleteQueries(1, &timerQuery);
+    }
+
+    JsObject results;
+    results["stage"] = JsValue(GetStageFilePath());
+    results["renderer"] = JsValue(_GetRenderer().GetString());
+    results["complexity"] = JsValue((double)_GetComplexity());
+    results["frameCount"] = JsValue(frameCount);
+    results["firstFrameMs"] = JsValue(firstFrameMs);
+    if (frameCount > 1) {
+        results["averageCpuMs"] = JsValue(totalCpuMs / (frameCount - 1));
+    }
+    results["cpuMsPerFrame"] = JsValue(cpuMsPerFrame);
+    results["gpuMsPerFrame"] = JsValue(gpuMsPerFrame);
+
+    // Snapshot all HdPerfLog counters; these cover the CPU-side sync costs
+    // (cache hits/misses, items drawn, varying state) that the wall-clock
+    // numbers alone can't attribute.
+    JsObject counters;
+    TfTokenVector counterNames = perfLog.GetCounterNames();
+    TF_FOR_ALL(nameIt, counterNames) {
+        counters[nameIt->GetString()] = JsValue(perfLog.GetCounter(*nameIt));
+    }
+    results["counters"] = JsValue(counters);
+
+    if (!GetBenchmarkOutputFilePath().empty()) {
+        std::ofstream ofs(GetBenchmarkOutputFilePath().c_str());
+        JsWriteToStream(JsValue(results), ofs);
+        std::cout << GetBenchmarkOutputFilePath() << "\n";
+    } else {
+        JsWriteToStream(JsValue(results), std::cout);
+        std::cout << "\n";
+    }
+}
+
 void
 My_TestGLDrawing::DrawTest(bool offscreen)
 {
     std::cout << "My_TestGLDrawing::DrawTest()\n";
 
+    if (IsEnabledBenchmark()) {
+        _RunBenchmark();
+        return;
+    }
+
     HdPerfLog& perfLog = HdPerfLog::GetInstance();
     perfLog.Enable();
     
@@ -223,21 +391,8 @@ My_TestGLDrawing::DrawTest(bool offscreen)
     GfFrustum frustum;
     frustum.SetPerspective(60.0, aspectRatio, 1, 100000.0);
 
-    GfMatrix4d viewMatrix;
-    viewMatrix.SetIdentity();
-    viewMatrix *= GfMatrix4d().SetRotate(GfRotation(GfVec3d(0, 1, 0), _rotate[0]));
-    viewMatrix *= GfMatrix4d().SetRotate(GfRotation(GfVec3d(1, 0, 0), _rotate[1]));
-    viewMatrix *= GfMatrix4d().SetTranslate(GfVec3d(_translate[0], _translate[1], _translate[2]));
-
     GfMatrix4d projMatrix = frustum.ComputeProjectionMatrix();
-
-    GfMatrix4d modelViewMatrix = viewMatrix; 
-    if (UsdGeomGetStageUpAxis(_stage) == UsdGeomTokens->z) {
-        // rotate from z-up to y-up
-        modelViewMatrix = 
-            GfMatrix4d().SetRotate(GfRotation(GfVec3d(1.0,0.0,0.0), -90.0)) *
-            modelViewMatrix;
-    }
+    GfMatrix4d modelViewMatrix = _ComputeModelViewMatrix();
 
     GfVec4d viewport(0, 0, width, height);
     _engine->SetCameraState(modelViewMatrix, projMatrix, viewport);
@@ -228,6 +228,7 @@ UsdImagingGL_UnitTestGLDrawing::UsdImagingGL_UnitTestGLDrawing()
     , _testLighting(false)
     , _cameraLight(false)
     , _testIdRender(false)
+    , _benchmarkFrameCount(0)
     , _complexity(1.0f)
     , _drawMode(UsdImagingGLEngine::DRAW_SHADED_SMOOTH)
     , _shouldFrameAll(false)
@@ -318,6 +319,7 @@ static void Usage(int argc, char *argv[])
 "                           [-complexities complexities1 complexities2 ...]\n"
 "                           [-times times1 times2 ...] [-cullBackfaces]\n"
 "                           [-clear r g b a] [-translate x y z]\n"
+"                           [-benchmark numFrames] [-benchmarkWrite filePath]\n"
 "\n"
 "  usdImaging basic drawing test\n"
 "\n"
@@ -345,7 +347,13 @@ static void Usage(int argc, char *argv[])
 "                      an image [()]\n"
 "  -cullBackfaces      enable backface culling\n"
 "  -clear r g b a      clear color\n"
-"  -translate x y z    default camera translation\n";
+"  -translate x y z    default camera translation\n"
+"  -benchmark numFrames\n"
+"                      render a scripted camera path offscreen for the\n"
+"                      given number of frames and report frame timing [0]\n"
+"  -benchmarkWrite filePath\n"
+"                      name of JSON file to write benchmark results to;\n"
+"                      results are printed to stdout if unset []\n";
 
     Die(usage, TfGetBaseName(argv[0]).c_str());
 }
@@ -468,6 +476,14 @@ UsdImagingGL_UnitTestGLDrawing::_Parse(int argc, char *argv[], _Args* args)
             args->clearColor[2] = (float)ParseDouble(i, argc, argv);
             args->clearColor[3] = (float)ParseDouble(i, argc, argv);
         }
+        else if (strcmp(argv[i], "-benchmark") == 0) {
+            CheckForMissingArguments(i, 1, argc, argv);
+            _benchmarkFrameCount = (int)ParseDouble(i, argc, argv);
+        }
+        else if (strcmp(argv[i], "-benchmarkWrite") == 0) {
+            CheckForMissingArguments(i, 1, argc, argv);
+            _benchmarkOutputFilePath = argv[++i];
+        }
         else if (strcmp(argv[i], "-translate") == 0) {
             CheckForMissingArguments(i, 3, argc, argv);
             args->translate[0] = (float)ParseDouble(i, argc, argv);
@@ -538,7 +554,12 @@ UsdImagingGL_UnitTestGLDrawing::RunTest(int argc, char *argv[])
         _times.push_back(-999);
     }
 
-    if (args.complexities.size() > 0) {
+    if (IsEnabledBenchmark()) {
+        // Benchmarks always run offscreen; the test's DrawTest() is expected
+        // to drive the scripted camera path and collect timing itself.
+        _widget->DrawOffscreen();
+
+    } else if (args.complexities.size() > 0) {
         std::string imageFilePath = GetOutputFilePath();
 
         TF_FOR_ALL(compIt, args.complexities) {
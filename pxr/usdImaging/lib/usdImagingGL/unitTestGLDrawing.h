@@ -61,6 +61,14 @@ public:
     std::string const & GetStageFilePath() const { return _stageFilePath; }
     std::string const & GetOutputFilePath() const { return _outputFilePath; }
 
+    // Benchmark mode: tests render a scripted camera path for the requested
+    // number of frames and report frame timing instead of writing images.
+    bool IsEnabledBenchmark() const { return _benchmarkFrameCount > 0; }
+    int GetBenchmarkFrameCount() const { return _benchmarkFrameCount; }
+    std::string const & GetBenchmarkOutputFilePath() const {
+        return _benchmarkOutputFilePath;
+    }
+
     std::vector<GfVec4d> const & GetClipPlanes() const { return _clipPlanes; }
     std::vector<double> const& GetTimes() const { return _times; }
     GfVec4f const & GetClearColor() const { return _clearColor; }
@@ -97,6 +105,9 @@ private:
     std::string _stageFilePath;
     std::string _outputFilePath;
 
+    int _benchmarkFrameCount;
+    std::string _benchmarkOutputFilePath;
+
     float _complexity;
     TfToken _renderer;
 
@@ -28,5 +28,6 @@ PXR_NAMESPACE_USING_DIRECTIVE
 
 TF_WRAP_MODULE
 {
+    TF_WRAP( PrimHierarchyModel );
     TF_WRAP( Utils );
 }
@@ -0,0 +1,119 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#include "pxr/usdImaging/usdviewq/primHierarchyModel.h"
+
+#include "pxr/usd/usd/primRange.h"
+#include "pxr/usd/usd/stage.h"
+
+#include "pxr/base/work/loops.h"
+
+#include <algorithm>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+
+UsdviewqPrimHierarchyModel::UsdviewqPrimHierarchyModel(
+    UsdStagePtr const& stage, UsdTimeCode time)
+    : _stage(stage)
+{
+    _Build(time);
+}
+
+void
+UsdviewqPrimHierarchyModel::Refresh(UsdTimeCode time)
+{
+    _Build(time);
+}
+
+void
+UsdviewqPrimHierarchyModel::_Build(UsdTimeCode time)
+{
+    _rows.clear();
+    _rowsByPath.clear();
+
+    if (!_stage) {
+        return;
+    }
+
+    // Pass 1: serial pre-and-post-order traversal to capture the hierarchy
+    // structure. This is just pointer-chasing; the expensive per-prim
+    // queries happen in the parallel pass below.
+    UsdPrimRange range = UsdPrimRange::AllPrimsPreAndPostVisit(
+        _stage->GetPseudoRoot());
+
+    std::vector<size_t> parentStack;
+    for (auto iter = range.begin(); iter != range.end(); ++iter) {
+        if (iter.IsPostVisit()) {
+            parentStack.pop_back();
+            continue;
+        }
+
+        size_t rowIndex = _rows.size();
+        Row row;
+        row.prim = *iter;
+        row.path = iter->GetPath();
+        row.parentRow = parentStack.empty() ? rowIndex : parentStack.back();
+        row.childCount = 0;
+        row.depth = (int)parentStack.size();
+        _rows.push_back(row);
+        _rowsByPath[row.path] = rowIndex;
+
+        if (!parentStack.empty()) {
+            ++_rows[parentStack.back()].childCount;
+        }
+        parentStack.push_back(rowIndex);
+    }
+
+    // Pass 2: fill in the per-prim display data in parallel. This is where
+    // the composition arc and visibility queries happen, and they dominate
+    // the build time on large stages. Stages support concurrent reads.
+    WorkParallelForN(_rows.size(),
+        [this, time](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                _rows[i].info =
+                    UsdviewqUtils::GetPrimInfo(_rows[i].prim, time);
+            }
+        });
+}
+
+size_t
+UsdviewqPrimHierarchyModel::GetRowForPath(SdfPath const& path) const
+{
+    _RowsByPathMap::const_iterator it = _rowsByPath.find(path);
+    return it == _rowsByPath.end() ? (size_t)-1 : it->second;
+}
+
+std::vector<UsdviewqPrimHierarchyModel::Row>
+UsdviewqPrimHierarchyModel::GetRows(size_t start, size_t count) const
+{
+    std::vector<Row> result;
+    if (start >= _rows.size()) {
+        return result;
+    }
+    size_t end = std::min(start + count, _rows.size());
+    result.assign(_rows.begin() + start, _rows.begin() + end);
+    return result;
+}
+
+PXR_NAMESPACE_CLOSE_SCOPE
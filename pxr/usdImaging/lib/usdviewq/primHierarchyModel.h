@@ -0,0 +1,103 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef USDVIEWQ_PRIM_HIERARCHY_MODEL_H
+#define USDVIEWQ_PRIM_HIERARCHY_MODEL_H
+
+#include "pxr/pxr.h"
+#include "pxr/usdImaging/usdviewq/api.h"
+#include "pxr/usdImaging/usdviewq/utils.h"
+
+#include "pxr/usd/sdf/path.h"
+#include "pxr/usd/usd/prim.h"
+#include "pxr/usd/usd/timeCode.h"
+
+#include "pxr/base/tf/hashmap.h"
+
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+
+/// \class UsdviewqPrimHierarchyModel
+///
+/// A bulk snapshot of a stage's prim hierarchy, built for usdview's prim
+/// browser. Building the snapshot traverses the stage once in C++ and fills
+/// the per-prim display data in parallel, so the browser pays one native
+/// call instead of a Python round trip per prim; afterwards the tree view
+/// pages rows out of the snapshot without touching the stage at all.
+///
+class UsdviewqPrimHierarchyModel {
+public:
+
+    /// One prim of the hierarchy snapshot. Rows are stored in depth-first
+    /// traversal order; \p parentRow is the row index of the prim's parent
+    /// (the root row points at itself) and \p childCount the number of
+    /// direct children, which is everything a tree view needs to build
+    /// its indices without further stage queries.
+    struct Row {
+        UsdPrim prim;
+        SdfPath path;
+        size_t parentRow;
+        size_t childCount;
+        int depth;
+        UsdviewqUtils::PrimInfo info;
+    };
+
+    /// Builds a snapshot of all prims (including inactive, undefined and
+    /// abstract ones, which usdview filters in the view) below the stage's
+    /// pseudo-root, evaluating visibility at \p time.
+    USDVIEWQ_API
+    UsdviewqPrimHierarchyModel(UsdStagePtr const& stage, UsdTimeCode time);
+
+    /// Rebuilds the snapshot, e.g. after stage edits or a frame change.
+    USDVIEWQ_API
+    void Refresh(UsdTimeCode time);
+
+    /// Returns the total number of rows in the snapshot.
+    size_t GetRowCount() const { return _rows.size(); }
+
+    /// Returns the row index for \p path, or size_t(-1) if the path is not
+    /// in the snapshot.
+    USDVIEWQ_API
+    size_t GetRowForPath(SdfPath const& path) const;
+
+    /// Returns up to \p count rows starting at row \p start, so a view can
+    /// lazily page in just the visible range.
+    USDVIEWQ_API
+    std::vector<Row> GetRows(size_t start, size_t count) const;
+
+private:
+    void _Build(UsdTimeCode time);
+
+    UsdStagePtr _stage;
+    std::vector<Row> _rows;
+
+    typedef TfHashMap<SdfPath, size_t, SdfPath::Hash> _RowsByPathMap;
+    _RowsByPathMap _rowsByPath;
+};
+
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif //USDVIEWQ_PRIM_HIERARCHY_MODEL_H
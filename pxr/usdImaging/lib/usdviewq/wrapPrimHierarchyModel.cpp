@@ -0,0 +1,84 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#include "pxr/usdImaging/usdviewq/primHierarchyModel.h"
+
+#include "pxr/usd/usd/stage.h"
+
+#include "pxr/base/tf/iterator.h"
+
+#include <boost/python.hpp>
+
+#include <vector>
+
+using namespace boost::python;
+
+PXR_NAMESPACE_USING_DIRECTIVE
+
+namespace {
+
+// As with Utils.GetPrimInfo, rows are unrolled into flat tuples rather
+// than wrapped classes to keep python marshalling costs down. Each row is
+// (path, parentRow, depth, childCount, primInfoTuple), with primInfoTuple
+// shaped exactly like the Utils.GetPrimInfo result.
+static list
+_GetRows(UsdviewqPrimHierarchyModel const &model, size_t start, size_t count)
+{
+    list result;
+    std::vector<UsdviewqPrimHierarchyModel::Row> rows =
+        model.GetRows(start, count);
+    TF_FOR_ALL(rowIt, rows) {
+        UsdviewqUtils::PrimInfo const &info = rowIt->info;
+        result.append(boost::python::make_tuple(
+            rowIt->path.GetString(),
+            rowIt->parentRow,
+            rowIt->depth,
+            rowIt->childCount,
+            boost::python::make_tuple(info.hasCompositionArcs,
+                                      info.isActive,
+                                      info.isImageable,
+                                      info.isDefined,
+                                      info.isAbstract,
+                                      info.isInMaster,
+                                      info.isInstance,
+                                      info.isVisibilityInherited,
+                                      info.visVaries,
+                                      info.name,
+                                      info.typeName)));
+    }
+    return result;
+}
+
+} // anonymous namespace
+
+void wrapPrimHierarchyModel() {
+    typedef UsdviewqPrimHierarchyModel This;
+
+    class_<This, boost::noncopyable> ("PrimHierarchyModel",
+                                      init<UsdStagePtr const &, UsdTimeCode>())
+        .def("Refresh", &This::Refresh)
+        .def("GetRowCount", &This::GetRowCount)
+        .def("GetRowForPath", &This::GetRowForPath)
+        .def("GetRows", _GetRows)
+        ;
+}
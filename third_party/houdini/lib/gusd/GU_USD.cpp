@@ -44,6 +44,8 @@
 #include <UT/UT_Interrupt.h>
 #include <UT/UT_ParallelUtil.h>
 
+#include <atomic>
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 namespace {
@@ -817,6 +819,45 @@ _BuildTypedRangesFromPrimRanges(
 }
 
 
+/// Functor for unpacking packed USD prims into per-prim detail shards.
+/// Each prim converts into its own GU_Detail, so workers never touch
+/// shared geometry; the shards are merged serially, in order, afterward.
+class _UnpackPrimsFn
+{
+public:
+    _UnpackPrimsFn(const UT_Array<const GusdGU_PackedUSD*>& prims,
+                   const UT_String& primvarPattern,
+                   UT_Array<GU_Detail*>& details,
+                   std::atomic_bool& workerInterrupt)
+        : _prims(prims), _primvarPattern(primvarPattern),
+          _details(details), _workerInterrupt(workerInterrupt) {}
+
+    void    operator()(const UT_BlockedRange<exint>& r) const
+            {
+                auto* boss = UTgetInterrupt();
+
+                for (exint i = r.begin(); i < r.end(); ++i) {
+                    if (boss->opInterrupt() || _workerInterrupt) {
+                        return;
+                    }
+                    GU_Detail* gd = new GU_Detail;
+                    if (!_prims(i)->unpackGeometry(
+                            *gd, _primvarPattern.c_str())) {
+                        // Interrupt the other worker threads.
+                        _workerInterrupt = true;
+                    }
+                    _details(i) = gd;
+                }
+            }
+
+private:
+    const UT_Array<const GusdGU_PackedUSD*>&    _prims;
+    const UT_String&                            _primvarPattern;
+    UT_Array<GU_Detail*>&                       _details;
+    std::atomic_bool&                           _workerInterrupt;
+};
+
+
 } /*namespace*/
 
 
@@ -896,14 +937,13 @@ GusdGU_USD::AppendExpandedPackedPrims(
     if (unpackToPolygons) {
         GA_Size gdStart = gd.getNumPrimitives();
 
-        // If unpacking down to polygons, iterate through the intermediate
-        // packed prims in gdPtr and unpack them into gd.
+        // If unpacking down to polygons, collect the intermediate packed
+        // prims in gdPtr, in destination order, together with the source
+        // index each one was expanded from.
+        UT_Array<const GusdGU_PackedUSD*> primsToUnpack;
+        UT_Array<exint> unpackSrcIndices;
         exint i = 0;
         for (GA_Iterator it(primDstRng); !it.atEnd(); ++it, ++i) {
-            if(task.wasInterrupted()) {
-                return false;
-            }
-
             const GEO_Primitive* p = gdPtr->getGEOPrimitive(*it);
             const GU_PrimPacked* pp = dynamic_cast<const GU_PrimPacked*>(p);
             if (!pp) {
@@ -912,21 +952,39 @@ GusdGU_USD::AppendExpandedPackedPrims(
 
             if (const GusdGU_PackedUSD* prim =
                 dynamic_cast<const GusdGU_PackedUSD*>(pp->implementation())) {
+                primsToUnpack.append(prim);
+                unpackSrcIndices.append(primIndexPairs(i).second);
+            }
+        }
 
-                GA_Size gdCurrent = gd.getNumPrimitives();
+        // Convert the prims in parallel, each into its own detail shard.
+        // Geometry conversion dominates the unpack cost; the serial work
+        // that remains is merging the shards into gd in order below.
+        UT_Array<GU_Detail*> shards(primsToUnpack.size(),
+                                    primsToUnpack.size());
+        std::atomic_bool workerInterrupt(false);
+        UTparallelFor(
+            UT_BlockedRange<exint>(0, primsToUnpack.size()),
+            _UnpackPrimsFn(primsToUnpack, primvarPattern, shards,
+                           workerInterrupt));
 
-                // Unpack this prim.
-                if (!prim->unpackGeometry(gd, primvarPattern.c_str())) {
-                    return false;
-                }
+        const bool interrupted = task.wasInterrupted() || workerInterrupt;
+        for (exint k = 0; k < shards.size(); ++k) {
+            if (!interrupted && shards(k)) {
+                GA_Size gdCurrent = gd.getNumPrimitives();
+                gd.merge(*shards(k));
 
-                const GA_Offset offset =
-                    indexToOffset(primIndexPairs(i).second);
+                const GA_Offset offset = indexToOffset(unpackSrcIndices(k));
                 const exint count = gd.getNumPrimitives() - gdCurrent;
                 for (exint j = 0; j < count; ++j) {
                     srcOffsets.append(offset);
                 }
             }
+            delete shards(k);
+        }
+        if (interrupted) {
+            delete gdPtr;
+            return false;
         }
 
         // primDstRng needs to be reset to be the range of unpacked prims in
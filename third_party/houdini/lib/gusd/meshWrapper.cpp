@@ -486,12 +486,14 @@ GusdMeshWrapper::refine(
             cornerIndicesAttr.Get(&vtIntArray, m_time);
             cornerSharpnessAttr.Get(&vtFloatArray, m_time);
             if(!vtIntArray.empty() && !vtFloatArray.empty()) {
+                // Hand the VtArrays off zero-copy; the wrapper shares the
+                // buffer instead of copying it element-wise.
                 GT_DataArrayHandle cornerArrayHandle
-                    = new GT_Int32Array(vtIntArray.data(), vtIntArray.size(), 1);
+                    = new GusdGT_VtArray<int32>(vtIntArray);
                 subdPrim->appendIntTag("corner", cornerArrayHandle);
 
                 GT_DataArrayHandle corenerWeightArrayHandle
-                    = new GT_Real32Array(vtFloatArray.data(), vtFloatArray.size(), 1);
+                    = new GusdGT_VtArray<fpreal32>(vtFloatArray);
                 subdPrim->appendRealTag("corner", corenerWeightArrayHandle);
             }
         }
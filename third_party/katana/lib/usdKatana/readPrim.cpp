@@ -24,6 +24,7 @@
 #include "pxr/pxr.h"
 #include "usdKatana/attrMap.h"
 #include "usdKatana/readPrim.h"
+#include "usdKatana/usdInAttrCache.h"
 #include "usdKatana/usdInPrivateData.h"
 #include "usdKatana/utils.h"
 #include "usdKatana/tokens.h"
@@ -754,6 +755,17 @@ PxrUsdKatanaGeomGetPrimvarGroup(
         const UsdGeomImageable& imageable,
         const PxrUsdKatanaUsdInPrivateData& data)
 {
+    // Reuse a previously resolved primvar batch for this prim and time
+    // if one exists (from an earlier cook or a parallel prefetch).
+    PxrUsdKatanaUsdInAttrCache* attrCache =
+        data.GetUsdInArgs()->GetAttrCache();
+    const SdfPath& primPath = imageable.GetPrim().GetPath();
+    const double currentTime = data.GetCurrentTime();
+    FnKat::Attribute cachedPrimvars;
+    if (attrCache->FindPrimvars(primPath, currentTime, &cachedPrimvars)) {
+        return cachedPrimvars;
+    }
+
     // Usd primvars -> Primvar attributes
     FnKat::GroupBuilder gdBuilder;
 
@@ -844,7 +856,9 @@ PxrUsdKatanaGeomGetPrimvarGroup(
         gdBuilder.set(gdName, attrBuilder.build());
     }
 
-    return gdBuilder.build();
+    FnKat::GroupAttribute primvarGroup = gdBuilder.build();
+    attrCache->StorePrimvars(primPath, currentTime, primvarGroup);
+    return primvarGroup;
 }
 
 void
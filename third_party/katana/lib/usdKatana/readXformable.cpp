@@ -25,6 +25,8 @@
 #include "usdKatana/attrMap.h"
 #include "usdKatana/readPrim.h"
 #include "usdKatana/readXformable.h"
+#include "usdKatana/usdInArgs.h"
+#include "usdKatana/usdInAttrCache.h"
 #include "usdKatana/usdInPrivateData.h"
 #include "usdKatana/utils.h"
 
@@ -53,6 +55,16 @@ PxrUsdKatanaReadXformable(
 
     double currentTime = data.GetCurrentTime();
 
+    // Reuse a previously resolved xform batch for this prim and time if
+    // one exists (from an earlier cook or a parallel prefetch). An
+    // invalid cached attribute records that the prim had no xform ops.
+    PxrUsdKatanaUsdInAttrCache* attrCache =
+        data.GetUsdInArgs()->GetAttrCache();
+    const SdfPath& primPath = xformable.GetPrim().GetPath();
+    if (attrCache->FindXform(primPath, currentTime, &attr)) {
+        return attr.isValid();
+    }
+
     // Get the ordered xform ops for the prim.
     //
     bool resetsXformStack = false;
@@ -122,6 +134,7 @@ PxrUsdKatanaReadXformable(
         xformGb.set("matrix", matrixAttr);
 
         attr = xformGb.build();
+        attrCache->StoreXform(primPath, currentTime, attr);
         return true;
     }
     else if (resetsXformStack) {
@@ -129,9 +142,12 @@ PxrUsdKatanaReadXformable(
         xformGb.setGroupInherit(false);
         xformGb.set("origin", FnKat::DoubleAttribute(1));
         attr = xformGb.build();
+        attrCache->StoreXform(primPath, currentTime, attr);
         return true;
     }
 
+    attrCache->StoreXform(primPath, currentTime,
+                          FnAttribute::GroupAttribute());
     return false;
 }
 
@@ -25,6 +25,7 @@
 #define PXRUSDKATANA_USDIN_ARGS_H
 
 #include "pxr/pxr.h"
+#include "usdKatana/usdInAttrCache.h"
 #include "pxr/usd/usdGeom/bboxCache.h"
 #include "pxr/base/tf/refPtr.h"
 
@@ -184,6 +185,12 @@ public:
         return _bboxCaches.local();
     }
 
+    /// Shared cache of resolved attribute batches (xform, bound,
+    /// primvars) for all locations cooked with these args.
+    PxrUsdKatanaUsdInAttrCache* GetAttrCache() {
+        return &_attrCache;
+    }
+
     const std::string & GetErrorMessage() {
         return _errorMessage;
     }
@@ -229,7 +236,9 @@ private:
 
     typedef tbb::enumerable_thread_specific< std::map<double, UsdGeomBBoxCache> > _ThreadLocalBBoxCaches;
     _ThreadLocalBBoxCaches _bboxCaches;
-    
+
+    PxrUsdKatanaUsdInAttrCache _attrCache;
+
     std::string _errorMessage;
 
 };
@@ -0,0 +1,171 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#include "pxr/pxr.h"
+#include "usdKatana/usdInAttrCache.h"
+
+#include "usdKatana/readPrim.h"
+#include "usdKatana/readXformable.h"
+#include "usdKatana/usdInArgs.h"
+#include "usdKatana/usdInPrivateData.h"
+#include "usdKatana/utils.h"
+
+#include "pxr/base/work/loops.h"
+#include "pxr/usd/usdGeom/imageable.h"
+#include "pxr/usd/usdGeom/xformable.h"
+
+#include <FnLogging/FnLogging.h>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+
+FnLogSetup("PxrUsdKatanaUsdInAttrCache");
+
+bool
+PxrUsdKatanaUsdInAttrCache::FindXform(
+        const SdfPath& path, double time,
+        FnAttribute::GroupAttribute* attr) const
+{
+    boost::shared_lock<boost::upgrade_mutex> readerLock(_mutex);
+    _Map::const_iterator it = _entries.find(_Key(path, time));
+    if (it == _entries.end() || !it->second.hasXform) {
+        return false;
+    }
+    *attr = it->second.xform;
+    return true;
+}
+
+void
+PxrUsdKatanaUsdInAttrCache::StoreXform(
+        const SdfPath& path, double time,
+        const FnAttribute::GroupAttribute& attr)
+{
+    boost::unique_lock<boost::upgrade_mutex> writerLock(_mutex);
+    _Entry& entry = _entries[_Key(path, time)];
+    entry.xform = attr;
+    entry.hasXform = true;
+}
+
+bool
+PxrUsdKatanaUsdInAttrCache::FindPrimvars(
+        const SdfPath& path, double time,
+        FnAttribute::Attribute* attr) const
+{
+    boost::shared_lock<boost::upgrade_mutex> readerLock(_mutex);
+    _Map::const_iterator it = _entries.find(_Key(path, time));
+    if (it == _entries.end() || !it->second.hasPrimvars) {
+        return false;
+    }
+    *attr = it->second.primvars;
+    return true;
+}
+
+void
+PxrUsdKatanaUsdInAttrCache::StorePrimvars(
+        const SdfPath& path, double time,
+        const FnAttribute::Attribute& attr)
+{
+    boost::unique_lock<boost::upgrade_mutex> writerLock(_mutex);
+    _Entry& entry = _entries[_Key(path, time)];
+    entry.primvars = attr;
+    entry.hasPrimvars = true;
+}
+
+FnAttribute::DoubleAttribute
+PxrUsdKatanaUsdInAttrCache::GetOrComputeBound(
+        const UsdPrim& prim,
+        const PxrUsdKatanaUsdInPrivateData& data)
+{
+    const _Key key(prim.GetPath(), data.GetCurrentTime());
+
+    {
+        boost::shared_lock<boost::upgrade_mutex> readerLock(_mutex);
+        _Map::const_iterator it = _entries.find(key);
+        if (it != _entries.end() && it->second.hasBound) {
+            return it->second.bound;
+        }
+    }
+
+    const std::vector<double>& motionSampleTimes =
+        data.GetMotionSampleTimes();
+    std::vector<GfBBox3d> bounds =
+        data.GetUsdInArgs()->ComputeBounds(prim, motionSampleTimes);
+
+    bool hasInfiniteBounds = false;
+    bool isMotionBackward = motionSampleTimes.size() > 1 &&
+        motionSampleTimes.front() > motionSampleTimes.back();
+    FnAttribute::DoubleAttribute boundsAttr =
+        PxrUsdKatanaUtils::ConvertBoundsToAttribute(
+            bounds, motionSampleTimes, isMotionBackward,
+            &hasInfiniteBounds);
+
+    // Report infinite bounds as a warning.
+    if (hasInfiniteBounds) {
+        FnLogWarn("Infinite bounds found at "<<prim.GetPath().GetString());
+    }
+
+    {
+        boost::unique_lock<boost::upgrade_mutex> writerLock(_mutex);
+        _Entry& entry = _entries[key];
+        entry.bound = boundsAttr;
+        entry.hasBound = true;
+    }
+
+    return boundsAttr;
+}
+
+void
+PxrUsdKatanaUsdInAttrCache::PrefetchChildren(
+        const std::vector<UsdPrim>& children,
+        const PxrUsdKatanaUsdInPrivateData& parentData)
+{
+    WorkParallelForN(children.size(),
+        [this, &children, &parentData](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                const UsdPrim& child = children[i];
+
+                // The read functions below consult and populate this
+                // cache themselves; we just invoke them with private
+                // data equivalent to what the child's cook will build.
+                PxrUsdKatanaUsdInPrivateData childData(
+                        child, parentData.GetUsdInArgs(), &parentData);
+
+                if (UsdGeomXformable xformable = UsdGeomXformable(child)) {
+                    FnAttribute::GroupAttribute xformAttr;
+                    PxrUsdKatanaReadXformable(xformable, childData,
+                                              xformAttr);
+                }
+
+                if (UsdGeomImageable imageable = UsdGeomImageable(child)) {
+                    PxrUsdKatanaGeomGetPrimvarGroup(imageable, childData);
+                }
+
+                if (PxrUsdKatanaUtils::IsBoundable(child)) {
+                    GetOrComputeBound(child, childData);
+                }
+            }
+        });
+}
+
+
+PXR_NAMESPACE_CLOSE_SCOPE
@@ -0,0 +1,110 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#ifndef PXRUSDKATANA_USDIN_ATTRCACHE_H
+#define PXRUSDKATANA_USDIN_ATTRCACHE_H
+
+#include "pxr/pxr.h"
+#include "pxr/usd/sdf/path.h"
+#include "pxr/usd/usd/prim.h"
+
+#include <FnAttribute/FnAttribute.h>
+
+#include <boost/thread/locks.hpp>
+#include <boost/thread/shared_mutex.hpp>
+
+#include <map>
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+class PxrUsdKatanaUsdInPrivateData;
+
+/// \brief Per-stage shared cache of resolved attribute batches.
+///
+/// Several of the attribute batches that a PxrUsdIn cook resolves depend
+/// only on the prim and the evaluation time: the xform attribute group,
+/// the bound attribute and the geometry.arbitrary primvar group.
+/// FnAttributes are immutable and cheap to copy, so we hold the resolved
+/// batches here -- on the usdInArgs shared by every location of an op --
+/// keyed by prim path and current time. Re-cooks of a location during
+/// interactive scenegraph expansion then reuse the batches rather than
+/// re-extracting them from the stage, and a cook can warm the cache for
+/// all of its child locations in one parallel prefetch pass.
+class PxrUsdKatanaUsdInAttrCache
+{
+public:
+
+    bool FindXform(const SdfPath& path, double time,
+                   FnAttribute::GroupAttribute* attr) const;
+    void StoreXform(const SdfPath& path, double time,
+                    const FnAttribute::GroupAttribute& attr);
+
+    bool FindPrimvars(const SdfPath& path, double time,
+                      FnAttribute::Attribute* attr) const;
+    void StorePrimvars(const SdfPath& path, double time,
+                       const FnAttribute::Attribute& attr);
+
+    /// \brief Return the bound attribute for \p prim, computing and
+    /// caching it if it is not already present. Unlike the xform and
+    /// primvar batches, bound computation is centralized here so that
+    /// both cooks and prefetching share one code path (and the bbox
+    /// caches held by the usdInArgs).
+    FnAttribute::DoubleAttribute GetOrComputeBound(
+            const UsdPrim& prim,
+            const PxrUsdKatanaUsdInPrivateData& data);
+
+    /// \brief Resolve and cache the attribute batches for \p children in
+    /// parallel. \p parentData is the private data of the location being
+    /// cooked; per-child private data is constructed the same way the
+    /// cook of each child location will construct it, so the cached
+    /// entries match what those cooks will ask for.
+    void PrefetchChildren(
+            const std::vector<UsdPrim>& children,
+            const PxrUsdKatanaUsdInPrivateData& parentData);
+
+private:
+
+    struct _Entry
+    {
+        _Entry() : hasXform(false), hasBound(false), hasPrimvars(false) {}
+
+        FnAttribute::GroupAttribute xform;
+        FnAttribute::DoubleAttribute bound;
+        FnAttribute::Attribute primvars;
+        bool hasXform;
+        bool hasBound;
+        bool hasPrimvars;
+    };
+
+    typedef std::pair<SdfPath, double> _Key;
+    typedef std::map<_Key, _Entry> _Map;
+
+    mutable boost::upgrade_mutex _mutex;
+    _Map _entries;
+};
+
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXRUSDKATANA_USDIN_ATTRCACHE_H
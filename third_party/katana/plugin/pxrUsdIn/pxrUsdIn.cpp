@@ -28,6 +28,7 @@
 #include "usdKatana/cache.h"
 #include "usdKatana/locks.h"
 #include "usdKatana/readBlindData.h"
+#include "usdKatana/usdInAttrCache.h"
 #include "usdKatana/usdInPluginRegistry.h"
 
 #include "pxr/usd/usd/modelAPI.h"
@@ -594,6 +595,7 @@ public:
                 // Require a defining specifier on prims if there is no input.
                 predicate = UsdPrimIsDefined && predicate;
             }
+            std::vector<UsdPrim> createdChildren;
             TF_FOR_ALL(childIter, prim.GetFilteredChildren(predicate))
             {
                 const UsdPrim& child = *childIter;
@@ -622,6 +624,16 @@ public:
                                 child, usdInArgs,
                                 privateData),
                         PxrUsdKatanaUsdInPrivateData::Delete);
+
+                createdChildren.push_back(child);
+            }
+
+            // Warm the shared attr cache for the child locations in one
+            // parallel pass so their (serial) cooks find their xform,
+            // bound and primvar batches already resolved.
+            if (privateData && createdChildren.size() > 1) {
+                usdInArgs->GetAttrCache()->PrefetchChildren(
+                        createdChildren, *privateData);
             }
         }
 
@@ -873,25 +885,10 @@ private:
             // Special-case to pre-empt coding errors.
             return FnKat::DoubleAttribute();
         }
-        const std::vector<double>& motionSampleTimes =
-            data.GetMotionSampleTimes();
-        std::vector<GfBBox3d> bounds =
-            data.GetUsdInArgs()->ComputeBounds(prim, motionSampleTimes);
-
-        bool hasInfiniteBounds = false;
-        bool isMotionBackward = motionSampleTimes.size() > 1 &&
-            motionSampleTimes.front() > motionSampleTimes.back();
-        FnKat::DoubleAttribute boundsAttr = 
-            PxrUsdKatanaUtils::ConvertBoundsToAttribute(
-                bounds, motionSampleTimes, isMotionBackward, 
-                &hasInfiniteBounds);
-
-        // Report infinite bounds as a warning.
-        if (hasInfiniteBounds) {
-            FnLogWarn("Infinite bounds found at "<<prim.GetPath().GetString());
-        }
-
-        return boundsAttr;
+        // Bounds computation and caching are centralized on the shared
+        // attr cache so that re-cooks and child prefetching reuse them.
+        return data.GetUsdInArgs()->GetAttrCache()->GetOrComputeBound(
+            prim, data);
     }
 
     static bool _hasSiteKinds;
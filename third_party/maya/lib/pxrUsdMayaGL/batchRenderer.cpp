@@ -197,8 +197,10 @@ UsdMayaGLBatchRenderer::ShapeRenderer::PrepareForQueue(
 
         _delegate->SetRefineLevelFallback(refineLevel);
 
-        // Will only react if time actually changes.
-        _delegate->SetTime(time);
+        // Defer the time update so that all shapes prepared for this refresh
+        // get their times applied in one vectorized SetTimes() call; the
+        // delegate will only react if a time actually changes.
+        _batchRenderer->_timeUpdateQueue[this] = time;
 
         _delegate->SetRootCompensation(_rootPrim.GetPath());
 
@@ -1093,6 +1095,10 @@ UsdMayaGLBatchRenderer::_GetHitInfo(
         return NULL;
     }
 
+    // A selection can arrive before the next display refresh, so make sure
+    // any deferred time updates have been applied to the delegates first.
+    _ApplyQueuedTimeUpdates();
+
     // Selection only occurs once per display refresh, with all usd objects
     // simulataneously. If the selectQueue is not empty, that means that
     // a refresh has occurred, and we need to perform a new selection operation.
@@ -1244,6 +1250,30 @@ UsdMayaGLBatchRenderer::_GetHitInfo(
     return TfMapLookupPtr( _selectResults, sharedId );
 }
 
+void
+UsdMayaGLBatchRenderer::_ApplyQueuedTimeUpdates()
+{
+    if (_timeUpdateQueue.empty()) {
+        return;
+    }
+
+    std::vector<UsdImagingDelegate*> delegates;
+    std::vector<UsdTimeCode> times;
+    delegates.reserve(_timeUpdateQueue.size());
+    times.reserve(_timeUpdateQueue.size());
+
+    for (const auto& shapeAndTime : _timeUpdateQueue) {
+        delegates.push_back(shapeAndTime.first->_delegate.get());
+        times.push_back(shapeAndTime.second);
+    }
+
+    // Batches the time-varying update processing across every queued shape;
+    // delegates whose time is unchanged are skipped cheaply inside.
+    UsdImagingDelegate::SetTimes(delegates, times);
+
+    _timeUpdateQueue.clear();
+}
+
 void
 UsdMayaGLBatchRenderer::_RenderBatches(
         const MHWRender::MDrawContext* vp2Context,
@@ -1255,6 +1285,8 @@ UsdMayaGLBatchRenderer::_RenderBatches(
         return;
     }
 
+    _ApplyQueuedTimeUpdates();
+
     if (!_populateQueue.empty()) {
         TF_DEBUG(PXRUSDMAYAGL_QUEUE_INFO).Msg(
             "____________ POPULATE STAGE START ______________ (%zu)\n",_populateQueue.size());
@@ -434,9 +434,20 @@ private:
     typedef std::unordered_map<size_t,ShapeRenderer> _ShapeRendererMap;
     _ShapeRendererMap _shapeRendererMap;
         
+    /// \brief Applies all time updates queued by
+    /// \c ShapeRenderer::PrepareForQueue(...) in a single vectorized
+    /// \c UsdImagingDelegate::SetTimes(...) call.
+    void _ApplyQueuedTimeUpdates();
+
     /// \brief container of all delegates to be populated at next display
     /// refresh.
     std::unordered_set<ShapeRenderer *> _populateQueue;
+
+    /// \brief container of deferred per-shape time updates, applied in one
+    /// vectorized call at the next display refresh or selection so that
+    /// time-varying update processing is batched across all proxy shapes
+    /// instead of running once per shape.
+    std::unordered_map<ShapeRenderer *, UsdTimeCode> _timeUpdateQueue;
         
     /// \brief Cache of \c SdfPath objects to be rendered
     typedef std::unordered_set<SdfPath, SdfPath::Hash> _SdfPathSet;
@@ -0,0 +1,151 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+#include "pxr/pxr.h"
+#include "usdMaya/meshDataCache.h"
+
+#include "pxr/base/work/loops.h"
+#include "pxr/usd/usd/attribute.h"
+#include "pxr/usd/usdGeom/mesh.h"
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+
+// Mirrors PxrUsdMayaTranslatorUtil::GetTimeSamples, which we cannot call
+// here since it takes PxrUsdMayaPrimReaderArgs and those are constructed
+// per-prim during the serial translation loop, after prefetching.
+static void
+_GetTimeSamplesInRange(
+        const UsdAttribute& attr,
+        const bool useCustomFrameRange,
+        const double startTime,
+        const double endTime,
+        std::vector<double>* outSamples)
+{
+    if (useCustomFrameRange) {
+        std::vector<double> tempSamples;
+        attr.GetTimeSamples(&tempSamples);
+        for (double t : tempSamples) {
+            if (t >= startTime && t <= endTime) {
+                outSamples->push_back(t);
+            }
+        }
+    } else {
+        attr.GetTimeSamples(outSamples);
+    }
+}
+
+// Performs the same USD reads that PxrUsdMayaTranslatorMesh::Create would
+// otherwise perform serially, storing the results in *data.
+static void
+_ExtractMeshData(
+        const UsdGeomMesh& mesh,
+        const bool readAnimData,
+        const bool useCustomFrameRange,
+        const double startTime,
+        const double endTime,
+        PxrUsdMayaMeshData* data)
+{
+    data->faceVertexCountsVary =
+        mesh.GetFaceVertexCountsAttr().ValueMightBeTimeVarying();
+    data->faceVertexIndicesVary =
+        mesh.GetFaceVertexIndicesAttr().ValueMightBeTimeVarying();
+    if (data->faceVertexCountsVary || data->faceVertexIndicesVary) {
+        // The translator skips topologically varying meshes; there is no
+        // point in resolving the rest of the data for them.
+        return;
+    }
+
+    // For any non-topo-varying mesh, sampling at zero will get us the
+    // right answer.
+    mesh.GetFaceVertexCountsAttr().Get(&data->faceVertexCounts, 0);
+    mesh.GetFaceVertexIndicesAttr().Get(&data->faceVertexIndices, 0);
+
+    data->pointsTimeSample = UsdTimeCode::EarliestTime();
+    data->normalsTimeSample = UsdTimeCode::EarliestTime();
+    if (readAnimData) {
+        _GetTimeSamplesInRange(mesh.GetPointsAttr(),
+                useCustomFrameRange, startTime, endTime,
+                &data->pointsTimeSamples);
+        if (!data->pointsTimeSamples.empty()) {
+            data->pointsTimeSample = data->pointsTimeSamples[0];
+        }
+        std::vector<double> normalsTimeSamples;
+        _GetTimeSamplesInRange(mesh.GetNormalsAttr(),
+                useCustomFrameRange, startTime, endTime,
+                &normalsTimeSamples);
+        if (!normalsTimeSamples.empty()) {
+            data->normalsTimeSample = normalsTimeSamples[0];
+        }
+    }
+
+    mesh.GetPointsAttr().Get(&data->points, data->pointsTimeSample);
+    mesh.GetNormalsAttr().Get(&data->normals, data->normalsTimeSample);
+    mesh.GetHoleIndicesAttr().Get(&data->holeIndices);
+}
+
+void
+PxrUsdMayaMeshDataCache::Prefetch(
+        const std::vector<UsdPrim>& meshPrims,
+        const bool readAnimData,
+        const bool useCustomFrameRange,
+        const double startTime,
+        const double endTime)
+{
+    _data.clear();
+    _data.resize(meshPrims.size());
+    _indexByPath.clear();
+
+    // The index is built serially so that the parallel workers only ever
+    // write into their own pre-allocated slots.
+    for (size_t i = 0; i < meshPrims.size(); ++i) {
+        _indexByPath[meshPrims[i].GetPath()] = i;
+    }
+
+    WorkParallelForN(meshPrims.size(),
+        [this, &meshPrims, readAnimData, useCustomFrameRange,
+         startTime, endTime](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                _ExtractMeshData(UsdGeomMesh(meshPrims[i]),
+                                 readAnimData,
+                                 useCustomFrameRange,
+                                 startTime,
+                                 endTime,
+                                 &_data[i]);
+            }
+        });
+}
+
+const PxrUsdMayaMeshData*
+PxrUsdMayaMeshDataCache::Find(const SdfPath& primPath) const
+{
+    TfHashMap<SdfPath, size_t, SdfPath::Hash>::const_iterator it =
+        _indexByPath.find(primPath);
+    if (it == _indexByPath.end()) {
+        return nullptr;
+    }
+    return &_data[it->second];
+}
+
+
+PXR_NAMESPACE_CLOSE_SCOPE
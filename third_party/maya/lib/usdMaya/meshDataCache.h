@@ -0,0 +1,111 @@
+//
+// Copyright 2016 Pixar
+//
+// Licensed under the Apache License, Version 2.0 (the "Apache License")
+// with the following modification; you may not use this file except in
+// compliance with the Apache License and the following modification to it:
+// Section 6. Trademarks. is deleted and replaced with:
+//
+// 6. Trademarks. This License does not grant permission to use the trade
+//    names, trademarks, service marks, or product names of the Licensor
+//    and its affiliates, except as required to comply with Section 4(c) of
+//    the License and to reproduce the content of the NOTICE file.
+//
+// You may obtain a copy of the Apache License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the Apache License with the above modification is
+// distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied. See the Apache License for the specific
+// language governing permissions and limitations under the Apache License.
+//
+
+/// \file meshDataCache.h
+
+#ifndef PXRUSDMAYA_MESH_DATA_CACHE_H
+#define PXRUSDMAYA_MESH_DATA_CACHE_H
+
+#include "pxr/pxr.h"
+#include "usdMaya/api.h"
+
+#include "pxr/base/gf/vec3f.h"
+#include "pxr/base/tf/hashmap.h"
+#include "pxr/base/vt/array.h"
+#include "pxr/usd/sdf/path.h"
+#include "pxr/usd/usd/prim.h"
+#include "pxr/usd/usd/timeCode.h"
+
+#include <vector>
+
+PXR_NAMESPACE_OPEN_SCOPE
+
+
+/// \brief Mesh data extracted from USD ahead of Maya node creation.
+///
+/// This mirrors the values that PxrUsdMayaTranslatorMesh::Create resolves
+/// from a UsdGeomMesh before it starts making Maya API calls.
+struct PxrUsdMayaMeshData
+{
+    PxrUsdMayaMeshData() :
+        faceVertexCountsVary(false),
+        faceVertexIndicesVary(false)
+    {
+    }
+
+    VtArray<GfVec3f> points;
+    VtArray<GfVec3f> normals;
+    VtArray<int> faceVertexCounts;
+    VtArray<int> faceVertexIndices;
+    VtArray<int> holeIndices;
+
+    /// Points time samples within the requested frame range, and the
+    /// resolved sample times for the initial points/normals reads.
+    std::vector<double> pointsTimeSamples;
+    UsdTimeCode pointsTimeSample;
+    UsdTimeCode normalsTimeSample;
+
+    /// True if the corresponding topology attribute is animated; such
+    /// meshes cannot be imported and are skipped by the translator.
+    bool faceVertexCountsVary;
+    bool faceVertexIndicesVary;
+};
+
+/// \class PxrUsdMayaMeshDataCache
+/// \brief Cache of prefetched mesh data for an import job.
+///
+/// USD value resolution is thread-safe for concurrent reads but the Maya
+/// API is not thread-safe at all, so an import is bound by its serial Maya
+/// node creation loop. This cache lets usdReadJob hoist the USD-side data
+/// extraction for all meshes into a parallel phase up front; the serial
+/// translation loop then only performs the Maya API calls.
+class PxrUsdMayaMeshDataCache
+{
+public:
+    /// Extracts mesh data for all of \p meshPrims in parallel. The frame
+    /// range arguments match the corresponding PxrUsdMayaPrimReaderArgs
+    /// so that the cached time samples agree with what the translator
+    /// would have resolved itself.
+    PXRUSDMAYA_API
+    void Prefetch(
+            const std::vector<UsdPrim>& meshPrims,
+            const bool readAnimData,
+            const bool useCustomFrameRange,
+            const double startTime,
+            const double endTime);
+
+    /// Returns the prefetched data for the mesh at \p primPath, or nullptr
+    /// if that prim was not prefetched.
+    PXRUSDMAYA_API
+    const PxrUsdMayaMeshData* Find(const SdfPath& primPath) const;
+
+private:
+    std::vector<PxrUsdMayaMeshData> _data;
+    TfHashMap<SdfPath, size_t, SdfPath::Hash> _indexByPath;
+};
+
+
+PXR_NAMESPACE_CLOSE_SCOPE
+
+#endif // PXRUSDMAYA_MESH_DATA_CACHE_H
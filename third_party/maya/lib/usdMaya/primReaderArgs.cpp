@@ -24,6 +24,8 @@
 #include "pxr/pxr.h"
 #include "usdMaya/primReaderArgs.h"
 
+#include "usdMaya/meshDataCache.h"
+
 PXR_NAMESPACE_OPEN_SCOPE
 
 
@@ -34,15 +36,17 @@ PxrUsdMayaPrimReaderArgs::PxrUsdMayaPrimReaderArgs(
         const bool readAnimData,
         const bool useCustomFrameRange,
         const double startTime,
-        const double endTime)
-    : 
+        const double endTime,
+        const PxrUsdMayaMeshDataCache* meshDataCache)
+    :
         _prim(prim),
         _shadingMode(shadingMode),
         _defaultMeshScheme(defaultMeshScheme),
         _readAnimData(readAnimData),
         _useCustomFrameRange(useCustomFrameRange),
         _startTime(startTime),
-        _endTime(endTime)
+        _endTime(endTime),
+        _meshDataCache(meshDataCache)
 {
 }
 const UsdPrim&
@@ -75,11 +79,16 @@ PxrUsdMayaPrimReaderArgs::GetStartTime() const
 {
     return _startTime;
 }
-double 
+double
 PxrUsdMayaPrimReaderArgs::GetEndTime() const
 {
     return _endTime;
 }
+const PxrUsdMayaMeshData*
+PxrUsdMayaPrimReaderArgs::GetPrefetchedMeshData() const
+{
+    return _meshDataCache ? _meshDataCache->Find(_prim.GetPath()) : nullptr;
+}
 
 PXR_NAMESPACE_CLOSE_SCOPE
 
@@ -33,6 +33,9 @@
 PXR_NAMESPACE_OPEN_SCOPE
 
 
+class PxrUsdMayaMeshDataCache;
+struct PxrUsdMayaMeshData;
+
 /// \class PxrUsdMayaPrimReaderArgs
 /// \brief This class holds read-only arguments that are passed into reader plugins for
 /// the usdMaya library.
@@ -49,7 +52,8 @@ public:
             const bool readAnimData,
             const bool useCustomFrameRange,
             const double startTime,
-            const double endTime);
+            const double endTime,
+            const PxrUsdMayaMeshDataCache* meshDataCache = nullptr);
 
     /// \brief return the usd prim that should be read.
     PXRUSDMAYA_API
@@ -76,6 +80,11 @@ public:
         return false;
     }
 
+    /// \brief return mesh data prefetched for this prim by the import
+    /// job's parallel extraction phase, or nullptr if none is available.
+    PXRUSDMAYA_API
+    const PxrUsdMayaMeshData* GetPrefetchedMeshData() const;
+
 private:
     const UsdPrim& _prim;
     const TfToken& _shadingMode;
@@ -84,6 +93,7 @@ private:
     const bool _useCustomFrameRange;
     const double _startTime;
     const double _endTime;
+    const PxrUsdMayaMeshDataCache* _meshDataCache;
 };
 
 
@@ -24,6 +24,7 @@
 #include "pxr/pxr.h"
 #include "usdMaya/translatorMesh.h"
 
+#include "usdMaya/meshDataCache.h"
 #include "usdMaya/meshUtil.h"
 #include "usdMaya/roundTripUtil.h"
 #include "usdMaya/translatorGprim.h"
@@ -71,37 +72,48 @@ PxrUsdMayaTranslatorMesh::Create(
         return false;
     }
 
+    // If the import job prefetched this mesh's data in parallel up front,
+    // use it instead of resolving the same values again here; VtArray
+    // copies below just share the prefetched buffers.
+    const PxrUsdMayaMeshData* prefetched = args.GetPrefetchedMeshData();
+
     VtArray<GfVec3f> points;
     VtArray<GfVec3f> normals;
     VtArray<int>     faceVertexCounts;
     VtArray<int>     faceVertexIndices;
-    
+
     UsdAttribute fvc = mesh.GetFaceVertexCountsAttr();
-    if (fvc.ValueMightBeTimeVarying()){
+    if (prefetched ? prefetched->faceVertexCountsVary
+                   : fvc.ValueMightBeTimeVarying()){
         // at some point, it would be great, instead of failing, to create a usd/hydra proxy node
         // for the mesh, perhaps?  For now, better to give a more specific error
         MGlobal::displayError(
-            TfStringPrintf("<%s> is a topologically varying Mesh (animated faceVertexCounts). Skipping...", 
+            TfStringPrintf("<%s> is a topologically varying Mesh (animated faceVertexCounts). Skipping...",
                 prim.GetPath().GetText()).c_str());
         return false;
+    } else if (prefetched) {
+        faceVertexCounts = prefetched->faceVertexCounts;
     } else {
         // for any non-topo-varying mesh, sampling at zero will get us the right answer
         fvc.Get(&faceVertexCounts, 0);
     }
 
     UsdAttribute fvi = mesh.GetFaceVertexIndicesAttr();
-    if (fvi.ValueMightBeTimeVarying()){
+    if (prefetched ? prefetched->faceVertexIndicesVary
+                   : fvi.ValueMightBeTimeVarying()){
         // at some point, it would be great, instead of failing, to create a usd/hydra proxy node
         // for the mesh, perhaps?  For now, better to give a more specific error
         MGlobal::displayError(
-            TfStringPrintf("<%s> is a topologically varying Mesh (animated faceVertexIndices). Skipping...", 
+            TfStringPrintf("<%s> is a topologically varying Mesh (animated faceVertexIndices). Skipping...",
                 prim.GetPath().GetText()).c_str());
         return false;
+    } else if (prefetched) {
+        faceVertexIndices = prefetched->faceVertexIndices;
     } else {
         // for any non-topo-varying mesh, sampling at zero will get us the right answer
         fvi.Get(&faceVertexIndices, 0);
     }
-        
+
     // Sanity Checks. If the vertex arrays are empty, skip this mesh
     if (faceVertexCounts.size() == 0 || faceVertexIndices.size() == 0) {
         MGlobal::displayError(
@@ -118,23 +130,32 @@ PxrUsdMayaTranslatorMesh::Create(
     UsdTimeCode normalsTimeSample=UsdTimeCode::EarliestTime();
     std::vector<double> pointsTimeSamples;
     size_t pointsNumTimeSamples = 0;
-    if (args.GetReadAnimData()) {
-        PxrUsdMayaTranslatorUtil::GetTimeSamples(mesh.GetPointsAttr(), args,
-                &pointsTimeSamples);
+    if (prefetched) {
+        pointsTimeSamples = prefetched->pointsTimeSamples;
         pointsNumTimeSamples = pointsTimeSamples.size();
-        if (pointsNumTimeSamples>0) {
-            pointsTimeSample = pointsTimeSamples[0];
-        }
-    	std::vector<double> normalsTimeSamples;
-        PxrUsdMayaTranslatorUtil::GetTimeSamples(mesh.GetNormalsAttr(), args,
-                &normalsTimeSamples);
-        if (normalsTimeSamples.size()) {
-            normalsTimeSample = normalsTimeSamples[0];
+        pointsTimeSample = prefetched->pointsTimeSample;
+        normalsTimeSample = prefetched->normalsTimeSample;
+        points = prefetched->points;
+        normals = prefetched->normals;
+    } else {
+        if (args.GetReadAnimData()) {
+            PxrUsdMayaTranslatorUtil::GetTimeSamples(mesh.GetPointsAttr(),
+                    args, &pointsTimeSamples);
+            pointsNumTimeSamples = pointsTimeSamples.size();
+            if (pointsNumTimeSamples>0) {
+                pointsTimeSample = pointsTimeSamples[0];
+            }
+            std::vector<double> normalsTimeSamples;
+            PxrUsdMayaTranslatorUtil::GetTimeSamples(mesh.GetNormalsAttr(),
+                    args, &normalsTimeSamples);
+            if (normalsTimeSamples.size()) {
+                normalsTimeSample = normalsTimeSamples[0];
+            }
         }
+        mesh.GetPointsAttr().Get(&points, pointsTimeSample);
+        mesh.GetNormalsAttr().Get(&normals, normalsTimeSample);
     }
-    mesh.GetPointsAttr().Get(&points, pointsTimeSample);
-    mesh.GetNormalsAttr().Get(&normals, normalsTimeSample);
-    
+
     if (points.size() == 0) {
         MGlobal::displayError(
             TfStringPrintf("Points arrays is empty on Mesh <%s>. Skipping...", 
@@ -226,7 +247,11 @@ PxrUsdMayaTranslatorMesh::Create(
  
     // Set Holes
     VtArray<int> holeIndices;
-    mesh.GetHoleIndicesAttr().Get(&holeIndices);   // not animatable
+    if (prefetched) {
+        holeIndices = prefetched->holeIndices;
+    } else {
+        mesh.GetHoleIndicesAttr().Get(&holeIndices);   // not animatable
+    }
     if ( holeIndices.size() != 0 ) {
         MUintArray mayaHoleIndices;
         mayaHoleIndices.setLength( holeIndices.size() );
@@ -24,6 +24,7 @@
 #include "pxr/pxr.h"
 #include "usdMaya/usdReadJob.h"
 
+#include "usdMaya/meshDataCache.h"
 #include "usdMaya/primReaderRegistry.h"
 #include "usdMaya/shadingModeRegistry.h"
 #include "usdMaya/stageCache.h"
@@ -41,6 +42,7 @@
 #include "pxr/usd/usd/timeCode.h"
 #include "pxr/usd/usd/primRange.h"
 #include "pxr/usd/usd/variantSets.h"
+#include "pxr/usd/usdGeom/mesh.h"
 #include "pxr/usd/usdGeom/xform.h"
 #include "pxr/usd/usdGeom/xformCommonAPI.h"
 #include "pxr/usd/usdUtils/pipeline.h"
@@ -240,6 +242,25 @@ bool usdReadJob::doIt(std::vector<MDagPath>* addedDagPaths)
 bool usdReadJob::_DoImport(UsdPrimRange& range,
                            const UsdPrim& usdRootPrim)
 {
+    // Extract the mesh data for the whole import up front, in parallel.
+    // The per-prim readers below are serialized by the Maya API, so pulling
+    // the USD-side value resolution out of that loop is the main
+    // opportunity for threading the import. Meshes that end up imported as
+    // assemblies are prefetched unnecessarily, but that extra work is
+    // bounded and happens off the serial path anyway.
+    PxrUsdMayaMeshDataCache meshDataCache;
+    std::vector<UsdPrim> meshPrims;
+    for (auto primIt = range.begin(); primIt != range.end(); ++primIt) {
+        if (primIt->IsA<UsdGeomMesh>()) {
+            meshPrims.push_back(*primIt);
+        }
+    }
+    meshDataCache.Prefetch(meshPrims,
+                           mArgs.readAnimData,
+                           mArgs.useCustomFrameRange,
+                           mArgs.startTime,
+                           mArgs.endTime);
+
     for (auto primIt = range.begin(); primIt != range.end(); ++primIt) {
         const UsdPrim& prim = *primIt;
 
@@ -249,7 +270,8 @@ bool usdReadJob::_DoImport(UsdPrimRange& range,
                                       mArgs.readAnimData,
                                       mArgs.useCustomFrameRange,
                                       mArgs.startTime,
-                                      mArgs.endTime);
+                                      mArgs.endTime,
+                                      &meshDataCache);
         PxrUsdMayaPrimReaderContext ctx(&mNewNodeRegistry);
 
         // If we are NOT importing on behalf of an assembly, then we'll create